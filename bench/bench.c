@@ -0,0 +1,223 @@
+/**
+ * @file bench.c
+ * @brief Microbenchmark harness
+ */
+
+#include "bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/utsname.h>
+
+// ============================================
+// Configuration
+// ============================================
+
+#define BENCH_MAX_RESULTS       128
+#define BENCH_MAX_ITERS         (1u << 30)
+
+// ============================================
+// Private Types & Variables
+// ============================================
+
+typedef struct {
+    char group[24];
+    char name[40];
+    bool skipped;
+    char reason[96];
+    uint32_t iters;                     // Iterations per measured run
+    double ns_per_op;                   // Median over repeats
+    double ns_per_op_min;               // Best run
+    size_t bytes_per_op;
+} bench_result_t;
+
+static bench_options_t s_options = BENCH_DEFAULT_OPTIONS();
+static bench_result_t s_results[BENCH_MAX_RESULTS];
+static size_t s_result_count = 0;
+static volatile uint32_t s_sink = 0;
+
+// ============================================
+// Private Functions
+// ============================================
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static bool case_selected(const char *group, const char *name)
+{
+    if (s_options.filter == NULL || s_options.filter[0] == '\0') {
+        return true;
+    }
+    char full[80];
+    snprintf(full, sizeof(full), "%s/%s", group, name);
+    return strstr(full, s_options.filter) != NULL;
+}
+
+static bench_result_t *new_result(const char *group, const char *name)
+{
+    if (s_result_count >= BENCH_MAX_RESULTS) {
+        return NULL;
+    }
+    bench_result_t *r = &s_results[s_result_count++];
+    memset(r, 0, sizeof(*r));
+    snprintf(r->group, sizeof(r->group), "%s", group);
+    snprintf(r->name, sizeof(r->name), "%s", name);
+    return r;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static double mb_per_s(const bench_result_t *r)
+{
+    if (r->bytes_per_op == 0 || r->ns_per_op <= 0.0) {
+        return 0.0;
+    }
+    return (double)r->bytes_per_op * 1000.0 / r->ns_per_op;
+}
+
+// ============================================
+// Public Functions
+// ============================================
+
+void bench_init(const bench_options_t *options)
+{
+    if (options) {
+        s_options = *options;
+    }
+    if (s_options.repeats == 0) {
+        s_options.repeats = 1;
+    }
+    s_result_count = 0;
+    printf("%-10s %-28s %12s %12s %12s %10s\n",
+           "group", "case", "iters", "ns/op", "best ns/op", "MB/s");
+}
+
+void bench_run(const char *group, const char *name, size_t bytes_per_op,
+               bench_fn_t fn, void *ctx)
+{
+    if (!case_selected(group, name)) {
+        return;
+    }
+    bench_result_t *r = new_result(group, name);
+    if (r == NULL) {
+        return;
+    }
+    r->bytes_per_op = bytes_per_op;
+
+    // Warm caches and lazy allocations, then grow the count until one run
+    // covers the minimum time
+    fn(ctx, 1);
+    uint64_t target_ns = (uint64_t)s_options.min_time_ms * 1000000ull;
+    uint32_t iters = 1;
+    for (;;) {
+        uint64_t start = now_ns();
+        fn(ctx, iters);
+        uint64_t elapsed = now_ns() - start;
+        if (elapsed >= target_ns || iters >= BENCH_MAX_ITERS) {
+            break;
+        }
+        uint64_t next = elapsed > 0 ? (uint64_t)iters * target_ns * 12 / 10 / elapsed : (uint64_t)iters * 10;
+        if (next > (uint64_t)iters * 10) {
+            next = (uint64_t)iters * 10;
+        }
+        if (next <= iters) {
+            next = iters + 1;
+        }
+        iters = next > BENCH_MAX_ITERS ? BENCH_MAX_ITERS : (uint32_t)next;
+    }
+
+    double samples[16];
+    uint32_t repeats = s_options.repeats > 16 ? 16 : s_options.repeats;
+    for (uint32_t i = 0; i < repeats; i++) {
+        uint64_t start = now_ns();
+        fn(ctx, iters);
+        samples[i] = (double)(now_ns() - start) / iters;
+    }
+    qsort(samples, repeats, sizeof(double), compare_double);
+    r->iters = iters;
+    r->ns_per_op = samples[repeats / 2];
+    r->ns_per_op_min = samples[0];
+
+    printf("%-10s %-28s %12u %12.1f %12.1f %10.1f\n",
+           group, name, iters, r->ns_per_op, r->ns_per_op_min, mb_per_s(r));
+    fflush(stdout);
+}
+
+void bench_skip(const char *group, const char *name, const char *reason)
+{
+    if (!case_selected(group, name)) {
+        return;
+    }
+    bench_result_t *r = new_result(group, name);
+    if (r == NULL) {
+        return;
+    }
+    r->skipped = true;
+    snprintf(r->reason, sizeof(r->reason), "%s", reason);
+    printf("%-10s %-28s skipped: %s\n", group, name, reason);
+}
+
+bool bench_group_selected(const char *group)
+{
+    if (s_options.filter == NULL || s_options.filter[0] == '\0') {
+        return true;
+    }
+    // Without a '/' the filter may match a case name in any group
+    const char *slash = strchr(s_options.filter, '/');
+    if (slash == NULL) {
+        return true;
+    }
+    char prefix[24];
+    snprintf(prefix, sizeof(prefix), "%.*s", (int)(slash - s_options.filter), s_options.filter);
+    return strstr(group, prefix) != NULL;
+}
+
+void bench_sink(uint32_t value)
+{
+    s_sink += value;
+}
+
+int bench_write_json(const char *path)
+{
+    FILE *f = strcmp(path, "-") == 0 ? stdout : fopen(path, "w");
+    if (f == NULL) {
+        fprintf(stderr, "bench: cannot write %s\n", path);
+        return -1;
+    }
+
+    struct utsname uts;
+    if (uname(&uts) != 0) {
+        memset(&uts, 0, sizeof(uts));
+    }
+    fprintf(f, "{\n  \"host\": {\"sysname\": \"%s\", \"machine\": \"%s\"},\n",
+            uts.sysname, uts.machine);
+    fprintf(f, "  \"min_time_ms\": %u,\n  \"repeats\": %u,\n  \"results\": [",
+            s_options.min_time_ms, s_options.repeats);
+    for (size_t i = 0; i < s_result_count; i++) {
+        const bench_result_t *r = &s_results[i];
+        fprintf(f, "%s\n    {\"group\": \"%s\", \"name\": \"%s\", ", i ? "," : "", r->group, r->name);
+        if (r->skipped) {
+            fprintf(f, "\"skipped\": true, \"reason\": \"%s\"}", r->reason);
+        } else {
+            fprintf(f, "\"iterations\": %u, \"ns_per_op\": %.2f, \"ns_per_op_min\": %.2f, "
+                    "\"bytes_per_op\": %zu, \"mb_per_s\": %.2f}",
+                    r->iters, r->ns_per_op, r->ns_per_op_min, r->bytes_per_op, mb_per_s(r));
+        }
+    }
+    fprintf(f, "\n  ]\n}\n");
+    if (f != stdout) {
+        fclose(f);
+    }
+    return 0;
+}
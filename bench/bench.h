@@ -0,0 +1,106 @@
+/**
+ * @file bench.h
+ * @brief Microbenchmark harness for the host bench target
+ *
+ * Each case is a function that runs its kernel `iters` times. The harness
+ * calibrates the iteration count until a run lasts at least the minimum
+ * time, repeats the measurement and keeps the median and the best run.
+ * Results are printed as a table and optionally written as JSON.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Benchmark case body
+ *
+ * @param ctx Case context
+ * @param iters Number of operations to run
+ */
+typedef void (*bench_fn_t)(void *ctx, uint32_t iters);
+
+/**
+ * @brief Harness options
+ */
+typedef struct {
+    uint32_t min_time_ms;               // Minimum duration of one measured run
+    uint32_t repeats;                   // Measured runs per case
+    const char *filter;                 // Substring of "group/name" (NULL: all)
+} bench_options_t;
+
+#define BENCH_DEFAULT_OPTIONS() { \
+    .min_time_ms = 200,           \
+    .repeats = 5,                 \
+    .filter = NULL,               \
+}
+
+/**
+ * @brief Initialize the harness
+ */
+void bench_init(const bench_options_t *options);
+
+/**
+ * @brief Run one case
+ *
+ * @param group Kernel group (e.g. "g711")
+ * @param name Case name (e.g. "encode_960")
+ * @param bytes_per_op Input bytes per operation, 0 if throughput is meaningless
+ * @param fn Case body
+ * @param ctx Case context
+ */
+void bench_run(const char *group, const char *name, size_t bytes_per_op,
+               bench_fn_t fn, void *ctx);
+
+/**
+ * @brief Record a case that cannot run in this build
+ *
+ * @param group Kernel group
+ * @param name Case name
+ * @param reason Why the case was skipped
+ */
+void bench_skip(const char *group, const char *name, const char *reason);
+
+/**
+ * @brief Check whether a group has any case selected by the filter
+ *
+ * Lets a suite skip expensive setup when it is filtered out.
+ */
+bool bench_group_selected(const char *group);
+
+/**
+ * @brief Keep a result alive so the compiler cannot drop the kernel
+ */
+void bench_sink(uint32_t value);
+
+/**
+ * @brief Write all results as JSON
+ *
+ * @param path Output file ("-" for stdout)
+ * @return 0 on success
+ */
+int bench_write_json(const char *path);
+
+// ============================================
+// Suites
+// ============================================
+
+void bench_suite_codec(void);           // G.711, base64, cJSON event parsing
+void bench_suite_dsp(void);             // Recorder DSP
+void bench_suite_resample(void);        // audio_resample
+void bench_suite_video(void);           // convert_color, RGB565 swap
+void bench_suite_overlay(void);         // Text overlay drawing
+void bench_suite_queue(void);           // msg_q, data_queue, share_q
+void bench_suite_rtc(void);             // WebRTC data channel events
+void bench_suite_ui(void);              // Speaking page transcript
+void bench_suite_trace(void);           // Trace ring events vs. log lines
+
+#ifdef __cplusplus
+}
+#endif
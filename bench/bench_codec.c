@@ -0,0 +1,200 @@
+/**
+ * @file bench_codec.c
+ * @brief G.711, base64 and cJSON event parsing
+ *
+ * The G.711 kernels are static in coze_ws.c, so the source is compiled into
+ * this translation unit; the same build also reaches the receive path
+ * (handle_received_message) end to end. Needs cJSON, like the providers in
+ * the replay harness.
+ */
+
+#include "bench.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#if BENCH_HAVE_CJSON
+
+#include "../components/coze_ws/coze_ws.c"
+#include "azure_protocol.h"
+
+// ============================================
+// Configuration
+// ============================================
+
+#define FRAME_SAMPLES       480         // One 60 ms pipeline frame at 8 kHz
+#define BATCH_SAMPLES       (FRAME_SAMPLES * AUDIO_BATCH_FRAMES)
+#define DELTA_BYTES         800         // 100 ms of μ-law per server delta
+
+// ============================================
+// Fixtures
+// ============================================
+
+static int16_t s_pcm[BATCH_SAMPLES];
+static uint8_t s_ulaw[BATCH_SAMPLES];
+static char s_b64[BATCH_SAMPLES * 2];
+static size_t s_b64_len;
+static char s_coze_delta[4096];
+static char s_azure_delta[4096];
+static char s_json_out[WS_BUFFER_SIZE];
+
+static void build_fixtures(void)
+{
+    for (int i = 0; i < BATCH_SAMPLES; i++) {
+        double t = (double)i / 8000.0;
+        s_pcm[i] = (int16_t)(8000.0 * sin(2.0 * M_PI * 440.0 * t) + 2000.0 * sin(2.0 * M_PI * 1700.0 * t));
+        s_ulaw[i] = linear_to_ulaw(s_pcm[i]);
+    }
+    int n = coze_protocol_base64_encode(s_ulaw, DELTA_BYTES, s_b64, sizeof(s_b64));
+    s_b64_len = n > 0 ? (size_t)n : 0;
+
+    snprintf(s_coze_delta, sizeof(s_coze_delta),
+             "{\"id\":\"evt_0123456789\",\"event_type\":\"conversation.audio.delta\","
+             "\"data\":{\"id\":\"msg_0123456789\",\"role\":\"assistant\",\"type\":\"answer\","
+             "\"content\":\"\",\"delta\":\"%s\"},\"detail\":{\"logid\":\"20251017000000\"}}", s_b64);
+    snprintf(s_azure_delta, sizeof(s_azure_delta),
+             "{\"type\":\"response.audio.delta\",\"event_id\":\"event_0123456789\","
+             "\"response_id\":\"resp_0123456789\",\"item_id\":\"item_0123456789\","
+             "\"output_index\":0,\"content_index\":0,\"delta\":\"%s\"}", s_b64);
+}
+
+// ============================================
+// Cases
+// ============================================
+
+static void g711_encode(void *ctx, uint32_t iters)
+{
+    uint32_t acc = 0;
+    for (uint32_t n = 0; n < iters; n++) {
+        for (int i = 0; i < FRAME_SAMPLES; i++) {
+            s_ulaw[i] = linear_to_ulaw(s_pcm[i]);
+        }
+        acc += s_ulaw[n % FRAME_SAMPLES];
+    }
+    bench_sink(acc);
+}
+
+static void g711_decode(void *ctx, uint32_t iters)
+{
+    static int16_t pcm[DELTA_BYTES];
+    uint32_t acc = 0;
+    for (uint32_t n = 0; n < iters; n++) {
+        for (int i = 0; i < DELTA_BYTES; i++) {
+            pcm[i] = ulaw_to_linear(s_ulaw[i]);
+        }
+        acc += (uint16_t)pcm[n % DELTA_BYTES];
+    }
+    bench_sink(acc);
+}
+
+static void base64_encode(void *ctx, uint32_t iters)
+{
+    static char out[BATCH_SAMPLES * 2];
+    uint32_t acc = 0;
+    for (uint32_t n = 0; n < iters; n++) {
+        acc += coze_protocol_base64_encode(s_ulaw, BATCH_SAMPLES, out, sizeof(out));
+    }
+    bench_sink(acc);
+}
+
+static void base64_decode(void *ctx, uint32_t iters)
+{
+    static uint8_t out[BATCH_SAMPLES];
+    uint32_t acc = 0;
+    for (uint32_t n = 0; n < iters; n++) {
+        acc += coze_protocol_base64_decode(s_b64, s_b64_len, out, sizeof(out));
+    }
+    bench_sink(acc);
+}
+
+static void cjson_coze_delta(void *ctx, uint32_t iters)
+{
+    static uint8_t out[2048];
+    char event_type[64];
+    uint32_t acc = 0;
+    for (uint32_t n = 0; n < iters; n++) {
+        size_t size = 0;
+        coze_protocol_parse_event_type(s_coze_delta, event_type, sizeof(event_type));
+        coze_protocol_parse_audio_delta(s_coze_delta, out, &size, sizeof(out));
+        acc += size;
+    }
+    bench_sink(acc);
+}
+
+static void cjson_azure_delta(void *ctx, uint32_t iters)
+{
+    static uint8_t out[2048];
+    char event_type[64];
+    uint32_t acc = 0;
+    for (uint32_t n = 0; n < iters; n++) {
+        size_t size = sizeof(out);
+        azure_protocol_parse_event_type(s_azure_delta, event_type, sizeof(event_type));
+        azure_protocol_parse_audio_delta(s_azure_delta, out, &size);
+        acc += size;
+    }
+    bench_sink(acc);
+}
+
+static void cjson_coze_append(void *ctx, uint32_t iters)
+{
+    uint32_t acc = 0;
+    for (uint32_t n = 0; n < iters; n++) {
+        acc += coze_protocol_build_audio_append(s_json_out, sizeof(s_json_out), s_ulaw, BATCH_SAMPLES);
+    }
+    bench_sink(acc);
+}
+
+static void coze_rx_event(const coze_event_t *event, void *user_data)
+{
+    bench_sink((uint32_t)event->audio_size);
+}
+
+static void coze_rx_delta(void *ctx, uint32_t iters)
+{
+    int len = (int)strlen(s_coze_delta);
+    s_event_callback = coze_rx_event;
+    for (uint32_t n = 0; n < iters; n++) {
+        handle_received_message(s_coze_delta, len);
+    }
+    bench_sink((uint32_t)len);
+}
+
+// ============================================
+// Suite
+// ============================================
+
+void bench_suite_codec(void)
+{
+    if (!bench_group_selected("g711") && !bench_group_selected("base64") &&
+        !bench_group_selected("cjson")) {
+        return;
+    }
+    build_fixtures();
+
+    bench_run("g711", "encode_frame_480", FRAME_SAMPLES * sizeof(int16_t), g711_encode, NULL);
+    bench_run("g711", "decode_delta_800", DELTA_BYTES, g711_decode, NULL);
+    bench_run("base64", "encode_batch_960", BATCH_SAMPLES, base64_encode, NULL);
+    bench_run("base64", "decode_delta_800", s_b64_len, base64_decode, NULL);
+    bench_run("cjson", "coze_audio_delta", strlen(s_coze_delta), cjson_coze_delta, NULL);
+    bench_run("cjson", "azure_audio_delta", strlen(s_azure_delta), cjson_azure_delta, NULL);
+    bench_run("cjson", "coze_build_append", BATCH_SAMPLES, cjson_coze_append, NULL);
+    bench_run("cjson", "coze_rx_delta", strlen(s_coze_delta), coze_rx_delta, NULL);
+}
+
+#else
+
+void bench_suite_codec(void)
+{
+    static const char *const cases[][2] = {
+        {"g711", "encode_frame_480"}, {"g711", "decode_delta_800"},
+        {"base64", "encode_batch_960"}, {"base64", "decode_delta_800"},
+        {"cjson", "coze_audio_delta"}, {"cjson", "azure_audio_delta"},
+        {"cjson", "coze_build_append"}, {"cjson", "coze_rx_delta"},
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_skip(cases[i][0], cases[i][1], "built without cJSON");
+    }
+}
+
+#endif
@@ -0,0 +1,121 @@
+/**
+ * @file bench_dsp.c
+ * @brief Recorder DSP (high-pass, AEC, noise suppression, energy, VAD)
+ *
+ * The DSP stages are static in audio_recorder.c, so the source is compiled
+ * into this translation unit. Each case processes one 60 ms frame.
+ */
+
+#include "bench.h"
+
+#include <math.h>
+
+#include "../components/audio_pipeline/audio_recorder.c"
+
+// audio_recorder.c resolves the microphone through app_main
+esp_codec_dev_handle_t app_get_mic_codec(void)
+{
+    return NULL;
+}
+
+// ============================================
+// Fixtures
+// ============================================
+
+#define FRAME_SAMPLES   (AUDIO_FRAME_BYTES / sizeof(int16_t))
+
+static int16_t s_mic[FRAME_SAMPLES];
+static int16_t s_ref[FRAME_SAMPLES];
+static int16_t s_work[FRAME_SAMPLES];
+
+static void build_fixtures(void)
+{
+    uint32_t seed = 1;
+    for (size_t i = 0; i < FRAME_SAMPLES; i++) {
+        double t = (double)i / AUDIO_SAMPLE_RATE;
+        seed = seed * 1664525u + 1013904223u;
+        int noise = (int)(seed >> 22) - 512;
+        s_ref[i] = (int16_t)(6000.0 * sin(2.0 * M_PI * 300.0 * t));
+        s_mic[i] = (int16_t)(4000.0 * sin(2.0 * M_PI * 220.0 * t) + s_ref[i] / 2 + noise + 300);
+    }
+}
+
+// ============================================
+// Cases
+// ============================================
+
+static void dsp_highpass(void *ctx, uint32_t iters)
+{
+    for (uint32_t n = 0; n < iters; n++) {
+        memcpy(s_work, s_mic, sizeof(s_work));
+        apply_highpass_filter(s_work, FRAME_SAMPLES);
+    }
+    bench_sink((uint16_t)s_work[0]);
+}
+
+static void dsp_aec(void *ctx, uint32_t iters)
+{
+    for (uint32_t n = 0; n < iters; n++) {
+        memcpy(s_work, s_mic, sizeof(s_work));
+        apply_aec(s_work, s_ref, FRAME_SAMPLES, 2);
+    }
+    bench_sink((uint16_t)s_work[0]);
+}
+
+static void dsp_noise_suppression(void *ctx, uint32_t iters)
+{
+    for (uint32_t n = 0; n < iters; n++) {
+        memcpy(s_work, s_mic, sizeof(s_work));
+        apply_noise_suppression(s_work, FRAME_SAMPLES, 2);
+    }
+    bench_sink((uint16_t)s_work[0]);
+}
+
+static void dsp_energy(void *ctx, uint32_t iters)
+{
+    uint32_t acc = 0;
+    for (uint32_t n = 0; n < iters; n++) {
+        acc += calculate_energy(s_mic, FRAME_SAMPLES);
+    }
+    bench_sink(acc);
+}
+
+static void dsp_vad_update(void *ctx, uint32_t iters)
+{
+    for (uint32_t n = 0; n < iters; n++) {
+        update_vad_state((n & 64) ? 2000 : 20);
+    }
+    bench_sink(s_vad_state);
+}
+
+// Same stage order as recorder_task with AEC, NS and VAD enabled
+static void dsp_frame_chain(void *ctx, uint32_t iters)
+{
+    for (uint32_t n = 0; n < iters; n++) {
+        memcpy(s_work, s_mic, sizeof(s_work));
+        apply_highpass_filter(s_work, FRAME_SAMPLES);
+        apply_aec(s_work, s_ref, FRAME_SAMPLES, 2);
+        apply_noise_suppression(s_work, FRAME_SAMPLES, 2);
+        update_vad_state(calculate_energy(s_work, FRAME_SAMPLES));
+    }
+    bench_sink((uint16_t)s_work[0]);
+}
+
+// ============================================
+// Suite
+// ============================================
+
+void bench_suite_dsp(void)
+{
+    if (!bench_group_selected("dsp")) {
+        return;
+    }
+    build_fixtures();
+
+    bench_run("dsp", "highpass_frame", AUDIO_FRAME_BYTES, dsp_highpass, NULL);
+    bench_run("dsp", "aec_frame", AUDIO_FRAME_BYTES, dsp_aec, NULL);
+    bench_run("dsp", "noise_suppression_frame", AUDIO_FRAME_BYTES, dsp_noise_suppression, NULL);
+    bench_run("dsp", "energy_frame", AUDIO_FRAME_BYTES, dsp_energy, NULL);
+    bench_run("dsp", "vad_update", 0, dsp_vad_update, NULL);
+    bench_run("dsp", "frame_chain", AUDIO_FRAME_BYTES, dsp_frame_chain, NULL);
+}
@@ -0,0 +1,75 @@
+/**
+ * @file bench_main.c
+ * @brief Host microbenchmarks for the firmware's hot kernels
+ *
+ *   bench [--filter group/name] [--min-time-ms N] [--repeats N] [--json out.json]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "host_shim.h"
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --filter STR       run cases whose \"group/name\" contains STR\n"
+            "  --min-time-ms N    minimum duration of one measured run (default 200)\n"
+            "  --repeats N        measured runs per case, median reported (default 5)\n"
+            "  --json PATH        write results as JSON (\"-\" for stdout)\n",
+            argv0);
+}
+
+int main(int argc, char **argv)
+{
+    bench_options_t options = BENCH_DEFAULT_OPTIONS();
+    const char *json_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (strcmp(arg, "--filter") == 0 && val) {
+            options.filter = val;
+            i++;
+        } else if (strcmp(arg, "--min-time-ms") == 0 && val) {
+            options.min_time_ms = (uint32_t)atoi(val);
+            i++;
+        } else if (strcmp(arg, "--repeats") == 0 && val) {
+            options.repeats = (uint32_t)atoi(val);
+            i++;
+        } else if (strcmp(arg, "--json") == 0 && val) {
+            json_path = val;
+            i++;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    // Kernels log on error paths only; keep the table readable
+    host_log_set_level(ESP_LOG_WARN);
+    host_task_register_current("bench");
+    if (host_media_lib_os_register() != ESP_OK) {
+        fprintf(stderr, "bench: media_lib OS port registration failed\n");
+        return 1;
+    }
+
+    bench_init(&options);
+    bench_suite_codec();
+    bench_suite_dsp();
+    bench_suite_resample();
+    bench_suite_video();
+    bench_suite_overlay();
+    bench_suite_queue();
+    bench_suite_rtc();
+    bench_suite_ui();
+    bench_suite_trace();
+
+    if (json_path && bench_write_json(json_path) != 0) {
+        return 1;
+    }
+    return 0;
+}
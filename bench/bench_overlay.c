@@ -0,0 +1,158 @@
+/**
+ * @file bench_overlay.c
+ * @brief esp_capture text overlay drawing
+ *
+ * A 320x48 caption strip with a clock that ticks once per second, as
+ * drawn over a 30 fps stream. The draw cases time one clock update: drawn
+ * immediately (every glyph of the strip) and between draw_start and
+ * draw_finished, where only the changed digits are redrawn, both from
+ * glyphs in the overlay's decoded glyph cache. draw_glyphs_uncached fills
+ * the strip with more distinct glyphs than the cache holds, so every glyph
+ * is decoded from the packed font on each draw. The frame_30fps cases are
+ * the drawing cost per frame with an update on every 30th frame: redrawn
+ * every frame, against drawn on updates only (incrementally).
+ */
+
+#include "bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_capture_text_overlay.h"
+
+// ============================================
+// Configuration
+// ============================================
+
+#define OVERLAY_WIDTH      320
+#define OVERLAY_HEIGHT     48
+#define OVERLAY_FONT_SIZE  24
+#define OVERLAY_FPS        30
+#define OVERLAY_GLYPHS     (2 * OVERLAY_WIDTH / (OVERLAY_FONT_SIZE / 2))
+
+// ============================================
+// Context
+// ============================================
+
+typedef struct {
+    esp_capture_overlay_if_t *overlay;
+    uint32_t                  seconds;
+    uint32_t                  frame_no;
+} overlay_ctx_t;
+
+static void draw_clock(overlay_ctx_t *c, bool batched)
+{
+    esp_capture_rgn_t rgn = {.width = OVERLAY_WIDTH, .height = OVERLAY_HEIGHT};
+    esp_capture_text_overlay_draw_info_t info = {
+        .color = COLOR_RGB565_WHITE,
+        .font_size = OVERLAY_FONT_SIZE,
+        .x = 8,
+        .y = 12,
+    };
+    uint32_t s = c->seconds;
+    if (batched) {
+        esp_capture_text_overlay_draw_start(c->overlay);
+    }
+    esp_capture_text_overlay_clear(c->overlay, &rgn, COLOR_RGB565_BLACK);
+    esp_capture_text_overlay_draw_text_fmt(c->overlay, &info, "2026-10-17 %02u:%02u:%02u", (unsigned)(s / 3600 % 24),
+                                           (unsigned)(s / 60 % 60), (unsigned)(s % 60));
+    if (batched) {
+        esp_capture_text_overlay_draw_finished(c->overlay);
+    }
+}
+
+// ============================================
+// Draw
+// ============================================
+
+static void overlay_draw_immediate(void *ctx, uint32_t iters)
+{
+    overlay_ctx_t *c = (overlay_ctx_t *)ctx;
+    for (uint32_t n = 0; n < iters; n++) {
+        c->seconds++;
+        draw_clock(c, false);
+    }
+}
+
+static void overlay_draw_incremental(void *ctx, uint32_t iters)
+{
+    overlay_ctx_t *c = (overlay_ctx_t *)ctx;
+    for (uint32_t n = 0; n < iters; n++) {
+        c->seconds++;
+        draw_clock(c, true);
+    }
+}
+
+static void overlay_draw_uncached(void *ctx, uint32_t iters)
+{
+    overlay_ctx_t *c = (overlay_ctx_t *)ctx;
+    esp_capture_text_overlay_draw_info_t info = {
+        .color = COLOR_RGB565_WHITE,
+        .font_size = OVERLAY_FONT_SIZE,
+    };
+    // Two lines of 26 cells, cycled through in order: least recently used is always next
+    char text[OVERLAY_GLYPHS + 1];
+    for (int i = 0; i < OVERLAY_GLYPHS; i++) {
+        text[i] = (char)('!' + i);
+    }
+    text[OVERLAY_GLYPHS] = '\0';
+    for (uint32_t n = 0; n < iters; n++) {
+        esp_capture_text_overlay_draw_text(c->overlay, &info, text);
+    }
+}
+
+// ============================================
+// Per Frame
+// ============================================
+
+static void overlay_frame_full(void *ctx, uint32_t iters)
+{
+    overlay_ctx_t *c = (overlay_ctx_t *)ctx;
+    for (uint32_t n = 0; n < iters; n++) {
+        if (c->frame_no++ % OVERLAY_FPS == 0) {
+            c->seconds++;
+        }
+        // Without change tracking the text is drawn for every frame
+        draw_clock(c, false);
+    }
+}
+
+static void overlay_frame_incremental(void *ctx, uint32_t iters)
+{
+    overlay_ctx_t *c = (overlay_ctx_t *)ctx;
+    for (uint32_t n = 0; n < iters; n++) {
+        if (c->frame_no++ % OVERLAY_FPS == 0) {
+            c->seconds++;
+            draw_clock(c, true);
+        }
+    }
+}
+
+// ============================================
+// Suite
+// ============================================
+
+void bench_suite_overlay(void)
+{
+    if (!bench_group_selected("overlay")) {
+        return;
+    }
+    overlay_ctx_t c = {0};
+    esp_capture_rgn_t rgn = {.width = OVERLAY_WIDTH, .height = OVERLAY_HEIGHT};
+    c.overlay = esp_capture_new_text_overlay(&rgn);
+    if (c.overlay == NULL || c.overlay->open(c.overlay) != ESP_CAPTURE_ERR_OK) {
+        bench_skip("overlay", "*", "no memory");
+    } else {
+        bench_run("overlay", "draw_clock_immediate", 0, overlay_draw_immediate, &c);
+        bench_run("overlay", "draw_clock_incremental", 0, overlay_draw_incremental, &c);
+        bench_run("overlay", "draw_glyphs_uncached", 0, overlay_draw_uncached, &c);
+
+        bench_run("overlay", "frame_30fps_redraw", 0, overlay_frame_full, &c);
+        bench_run("overlay", "frame_30fps_incremental", 0, overlay_frame_incremental, &c);
+    }
+    if (c.overlay) {
+        c.overlay->close(c.overlay);
+    }
+    free(c.overlay);
+}
@@ -0,0 +1,282 @@
+/**
+ * @file bench_queue.c
+ * @brief msg_q, data_queue and share_q throughput
+ *
+ * Each case moves `iters` items from a producer thread to the calling
+ * thread (or, for share_q, to 1-4 consumer threads), so ns/op is the
+ * per-item cost including wake-ups.
+ *
+ * share_q runs both ways esp_capture can use it: its own consumer queues
+ * and external msg_q queues, which is how the capture paths (WebRTC send
+ * plus the muxer) are fed. The producer never waits for frame pacing, so
+ * the numbers are the saturated upper bound of what an audio (50 fps) or
+ * video (30 fps) source thread spends per frame in the fan-out. The inline
+ * cases add, receive and release on one thread: the bookkeeping alone,
+ * without wake-ups.
+ */
+
+#include "bench.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "msg_q.h"
+#include "data_queue.h"
+#include "share_q.h"
+
+// ============================================
+// Configuration
+// ============================================
+
+#define QUEUE_DEPTH         16
+#define FRAME_BYTES         960         // One 60 ms pipeline frame
+#define SHARE_Q_DEPTH       5           // As esp_capture configures its share queues
+#define FANOUT_MAX_USERS    4
+
+// ============================================
+// msg_q
+// ============================================
+
+typedef struct {
+    msg_q_handle_t q;
+    uint32_t iters;
+} msg_q_ctx_t;
+
+static void *msg_q_producer(void *arg)
+{
+    msg_q_ctx_t *c = (msg_q_ctx_t *)arg;
+    for (uint32_t n = 0; n < c->iters; n++) {
+        void *msg = (void *)(uintptr_t)(n + 1);
+        msg_q_send(c->q, &msg, sizeof(msg));
+    }
+    return NULL;
+}
+
+static void queue_msg_q(void *ctx, uint32_t iters)
+{
+    msg_q_ctx_t c = {
+        .q = msg_q_create(QUEUE_DEPTH, sizeof(void *)),
+        .iters = iters,
+    };
+    if (c.q == NULL) {
+        return;
+    }
+    pthread_t producer;
+    pthread_create(&producer, NULL, msg_q_producer, &c);
+    uintptr_t acc = 0;
+    for (uint32_t n = 0; n < iters; n++) {
+        void *msg = NULL;
+        msg_q_recv(c.q, &msg, sizeof(msg), false);
+        acc += (uintptr_t)msg;
+    }
+    pthread_join(producer, NULL);
+    msg_q_destroy(c.q);
+    bench_sink((uint32_t)acc);
+}
+
+// ============================================
+// data_queue
+// ============================================
+
+typedef struct {
+    data_queue_t *q;
+    uint32_t iters;
+} data_q_ctx_t;
+
+static void *data_q_producer(void *arg)
+{
+    data_q_ctx_t *c = (data_q_ctx_t *)arg;
+    for (uint32_t n = 0; n < c->iters; n++) {
+        uint8_t *buf = (uint8_t *)data_queue_get_buffer(c->q, FRAME_BYTES);
+        if (buf == NULL) {
+            break;
+        }
+        memset(buf, (int)n, FRAME_BYTES);
+        data_queue_send_buffer(c->q, FRAME_BYTES);
+    }
+    return NULL;
+}
+
+static void queue_data_queue(void *ctx, uint32_t iters)
+{
+    data_q_ctx_t c = {
+        .q = data_queue_init((FRAME_BYTES + 16) * QUEUE_DEPTH),
+        .iters = iters,
+    };
+    if (c.q == NULL) {
+        return;
+    }
+    pthread_t producer;
+    pthread_create(&producer, NULL, data_q_producer, &c);
+    uint32_t acc = 0;
+    for (uint32_t n = 0; n < iters; n++) {
+        void *buf = NULL;
+        int size = 0;
+        if (data_queue_read_lock(c.q, &buf, &size) != 0) {
+            break;
+        }
+        acc += ((uint8_t *)buf)[size - 1];
+        data_queue_read_unlock(c.q);
+    }
+    pthread_join(producer, NULL);
+    data_queue_deinit(c.q);
+    bench_sink(acc);
+}
+
+// ============================================
+// share_q
+// ============================================
+
+typedef struct {
+    void *data;
+    uint32_t seq;
+} share_frame_t;
+
+typedef struct {
+    share_q_handle_t q;
+    msg_q_handle_t ext_q;               // External queue, NULL for the share_q's own
+    uint32_t iters;
+    uint8_t index;
+} share_user_t;
+
+typedef struct {
+    uint8_t users;
+    bool external;
+} share_case_t;
+
+static void *share_get_frame_data(void *item)
+{
+    return ((share_frame_t *)item)->data;
+}
+
+static int share_release_frame(void *item, void *ctx)
+{
+    return 0;
+}
+
+static void *share_consumer(void *arg)
+{
+    share_user_t *u = (share_user_t *)arg;
+    uint32_t acc = 0;
+    for (uint32_t n = 0; n < u->iters; n++) {
+        share_frame_t frame;
+        int ret = u->ext_q ? msg_q_recv(u->ext_q, &frame, sizeof(frame), false)
+                           : share_q_recv(u->q, u->index, &frame);
+        if (ret != 0) {
+            break;
+        }
+        acc += frame.seq;
+        share_q_release(u->q, &frame);
+    }
+    bench_sink(acc);
+    return NULL;
+}
+
+static void queue_share_q(void *ctx, uint32_t iters)
+{
+    const share_case_t *c = (const share_case_t *)ctx;
+    share_q_cfg_t cfg = {
+        .user_count = c->users,
+        .q_count = SHARE_Q_DEPTH,
+        .item_size = sizeof(share_frame_t),
+        .get_frame_data = share_get_frame_data,
+        .release_frame = share_release_frame,
+        .use_external_q = c->external,
+    };
+    share_q_handle_t q = share_q_create(&cfg);
+    if (q == NULL) {
+        return;
+    }
+    pthread_t consumers[FANOUT_MAX_USERS];
+    share_user_t users[FANOUT_MAX_USERS];
+    for (uint8_t i = 0; i < c->users; i++) {
+        users[i] = (share_user_t){.q = q, .iters = iters, .index = i};
+        if (c->external) {
+            users[i].ext_q = msg_q_create(SHARE_Q_DEPTH, sizeof(share_frame_t));
+            share_q_set_external(q, i, users[i].ext_q);
+        }
+        share_q_enable(q, i, true);
+        pthread_create(&consumers[i], NULL, share_consumer, &users[i]);
+    }
+    for (uint32_t n = 0; n < iters; n++) {
+        // Frame identity is the data pointer; unique within the queue depth
+        share_frame_t frame = {
+            .data = (void *)(uintptr_t)(n % (SHARE_Q_DEPTH * 2) + 1),
+            .seq = n,
+        };
+        share_q_add(q, &frame);
+    }
+    for (int i = 0; i < c->users; i++) {
+        pthread_join(consumers[i], NULL);
+    }
+    share_q_destroy(q);
+    for (int i = 0; i < c->users; i++) {
+        if (users[i].ext_q) {
+            msg_q_destroy(users[i].ext_q);
+        }
+    }
+}
+
+static void queue_share_q_inline(void *ctx, uint32_t iters)
+{
+    const share_case_t *c = (const share_case_t *)ctx;
+    share_q_cfg_t cfg = {
+        .user_count = c->users,
+        .q_count = SHARE_Q_DEPTH,
+        .item_size = sizeof(share_frame_t),
+        .get_frame_data = share_get_frame_data,
+        .release_frame = share_release_frame,
+    };
+    share_q_handle_t q = share_q_create(&cfg);
+    if (q == NULL) {
+        return;
+    }
+    for (uint8_t i = 0; i < c->users; i++) {
+        share_q_enable(q, i, true);
+    }
+    uint32_t acc = 0;
+    for (uint32_t n = 0; n < iters; n++) {
+        share_frame_t frame = {
+            .data = (void *)(uintptr_t)(n % (SHARE_Q_DEPTH * 2) + 1),
+            .seq = n,
+        };
+        share_q_add(q, &frame);
+        for (uint8_t i = 0; i < c->users; i++) {
+            share_q_recv(q, i, &frame);
+            acc += frame.seq;
+            share_q_release(q, &frame);
+        }
+    }
+    bench_sink(acc);
+    share_q_destroy(q);
+}
+
+// ============================================
+// Suite
+// ============================================
+
+void bench_suite_queue(void)
+{
+    if (!bench_group_selected("queue")) {
+        return;
+    }
+
+    bench_run("queue", "msg_q_ptr_spsc", sizeof(void *), queue_msg_q, NULL);
+    bench_run("queue", "data_queue_frame_spsc", FRAME_BYTES, queue_data_queue, NULL);
+    static share_case_t share_cases[2][FANOUT_MAX_USERS];
+    for (int ext = 0; ext < 2; ext++) {
+        for (uint8_t users = 1; users <= FANOUT_MAX_USERS; users++) {
+            char name[32];
+            snprintf(name, sizeof(name), "share_q_%sfanout_%u", ext ? "ext_" : "", users);
+            share_cases[ext][users - 1] = (share_case_t){.users = users, .external = ext};
+            bench_run("queue", name, sizeof(share_frame_t), queue_share_q, &share_cases[ext][users - 1]);
+        }
+    }
+    for (uint8_t users = 1; users <= FANOUT_MAX_USERS; users++) {
+        char name[32];
+        snprintf(name, sizeof(name), "share_q_inline_%u", users);
+        bench_run("queue", name, sizeof(share_frame_t), queue_share_q_inline, &share_cases[0][users - 1]);
+    }
+}
@@ -0,0 +1,180 @@
+/**
+ * @file bench_resample.c
+ * @brief audio_resample conversions (channel, rate, bit depth)
+ *
+ * The fused kernels (audio_resample_fused.c) have no dependency and always
+ * run. audio_resample.c itself chains the prebuilt esp_audio_effects
+ * converters for everything else; those ship as target libraries only, so
+ * the chain cases, fused and generic side by side for the same tuples, run
+ * when the bench is configured with BENCH_ESP_AE_DIR pointing at a host
+ * build of esp_audio_effects and are reported as skipped otherwise.
+ */
+
+#include "bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "audio_resample_fused.h"
+
+#define FRAME_MS        20
+
+static void fill_pcm(uint8_t *pcm, int size)
+{
+    int16_t *s = (int16_t *)pcm;
+    for (int k = 0; k < size / 2; k++) {
+        s[k] = (int16_t)((k * 2654435761u) >> 16);
+    }
+}
+
+// ============================================
+// Fused Kernels
+// ============================================
+
+typedef struct {
+    const char *name;
+    av_render_audio_frame_info_t in;
+    av_render_audio_frame_info_t out;
+    resample_fused_handle_t handle;
+    uint8_t *pcm;
+    uint8_t *dst;
+    int size;
+} fused_case_t;
+
+static fused_case_t s_fused_cases[] = {
+    {"fused_16k_stereo_to_8k_mono", {2, 16, 16000}, {1, 16, 8000}},
+    {"fused_8k_mono_to_16k_stereo", {1, 16, 8000}, {2, 16, 16000}},
+    {"fused_16k_mono_to_24k_stereo", {1, 16, 16000}, {2, 16, 24000}},
+    {"fused_48k_stereo_to_16k_mono", {2, 16, 48000}, {1, 16, 16000}},
+    {"fused_16k_stereo_to_16k_mono", {2, 16, 16000}, {1, 16, 16000}},
+};
+
+static void fused_frame(void *ctx, uint32_t iters)
+{
+    fused_case_t *c = (fused_case_t *)ctx;
+    for (uint32_t n = 0; n < iters; n++) {
+        bench_sink((uint32_t)resample_fused_process(c->handle, c->pcm, c->size, c->dst));
+    }
+}
+
+static void bench_fused(void)
+{
+    for (size_t i = 0; i < sizeof(s_fused_cases) / sizeof(s_fused_cases[0]); i++) {
+        fused_case_t *c = &s_fused_cases[i];
+        c->size = c->in.sample_rate * FRAME_MS / 1000 * c->in.channel * (c->in.bits_per_sample >> 3);
+        c->pcm = (uint8_t *)calloc(1, c->size);
+        c->handle = resample_fused_open(&c->in, &c->out);
+        c->dst = c->handle ? (uint8_t *)malloc(resample_fused_max_out_size(c->handle, c->size)) : NULL;
+        if (c->pcm == NULL || c->dst == NULL) {
+            bench_skip("resample", c->name, "open failed");
+        } else {
+            fill_pcm(c->pcm, c->size);
+            bench_run("resample", c->name, c->size, fused_frame, c);
+        }
+        resample_fused_close(c->handle);
+        free(c->dst);
+        free(c->pcm);
+    }
+}
+
+#if BENCH_HAVE_ESP_AE
+
+#include "audio_resample.h"
+
+// ============================================
+// Fixtures
+// ============================================
+
+typedef struct {
+    const char *name;
+    av_render_audio_frame_info_t in;
+    av_render_audio_frame_info_t out;
+    audio_resample_handle_t handle;
+    uint8_t *pcm;
+    int size;
+    bool generic_only;
+} resample_case_t;
+
+static resample_case_t s_cases[] = {
+    {"48k_stereo_to_16k_mono", {2, 16, 48000}, {1, 16, 16000}},
+    {"16k_mono_to_48k_stereo", {1, 16, 16000}, {2, 16, 48000}},
+    {"16k_mono_to_8k_mono", {1, 16, 16000}, {1, 16, 8000}},
+    {"8k_mono_to_16k_mono", {1, 16, 8000}, {1, 16, 16000}},
+    {"16k_stereo_to_16k_mono", {2, 16, 16000}, {1, 16, 16000}},
+    {"generic_16k_stereo_to_8k_mono", {2, 16, 16000}, {1, 16, 8000}, .generic_only = true},
+    {"generic_8k_mono_to_16k_stereo", {1, 16, 8000}, {2, 16, 16000}, .generic_only = true},
+    {"generic_16k_mono_to_24k_stereo", {1, 16, 16000}, {2, 16, 24000}, .generic_only = true},
+    {"generic_48k_stereo_to_16k_mono", {2, 16, 48000}, {1, 16, 16000}, .generic_only = true},
+    {"generic_16k_stereo_to_16k_mono", {2, 16, 16000}, {1, 16, 16000}, .generic_only = true},
+};
+
+static int resample_sink(av_render_audio_frame_t *frame, void *ctx)
+{
+    bench_sink((uint32_t)frame->size);
+    return 0;
+}
+
+// ============================================
+// Cases
+// ============================================
+
+static void resample_frame(void *ctx, uint32_t iters)
+{
+    resample_case_t *c = (resample_case_t *)ctx;
+    for (uint32_t n = 0; n < iters; n++) {
+        av_render_audio_frame_t frame = {
+            .pts = n * FRAME_MS,
+            .data = c->pcm,
+            .size = c->size,
+        };
+        audio_resample_write(c->handle, &frame);
+    }
+}
+
+// ============================================
+// Suite
+// ============================================
+
+void bench_suite_resample(void)
+{
+    if (!bench_group_selected("resample")) {
+        return;
+    }
+    bench_fused();
+    for (size_t i = 0; i < sizeof(s_cases) / sizeof(s_cases[0]); i++) {
+        resample_case_t *c = &s_cases[i];
+        audio_resample_cfg_t cfg = {
+            .input_info = c->in,
+            .output_info = c->out,
+            .resample_cb = resample_sink,
+            .ctx = c,
+            .generic_only = c->generic_only,
+        };
+        c->size = c->in.sample_rate * FRAME_MS / 1000 * c->in.channel * (c->in.bits_per_sample >> 3);
+        c->pcm = (uint8_t *)calloc(1, c->size);
+        c->handle = audio_resample_open(&cfg);
+        if (c->pcm == NULL || c->handle == NULL) {
+            bench_skip("resample", c->name, "open failed");
+        } else {
+            fill_pcm(c->pcm, c->size);
+            bench_run("resample", c->name, c->size, resample_frame, c);
+        }
+        if (c->handle) {
+            audio_resample_close(c->handle);
+        }
+        free(c->pcm);
+    }
+}
+
+#else
+
+void bench_suite_resample(void)
+{
+    if (!bench_group_selected("resample")) {
+        return;
+    }
+    bench_fused();
+    bench_skip("resample", "chain", "esp_audio_effects not available (set BENCH_ESP_AE_DIR)");
+}
+
+#endif
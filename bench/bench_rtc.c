@@ -0,0 +1,386 @@
+/**
+ * @file bench_rtc.c
+ * @brief WebRTC data channel event handling
+ *
+ * Replays the server events of two Realtime API turns (a spoken answer and
+ * a function call) through the data channel receive path. The cjson cases
+ * reproduce the handler as it was before rtc_event_router: process_json
+ * parses every message, the transcript pass parses it again and prints the
+ * tree back to text to strstr for the transcript, and function arguments are
+ * parsed a third time. The router cases scan each message once, dispatch
+ * through the event table and run function calls through the compile-time
+ * tool registry (azure_tools.cpp). Before timing, the router's type, delta,
+ * transcript and arguments are checked against cJSON for every message and
+ * the generated session.update is parsed back.
+ */
+
+#include "bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rtc_event_router.h"
+#include "azure_tools.h"
+
+#if BENCH_HAVE_CJSON
+#include <cJSON.h>
+#endif
+
+// ============================================
+// Fixtures
+// ============================================
+
+// One spoken answer followed by a function call turn, in arrival order
+static const char *const s_turn[] = {
+    "{\"type\":\"input_audio_buffer.speech_started\",\"event_id\":\"event_B1x0\",\"audio_start_ms\":1088,\"item_id\":\"item_B1x1\"}",
+    "{\"type\":\"input_audio_buffer.speech_stopped\",\"event_id\":\"event_B1x2\",\"audio_end_ms\":3712,\"item_id\":\"item_B1x1\"}",
+    "{\"type\":\"input_audio_buffer.committed\",\"event_id\":\"event_B1x3\",\"previous_item_id\":null,\"item_id\":\"item_B1x1\"}",
+    "{\"type\":\"conversation.item.created\",\"event_id\":\"event_B1x4\",\"previous_item_id\":null,\"item\":{\"id\":\"item_B1x1\",\"object\":\"realtime.item\",\"type\":\"message\",\"status\":\"completed\",\"role\":\"user\",\"content\":[{\"type\":\"input_audio\",\"transcript\":null}]}}",
+    "{\"type\":\"response.created\",\"event_id\":\"event_B1x5\",\"response\":{\"object\":\"realtime.response\",\"id\":\"resp_B1x6\",\"status\":\"in_progress\",\"status_details\":null,\"output\":[],\"conversation_id\":\"conv_B1x7\",\"modalities\":[\"text\",\"audio\"],\"voice\":\"alloy\",\"output_audio_format\":\"pcm16\",\"temperature\":0.8,\"max_output_tokens\":\"inf\",\"usage\":null,\"metadata\":null}}",
+    "{\"type\":\"rate_limits.updated\",\"event_id\":\"event_B1x8\",\"rate_limits\":[{\"name\":\"requests\",\"limit\":10000,\"remaining\":9999,\"reset_seconds\":0.006},{\"name\":\"tokens\",\"limit\":2000000,\"remaining\":1995344,\"reset_seconds\":0.139}]}",
+    "{\"type\":\"response.output_item.added\",\"event_id\":\"event_B1x9\",\"response_id\":\"resp_B1x6\",\"output_index\":0,\"item\":{\"id\":\"item_B1xA\",\"object\":\"realtime.item\",\"type\":\"message\",\"status\":\"in_progress\",\"role\":\"assistant\",\"content\":[]}}",
+    "{\"type\":\"conversation.item.created\",\"event_id\":\"event_B1xB\",\"previous_item_id\":\"item_B1x1\",\"item\":{\"id\":\"item_B1xA\",\"object\":\"realtime.item\",\"type\":\"message\",\"status\":\"in_progress\",\"role\":\"assistant\",\"content\":[]}}",
+    "{\"type\":\"response.content_part.added\",\"event_id\":\"event_B1xC\",\"response_id\":\"resp_B1x6\",\"item_id\":\"item_B1xA\",\"output_index\":0,\"content_index\":0,\"part\":{\"type\":\"audio\",\"transcript\":\"\"}}",
+    "{\"type\":\"output_audio_buffer.started\",\"event_id\":\"event_B1xD\",\"response_id\":\"resp_B1x6\"}",
+    "{\"type\":\"response.audio_transcript.delta\",\"event_id\":\"event_B1xE\",\"response_id\":\"resp_B1x6\",\"item_id\":\"item_B1xA\",\"output_index\":0,\"content_index\":0,\"delta\":\"It\\u2019s\"}",
+    "{\"type\":\"response.audio_transcript.delta\",\"event_id\":\"event_B1xF\",\"response_id\":\"resp_B1x6\",\"item_id\":\"item_B1xA\",\"output_index\":0,\"content_index\":0,\"delta\":\" currently\"}",
+    "{\"type\":\"response.audio_transcript.delta\",\"event_id\":\"event_B1xG\",\"response_id\":\"resp_B1x6\",\"item_id\":\"item_B1xA\",\"output_index\":0,\"content_index\":0,\"delta\":\" 21\"}",
+    "{\"type\":\"response.audio_transcript.delta\",\"event_id\":\"event_B1xH\",\"response_id\":\"resp_B1x6\",\"item_id\":\"item_B1xA\",\"output_index\":0,\"content_index\":0,\"delta\":\"\\u00b0C\"}",
+    "{\"type\":\"response.audio_transcript.delta\",\"event_id\":\"event_B1xI\",\"response_id\":\"resp_B1x6\",\"item_id\":\"item_B1xA\",\"output_index\":0,\"content_index\":0,\"delta\":\" and\"}",
+    "{\"type\":\"response.audio_transcript.delta\",\"event_id\":\"event_B1xJ\",\"response_id\":\"resp_B1x6\",\"item_id\":\"item_B1xA\",\"output_index\":0,\"content_index\":0,\"delta\":\" \\\"partly\"}",
+    "{\"type\":\"response.audio_transcript.delta\",\"event_id\":\"event_B1xK\",\"response_id\":\"resp_B1x6\",\"item_id\":\"item_B1xA\",\"output_index\":0,\"content_index\":0,\"delta\":\" cloudy\\\"\"}",
+    "{\"type\":\"response.audio_transcript.delta\",\"event_id\":\"event_B1xL\",\"response_id\":\"resp_B1x6\",\"item_id\":\"item_B1xA\",\"output_index\":0,\"content_index\":0,\"delta\":\" outside\"}",
+    "{\"type\":\"response.audio_transcript.delta\",\"event_id\":\"event_B1xM\",\"response_id\":\"resp_B1x6\",\"item_id\":\"item_B1xA\",\"output_index\":0,\"content_index\":0,\"delta\":\".\"}",
+    "{\"type\":\"response.audio.done\",\"event_id\":\"event_B1xN\",\"response_id\":\"resp_B1x6\",\"item_id\":\"item_B1xA\",\"output_index\":0,\"content_index\":0}",
+    "{\"type\":\"response.audio_transcript.done\",\"event_id\":\"event_B1xO\",\"response_id\":\"resp_B1x6\",\"item_id\":\"item_B1xA\",\"output_index\":0,\"content_index\":0,\"transcript\":\"It\\u2019s currently 21\\u00b0C and \\\"partly cloudy\\\" outside.\"}",
+    "{\"type\":\"response.content_part.done\",\"event_id\":\"event_B1xP\",\"response_id\":\"resp_B1x6\",\"item_id\":\"item_B1xA\",\"output_index\":0,\"content_index\":0,\"part\":{\"type\":\"audio\",\"transcript\":\"It\\u2019s currently 21\\u00b0C and \\\"partly cloudy\\\" outside.\"}}",
+    "{\"type\":\"response.output_item.done\",\"event_id\":\"event_B1xQ\",\"response_id\":\"resp_B1x6\",\"output_index\":0,\"item\":{\"id\":\"item_B1xA\",\"object\":\"realtime.item\",\"type\":\"message\",\"status\":\"completed\",\"role\":\"assistant\",\"content\":[{\"type\":\"audio\",\"transcript\":\"It\\u2019s currently 21\\u00b0C and \\\"partly cloudy\\\" outside.\"}]}}",
+    "{\"type\":\"response.done\",\"event_id\":\"event_B1xR\",\"response\":{\"object\":\"realtime.response\",\"id\":\"resp_B1x6\",\"status\":\"completed\",\"status_details\":null,\"output\":[{\"id\":\"item_B1xA\",\"object\":\"realtime.item\",\"type\":\"message\",\"status\":\"completed\",\"role\":\"assistant\",\"content\":[{\"type\":\"audio\",\"transcript\":\"It\\u2019s currently 21\\u00b0C and \\\"partly cloudy\\\" outside.\"}]}],\"conversation_id\":\"conv_B1x7\",\"modalities\":[\"text\",\"audio\"],\"voice\":\"alloy\",\"output_audio_format\":\"pcm16\",\"temperature\":0.8,\"max_output_tokens\":\"inf\",\"usage\":{\"total_tokens\":1093,\"input_tokens\":921,\"output_tokens\":172,\"input_token_details\":{\"text_tokens\":724,\"audio_tokens\":197,\"cached_tokens\":0},\"output_token_details\":{\"text_tokens\":37,\"audio_tokens\":135}},\"metadata\":null}}",
+    "{\"type\":\"output_audio_buffer.stopped\",\"event_id\":\"event_B1xS\",\"response_id\":\"resp_B1x6\"}",
+    "{\"type\":\"input_audio_buffer.speech_started\",\"event_id\":\"event_B2x0\",\"audio_start_ms\":9120,\"item_id\":\"item_B2x1\"}",
+    "{\"type\":\"input_audio_buffer.speech_stopped\",\"event_id\":\"event_B2x2\",\"audio_end_ms\":11040,\"item_id\":\"item_B2x1\"}",
+    "{\"type\":\"input_audio_buffer.committed\",\"event_id\":\"event_B2x3\",\"previous_item_id\":\"item_B1xA\",\"item_id\":\"item_B2x1\"}",
+    "{\"type\":\"response.created\",\"event_id\":\"event_B2x4\",\"response\":{\"object\":\"realtime.response\",\"id\":\"resp_B2x5\",\"status\":\"in_progress\",\"status_details\":null,\"output\":[],\"conversation_id\":\"conv_B1x7\",\"modalities\":[\"text\",\"audio\"],\"voice\":\"alloy\",\"output_audio_format\":\"pcm16\",\"temperature\":0.8,\"max_output_tokens\":\"inf\",\"usage\":null,\"metadata\":null}}",
+    "{\"type\":\"response.output_item.added\",\"event_id\":\"event_B2x6\",\"response_id\":\"resp_B2x5\",\"output_index\":0,\"item\":{\"id\":\"item_B2x7\",\"object\":\"realtime.item\",\"type\":\"function_call\",\"status\":\"in_progress\",\"name\":\"SetLightState\",\"call_id\":\"call_B2x8\",\"arguments\":\"\"}}",
+    "{\"type\":\"response.function_call_arguments.delta\",\"event_id\":\"event_B2x9\",\"response_id\":\"resp_B2x5\",\"item_id\":\"item_B2x7\",\"output_index\":0,\"call_id\":\"call_B2x8\",\"delta\":\"{\\\"LightState\\\":true,\"}",
+    "{\"type\":\"response.function_call_arguments.delta\",\"event_id\":\"event_B2xA\",\"response_id\":\"resp_B2x5\",\"item_id\":\"item_B2x7\",\"output_index\":0,\"call_id\":\"call_B2x8\",\"delta\":\"\\\"LightColor\\\":{\\\"red\\\":255,\\\"green\\\":180,\\\"blue\\\":40}}\"}",
+    "{\"type\":\"response.function_call_arguments.done\",\"event_id\":\"event_B2xB\",\"response_id\":\"resp_B2x5\",\"item_id\":\"item_B2x7\",\"output_index\":0,\"call_id\":\"call_B2x8\",\"name\":\"SetLightState\",\"arguments\":\"{\\\"LightState\\\":true,\\\"LightColor\\\":{\\\"red\\\":255,\\\"green\\\":180,\\\"blue\\\":40}}\"}",
+    "{\"type\":\"response.output_item.done\",\"event_id\":\"event_B2xC\",\"response_id\":\"resp_B2x5\",\"output_index\":0,\"item\":{\"id\":\"item_B2x7\",\"object\":\"realtime.item\",\"type\":\"function_call\",\"status\":\"completed\",\"name\":\"SetLightState\",\"call_id\":\"call_B2x8\",\"arguments\":\"{\\\"LightState\\\":true,\\\"LightColor\\\":{\\\"red\\\":255,\\\"green\\\":180,\\\"blue\\\":40}}\"}}",
+    "{\"type\":\"response.done\",\"event_id\":\"event_B2xD\",\"response\":{\"object\":\"realtime.response\",\"id\":\"resp_B2x5\",\"status\":\"completed\",\"status_details\":null,\"output\":[{\"id\":\"item_B2x7\",\"object\":\"realtime.item\",\"type\":\"function_call\",\"status\":\"completed\",\"name\":\"SetLightState\",\"call_id\":\"call_B2x8\",\"arguments\":\"{\\\"LightState\\\":true,\\\"LightColor\\\":{\\\"red\\\":255,\\\"green\\\":180,\\\"blue\\\":40}}\"}],\"conversation_id\":\"conv_B1x7\",\"modalities\":[\"text\",\"audio\"],\"voice\":\"alloy\",\"output_audio_format\":\"pcm16\",\"temperature\":0.8,\"max_output_tokens\":\"inf\",\"usage\":{\"total_tokens\":1188,\"input_tokens\":1160,\"output_tokens\":28},\"metadata\":null}}",
+};
+
+#define TURN_EVENTS         (sizeof(s_turn) / sizeof(s_turn[0]))
+#define DELTA_EVENT         11          // A transcript delta
+#define CALL_EVENT          32          // function_call_arguments.done
+
+static size_t s_turn_bytes;
+
+// ============================================
+// Router Path
+// ============================================
+
+static uint32_t router_transcript(rtc_span_t span)
+{
+    char inline_buf[256];
+    char *text = span.len < sizeof(inline_buf) ? inline_buf : malloc(span.len + 1);
+    if (text == NULL) {
+        return 0;
+    }
+    uint32_t n = (uint32_t)rtc_span_unescape(span, text, span.len + 1);
+    if (text != inline_buf) {
+        free(text);
+    }
+    return n;
+}
+
+static uint32_t router_call(const rtc_event_t *event)
+{
+    char name[64];
+    char args[AZURE_TOOLS_ARGS_MAX];
+    if (event->arguments.len >= sizeof(args)) {
+        return 0;
+    }
+    size_t name_len = rtc_span_unescape(event->name, name, sizeof(name));
+    size_t args_len = rtc_span_unescape(event->arguments, args, sizeof(args));
+    return azure_tools_call(name, name_len, args, args_len) == ESP_OK ? (uint32_t)args_len : 0;
+}
+
+static uint32_t router_handle(const char *data, size_t size)
+{
+    rtc_event_t event;
+    if (rtc_event_parse(data, size, &event) != ESP_OK) {
+        return 0;
+    }
+    switch (event.type) {
+        case RTC_EVENT_TRANSCRIPT_DELTA:
+            return router_transcript(event.delta);
+        case RTC_EVENT_TRANSCRIPT_DONE:
+        case RTC_EVENT_INPUT_TRANSCRIPT_DONE:
+            return router_transcript(event.transcript);
+        case RTC_EVENT_FUNCTION_ARGS_DONE:
+            return router_call(&event);
+        default:
+            return (uint32_t)event.type;
+    }
+}
+
+static void router_turn(void *ctx, uint32_t iters)
+{
+    uint32_t acc = 0;
+    for (uint32_t n = 0; n < iters; n++) {
+        for (size_t i = 0; i < TURN_EVENTS; i++) {
+            acc += router_handle(s_turn[i], strlen(s_turn[i]));
+        }
+    }
+    bench_sink(acc);
+}
+
+static void router_one(void *ctx, uint32_t iters)
+{
+    const char *msg = (const char *)ctx;
+    size_t len = strlen(msg);
+    uint32_t acc = 0;
+    for (uint32_t n = 0; n < iters; n++) {
+        acc += router_handle(msg, len);
+    }
+    bench_sink(acc);
+}
+
+#if BENCH_HAVE_CJSON
+
+// ============================================
+// cJSON Path (webrtc_data_handler before the router)
+// ============================================
+
+// Function classes webrtc_azure.c had before the tool registry, reduced to
+// their attribute names
+typedef struct {
+    const char *name;
+    const char *attrs[3];
+    bool parent;                        // attrs[1] holds a red / green / blue object
+} call_class_t;
+
+static const call_class_t s_call_classes[] = {
+    { "SetLightState", { "LightState", "LightColor" }, true },
+    { "SetVolume",     { "volume" },                   false },
+    { "OpenDoor",      { "open" },                     false },
+};
+
+#define CALL_CLASSES        (sizeof(s_call_classes) / sizeof(s_call_classes[0]))
+
+static const char *const s_color_attrs[] = { "red", "green", "blue" };
+
+static uint32_t cjson_apply(const cJSON *obj, const char *const *attrs, size_t attr_num, bool parent)
+{
+    uint32_t acc = 0;
+    for (size_t i = 0; i < attr_num && attrs[i]; i++) {
+        const cJSON *v = cJSON_GetObjectItemCaseSensitive(obj, attrs[i]);
+        if (cJSON_IsNumber(v)) {
+            acc += (uint32_t)v->valueint;
+        } else if (cJSON_IsTrue(v)) {
+            acc++;
+        } else if (cJSON_IsObject(v) && parent) {
+            acc += cjson_apply(v, s_color_attrs, 3, false);
+        }
+    }
+    return acc;
+}
+
+static uint32_t cjson_process_json(const char *json_data)
+{
+    cJSON *root = cJSON_Parse(json_data);
+    if (!root) {
+        return 0;
+    }
+    const cJSON *type = cJSON_GetObjectItemCaseSensitive(root, "type");
+    if (!cJSON_IsString(type) || strcmp(type->valuestring, "response.function_call_arguments.done") != 0) {
+        cJSON_Delete(root);
+        return 0;
+    }
+    // The handler logged the whole event
+    char *payload = cJSON_PrintUnformatted(root);
+    free(payload);
+
+    uint32_t acc = 0;
+    const cJSON *name = cJSON_GetObjectItemCaseSensitive(root, "name");
+    const cJSON *arguments = cJSON_GetObjectItemCaseSensitive(root, "arguments");
+    cJSON *args_root = cJSON_IsString(arguments) ? cJSON_Parse(arguments->valuestring) : NULL;
+    if (args_root && cJSON_IsString(name)) {
+        for (size_t i = 0; i < CALL_CLASSES; i++) {
+            if (strcmp(s_call_classes[i].name, name->valuestring) == 0) {
+                acc += cjson_apply(args_root, s_call_classes[i].attrs, 3, s_call_classes[i].parent);
+            }
+        }
+    }
+    cJSON_Delete(args_root);
+    cJSON_Delete(root);
+    return acc;
+}
+
+static uint32_t cjson_handle(const char *data)
+{
+    uint32_t acc = cjson_process_json(data);
+
+    cJSON *root = cJSON_Parse(data);
+    if (!root) {
+        return acc;
+    }
+    const cJSON *type = cJSON_GetObjectItemCaseSensitive(root, "type");
+    if (cJSON_IsString(type)) {
+        acc += (uint32_t)strlen(type->valuestring);     // track_turn_latency's strcmp chain
+    }
+    char *payload = cJSON_PrintUnformatted(root);
+    if (payload) {
+        char *text = strstr(payload, "transcript\":");
+        if (text) {
+            text += strlen("transcript\":");
+            char *start = strchr(text, '"');
+            char *end = start ? strchr(start + 1, '"') : NULL;
+            if (end) {
+                start++;
+                int len = (int)(end - start);
+                char *transcript = malloc(len + 1);
+                if (transcript) {
+                    memcpy(transcript, start, len);
+                    transcript[len] = '\0';
+                    acc += (uint32_t)len;
+                    free(transcript);
+                }
+            }
+        }
+        free(payload);
+    }
+    cJSON_Delete(root);
+    return acc;
+}
+
+static void cjson_turn(void *ctx, uint32_t iters)
+{
+    uint32_t acc = 0;
+    for (uint32_t n = 0; n < iters; n++) {
+        for (size_t i = 0; i < TURN_EVENTS; i++) {
+            acc += cjson_handle(s_turn[i]);
+        }
+    }
+    bench_sink(acc);
+}
+
+static void cjson_one(void *ctx, uint32_t iters)
+{
+    const char *msg = (const char *)ctx;
+    uint32_t acc = 0;
+    for (uint32_t n = 0; n < iters; n++) {
+        acc += cjson_handle(msg);
+    }
+    bench_sink(acc);
+}
+
+// ============================================
+// Cross-check
+// ============================================
+
+static bool span_matches(rtc_span_t span, const cJSON *item)
+{
+    if (!cJSON_IsString(item)) {
+        return span.ptr == NULL;
+    }
+    char buf[1024];
+    rtc_span_unescape(span, buf, sizeof(buf));
+    return strcmp(buf, item->valuestring) == 0;
+}
+
+/**
+ * @brief Check the router against cJSON on every fixture message
+ */
+static bool router_agrees(void)
+{
+    // The compile-time schema must be valid JSON offering the same tools
+    cJSON *update = cJSON_Parse(azure_tools_session_update(NULL));
+    const cJSON *session = cJSON_GetObjectItemCaseSensitive(update, "session");
+    const cJSON *tool = cJSON_GetObjectItemCaseSensitive(session, "tools");
+    size_t tools = 0;
+    for (tool = tool ? tool->child : NULL; tool; tool = tool->next, tools++) {
+        const cJSON *name = cJSON_GetObjectItemCaseSensitive(tool, "name");
+        if (tools >= CALL_CLASSES || !cJSON_IsString(name) ||
+            strcmp(name->valuestring, s_call_classes[tools].name) != 0) {
+            break;
+        }
+    }
+    cJSON_Delete(update);
+    if (tools != CALL_CLASSES) {
+        fprintf(stderr, "bench: tool schema does not match the function classes\n");
+        return false;
+    }
+
+    for (size_t i = 0; i < TURN_EVENTS; i++) {
+        rtc_event_t event;
+        cJSON *root = cJSON_Parse(s_turn[i]);
+        bool ok = root != NULL && rtc_event_parse(s_turn[i], strlen(s_turn[i]), &event) == ESP_OK;
+        if (ok) {
+            const cJSON *type = cJSON_GetObjectItemCaseSensitive(root, "type");
+            ok = cJSON_IsString(type) && strcmp(rtc_event_name(event.type), type->valuestring) == 0 &&
+                 span_matches(event.delta, cJSON_GetObjectItemCaseSensitive(root, "delta")) &&
+                 span_matches(event.transcript, cJSON_GetObjectItemCaseSensitive(root, "transcript")) &&
+                 span_matches(event.name, cJSON_GetObjectItemCaseSensitive(root, "name")) &&
+                 span_matches(event.arguments, cJSON_GetObjectItemCaseSensitive(root, "arguments"));
+        }
+        cJSON_Delete(root);
+        if (!ok) {
+            fprintf(stderr, "bench: router and cJSON disagree on message %zu\n", i);
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif // BENCH_HAVE_CJSON
+
+// ============================================
+// Suite
+// ============================================
+
+void bench_suite_rtc(void)
+{
+    if (!bench_group_selected("rtc")) {
+        return;
+    }
+
+    char turn_name[32];
+    s_turn_bytes = 0;
+    for (size_t i = 0; i < TURN_EVENTS; i++) {
+        s_turn_bytes += strlen(s_turn[i]);
+    }
+    snprintf(turn_name, sizeof(turn_name), "turn_%zu_events", TURN_EVENTS);
+
+    if (rtc_event_router_init() != ESP_OK) {
+        bench_skip("rtc", "router", "event table not built");
+        return;
+    }
+
+    static char cjson_turn_name[48];
+    static char router_turn_name[48];
+    snprintf(cjson_turn_name, sizeof(cjson_turn_name), "cjson_%s", turn_name);
+    snprintf(router_turn_name, sizeof(router_turn_name), "router_%s", turn_name);
+
+#if BENCH_HAVE_CJSON
+    if (!router_agrees()) {
+        bench_skip("rtc", "router", "router output differs from cJSON");
+        return;
+    }
+    bench_run("rtc", cjson_turn_name, s_turn_bytes, cjson_turn, NULL);
+    bench_run("rtc", "cjson_transcript_delta", strlen(s_turn[DELTA_EVENT]),
+              cjson_one, (void *)s_turn[DELTA_EVENT]);
+    bench_run("rtc", "cjson_function_call", strlen(s_turn[CALL_EVENT]),
+              cjson_one, (void *)s_turn[CALL_EVENT]);
+#else
+    bench_skip("rtc", cjson_turn_name, "built without cJSON");
+    bench_skip("rtc", "cjson_transcript_delta", "built without cJSON");
+    bench_skip("rtc", "cjson_function_call", "built without cJSON");
+#endif
+    bench_run("rtc", router_turn_name, s_turn_bytes, router_turn, NULL);
+    bench_run("rtc", "router_transcript_delta", strlen(s_turn[DELTA_EVENT]),
+              router_one, (void *)s_turn[DELTA_EVENT]);
+    bench_run("rtc", "router_function_call", strlen(s_turn[CALL_EVENT]),
+              router_one, (void *)s_turn[CALL_EVENT]);
+}
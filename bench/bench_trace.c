@@ -0,0 +1,123 @@
+/**
+ * @file bench_trace.c
+ * @brief Per-event cost of the trace ring against the log lines it replaced
+ *
+ * The log cases go through the real ESP_LOGx macros and the shim's
+ * esp_log_write, with the output sent to /dev/null: formatting and the
+ * stdio write, but no UART time (on the device a 115200 baud console adds
+ * ~87 us per 10 characters). audio_cb is the per-frame line app_core used to
+ * print, recv_raw the 500-byte RECV RAW dump coze_ws printed per message,
+ * and logd_filtered the cost left after both were demoted below the log
+ * level (the shim still reads the clock; on the device, with the default
+ * maximum log level, ESP_LOGD compiles out). The trace cases record the matching event with the ring enabled
+ * and with recording switched off at run time.
+ */
+
+#include "bench.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "host_shim.h"
+#include "trace_ring.h"
+
+static const char *TAG = "APP_CORE";
+
+// ============================================
+// Fixtures
+// ============================================
+
+#define AUDIO_CB_BYTES      640
+#define RECV_RAW_MAX        500         // As coze_ws truncates the dump
+
+static char s_message[1024];
+
+static void make_message(void)
+{
+    // A conversation.audio.delta event; the dump is cut at 500 bytes anyway
+    int len = snprintf(s_message, sizeof(s_message),
+                       "{\"id\":\"evt_7431\",\"event_type\":\"conversation.audio.delta\","
+                       "\"data\":{\"id\":\"msg_7432\",\"role\":\"assistant\",\"type\":\"answer\","
+                       "\"content\":\"");
+    while (len < (int)sizeof(s_message) - 4) {
+        s_message[len] = "AAEAAQACAAMABAAF"[len & 15];
+        len++;
+    }
+    memcpy(s_message + len, "\"}}", 4);
+}
+
+// ============================================
+// Log Lines
+// ============================================
+
+static void log_audio_cb(void *ctx, uint32_t iters)
+{
+    for (uint32_t n = 0; n < iters; n++) {
+        ESP_LOGI(TAG, "🎤 Audio callback: %u bytes, VAD=%d, state=%s",
+                 (unsigned)AUDIO_CB_BYTES, (int)(n & 1), "LISTENING");
+    }
+}
+
+static void log_recv_raw(void *ctx, uint32_t iters)
+{
+    int len = (int)strlen(s_message);
+    for (uint32_t n = 0; n < iters; n++) {
+        ESP_LOGI("COZE_WS", "📥 RECV RAW (%d bytes): %.*s", len,
+                 len > RECV_RAW_MAX ? RECV_RAW_MAX : len, s_message);
+    }
+}
+
+static void log_filtered(void *ctx, uint32_t iters)
+{
+    int len = (int)strlen(s_message);
+    for (uint32_t n = 0; n < iters; n++) {
+        ESP_LOGD("COZE_WS", "📥 RECV RAW (%d bytes): %.*s", len,
+                 len > RECV_RAW_MAX ? RECV_RAW_MAX : len, s_message);
+    }
+}
+
+// ============================================
+// Trace Events
+// ============================================
+
+static void trace_event(void *ctx, uint32_t iters)
+{
+    for (uint32_t n = 0; n < iters; n++) {
+        TRACE_EVENT(TRACE_EV_AUDIO_CB, AUDIO_CB_BYTES, n & 1);
+    }
+}
+
+// ============================================
+// Suite
+// ============================================
+
+void bench_suite_trace(void)
+{
+    if (!bench_group_selected("trace")) {
+        return;
+    }
+    make_message();
+
+    FILE *null_out = fopen("/dev/null", "w");
+    if (null_out == NULL) {
+        bench_skip("trace", "logi_audio_cb", "cannot open /dev/null");
+        bench_skip("trace", "logi_recv_raw", "cannot open /dev/null");
+    } else {
+        host_log_set_level(ESP_LOG_INFO);
+        host_log_set_output(null_out);
+        bench_run("trace", "logi_audio_cb", 0, log_audio_cb, NULL);
+        bench_run("trace", "logi_recv_raw", 0, log_recv_raw, NULL);
+        host_log_set_output(NULL);
+        host_log_set_level(ESP_LOG_WARN);
+        fclose(null_out);
+    }
+    bench_run("trace", "logd_filtered", 0, log_filtered, NULL);
+
+    trace_ring_set_enabled(true);
+    bench_run("trace", "event", 0, trace_event, NULL);
+    trace_ring_set_enabled(false);
+    bench_run("trace", "event_disabled", 0, trace_event, NULL);
+    trace_ring_set_enabled(true);
+    trace_ring_clear();
+}
@@ -0,0 +1,245 @@
+/**
+ * @file bench_ui.c
+ * @brief Speaking page transcript: whole-label relayout vs. the line ring
+ *
+ * A 2000-character response streamed in deltas of 2-12 bytes, English and
+ * Chinese. One op is one delta, averaged over the whole response.
+ *
+ * relayout is the previous path: strncat into the app's transcript with a
+ * strlen, strcat into the page buffer, then lv_label_set_text on all of
+ * it, which copies the text and wraps every line again. The wrap is timed
+ * with ui_transcript itself on the whole text, so both sides pay the same
+ * per-glyph cost. ring is the current path: append the delta to the app's
+ * transcript and the line ring, take the changed lines and copy them, as
+ * the apply timer does (here after every delta, without coalescing).
+ */
+
+#include "bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ui_transcript.h"
+
+// ============================================
+// Configuration
+// ============================================
+
+#define RESPONSE_CHARS      2000
+#define TRANSCRIPT_LEN      2048    // ui_speaking.c MAX_TRANSCRIPT_LEN, app_core.c s_ai_transcript
+#define TRANSCRIPT_LINES    48      // ui_speaking.c
+#define LINE_WIDTH          376     // Transcript box content width (466 - 60 - 2 * 15)
+#define MAX_LINE_LEN        256
+
+// ============================================
+// Context
+// ============================================
+
+typedef struct {
+    char        *text;              // Whole response
+    uint16_t    *delta_end;         // Byte offset where each delta ends
+    uint32_t     delta_num;
+    uint32_t     next;              // Next delta
+    char         app[TRANSCRIPT_LEN];
+    size_t       app_len;
+    char         page[TRANSCRIPT_LEN];
+    size_t       page_len;
+    char        *label;             // lv_label's copy of the text
+    ui_transcript_handle_t ring;
+    ui_transcript_handle_t layout;  // Whole-text wrap for the relayout path
+} transcript_ctx_t;
+
+/**
+ * @brief Advances close to lv_font_montserrat_16
+ */
+static uint16_t glyph_width(uint32_t letter, void *ctx)
+{
+    if (letter >= 0x2E80) {
+        return 16;
+    }
+    if (letter == ' ' || letter == 'i' || letter == 'l' || letter == '.' || letter == ',') {
+        return 4;
+    }
+    if (letter == 'm' || letter == 'w' || (letter >= 'A' && letter <= 'Z')) {
+        return 12;
+    }
+    return 9;
+}
+
+static void make_response(transcript_ctx_t *c, bool zh)
+{
+    static const char *const words[] = {
+        "the", "weather", "today", "is", "mostly", "sunny", "with", "a", "light", "breeze",
+        "from", "northwest,", "and", "temperatures", "around", "twenty", "degrees.", "Tomorrow",
+        "brings", "clouds", "in", "afternoon", "so", "you", "might", "want", "to", "take", "an", "umbrella.",
+    };
+    // Common ideographs, three bytes each
+    static const char *const hanzi[] = {
+        "今", "天", "的", "天", "气", "晴", "朗", "，", "气", "温", "大", "约", "二", "十", "度", "。",
+        "明", "天", "下", "午", "有", "云", "记", "得", "带", "伞",
+    };
+    size_t cap = RESPONSE_CHARS * 3 + 16;
+    c->text = (char *)malloc(cap);
+    c->delta_end = (uint16_t *)malloc(RESPONSE_CHARS * 2 * sizeof(uint16_t));
+    size_t len = 0;
+    uint32_t chars = 0;
+    uint32_t seed = 12345;
+    while (chars < RESPONSE_CHARS) {
+        seed = seed * 1103515245 + 12345;
+        const char *piece = zh ? hanzi[(seed >> 16) % (sizeof(hanzi) / sizeof(hanzi[0]))]
+                               : words[(seed >> 16) % (sizeof(words) / sizeof(words[0]))];
+        size_t n = strlen(piece);
+        memcpy(c->text + len, piece, n);
+        len += n;
+        chars += zh ? 1 : (uint32_t)n;
+        if (!zh && chars < RESPONSE_CHARS) {
+            c->text[len++] = ' ';
+            chars++;
+        }
+    }
+    c->text[len] = '\0';
+
+    // Deltas of 2-12 bytes, ending on a character boundary
+    c->delta_num = 0;
+    size_t off = 0;
+    while (off < len) {
+        seed = seed * 1103515245 + 12345;
+        size_t end = off + 2 + (seed >> 16) % 11;
+        if (end >= len) {
+            end = len;
+        }
+        while (end < len && ((uint8_t)c->text[end] & 0xC0) == 0x80) {
+            end++;
+        }
+        c->delta_end[c->delta_num++] = (uint16_t)end;
+        off = end;
+    }
+}
+
+static const char *next_delta(transcript_ctx_t *c, char *buf, bool *restart)
+{
+    uint32_t i = c->next;
+    size_t start = i ? c->delta_end[i - 1] : 0;
+    size_t len = c->delta_end[i] - start;
+    memcpy(buf, c->text + start, len);
+    buf[len] = '\0';
+    c->next = (i + 1) % c->delta_num;
+    *restart = i == 0;
+    return buf;
+}
+
+// ============================================
+// Cases
+// ============================================
+
+static void transcript_relayout(void *ctx, uint32_t iters)
+{
+    transcript_ctx_t *c = (transcript_ctx_t *)ctx;
+    char delta[32];
+    uint32_t sink = 0;
+    for (uint32_t i = 0; i < iters; i++) {
+        bool restart;
+        next_delta(c, delta, &restart);
+        if (restart) {
+            c->app[0] = '\0';
+            c->page[0] = '\0';
+            c->page_len = 0;
+        }
+        strncat(c->app, delta, sizeof(c->app) - strlen(c->app) - 1);
+        size_t n = strlen(delta);
+        if (c->page_len + n < TRANSCRIPT_LEN - 1) {
+            strcat(c->page, delta);
+            c->page_len += n;
+        }
+        // lv_label_set_text: copy the text, then wrap all of it again
+        memcpy(c->label, c->page, c->page_len + 1);
+        ui_transcript_clear(c->layout);
+        ui_transcript_append(c->layout, c->label);
+        uint32_t first, end;
+        ui_transcript_get_lines(c->layout, &first, &end);
+        sink += end - first;
+    }
+    bench_sink(sink);
+}
+
+static void transcript_ring(void *ctx, uint32_t iters)
+{
+    transcript_ctx_t *c = (transcript_ctx_t *)ctx;
+    char delta[32];
+    char line[MAX_LINE_LEN];
+    uint32_t sink = 0;
+    for (uint32_t i = 0; i < iters; i++) {
+        bool restart;
+        next_delta(c, delta, &restart);
+        if (restart) {
+            c->app_len = 0;
+            ui_transcript_clear(c->ring);
+        }
+        size_t room = sizeof(c->app) - 1 - c->app_len;
+        size_t n = strnlen(delta, room);
+        memcpy(c->app + c->app_len, delta, n);
+        c->app_len += n;
+        c->app[c->app_len] = '\0';
+
+        ui_transcript_append(c->ring, delta);
+        uint32_t from, first, end;
+        if (ui_transcript_take_dirty(c->ring, &from)) {
+            ui_transcript_get_lines(c->ring, &first, &end);
+            for (uint32_t id = from; id < end; id++) {
+                sink += (uint32_t)ui_transcript_copy_line(c->ring, id, line, sizeof(line));
+            }
+        }
+    }
+    bench_sink(sink);
+}
+
+// ============================================
+// Suite
+// ============================================
+
+static void run_language(bool zh)
+{
+    transcript_ctx_t *c = (transcript_ctx_t *)calloc(1, sizeof(transcript_ctx_t));
+    ui_transcript_cfg_t cfg = {
+        .max_width = LINE_WIDTH,
+        .max_lines = TRANSCRIPT_LINES,
+        .text_size = TRANSCRIPT_LEN,
+        .glyph_width = glyph_width,
+    };
+    ui_transcript_cfg_t layout_cfg = cfg;
+    layout_cfg.max_lines = 512;
+    layout_cfg.text_size = RESPONSE_CHARS * 3 + 16;
+    if (c) {
+        c->ring = ui_transcript_create(&cfg);
+        c->layout = ui_transcript_create(&layout_cfg);
+        c->label = (char *)malloc(TRANSCRIPT_LEN);
+        make_response(c, zh);
+    }
+    if (c == NULL || c->ring == NULL || c->layout == NULL || c->label == NULL || c->text == NULL ||
+        c->delta_end == NULL) {
+        bench_skip("transcript", "*", "no memory");
+    } else {
+        // The old page stopped appending at 2 KB; Chinese reaches that at ~680 characters
+        bench_run("transcript", zh ? "relayout_delta_zh" : "relayout_delta_en", 0, transcript_relayout, c);
+        c->next = 0;
+        bench_run("transcript", zh ? "ring_delta_zh" : "ring_delta_en", 0, transcript_ring, c);
+    }
+    if (c) {
+        ui_transcript_destroy(c->ring);
+        ui_transcript_destroy(c->layout);
+        free(c->label);
+        free(c->text);
+        free(c->delta_end);
+        free(c);
+    }
+}
+
+void bench_suite_ui(void)
+{
+    if (!bench_group_selected("transcript")) {
+        return;
+    }
+    run_language(false);
+    run_language(true);
+}
@@ -0,0 +1,143 @@
+/**
+ * @file bench_video.c
+ * @brief convert_color and the display flush RGB565 byte swap
+ *
+ * LVGL comes from the IDF component manager and is not part of the host
+ * build, so the flush swap is measured with rgb565_swap() below, which
+ * follows lv_draw_sw_rgb565_swap() in LVGL 9 (eight 32-bit words per step,
+ * odd trailing pixel handled separately).
+ */
+
+#include "bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "color_convert.h"
+
+// ============================================
+// Configuration
+// ============================================
+
+// components/display/include/display_init.h
+#define DISPLAY_H_RES           466
+#define DISPLAY_LVGL_BUF_HEIGHT 30
+
+#define VIDEO_WIDTH             320
+#define VIDEO_HEIGHT            240
+
+// ============================================
+// RGB565 Swap
+// ============================================
+
+static void rgb565_swap(void *buf, uint32_t buf_size_px)
+{
+    uint32_t u32_cnt = buf_size_px / 2;
+    uint16_t *buf16 = buf;
+    uint32_t *buf32 = buf;
+
+    while (u32_cnt >= 8) {
+        for (int i = 0; i < 8; i++) {
+            buf32[i] = ((buf32[i] & 0xff00ff00) >> 8) | ((buf32[i] & 0x00ff00ff) << 8);
+        }
+        buf32 += 8;
+        u32_cnt -= 8;
+    }
+    while (u32_cnt) {
+        *buf32 = ((*buf32 & 0xff00ff00) >> 8) | ((*buf32 & 0x00ff00ff) << 8);
+        buf32++;
+        u32_cnt--;
+    }
+    if (buf_size_px & 0x1) {
+        uint32_t e = buf_size_px - 1;
+        buf16[e] = ((buf16[e] & 0xff00) >> 8) | ((buf16[e] & 0x00ff) << 8);
+    }
+}
+
+typedef struct {
+    uint16_t *buf;
+    uint32_t px;
+} swap_ctx_t;
+
+static void video_rgb565_swap(void *ctx, uint32_t iters)
+{
+    swap_ctx_t *c = (swap_ctx_t *)ctx;
+    for (uint32_t n = 0; n < iters; n++) {
+        rgb565_swap(c->buf, c->px);
+    }
+    bench_sink(c->buf[0]);
+}
+
+// ============================================
+// convert_color
+// ============================================
+
+typedef struct {
+    color_convert_table_t table;
+    uint8_t *src;
+    int src_size;
+    uint8_t *dst;
+    int dst_size;
+} convert_ctx_t;
+
+static void video_convert(void *ctx, uint32_t iters)
+{
+    convert_ctx_t *c = (convert_ctx_t *)ctx;
+    for (uint32_t n = 0; n < iters; n++) {
+        convert_color(c->table, c->src, c->src_size, c->dst, c->dst_size);
+    }
+    bench_sink(c->dst[0]);
+}
+
+static void run_convert(const char *name, av_render_video_frame_type_t to)
+{
+    color_convert_cfg_t cfg = {
+        .from = AV_RENDER_VIDEO_RAW_TYPE_YUV420,
+        .to = to,
+        .width = VIDEO_WIDTH,
+        .height = VIDEO_HEIGHT,
+    };
+    convert_ctx_t c = {
+        .table = init_convert_table(&cfg),
+        .src_size = convert_table_get_image_size(cfg.from, cfg.width, cfg.height),
+        .dst_size = convert_table_get_image_size(cfg.to, cfg.width, cfg.height),
+    };
+    c.src = (uint8_t *)malloc(c.src_size);
+    c.dst = (uint8_t *)malloc(c.dst_size);
+    if (c.table == NULL || c.src == NULL || c.dst == NULL) {
+        bench_skip("video", name, "no memory");
+    } else {
+        for (int i = 0; i < c.src_size; i++) {
+            c.src[i] = (uint8_t)(i * 7 + (i >> 9));
+        }
+        bench_run("video", name, c.src_size, video_convert, &c);
+    }
+    deinit_convert_table(c.table);
+    free(c.src);
+    free(c.dst);
+}
+
+// ============================================
+// Suite
+// ============================================
+
+void bench_suite_video(void)
+{
+    if (!bench_group_selected("video")) {
+        return;
+    }
+
+    run_convert("yuv420_to_rgb565_320x240", AV_RENDER_VIDEO_RAW_TYPE_RGB565);
+    run_convert("yuv420_to_rgb565be_320x240", AV_RENDER_VIDEO_RAW_TYPE_RGB565_BE);
+
+    // One partial-mode LVGL draw buffer, the area of a full-width flush
+    swap_ctx_t stripe = {.px = DISPLAY_H_RES * DISPLAY_LVGL_BUF_HEIGHT};
+    stripe.buf = (uint16_t *)malloc(stripe.px * sizeof(uint16_t));
+    if (stripe.buf) {
+        for (uint32_t i = 0; i < stripe.px; i++) {
+            stripe.buf[i] = (uint16_t)(i * 2654435761u >> 16);
+        }
+        bench_run("video", "rgb565_swap_flush_stripe", stripe.px * sizeof(uint16_t), video_rgb565_swap, &stripe);
+        free(stripe.buf);
+    }
+}
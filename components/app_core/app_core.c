@@ -9,6 +9,8 @@
 #include "coze_ws.h"
 #include "azure_realtime.h"
 #include "ui_manager.h"
+#include "latency_ledger.h"
+#include "trace_ring.h"
 
 #include <string.h>
 #include "freertos/FreeRTOS.h"
@@ -43,11 +45,24 @@ static void *s_callback_user_data = NULL;
 // Accumulated transcript
 static char s_user_transcript[1024] = {0};
 static char s_ai_transcript[2048] = {0};
+static size_t s_ai_transcript_len = 0;
 
 // ============================================
 // Private Functions
 // ============================================
 
+/**
+ * @brief Append a response delta to the AI transcript, truncating when full
+ */
+static void append_ai_transcript(const char *text)
+{
+    size_t room = sizeof(s_ai_transcript) - 1 - s_ai_transcript_len;
+    size_t len = strnlen(text, room);
+    memcpy(s_ai_transcript + s_ai_transcript_len, text, len);
+    s_ai_transcript_len += len;
+    s_ai_transcript[s_ai_transcript_len] = '\0';
+}
+
 /**
  * @brief Audio data callback from recording pipeline
  */
@@ -56,17 +71,12 @@ static void audio_record_callback(const uint8_t *data, size_t size,
 {
     // Send audio to Azure
     if (s_current_state == APP_STATE_LISTENING) {
-        ESP_LOGI(TAG, "🎤 Audio callback: %u bytes, VAD=%d, state=%s",
-                 (unsigned)size, vad_state, app_core_state_to_string(s_current_state));
+        TRACE_EVENT(TRACE_EV_AUDIO_CB, size, vad_state);
         esp_err_t ret = azure_realtime_send_audio(data, size);
         if (ret != ESP_OK) {
             ESP_LOGE(TAG, "❌ Failed to send audio: %s", esp_err_to_name(ret));
         }
 
-        // Update UI with audio level
-        uint8_t level = audio_pipeline_get_volume();
-        ui_manager_update_audio_level(level);
-
         // Handle VAD events
         if (vad_state == VAD_STATE_VOICE_END) {
             ESP_LOGI(TAG, "🎤 VAD: Voice END detected");
@@ -83,7 +93,7 @@ static void audio_record_callback(const uint8_t *data, size_t size,
  */
 static void coze_event_callback(const coze_event_t *event, void *user_data)
 {
-    ESP_LOGI(TAG, "🔍 ENTRY: coze_event_callback (event=%p, type=%d)",
+    ESP_LOGD(TAG, "🔍 ENTRY: coze_event_callback (event=%p, type=%d)",
              event, event ? event->type : -1);
 
     if (event == NULL) {
@@ -125,8 +135,7 @@ static void coze_event_callback(const coze_event_t *event, void *user_data)
             if (event->text) {
                 ESP_LOGI(TAG, "🤖 Coze transcript: \"%s\"", event->text);
                 // Append to AI transcript
-                strncat(s_ai_transcript, event->text,
-                        sizeof(s_ai_transcript) - strlen(s_ai_transcript) - 1);
+                append_ai_transcript(event->text);
                 if (app_get_display() != NULL) {
                     ui_manager_update_transcript(event->text, false);
                 }
@@ -165,7 +174,7 @@ static void coze_event_callback(const coze_event_t *event, void *user_data)
             break;
     }
 
-    ESP_LOGI(TAG, "✅ EXIT: coze_event_callback");
+    ESP_LOGD(TAG, "✅ EXIT: coze_event_callback");
 }
 
 /**
@@ -173,7 +182,7 @@ static void coze_event_callback(const coze_event_t *event, void *user_data)
  */
 static void azure_event_callback(const azure_event_t *event, void *user_data)
 {
-    ESP_LOGI(TAG, "🔍 ENTRY: azure_event_callback (event=%p, type=%d)",
+    ESP_LOGD(TAG, "🔍 ENTRY: azure_event_callback (event=%p, type=%d)",
              event, event ? event->type : -1);
 
     if (event == NULL) {
@@ -215,8 +224,7 @@ static void azure_event_callback(const azure_event_t *event, void *user_data)
             if (event->text) {
                 ESP_LOGI(TAG, "🤖 Azure transcript: \"%s\"", event->text);
                 // Append to AI transcript
-                strncat(s_ai_transcript, event->text,
-                        sizeof(s_ai_transcript) - strlen(s_ai_transcript) - 1);
+                append_ai_transcript(event->text);
                 if (app_get_display() != NULL) {
                     ui_manager_update_transcript(event->text, false);
                 }
@@ -255,7 +263,7 @@ static void azure_event_callback(const azure_event_t *event, void *user_data)
             break;
     }
 
-    ESP_LOGI(TAG, "✅ EXIT: azure_event_callback");
+    ESP_LOGD(TAG, "✅ EXIT: azure_event_callback");
 }
 
 /**
@@ -263,6 +271,11 @@ static void azure_event_callback(const azure_event_t *event, void *user_data)
  */
 static void ui_event_callback(ui_event_t event, void *user_data)
 {
+    // A touch means the user is about to talk: skip any reconnect backoff
+    if (!azure_realtime_is_connected()) {
+        azure_realtime_prewarm();
+    }
+
     switch (event) {
         case UI_EVENT_TAP:
             app_core_send_event(APP_EVENT_USER_TAP);
@@ -298,6 +311,8 @@ static esp_err_t transition_to_state(app_state_t new_state)
              app_core_state_to_string(old_state),
              app_core_state_to_string(new_state));
 
+    TRACE_EVENT(TRACE_EV_APP_STATE, old_state, new_state);
+
     // Exit current state
     switch (old_state) {
         case APP_STATE_LISTENING:
@@ -318,6 +333,7 @@ static esp_err_t transition_to_state(app_state_t new_state)
     switch (new_state) {
         case APP_STATE_IDLE:
             ESP_LOGI(TAG, "➡️  Entering IDLE state");
+            latency_ledger_end_turn();
             if (app_get_display() != NULL) {
                 ui_manager_set_page(UI_PAGE_IDLE);
             } else {
@@ -330,6 +346,7 @@ static esp_err_t transition_to_state(app_state_t new_state)
             // Clear transcripts
             s_user_transcript[0] = '\0';
             s_ai_transcript[0] = '\0';
+            s_ai_transcript_len = 0;
             if (app_get_display() != NULL) {
                 ui_manager_clear_transcript();
                 ui_manager_set_page(UI_PAGE_LISTENING);
@@ -339,6 +356,7 @@ static esp_err_t transition_to_state(app_state_t new_state)
 
         case APP_STATE_PROCESSING:
             ESP_LOGI(TAG, "➡️  Entering PROCESSING state, completing audio (Azure manual mode)");
+            latency_ledger_begin_turn(LATENCY_PROVIDER_AZURE_WS);
             if (app_get_display() != NULL) {
                 ui_manager_set_page(UI_PAGE_THINKING);
             }
@@ -357,6 +375,7 @@ static esp_err_t transition_to_state(app_state_t new_state)
 
         case APP_STATE_ERROR:
             ESP_LOGE(TAG, "➡️  Entering ERROR state");
+            latency_ledger_abort_turn();
             if (app_get_display() != NULL) {
                 ui_manager_set_page(UI_PAGE_ERROR);
             }
@@ -420,6 +439,7 @@ static void process_event(app_event_t event)
                 transition_to_state(APP_STATE_ERROR);
             } else if (event == APP_EVENT_CANCEL) {
                 ESP_LOGI(TAG, "❌ User cancelled processing");
+                latency_ledger_abort_turn();
                 azure_realtime_cancel_response();
                 transition_to_state(APP_STATE_IDLE);
             }
@@ -6,6 +6,7 @@
 #include "audio_pipeline.h"
 #include "audio_recorder.h"
 #include "audio_player.h"
+#include "trace_ring.h"
 
 #include <string.h>
 #include "freertos/FreeRTOS.h"
@@ -92,6 +93,8 @@ static void record_pipeline_task(void *pvParameters)
                 last_log_time = now;
             }
 
+            TRACE_EVENT(TRACE_EV_PIPE_FRAME, bytes_read, vad_state);
+
             // Call the record callback if registered
             if (s_config.record_cb) {
                 s_config.record_cb(audio_buffer, bytes_read, vad_state, s_config.user_data);
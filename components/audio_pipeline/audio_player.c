@@ -6,11 +6,15 @@
  */
 
 #include "audio_player.h"
+#include "audio_telemetry.h"
+#include "latency_ledger.h"
+#include "trace_ring.h"
 
 // Use official BSP codec dev API
 #include "esp_codec_dev.h"
 
 #include <string.h>
+#include <math.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
@@ -86,6 +90,21 @@ static void apply_volume(int16_t *samples, size_t count, uint8_t volume)
     }
 }
 
+/**
+ * @brief Level 0-100 of a played frame, on the mic level scale
+ */
+static uint8_t frame_level(const int16_t *samples, size_t count)
+{
+    if (count == 0) {
+        return 0;
+    }
+    int64_t sum = 0;
+    for (size_t i = 0; i < count; i++) {
+        sum += (int32_t)samples[i] * samples[i];
+    }
+    return audio_telemetry_level((uint32_t)sqrt((double)sum / count));
+}
+
 /**
  * @brief Player task - reads from ring buffer, writes to codec
  */
@@ -101,8 +120,19 @@ static void player_task(void *pvParameters)
         return;
     }
 
+    // Playback position, restarted whenever playback starts
+    bool was_playing = false;
+    uint64_t played_samples = 0;
+
     while (s_task_running) {
-        if (s_state == AUDIO_PLAYER_STATE_PLAYING && s_codec_opened) {
+        bool playing = s_state == AUDIO_PLAYER_STATE_PLAYING && s_codec_opened;
+        if (playing != was_playing) {
+            played_samples = 0;
+            was_playing = playing;
+            audio_telemetry_publish_play(0, playing, 0);
+        }
+
+        if (playing) {
             size_t received_size;
 
             // Try to receive data from ring buffer
@@ -124,7 +154,15 @@ static void player_task(void *pvParameters)
                 }
 
                 // Write to speaker codec
-                esp_codec_dev_write(s_spk_codec, output_buffer, received_size);
+                TRACE_BEGIN(TRACE_EV_PLAY_WRITE, received_size, s_muted);
+                if (esp_codec_dev_write(s_spk_codec, output_buffer, received_size) == ESP_CODEC_DEV_OK) {
+                    latency_ledger_mark(LATENCY_MARK_FIRST_I2S_WRITE);
+                }
+                TRACE_END(TRACE_EV_PLAY_WRITE, received_size, s_muted);
+
+                played_samples += sample_count / s_config.channels;
+                audio_telemetry_publish_play(frame_level(output_buffer, sample_count), true,
+                                             (uint32_t)(played_samples * 1000 / s_config.sample_rate));
 
             } else {
                 // No data available - check if we're done
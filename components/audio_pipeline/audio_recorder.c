@@ -6,6 +6,8 @@
  */
 
 #include "audio_recorder.h"
+#include "audio_telemetry.h"
+#include "trace_ring.h"
 
 // Use official Waveshare BSP codec dev API
 #include "esp_codec_dev.h"
@@ -151,9 +153,6 @@ static void update_vad_state(uint32_t energy)
     uint32_t now = xTaskGetTickCount();
     vad_state_t prev_state = s_vad_state;
 
-    // Update audio level (0-100 scale)
-    s_audio_level = (energy > 10000) ? 100 : (uint8_t)(energy / 100);
-
     bool voice_detected = (energy > VAD_ENERGY_THRESHOLD);
 
     switch (s_vad_state) {
@@ -278,6 +277,8 @@ static void recorder_task(void *pvParameters)
             data_frames++;
             size_t sample_count = AUDIO_FRAME_BYTES / sizeof(int16_t);
 
+            TRACE_BEGIN(TRACE_EV_REC_DSP, sample_count, s_config.enable_aec);
+
             // Apply high-pass filter to remove DC offset
             apply_highpass_filter(process_buffer, sample_count);
 
@@ -300,10 +301,16 @@ static void recorder_task(void *pvParameters)
             if (s_config.enable_vad) {
                 update_vad_state(energy);
             }
+            s_audio_level = audio_telemetry_level(energy);
+            audio_telemetry_publish_mic(s_audio_level, (uint8_t)s_vad_state);
+
+            TRACE_END(TRACE_EV_REC_DSP, sample_count, s_config.enable_aec);
+            TRACE_EVENT(TRACE_EV_REC_FRAME, energy, s_vad_state);
 
             // Put processed audio to ring buffer
             if (xRingbufferSend(s_ring_buffer, process_buffer, AUDIO_FRAME_BYTES, 0) != pdTRUE) {
                 ESP_LOGW(TAG, "Ring buffer full, dropping audio frame");
+                TRACE_EVENT(TRACE_EV_REC_DROP, AUDIO_FRAME_BYTES, 0);
             }
         } else {
             // Read failed, wait a bit before retry
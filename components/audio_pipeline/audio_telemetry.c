@@ -0,0 +1,96 @@
+/**
+ * @file audio_telemetry.c
+ * @brief Lock-free latest-value channel from the audio tasks to the UI
+ */
+
+#include "audio_telemetry.h"
+
+#include <stdatomic.h>
+
+// ============================================
+// Word Layout
+// ============================================
+
+// Both words: latest level, peak since the last read, a flag byte and a
+// publish counter the reader uses to tell new values and count frames
+#define WORD_LEVEL(w)       ((uint8_t)((w) & 0xFF))
+#define WORD_PEAK(w)        ((uint8_t)(((w) >> 8) & 0xFF))
+#define WORD_FLAGS(w)       ((uint8_t)(((w) >> 16) & 0xFF))
+#define WORD_SEQ(w)         ((uint8_t)((w) >> 24))
+#define WORD_PACK(level, peak, flags, seq) \
+    ((uint32_t)(level) | ((uint32_t)(peak) << 8) | ((uint32_t)(flags) << 16) | ((uint32_t)(seq) << 24))
+
+// ============================================
+// Private Variables
+// ============================================
+
+static _Atomic uint32_t s_mic_word;     // Flags: VAD state
+static _Atomic uint32_t s_play_word;    // Flags: playing
+static _Atomic uint32_t s_play_ms;
+
+// Reader side, one task only
+static uint8_t s_mic_seen;
+static uint8_t s_play_seen;
+
+// ============================================
+// Private Functions
+// ============================================
+
+static void publish(_Atomic uint32_t *word, uint8_t level, uint8_t flags)
+{
+    uint32_t old = atomic_load_explicit(word, memory_order_relaxed);
+    uint32_t next;
+    do {
+        uint8_t peak = WORD_PEAK(old) > level ? WORD_PEAK(old) : level;
+        next = WORD_PACK(level, peak, flags, WORD_SEQ(old) + 1);
+    } while (!atomic_compare_exchange_weak_explicit(word, &old, next, memory_order_release,
+                                                    memory_order_relaxed));
+}
+
+/**
+ * @brief Load a word and restart its peak at the latest level
+ */
+static uint32_t take(_Atomic uint32_t *word)
+{
+    uint32_t old = atomic_load_explicit(word, memory_order_acquire);
+    uint32_t next;
+    do {
+        next = (old & ~0xFF00u) | ((uint32_t)WORD_LEVEL(old) << 8);
+    } while (old != next && !atomic_compare_exchange_weak_explicit(word, &old, next, memory_order_acquire,
+                                                                   memory_order_acquire));
+    return old;
+}
+
+// ============================================
+// Public Functions
+// ============================================
+
+void audio_telemetry_publish_mic(uint8_t level, uint8_t vad_state)
+{
+    publish(&s_mic_word, level, vad_state);
+}
+
+void audio_telemetry_publish_play(uint8_t level, bool playing, uint32_t play_ms)
+{
+    // The position goes first so a reader seeing the word sees this position or a later one
+    atomic_store_explicit(&s_play_ms, play_ms, memory_order_relaxed);
+    publish(&s_play_word, level, playing ? 1 : 0);
+}
+
+bool audio_telemetry_read(audio_telemetry_t *out)
+{
+    uint32_t mic = take(&s_mic_word);
+    uint32_t play = take(&s_play_word);
+
+    out->mic_level = WORD_PEAK(mic);
+    out->vad_state = WORD_FLAGS(mic);
+    out->play_level = WORD_PEAK(play);
+    out->playing = WORD_FLAGS(play) != 0;
+    out->play_ms = atomic_load_explicit(&s_play_ms, memory_order_relaxed);
+    out->mic_frames = (uint8_t)(WORD_SEQ(mic) - s_mic_seen);
+    out->play_frames = (uint8_t)(WORD_SEQ(play) - s_play_seen);
+
+    s_mic_seen = WORD_SEQ(mic);
+    s_play_seen = WORD_SEQ(play);
+    return out->mic_frames || out->play_frames;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file audio_telemetry.h
+ * @brief Lock-free latest-value channel from the audio tasks to the UI
+ *
+ * The recorder task publishes the mic level and VAD state per frame, the
+ * player task the playback level and position. Publishing never blocks:
+ * each side is one 32-bit atomic word updated with a compare-and-swap, so
+ * an audio task never waits on the display lock or on the reader.
+ *
+ * The UI samples the channel once per frame on its own task. Levels are
+ * decimated by peak-hold: a read returns the loudest level published since
+ * the previous read, so a short peak between two frames is not lost.
+ *
+ * Any number of producers; a single reader (the UI task). VAD states are
+ * vad_state_t values; this header stays free of audio_pipeline.h so the
+ * player, which has its own frame format, can include it.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Telemetry snapshot
+ */
+typedef struct {
+    uint8_t     mic_level;      // Mic level 0-100, peak since the last read
+    uint8_t     vad_state;      // Latest VAD state (vad_state_t)
+    uint8_t     play_level;     // Playback level 0-100, peak since the last read
+    bool        playing;        // Player is writing to the speaker
+    uint32_t    play_ms;        // Audio played since playback started
+    uint8_t     mic_frames;     // Mic frames folded into this read
+    uint8_t     play_frames;    // Playback frames folded into this read
+} audio_telemetry_t;
+
+/**
+ * @brief Publish the mic level and VAD state of one recorded frame
+ *
+ * Lock-free, callable from any task.
+ *
+ * @param level     Mic level 0-100
+ * @param vad_state VAD state after the frame (vad_state_t)
+ */
+void audio_telemetry_publish_mic(uint8_t level, uint8_t vad_state);
+
+/**
+ * @brief Publish the level and position of one played frame
+ *
+ * Lock-free, callable from any task.
+ *
+ * @param level   Playback level 0-100
+ * @param playing Player is writing to the speaker
+ * @param play_ms Audio played since playback started
+ */
+void audio_telemetry_publish_play(uint8_t level, bool playing, uint32_t play_ms);
+
+/**
+ * @brief Take the latest values
+ *
+ * Resets the peak levels to the latest ones. Call from one task only.
+ *
+ * @param out Snapshot
+ * @return true if anything was published since the last read
+ */
+bool audio_telemetry_read(audio_telemetry_t *out);
+
+/**
+ * @brief Level 0-100 of a frame's RMS, the scale of the mic level
+ *
+ * @param rms Frame RMS of 16-bit samples
+ */
+static inline uint8_t audio_telemetry_level(uint32_t rms)
+{
+    return (rms > 10000) ? 100 : (uint8_t)(rms / 100);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,167 @@
+/**
+ * @file audio_mixer.h
+ * @brief Audio mixer between av_render and the audio render
+ *
+ * Mixes short local sounds (earcons, prompts) into the playback stream
+ * without going through av_render's queues. The mixer exposes an audio
+ * render for the main stream: av_render writes decoded frames to it as it
+ * would to the I2S render, and each frame leaves with the active overlay
+ * inputs mixed in. While the main stream is idle, the mixer's own task
+ * writes overlay frames, so a sound starts within one render frame either
+ * way.
+ *
+ * Gains are Q15 (AUDIO_MIXER_GAIN_UNITY is 1.0) and ramp over ramp_ms to
+ * avoid clicks. An input can duck the main stream while it plays and can
+ * start at a main-stream pts for sample-aligned prompts.
+ */
+
+#pragma once
+
+#include "audio_render.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AUDIO_MIXER_GAIN_UNITY   (32768)
+
+/**
+ * @brief  Audio mixer handle
+ */
+typedef void *audio_mixer_handle_t;
+
+/**
+ * @brief  Called once an input finished or was stopped (from the mixer or render task)
+ */
+typedef void (*audio_mixer_done_cb)(int input, void *ctx);
+
+/**
+ * @brief  Audio mixer configuration
+ */
+typedef struct {
+    audio_render_handle_t        out;         /*!< Render the mix is written to (e.g. I2S render) */
+    av_render_audio_frame_info_t info;        /*!< Output format, 16 bits; the main stream must match */
+    uint8_t                      max_inputs;  /*!< Overlay inputs (default 4) */
+    uint16_t                     frame_ms;    /*!< Frame written while the main stream is idle (default 10) */
+    uint16_t                     ramp_ms;     /*!< Gain ramp on start, stop and ducking (default 5) */
+    uint16_t                     duck_gain;   /*!< Q15 main-stream gain under a ducking input (default 0.25) */
+} audio_mixer_cfg_t;
+
+/**
+ * @brief  Sound to play on an overlay input
+ */
+typedef struct {
+    const int16_t       *data;     /*!< PCM at the mixer rate, kept valid until done */
+    uint32_t             samples;  /*!< Samples per channel */
+    uint8_t              channel;  /*!< 1 (played on every output channel) or the mixer channel count */
+    uint16_t             gain;     /*!< Q15 gain, 0 for unity */
+    bool                 duck;     /*!< Lower the main stream while playing */
+    bool                 loop;     /*!< Repeat until audio_mixer_stop() */
+    bool                 at_pts;   /*!< Start at pts instead of the next frame */
+    uint32_t             pts;      /*!< Main-stream pts (ms) to start at */
+    audio_mixer_done_cb  done;     /*!< Completion callback (optional) */
+    void                *ctx;      /*!< Completion callback context */
+} audio_mixer_sound_t;
+
+/**
+ * @brief  Audio mixer statistics
+ */
+typedef struct {
+    uint32_t main_frames;       /*!< Main-stream frames written */
+    uint32_t mixed_frames;      /*!< Main-stream frames with an overlay mixed in */
+    uint32_t unmixed_frames;    /*!< Main-stream frames passed through unmixed, no memory to mix */
+    uint32_t idle_frames;       /*!< Overlay frames written by the mixer task */
+    uint32_t started;           /*!< Inputs started */
+    uint32_t finished;          /*!< Inputs finished or stopped */
+    uint32_t late;              /*!< Inputs whose pts had already passed */
+    uint32_t clipped;           /*!< Output samples saturated */
+    uint32_t start_latency_ms;  /*!< Last play call to its first output frame */
+} audio_mixer_stats_t;
+
+/**
+ * @brief  Open audio mixer
+ *
+ * @param[in]  cfg  Audio mixer configuration
+ *
+ * @return
+ *       - NULL    Invalid configuration or no memory
+ *       - Others  Audio mixer instance
+ */
+audio_mixer_handle_t audio_mixer_open(audio_mixer_cfg_t *cfg);
+
+/**
+ * @brief  Get the render the main stream is written to
+ *
+ * @note  Use it as av_render_cfg_t.audio_render; it stays valid until audio_mixer_close
+ *
+ * @param[in]  mixer  Audio mixer handle
+ *
+ * @return
+ *       - NULL    Invalid handle
+ *       - Others  Audio render handle
+ */
+audio_render_handle_t audio_mixer_get_render(audio_mixer_handle_t mixer);
+
+/**
+ * @brief  Play a sound on a free overlay input
+ *
+ * @param[in]   mixer  Audio mixer handle
+ * @param[in]   sound  Sound to play
+ * @param[out]  input  Input the sound plays on (optional)
+ *
+ * @return
+ *       - ESP_MEDIA_ERR_OK           On success
+ *       - ESP_MEDIA_ERR_INVALID_ARG  Invalid argument or format
+ *       - ESP_MEDIA_ERR_EXCEED_LIMIT  All inputs busy
+ */
+int audio_mixer_play(audio_mixer_handle_t mixer, const audio_mixer_sound_t *sound, int *input);
+
+/**
+ * @brief  Fade out and stop an input
+ *
+ * @param[in]  mixer  Audio mixer handle
+ * @param[in]  input  Input from audio_mixer_play
+ *
+ * @return
+ *       - ESP_MEDIA_ERR_OK           On success
+ *       - ESP_MEDIA_ERR_INVALID_ARG  Input not playing
+ */
+int audio_mixer_stop(audio_mixer_handle_t mixer, int input);
+
+/**
+ * @brief  Ramp the gain of a playing input
+ *
+ * @param[in]  mixer  Audio mixer handle
+ * @param[in]  input  Input from audio_mixer_play
+ * @param[in]  gain   Q15 gain
+ *
+ * @return
+ *       - ESP_MEDIA_ERR_OK           On success
+ *       - ESP_MEDIA_ERR_INVALID_ARG  Input not playing
+ */
+int audio_mixer_set_gain(audio_mixer_handle_t mixer, int input, uint16_t gain);
+
+/**
+ * @brief  Get audio mixer statistics
+ *
+ * @param[in]   mixer  Audio mixer handle
+ * @param[out]  stats  Statistics
+ *
+ * @return
+ *       - ESP_MEDIA_ERR_OK           On success
+ *       - ESP_MEDIA_ERR_INVALID_ARG  Invalid argument
+ */
+int audio_mixer_get_stats(audio_mixer_handle_t mixer, audio_mixer_stats_t *stats);
+
+/**
+ * @brief  Close audio mixer
+ *
+ * @note  Close av_render first; the output render is closed but not freed
+ *
+ * @param[in]  mixer  Audio mixer handle
+ */
+void audio_mixer_close(audio_mixer_handle_t mixer);
+
+#ifdef __cplusplus
+}
+#endif
@@ -47,11 +47,15 @@ typedef struct {
     av_render_audio_frame_info_t output_info;  /*!< Output frame information */
     audio_resample_frame_cb      resample_cb;  /*!< Resample output callback */
     void                        *ctx;          /*!< User context */
+    bool                         generic_only; /*!< Chain esp_ae converters even where a fused kernel fits */
 } audio_resample_cfg_t;
 
 /**
  * @brief  Open audio resample
  *
+ * @note  16-bit conversions between common channel and rate tuples run as one fused pass;
+ *        other conversions chain the esp_ae channel, bit and rate converters
+ *
  * @param[in]  cfg  Audio resample configuration
  *
  * @return
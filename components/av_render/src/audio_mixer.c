@@ -0,0 +1,649 @@
+/**
+ * @file audio_mixer.c
+ * @brief Audio mixer between av_render and the audio render
+ *
+ * Two locks: out_lock serializes the writers of the output render (the
+ * main stream's write and the mixer task), lock covers the inputs. The
+ * main stream's write mixes the active inputs into its frame and writes it
+ * out; the mixer task does the same with silence as the main frame whenever
+ * inputs are active and the main stream has gone quiet for longer than its
+ * last frame. Both paths block in the output render, which paces them the
+ * way the I2S DMA paces av_render, but only hold lock while mixing, so
+ * audio_mixer_play() never waits on the DMA and the sound goes out with
+ * the next frame.
+ *
+ * Mixing is Q15 with 64-bit sums and one saturation per output sample. Every
+ * gain (per input and the main-stream duck) moves towards its target by a
+ * fixed step per sample, so starts, stops, ducking and gain changes ramp
+ * over ramp_ms instead of stepping.
+ */
+
+#include "audio_mixer.h"
+
+#include <string.h>
+#include "media_lib_os.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#define TAG "AUDIO_MIXER"
+
+#define MIXER_DEFAULT_INPUTS     (4)
+#define MIXER_DEFAULT_FRAME_MS   (10)
+#define MIXER_DEFAULT_RAMP_MS    (5)
+#define MIXER_DEFAULT_DUCK_GAIN  (AUDIO_MIXER_GAIN_UNITY / 4)
+
+#define MIXER_QUIT_BIT           (1 << 0)
+
+// ============================================
+// Private Types
+// ============================================
+
+typedef struct {
+    bool                 active;
+    bool                 stopping;
+    bool                 waiting;          // Holding for its pts
+    bool                 started;          // First sample written
+    audio_mixer_sound_t  sound;
+    uint32_t             pos;              // Next sample
+    int32_t              gain;             // Q15, current
+    int32_t              target;
+    int32_t              step;             // Per sample, > 0
+    int64_t              play_us;          // audio_mixer_play() time
+} mixer_input_t;
+
+typedef struct {
+    int                  input;
+    audio_mixer_done_cb  done;
+    void                *ctx;
+} mixer_done_t;
+
+typedef struct {
+    audio_mixer_cfg_t            cfg;
+    mixer_input_t               *inputs;
+    mixer_done_t                *done;        // Callbacks collected under the lock
+    int                          done_num;
+    media_lib_mutex_handle_t     lock;        // Inputs, duck, stats, done
+    media_lib_mutex_handle_t     out_lock;    // Output render, main-stream state, buf
+    media_lib_sema_handle_t      wake;
+    media_lib_event_grp_handle_t event;
+    audio_render_handle_t        render;      // Main-stream input
+    bool                         running;
+    bool                         out_open;
+    bool                         main_open;
+    int64_t                      main_idle_us; // Main stream counts as idle after this
+    int32_t                      duck;        // Q15 main-stream gain, current
+    int32_t                      duck_target;
+    int32_t                      duck_step;
+    int                          ramp_samples;
+    int                          frame_samples;
+    int16_t                     *buf;
+    int                          buf_size;
+    audio_mixer_stats_t          stats;
+} audio_mixer_t;
+
+// ============================================
+// Mixing
+// ============================================
+
+static inline int32_t ramp(int32_t gain, int32_t target, int32_t step)
+{
+    if (gain < target) {
+        return gain + step > target ? target : gain + step;
+    }
+    if (gain > target) {
+        return gain - step < target ? target : gain - step;
+    }
+    return gain;
+}
+
+static int32_t ramp_step(audio_mixer_t *mixer, int32_t from, int32_t to)
+{
+    int32_t diff = from > to ? from - to : to - from;
+    if (mixer->ramp_samples == 0 || diff == 0) {
+        return AUDIO_MIXER_GAIN_UNITY * 2;
+    }
+    int32_t step = diff / mixer->ramp_samples;
+    return step > 0 ? step : 1;
+}
+
+static void finish_input(audio_mixer_t *mixer, int i)
+{
+    mixer_input_t *in = &mixer->inputs[i];
+    in->active = false;
+    mixer->stats.finished++;
+    if (in->sound.done) {
+        mixer->done[mixer->done_num++] = (mixer_done_t) { i, in->sound.done, in->sound.ctx };
+    }
+}
+
+static void update_duck(audio_mixer_t *mixer)
+{
+    int32_t target = AUDIO_MIXER_GAIN_UNITY;
+    for (int i = 0; i < mixer->cfg.max_inputs; i++) {
+        mixer_input_t *in = &mixer->inputs[i];
+        if (in->active && in->sound.duck && !in->stopping) {
+            target = mixer->cfg.duck_gain;
+            break;
+        }
+    }
+    mixer->duck_target = target;
+    mixer->duck_step = ramp_step(mixer, mixer->duck, target);
+}
+
+static bool mixer_busy(audio_mixer_t *mixer)
+{
+    for (int i = 0; i < mixer->cfg.max_inputs; i++) {
+        if (mixer->inputs[i].active) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Mix the active inputs into one frame
+ *
+ * @param main Main-stream samples, NULL for silence
+ * @param has_pts Frame carries the main-stream pts, so inputs waiting for
+ *                a pts can start at the right sample
+ * @return Whether any input contributed
+ */
+static bool mix_frame(audio_mixer_t *mixer, const int16_t *main, int16_t *out, int samples, bool has_pts, uint32_t pts)
+{
+    const int ch = mixer->cfg.info.channel;
+    const uint32_t rate = mixer->cfg.info.sample_rate;
+    int64_t now = esp_timer_get_time();
+    bool mixed = false;
+    int offset[mixer->cfg.max_inputs];
+
+    for (int i = 0; i < mixer->cfg.max_inputs; i++) {
+        mixer_input_t *in = &mixer->inputs[i];
+        offset[i] = 0;
+        if (in->active == false) {
+            continue;
+        }
+        if (in->waiting) {
+            if (has_pts) {
+                // Sample offset of the start pts inside this frame
+                int64_t diff = (int64_t)in->sound.pts - pts;
+                if (diff < 0) {
+                    mixer->stats.late++;
+                    diff = 0;
+                }
+                int64_t at = diff * rate / 1000;
+                if (at >= samples) {
+                    offset[i] = samples;
+                    continue;
+                }
+                offset[i] = (int)at;
+            }
+            in->waiting = false;
+        }
+        if (in->started == false) {
+            in->started = true;
+            mixer->stats.start_latency_ms = (uint32_t)((now - in->play_us) / 1000);
+        }
+        mixed = true;
+    }
+
+    // 64-bit sums: any number of inputs at up to 2x gain cannot wrap before saturation
+    int64_t acc[ch];
+    for (int n = 0; n < samples; n++) {
+        for (int c = 0; c < ch; c++) {
+            acc[c] = main ? (int32_t)main[n * ch + c] * mixer->duck : 0;
+        }
+        mixer->duck = ramp(mixer->duck, mixer->duck_target, mixer->duck_step);
+        for (int i = 0; i < mixer->cfg.max_inputs; i++) {
+            mixer_input_t *in = &mixer->inputs[i];
+            if (in->active == false || in->waiting || n < offset[i]) {
+                continue;
+            }
+            const int16_t *s = in->sound.data + in->pos * in->sound.channel;
+            int32_t g = in->gain;
+            if (in->sound.channel == 1) {
+                int32_t v = (int32_t)s[0] * g;
+                for (int c = 0; c < ch; c++) {
+                    acc[c] += v;
+                }
+            } else {
+                for (int c = 0; c < ch; c++) {
+                    acc[c] += (int32_t)s[c] * g;
+                }
+            }
+            in->gain = ramp(g, in->target, in->step);
+            if (++in->pos >= in->sound.samples) {
+                in->pos = 0;
+                if (in->sound.loop == false) {
+                    finish_input(mixer, i);
+                    update_duck(mixer);
+                    continue;
+                }
+            }
+            if (in->stopping && in->gain == 0) {
+                finish_input(mixer, i);
+                update_duck(mixer);
+            }
+        }
+        for (int c = 0; c < ch; c++) {
+            int64_t v = (acc[c] + (1 << 14)) >> 15;
+            if (v > INT16_MAX) {
+                v = INT16_MAX;
+                mixer->stats.clipped++;
+            } else if (v < INT16_MIN) {
+                v = INT16_MIN;
+                mixer->stats.clipped++;
+            }
+            out[n * ch + c] = (int16_t)v;
+        }
+    }
+    return mixed;
+}
+
+static int ensure_buf(audio_mixer_t *mixer, int size)
+{
+    if (size > mixer->buf_size) {
+        int16_t *buf = (int16_t *)media_lib_realloc(mixer->buf, size);
+        if (buf == NULL) {
+            return ESP_MEDIA_ERR_NO_MEM;
+        }
+        mixer->buf = buf;
+        mixer->buf_size = size;
+    }
+    return ESP_MEDIA_ERR_OK;
+}
+
+static int open_output(audio_mixer_t *mixer)
+{
+    if (mixer->out_open) {
+        return ESP_MEDIA_ERR_OK;
+    }
+    int ret = audio_render_open(mixer->cfg.out, &mixer->cfg.info);
+    if (ret != 0) {
+        ESP_LOGE(TAG, "Fail to open output render ret %d", ret);
+        return ret;
+    }
+    mixer->out_open = true;
+    return ESP_MEDIA_ERR_OK;
+}
+
+static void close_output(audio_mixer_t *mixer)
+{
+    if (mixer->out_open) {
+        audio_render_close(mixer->cfg.out);
+        mixer->out_open = false;
+    }
+}
+
+static void call_done(audio_mixer_t *mixer, mixer_done_t *done, int num)
+{
+    for (int i = 0; i < num; i++) {
+        done[i].done(done[i].input, done[i].ctx);
+    }
+}
+
+// Collected under the lock, called after it so callbacks may play the next sound
+#define TAKE_DONE(mixer, list, num) do {                                   \
+    num = (mixer)->done_num;                                               \
+    memcpy(list, (mixer)->done, num * sizeof(mixer_done_t));               \
+    (mixer)->done_num = 0;                                                 \
+} while (0)
+
+// ============================================
+// Main-Stream Render
+// ============================================
+
+static audio_render_handle_t mixer_render_init(void *cfg, int cfg_size)
+{
+    if (cfg == NULL || cfg_size != sizeof(audio_mixer_t)) {
+        return NULL;
+    }
+    return cfg;
+}
+
+static int mixer_render_open(audio_render_handle_t render, av_render_audio_frame_info_t *info)
+{
+    audio_mixer_t *mixer = (audio_mixer_t *)render;
+    if (info->sample_rate != mixer->cfg.info.sample_rate || info->channel != mixer->cfg.info.channel ||
+        info->bits_per_sample != mixer->cfg.info.bits_per_sample) {
+        ESP_LOGE(TAG, "Main stream %dch %dHz %dbit does not match mixer %dch %dHz", info->channel,
+                 (int)info->sample_rate, info->bits_per_sample, mixer->cfg.info.channel,
+                 (int)mixer->cfg.info.sample_rate);
+        return ESP_MEDIA_ERR_NOT_SUPPORT;
+    }
+    media_lib_mutex_lock(mixer->out_lock, MEDIA_LIB_MAX_LOCK_TIME);
+    int ret = open_output(mixer);
+    if (ret == ESP_MEDIA_ERR_OK) {
+        mixer->main_open = true;
+        mixer->main_idle_us = 0;
+    }
+    media_lib_mutex_unlock(mixer->out_lock);
+    return ret;
+}
+
+static int mixer_render_write(audio_render_handle_t render, av_render_audio_frame_t *frame)
+{
+    audio_mixer_t *mixer = (audio_mixer_t *)render;
+    const int frame_bytes = mixer->cfg.info.channel * sizeof(int16_t);
+    int samples = frame->size / frame_bytes;
+    mixer_done_t done[mixer->cfg.max_inputs];
+    int done_num = 0;
+
+    media_lib_mutex_lock(mixer->out_lock, MEDIA_LIB_MAX_LOCK_TIME);
+    media_lib_mutex_lock(mixer->lock, MEDIA_LIB_MAX_LOCK_TIME);
+    av_render_audio_frame_t out = *frame;
+    // Nothing to mix and no duck ramp in flight: pass the frame through untouched
+    if (mixer_busy(mixer) || mixer->duck != AUDIO_MIXER_GAIN_UNITY) {
+        if (ensure_buf(mixer, samples * frame_bytes) == ESP_MEDIA_ERR_OK) {
+            if (mix_frame(mixer, (const int16_t *)frame->data, mixer->buf, samples, true, frame->pts)) {
+                mixer->stats.mixed_frames++;
+            }
+            out.data = (uint8_t *)mixer->buf;
+            out.size = samples * frame_bytes;
+        } else {
+            // Losing the overlay beats losing the main stream: play the frame as it came
+            if (mixer->stats.unmixed_frames++ == 0) {
+                ESP_LOGW(TAG, "No memory for a %d byte mix buffer, main stream passes through", samples * frame_bytes);
+            }
+        }
+    }
+    mixer->stats.main_frames++;
+    TAKE_DONE(mixer, done, done_num);
+    media_lib_mutex_unlock(mixer->lock);
+    int ret = audio_render_write(mixer->cfg.out, &out);
+    // The mixer task takes over once the stream stays quiet past this frame
+    int64_t frame_us = (int64_t)samples * 1000000 / mixer->cfg.info.sample_rate;
+    mixer->main_idle_us = esp_timer_get_time() + frame_us + mixer->cfg.frame_ms * 1000;
+    media_lib_mutex_unlock(mixer->out_lock);
+    call_done(mixer, done, done_num);
+    return ret;
+}
+
+static int mixer_render_get_latency(audio_render_handle_t render, uint32_t *latency)
+{
+    audio_mixer_t *mixer = (audio_mixer_t *)render;
+    return audio_render_get_latency(mixer->cfg.out, latency);
+}
+
+static int mixer_render_get_frame_info(audio_render_handle_t render, av_render_audio_frame_info_t *info)
+{
+    audio_mixer_t *mixer = (audio_mixer_t *)render;
+    memcpy(info, &mixer->cfg.info, sizeof(av_render_audio_frame_info_t));
+    return 0;
+}
+
+static int mixer_render_set_speed(audio_render_handle_t render, float speed)
+{
+    audio_mixer_t *mixer = (audio_mixer_t *)render;
+    return audio_render_set_speed(mixer->cfg.out, speed);
+}
+
+static int mixer_render_close(audio_render_handle_t render)
+{
+    audio_mixer_t *mixer = (audio_mixer_t *)render;
+    media_lib_mutex_lock(mixer->out_lock, MEDIA_LIB_MAX_LOCK_TIME);
+    mixer->main_open = false;
+    media_lib_mutex_lock(mixer->lock, MEDIA_LIB_MAX_LOCK_TIME);
+    bool busy = mixer_busy(mixer);
+    media_lib_mutex_unlock(mixer->lock);
+    // Inputs still playing keep the output open until the mixer task finishes them
+    if (busy == false) {
+        close_output(mixer);
+    }
+    media_lib_mutex_unlock(mixer->out_lock);
+    return 0;
+}
+
+static void mixer_render_deinit(audio_render_handle_t render)
+{
+    // Owned by audio_mixer_close()
+}
+
+// ============================================
+// Mixer Task
+// ============================================
+
+static void mixer_task(void *arg)
+{
+    audio_mixer_t *mixer = (audio_mixer_t *)arg;
+    const int frame_size = mixer->frame_samples * mixer->cfg.info.channel * sizeof(int16_t);
+    mixer_done_t done[mixer->cfg.max_inputs];
+    int done_num = 0;
+    while (mixer->running) {
+        bool wrote = false;
+        media_lib_mutex_lock(mixer->out_lock, MEDIA_LIB_MAX_LOCK_TIME);
+        bool main_idle = mixer->main_open == false || esp_timer_get_time() > mixer->main_idle_us;
+        media_lib_mutex_lock(mixer->lock, MEDIA_LIB_MAX_LOCK_TIME);
+        if (mixer_busy(mixer) && main_idle && ensure_buf(mixer, frame_size) == ESP_MEDIA_ERR_OK &&
+            open_output(mixer) == ESP_MEDIA_ERR_OK) {
+            mix_frame(mixer, NULL, mixer->buf, mixer->frame_samples, false, 0);
+            mixer->stats.idle_frames++;
+            wrote = true;
+        }
+        bool busy = mixer_busy(mixer);
+        TAKE_DONE(mixer, done, done_num);
+        media_lib_mutex_unlock(mixer->lock);
+        if (wrote) {
+            av_render_audio_frame_t frame = {
+                .data = (uint8_t *)mixer->buf,
+                .size = frame_size,
+            };
+            audio_render_write(mixer->cfg.out, &frame);
+        }
+        if (mixer->main_open == false && busy == false) {
+            close_output(mixer);
+        }
+        media_lib_mutex_unlock(mixer->out_lock);
+        call_done(mixer, done, done_num);
+        if (wrote == false) {
+            // Woken by audio_mixer_play() and audio_mixer_close(). With inputs playing behind the
+            // main stream the timeout notices it going quiet; with none there is nothing to poll.
+            media_lib_sema_lock(mixer->wake, busy ? mixer->cfg.frame_ms : MEDIA_LIB_MAX_LOCK_TIME);
+        }
+    }
+    media_lib_event_group_set_bits(mixer->event, MIXER_QUIT_BIT);
+    media_lib_thread_destroy(NULL);
+}
+
+// ============================================
+// Public API
+// ============================================
+
+audio_mixer_handle_t audio_mixer_open(audio_mixer_cfg_t *cfg)
+{
+    if (cfg == NULL || cfg->out == NULL || cfg->info.bits_per_sample != 16 || cfg->info.channel == 0 ||
+        cfg->info.sample_rate == 0) {
+        ESP_LOGE(TAG, "Mixer needs an output render and a 16 bits format");
+        return NULL;
+    }
+    audio_mixer_t *mixer = (audio_mixer_t *)media_lib_calloc(1, sizeof(audio_mixer_t));
+    if (mixer == NULL) {
+        return NULL;
+    }
+    mixer->cfg = *cfg;
+    if (mixer->cfg.max_inputs == 0) {
+        mixer->cfg.max_inputs = MIXER_DEFAULT_INPUTS;
+    }
+    if (mixer->cfg.frame_ms == 0) {
+        mixer->cfg.frame_ms = MIXER_DEFAULT_FRAME_MS;
+    }
+    if (mixer->cfg.ramp_ms == 0) {
+        mixer->cfg.ramp_ms = MIXER_DEFAULT_RAMP_MS;
+    }
+    if (mixer->cfg.duck_gain == 0) {
+        mixer->cfg.duck_gain = MIXER_DEFAULT_DUCK_GAIN;
+    }
+    mixer->ramp_samples = cfg->info.sample_rate * mixer->cfg.ramp_ms / 1000;
+    mixer->frame_samples = cfg->info.sample_rate * mixer->cfg.frame_ms / 1000;
+    mixer->duck = AUDIO_MIXER_GAIN_UNITY;
+    mixer->duck_target = AUDIO_MIXER_GAIN_UNITY;
+    do {
+        mixer->inputs = (mixer_input_t *)media_lib_calloc(mixer->cfg.max_inputs, sizeof(mixer_input_t));
+        mixer->done = (mixer_done_t *)media_lib_calloc(mixer->cfg.max_inputs, sizeof(mixer_done_t));
+        if (mixer->inputs == NULL || mixer->done == NULL) {
+            break;
+        }
+        if (media_lib_mutex_create(&mixer->lock) != 0 || media_lib_mutex_create(&mixer->out_lock) != 0 ||
+            media_lib_sema_create(&mixer->wake) != 0 ||
+            media_lib_event_group_create(&mixer->event) != 0) {
+            break;
+        }
+        audio_render_cfg_t render_cfg = {
+            .ops = {
+                .init = mixer_render_init,
+                .open = mixer_render_open,
+                .write = mixer_render_write,
+                .get_latency = mixer_render_get_latency,
+                .get_frame_info = mixer_render_get_frame_info,
+                .set_speed = mixer_render_set_speed,
+                .close = mixer_render_close,
+                .deinit = mixer_render_deinit,
+            },
+            .cfg = mixer,
+            .cfg_size = sizeof(audio_mixer_t),
+        };
+        mixer->render = audio_render_alloc_handle(&render_cfg);
+        if (mixer->render == NULL) {
+            break;
+        }
+        media_lib_thread_handle_t thread = NULL;
+        mixer->running = true;
+        if (media_lib_thread_create_from_scheduler(&thread, "AMixer", mixer_task, mixer) != 0) {
+            mixer->running = false;
+            break;
+        }
+        ESP_LOGI(TAG, "Mixer %dch %dHz, %d inputs, %d ms frames", cfg->info.channel, (int)cfg->info.sample_rate,
+                 mixer->cfg.max_inputs, mixer->cfg.frame_ms);
+        return mixer;
+    } while (0);
+    ESP_LOGE(TAG, "Fail to open mixer");
+    audio_mixer_close(mixer);
+    return NULL;
+}
+
+audio_render_handle_t audio_mixer_get_render(audio_mixer_handle_t h)
+{
+    audio_mixer_t *mixer = (audio_mixer_t *)h;
+    return mixer ? mixer->render : NULL;
+}
+
+int audio_mixer_play(audio_mixer_handle_t h, const audio_mixer_sound_t *sound, int *input)
+{
+    audio_mixer_t *mixer = (audio_mixer_t *)h;
+    if (mixer == NULL || sound == NULL || sound->data == NULL || sound->samples == 0 ||
+        (sound->channel != 1 && sound->channel != mixer->cfg.info.channel)) {
+        return ESP_MEDIA_ERR_INVALID_ARG;
+    }
+    int ret = ESP_MEDIA_ERR_EXCEED_LIMIT;
+    media_lib_mutex_lock(mixer->lock, MEDIA_LIB_MAX_LOCK_TIME);
+    for (int i = 0; i < mixer->cfg.max_inputs; i++) {
+        mixer_input_t *in = &mixer->inputs[i];
+        if (in->active) {
+            continue;
+        }
+        memset(in, 0, sizeof(mixer_input_t));
+        in->sound = *sound;
+        in->target = sound->gain ? sound->gain : AUDIO_MIXER_GAIN_UNITY;
+        in->step = ramp_step(mixer, 0, in->target);
+        // Only main-stream frames carry a pts; a mixer task frame starts it at once
+        in->waiting = sound->at_pts;
+        in->play_us = esp_timer_get_time();
+        in->active = true;
+        mixer->stats.started++;
+        update_duck(mixer);
+        if (input) {
+            *input = i;
+        }
+        ret = ESP_MEDIA_ERR_OK;
+        break;
+    }
+    media_lib_mutex_unlock(mixer->lock);
+    if (ret == ESP_MEDIA_ERR_OK) {
+        media_lib_sema_unlock(mixer->wake);
+    } else {
+        ESP_LOGW(TAG, "All %d mixer inputs busy", mixer->cfg.max_inputs);
+    }
+    return ret;
+}
+
+int audio_mixer_stop(audio_mixer_handle_t h, int input)
+{
+    audio_mixer_t *mixer = (audio_mixer_t *)h;
+    if (mixer == NULL || input < 0 || input >= mixer->cfg.max_inputs) {
+        return ESP_MEDIA_ERR_INVALID_ARG;
+    }
+    int ret = ESP_MEDIA_ERR_INVALID_ARG;
+    media_lib_mutex_lock(mixer->lock, MEDIA_LIB_MAX_LOCK_TIME);
+    mixer_input_t *in = &mixer->inputs[input];
+    if (in->active) {
+        in->stopping = true;
+        in->target = 0;
+        in->step = ramp_step(mixer, in->gain, 0);
+        update_duck(mixer);
+        ret = ESP_MEDIA_ERR_OK;
+    }
+    media_lib_mutex_unlock(mixer->lock);
+    return ret;
+}
+
+int audio_mixer_set_gain(audio_mixer_handle_t h, int input, uint16_t gain)
+{
+    audio_mixer_t *mixer = (audio_mixer_t *)h;
+    if (mixer == NULL || input < 0 || input >= mixer->cfg.max_inputs) {
+        return ESP_MEDIA_ERR_INVALID_ARG;
+    }
+    int ret = ESP_MEDIA_ERR_INVALID_ARG;
+    media_lib_mutex_lock(mixer->lock, MEDIA_LIB_MAX_LOCK_TIME);
+    mixer_input_t *in = &mixer->inputs[input];
+    if (in->active && in->stopping == false) {
+        in->target = gain;
+        in->step = ramp_step(mixer, in->gain, gain);
+        ret = ESP_MEDIA_ERR_OK;
+    }
+    media_lib_mutex_unlock(mixer->lock);
+    return ret;
+}
+
+int audio_mixer_get_stats(audio_mixer_handle_t h, audio_mixer_stats_t *stats)
+{
+    audio_mixer_t *mixer = (audio_mixer_t *)h;
+    if (mixer == NULL || stats == NULL) {
+        return ESP_MEDIA_ERR_INVALID_ARG;
+    }
+    media_lib_mutex_lock(mixer->lock, MEDIA_LIB_MAX_LOCK_TIME);
+    *stats = mixer->stats;
+    media_lib_mutex_unlock(mixer->lock);
+    return ESP_MEDIA_ERR_OK;
+}
+
+void audio_mixer_close(audio_mixer_handle_t h)
+{
+    audio_mixer_t *mixer = (audio_mixer_t *)h;
+    if (mixer == NULL) {
+        return;
+    }
+    if (mixer->running) {
+        mixer->running = false;
+        media_lib_sema_unlock(mixer->wake);
+        media_lib_event_group_wait_bits(mixer->event, MIXER_QUIT_BIT, MEDIA_LIB_MAX_LOCK_TIME);
+    }
+    close_output(mixer);
+    if (mixer->render) {
+        audio_render_free_handle(mixer->render);
+    }
+    if (mixer->event) {
+        media_lib_event_group_destroy(mixer->event);
+    }
+    if (mixer->wake) {
+        media_lib_sema_destroy(mixer->wake);
+    }
+    if (mixer->lock) {
+        media_lib_mutex_destroy(mixer->lock);
+    }
+    if (mixer->out_lock) {
+        media_lib_mutex_destroy(mixer->out_lock);
+    }
+    media_lib_free(mixer->inputs);
+    media_lib_free(mixer->done);
+    media_lib_free(mixer->buf);
+    media_lib_free(mixer);
+}
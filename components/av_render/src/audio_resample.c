@@ -46,6 +46,7 @@
  *
  */
 #include "audio_resample.h"
+#include "audio_resample_fused.h"
 #include "esp_ae_ch_cvt.h"
 #include "esp_ae_rate_cvt.h"
 #include "esp_ae_bit_cvt.h"
@@ -78,6 +79,7 @@ typedef struct {
     esp_ae_bit_cvt_handle_t  bit_cvt_handle;
     resample_ops_t           ops[3];
     work_buf_t               work_buf[2];
+    resample_fused_handle_t  fused;
 } resample_t;
 
 static int add_bits_resample(resample_t *resample, audio_resample_cfg_t *cfg, int i)
@@ -156,6 +158,15 @@ audio_resample_handle_t audio_resample_open(audio_resample_cfg_t *cfg)
         if (resample == NULL) {
             break;
         }
+        // Common tuples convert in one pass, the rest chain esp_ae operations
+        if (cfg->generic_only == false && resample_fused_supported(&cfg->input_info, &cfg->output_info)) {
+            resample->fused = resample_fused_open(&cfg->input_info, &cfg->output_info);
+            if (resample->fused == NULL) {
+                break;
+            }
+            resample->cfg = *cfg;
+            return resample;
+        }
         sort_resample_ops(resample, cfg);
         av_render_audio_frame_info_t cur_info = cfg->input_info;
         esp_ae_err_t ret = ESP_AE_ERR_OK;
@@ -217,6 +228,22 @@ audio_resample_handle_t audio_resample_open(audio_resample_cfg_t *cfg)
 int audio_resample_write(audio_resample_handle_t h, av_render_audio_frame_t *data)
 {
     resample_t *resample = (resample_t *)h;
+    if (data->size && resample->fused) {
+        work_buf_t *out = alloc_work_buf(resample, resample_fused_max_out_size(resample->fused, data->size));
+        if (out == NULL) {
+            return ESP_MEDIA_ERR_NO_MEM;
+        }
+        int size = resample_fused_process(resample->fused, data->data, data->size, out->data);
+        release_work_buf(out);
+        if (size < 0) {
+            return ESP_MEDIA_ERR_NO_MEM;
+        }
+        av_render_audio_frame_t new_frame = *data;
+        new_frame.data = out->data;
+        new_frame.size = size;
+        resample->cfg.resample_cb(&new_frame, resample->cfg.ctx);
+        return ESP_MEDIA_ERR_OK;
+    }
     // Bypass or size is 0
     if (data->size == 0 || resample->ops[0] == RESAMPLE_OPS_NONE) {
         resample->cfg.resample_cb(data, resample->cfg.ctx);
@@ -270,6 +297,10 @@ void audio_resample_close(audio_resample_handle_t h)
     if (resample == NULL) {
         return;
     }
+    if (resample->fused) {
+        resample_fused_close(resample->fused);
+        resample->fused = NULL;
+    }
     if (resample->bit_cvt_handle) {
         esp_ae_bit_cvt_close(resample->bit_cvt_handle);
         resample->bit_cvt_handle = NULL;
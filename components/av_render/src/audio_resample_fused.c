@@ -0,0 +1,355 @@
+/**
+ * @file audio_resample_fused.c
+ * @brief Single-pass 16-bit converters for the common resample tuples
+ *
+ * Each kernel reads the input once, folding the downmix into the load of
+ * the filter history line, and writes the output once, duplicating into
+ * both channels on the store. The rate change is a polyphase FIR: a
+ * Kaiser-windowed sinc designed at open time for the reduced ratio L:M
+ * (output:input rate), split into L phases of T taps so each output sample
+ * costs T multiply-accumulates. Channel counts, L, M and T are constants in
+ * every kernel, so the compiler unrolls the tap loop and drops the phase
+ * bookkeeping when L is 1.
+ */
+
+#include "audio_resample_fused.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "media_lib_os.h"
+#include "esp_log.h"
+
+#define TAG "RESAMPLE_FUSED"
+
+#define FIR_ZERO_CROSSINGS  16          // Sinc zero crossings each side at the narrower rate
+#define FIR_ATTEN_DB        70.0f       // Kaiser design stopband
+#define FIR_COEF_SHIFT      14          // Q14: 96 taps of full-scale input stay inside int32
+#define FIR_TAPS(L, M)      (FIR_ZERO_CROSSINGS * 2 * (((M) + (L) - 1) / (L)))
+
+#define ELEMS(a) (sizeof(a) / sizeof(a[0]))
+
+// ============================================
+// Private Types
+// ============================================
+
+typedef struct resample_fused resample_fused_t;
+
+typedef int (*fused_kernel_fn_t)(resample_fused_t *r, const int16_t *in, int samples, int16_t *out);
+
+typedef struct {
+    uint8_t in_ch;
+    uint8_t out_ch;
+    uint8_t up;                         // L: output rate / gcd
+    uint8_t down;                       // M: input rate / gcd
+    const char *name;
+    fused_kernel_fn_t fn;
+} fused_kernel_t;
+
+struct resample_fused {
+    const fused_kernel_t *kernel;
+    int in_ch;
+    int out_ch;
+    int up;
+    int down;
+    int taps;                           // Per phase
+    int16_t *coef;                      // up x taps, each phase reversed
+    int16_t *line;                      // taps - 1 samples of history, then the frame
+    int line_samples;                   // Frame capacity of line
+    int pos;                            // Next output's newest input, relative to the frame
+    int phase;
+};
+
+// ============================================
+// Kernels
+// ============================================
+
+static inline int16_t sat16(int32_t v)
+{
+    if (v > INT16_MAX) {
+        return INT16_MAX;
+    }
+    if (v < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return (int16_t)v;
+}
+
+static inline __attribute__((always_inline)) int16_t *load_line(resample_fused_t *r, const int16_t *in, int samples,
+                                                               const int in_ch, const int taps)
+{
+    int16_t *x = r->line + taps - 1;
+    if (in_ch == 2) {
+        for (int i = 0; i < samples; i++) {
+            x[i] = (int16_t)((in[2 * i] + in[2 * i + 1]) >> 1);
+        }
+    } else {
+        memcpy(x, in, samples * sizeof(int16_t));
+    }
+    return x;
+}
+
+static inline __attribute__((always_inline)) int fir_kernel(resample_fused_t *r, const int16_t *in, int samples,
+                                                           int16_t *out, const int in_ch, const int out_ch,
+                                                           const int up, const int down, const int taps)
+{
+    int16_t *x = load_line(r, in, samples, in_ch, taps);
+    int pos = r->pos;
+    int phase = r->phase;
+    int n = 0;
+    while (pos < samples) {
+        const int16_t *h = r->coef + phase * taps;
+        const int16_t *s = x + pos - (taps - 1);
+        int32_t acc = 1 << (FIR_COEF_SHIFT - 1);
+        for (int k = 0; k < taps; k++) {
+            acc += (int32_t)h[k] * s[k];
+        }
+        int16_t v = sat16(acc >> FIR_COEF_SHIFT);
+        out[n * out_ch] = v;
+        if (out_ch == 2) {
+            out[n * out_ch + 1] = v;
+        }
+        n++;
+        phase += down;
+        pos += phase / up;
+        phase %= up;
+    }
+    r->pos = pos - samples;
+    r->phase = phase;
+    // Keep the newest taps - 1 samples as history for the next frame
+    memmove(r->line, r->line + samples, (taps - 1) * sizeof(int16_t));
+    return n;
+}
+
+static int kernel_downmix(resample_fused_t *r, const int16_t *in, int samples, int16_t *out)
+{
+    for (int i = 0; i < samples; i++) {
+        out[i] = (int16_t)((in[2 * i] + in[2 * i + 1]) >> 1);
+    }
+    return samples;
+}
+
+static int kernel_upmix(resample_fused_t *r, const int16_t *in, int samples, int16_t *out)
+{
+    for (int i = 0; i < samples; i++) {
+        out[2 * i] = in[i];
+        out[2 * i + 1] = in[i];
+    }
+    return samples;
+}
+
+#define FUSED_FIR_KERNEL(in_ch, out_ch, up, down)                                                    \
+    static int kernel_##in_ch##_##out_ch##_##up##_##down(resample_fused_t *r, const int16_t *in,     \
+                                                          int samples, int16_t *out)                 \
+    {                                                                                                \
+        return fir_kernel(r, in, samples, out, in_ch, out_ch, up, down, FIR_TAPS(up, down));         \
+    }
+
+FUSED_FIR_KERNEL(2, 1, 1, 2)            // ES7210 feed: 2ch 16k -> 1ch 8k
+FUSED_FIR_KERNEL(2, 1, 1, 3)            // 2ch 48k -> 1ch 16k
+FUSED_FIR_KERNEL(1, 1, 1, 2)            // 16k -> 8k
+FUSED_FIR_KERNEL(1, 1, 1, 3)            // 48k -> 16k
+FUSED_FIR_KERNEL(1, 1, 2, 1)            // 8k -> 16k
+FUSED_FIR_KERNEL(1, 1, 3, 2)            // 16k -> 24k
+FUSED_FIR_KERNEL(1, 1, 3, 1)            // 16k -> 48k
+FUSED_FIR_KERNEL(1, 2, 2, 1)            // Speaker: 1ch 8k -> 2ch 16k
+FUSED_FIR_KERNEL(1, 2, 3, 2)            // Speaker: 1ch 16k -> 2ch 24k
+FUSED_FIR_KERNEL(1, 2, 3, 1)            // 1ch 16k -> 2ch 48k
+
+static const fused_kernel_t s_kernels[] = {
+    {2, 1, 1, 1, "2ch_to_1ch", kernel_downmix},
+    {1, 2, 1, 1, "1ch_to_2ch", kernel_upmix},
+    {2, 1, 1, 2, "2ch_to_1ch_1:2", kernel_2_1_1_2},
+    {2, 1, 1, 3, "2ch_to_1ch_1:3", kernel_2_1_1_3},
+    {1, 1, 1, 2, "1ch_1:2", kernel_1_1_1_2},
+    {1, 1, 1, 3, "1ch_1:3", kernel_1_1_1_3},
+    {1, 1, 2, 1, "1ch_2:1", kernel_1_1_2_1},
+    {1, 1, 3, 2, "1ch_3:2", kernel_1_1_3_2},
+    {1, 1, 3, 1, "1ch_3:1", kernel_1_1_3_1},
+    {1, 2, 2, 1, "1ch_to_2ch_2:1", kernel_1_2_2_1},
+    {1, 2, 3, 2, "1ch_to_2ch_3:2", kernel_1_2_3_2},
+    {1, 2, 3, 1, "1ch_to_2ch_3:1", kernel_1_2_3_1},
+};
+
+// ============================================
+// Filter Design
+// ============================================
+
+static uint32_t gcd_u32(uint32_t a, uint32_t b)
+{
+    while (b) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+static const fused_kernel_t *find_kernel(const av_render_audio_frame_info_t *in, const av_render_audio_frame_info_t *out)
+{
+    if (in->bits_per_sample != 16 || out->bits_per_sample != 16 || in->sample_rate == 0 || out->sample_rate == 0) {
+        return NULL;
+    }
+    uint32_t g = gcd_u32(in->sample_rate, out->sample_rate);
+    uint32_t up = out->sample_rate / g;
+    uint32_t down = in->sample_rate / g;
+    for (int i = 0; i < ELEMS(s_kernels); i++) {
+        const fused_kernel_t *k = &s_kernels[i];
+        if (k->in_ch == in->channel && k->out_ch == out->channel && k->up == up && k->down == down) {
+            return k;
+        }
+    }
+    return NULL;
+}
+
+static float bessel_i0(float x)
+{
+    float sum = 1.0f;
+    float term = 1.0f;
+    for (int k = 1; k < 32; k++) {
+        term *= (x / (2.0f * k)) * (x / (2.0f * k));
+        sum += term;
+        if (term < sum * 1e-9f) {
+            break;
+        }
+    }
+    return sum;
+}
+
+/**
+ * @brief Design the prototype low-pass at the upsampled rate and split it
+ *
+ * The cutoff sits half a transition band below the narrower Nyquist so the
+ * stopband starts at it. Every phase is scaled to unity DC gain after
+ * quantization, which keeps the phases from modulating a DC offset into a
+ * tone at the output rate.
+ */
+static void design_filter(resample_fused_t *r)
+{
+    int len = r->up * r->taps;
+    int narrow = r->up > r->down ? r->up : r->down;
+    float center = (len - 1) * 0.5f;
+    float beta = 0.1102f * (FIR_ATTEN_DB - 8.7f);
+    // Kaiser transition width in cycles per upsampled sample
+    float transition = (FIR_ATTEN_DB - 7.95f) / (14.36f * len);
+    float fc = 0.5f / narrow - 0.5f * transition;
+    float i0_beta = bessel_i0(beta);
+    for (int p = 0; p < r->up; p++) {
+        float proto[r->taps];
+        float sum = 0.0f;
+        for (int k = 0; k < r->taps; k++) {
+            // Tap k multiplies the input taps - 1 - k samples before the newest
+            int j = p + (r->taps - 1 - k) * r->up;
+            float t = j - center;
+            float w = 2.0f * t / (len - 1);
+            float win = bessel_i0(beta * sqrtf(fmaxf(0.0f, 1.0f - w * w))) / i0_beta;
+            float x = 2.0f * fc * t;
+            float sinc = (t == 0.0f) ? 1.0f : sinf((float)M_PI * x) / ((float)M_PI * x);
+            proto[k] = 2.0f * fc * sinc * win;
+            sum += proto[k];
+        }
+        int32_t qsum = 0;
+        int peak = 0;
+        for (int k = 0; k < r->taps; k++) {
+            int16_t q = (int16_t)lrintf(proto[k] / sum * (1 << FIR_COEF_SHIFT));
+            r->coef[p * r->taps + k] = q;
+            qsum += q;
+            if (abs(q) > abs(r->coef[p * r->taps + peak])) {
+                peak = k;
+            }
+        }
+        // Rounding leftovers go to the largest tap
+        r->coef[p * r->taps + peak] += (int16_t)((1 << FIR_COEF_SHIFT) - qsum);
+    }
+}
+
+// ============================================
+// Public API
+// ============================================
+
+bool resample_fused_supported(const av_render_audio_frame_info_t *in, const av_render_audio_frame_info_t *out)
+{
+    return in && out && find_kernel(in, out) != NULL;
+}
+
+resample_fused_handle_t resample_fused_open(const av_render_audio_frame_info_t *in,
+                                            const av_render_audio_frame_info_t *out)
+{
+    const fused_kernel_t *kernel = (in && out) ? find_kernel(in, out) : NULL;
+    if (kernel == NULL) {
+        return NULL;
+    }
+    resample_fused_t *r = (resample_fused_t *)media_lib_calloc(1, sizeof(resample_fused_t));
+    if (r == NULL) {
+        return NULL;
+    }
+    r->kernel = kernel;
+    r->in_ch = kernel->in_ch;
+    r->out_ch = kernel->out_ch;
+    r->up = kernel->up;
+    r->down = kernel->down;
+    if (r->up != 1 || r->down != 1) {
+        r->taps = FIR_TAPS(r->up, r->down);
+        r->coef = (int16_t *)media_lib_calloc(r->up * r->taps, sizeof(int16_t));
+        if (r->coef == NULL) {
+            resample_fused_close(r);
+            return NULL;
+        }
+        design_filter(r);
+    }
+    ESP_LOGI(TAG, "Fused %s for %dch %dHz -> %dch %dHz (%d taps)", kernel->name, in->channel,
+             (int)in->sample_rate, out->channel, (int)out->sample_rate, r->taps);
+    return r;
+}
+
+int resample_fused_max_out_size(resample_fused_handle_t h, int in_size)
+{
+    resample_fused_t *r = (resample_fused_t *)h;
+    int samples = in_size / (r->in_ch * (int)sizeof(int16_t));
+    int out_samples = (int)(((int64_t)samples * r->up + r->down - 1) / r->down) + 1;
+    return out_samples * r->out_ch * (int)sizeof(int16_t);
+}
+
+int resample_fused_process(resample_fused_handle_t h, const uint8_t *in, int in_size, uint8_t *out)
+{
+    resample_fused_t *r = (resample_fused_t *)h;
+    int samples = in_size / (r->in_ch * (int)sizeof(int16_t));
+    if (samples <= 0) {
+        return 0;
+    }
+    if (r->taps && samples > r->line_samples) {
+        // Line is zero history at open; growth keeps the history in front
+        int16_t *line = (int16_t *)media_lib_realloc(r->line, (r->taps - 1 + samples) * sizeof(int16_t));
+        if (line == NULL) {
+            return -1;
+        }
+        if (r->line == NULL) {
+            memset(line, 0, (r->taps - 1) * sizeof(int16_t));
+        }
+        r->line = line;
+        r->line_samples = samples;
+    }
+    int n = r->kernel->fn(r, (const int16_t *)in, samples, (int16_t *)out);
+    return n * r->out_ch * (int)sizeof(int16_t);
+}
+
+const char *resample_fused_name(resample_fused_handle_t h)
+{
+    resample_fused_t *r = (resample_fused_t *)h;
+    return r ? r->kernel->name : "";
+}
+
+void resample_fused_close(resample_fused_handle_t h)
+{
+    resample_fused_t *r = (resample_fused_t *)h;
+    if (r == NULL) {
+        return;
+    }
+    if (r->coef) {
+        media_lib_free(r->coef);
+    }
+    if (r->line) {
+        media_lib_free(r->line);
+    }
+    media_lib_free(r);
+}
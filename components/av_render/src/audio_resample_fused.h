@@ -0,0 +1,69 @@
+/**
+ * @file audio_resample_fused.h
+ * @brief Single-pass 16-bit converters for the common resample tuples
+ *
+ * Channel conversion and a polyphase FIR rate change run as one kernel
+ * per (channels, rate ratio) tuple, specialized at compile time and picked
+ * when the resampler opens. Tuples without a kernel (other bit depths,
+ * stereo to stereo rate changes, ratios beyond 3:1) stay on the generic
+ * esp_ae chain in audio_resample.c.
+ *
+ * No esp_ae dependency, so the host build checks and benchmarks the
+ * kernels directly.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "av_render_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct resample_fused *resample_fused_handle_t;
+
+/**
+ * @brief Check whether a fused kernel covers the conversion
+ */
+bool resample_fused_supported(const av_render_audio_frame_info_t *in, const av_render_audio_frame_info_t *out);
+
+/**
+ * @brief Open a fused converter and design its filter
+ *
+ * @return NULL when unsupported or out of memory
+ */
+resample_fused_handle_t resample_fused_open(const av_render_audio_frame_info_t *in,
+                                            const av_render_audio_frame_info_t *out);
+
+/**
+ * @brief Largest output in bytes for an input of in_size bytes
+ */
+int resample_fused_max_out_size(resample_fused_handle_t h, int in_size);
+
+/**
+ * @brief Convert one frame
+ *
+ * Filter history and phase carry over between calls, so frames of any
+ * length join without a seam. Internal buffers only grow when a frame is
+ * longer than every previous one.
+ *
+ * @param out At least resample_fused_max_out_size(in_size) bytes
+ * @return Output size in bytes, negative when out of memory
+ */
+int resample_fused_process(resample_fused_handle_t h, const uint8_t *in, int in_size, uint8_t *out);
+
+/**
+ * @brief Kernel name (e.g. "2ch_to_1ch_1:2")
+ */
+const char *resample_fused_name(resample_fused_handle_t h);
+
+/**
+ * @brief Close the converter
+ */
+void resample_fused_close(resample_fused_handle_t h);
+
+#ifdef __cplusplus
+}
+#endif
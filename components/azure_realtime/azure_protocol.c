@@ -8,6 +8,7 @@
 
 #include "azure_protocol.h"
 
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include "esp_log.h"
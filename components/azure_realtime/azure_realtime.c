@@ -7,6 +7,10 @@
 
 #include "azure_realtime.h"
 #include "azure_protocol.h"
+#include "capture_spool.h"
+#include "latency_ledger.h"
+#include "realtime_link.h"
+#include "trace_ring.h"
 
 #include <string.h>
 #include "esp_log.h"
@@ -15,7 +19,6 @@
 #include "esp_crt_bundle.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "freertos/queue.h"
 
 static const char *TAG = "AZURE_RT";
 
@@ -24,34 +27,35 @@ static const char *TAG = "AZURE_RT";
 // ============================================
 
 #define AZURE_AUDIO_CHUNK_SIZE  960    // 60ms @ 8kHz × 2 bytes = 960 bytes per chunk
-#define AUDIO_QUEUE_SIZE        20     // Buffer 20 chunks (~1.2 seconds)
 #define AUDIO_BATCH_FRAMES      2      // Send 2 frames (~120ms) at a time
+#define REPLAY_BATCH_FRAMES     8      // 480ms per message while catching up (~5.2KB base64)
 #define AUDIO_BATCH_TIMEOUT_MS  100    // Or timeout after 100ms
-#define RECONNECT_DELAY_MS      5000   // 5 second delay before reconnection
 #define WS_BUFFER_SIZE          8192   // WebSocket send buffer size
 
-// ============================================
-// Audio Chunk Structure
-// ============================================
-
-typedef struct {
-    uint8_t data[AZURE_AUDIO_CHUNK_SIZE];
-    size_t size;
-} audio_chunk_t;
-
 // ============================================
 // Static Variables
 // ============================================
 
 static esp_websocket_client_handle_t s_ws_client = NULL;
+static realtime_link_handle_t s_link = NULL;
 static azure_realtime_config_t s_config = {0};
 static azure_state_t s_state = AZURE_STATE_DISCONNECTED;
-static QueueHandle_t s_audio_queue = NULL;
+static capture_spool_handle_t s_spool = NULL;
 static TaskHandle_t s_task_handle = NULL;
 static volatile bool s_task_running = false;
 static volatile bool s_ws_cleanup_needed = false;
 static volatile bool s_session_update_pending = false;
 
+// Turn bookkeeping against spool positions: commit and response.create are
+// sent by the task once the audio they close has gone out, and the turn's
+// audio is released when the server starts answering
+static portMUX_TYPE s_turn_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint64_t s_commit_pos = 0;           // Spool position the commit closes
+static bool s_commit_pending = false;       // Commit waits for its audio
+static bool s_response_pending = false;     // response.create follows the commit
+static bool s_turn_unacked = false;         // Commit sent, no response yet
+static volatile uint32_t s_ready_gen = 0;   // Sessions that reached READY
+
 // Session ID (received from session.created event)
 static char s_session_id[64] = {0};
 
@@ -140,6 +144,26 @@ static inline int16_t ulaw_to_linear(uint8_t ulaw)
     return ulaw_exp_table[ulaw];
 }
 
+// ============================================
+// Capture Spool Turn Tracking
+// ============================================
+
+/**
+ * @brief The server has acted on the committed turn: stop holding its audio
+ */
+static void release_turn(void)
+{
+    portENTER_CRITICAL(&s_turn_lock);
+    bool unacked = s_turn_unacked;
+    uint64_t pos = s_commit_pos;
+    s_turn_unacked = false;
+    portEXIT_CRITICAL(&s_turn_lock);
+
+    if (unacked) {
+        capture_spool_release(s_spool, pos);
+    }
+}
+
 // ============================================
 // Azure Event Handler
 // ============================================
@@ -161,7 +185,11 @@ static void handle_azure_event(const char *json_str, const char *event_type)
     // Session events
     if (strcmp(event_type, "session.created") == 0) {
         ESP_LOGI(TAG, "✅ Session created");
+        if (s_state != AZURE_STATE_READY && s_state != AZURE_STATE_STREAMING) {
+            s_ready_gen++;
+        }
         s_state = AZURE_STATE_READY;
+        realtime_link_on_ready(s_link);
 
         // Parse session ID
         cJSON *session = cJSON_GetObjectItem(root, "session");
@@ -211,6 +239,7 @@ static void handle_azure_event(const char *json_str, const char *event_type)
     else if (strcmp(event_type, "response.created") == 0) {
         ESP_LOGI(TAG, "🤖 Response created - AI responding");
         s_state = AZURE_STATE_STREAMING;
+        release_turn();
 
         if (s_config.callback) {
             azure_event_t event = {.type = AZURE_MSG_TYPE_RESPONSE_CREATED};
@@ -237,6 +266,8 @@ static void handle_azure_event(const char *json_str, const char *event_type)
         size_t ulaw_size = sizeof(ulaw_buffer);
 
         if (azure_protocol_parse_audio_delta(json_str, ulaw_buffer, &ulaw_size)) {
+            latency_ledger_mark(LATENCY_MARK_FIRST_AUDIO_DELTA);
+
             // Decode G.711 μ-law → PCM16
             static int16_t pcm_buffer[2048];
             for (size_t i = 0; i < ulaw_size; i++) {
@@ -264,6 +295,7 @@ static void handle_azure_event(const char *json_str, const char *event_type)
     }
     else if (strcmp(event_type, "response.done") == 0) {
         ESP_LOGI(TAG, "✅ Response complete");
+        latency_ledger_mark(LATENCY_MARK_RESPONSE_DONE);
         s_state = AZURE_STATE_READY;
 
         if (s_config.callback) {
@@ -276,6 +308,8 @@ static void handle_azure_event(const char *json_str, const char *event_type)
         char error_msg[256] = {0};
         int error_code = 0;
 
+        // A rejected turn is not sent again on the next session
+        release_turn();
         if (azure_protocol_parse_error(json_str, error_msg, sizeof(error_msg), &error_code)) {
             ESP_LOGE(TAG, "❌ Error: %s (code: %d)", error_msg, error_code);
 
@@ -313,6 +347,85 @@ static inline bool is_ws_client_valid(void)
              s_state == AZURE_STATE_STREAMING));
 }
 
+// ============================================
+// Turn Commit and Replay (task context)
+// ============================================
+
+static int send_commit(void)
+{
+    char buffer[128];
+    int len = azure_protocol_build_audio_commit(buffer, sizeof(buffer));
+    if (len <= 0) {
+        return ESP_FAIL;
+    }
+    ESP_LOGI(TAG, "📤 Sending input_audio_buffer.commit");
+    int ret = esp_websocket_client_send_text(s_ws_client, buffer, len, portMAX_DELAY);
+    if (ret >= 0) {
+        latency_ledger_mark(LATENCY_MARK_COMMIT_SENT);
+    }
+    return ret;
+}
+
+static int send_response_create(void)
+{
+    char buffer[512];
+    int len = azure_protocol_build_response_create(buffer, sizeof(buffer));
+    if (len <= 0) {
+        return ESP_FAIL;
+    }
+    ESP_LOGI(TAG, "📤 Sending response.create");
+    return esp_websocket_client_send_text(s_ws_client, buffer, len, portMAX_DELAY);
+}
+
+/**
+ * @brief Send the deferred commit / response.create once the audio is out
+ *
+ * @param read_pos Spool position sent so far
+ */
+static void send_pending_turn(uint64_t read_pos)
+{
+    portENTER_CRITICAL(&s_turn_lock);
+    bool commit = s_commit_pending && read_pos >= s_commit_pos;
+    bool response = s_response_pending && (commit || !s_commit_pending);
+    if (commit) {
+        s_commit_pending = false;
+        s_turn_unacked = true;
+    }
+    if (response) {
+        s_response_pending = false;
+    }
+    portEXIT_CRITICAL(&s_turn_lock);
+
+    if (commit) {
+        send_commit();
+    }
+    if (response) {
+        send_response_create();
+    }
+}
+
+/**
+ * @brief A new session is ready: send again what the last one did not act on
+ */
+static void resume_session(void)
+{
+    size_t replay = capture_spool_rewind(s_spool);
+
+    portENTER_CRITICAL(&s_turn_lock);
+    bool rearm = s_turn_unacked;
+    if (rearm) {
+        s_turn_unacked = false;
+        s_commit_pending = true;
+        s_response_pending = true;
+    }
+    portEXIT_CRITICAL(&s_turn_lock);
+
+    if (replay > 0 || rearm) {
+        ESP_LOGW(TAG, "↩️ Session back: replaying %u bytes of captured audio%s",
+                 (unsigned)replay, rearm ? ", then commit + response.create" : "");
+    }
+}
+
 // ============================================
 // Azure WebSocket Task - Audio Batching
 // ============================================
@@ -322,20 +435,22 @@ static inline bool is_ws_client_valid(void)
  *
  * Uses batch sending to reduce WebSocket message frequency and improve throughput.
  * Accumulates AUDIO_BATCH_FRAMES frames before sending, or sends on timeout.
+ * Audio comes from the capture spool, which keeps recording while the link
+ * is down; a backlog (replay after reconnect) goes out in REPLAY_BATCH_FRAMES
+ * messages until it has caught up.
  */
 static void azure_realtime_task(void *pvParameters)
 {
     ESP_LOGI(TAG, "Azure Realtime task started (batch mode: %d frames, %dms timeout)",
              AUDIO_BATCH_FRAMES, AUDIO_BATCH_TIMEOUT_MS);
 
-    audio_chunk_t chunk;
     static char send_buffer[WS_BUFFER_SIZE];  // Static to avoid 8KB stack usage
 
     // Batch buffer for accumulating audio frames
-    static uint8_t batch_buffer[AZURE_AUDIO_CHUNK_SIZE * AUDIO_BATCH_FRAMES];
+    static uint8_t batch_buffer[AZURE_AUDIO_CHUNK_SIZE * REPLAY_BATCH_FRAMES];
     size_t batch_len = 0;
-    int batch_frames = 0;
     uint32_t batch_start_tick = 0;
+    uint32_t ready_gen = s_ready_gen;
 
     while (s_task_running) {
         // Handle pending cleanup requested by event callbacks
@@ -344,20 +459,27 @@ static void azure_realtime_task(void *pvParameters)
             s_ws_cleanup_needed = false;
         }
 
-        // Handle reconnection if disconnected
+        // Handle reconnection if disconnected (jittered backoff, cut short by pre-warm)
         if (s_state == AZURE_STATE_DISCONNECTED) {
+            uint32_t delay_ms = realtime_link_next_delay_ms(s_link);
+            if (delay_ms > 0) {
+                ESP_LOGI(TAG, "Reconnecting in %lums", (unsigned long)delay_ms);
+                realtime_link_wait(s_link, delay_ms);
+                if (!s_task_running) {
+                    break;
+                }
+            }
             ESP_LOGI(TAG, "Attempting reconnection...");
             azure_realtime_disconnect();  // ensure previous client is fully cleaned
-            esp_err_t ret = azure_realtime_connect();
-            if (ret != ESP_OK) {
-                ESP_LOGW(TAG, "Reconnection failed, will retry in %dms", RECONNECT_DELAY_MS);
+            if (azure_realtime_connect() != ESP_OK) {
+                ESP_LOGW(TAG, "Reconnection failed");
             }
-            vTaskDelay(pdMS_TO_TICKS(RECONNECT_DELAY_MS));
             continue;
         }
 
-        // Send pending session.update after successful connection
-        if (s_state == AZURE_STATE_CONNECTED && s_session_update_pending) {
+        // Send pending session.update after successful connection (session.created
+        // may already have moved the state on to READY)
+        if (s_session_update_pending && is_ws_client_valid()) {
             if (s_ws_client && esp_websocket_client_is_connected(s_ws_client)) {
                 char session_buf[2048];
                 int len = azure_protocol_build_session_update(session_buf, sizeof(session_buf));
@@ -379,50 +501,62 @@ static void azure_realtime_task(void *pvParameters)
             }
         }
 
-        // Process audio queue if connected and ready
-        if (s_state == AZURE_STATE_READY || s_state == AZURE_STATE_STREAMING) {
-            // Try to receive audio with short timeout
-            if (xQueueReceive(s_audio_queue, &chunk, pdMS_TO_TICKS(20)) == pdTRUE) {
-                // Log first chunk to confirm audio flow
-                if (batch_frames == 0 && s_send_count < 3) {
-                    ESP_LOGI(TAG, "🎤 Audio chunk received (state=%d, queue=%d)",
-                             s_state, (int)uxQueueMessagesWaiting(s_audio_queue));
+        // Stream spooled audio once the session is configured
+        if ((s_state == AZURE_STATE_READY || s_state == AZURE_STATE_STREAMING) &&
+            !s_session_update_pending) {
+            // Audio already taken for the previous session is in the replay
+            if (ready_gen != s_ready_gen) {
+                ready_gen = s_ready_gen;
+                batch_len = 0;
+                resume_session();
+            }
+
+            uint64_t read_pos = capture_spool_read_pos(s_spool);
+            size_t backlog = capture_spool_pending(s_spool);
+            size_t target = AZURE_AUDIO_CHUNK_SIZE *
+                            (backlog > AZURE_AUDIO_CHUNK_SIZE * AUDIO_BATCH_FRAMES ? REPLAY_BATCH_FRAMES : AUDIO_BATCH_FRAMES);
+
+            // A commit closes exactly the audio captured before it
+            portENTER_CRITICAL(&s_turn_lock);
+            bool commit_pending = s_commit_pending;
+            uint64_t commit_pos = s_commit_pos;
+            portEXIT_CRITICAL(&s_turn_lock);
+
+            size_t room = batch_len < target ? target - batch_len : 0;
+            if (commit_pending && commit_pos - read_pos < room) {
+                room = (size_t)(commit_pos - read_pos);
+            }
+            if (room > 0) {
+                size_t n = capture_spool_read(s_spool, batch_buffer + batch_len, room, pdMS_TO_TICKS(20));
+                // Log first chunks to confirm audio flow
+                if (n > 0 && batch_len == 0 && s_send_count < 3) {
+                    ESP_LOGI(TAG, "🎤 Audio from spool (state=%d, pending=%u)", s_state, (unsigned)backlog);
                 }
-                // Start batch timer on first frame
-                if (batch_frames == 0) {
+                // Start batch timer on first bytes
+                if (n > 0 && batch_len == 0) {
                     batch_start_tick = xTaskGetTickCount();
                 }
-
-                // Add to batch buffer
-                if (batch_len + chunk.size <= sizeof(batch_buffer)) {
-                    memcpy(batch_buffer + batch_len, chunk.data, chunk.size);
-                    batch_len += chunk.size;
-                    batch_frames++;
-                }
+                batch_len += n;
+                read_pos += n;
             }
 
             // Check if we should send the batch
-            bool should_send = false;
+            bool at_commit = commit_pending && read_pos >= commit_pos;
             uint32_t elapsed_ms = (xTaskGetTickCount() - batch_start_tick) * portTICK_PERIOD_MS;
-
-            if (batch_frames >= AUDIO_BATCH_FRAMES) {
-                should_send = true;  // Reached batch size
-            } else if (batch_frames > 0 && elapsed_ms >= AUDIO_BATCH_TIMEOUT_MS) {
-                should_send = true;  // Timeout with pending data
-            }
+            bool should_send = batch_len >= target || at_commit ||
+                               (batch_len > 0 && elapsed_ms >= AUDIO_BATCH_TIMEOUT_MS);
 
             // Send batch if ready
             if (should_send && batch_len > 0) {
-                // Validate client before sending
+                // Validate client before sending; the audio stays spooled for the replay
                 if (!is_ws_client_valid()) {
-                    ESP_LOGW(TAG, "WebSocket client invalid, dropping audio batch");
+                    ESP_LOGW(TAG, "WebSocket client invalid, batch left for replay");
                     batch_len = 0;
-                    batch_frames = 0;
                     continue;
                 }
 
                 // Convert PCM16 to G.711 μ-law (2:1 compression)
-                static uint8_t ulaw_buffer[AZURE_AUDIO_CHUNK_SIZE * AUDIO_BATCH_FRAMES];
+                static uint8_t ulaw_buffer[AZURE_AUDIO_CHUNK_SIZE * REPLAY_BATCH_FRAMES / 2];
                 size_t ulaw_len = 0;
                 int16_t *pcm_samples = (int16_t *)batch_buffer;
                 size_t num_samples = batch_len / 2;  // 16-bit samples = bytes / 2
@@ -436,9 +570,11 @@ static void azure_realtime_task(void *pvParameters)
                                                              ulaw_buffer, ulaw_len);
                 if (len > 0) {
                     s_send_count++;
-                    ESP_LOGI(TAG, "📤 SEND #%d: %d frames, PCM:%zu → μ-law:%zu → WS:%d bytes (heap: %lu)",
-                             s_send_count, batch_frames, batch_len, ulaw_len, len, esp_get_free_heap_size());
+                    ESP_LOGD(TAG, "📤 SEND #%d: PCM:%zu → μ-law:%zu → WS:%d bytes",
+                             s_send_count, batch_len, ulaw_len, len);
+                    TRACE_BEGIN(TRACE_EV_WS_SEND, TRACE_SRC_AZURE, len);
                     int ret = esp_websocket_client_send_text(s_ws_client, send_buffer, len, pdMS_TO_TICKS(200));
+                    TRACE_END(TRACE_EV_WS_SEND, TRACE_SRC_AZURE, ret);
                     if (ret < 0) {
                         ESP_LOGE(TAG, "❌ WebSocket send failed: %d", ret);
                     }
@@ -448,12 +584,14 @@ static void azure_realtime_task(void *pvParameters)
 
                 // Reset batch
                 batch_len = 0;
-                batch_frames = 0;
+            }
+
+            if (batch_len == 0) {
+                send_pending_turn(read_pos);
             }
         } else {
-            // Not connected - clear any pending batch and wait
+            // Not ready - the partial batch is still spooled and is replayed on the next session
             batch_len = 0;
-            batch_frames = 0;
             vTaskDelay(pdMS_TO_TICKS(100));
         }
     }
@@ -475,6 +613,7 @@ static void websocket_event_handler(void *handler_args, esp_event_base_t base,
     case WEBSOCKET_EVENT_CONNECTED:
         ESP_LOGI(TAG, "✅ WebSocket Connected to Azure OpenAI Realtime");
         s_state = AZURE_STATE_CONNECTED;
+        realtime_link_on_connected(s_link);
         s_send_count = 0;
         s_recv_count = 0;
         s_ws_cleanup_needed = false;
@@ -487,7 +626,8 @@ static void websocket_event_handler(void *handler_args, esp_event_base_t base,
 
     case WEBSOCKET_EVENT_DATA:
         if (data->op_code == 0x01) {  // Text frame
-            ESP_LOGI(TAG, "📥 Received WebSocket message (%d bytes)", data->data_len);
+            TRACE_EVENT(TRACE_EV_WS_RECV, TRACE_SRC_AZURE, data->data_len);
+            latency_ledger_mark(LATENCY_MARK_FIRST_SERVER_EVENT);
 
             // Null-terminate the data for cJSON parsing
             char *json_str = (char *)data->data_ptr;
@@ -499,7 +639,7 @@ static void websocket_event_handler(void *handler_args, esp_event_base_t base,
                 // Parse event type
                 char event_type[128];
                 if (azure_protocol_parse_event_type(temp_buf, event_type, sizeof(event_type))) {
-                    ESP_LOGI(TAG, "Event type: %s", event_type);
+                    ESP_LOGD(TAG, "Event type: %s", event_type);
                     handle_azure_event(temp_buf, event_type);
                 } else {
                     ESP_LOGW(TAG, "Failed to parse event type");
@@ -516,14 +656,8 @@ static void websocket_event_handler(void *handler_args, esp_event_base_t base,
         s_ws_cleanup_needed = true;
         s_session_update_pending = false;
 
-        // Clear audio queue to prevent stale data on reconnection
-        if (s_audio_queue) {
-            audio_chunk_t chunk;
-            while (xQueueReceive(s_audio_queue, &chunk, 0) == pdTRUE) {
-                // Drain queue
-            }
-            ESP_LOGI(TAG, "Audio queue drained after error");
-        }
+        // Captured audio stays in the spool: the task replays what the server
+        // has not acted on once the next session is ready
 
         // Note: Avoid destroying client in callback context; task loop will clean & reconnect
         break;
@@ -548,11 +682,13 @@ esp_err_t azure_realtime_init(void)
 {
     ESP_LOGI(TAG, "Initializing Azure Realtime client");
 
-    // Create audio queue
-    s_audio_queue = xQueueCreate(AUDIO_QUEUE_SIZE, sizeof(audio_chunk_t));
-    if (s_audio_queue == NULL) {
-        ESP_LOGE(TAG, "Failed to create audio queue");
-        return ESP_ERR_NO_MEM;
+    // Create capture spool
+    if (s_spool == NULL) {
+        s_spool = capture_spool_create("azure");
+        if (s_spool == NULL) {
+            ESP_LOGE(TAG, "Failed to create capture spool");
+            return ESP_ERR_NO_MEM;
+        }
     }
 
     s_state = AZURE_STATE_DISCONNECTED;
@@ -567,9 +703,9 @@ esp_err_t azure_realtime_deinit(void)
         s_ws_client = NULL;
     }
 
-    if (s_audio_queue) {
-        vQueueDelete(s_audio_queue);
-        s_audio_queue = NULL;
+    if (s_spool) {
+        capture_spool_destroy(s_spool);
+        s_spool = NULL;
     }
 
     return ESP_OK;
@@ -661,6 +797,11 @@ esp_err_t azure_realtime_connect(void)
         .pingpong_timeout_sec = 60,
     };
 
+    // Reuse the TLS session of the previous connection (no-op unless enabled)
+    static char key_header[160];
+    snprintf(key_header, sizeof(key_header), "api-key: %s\r\n", s_config.api_key);
+    realtime_link_attach_transport(s_link, &ws_cfg, key_header);
+
     s_ws_client = esp_websocket_client_init(&ws_cfg);
     if (s_ws_client == NULL) {
         ESP_LOGE(TAG, "Failed to init WebSocket client");
@@ -676,6 +817,7 @@ esp_err_t azure_realtime_connect(void)
                                    websocket_event_handler, NULL);
 
     // Start connection (state already set to CONNECTING at function entry)
+    realtime_link_on_connecting(s_link);
     esp_err_t ret = esp_websocket_client_start(s_ws_client);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to start WebSocket client: %s", esp_err_to_name(ret));
@@ -695,6 +837,11 @@ esp_err_t azure_realtime_disconnect(void)
     return ESP_OK;
 }
 
+void azure_realtime_prewarm(void)
+{
+    realtime_link_prewarm(s_link);
+}
+
 bool azure_realtime_is_connected(void)
 {
     return (s_state == AZURE_STATE_READY || s_state == AZURE_STATE_STREAMING);
@@ -718,39 +865,27 @@ esp_err_t azure_realtime_end_session(void)
 
 esp_err_t azure_realtime_send_audio(const uint8_t *audio_data, size_t size)
 {
-    if (audio_data == NULL || s_audio_queue == NULL) {
+    if (audio_data == NULL || s_spool == NULL) {
         return ESP_ERR_INVALID_ARG;
     }
 
-    if (!azure_realtime_is_connected()) {
-        ESP_LOGW(TAG, "Not connected, dropping audio");
+    // Audio is spooled while disconnected too and sent once the session is back
+    if (!s_task_running) {
+        ESP_LOGW(TAG, "Task not running, dropping audio");
         return ESP_ERR_INVALID_STATE;
     }
 
-    // Queue audio data in chunks
-    size_t offset = 0;
-    int chunks_queued = 0;
-    while (offset < size) {
-        audio_chunk_t chunk;
-        chunk.size = (size - offset > AZURE_AUDIO_CHUNK_SIZE) ?
-                     AZURE_AUDIO_CHUNK_SIZE : (size - offset);
-        memcpy(chunk.data, audio_data + offset, chunk.size);
-
-        if (xQueueSend(s_audio_queue, &chunk, pdMS_TO_TICKS(10)) != pdTRUE) {
-            ESP_LOGW(TAG, "Audio queue full, dropping chunk");
-        } else {
-            chunks_queued++;
-        }
-
-        offset += chunk.size;
+    if (capture_spool_write(s_spool, audio_data, size) != ESP_OK) {
+        ESP_LOGW(TAG, "Capture spool full or busy, dropping audio");
+        TRACE_EVENT(TRACE_EV_WS_QUEUE_DROP, TRACE_SRC_AZURE, size);
     }
 
     // Log periodically
-    static uint32_t total_queued = 0;
-    total_queued += chunks_queued;
-    if (total_queued % 50 == 0) {
-        ESP_LOGI(TAG, "🎙️ Audio queued: total=%lu, this call=%d chunks, %u bytes",
-                 total_queued, chunks_queued, (unsigned)size);
+    static uint32_t total_spooled = 0;
+    total_spooled++;
+    if (total_spooled % 50 == 0) {
+        ESP_LOGI(TAG, "🎙️ Audio spooled: total=%lu writes, this call=%u bytes, pending=%u bytes",
+                 total_spooled, (unsigned)size, (unsigned)capture_spool_pending(s_spool));
     }
 
     return ESP_OK;
@@ -758,36 +893,40 @@ esp_err_t azure_realtime_send_audio(const uint8_t *audio_data, size_t size)
 
 esp_err_t azure_realtime_commit_audio(void)
 {
-    if (!is_ws_client_valid()) {
-        ESP_LOGW(TAG, "Cannot commit audio: WebSocket not connected");
+    if (s_spool == NULL) {
         return ESP_ERR_INVALID_STATE;
     }
 
-    char buffer[128];
-    int len = azure_protocol_build_audio_commit(buffer, sizeof(buffer));
-    if (len > 0) {
-        ESP_LOGI(TAG, "📤 Sending input_audio_buffer.commit");
-        return esp_websocket_client_send_text(s_ws_client, buffer, len, portMAX_DELAY);
-    }
+    // The task sends the commit right after the last audio captured before it
+    uint64_t head = capture_spool_head(s_spool);
+    portENTER_CRITICAL(&s_turn_lock);
+    s_commit_pos = head;
+    s_commit_pending = true;
+    portEXIT_CRITICAL(&s_turn_lock);
+    capture_spool_notify(s_spool);
 
-    return ESP_FAIL;
+    if (!azure_realtime_is_connected()) {
+        ESP_LOGW(TAG, "⏸️ Not connected: commit deferred until the session is back");
+    }
+    return ESP_OK;
 }
 
 esp_err_t azure_realtime_create_response(void)
 {
-    if (!is_ws_client_valid()) {
-        ESP_LOGW(TAG, "Cannot create response: WebSocket not connected");
+    if (s_spool == NULL) {
         return ESP_ERR_INVALID_STATE;
     }
 
-    char buffer[512];
-    int len = azure_protocol_build_response_create(buffer, sizeof(buffer));
-    if (len > 0) {
-        ESP_LOGI(TAG, "📤 Sending response.create");
-        return esp_websocket_client_send_text(s_ws_client, buffer, len, portMAX_DELAY);
-    }
+    // Sent by the task, after a pending commit
+    portENTER_CRITICAL(&s_turn_lock);
+    s_response_pending = true;
+    portEXIT_CRITICAL(&s_turn_lock);
+    capture_spool_notify(s_spool);
 
-    return ESP_FAIL;
+    if (!azure_realtime_is_connected()) {
+        ESP_LOGW(TAG, "⏸️ Not connected: response.create deferred until the session is back");
+    }
+    return ESP_OK;
 }
 
 esp_err_t azure_realtime_cancel_response(void)
@@ -826,15 +965,20 @@ esp_err_t azure_realtime_start_task(void)
         return ESP_OK;
     }
 
-    // Create audio queue
-    if (s_audio_queue == NULL) {
-        s_audio_queue = xQueueCreate(AUDIO_QUEUE_SIZE, sizeof(audio_chunk_t));
-        if (s_audio_queue == NULL) {
-            ESP_LOGE(TAG, "Failed to create audio queue");
+    // Create capture spool
+    if (s_spool == NULL) {
+        s_spool = capture_spool_create("azure");
+        if (s_spool == NULL) {
+            ESP_LOGE(TAG, "Failed to create capture spool");
             return ESP_FAIL;
         }
     }
 
+    // Reconnect policy and connection timing
+    if (s_link == NULL) {
+        s_link = realtime_link_create("azure");
+    }
+
     // Start task
     s_task_running = true;
     BaseType_t ret = xTaskCreate(azure_realtime_task, "azure_rt_task",
@@ -856,6 +1000,7 @@ esp_err_t azure_realtime_stop_task(void)
     }
 
     s_task_running = false;
+    realtime_link_prewarm(s_link);  // Wake a pending reconnect backoff
 
     // Wait for task to finish
     if (s_task_handle) {
@@ -863,11 +1008,13 @@ esp_err_t azure_realtime_stop_task(void)
         s_task_handle = NULL;
     }
 
-    // Clean up queue
-    if (s_audio_queue) {
-        vQueueDelete(s_audio_queue);
-        s_audio_queue = NULL;
-    }
+    // Drop spooled audio and any deferred turn
+    capture_spool_reset(s_spool);
+    portENTER_CRITICAL(&s_turn_lock);
+    s_commit_pending = false;
+    s_response_pending = false;
+    s_turn_unacked = false;
+    portEXIT_CRITICAL(&s_turn_lock);
 
     // Ensure websocket client is stopped/destroyed
     azure_realtime_disconnect();
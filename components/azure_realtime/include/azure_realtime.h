@@ -146,6 +146,14 @@ esp_err_t azure_realtime_connect(void);
  */
 esp_err_t azure_realtime_disconnect(void);
 
+/**
+ * @brief Connect now if the task is waiting out a reconnect backoff
+ *
+ * Called when the user is about to talk so the session is up by the time
+ * audio arrives.
+ */
+void azure_realtime_prewarm(void);
+
 /**
  * @brief Check if connected to Azure server
  *
@@ -177,15 +185,22 @@ esp_err_t azure_realtime_end_session(void);
 /**
  * @brief Send audio data to Azure
  *
+ * Audio goes through the capture spool, so it is accepted while the
+ * connection is down and sent (again) once the next session is ready.
+ *
  * @param audio_data Audio data (PCM16 format, will be converted to G.711)
  * @param size Size in bytes
- * @return ESP_OK on success
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the task is not running
  */
 esp_err_t azure_realtime_send_audio(const uint8_t *audio_data, size_t size);
 
 /**
  * @brief Commit audio buffer (signal end of user speech)
  *
+ * Sent by the task right after the audio captured before this call, or on
+ * the next session when disconnected. A commit the server has not answered
+ * when the connection drops is sent again with its audio after reconnect.
+ *
  * @return ESP_OK on success
  */
 esp_err_t azure_realtime_commit_audio(void);
@@ -193,6 +208,8 @@ esp_err_t azure_realtime_commit_audio(void);
 /**
  * @brief Request response generation (required for manual mode)
  *
+ * Sent by the task after a pending commit.
+ *
  * @return ESP_OK on success
  */
 esp_err_t azure_realtime_create_response(void);
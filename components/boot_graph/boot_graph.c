@@ -0,0 +1,387 @@
+/**
+ * @file boot_graph.c
+ * @brief Dependency-graph boot orchestrator implementation
+ *
+ * Phases whose dependencies are done are put on a ready queue; the workers
+ * take them from it in order. The bookkeeping (phase states, done mask,
+ * what is still outstanding) sits behind one mutex that is never held
+ * while a phase runs. When the last phase finishes, or a failure has
+ * skipped everything not yet started, one stop token per worker is queued
+ * and the caller collects the workers before returning.
+ */
+
+#include "boot_graph.h"
+
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "BOOT_GRAPH";
+
+#define PHASE_STOP          0xFF    // Ready queue token: worker exits
+#define TIMELINE_COLS       40      // Width of the timeline bars
+
+typedef struct boot_run boot_run_t;
+
+typedef struct {
+    boot_run_t *run;
+    uint8_t index;
+} boot_worker_t;
+
+struct boot_run {
+    const boot_graph_config_t *config;
+    boot_graph_result_t *result;
+    SemaphoreHandle_t lock;
+    QueueHandle_t ready;
+    SemaphoreHandle_t exited;
+    uint32_t done_mask;
+    uint32_t queued_mask;
+    uint32_t outstanding;           // Phases neither finished nor skipped
+    uint8_t workers;
+    boot_worker_t worker[BOOT_GRAPH_MAX_WORKERS];
+};
+
+// ============================================
+// Private Functions
+// ============================================
+
+/**
+ * @brief Check that every dependency exists and the graph has no cycle
+ */
+static bool graph_valid(const boot_graph_config_t *config)
+{
+    uint32_t all = (config->phase_count == 32) ? 0xFFFFFFFFUL : (BOOT_DEP(config->phase_count) - 1);
+    for (size_t i = 0; i < config->phase_count; i++) {
+        const boot_phase_t *phase = &config->phases[i];
+        if (phase->fn == NULL || (phase->deps & ~all) || (phase->deps & BOOT_DEP(i))) {
+            ESP_LOGE(TAG, "Phase %u (%s): bad function or dependency", (unsigned)i,
+                     phase->name ? phase->name : "?");
+            return false;
+        }
+    }
+
+    // Resolve phases in rounds; a round that resolves nothing leaves a cycle
+    uint32_t resolved = 0;
+    while (resolved != all) {
+        uint32_t round = 0;
+        for (size_t i = 0; i < config->phase_count; i++) {
+            if (!(resolved & BOOT_DEP(i)) && (config->phases[i].deps & ~resolved) == 0) {
+                round |= BOOT_DEP(i);
+            }
+        }
+        if (round == 0) {
+            ESP_LOGE(TAG, "Dependency cycle among phases 0x%08lx", (unsigned long)(all & ~resolved));
+            return false;
+        }
+        resolved |= round;
+    }
+    return true;
+}
+
+/**
+ * @brief Queue every pending phase whose dependencies are done (lock held)
+ */
+static void queue_ready(boot_run_t *run)
+{
+    const boot_graph_config_t *config = run->config;
+    for (size_t i = 0; i < config->phase_count; i++) {
+        uint32_t bit = BOOT_DEP(i);
+        if ((run->queued_mask & bit) || (config->phases[i].deps & ~run->done_mask)) {
+            continue;
+        }
+        uint8_t index = (uint8_t)i;
+        run->queued_mask |= bit;
+        xQueueSend(run->ready, &index, 0);  // Sized for every phase plus the stop tokens
+    }
+}
+
+/**
+ * @brief Skip every phase that has not started (lock held)
+ */
+static void skip_pending(boot_run_t *run)
+{
+    for (size_t i = 0; i < run->config->phase_count; i++) {
+        boot_phase_record_t *rec = &run->result->phases[i];
+        if (rec->state == BOOT_PHASE_PENDING) {
+            rec->state = BOOT_PHASE_SKIPPED;
+            run->outstanding--;
+        }
+    }
+    // Skipped phases still in the ready queue are dropped by the workers
+    run->queued_mask = 0xFFFFFFFFUL;
+}
+
+/**
+ * @brief Stop the workers once nothing is outstanding (lock held)
+ */
+static void stop_if_finished(boot_run_t *run)
+{
+    if (run->outstanding != 0) {
+        return;
+    }
+    uint8_t stop = PHASE_STOP;
+    for (uint8_t i = 0; i < run->workers; i++) {
+        xQueueSend(run->ready, &stop, 0);
+    }
+}
+
+static void worker_task(void *arg)
+{
+    boot_worker_t *worker = (boot_worker_t *)arg;
+    boot_run_t *run = worker->run;
+    const boot_graph_config_t *config = run->config;
+    uint8_t index;
+
+    while (xQueueReceive(run->ready, &index, portMAX_DELAY) == pdTRUE && index != PHASE_STOP) {
+        const boot_phase_t *phase = &config->phases[index];
+        boot_phase_record_t *rec = &run->result->phases[index];
+
+        xSemaphoreTake(run->lock, portMAX_DELAY);
+        if (rec->state != BOOT_PHASE_PENDING) {
+            xSemaphoreGive(run->lock);
+            continue;
+        }
+        rec->state = BOOT_PHASE_RUNNING;
+        rec->worker = worker->index;
+        rec->start_us = esp_timer_get_time();
+        xSemaphoreGive(run->lock);
+
+        esp_err_t err = phase->fn(phase->arg);
+        int64_t end_us = esp_timer_get_time();
+
+        xSemaphoreTake(run->lock, portMAX_DELAY);
+        rec->end_us = end_us;
+        rec->err = err;
+        run->outstanding--;
+        if (err == ESP_OK) {
+            rec->state = BOOT_PHASE_DONE;
+            run->done_mask |= BOOT_DEP(index);
+            queue_ready(run);
+        } else {
+            rec->state = BOOT_PHASE_FAILED;
+            if (run->result->err == ESP_OK) {
+                run->result->err = err;
+                skip_pending(run);
+            }
+        }
+        stop_if_finished(run);
+        xSemaphoreGive(run->lock);
+
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Phase %s failed: %s", phase->name, esp_err_to_name(err));
+        }
+    }
+
+    xSemaphoreGive(run->exited);
+    vTaskDelete(NULL);
+}
+
+static int64_t milestone_time(const boot_graph_config_t *config, const boot_graph_result_t *result,
+                              uint32_t phases)
+{
+    int64_t at = result->start_us;
+    for (size_t i = 0; i < config->phase_count; i++) {
+        if (!(phases & BOOT_DEP(i))) {
+            continue;
+        }
+        const boot_phase_record_t *rec = &result->phases[i];
+        if (rec->state != BOOT_PHASE_DONE) {
+            return -1;
+        }
+        if (rec->end_us > at) {
+            at = rec->end_us;
+        }
+    }
+    return at;
+}
+
+static void run_cleanup(boot_run_t *run)
+{
+    if (run->ready) {
+        vQueueDelete(run->ready);
+    }
+    if (run->lock) {
+        vSemaphoreDelete(run->lock);
+    }
+    if (run->exited) {
+        vSemaphoreDelete(run->exited);
+    }
+}
+
+// ============================================
+// Public Functions
+// ============================================
+
+esp_err_t boot_graph_run(const boot_graph_config_t *config, boot_graph_result_t *result)
+{
+    if (config == NULL || result == NULL || config->phases == NULL || config->phase_count == 0 ||
+        config->phase_count > BOOT_GRAPH_MAX_PHASES ||
+        config->milestone_count > BOOT_GRAPH_MAX_MILESTONES ||
+        (config->milestone_count && config->milestones == NULL)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!graph_valid(config)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(result, 0, sizeof(*result));
+    for (size_t i = 0; i < BOOT_GRAPH_MAX_MILESTONES; i++) {
+        result->milestone_us[i] = -1;
+    }
+
+    uint8_t workers = config->workers ? config->workers : CONFIG_BOOT_GRAPH_WORKERS;
+    if (workers > BOOT_GRAPH_MAX_WORKERS) {
+        workers = BOOT_GRAPH_MAX_WORKERS;
+    }
+
+    boot_run_t run = {
+        .config = config,
+        .result = result,
+        .outstanding = (uint32_t)config->phase_count,
+    };
+    run.lock = xSemaphoreCreateMutex();
+    run.ready = xQueueCreate(config->phase_count + workers, sizeof(uint8_t));
+    run.exited = xSemaphoreCreateCounting(workers, 0);
+    if (run.lock == NULL || run.ready == NULL || run.exited == NULL) {
+        run_cleanup(&run);
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Workers first, so the stop tokens always match the workers running
+    for (uint8_t i = 0; i < workers; i++) {
+        char name[8];
+        snprintf(name, sizeof(name), "boot%u", (unsigned)i);
+        BaseType_t core = (i < portNUM_PROCESSORS) ? (BaseType_t)i : tskNO_AFFINITY;
+        run.worker[i].run = &run;
+        run.worker[i].index = i;
+        if (xTaskCreatePinnedToCore(worker_task, name, CONFIG_BOOT_GRAPH_TASK_STACK, &run.worker[i],
+                                    CONFIG_BOOT_GRAPH_TASK_PRIO, NULL, core) != pdPASS) {
+            ESP_LOGW(TAG, "Worker %u not created, continuing with %u", (unsigned)i, (unsigned)i);
+            break;
+        }
+        run.workers++;
+    }
+    if (run.workers == 0) {
+        run_cleanup(&run);
+        return ESP_ERR_NO_MEM;
+    }
+    result->workers = run.workers;
+
+    ESP_LOGI(TAG, "Booting %u phases on %u workers", (unsigned)config->phase_count,
+             (unsigned)run.workers);
+    result->start_us = esp_timer_get_time();
+    xSemaphoreTake(run.lock, portMAX_DELAY);
+    queue_ready(&run);
+    xSemaphoreGive(run.lock);
+
+    for (uint8_t i = 0; i < run.workers; i++) {
+        xSemaphoreTake(run.exited, portMAX_DELAY);
+    }
+    result->end_us = esp_timer_get_time();
+    run_cleanup(&run);
+
+    for (size_t i = 0; i < config->milestone_count; i++) {
+        result->milestone_us[i] = milestone_time(config, result, config->milestones[i].phases);
+    }
+    return result->err;
+}
+
+int32_t boot_graph_milestone_ms(const boot_graph_result_t *result, size_t index)
+{
+    if (result == NULL || index >= BOOT_GRAPH_MAX_MILESTONES || result->milestone_us[index] < 0) {
+        return -1;
+    }
+    return (int32_t)((result->milestone_us[index] - result->start_us) / 1000);
+}
+
+void boot_graph_print(const boot_graph_config_t *config, const boot_graph_result_t *result)
+{
+    if (config == NULL || result == NULL) {
+        return;
+    }
+
+    int64_t span_us = result->end_us - result->start_us;
+    if (span_us <= 0) {
+        span_us = 1;
+    }
+
+    // Start order; phases that never ran go last, in table order
+    uint8_t order[BOOT_GRAPH_MAX_PHASES];
+    size_t count = config->phase_count;
+    for (size_t i = 0; i < count; i++) {
+        order[i] = (uint8_t)i;
+    }
+    for (size_t i = 1; i < count; i++) {
+        uint8_t index = order[i];
+        const boot_phase_record_t *rec = &result->phases[index];
+        bool ran = rec->state == BOOT_PHASE_DONE || rec->state == BOOT_PHASE_FAILED;
+        size_t j = i;
+        while (j > 0) {
+            const boot_phase_record_t *prev = &result->phases[order[j - 1]];
+            bool prev_ran = prev->state == BOOT_PHASE_DONE || prev->state == BOOT_PHASE_FAILED;
+            if (!ran || (prev_ran && prev->start_us <= rec->start_us)) {
+                break;
+            }
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = index;
+    }
+
+    ESP_LOGI(TAG, "Boot timeline: %lu ms on %u workers, from %lu ms after reset",
+             (unsigned long)(span_us / 1000), (unsigned)result->workers,
+             (unsigned long)(result->start_us / 1000));
+    ESP_LOGI(TAG, "  %-12s %2s %6s %6s %6s", "phase", "w", "start", "end", "ms");
+    for (size_t n = 0; n < count; n++) {
+        uint8_t i = order[n];
+        const boot_phase_record_t *rec = &result->phases[i];
+        const char *name = config->phases[i].name;
+        if (rec->state != BOOT_PHASE_DONE && rec->state != BOOT_PHASE_FAILED) {
+            ESP_LOGI(TAG, "  %-12s %s", name, boot_graph_state_to_string(rec->state));
+            continue;
+        }
+
+        int64_t start = rec->start_us - result->start_us;
+        int64_t end = rec->end_us - result->start_us;
+        char bar[TIMELINE_COLS + 1];
+        int from = (int)(start * TIMELINE_COLS / span_us);
+        int to = (int)((end * TIMELINE_COLS + span_us - 1) / span_us);
+        if (to <= from) {
+            to = from + 1;
+        }
+        for (int c = 0; c < TIMELINE_COLS; c++) {
+            bar[c] = (c >= from && c < to) ? '#' : '.';
+        }
+        bar[TIMELINE_COLS] = '\0';
+        ESP_LOGI(TAG, "  %-12s %2u %6lu %6lu %6lu |%s|%s", name, (unsigned)rec->worker,
+                 (unsigned long)(start / 1000), (unsigned long)(end / 1000),
+                 (unsigned long)((end - start) / 1000), bar,
+                 rec->state == BOOT_PHASE_FAILED ? " failed" : "");
+    }
+
+    for (size_t i = 0; i < config->milestone_count; i++) {
+        int32_t ms = boot_graph_milestone_ms(result, i);
+        if (ms < 0) {
+            ESP_LOGW(TAG, "  %-24s not reached", config->milestones[i].name);
+        } else {
+            ESP_LOGI(TAG, "  %-24s %6ld ms", config->milestones[i].name, (long)ms);
+        }
+    }
+}
+
+const char *boot_graph_state_to_string(boot_phase_state_t state)
+{
+    switch (state) {
+        case BOOT_PHASE_PENDING:    return "pending";
+        case BOOT_PHASE_RUNNING:    return "running";
+        case BOOT_PHASE_DONE:       return "done";
+        case BOOT_PHASE_FAILED:     return "failed";
+        case BOOT_PHASE_SKIPPED:    return "skipped";
+        default:                    return "unknown";
+    }
+}
@@ -0,0 +1,166 @@
+/**
+ * @file boot_graph.h
+ * @brief Dependency-graph boot orchestrator
+ *
+ * Boot is a table of phases, each naming the phases it depends on. A small
+ * pool of worker tasks, one pinned to each core plus spares for phases that
+ * mostly wait, runs every phase as soon as its dependencies are done, so
+ * independent hardware and network bring-up overlap. Start and end of each
+ * phase are recorded and printed as a timeline, together with milestones:
+ * the time at which a chosen set of phases had all completed.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================
+// Boot Graph Configuration
+// ============================================
+
+#ifndef CONFIG_BOOT_GRAPH_WORKERS
+#define CONFIG_BOOT_GRAPH_WORKERS       3
+#endif
+#ifndef CONFIG_BOOT_GRAPH_TASK_STACK
+#define CONFIG_BOOT_GRAPH_TASK_STACK    8192
+#endif
+#ifndef CONFIG_BOOT_GRAPH_TASK_PRIO
+#define CONFIG_BOOT_GRAPH_TASK_PRIO     1
+#endif
+
+#define BOOT_GRAPH_MAX_PHASES       32      // Dependencies are a 32-bit mask
+#define BOOT_GRAPH_MAX_MILESTONES   4
+#define BOOT_GRAPH_MAX_WORKERS      8
+
+/**
+ * @brief Dependency mask bit for a phase index
+ */
+#define BOOT_DEP(index)             (1UL << (index))
+
+/**
+ * @brief Phase function
+ *
+ * Runs on a boot worker task. Anything other than ESP_OK aborts the boot:
+ * phases not started yet are skipped. Phases that can fail without
+ * consequence log a warning and return ESP_OK.
+ */
+typedef esp_err_t (*boot_phase_fn_t)(void *arg);
+
+/**
+ * @brief One boot phase
+ */
+typedef struct {
+    const char *name;
+    boot_phase_fn_t fn;
+    void *arg;
+    uint32_t deps;                      // BOOT_DEP() of every phase that must finish first
+} boot_phase_t;
+
+/**
+ * @brief A point of interest in the boot, reached when all its phases are done
+ */
+typedef struct {
+    const char *name;
+    uint32_t phases;                    // BOOT_DEP() of the phases it waits for
+} boot_milestone_t;
+
+/**
+ * @brief Boot graph description
+ */
+typedef struct {
+    const boot_phase_t *phases;
+    size_t phase_count;                 // At most BOOT_GRAPH_MAX_PHASES
+    const boot_milestone_t *milestones;
+    size_t milestone_count;             // At most BOOT_GRAPH_MAX_MILESTONES
+    uint8_t workers;                    // 0 for CONFIG_BOOT_GRAPH_WORKERS; 1 boots sequentially
+} boot_graph_config_t;
+
+/**
+ * @brief Phase outcome
+ */
+typedef enum {
+    BOOT_PHASE_PENDING = 0,
+    BOOT_PHASE_RUNNING,
+    BOOT_PHASE_DONE,
+    BOOT_PHASE_FAILED,
+    BOOT_PHASE_SKIPPED,                 // Not started because another phase failed
+} boot_phase_state_t;
+
+/**
+ * @brief Timing of one phase, in esp_timer microseconds
+ */
+typedef struct {
+    boot_phase_state_t state;
+    esp_err_t err;
+    int64_t start_us;
+    int64_t end_us;
+    uint8_t worker;                     // Worker task that ran it
+} boot_phase_record_t;
+
+/**
+ * @brief Boot timeline
+ */
+typedef struct {
+    esp_err_t err;                      // First phase failure, ESP_OK if none
+    int64_t start_us;
+    int64_t end_us;
+    uint8_t workers;
+    boot_phase_record_t phases[BOOT_GRAPH_MAX_PHASES];
+    int64_t milestone_us[BOOT_GRAPH_MAX_MILESTONES];  // -1 if not reached
+} boot_graph_result_t;
+
+// ============================================
+// Boot Graph Function Declarations
+// ============================================
+
+/**
+ * @brief Run a boot graph to completion
+ *
+ * Blocks the caller until every phase has finished or been skipped. The
+ * graph is checked first: a dependency on a phase outside the table or a
+ * cycle is rejected before anything runs.
+ *
+ * @param config Graph to run
+ * @param result Output timeline
+ * @return ESP_OK if every phase succeeded, the first phase error otherwise,
+ *         ESP_ERR_INVALID_ARG for a malformed graph, ESP_ERR_NO_MEM if the
+ *         workers could not be created
+ */
+esp_err_t boot_graph_run(const boot_graph_config_t *config, boot_graph_result_t *result);
+
+/**
+ * @brief Milestone time relative to the start of the run
+ *
+ * @param result Timeline from boot_graph_run()
+ * @param index Milestone index
+ * @return Milliseconds, -1 if the milestone was not reached
+ */
+int32_t boot_graph_milestone_ms(const boot_graph_result_t *result, size_t index);
+
+/**
+ * @brief Log the timeline: one bar per phase in start order, then milestones
+ *
+ * @param config Graph that was run
+ * @param result Timeline from boot_graph_run()
+ */
+void boot_graph_print(const boot_graph_config_t *config, const boot_graph_result_t *result);
+
+/**
+ * @brief Get phase state name string
+ *
+ * @param state Phase state
+ * @return State name string
+ */
+const char *boot_graph_state_to_string(boot_phase_state_t state);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,470 @@
+/**
+ * @file capture_spool.c
+ * @brief Bounded capture spool for realtime provider uplink audio
+ *
+ * The RAM ring holds [tail, spill) of the stream; once it is full the
+ * overflow file holds [spill, head). Whenever ring space frees up the oldest
+ * file data moves back into the ring, and the file is truncated when it has
+ * been drained, so the ring always holds the oldest audio and reads never
+ * touch flash. A mutex rather than a spinlock guards the spool because the
+ * overflow path does file I/O with it held. The writer only appends to the
+ * file; moving data back (refill) is left to the reader and release paths,
+ * and the writer waits at most SPOOL_WRITE_WAIT_MS for the lock so
+ * that I/O never stalls the recorder.
+ */
+
+#include "capture_spool.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+
+static const char *TAG = "SPOOL";
+
+#define SPOOL_PATH_MAX      64
+#define SPOOL_WRITE_WAIT_MS 5   // Well under one recorder frame
+
+// ============================================
+// Private Types and Variables
+// ============================================
+
+struct capture_spool {
+    const char *name;
+    SemaphoreHandle_t lock;
+    SemaphoreHandle_t data;             // Given on write and notify
+
+    uint8_t *ram;
+    size_t cap;
+
+    uint64_t tail;                      // Released
+    uint64_t read;                      // Sent on the current connection
+    uint64_t spill;                     // End of the RAM-resident part
+    uint64_t head;                      // Written
+    uint64_t replay_end;                // read before the last rewind
+
+    FILE *file;
+    char path[SPOOL_PATH_MAX];
+    size_t file_rd;                     // File offset of spill
+    size_t file_wr;                     // File offset of head
+
+    capture_spool_stats_t stats;
+};
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static struct capture_spool *s_spools[CAPTURE_SPOOL_MAX_SPOOLS];
+
+// ============================================
+// Ring and File Helpers (spool lock held)
+// ============================================
+
+static void ring_put(struct capture_spool *sp, uint64_t pos, const uint8_t *src, size_t n)
+{
+    size_t off = (size_t)(pos % sp->cap);
+    size_t first = n < sp->cap - off ? n : sp->cap - off;
+    memcpy(sp->ram + off, src, first);
+    memcpy(sp->ram, src + first, n - first);
+}
+
+static void ring_get(struct capture_spool *sp, uint64_t pos, uint8_t *dst, size_t n)
+{
+    size_t off = (size_t)(pos % sp->cap);
+    size_t first = n < sp->cap - off ? n : sp->cap - off;
+    memcpy(dst, sp->ram + off, first);
+    memcpy(dst + first, sp->ram, n - first);
+}
+
+static void update_depth(struct capture_spool *sp)
+{
+    uint32_t depth = (uint32_t)(sp->head - sp->tail);
+    sp->stats.depth_bytes = depth;
+    if (depth > sp->stats.max_depth_bytes) {
+        sp->stats.max_depth_bytes = depth;
+    }
+}
+
+/**
+ * @brief Append to the overflow file, bounded by CONFIG_CAPTURE_SPOOL_OVERFLOW_KB
+ *
+ * @return Bytes stored
+ */
+static size_t file_append(struct capture_spool *sp, const uint8_t *src, size_t n)
+{
+    if (sp->path[0] == '\0') {
+        return 0;
+    }
+    if (sp->file == NULL) {
+        sp->file = fopen(sp->path, "w+b");
+        if (sp->file == NULL) {
+            ESP_LOGW(TAG, "⚠️ %s: cannot open overflow file %s", sp->name, sp->path);
+            sp->path[0] = '\0';
+            return 0;
+        }
+        sp->file_rd = 0;
+        sp->file_wr = 0;
+    }
+
+    size_t limit = (size_t)CONFIG_CAPTURE_SPOOL_OVERFLOW_KB * 1024;
+    size_t room = sp->file_wr < limit ? limit - sp->file_wr : 0;
+    if (n > room) {
+        n = room;
+    }
+    if (n == 0 || fseek(sp->file, (long)sp->file_wr, SEEK_SET) != 0) {
+        return 0;
+    }
+    size_t written = fwrite(src, 1, n, sp->file);
+    sp->file_wr += written;
+    sp->stats.overflow_bytes += written;
+    return written;
+}
+
+/**
+ * @brief Move the oldest file data into free ring space
+ */
+static void refill(struct capture_spool *sp)
+{
+    if (sp->file == NULL) {
+        return;
+    }
+
+    while (sp->file_rd < sp->file_wr) {
+        size_t space = sp->cap - (size_t)(sp->spill - sp->tail);
+        size_t off = (size_t)(sp->spill % sp->cap);
+        size_t n = sp->file_wr - sp->file_rd;
+        if (n > space) {
+            n = space;
+        }
+        if (n > sp->cap - off) {
+            n = sp->cap - off;
+        }
+        if (n == 0 || fseek(sp->file, (long)sp->file_rd, SEEK_SET) != 0) {
+            break;
+        }
+        size_t got = fread(sp->ram + off, 1, n, sp->file);
+        if (got == 0) {
+            break;
+        }
+        sp->spill += got;
+        sp->file_rd += got;
+    }
+
+    // Drained: start the file over so it never grows past what is pending
+    if (sp->file_rd == sp->file_wr && sp->file_wr > 0) {
+        fclose(sp->file);
+        sp->file = fopen(sp->path, "w+b");
+        sp->file_rd = 0;
+        sp->file_wr = 0;
+    }
+}
+
+// ============================================
+// Lifecycle
+// ============================================
+
+capture_spool_handle_t capture_spool_create(const char *name)
+{
+    struct capture_spool *sp = calloc(1, sizeof(*sp));
+    if (sp == NULL) {
+        return NULL;
+    }
+    sp->name = name;
+    sp->stats.name = name;
+    sp->cap = (size_t)CONFIG_CAPTURE_SPOOL_RAM_KB * 1024;
+
+    bool psram = true;
+    sp->ram = heap_caps_malloc(sp->cap, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (sp->ram == NULL) {
+        psram = false;
+        sp->ram = heap_caps_malloc(sp->cap, MALLOC_CAP_8BIT);
+    }
+    sp->lock = xSemaphoreCreateMutex();
+    sp->data = xSemaphoreCreateBinary();
+    if (sp->ram == NULL || sp->lock == NULL || sp->data == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate %u byte spool for %s", (unsigned)sp->cap, name);
+        goto fail;
+    }
+    sp->stats.ram_bytes = (uint32_t)sp->cap;
+
+    if (CONFIG_CAPTURE_SPOOL_OVERFLOW_PATH[0] != '\0') {
+        snprintf(sp->path, sizeof(sp->path), "%s.%s", CONFIG_CAPTURE_SPOOL_OVERFLOW_PATH, name);
+    }
+
+    portENTER_CRITICAL(&s_lock);
+    int slot = -1;
+    for (int i = 0; i < CAPTURE_SPOOL_MAX_SPOOLS; i++) {
+        if (s_spools[i] == NULL) {
+            s_spools[i] = sp;
+            slot = i;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    if (slot < 0) {
+        ESP_LOGE(TAG, "No free spool slot for %s", name);
+        goto fail;
+    }
+
+    ESP_LOGI(TAG, "🎙️ %s: %u KB capture spool in %s%s%s", name, (unsigned)(sp->cap / 1024),
+             psram ? "PSRAM" : "internal RAM", sp->path[0] ? ", overflow to " : "", sp->path);
+    return sp;
+
+fail:
+    if (sp->lock) {
+        vSemaphoreDelete(sp->lock);
+    }
+    if (sp->data) {
+        vSemaphoreDelete(sp->data);
+    }
+    heap_caps_free(sp->ram);
+    free(sp);
+    return NULL;
+}
+
+void capture_spool_destroy(capture_spool_handle_t spool)
+{
+    if (spool == NULL) {
+        return;
+    }
+
+    portENTER_CRITICAL(&s_lock);
+    for (int i = 0; i < CAPTURE_SPOOL_MAX_SPOOLS; i++) {
+        if (s_spools[i] == spool) {
+            s_spools[i] = NULL;
+        }
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    if (spool->file) {
+        fclose(spool->file);
+        remove(spool->path);
+    }
+    vSemaphoreDelete(spool->lock);
+    vSemaphoreDelete(spool->data);
+    heap_caps_free(spool->ram);
+    free(spool);
+}
+
+// ============================================
+// Writer
+// ============================================
+
+esp_err_t capture_spool_write(capture_spool_handle_t spool, const uint8_t *data, size_t size)
+{
+    if (spool == NULL || data == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // The lock is only held this long for file I/O: drop the frame rather than wait it out
+    if (xSemaphoreTake(spool->lock, pdMS_TO_TICKS(SPOOL_WRITE_WAIT_MS)) != pdTRUE) {
+        portENTER_CRITICAL(&s_lock);
+        spool->stats.busy_bytes += size;
+        portEXIT_CRITICAL(&s_lock);
+        return ESP_ERR_TIMEOUT;
+    }
+    size_t stored = 0;
+
+    // Audio goes to the ring only while nothing is waiting in the file
+    if (spool->head == spool->spill) {
+        size_t space = spool->cap - (size_t)(spool->spill - spool->tail);
+        if (space < size && spool->read > spool->tail) {
+            size_t need = size - space;
+            size_t sent = (size_t)(spool->read - spool->tail);
+            size_t evict = need < sent ? need : sent;
+            spool->tail += evict;
+            spool->stats.evicted_bytes += evict;
+            space += evict;
+        }
+        stored = size < space ? size : space;
+        ring_put(spool, spool->spill, data, stored);
+        spool->spill += stored;
+    }
+    if (stored < size) {
+        stored += file_append(spool, data + stored, size - stored);
+    }
+
+    spool->head += stored;
+    spool->stats.spooled_bytes += stored;
+    spool->stats.dropped_bytes += size - stored;
+    update_depth(spool);
+    xSemaphoreGive(spool->lock);
+
+    if (stored > 0) {
+        xSemaphoreGive(spool->data);
+    }
+    return stored == size ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+// ============================================
+// Reader
+// ============================================
+
+size_t capture_spool_read(capture_spool_handle_t spool, uint8_t *buf, size_t max, TickType_t wait)
+{
+    if (spool == NULL || buf == NULL) {
+        return 0;
+    }
+
+    for (int attempt = 0; attempt < 2; attempt++) {
+        xSemaphoreTake(spool->lock, portMAX_DELAY);
+        // Everything unread is in the file: give up unacknowledged audio to bring it in
+        if (spool->read == spool->spill && spool->head > spool->spill) {
+            spool->stats.evicted_bytes += spool->read - spool->tail;
+            spool->tail = spool->read;
+            refill(spool);
+        }
+
+        size_t n = (size_t)(spool->spill - spool->read);
+        if (n > max) {
+            n = max;
+        }
+        ring_get(spool, spool->read, buf, n);
+        if (spool->read < spool->replay_end) {
+            uint64_t replay = spool->replay_end - spool->read;
+            spool->stats.replayed_bytes += replay < n ? replay : n;
+        }
+        spool->read += n;
+        xSemaphoreGive(spool->lock);
+
+        if (n > 0 || wait == 0 || attempt > 0) {
+            return n;
+        }
+        xSemaphoreTake(spool->data, wait);
+    }
+    return 0;
+}
+
+void capture_spool_notify(capture_spool_handle_t spool)
+{
+    if (spool != NULL) {
+        xSemaphoreGive(spool->data);
+    }
+}
+
+size_t capture_spool_pending(capture_spool_handle_t spool)
+{
+    if (spool == NULL) {
+        return 0;
+    }
+    xSemaphoreTake(spool->lock, portMAX_DELAY);
+    size_t pending = (size_t)(spool->head - spool->read);
+    xSemaphoreGive(spool->lock);
+    return pending;
+}
+
+uint64_t capture_spool_head(capture_spool_handle_t spool)
+{
+    if (spool == NULL) {
+        return 0;
+    }
+    xSemaphoreTake(spool->lock, portMAX_DELAY);
+    uint64_t head = spool->head;
+    xSemaphoreGive(spool->lock);
+    return head;
+}
+
+uint64_t capture_spool_read_pos(capture_spool_handle_t spool)
+{
+    if (spool == NULL) {
+        return 0;
+    }
+    xSemaphoreTake(spool->lock, portMAX_DELAY);
+    uint64_t read = spool->read;
+    xSemaphoreGive(spool->lock);
+    return read;
+}
+
+// ============================================
+// Acknowledgement and Replay
+// ============================================
+
+void capture_spool_release(capture_spool_handle_t spool, uint64_t pos)
+{
+    if (spool == NULL) {
+        return;
+    }
+    xSemaphoreTake(spool->lock, portMAX_DELAY);
+    if (pos > spool->read) {
+        pos = spool->read;
+    }
+    if (pos > spool->tail) {
+        spool->tail = pos;
+        refill(spool);
+        update_depth(spool);
+    }
+    xSemaphoreGive(spool->lock);
+}
+
+size_t capture_spool_rewind(capture_spool_handle_t spool)
+{
+    if (spool == NULL) {
+        return 0;
+    }
+    xSemaphoreTake(spool->lock, portMAX_DELAY);
+    size_t replay = (size_t)(spool->read - spool->tail);
+    if (replay > 0) {
+        if (spool->read > spool->replay_end) {
+            spool->replay_end = spool->read;
+        }
+        spool->read = spool->tail;
+        spool->stats.rewinds++;
+    }
+    xSemaphoreGive(spool->lock);
+    return replay;
+}
+
+void capture_spool_reset(capture_spool_handle_t spool)
+{
+    if (spool == NULL) {
+        return;
+    }
+    xSemaphoreTake(spool->lock, portMAX_DELAY);
+    if (spool->file) {
+        fclose(spool->file);
+        spool->file = fopen(spool->path, "w+b");
+        spool->file_rd = 0;
+        spool->file_wr = 0;
+    }
+    spool->tail = spool->head;
+    spool->read = spool->head;
+    spool->spill = spool->head;
+    spool->replay_end = spool->head;
+    update_depth(spool);
+    xSemaphoreGive(spool->lock);
+}
+
+// ============================================
+// Statistics
+// ============================================
+
+esp_err_t capture_spool_get_stats(capture_spool_handle_t spool, capture_spool_stats_t *stats)
+{
+    if (spool == NULL || stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    xSemaphoreTake(spool->lock, portMAX_DELAY);
+    portENTER_CRITICAL(&s_lock);
+    *stats = spool->stats;
+    portEXIT_CRITICAL(&s_lock);
+    xSemaphoreGive(spool->lock);
+    return ESP_OK;
+}
+
+void capture_spool_foreach(capture_spool_stats_cb_t cb, void *ctx)
+{
+    if (cb == NULL) {
+        return;
+    }
+    for (int i = 0; i < CAPTURE_SPOOL_MAX_SPOOLS; i++) {
+        portENTER_CRITICAL(&s_lock);
+        capture_spool_handle_t spool = s_spools[i];
+        portEXIT_CRITICAL(&s_lock);
+        capture_spool_stats_t stats;
+        if (spool != NULL && capture_spool_get_stats(spool, &stats) == ESP_OK) {
+            cb(&stats, ctx);
+        }
+    }
+}
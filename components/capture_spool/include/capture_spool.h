@@ -0,0 +1,165 @@
+/**
+ * @file capture_spool.h
+ * @brief Bounded capture spool for realtime provider uplink audio
+ *
+ * A byte FIFO between the recorder callback and a provider's send task that
+ * keeps microphone audio through a disconnect. Three positions move forward
+ * through the stream:
+ *
+ *   tail  - released: the server has acted on everything before it
+ *   read  - sent on the current connection
+ *   head  - written by the recorder
+ *
+ * Audio in [tail, read) has been sent but not acknowledged; a reconnect
+ * rewinds read to tail so it is sent again on the new session. The spool
+ * lives in PSRAM and can spill to a file on flash once full.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================
+// Spool Configuration
+// ============================================
+
+#ifndef CONFIG_CAPTURE_SPOOL_RAM_KB
+#define CONFIG_CAPTURE_SPOOL_RAM_KB         256
+#endif
+#ifndef CONFIG_CAPTURE_SPOOL_OVERFLOW_PATH
+#define CONFIG_CAPTURE_SPOOL_OVERFLOW_PATH  ""
+#endif
+#ifndef CONFIG_CAPTURE_SPOOL_OVERFLOW_KB
+#define CONFIG_CAPTURE_SPOOL_OVERFLOW_KB    512
+#endif
+
+#define CAPTURE_SPOOL_MAX_SPOOLS    2
+
+/**
+ * @brief Opaque spool handle (one per provider)
+ */
+typedef struct capture_spool *capture_spool_handle_t;
+
+/**
+ * @brief Spool statistics since creation
+ */
+typedef struct {
+    const char *name;
+    uint64_t spooled_bytes;             // Written by the recorder
+    uint64_t replayed_bytes;            // Sent again after a rewind
+    uint64_t evicted_bytes;             // Sent but unacknowledged audio given up for room
+    uint64_t dropped_bytes;             // Newest audio discarded with RAM and file full
+    uint64_t busy_bytes;                // Audio discarded while the spool was locked for file I/O
+    uint64_t overflow_bytes;            // Written to the overflow file
+    uint32_t rewinds;                   // Reconnects that had audio to send again
+    uint32_t depth_bytes;               // head - tail now
+    uint32_t max_depth_bytes;           // High-water mark of head - tail
+    uint32_t ram_bytes;                 // RAM ring capacity
+} capture_spool_stats_t;
+
+typedef void (*capture_spool_stats_cb_t)(const capture_spool_stats_t *stats, void *ctx);
+
+// ============================================
+// Capture Spool Function Declarations
+// ============================================
+
+/**
+ * @brief Create a spool
+ *
+ * The ring (CONFIG_CAPTURE_SPOOL_RAM_KB) is taken from PSRAM, falling back
+ * to internal RAM. With CONFIG_CAPTURE_SPOOL_OVERFLOW_PATH set, audio that
+ * does not fit spills to "<path>.<name>" (up to CONFIG_CAPTURE_SPOOL_OVERFLOW_KB);
+ * the file system must already be mounted.
+ *
+ * @param name Short provider name used in logs, stats and the file name (static string)
+ * @return Spool handle, NULL on allocation failure or when all slots are used
+ */
+capture_spool_handle_t capture_spool_create(const char *name);
+
+/**
+ * @brief Destroy a spool and remove its overflow file
+ */
+void capture_spool_destroy(capture_spool_handle_t spool);
+
+/**
+ * @brief Append recorded audio at head
+ *
+ * When the RAM ring is full, sent-but-unacknowledged audio is given up
+ * first, then new audio spills to the overflow file, and only then is the
+ * newest audio dropped. Never waits out the reader's file I/O: if the
+ * spool stays locked for a few milliseconds the data is dropped and counted
+ * in busy_bytes.
+ *
+ * @return ESP_OK, ESP_ERR_NO_MEM if part of the data was dropped,
+ *         ESP_ERR_TIMEOUT if all of it was dropped because the spool was busy
+ */
+esp_err_t capture_spool_write(capture_spool_handle_t spool, const uint8_t *data, size_t size);
+
+/**
+ * @brief Take up to max bytes from read onwards
+ *
+ * @param wait Ticks to wait for data when none is pending
+ * @return Bytes copied (0 on timeout)
+ */
+size_t capture_spool_read(capture_spool_handle_t spool, uint8_t *buf, size_t max, TickType_t wait);
+
+/**
+ * @brief Wake a reader blocked in capture_spool_read() without writing
+ */
+void capture_spool_notify(capture_spool_handle_t spool);
+
+/**
+ * @brief Bytes written but not yet read (head - read)
+ */
+size_t capture_spool_pending(capture_spool_handle_t spool);
+
+/**
+ * @brief Stream position of head (bytes written since creation)
+ */
+uint64_t capture_spool_head(capture_spool_handle_t spool);
+
+/**
+ * @brief Stream position of read (bytes sent on the current connection)
+ */
+uint64_t capture_spool_read_pos(capture_spool_handle_t spool);
+
+/**
+ * @brief Release audio up to pos (clamped to read): the server has acted on it
+ */
+void capture_spool_release(capture_spool_handle_t spool, uint64_t pos);
+
+/**
+ * @brief Move read back to tail so unacknowledged audio is sent again
+ *
+ * @return Bytes that will be replayed
+ */
+size_t capture_spool_rewind(capture_spool_handle_t spool);
+
+/**
+ * @brief Discard everything (tail = read = head)
+ */
+void capture_spool_reset(capture_spool_handle_t spool);
+
+/**
+ * @brief Get spool statistics
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_ARG for a NULL handle or stats
+ */
+esp_err_t capture_spool_get_stats(capture_spool_handle_t spool, capture_spool_stats_t *stats);
+
+/**
+ * @brief Call cb with the statistics of every spool
+ */
+void capture_spool_foreach(capture_spool_stats_cb_t cb, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
@@ -5,12 +5,14 @@
 
 #include "coze_ws.h"
 #include "coze_protocol.h"
-#include "app_core.h"
+#include "capture_spool.h"
+#include "latency_ledger.h"
+#include "realtime_link.h"
+#include "trace_ring.h"
 
 #include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "freertos/queue.h"
 #include "freertos/semphr.h"
 #include "esp_log.h"
 #include "esp_heap_caps.h"
@@ -105,10 +107,9 @@ static inline int16_t ulaw_to_linear(uint8_t ulaw)
 
 #define WS_BUFFER_SIZE          8192    // Increased from 4096 for Base64-encoded 60ms audio frames (~5200 bytes needed)
 #define WS_TASK_STACK_SIZE      12288  // TLS + JSON + WebSocket needs ~12KB (internal RAM only!)
-#define AUDIO_QUEUE_SIZE        20     // 20 items * 60ms = 1.2s buffer (reduced from 50 due to larger 1920-byte frames)
 #define AUDIO_BATCH_FRAMES      2      // Send 2 frames (~120ms) at a time (reduced from 4 since frames are now 60ms)
+#define REPLAY_BATCH_FRAMES     8      // 480ms per message while catching up (~5.2KB base64)
 #define AUDIO_BATCH_TIMEOUT_MS  100    // Or timeout after 100ms
-#define RECONNECT_DELAY_MS      5000
 
 // ============================================
 // Private Variables
@@ -123,6 +124,8 @@ static char s_error_msg_buffer[COZE_MAX_ERROR_MSG_LEN] = {0};
 
 // WebSocket client
 static esp_websocket_client_handle_t s_ws_client = NULL;
+static bool s_ws_started = false;
+static realtime_link_handle_t s_link = NULL;
 
 // Session info
 static char s_session_id[COZE_MAX_SESSION_ID_LEN] = {0};
@@ -136,8 +139,17 @@ static void *s_callback_user_data = NULL;
 static TaskHandle_t s_ws_task = NULL;
 static volatile bool s_task_running = false;
 
-// Audio send queue
-static QueueHandle_t s_audio_queue = NULL;
+// Audio send spool (keeps capturing while disconnected)
+static capture_spool_handle_t s_spool = NULL;
+
+// Turn bookkeeping against spool positions: the commit is sent by the task
+// once the audio it closes has gone out, and the turn's audio is released
+// when the answer starts
+static portMUX_TYPE s_turn_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint64_t s_commit_pos = 0;           // Spool position the commit closes
+static bool s_commit_pending = false;       // Commit waits for its audio
+static bool s_turn_unacked = false;         // Commit sent, no answer yet
+static volatile uint32_t s_ready_gen = 0;   // Sessions that reached READY
 
 // Mutex
 static SemaphoreHandle_t s_mutex = NULL;
@@ -146,11 +158,36 @@ static SemaphoreHandle_t s_mutex = NULL;
 static int s_send_count = 0;
 static int s_recv_count = 0;
 
-// Audio chunk structure
-typedef struct {
-    uint8_t data[COZE_AUDIO_CHUNK_SIZE];
-    size_t size;
-} audio_chunk_t;
+// ============================================
+// Private Functions - Capture Spool Turn Tracking
+// ============================================
+
+/**
+ * @brief The server has acted on the committed turn: stop holding its audio
+ */
+static void release_turn(void)
+{
+    portENTER_CRITICAL(&s_turn_lock);
+    bool unacked = s_turn_unacked;
+    uint64_t pos = s_commit_pos;
+    s_turn_unacked = false;
+    portEXIT_CRITICAL(&s_turn_lock);
+
+    if (unacked) {
+        capture_spool_release(s_spool, pos);
+    }
+}
+
+/**
+ * @brief Enter READY; a transition starts a new session for the replay
+ */
+static void set_ready(void)
+{
+    if (s_state != COZE_STATE_READY && s_state != COZE_STATE_STREAMING) {
+        s_ready_gen++;
+    }
+    s_state = COZE_STATE_READY;
+}
 
 // ============================================
 // Private Functions - Event Handling
@@ -163,8 +200,10 @@ static void handle_received_message(const char *data, int len)
 {
     if (data == NULL || len <= 0) return;
 
-    // DEBUG: Log raw JSON for debugging (use ESP_LOGE to ensure visibility)
-    ESP_LOGE(TAG, "📥 RECV RAW (%d bytes): %.*s", len, len > 500 ? 500 : len, data);
+    latency_ledger_mark(LATENCY_MARK_FIRST_SERVER_EVENT);
+
+    // Raw JSON dump is debug-level only; per-message activity goes to the trace ring
+    ESP_LOGD(TAG, "📥 RECV RAW (%d bytes): %.*s", len, len > 500 ? 500 : len, data);
 
     // Parse event type
     char event_type[64] = {0};
@@ -173,7 +212,7 @@ static void handle_received_message(const char *data, int len)
         return;
     }
 
-    ESP_LOGE(TAG, "📥 RECV EVENT: %s", event_type);
+    ESP_LOGD(TAG, "📥 RECV EVENT: %s", event_type);
 
     coze_event_t event = {0};
 
@@ -182,13 +221,15 @@ static void handle_received_message(const char *data, int len)
         event.type = COZE_MSG_TYPE_SPEECH_CREATED;
         coze_protocol_parse_chat_id(data, s_session_id, sizeof(s_session_id));
         event.session_id = s_session_id;
-        s_state = COZE_STATE_READY;
+        set_ready();
+        realtime_link_on_ready(s_link);
         ESP_LOGI(TAG, "✅ Speech session created: id=%s", s_session_id);
         // Pure audio mode: Wait for user to trigger voice input via button
 
     } else if (strcmp(event_type, COZE_EVENT_SESSION_UPDATED) == 0) {
         event.type = COZE_MSG_TYPE_SESSION_UPDATED;
-        s_state = COZE_STATE_READY;
+        set_ready();
+        realtime_link_on_ready(s_link);
         ESP_LOGI(TAG, "✅ Session updated");
 
     } else if (strcmp(event_type, COZE_EVENT_INPUT_AUDIO_BUFFER_SPEECH_STARTED) == 0) {
@@ -206,12 +247,15 @@ static void handle_received_message(const char *data, int len)
 
     } else if (strcmp(event_type, COZE_EVENT_CONVERSATION_AUDIO_DELTA) == 0) {
         event.type = COZE_MSG_TYPE_RESPONSE_AUDIO_DELTA;
+        release_turn();
         static uint8_t ulaw_buffer[2048];  // G.711 μ-law data from server
         static uint8_t pcm_buffer[4096];   // PCM16 data for playback (2x size)
         size_t ulaw_size = 0;
 
         // Parse base64-encoded G.711 μ-law audio from server (Coze protocol)
         if (coze_protocol_parse_audio_delta(data, ulaw_buffer, &ulaw_size, sizeof(ulaw_buffer))) {
+            latency_ledger_mark(LATENCY_MARK_FIRST_AUDIO_DELTA);
+
             // Convert G.711 μ-law to PCM16 for playback
             int16_t *pcm_samples = (int16_t *)pcm_buffer;
             for (size_t i = 0; i < ulaw_size; i++) {
@@ -220,21 +264,25 @@ static void handle_received_message(const char *data, int len)
 
             event.audio_data = pcm_buffer;
             event.audio_size = ulaw_size * 2;  // PCM16 is 2 bytes per sample
-            ESP_LOGI(TAG, "🔊 Conversation audio delta: μ-law:%zu → PCM16:%zu bytes", ulaw_size, event.audio_size);
+            ESP_LOGD(TAG, "🔊 Conversation audio delta: μ-law:%zu → PCM16:%zu bytes", ulaw_size, event.audio_size);
         }
 
     } else if (strcmp(event_type, COZE_EVENT_CONVERSATION_CHAT_COMPLETED) == 0) {
         event.type = COZE_MSG_TYPE_RESPONSE_DONE;
         s_state = COZE_STATE_READY;
+        release_turn();
+        latency_ledger_mark(LATENCY_MARK_RESPONSE_DONE);
         ESP_LOGI(TAG, "✅ Conversation chat completed");
 
     } else if (strcmp(event_type, COZE_EVENT_CONVERSATION_CHAT_CANCELED) == 0) {
         event.type = COZE_MSG_TYPE_RESPONSE_DONE;
         s_state = COZE_STATE_READY;
+        release_turn();
         ESP_LOGI(TAG, "⚠️  Conversation chat canceled");
 
     } else if (strcmp(event_type, COZE_EVENT_ERROR) == 0) {
         event.type = COZE_MSG_TYPE_ERROR;
+        release_turn();  // A rejected turn is not sent again on the next session
         char temp_error_msg[COZE_MAX_ERROR_MSG_LEN];
         int error_code = 0;
         if (coze_protocol_parse_error(data, temp_error_msg, sizeof(temp_error_msg), &error_code)) {
@@ -253,12 +301,13 @@ static void handle_received_message(const char *data, int len)
     }
 
     // Notify callback with comprehensive validation
-    ESP_LOGI(TAG, "🔍 About to invoke callback: ptr=%p, event_type=%d",
+    ESP_LOGD(TAG, "🔍 About to invoke callback: ptr=%p, event_type=%d",
              (void*)s_event_callback, event.type);
 
     // Validate function pointer is in valid memory range
-    // Valid ESP32 code ranges: 0x40000000-0x50000000
+    // Valid ESP32 code ranges: 0x40000000-0x50000000 (not applicable to host builds)
     if (s_event_callback) {
+#ifdef ESP_PLATFORM
         if ((uintptr_t)s_event_callback < 0x40000000 ||
             (uintptr_t)s_event_callback > 0x50000000) {
             ESP_LOGE(TAG, "❌ INVALID callback pointer: %p - OUT OF VALID CODE RANGE",
@@ -266,10 +315,11 @@ static void handle_received_message(const char *data, int len)
             ESP_LOGE(TAG, "❌ System may be corrupted! Skipping callback to prevent crash.");
             return;
         }
+#endif
 
-        ESP_LOGI(TAG, "✅ Calling callback...");
+        ESP_LOGD(TAG, "✅ Calling callback...");
         s_event_callback(&event, s_callback_user_data);
-        ESP_LOGI(TAG, "✅ Callback returned successfully");
+        ESP_LOGD(TAG, "✅ Callback returned successfully");
     } else {
         ESP_LOGW(TAG, "⚠️  Callback is NULL, skipping");
     }
@@ -289,17 +339,14 @@ static void websocket_event_handler(void *handler_args, esp_event_base_t base,
             s_send_count = 0;
             s_recv_count = 0;
             s_state = COZE_STATE_CONNECTED;
+            realtime_link_on_connected(s_link);
 
             // Send session configuration
             coze_ws_start_session();
 
-            // Solution 2: Reconnect recovery - resend complete if in PROCESSING state
-            // If we disconnected while waiting for AI response, automatically resend complete
-            if (app_core_get_state() == APP_STATE_PROCESSING) {
-                ESP_LOGW(TAG, "🔄 Reconnected in PROCESSING state - resending input_audio_buffer.complete");
-                vTaskDelay(pdMS_TO_TICKS(500));  // Wait for session to be ready
-                coze_ws_commit_audio();
-            }
+            // Reconnect recovery: a turn completed but not answered before the
+            // drop is replayed by coze_ws_task - its audio from the capture
+            // spool, then input_audio_buffer.complete - once the session is ready
             break;
 
         case WEBSOCKET_EVENT_DISCONNECTED:
@@ -309,8 +356,7 @@ static void websocket_event_handler(void *handler_args, esp_event_base_t base,
 
         case WEBSOCKET_EVENT_DATA:
             s_recv_count++;
-            ESP_LOGE(TAG, "📥 WS_EVENT: DATA #%d (opcode=0x%02X, len=%d)",
-                     s_recv_count, data->op_code, data->data_len);
+            TRACE_EVENT(TRACE_EV_WS_RECV, TRACE_SRC_COZE, data->data_len);
             if (data->op_code == 0x01) {  // Text frame
                 handle_received_message((char *)data->data_ptr, data->data_len);
             } else if (data->op_code == 0x02) {  // Binary frame
@@ -340,72 +386,162 @@ static void websocket_event_handler(void *handler_args, esp_event_base_t base,
     }
 }
 
+// ============================================
+// Private Functions - Turn Commit and Replay (task context)
+// ============================================
+
+static esp_err_t send_commit(void)
+{
+    char buffer[256];
+    int len = coze_protocol_build_audio_complete(buffer, sizeof(buffer));
+    if (len <= 0) {
+        return ESP_FAIL;
+    }
+
+    // Check WebSocket connection status
+    bool ws_connected = esp_websocket_client_is_connected(s_ws_client);
+    ESP_LOGE(TAG, "🔴 COMPLETE: ws_connected=%d, state=%d, sent=%d, recv=%d",
+             ws_connected, s_state, s_send_count, s_recv_count);
+
+    s_send_count++;
+    ESP_LOGE(TAG, "🔴 SEND #%d [COMPLETE]: input_audio_buffer.complete (%d bytes) - AI will auto-respond", s_send_count, len);
+    ESP_LOGE(TAG, "🔴 SEND #%d [COMPLETE]: %s", s_send_count, buffer);
+    esp_err_t ret = esp_websocket_client_send_bin(s_ws_client, buffer, len, pdMS_TO_TICKS(1000));
+    if (ret >= 0) {
+        latency_ledger_mark(LATENCY_MARK_COMMIT_SENT);
+    }
+    ESP_LOGE(TAG, "🔴 SEND #%d [COMPLETE]: DONE (ret=%d) - waiting for conversation.audio.delta...", s_send_count, ret);
+    return ret;
+}
+
+/**
+ * @brief Send the deferred commit once the audio it closes is out
+ *
+ * @param read_pos Spool position sent so far
+ */
+static void send_pending_turn(uint64_t read_pos)
+{
+    portENTER_CRITICAL(&s_turn_lock);
+    bool commit = s_commit_pending && read_pos >= s_commit_pos;
+    if (commit) {
+        s_commit_pending = false;
+        s_turn_unacked = true;
+    }
+    portEXIT_CRITICAL(&s_turn_lock);
+
+    if (commit) {
+        send_commit();
+    }
+}
+
+/**
+ * @brief A new session is ready: send again what the last one did not act on
+ */
+static void resume_session(void)
+{
+    size_t replay = capture_spool_rewind(s_spool);
+
+    portENTER_CRITICAL(&s_turn_lock);
+    bool rearm = s_turn_unacked;
+    if (rearm) {
+        s_turn_unacked = false;
+        s_commit_pending = true;
+    }
+    portEXIT_CRITICAL(&s_turn_lock);
+
+    if (replay > 0 || rearm) {
+        ESP_LOGW(TAG, "↩️ Session back: replaying %u bytes of captured audio%s",
+                 (unsigned)replay, rearm ? ", then input_audio_buffer.complete" : "");
+    }
+}
+
 /**
  * @brief WebSocket task - handles connection and audio streaming
  *
  * Uses batch sending to reduce WebSocket message frequency and improve throughput.
  * Accumulates AUDIO_BATCH_FRAMES frames before sending, or sends on timeout.
+ * Audio comes from the capture spool, which keeps recording while the link
+ * is down; a backlog (replay after reconnect) goes out in REPLAY_BATCH_FRAMES
+ * messages until it has caught up.
  */
 static void coze_ws_task(void *pvParameters)
 {
     ESP_LOGI(TAG, "Coze WebSocket task started (batch mode: %d frames, %dms timeout)",
              AUDIO_BATCH_FRAMES, AUDIO_BATCH_TIMEOUT_MS);
 
-    audio_chunk_t chunk;
     static char send_buffer[WS_BUFFER_SIZE];  // Static to avoid 8KB stack usage
 
     // Batch buffer for accumulating audio frames
-    static uint8_t batch_buffer[COZE_AUDIO_CHUNK_SIZE * AUDIO_BATCH_FRAMES];
+    static uint8_t batch_buffer[COZE_AUDIO_CHUNK_SIZE * REPLAY_BATCH_FRAMES];
     size_t batch_len = 0;
-    int batch_frames = 0;
     uint32_t batch_start_tick = 0;
+    uint32_t ready_gen = s_ready_gen;
 
     while (s_task_running) {
-        // Handle reconnection if needed
-        if (s_state == COZE_STATE_DISCONNECTED && s_ws_client != NULL) {
+        // Handle reconnection if needed (jittered backoff, cut short by pre-warm)
+        if ((s_state == COZE_STATE_DISCONNECTED || s_state == COZE_STATE_ERROR) && s_ws_client != NULL) {
+            uint32_t delay_ms = realtime_link_next_delay_ms(s_link);
+            if (delay_ms > 0) {
+                ESP_LOGI(TAG, "Reconnecting in %lums", (unsigned long)delay_ms);
+                realtime_link_wait(s_link, delay_ms);
+                if (!s_task_running) {
+                    break;
+                }
+            }
             ESP_LOGI(TAG, "Attempting reconnection...");
             coze_ws_connect();
-            vTaskDelay(pdMS_TO_TICKS(RECONNECT_DELAY_MS));
             continue;
         }
 
-        // Process audio queue if connected and ready
+        // Stream spooled audio if connected and ready
         if (s_state == COZE_STATE_READY || s_state == COZE_STATE_STREAMING) {
-            // Try to receive audio with short timeout
-            if (xQueueReceive(s_audio_queue, &chunk, pdMS_TO_TICKS(20)) == pdTRUE) {
-                // Log first chunk to confirm audio flow
-                if (batch_frames == 0 && s_send_count < 3) {
-                    ESP_LOGE(TAG, "🎤 Audio chunk received (state=%d, queue=%d)",
-                             s_state, (int)uxQueueMessagesWaiting(s_audio_queue));
+            // Audio already taken for the previous session is in the replay
+            if (ready_gen != s_ready_gen) {
+                ready_gen = s_ready_gen;
+                batch_len = 0;
+                resume_session();
+            }
+
+            uint64_t read_pos = capture_spool_read_pos(s_spool);
+            size_t backlog = capture_spool_pending(s_spool);
+            size_t target = COZE_AUDIO_CHUNK_SIZE *
+                            (backlog > COZE_AUDIO_CHUNK_SIZE * AUDIO_BATCH_FRAMES ? REPLAY_BATCH_FRAMES : AUDIO_BATCH_FRAMES);
+
+            // A commit closes exactly the audio captured before it
+            portENTER_CRITICAL(&s_turn_lock);
+            bool commit_pending = s_commit_pending;
+            uint64_t commit_pos = s_commit_pos;
+            portEXIT_CRITICAL(&s_turn_lock);
+
+            size_t room = batch_len < target ? target - batch_len : 0;
+            if (commit_pending && commit_pos - read_pos < room) {
+                room = (size_t)(commit_pos - read_pos);
+            }
+            if (room > 0) {
+                size_t n = capture_spool_read(s_spool, batch_buffer + batch_len, room, pdMS_TO_TICKS(20));
+                // Log first chunks to confirm audio flow
+                if (n > 0 && batch_len == 0 && s_send_count < 3) {
+                    ESP_LOGE(TAG, "🎤 Audio from spool (state=%d, pending=%u)", s_state, (unsigned)backlog);
                 }
-                // Start batch timer on first frame
-                if (batch_frames == 0) {
+                // Start batch timer on first bytes
+                if (n > 0 && batch_len == 0) {
                     batch_start_tick = xTaskGetTickCount();
                 }
-
-                // Add to batch buffer
-                if (batch_len + chunk.size <= sizeof(batch_buffer)) {
-                    memcpy(batch_buffer + batch_len, chunk.data, chunk.size);
-                    batch_len += chunk.size;
-                    batch_frames++;
-                }
+                batch_len += n;
+                read_pos += n;
             }
 
             // Check if we should send the batch
-            bool should_send = false;
+            bool at_commit = commit_pending && read_pos >= commit_pos;
             uint32_t elapsed_ms = (xTaskGetTickCount() - batch_start_tick) * portTICK_PERIOD_MS;
-
-            if (batch_frames >= AUDIO_BATCH_FRAMES) {
-                should_send = true;  // Reached batch size
-            } else if (batch_frames > 0 && elapsed_ms >= AUDIO_BATCH_TIMEOUT_MS) {
-                should_send = true;  // Timeout with pending data
-            }
+            bool should_send = batch_len >= target || at_commit ||
+                               (batch_len > 0 && elapsed_ms >= AUDIO_BATCH_TIMEOUT_MS);
 
             // Send batch if ready
             if (should_send && batch_len > 0) {
                 // Convert PCM16 to G.711 μ-law (2:1 compression)
-                // 8kHz × 60ms × 2 bytes = 960 bytes per frame, × 2 frames = 1920 bytes max
-                static uint8_t ulaw_buffer[1920];  // Max μ-law buffer (960 bytes per frame × 2 frames)
+                // 8kHz × 60ms × 2 bytes = 960 bytes per frame, halved per replay batch
+                static uint8_t ulaw_buffer[COZE_AUDIO_CHUNK_SIZE * REPLAY_BATCH_FRAMES / 2];
                 size_t ulaw_len = 0;
                 int16_t *pcm_samples = (int16_t *)batch_buffer;
                 size_t num_samples = batch_len / 2;  // 16-bit samples = bytes / 2
@@ -419,9 +555,11 @@ static void coze_ws_task(void *pvParameters)
                                                            ulaw_buffer, ulaw_len);
                 if (len > 0) {
                     s_send_count++;
-                    ESP_LOGI(TAG, "📤 SEND #%d: %d frames, PCM:%zu → μ-law:%zu → WS:%d bytes (heap: %lu)",
-                             s_send_count, batch_frames, batch_len, ulaw_len, len, esp_get_free_heap_size());
+                    ESP_LOGD(TAG, "📤 SEND #%d: PCM:%zu → μ-law:%zu → WS:%d bytes",
+                             s_send_count, batch_len, ulaw_len, len);
+                    TRACE_BEGIN(TRACE_EV_WS_SEND, TRACE_SRC_COZE, len);
                     int ret = esp_websocket_client_send_bin(s_ws_client, send_buffer, len, pdMS_TO_TICKS(200));
+                    TRACE_END(TRACE_EV_WS_SEND, TRACE_SRC_COZE, ret);
                     if (ret < 0) {
                         ESP_LOGE(TAG, "❌ WebSocket send failed: %d", ret);
                     }
@@ -432,12 +570,14 @@ static void coze_ws_task(void *pvParameters)
 
                 // Reset batch
                 batch_len = 0;
-                batch_frames = 0;
+            }
+
+            if (batch_len == 0) {
+                send_pending_turn(read_pos);
             }
         } else {
-            // Not connected - clear any pending batch and wait
+            // Not ready - the partial batch is still spooled and is replayed on the next session
             batch_len = 0;
-            batch_frames = 0;
             vTaskDelay(pdMS_TO_TICKS(100));
         }
     }
@@ -469,11 +609,13 @@ esp_err_t coze_ws_init(void)
         return ESP_ERR_NO_MEM;
     }
 
-    // Create audio queue
-    s_audio_queue = xQueueCreate(AUDIO_QUEUE_SIZE, sizeof(audio_chunk_t));
-    if (s_audio_queue == NULL) {
-        ESP_LOGE(TAG, "Failed to create audio queue");
-        return ESP_ERR_NO_MEM;
+    // Create capture spool
+    if (s_spool == NULL) {
+        s_spool = capture_spool_create("coze");
+        if (s_spool == NULL) {
+            ESP_LOGE(TAG, "Failed to create capture spool");
+            return ESP_ERR_NO_MEM;
+        }
     }
 
     // Build WebSocket URI (must be static - ws client stores pointer)
@@ -501,8 +643,16 @@ esp_err_t coze_ws_init(void)
         .crt_bundle_attach = esp_crt_bundle_attach,  // Use ESP-IDF default CA bundle
         .transport = WEBSOCKET_TRANSPORT_OVER_SSL,
         .headers = auth_header,
+        // Reconnection is paced by coze_ws_task (realtime_link backoff)
+        .disable_auto_reconnect = true,
     };
 
+    // Reuse the TLS session of the previous connection (no-op unless enabled)
+    if (s_link == NULL) {
+        s_link = realtime_link_create("coze");
+    }
+    realtime_link_attach_transport(s_link, &ws_cfg, auth_header);
+
     // Create WebSocket client
     s_ws_client = esp_websocket_client_init(&ws_cfg);
     if (s_ws_client == NULL) {
@@ -536,9 +686,9 @@ esp_err_t coze_ws_deinit(void)
         s_ws_client = NULL;
     }
 
-    if (s_audio_queue) {
-        vQueueDelete(s_audio_queue);
-        s_audio_queue = NULL;
+    if (s_spool) {
+        capture_spool_destroy(s_spool);
+        s_spool = NULL;
     }
 
     if (s_mutex) {
@@ -571,19 +721,28 @@ esp_err_t coze_ws_connect(void)
         return ESP_ERR_INVALID_STATE;
     }
 
-    if (s_state == COZE_STATE_CONNECTED || s_state == COZE_STATE_READY) {
+    if (s_state == COZE_STATE_CONNECTING || s_state == COZE_STATE_CONNECTED ||
+        s_state == COZE_STATE_READY || s_state == COZE_STATE_STREAMING) {
         return ESP_OK;
     }
 
     ESP_LOGI(TAG, "Connecting to Coze server...");
+
+    // Auto-reconnect is off: make sure the previous run has fully exited
+    if (s_ws_started) {
+        esp_websocket_client_stop(s_ws_client);
+        s_ws_started = false;
+    }
     s_state = COZE_STATE_CONNECTING;
 
+    realtime_link_on_connecting(s_link);
     esp_err_t ret = esp_websocket_client_start(s_ws_client);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to start WebSocket client: %s", esp_err_to_name(ret));
         s_state = COZE_STATE_ERROR;
         return ret;
     }
+    s_ws_started = true;
 
     return ESP_OK;
 }
@@ -601,11 +760,17 @@ esp_err_t coze_ws_disconnect(void)
     ESP_LOGI(TAG, "Disconnecting from Coze server...");
 
     esp_websocket_client_stop(s_ws_client);
+    s_ws_started = false;
     s_state = COZE_STATE_DISCONNECTED;
 
     return ESP_OK;
 }
 
+void coze_ws_prewarm(void)
+{
+    realtime_link_prewarm(s_link);
+}
+
 bool coze_ws_is_connected(void)
 {
     return s_state == COZE_STATE_READY || s_state == COZE_STATE_STREAMING;
@@ -661,34 +826,22 @@ esp_err_t coze_ws_send_audio(const uint8_t *audio_data, size_t size)
         return ESP_ERR_INVALID_ARG;
     }
 
-    if (!coze_ws_is_connected()) {
-        ESP_LOGE(TAG, "❌ send_audio: not connected (state=%d)", s_state);
+    // Audio is spooled while disconnected too and sent once the session is back
+    if (!s_task_running) {
+        ESP_LOGE(TAG, "❌ send_audio: task not running (state=%d)", s_state);
         return ESP_ERR_INVALID_STATE;
     }
 
-    // Queue audio data in chunks
-    size_t offset = 0;
-    int chunks_queued = 0;
-    while (offset < size) {
-        audio_chunk_t chunk;
-        chunk.size = (size - offset > COZE_AUDIO_CHUNK_SIZE) ?
-                     COZE_AUDIO_CHUNK_SIZE : (size - offset);
-        memcpy(chunk.data, audio_data + offset, chunk.size);
-
-        if (xQueueSend(s_audio_queue, &chunk, pdMS_TO_TICKS(10)) != pdTRUE) {
-            ESP_LOGW(TAG, "Audio queue full, dropping chunk");
-        } else {
-            chunks_queued++;
-            s_audio_queued_count++;
-        }
-
-        offset += chunk.size;
+    if (capture_spool_write(s_spool, audio_data, size) != ESP_OK) {
+        ESP_LOGW(TAG, "Capture spool full or busy, dropping audio");
+        TRACE_EVENT(TRACE_EV_WS_QUEUE_DROP, TRACE_SRC_COZE, size);
     }
+    s_audio_queued_count++;
 
-    // Log every 50 chunks
+    // Log every 50 writes
     if (s_audio_queued_count % 50 == 0) {
-        ESP_LOGI(TAG, "🎙️ Audio queued: total=%lu, this call=%d chunks, %u bytes",
-                 s_audio_queued_count, chunks_queued, (unsigned)size);
+        ESP_LOGI(TAG, "🎙️ Audio spooled: total=%lu writes, this call=%u bytes, pending=%u bytes",
+                 s_audio_queued_count, (unsigned)size, (unsigned)capture_spool_pending(s_spool));
     }
 
     return ESP_OK;
@@ -707,28 +860,27 @@ esp_err_t coze_ws_send_text(const char *text)
 
 esp_err_t coze_ws_commit_audio(void)
 {
-    if (!coze_ws_is_connected()) {
-        ESP_LOGE(TAG, "❌ complete_audio: not connected (state=%d)", s_state);
+    if (!s_initialized || s_spool == NULL) {
         return ESP_ERR_INVALID_STATE;
     }
 
-    char buffer[256];
-    int len = coze_protocol_build_audio_complete(buffer, sizeof(buffer));
-    if (len <= 0) {
-        return ESP_FAIL;
+    // Turns not driven by app_core start their latency clock at commit
+    if (!latency_ledger_turn_active()) {
+        latency_ledger_begin_turn(LATENCY_PROVIDER_COZE_WS);
     }
 
-    // Check WebSocket connection status
-    bool ws_connected = esp_websocket_client_is_connected(s_ws_client);
-    ESP_LOGE(TAG, "🔴 COMPLETE: ws_connected=%d, state=%d, sent=%d, recv=%d",
-             ws_connected, s_state, s_send_count, s_recv_count);
+    // The task sends the commit right after the last audio captured before it
+    uint64_t head = capture_spool_head(s_spool);
+    portENTER_CRITICAL(&s_turn_lock);
+    s_commit_pos = head;
+    s_commit_pending = true;
+    portEXIT_CRITICAL(&s_turn_lock);
+    capture_spool_notify(s_spool);
 
-    s_send_count++;
-    ESP_LOGE(TAG, "🔴 SEND #%d [COMPLETE]: input_audio_buffer.complete (%d bytes) - AI will auto-respond", s_send_count, len);
-    ESP_LOGE(TAG, "🔴 SEND #%d [COMPLETE]: %s", s_send_count, buffer);
-    esp_err_t ret = esp_websocket_client_send_bin(s_ws_client, buffer, len, pdMS_TO_TICKS(1000));
-    ESP_LOGE(TAG, "🔴 SEND #%d [COMPLETE]: DONE (ret=%d) - waiting for conversation.audio.delta...", s_send_count, ret);
-    return ret;
+    if (!coze_ws_is_connected()) {
+        ESP_LOGW(TAG, "⏸️ complete_audio: not connected (state=%d), deferred until the session is back", s_state);
+    }
+    return ESP_OK;
 }
 
 esp_err_t coze_ws_cancel_response(void)
@@ -856,9 +1008,17 @@ esp_err_t coze_ws_stop_task(void)
     }
 
     s_task_running = false;
+    realtime_link_prewarm(s_link);  // Wake a pending reconnect backoff
     vTaskDelay(pdMS_TO_TICKS(200));
     s_ws_task = NULL;
 
+    // Drop spooled audio and any deferred turn
+    capture_spool_reset(s_spool);
+    portENTER_CRITICAL(&s_turn_lock);
+    s_commit_pending = false;
+    s_turn_unacked = false;
+    portEXIT_CRITICAL(&s_turn_lock);
+
     ESP_LOGI(TAG, "Coze WS task stopped");
     return ESP_OK;
 }
@@ -162,6 +162,14 @@ esp_err_t coze_ws_connect(void);
  */
 esp_err_t coze_ws_disconnect(void);
 
+/**
+ * @brief Connect now if the task is waiting out a reconnect backoff
+ *
+ * Called when the user is about to talk so the session is up by the time
+ * audio arrives.
+ */
+void coze_ws_prewarm(void);
+
 /**
  * @brief Check if connected to Coze server
  *
@@ -193,9 +201,12 @@ esp_err_t coze_ws_end_session(void);
 /**
  * @brief Send audio data to Coze
  *
+ * Audio goes through the capture spool, so it is accepted while the
+ * connection is down and sent (again) once the next session is ready.
+ *
  * @param audio_data Audio data (PCM format)
  * @param size Size in bytes
- * @return ESP_OK on success
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the task is not running
  */
 esp_err_t coze_ws_send_audio(const uint8_t *audio_data, size_t size);
 
@@ -210,6 +221,10 @@ esp_err_t coze_ws_send_text(const char *text);
 /**
  * @brief Commit audio buffer (signal end of user speech)
  *
+ * Sent by the task right after the audio captured before this call, or on
+ * the next session when disconnected. A commit the server has not answered
+ * when the connection drops is sent again with its audio after reconnect.
+ *
  * @return ESP_OK on success
  */
 esp_err_t coze_ws_commit_audio(void);
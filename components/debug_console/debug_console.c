@@ -7,15 +7,22 @@
 #include "app_core.h"
 #include "app_events.h"
 #include "coze_ws.h"
+#include "latency_ledger.h"
+#include "trace_ring.h"
 #include "esp_log.h"
 #include "esp_console.h"
+#include "esp_timer.h"
 #include "argtable3/argtable3.h"
 #include "driver/uart.h"
 #include "linenoise/linenoise.h"
 #include <string.h>
+#include <stdio.h>
 
 static const char *TAG = "DEBUG_CONSOLE";
 
+#define TRACE_DEFAULT_PATH      "/sdcard/trace.json"
+#define TRACE_BENCH_EVENTS      10000
+
 // ============================================
 // Command Implementations
 // ============================================
@@ -33,6 +40,18 @@ static struct {
     struct arg_end *end;
 } status_args;
 
+static struct {
+    struct arg_lit *reset;
+    struct arg_lit *save;
+    struct arg_end *end;
+} latency_args;
+
+static struct {
+    struct arg_str *action;
+    struct arg_str *path;
+    struct arg_end *end;
+} trace_args;
+
 /**
  * @brief Send text message command
  */
@@ -130,6 +149,120 @@ static int cmd_status(int argc, char **argv)
     return 0;
 }
 
+/**
+ * @brief Show (or reset / persist) turn latency percentiles
+ */
+static int cmd_latency(int argc, char **argv)
+{
+    int nerrors = arg_parse(argc, argv, (void **) &latency_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, latency_args.end, argv[0]);
+        return 1;
+    }
+
+    if (latency_args.reset->count > 0) {
+        esp_err_t ret = latency_ledger_reset();
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "❌ Failed to reset latency ledger: %s", esp_err_to_name(ret));
+            return 1;
+        }
+        ESP_LOGI(TAG, "✅ Latency ledger cleared");
+        return 0;
+    }
+
+    if (latency_args.save->count > 0) {
+        esp_err_t ret = latency_ledger_save();
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "❌ Failed to save latency ledger: %s", esp_err_to_name(ret));
+            return 1;
+        }
+        ESP_LOGI(TAG, "✅ Latency ledger saved to NVS");
+    }
+
+    latency_ledger_print();
+    return 0;
+}
+
+/**
+ * @brief Compare trace ring cost against formatting an equivalent log line
+ */
+static void trace_bench(void)
+{
+    uint32_t trace_ns = trace_ring_measure_cost(TRACE_BENCH_EVENTS);
+
+    // Format-only cost of a typical per-frame log line (UART time excluded)
+    char line[128];
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < TRACE_BENCH_EVENTS; i++) {
+        snprintf(line, sizeof(line), "I (%lu) APP_CORE: 🎤 Audio callback: %u bytes, VAD=%d, state=%s",
+                 (unsigned long)i, 640u, i & 3, "LISTENING");
+    }
+    uint32_t log_ns = (uint32_t)((esp_timer_get_time() - start) * 1000 / TRACE_BENCH_EVENTS);
+
+    ESP_LOGI(TAG, "⏱️  Trace event: %lu ns, log line format: %lu ns (+ ~%d us UART per line)",
+             trace_ns, log_ns, (int)(strlen(line) * 10 * 1000000 / 115200));
+}
+
+/**
+ * @brief Trace ring control and Chrome trace JSON export
+ */
+static int cmd_trace(int argc, char **argv)
+{
+    int nerrors = arg_parse(argc, argv, (void **) &trace_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, trace_args.end, argv[0]);
+        return 1;
+    }
+
+    const char *action = trace_args.action->count > 0 ? trace_args.action->sval[0] : "stats";
+
+    if (strcmp(action, "dump") == 0) {
+        uint32_t written = 0;
+        esp_err_t ret = trace_ring_export_json(stdout, &written);
+        fflush(stdout);
+        ESP_LOGI(TAG, "📤 Dumped %lu trace events", written);
+        return ret == ESP_OK ? 0 : 1;
+    }
+
+    if (strcmp(action, "save") == 0) {
+        const char *path = trace_args.path->count > 0 ? trace_args.path->sval[0] : TRACE_DEFAULT_PATH;
+        FILE *f = fopen(path, "w");
+        if (f == NULL) {
+            ESP_LOGE(TAG, "❌ Cannot open %s (is the SD card mounted?)", path);
+            return 1;
+        }
+        uint32_t written = 0;
+        esp_err_t ret = trace_ring_export_json(f, &written);
+        fclose(f);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "❌ Failed to write %s", path);
+            return 1;
+        }
+        ESP_LOGI(TAG, "✅ Saved %lu trace events to %s", written, path);
+        return 0;
+    }
+
+    if (strcmp(action, "clear") == 0) {
+        trace_ring_clear();
+    } else if (strcmp(action, "on") == 0) {
+        trace_ring_set_enabled(true);
+    } else if (strcmp(action, "off") == 0) {
+        trace_ring_set_enabled(false);
+    } else if (strcmp(action, "bench") == 0) {
+        trace_bench();
+        return 0;
+    } else if (strcmp(action, "stats") != 0) {
+        ESP_LOGW(TAG, "Unknown trace action '%s'", action);
+        return 1;
+    }
+
+    trace_ring_stats_t stats;
+    trace_ring_get_stats(&stats);
+    ESP_LOGI(TAG, "🧵 Trace ring: %s, %lu recorded, %lu overwritten, capacity %lu",
+             stats.enabled ? "ON" : "OFF", stats.recorded, stats.overwritten, stats.capacity);
+    return 0;
+}
+
 /**
  * @brief Send quick test message "你好"
  */
@@ -213,7 +346,35 @@ static void register_commands(void)
     };
     ESP_ERROR_CHECK(esp_console_cmd_register(&hello_cmd));
 
-    ESP_LOGI(TAG, "Registered commands: send, start, status, hello");
+    // Register 'latency' command
+    latency_args.reset = arg_lit0("r", "reset", "Clear all latency histograms");
+    latency_args.save = arg_lit0("s", "save", "Persist histograms to NVS now");
+    latency_args.end = arg_end(2);
+
+    const esp_console_cmd_t latency_cmd = {
+        .command = "latency",
+        .help = "Show turn latency percentiles (p50/p90/p99)",
+        .hint = NULL,
+        .func = &cmd_latency,
+        .argtable = &latency_args
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&latency_cmd));
+
+    // Register 'trace' command
+    trace_args.action = arg_str0(NULL, NULL, "<action>", "stats | dump | save | clear | on | off | bench");
+    trace_args.path = arg_str0(NULL, NULL, "<path>", "File for 'save' (default " TRACE_DEFAULT_PATH ")");
+    trace_args.end = arg_end(2);
+
+    const esp_console_cmd_t trace_cmd = {
+        .command = "trace",
+        .help = "Binary trace ring control, Chrome trace JSON export",
+        .hint = NULL,
+        .func = &cmd_trace,
+        .argtable = &trace_args
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&trace_cmd));
+
+    ESP_LOGI(TAG, "Registered commands: send, start, status, hello, latency, trace");
 }
 
 esp_err_t debug_console_init(void)
@@ -243,6 +404,8 @@ esp_err_t debug_console_init(void)
     printf("  hello           - Send '你好' (quick test)\n");
     printf("  start           - Start conversation\n");
     printf("  status          - Show system status\n");
+    printf("  latency [-r|-s] - Turn latency percentiles\n");
+    printf("  trace [action]  - Trace ring (dump/save/clear/bench)\n");
     printf("  help            - Show all commands\n");
     printf("===========================================\n\n");
 
@@ -7,9 +7,24 @@
  *
  * CRITICAL: Initialization order matters for memory allocation!
  * Order: SPI bus → Panel IO → Panel init → lv_init() → Buffers → Display create
+ *
+ * The SH8601 takes RGB565 big-endian, so each area is byte-swapped in the
+ * flush callback.
+ *
+ * The panel is round: invalidated areas are cut into bands of one draw
+ * buffer height and narrowed to the circle (display_round), so corners that
+ * can never be seen are neither rendered nor sent.
+ *
+ * The LVGL task is event-driven (display_loop): it sleeps until its next
+ * LVGL timer or until display_unlock() reports a change from another task,
+ * and blocks outright while nothing is pending. LVGL reads the tick from
+ * esp_timer instead of a periodic tick interrupt, and waits for a transfer
+ * on a semaphore given by the DMA done ISR instead of spinning.
  */
 
 #include "display_init.h"
+#include "display_round.h"
+#include "display_loop.h"
 
 #include <string.h>
 #include "freertos/FreeRTOS.h"
@@ -28,6 +43,16 @@
 
 static const char *TAG = "display_init";
 
+#ifndef CONFIG_DISPLAY_TE_GPIO
+#define CONFIG_DISPLAY_TE_GPIO -1
+#endif
+
+// Longest wait for the TE pulse (one refresh at 50 Hz, with margin)
+#define DISPLAY_TE_TIMEOUT_MS   25
+#define DISPLAY_FPS_WINDOW_US   1000000
+// Longest wait for a transfer before LVGL reuses its buffer anyway
+#define DISPLAY_FLUSH_TIMEOUT_MS 100
+
 // ============================================
 // Private Variables
 // ============================================
@@ -36,13 +61,41 @@ static esp_lcd_panel_io_handle_t s_panel_io = NULL;
 static esp_lcd_panel_handle_t s_panel = NULL;
 static lv_display_t *s_lv_disp = NULL;
 static SemaphoreHandle_t s_lvgl_mutex = NULL;
-static esp_timer_handle_t s_lvgl_tick_timer = NULL;
 static TaskHandle_t s_lvgl_task_handle = NULL;
 
 // LVGL draw buffers
 static void *s_buf1 = NULL;
 static void *s_buf2 = NULL;
 
+// Tearing effect pulse, given from the GPIO ISR
+static SemaphoreHandle_t s_te_sem = NULL;
+static bool s_frame_start = true;
+
+// Transfer done, given from the DMA done ISR while LVGL waits in flush_wait_cb
+static SemaphoreHandle_t s_flush_sem = NULL;
+static uint32_t s_refr_flushes = 0;
+
+// Flush statistics, updated from the flush callback and the transfer done ISR
+typedef struct {
+    uint32_t frames;
+    uint32_t flushes;
+    uint32_t transfers;
+    uint64_t flush_cpu_us;
+    uint32_t flush_cpu_us_max;
+    uint64_t transfer_us;
+    uint32_t te_waits;
+    uint32_t te_timeouts;
+    int64_t  transfer_start_us;
+    bool     transfer_last;
+    int64_t  last_frame_us;
+    int64_t  window_start_us;
+    uint32_t window_frames;
+    uint32_t fps;
+} flush_stats_t;
+
+static flush_stats_t s_stats;
+static portMUX_TYPE s_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
 // ============================================
 // SH8601 Initialization Commands
 // ============================================
@@ -65,36 +118,71 @@ static const sh8601_lcd_init_cmd_t lcd_init_cmds[] = {
 // Private Functions
 // ============================================
 
+/**
+ * @brief Wait for the panel's TE pulse before the first area of a frame
+ */
+static void wait_tearing_effect(void)
+{
+    // Drop a pulse left from an earlier frame, then wait for the next one
+    xSemaphoreTake(s_te_sem, 0);
+    bool got = xSemaphoreTake(s_te_sem, pdMS_TO_TICKS(DISPLAY_TE_TIMEOUT_MS)) == pdTRUE;
+    portENTER_CRITICAL(&s_stats_lock);
+    if (got) {
+        s_stats.te_waits++;
+    } else {
+        s_stats.te_timeouts++;
+    }
+    portEXIT_CRITICAL(&s_stats_lock);
+}
+
 /**
  * @brief LVGL display flush callback (LVGL 9.x API)
  *
- * IMPORTANT: SH8601 display requires RGB565 byte swapping for correct colors.
- * Without swapping, colors appear inverted (e.g., dark gray shows as magenta).
+ * IMPORTANT: SH8601 display requires RGB565 in big-endian byte order.
+ * Without it, colors appear wrong (e.g., dark gray shows as magenta).
+ * The area is swapped here, on the LVGL core, before the transfer.
  *
- * We swap bytes, send to display, then call flush_ready immediately.
- * This makes the operation synchronous to avoid buffer race conditions.
- * The SPI panel_io still uses async transfer internally, but LVGL won't
- * reuse the buffer until we explicitly allow it.
+ * The transfer is only queued here. LVGL renders the next area into the
+ * other draw buffer meanwhile, and waits for flush_ready (given from
+ * panel_io_done_cb when the DMA finished) before reusing this one.
  */
 static void lvgl_flush_cb(lv_display_t *display, const lv_area_t *area, uint8_t *px_map)
 {
     esp_lcd_panel_handle_t panel = lv_display_get_user_data(display);
+    int64_t start_us = esp_timer_get_time();
 
-    int x1 = area->x1;
-    int y1 = area->y1;
-    int x2 = area->x2;
-    int y2 = area->y2;
-
-    // Swap RGB565 bytes for SH8601 display (required for correct color rendering)
     // This matches the BSP's .swap_bytes = true behavior
-    uint32_t len = (x2 - x1 + 1) * (y2 - y1 + 1);
-    lv_draw_sw_rgb565_swap(px_map, len);
+    lv_draw_sw_rgb565_swap(px_map, lv_area_get_size(area));
 
-    // Draw bitmap to panel
-    esp_lcd_panel_draw_bitmap(panel, x1, y1, x2 + 1, y2 + 1, px_map);
+    int64_t te_us = 0;
+    if (s_te_sem && s_frame_start) {
+        int64_t te_start_us = esp_timer_get_time();
+        wait_tearing_effect();
+        te_us = esp_timer_get_time() - te_start_us;
+    }
+    s_frame_start = lv_display_flush_is_last(display);
+
+    portENTER_CRITICAL(&s_stats_lock);
+    s_stats.transfer_last = s_frame_start;
+    s_stats.transfer_start_us = esp_timer_get_time();
+    portEXIT_CRITICAL(&s_stats_lock);
+
+    // Draw bitmap to panel; the done ISR gives the semaphore for this transfer only
+    if (s_flush_sem) {
+        xSemaphoreTake(s_flush_sem, 0);
+    }
+    s_refr_flushes++;
+    esp_lcd_panel_draw_bitmap(panel, area->x1, area->y1, area->x2 + 1, area->y2 + 1, px_map);
 
-    // Note: flush_ready is called from panel_io_done_cb when SPI transfer completes
-    // The buffer should not be modified until then
+    // Waiting for TE is idle time, not CPU time
+    uint32_t cpu_us = (uint32_t)(esp_timer_get_time() - start_us - te_us);
+    portENTER_CRITICAL(&s_stats_lock);
+    s_stats.flushes++;
+    s_stats.flush_cpu_us += cpu_us;
+    if (cpu_us > s_stats.flush_cpu_us_max) {
+        s_stats.flush_cpu_us_max = cpu_us;
+    }
+    portEXIT_CRITICAL(&s_stats_lock);
 }
 
 /**
@@ -107,44 +195,178 @@ static void lvgl_flush_cb(lv_display_t *display, const lv_area_t *area, uint8_t
 static bool panel_io_done_cb(esp_lcd_panel_io_handle_t panel_io,
                               esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
 {
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL_ISR(&s_stats_lock);
+    if (s_stats.transfer_start_us) {
+        s_stats.transfers++;
+        s_stats.transfer_us += now - s_stats.transfer_start_us;
+        s_stats.transfer_start_us = 0;
+        if (s_stats.transfer_last) {
+            s_stats.frames++;
+            s_stats.last_frame_us = now;
+            if (s_stats.window_frames++ == 0) {
+                s_stats.window_start_us = now;
+            } else if (now - s_stats.window_start_us >= DISPLAY_FPS_WINDOW_US) {
+                s_stats.fps = (uint32_t)((s_stats.window_frames - 1) * 1000000LL / (now - s_stats.window_start_us));
+                s_stats.window_start_us = now;
+                s_stats.window_frames = 1;
+            }
+        }
+    }
+    portEXIT_CRITICAL_ISR(&s_stats_lock);
+
     // Use global display handle (set after display creation)
+    BaseType_t woken = pdFALSE;
     if (s_lv_disp) {
         lv_display_flush_ready(s_lv_disp);
+        if (s_flush_sem) {
+            xSemaphoreGiveFromISR(s_flush_sem, &woken);
+        }
+    }
+    return woken == pdTRUE;
+}
+
+/**
+ * @brief Block LVGL until the transfer in flight is done
+ *
+ * Called by LVGL before it reuses a draw buffer. Without it LVGL spins on
+ * the flushing flag for the whole transfer.
+ */
+static void lvgl_flush_wait_cb(lv_display_t *display)
+{
+    int64_t start_us = esp_timer_get_time();
+    if (xSemaphoreTake(s_flush_sem, pdMS_TO_TICKS(DISPLAY_FLUSH_TIMEOUT_MS)) != pdTRUE) {
+        ESP_LOGW(TAG, "Transfer not done after %d ms", DISPLAY_FLUSH_TIMEOUT_MS);
     }
-    return false;
+    display_loop_flush_wait((uint32_t)(esp_timer_get_time() - start_us));
 }
 
 /**
- * @brief LVGL tick timer callback
+ * @brief Time each refresh of the display
  */
-static void lvgl_tick_cb(void *arg)
+static void refr_event_cb(lv_event_t *e)
+{
+    if (lv_event_get_code(e) == LV_EVENT_REFR_START) {
+        s_refr_flushes = 0;
+        display_loop_frame_begin();
+    } else {
+        display_loop_frame_end(s_refr_flushes > 0);
+    }
+}
+
+static void IRAM_ATTR te_isr(void *arg)
 {
-    lv_tick_inc(DISPLAY_LVGL_TICK_MS);
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(s_te_sem, &woken);
+    if (woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+/**
+ * @brief Route the panel's TE output to a semaphore, if it is wired
+ */
+static esp_err_t init_tearing_effect(void)
+{
+    if (CONFIG_DISPLAY_TE_GPIO < 0) {
+        return ESP_OK;
+    }
+    s_te_sem = xSemaphoreCreateBinary();
+    if (s_te_sem == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    gpio_config_t te_gpio_conf = {
+        .pin_bit_mask = (1ULL << CONFIG_DISPLAY_TE_GPIO),
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_POSEDGE,
+    };
+    esp_err_t ret = gpio_config(&te_gpio_conf);
+    if (ret == ESP_OK) {
+        // Already installed by another driver is fine
+        ret = gpio_install_isr_service(0);
+        if (ret == ESP_ERR_INVALID_STATE) {
+            ret = ESP_OK;
+        }
+    }
+    if (ret == ESP_OK) {
+        ret = gpio_isr_handler_add(CONFIG_DISPLAY_TE_GPIO, te_isr, NULL);
+    }
+    if (ret != ESP_OK) {
+        vSemaphoreDelete(s_te_sem);
+        s_te_sem = NULL;
+        return ret;
+    }
+    ESP_LOGI(TAG, "Flush paced to TE on GPIO %d", CONFIG_DISPLAY_TE_GPIO);
+    return ESP_OK;
+}
+
+static void deinit_tearing_effect(void)
+{
+    if (s_te_sem) {
+        gpio_isr_handler_remove(CONFIG_DISPLAY_TE_GPIO);
+        vSemaphoreDelete(s_te_sem);
+        s_te_sem = NULL;
+    }
+}
+
+/**
+ * @brief Clip invalidated areas to the round panel
+ *
+ * Tall areas are cut into bands, the rows below the first band are
+ * invalidated again (and come back here), and each band is narrowed to the
+ * circle. Bands are one draw buffer high so each is rendered and flushed
+ * in one piece. A band with nothing on the circle is shrunk to two pixels
+ * at the edge of the circle (display_round_min_area) rather than emptied,
+ * which LVGL's refresh does not expect.
+ */
+static void invalidate_area_cb(lv_event_t *e)
+{
+    lv_area_t *area = (lv_area_t *)lv_event_get_param(e);
+    display_round_area_t band = {area->x1, area->y1, area->x2, area->y2};
+    display_round_area_t rest;
+    if (display_round_split(&band, &rest)) {
+        lv_area_t rest_area = {rest.x1, rest.y1, rest.x2, rest.y2};
+        lv_inv_area(s_lv_disp, &rest_area);
+    }
+    if (!display_round_clip(&band)) {
+        display_round_min_area(&band);
+    }
+    area->x1 = band.x1;
+    area->y1 = band.y1;
+    area->x2 = band.x2;
+    area->y2 = band.y2;
+}
+
+/**
+ * @brief LVGL tick source, read when LVGL needs the time
+ */
+static uint32_t lvgl_tick_get_cb(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
 }
 
 /**
  * @brief LVGL rendering task
+ *
+ * Runs the LVGL timers, then sleeps until the next one is due. With none
+ * pending (refresh paused, no animation) it sleeps until display_unlock()
+ * wakes it for a change made by another task.
  */
 static void lvgl_task(void *arg)
 {
     ESP_LOGI(TAG, "LVGL task started");
 
-    uint32_t task_delay_ms = 500;
+    display_loop_bind(LV_DEF_REFR_PERIOD);
 
     while (1) {
+        uint32_t next_ms = 0;
         if (display_lock(-1)) {
-            task_delay_ms = lv_timer_handler();
+            next_ms = lv_timer_handler();
             display_unlock();
         }
-
-        // Clamp delay
-        if (task_delay_ms > 500) {
-            task_delay_ms = 500;
-        } else if (task_delay_ms < 1) {
-            task_delay_ms = 1;
-        }
-
-        vTaskDelay(pdMS_TO_TICKS(task_delay_ms));
+        display_loop_wait(next_ms == LV_NO_TIMER_READY ? DISPLAY_LOOP_WAIT_FOREVER : next_ms);
     }
 }
 
@@ -262,6 +484,8 @@ esp_err_t display_init(void)
     // ========================================
     ESP_LOGI(TAG, "Initializing LVGL...");
     lv_init();
+    // LVGL reads the time on demand, so no tick interrupt runs while the UI is idle
+    lv_tick_set_cb(lvgl_tick_get_cb);
 
     // ========================================
     // Step 7: Allocate LVGL buffers IMMEDIATELY after lv_init()
@@ -313,39 +537,46 @@ esp_err_t display_init(void)
     lv_display_set_flush_cb(s_lv_disp, lvgl_flush_cb);
     lv_display_set_user_data(s_lv_disp, s_panel);
 
-    // ========================================
-    // Step 9: Create LVGL tick timer
-    // ========================================
-    ESP_LOGI(TAG, "Installing LVGL tick timer...");
-    const esp_timer_create_args_t timer_args = {
-        .callback = lvgl_tick_cb,
-        .name = "lvgl_tick",
-    };
+    // Block on the transfer instead of spinning; without the semaphore LVGL spins
+    s_flush_sem = xSemaphoreCreateBinary();
+    if (s_flush_sem) {
+        lv_display_set_flush_wait_cb(s_lv_disp, lvgl_flush_wait_cb);
+    } else {
+        ESP_LOGW(TAG, "No flush semaphore, LVGL polls for transfers");
+    }
+    lv_display_add_event_cb(s_lv_disp, refr_event_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(s_lv_disp, refr_event_cb, LV_EVENT_REFR_READY, NULL);
 
-    ret = esp_timer_create(&timer_args, &s_lvgl_tick_timer);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to create LVGL tick timer: %s", esp_err_to_name(ret));
-        goto err_cleanup;
+#if CONFIG_DISPLAY_ROUND_CLIP
+    // Redraw only what the round panel shows
+    if (display_round_init(DISPLAY_H_RES, DISPLAY_LVGL_BUF_HEIGHT) == ESP_OK) {
+        lv_display_add_event_cb(s_lv_disp, invalidate_area_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    } else {
+        ESP_LOGW(TAG, "Round clipping disabled, redrawing full rectangles");
     }
+#endif
 
-    ret = esp_timer_start_periodic(s_lvgl_tick_timer, DISPLAY_LVGL_TICK_MS * 1000);
+    // ========================================
+    // Step 9: Pace the flush to the tearing effect signal (optional)
+    // ========================================
+    ret = init_tearing_effect();
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to start LVGL tick timer: %s", esp_err_to_name(ret));
-        goto err_cleanup;
+        ESP_LOGW(TAG, "TE pacing disabled: %s", esp_err_to_name(ret));
     }
 
     ESP_LOGI(TAG, "Display initialized successfully");
     return ESP_OK;
 
 err_cleanup:
-    if (s_lvgl_tick_timer) {
-        esp_timer_delete(s_lvgl_tick_timer);
-        s_lvgl_tick_timer = NULL;
-    }
     if (s_lv_disp) {
         lv_display_delete(s_lv_disp);
         s_lv_disp = NULL;
     }
+    if (s_flush_sem) {
+        vSemaphoreDelete(s_flush_sem);
+        s_flush_sem = NULL;
+    }
+    display_round_deinit();
     if (s_panel) {
         esp_lcd_panel_del(s_panel);
         s_panel = NULL;
@@ -378,18 +609,20 @@ esp_err_t display_deinit(void)
     if (s_lvgl_task_handle) {
         vTaskDelete(s_lvgl_task_handle);
         s_lvgl_task_handle = NULL;
+        display_loop_unbind();
     }
 
-    if (s_lvgl_tick_timer) {
-        esp_timer_stop(s_lvgl_tick_timer);
-        esp_timer_delete(s_lvgl_tick_timer);
-        s_lvgl_tick_timer = NULL;
-    }
+    deinit_tearing_effect();
 
     if (s_lv_disp) {
         lv_display_delete(s_lv_disp);
         s_lv_disp = NULL;
     }
+    if (s_flush_sem) {
+        vSemaphoreDelete(s_flush_sem);
+        s_flush_sem = NULL;
+    }
+    display_round_deinit();
     if (s_panel) {
         esp_lcd_panel_del(s_panel);
         s_panel = NULL;
@@ -434,6 +667,8 @@ void display_unlock(void)
 {
     if (s_lvgl_mutex != NULL) {
         xSemaphoreGiveRecursive(s_lvgl_mutex);
+        // The caller may have invalidated, animated or added a timer: let LVGL look
+        display_loop_wake();
     }
 }
 
@@ -472,3 +707,53 @@ esp_err_t display_power(bool on)
     ESP_LOGI(TAG, "Display power %s", on ? "on" : "off");
     return ESP_OK;
 }
+
+esp_err_t display_get_stats(display_stats_t *stats)
+{
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_stats_lock);
+    flush_stats_t s = s_stats;
+    portEXIT_CRITICAL(&s_stats_lock);
+    display_loop_stats_t loop;
+    display_loop_get_stats(&loop);
+    uint64_t loop_us = loop.busy_us + loop.idle_us;
+
+    *stats = (display_stats_t) {
+        .fps = (now - s.last_frame_us < DISPLAY_FPS_WINDOW_US) ? s.fps : 0,
+        .frames = s.frames,
+        .flushes = s.flushes,
+        .flush_cpu_us_avg = s.flushes ? (uint32_t)(s.flush_cpu_us / s.flushes) : 0,
+        .flush_cpu_us_max = s.flush_cpu_us_max,
+        .transfer_us_avg = s.transfers ? (uint32_t)(s.transfer_us / s.transfers) : 0,
+        .te_waits = s.te_waits,
+        .te_timeouts = s.te_timeouts,
+        .frame_us_avg = loop.frame_us_avg,
+        .frame_us_max = loop.frame_us_max,
+        .render_us_avg = loop.render_us_avg,
+        .render_us_max = loop.render_us_max,
+        .flush_wait_us_avg = loop.flush_wait_us_avg,
+        .frames_late = loop.frames_late,
+        .frames_skipped = loop.frames_skipped,
+        .loop_passes = loop.passes,
+        .loop_wakes = loop.wakes,
+        .loop_idle_waits = loop.idle_waits,
+        .loop_busy_pct = loop_us ? (uint32_t)(loop.busy_us * 100 / loop_us) : 0,
+    };
+    return ESP_OK;
+}
+
+void display_reset_stats(void)
+{
+    portENTER_CRITICAL(&s_stats_lock);
+    // Keep the transfer in flight so its completion is still matched
+    int64_t transfer_start_us = s_stats.transfer_start_us;
+    bool transfer_last = s_stats.transfer_last;
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.transfer_start_us = transfer_start_us;
+    s_stats.transfer_last = transfer_last;
+    portEXIT_CRITICAL(&s_stats_lock);
+    display_loop_reset_stats();
+}
@@ -0,0 +1,169 @@
+/**
+ * @file display_loop.c
+ * @brief Event-driven pacing and frame telemetry for the LVGL task
+ */
+
+#include "display_loop.h"
+
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+
+// ============================================
+// Private Types and Variables
+// ============================================
+
+typedef struct {
+    uint32_t passes;
+    uint32_t wakes;
+    uint32_t idle_waits;
+    uint64_t busy_us;
+    uint64_t idle_us;
+    uint32_t frames;
+    uint64_t frame_us;
+    uint32_t frame_us_max;
+    uint64_t render_us;
+    uint32_t render_us_max;
+    uint64_t flush_wait_us;
+    uint32_t frames_late;
+    uint32_t frames_skipped;
+} loop_stats_t;
+
+static TaskHandle_t s_task = NULL;
+static uint32_t s_refr_period_us = 0;
+static int64_t s_awake_us = 0;          // End of the last wait
+static int64_t s_frame_start_us = 0;    // 0 outside a refresh
+static uint32_t s_frame_wait_us = 0;    // Blocked on transfers in this refresh
+
+static loop_stats_t s_stats;
+static portMUX_TYPE s_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// ============================================
+// Public Functions
+// ============================================
+
+esp_err_t display_loop_bind(uint32_t refr_period_ms)
+{
+    if (refr_period_ms == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_refr_period_us = refr_period_ms * 1000;
+    s_awake_us = esp_timer_get_time();
+    s_frame_start_us = 0;
+    s_task = xTaskGetCurrentTaskHandle();
+    return ESP_OK;
+}
+
+void display_loop_unbind(void)
+{
+    s_task = NULL;
+}
+
+bool display_loop_wait(uint32_t next_ms)
+{
+    int64_t start_us = esp_timer_get_time();
+    TickType_t ticks = (next_ms == DISPLAY_LOOP_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(next_ms);
+
+    // Notifications given during the pass are still pending and return at once
+    bool woken = ulTaskNotifyTake(pdTRUE, ticks) > 0;
+
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_stats_lock);
+    s_stats.passes++;
+    if (woken && next_ms != 0) {
+        s_stats.wakes++;
+    }
+    if (next_ms == DISPLAY_LOOP_WAIT_FOREVER) {
+        s_stats.idle_waits++;
+    }
+    s_stats.busy_us += start_us - s_awake_us;
+    s_stats.idle_us += now - start_us;
+    portEXIT_CRITICAL(&s_stats_lock);
+    s_awake_us = now;
+    return woken;
+}
+
+void display_loop_wake(void)
+{
+    TaskHandle_t task = s_task;
+    if (task && task != xTaskGetCurrentTaskHandle()) {
+        xTaskNotifyGive(task);
+    }
+}
+
+void display_loop_frame_begin(void)
+{
+    s_frame_start_us = esp_timer_get_time();
+    s_frame_wait_us = 0;
+}
+
+void display_loop_flush_wait(uint32_t us)
+{
+    s_frame_wait_us += us;
+}
+
+void display_loop_frame_end(bool drawn)
+{
+    if (s_frame_start_us == 0) {
+        return;
+    }
+    uint32_t frame_us = (uint32_t)(esp_timer_get_time() - s_frame_start_us);
+    s_frame_start_us = 0;
+    if (!drawn) {
+        return;
+    }
+    uint32_t render_us = frame_us > s_frame_wait_us ? frame_us - s_frame_wait_us : 0;
+
+    portENTER_CRITICAL(&s_stats_lock);
+    s_stats.frames++;
+    s_stats.frame_us += frame_us;
+    if (frame_us > s_stats.frame_us_max) {
+        s_stats.frame_us_max = frame_us;
+    }
+    s_stats.render_us += render_us;
+    if (render_us > s_stats.render_us_max) {
+        s_stats.render_us_max = render_us;
+    }
+    s_stats.flush_wait_us += s_frame_wait_us;
+    if (s_refr_period_us && frame_us > s_refr_period_us) {
+        // Every whole period the frame overran is a refresh the panel did not get
+        s_stats.frames_late++;
+        s_stats.frames_skipped += frame_us / s_refr_period_us;
+    }
+    portEXIT_CRITICAL(&s_stats_lock);
+}
+
+esp_err_t display_loop_get_stats(display_loop_stats_t *stats)
+{
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&s_stats_lock);
+    loop_stats_t s = s_stats;
+    portEXIT_CRITICAL(&s_stats_lock);
+
+    *stats = (display_loop_stats_t) {
+        .passes = s.passes,
+        .wakes = s.wakes,
+        .idle_waits = s.idle_waits,
+        .busy_us = s.busy_us,
+        .idle_us = s.idle_us,
+        .frames = s.frames,
+        .frame_us_avg = s.frames ? (uint32_t)(s.frame_us / s.frames) : 0,
+        .frame_us_max = s.frame_us_max,
+        .render_us_avg = s.frames ? (uint32_t)(s.render_us / s.frames) : 0,
+        .render_us_max = s.render_us_max,
+        .flush_wait_us_avg = s.frames ? (uint32_t)(s.flush_wait_us / s.frames) : 0,
+        .frames_late = s.frames_late,
+        .frames_skipped = s.frames_skipped,
+    };
+    return ESP_OK;
+}
+
+void display_loop_reset_stats(void)
+{
+    portENTER_CRITICAL(&s_stats_lock);
+    memset(&s_stats, 0, sizeof(s_stats));
+    portEXIT_CRITICAL(&s_stats_lock);
+}
@@ -0,0 +1,136 @@
+/**
+ * @file display_round.c
+ * @brief Clipping of redraw areas to a round panel
+ */
+
+#include "display_round.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+// ============================================
+// Private Variables
+// ============================================
+
+static int16_t *s_span_x1 = NULL;  // First visible column per row, the span is symmetric
+static int32_t s_diameter = 0;
+static int32_t s_band_rows = 0;
+
+// ============================================
+// Public Functions
+// ============================================
+
+esp_err_t display_round_init(int32_t diameter, int32_t band_rows)
+{
+    if (diameter <= 0 || diameter > INT16_MAX || band_rows <= 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    int16_t *span = (int16_t *)malloc(diameter * sizeof(int16_t));
+    if (span == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    float r = diameter / 2.0f;
+    for (int32_t y = 0; y < diameter; y++) {
+        // The edge of the row nearest to the center sees the widest chord
+        float dy = fminf(fabsf(y - r), fabsf(y + 1 - r));
+        float half = sqrtf(r * r - dy * dy);
+        int32_t x1 = (int32_t)floorf(r - half);
+        span[y] = (int16_t)(x1 < 0 ? 0 : x1);
+    }
+    display_round_deinit();
+    s_span_x1 = span;
+    s_diameter = diameter;
+    s_band_rows = band_rows;
+    return ESP_OK;
+}
+
+void display_round_deinit(void)
+{
+    free(s_span_x1);
+    s_span_x1 = NULL;
+    s_diameter = 0;
+}
+
+bool display_round_row_span(int32_t y, int32_t *x1, int32_t *x2)
+{
+    if (s_span_x1 == NULL || y < 0 || y >= s_diameter) {
+        return false;
+    }
+    *x1 = s_span_x1[y];
+    *x2 = s_diameter - 1 - s_span_x1[y];
+    return true;
+}
+
+bool display_round_contains(const display_round_area_t *area)
+{
+    if (s_span_x1 == NULL || area->y1 < 0 || area->y2 >= s_diameter) {
+        return false;
+    }
+    // The rows farthest from the center have the narrowest span
+    int32_t top = s_span_x1[area->y1];
+    int32_t bottom = s_span_x1[area->y2];
+    int32_t x1 = top > bottom ? top : bottom;
+    return area->x1 >= x1 && area->x2 <= s_diameter - 1 - x1;
+}
+
+bool display_round_split(display_round_area_t *area, display_round_area_t *rest)
+{
+    if (s_span_x1 == NULL || area->y1 < 0 || display_round_contains(area)) {
+        return false;
+    }
+    int32_t band_end = (area->y1 / s_band_rows + 1) * s_band_rows - 1;
+    if (area->y2 <= band_end) {
+        return false;
+    }
+    *rest = *area;
+    rest->y1 = band_end + 1;
+    area->y2 = band_end;
+    return true;
+}
+
+bool display_round_clip(display_round_area_t *area)
+{
+    if (s_span_x1 == NULL || display_round_contains(area)) {
+        return true;
+    }
+    int32_t y1 = area->y1 < 0 ? 0 : area->y1;
+    int32_t y2 = area->y2 >= s_diameter ? s_diameter - 1 : area->y2;
+    if (y1 > y2) {
+        return false;
+    }
+    // The row nearest to the center has the widest span
+    int32_t y = (y1 <= s_diameter / 2 && s_diameter / 2 <= y2) ? s_diameter / 2 :
+                (y2 < s_diameter / 2 ? y2 : y1);
+    int32_t x1 = s_span_x1[y];
+    int32_t x2 = s_diameter - 1 - x1;
+    x1 = area->x1 > x1 ? area->x1 : x1;
+    x2 = area->x2 < x2 ? area->x2 : x2;
+    if (x1 > x2) {
+        return false;
+    }
+    area->x1 = x1 & ~1;
+    area->x2 = x2 | 1;
+    if (area->x2 >= s_diameter) {
+        area->x2 = s_diameter - 1;
+    }
+    return true;
+}
+
+bool display_round_min_area(display_round_area_t *area)
+{
+    if (s_span_x1 == NULL) {
+        return false;
+    }
+    int32_t y1 = area->y1 < 0 ? 0 : area->y1;
+    int32_t y2 = area->y2 >= s_diameter ? s_diameter - 1 : area->y2;
+    if (y1 > y2) {
+        return false;
+    }
+    int32_t y = (y1 <= s_diameter / 2 && s_diameter / 2 <= y2) ? s_diameter / 2 :
+                (y2 < s_diameter / 2 ? y2 : y1);
+    area->x1 = s_span_x1[y] & ~1;
+    area->x2 = area->x1 + 1;
+    area->y1 = y;
+    area->y2 = y;
+    return true;
+}
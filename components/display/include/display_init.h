@@ -9,6 +9,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 #include "esp_err.h"
 #include "lvgl.h"
 
@@ -38,10 +39,38 @@ extern "C" {
 // Reduced buffer height to free internal RAM for audio pipeline
 // 466 * 30 * 2 = 27,960 bytes per buffer (RGB565)
 #define DISPLAY_LVGL_BUF_HEIGHT 30  // ~30 lines per buffer
-#define DISPLAY_LVGL_TICK_MS    2
 #define DISPLAY_LVGL_TASK_STACK (8 * 1024)
 #define DISPLAY_LVGL_TASK_PRIO  2
 
+// ============================================
+// Types
+// ============================================
+
+/**
+ * @brief Display flush statistics
+ */
+typedef struct {
+    uint32_t fps;               // Frames completed in the last second (0 when idle)
+    uint32_t frames;            // Frames completed
+    uint32_t flushes;           // Areas flushed
+    uint32_t flush_cpu_us_avg;  // CPU time per flush callback (byte swap and queueing)
+    uint32_t flush_cpu_us_max;
+    uint32_t transfer_us_avg;   // Area queued to its QSPI transfer done
+    uint32_t te_waits;          // Frames started on a TE pulse
+    uint32_t te_timeouts;       // Frames started without one
+    uint32_t frame_us_avg;      // LVGL refresh start to the last area queued
+    uint32_t frame_us_max;
+    uint32_t render_us_avg;     // Refresh time not spent waiting for a transfer
+    uint32_t render_us_max;
+    uint32_t flush_wait_us_avg; // Per frame, LVGL blocked on a transfer (core free)
+    uint32_t frames_late;       // Frames longer than the LVGL refresh period
+    uint32_t frames_skipped;    // Refresh periods missed by late frames
+    uint32_t loop_passes;       // LVGL task passes
+    uint32_t loop_wakes;        // Passes started by display_unlock() from another task
+    uint32_t loop_idle_waits;   // Sleeps with no LVGL timer pending
+    uint32_t loop_busy_pct;     // Share of time the LVGL task was awake
+} display_stats_t;
+
 // ============================================
 // Public Functions
 // ============================================
@@ -52,9 +81,7 @@ extern "C" {
  * This initializes:
  * - QSPI bus for LCD
  * - SH8601 panel driver
- * - LVGL library
- * - LVGL tick timer
- * - LVGL task
+ * - LVGL library (tick read from esp_timer)
  *
  * @return ESP_OK on success, error code otherwise
  */
@@ -84,6 +111,9 @@ bool display_lock(int timeout_ms);
 
 /**
  * @brief Unlock LVGL mutex
+ *
+ * Also wakes the LVGL task, which sleeps while nothing is pending, so
+ * changes made under the lock are rendered without polling.
  */
 void display_unlock(void);
 
@@ -91,6 +121,8 @@ void display_unlock(void);
  * @brief Start LVGL task
  *
  * Must be called after display_init() to start the LVGL rendering task.
+ * It runs only when an LVGL timer is due or the UI was changed under
+ * display_lock().
  *
  * @return ESP_OK on success
  */
@@ -104,6 +136,19 @@ esp_err_t display_start_task(void);
  */
 esp_err_t display_power(bool on);
 
+/**
+ * @brief Get display flush statistics
+ *
+ * @param stats Output statistics
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if stats is NULL
+ */
+esp_err_t display_get_stats(display_stats_t *stats);
+
+/**
+ * @brief Reset display flush statistics
+ */
+void display_reset_stats(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,115 @@
+/**
+ * @file display_loop.h
+ * @brief Event-driven pacing and frame telemetry for the LVGL task
+ *
+ * The LVGL task sleeps until its next timer is due or until another task
+ * changed the UI (display_unlock wakes it), instead of polling. When no
+ * timer is pending at all (static page, no animation, nothing invalid) it
+ * blocks until the next wake, with no tick and no periodic pass.
+ *
+ * Each refresh is timed: render time, time blocked on the transfer of the
+ * previous area, and refresh periods missed by frames that ran late.
+ *
+ * Independent of LVGL so the host tools can use it.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Wait until woken (as LV_NO_TIMER_READY)
+ */
+#define DISPLAY_LOOP_WAIT_FOREVER   UINT32_MAX
+
+/**
+ * @brief Render loop statistics
+ */
+typedef struct {
+    uint32_t passes;            // Timer handler passes
+    uint32_t wakes;             // Passes started by display_loop_wake() before the timer was due
+    uint32_t idle_waits;        // Waits with no timer pending (blocked until woken)
+    uint64_t busy_us;           // Time awake between waits
+    uint64_t idle_us;           // Time blocked in display_loop_wait()
+    uint32_t frames;            // Refreshes that flushed at least one area
+    uint32_t frame_us_avg;      // Refresh start to the last area queued
+    uint32_t frame_us_max;
+    uint32_t render_us_avg;     // Refresh time not spent waiting for a transfer
+    uint32_t render_us_max;
+    uint32_t flush_wait_us_avg; // Per frame, time blocked on a transfer (core free)
+    uint32_t frames_late;       // Frames longer than the refresh period
+    uint32_t frames_skipped;    // Refresh periods missed by late frames
+} display_loop_stats_t;
+
+/**
+ * @brief Bind the loop to the calling task
+ *
+ * Call from the render task before its first display_loop_wait().
+ *
+ * @param refr_period_ms Refresh period frames are measured against (LV_DEF_REFR_PERIOD)
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if the period is 0
+ */
+esp_err_t display_loop_bind(uint32_t refr_period_ms);
+
+/**
+ * @brief Forget the render task (it was deleted)
+ */
+void display_loop_unbind(void);
+
+/**
+ * @brief Block the render task until its next timer or a wake
+ *
+ * @param next_ms Milliseconds until the next timer is due, DISPLAY_LOOP_WAIT_FOREVER for none
+ * @return true if woken before next_ms elapsed
+ */
+bool display_loop_wait(uint32_t next_ms);
+
+/**
+ * @brief Wake the render task for a pass
+ *
+ * Called after another task changed the UI. No-op from the render task
+ * itself and before display_loop_bind().
+ */
+void display_loop_wake(void);
+
+/**
+ * @brief Mark the start of a refresh (LV_EVENT_REFR_START)
+ */
+void display_loop_frame_begin(void);
+
+/**
+ * @brief Account time the refresh was blocked on a transfer
+ *
+ * @param us Microseconds waited
+ */
+void display_loop_flush_wait(uint32_t us);
+
+/**
+ * @brief Mark the end of a refresh (LV_EVENT_REFR_READY)
+ *
+ * @param drawn false if the refresh found nothing to draw; it is not counted
+ */
+void display_loop_frame_end(bool drawn);
+
+/**
+ * @brief Get render loop statistics
+ *
+ * @param stats Output statistics
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if stats is NULL
+ */
+esp_err_t display_loop_get_stats(display_loop_stats_t *stats);
+
+/**
+ * @brief Reset render loop statistics
+ */
+void display_loop_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
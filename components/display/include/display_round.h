@@ -0,0 +1,104 @@
+/**
+ * @file display_round.h
+ * @brief Clipping of redraw areas to a round panel
+ *
+ * The AMOLED is a 466x466 circle; the corners of every rectangular area
+ * are never visible. Invalidated areas are cut into bands of a few rows
+ * and each band is narrowed to the widest visible span of its rows, so
+ * LVGL renders and the flush transfers little outside the circle.
+ *
+ * Independent of LVGL so the host tools can use it.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Area with inclusive corners, as lv_area_t
+ */
+typedef struct {
+    int32_t x1;
+    int32_t y1;
+    int32_t x2;
+    int32_t y2;
+} display_round_area_t;
+
+/**
+ * @brief Set up the visible span of every row
+ *
+ * @param diameter  Panel width and height in pixels
+ * @param band_rows Rows per band (areas are cut at multiples of it)
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG or ESP_ERR_NO_MEM
+ */
+esp_err_t display_round_init(int32_t diameter, int32_t band_rows);
+
+/**
+ * @brief Free the span table
+ */
+void display_round_deinit(void);
+
+/**
+ * @brief Get the visible columns of a row
+ *
+ * Columns of pixels the circle touches at all are included.
+ *
+ * @param y  Row
+ * @param x1 First visible column
+ * @param x2 Last visible column
+ * @return false if not initialized or the row is outside the panel
+ */
+bool display_round_row_span(int32_t y, int32_t *x1, int32_t *x2);
+
+/**
+ * @brief Check whether an area lies entirely on the circle
+ *
+ * @param area Area to check
+ * @return true if every pixel of the area is visible
+ */
+bool display_round_contains(const display_round_area_t *area);
+
+/**
+ * @brief Cut an area at the end of its first band
+ *
+ * Areas entirely on the circle are not cut.
+ *
+ * @param area Area, left with the rows of its first band
+ * @param rest Rows below the first band, when there are any
+ * @return true if rest was set
+ */
+bool display_round_split(display_round_area_t *area, display_round_area_t *rest);
+
+/**
+ * @brief Narrow an area to the visible columns of its rows
+ *
+ * The result starts on an even column and has an even width, as the panel
+ * requires for column windows. Areas entirely on the circle are unchanged.
+ *
+ * @param area Area to clip, unchanged when nothing of it is visible
+ * @return false if no pixel of the area is visible
+ */
+bool display_round_clip(display_round_area_t *area);
+
+/**
+ * @brief Shrink an area to the smallest redraw on the circle within its rows
+ *
+ * For an area display_round_clip() finds nothing visible in: one row, two
+ * columns wide from an even column, at the first visible column of the row
+ * nearest to the center. LVGL cannot drop an area from its invalidate hook,
+ * and an empty area is not safe to render, so this is what is left instead.
+ *
+ * @param area Area to shrink, unchanged when none of its rows is on the panel
+ * @return false if not initialized or none of the rows is on the panel
+ */
+bool display_round_min_area(display_round_area_t *area);
+
+#ifdef __cplusplus
+}
+#endif
@@ -142,6 +142,9 @@ int esp_capture_text_overlay_draw_text_fmt(esp_capture_overlay_if_t *h, esp_capt
 /**
  * @brief  Indicate draw text finished
  *
+ * @note  Draws since `esp_capture_text_overlay_draw_start` are rendered here. When they repeat the previous
+ *        draws with only some characters changed, only the changed character cells are redrawn
+ *
  * @param[in]  h  Text overlay instance
  *
  * @return
@@ -165,6 +168,23 @@ int esp_capture_text_overlay_draw_finished(esp_capture_overlay_if_t *h);
  */
 int esp_capture_text_overlay_clear(esp_capture_overlay_if_t *h, esp_capture_rgn_t *rgn, uint16_t color);
 
+/**
+ * @brief  Take the regions of the overlay frame changed since the last call
+ *
+ * @note  Call it between `acquire_frame` and `release_frame` of the overlay so that the regions match the frame.
+ *        A mixer that keeps the overlay converted (e.g. to YUV) can convert only these regions again
+ *
+ * @param[in]   h        Text overlay instance
+ * @param[out]  rgn      Changed regions
+ * @param[in]   max_num  Size of `rgn`, regions beyond it are merged into the last one
+ *
+ * @return
+ *       - >= 0                           Number of changed regions
+ *       - ESP_CAPTURE_ERR_INVALID_ARG    Invalid argument
+ *       - ESP_CAPTURE_ERR_NOT_SUPPORTED  Not supported action for not open yet
+ */
+int esp_capture_text_overlay_take_dirty(esp_capture_overlay_if_t *h, esp_capture_rgn_t *rgn, int max_num);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -1389,7 +1389,7 @@ int esp_capture_set_path_bitrate(esp_capture_path_handle_t h, esp_capture_stream
     esp_capture_path_set_type_t type = ESP_CAPTURE_PATH_SET_TYPE_NONE;
     if (stream_type == ESP_CAPTURE_STREAM_TYPE_VIDEO) {
         type = ESP_CAPTURE_PATH_SET_TYPE_VIDEO_BITRATE;
-    } else if (stream_type == ESP_CAPTURE_STREAM_TYPE_VIDEO) {
+    } else if (stream_type == ESP_CAPTURE_STREAM_TYPE_AUDIO) {
         type = ESP_CAPTURE_PATH_SET_TYPE_AUDIO_BITRATE;
     }
     int ret = capture->cfg.capture_path->set(capture->cfg.capture_path, path->path_type, type, &bitrate, sizeof(uint32_t));
@@ -23,6 +23,7 @@
  */
 
 #include <stdlib.h>
+#include <stdatomic.h>
 #include "esp_audio_enc_default.h"
 #include "esp_capture_types.h"
 #include "esp_capture_aenc_if.h"
@@ -30,6 +31,7 @@
 
 #define TAG                              "CAPTURE_AENC"
 #define CAPTURE_AENC_DEF_FRAME_DURATION  (20) // Default audio frame duration
+#define CAPTURE_AENC_DEF_BITRATE         (90000)
 
 typedef struct {
     esp_capture_aenc_if_t    base;
@@ -37,6 +39,7 @@ typedef struct {
     bool                     started;
     esp_capture_audio_info_t info;
     int                      bitrate;
+    atomic_int               pending_bitrate; // Set by any thread, applied by the encoding one; 0: none
     int                      in_frame_size;
     int                      out_frame_size;
     esp_audio_enc_handle_t   aenc_handle;
@@ -58,15 +61,18 @@ typedef union {
     cfg->channel         = info->channel;          \
 }
 
-static int get_encoder_config(esp_audio_enc_config_t *enc_cfg, esp_capture_audio_info_t *info)
+static int get_encoder_config(esp_audio_enc_config_t *enc_cfg, esp_capture_audio_info_t *info, int bitrate)
 {
+    if (bitrate <= 0) {
+        bitrate = CAPTURE_AENC_DEF_BITRATE;
+    }
     enc_all_cfg_t *all_cfg = (enc_all_cfg_t *)(enc_cfg->cfg);
     switch (info->codec) {
         case ESP_CAPTURE_CODEC_TYPE_AAC: {
             esp_aac_enc_config_t *cfg = &all_cfg->aac_cfg;
             ASSIGN_BASIC_CFG(cfg);
             enc_cfg->cfg_sz = sizeof(esp_aac_enc_config_t);
-            cfg->bitrate = 90000;
+            cfg->bitrate = bitrate;
             cfg->adts_used = true;
             break;
         }
@@ -82,7 +88,7 @@ static int get_encoder_config(esp_audio_enc_config_t *enc_cfg, esp_capture_audio
             esp_opus_enc_config_t *cfg = &all_cfg->opus_cfg;
             ASSIGN_BASIC_CFG(cfg);
             enc_cfg->cfg_sz = sizeof(esp_opus_enc_config_t);
-            cfg->bitrate = 90000;
+            cfg->bitrate = bitrate;
             cfg->frame_duration = ESP_OPUS_ENC_FRAME_DURATION_20_MS;
             cfg->application_mode = ESP_OPUS_ENC_APPLICATION_AUDIO;
             break;
@@ -174,8 +180,10 @@ static int general_aenc_start(esp_capture_aenc_if_t *h, esp_capture_audio_info_t
         .type = get_audio_codec_type(info->codec),
         .cfg = &all_cfg,
     };
+    // Opened at aenc->bitrate already
+    atomic_store(&aenc->pending_bitrate, 0);
     // Get encoder configuration
-    if (get_encoder_config(&enc_cfg, info) != 0) {
+    if (get_encoder_config(&enc_cfg, info, aenc->bitrate) != 0) {
         ESP_LOGE(TAG, "Fail to get encoder config");
         return ESP_CAPTURE_ERR_NOT_SUPPORTED;
     }
@@ -198,6 +206,9 @@ static int general_aenc_set_bitrate(esp_capture_aenc_if_t *h, int bitrate)
         return ESP_CAPTURE_ERR_INVALID_ARG;
     }
     aenc->bitrate = bitrate;
+    // Called from the stats thread while the capture thread may be encoding:
+    // a running encoder takes the new bitrate before its next frame, otherwise it applies on start
+    atomic_store(&aenc->pending_bitrate, bitrate);
     return ESP_CAPTURE_ERR_OK;
 }
 
@@ -215,6 +226,13 @@ static int general_aenc_encode_frame(esp_capture_aenc_if_t *h, esp_capture_strea
                  aenc->in_frame_size, raw->size, aenc->out_frame_size, encoded->size);
         return ESP_CAPTURE_ERR_INVALID_ARG;
     }
+    int bitrate = atomic_exchange(&aenc->pending_bitrate, 0);
+    if (bitrate > 0) {
+        int ret = esp_audio_enc_set_bitrate(aenc->aenc_handle, bitrate);
+        if (ret != ESP_AUDIO_ERR_OK) {
+            ESP_LOGW(TAG, "Fail to set bitrate %d ret %d", bitrate, ret);
+        }
+    }
     esp_audio_enc_in_frame_t in_frame = {
         .buffer = raw->data,
         .len = raw->size,
@@ -27,11 +27,91 @@
 #include "esp_painter_font.h"
 #include "esp_log.h"
 #include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
 
 #define TAG "TEXT_OVERLAY"
 
 #define RGN_OVERFLOW(base, rgn) ((rgn)->x + (rgn)->width > base->width || (rgn)->y + (rgn)->height > base->height)
 
+/*
+ * Drawing between draw_start and draw_finished is recorded as a list of
+ * clear and text operations and rendered at draw_finished. When the list
+ * has the same operations as the previous one and only the strings differ
+ * (a clock or a caption being updated), only the character cells that
+ * changed are repainted, by replaying the list clipped to each cell; every
+ * operation writes constant pixels, so the result equals a full redraw.
+ * Repainted areas are kept as dirty regions for the overlay mixer.
+ *
+ * Glyphs are drawn from spans of set pixels per row. The fonts are packed
+ * in flash (esp_painter_font.h); a glyph is decoded into spans on first
+ * use and kept in a small least recently used cache, so a draw reads no
+ * font data unless it meets a glyph it has not drawn lately.
+ */
+
+#ifndef CONFIG_ESP_PAINTER_GLYPH_CACHE_SIZE
+#define CONFIG_ESP_PAINTER_GLYPH_CACHE_SIZE 32
+#endif
+
+#define TEXT_MAX_FONTS     (4)
+#define TEXT_GLYPH_CACHE   CONFIG_ESP_PAINTER_GLYPH_CACHE_SIZE
+#define TEXT_GLYPH_NONE    (0xFF)
+#define TEXT_MAX_OPS       (16)
+#define TEXT_ARENA_SIZE    (512)
+#define TEXT_MAX_REPAINT   (32)
+#define TEXT_MAX_DIRTY     (8)
+
+typedef struct {
+    uint8_t x;
+    uint8_t len;
+} glyph_span_t;
+
+typedef struct {
+    const esp_painter_basic_font_t *font;
+    uint8_t                        *slot;       // Per glyph, its cache entry or TEXT_GLYPH_NONE
+} font_map_t;
+
+typedef struct {
+    uint8_t       font_idx;                     // TEXT_GLYPH_NONE when unused
+    uint8_t       glyph;
+    uint32_t      last_use;
+    uint16_t     *row_start;                    // Per box row, index of its first span; one extra at the end
+    glyph_span_t *spans;                        // x within the cell; same block as row_start
+} glyph_entry_t;
+
+typedef enum {
+    TEXT_OP_CLEAR,
+    TEXT_OP_TEXT,
+} text_op_type_t;
+
+typedef struct {
+    text_op_type_t                       type;
+    esp_capture_rgn_t                    rgn;     // Clear region
+    uint16_t                             color;   // Clear color
+    esp_capture_text_overlay_draw_info_t info;    // Text settings
+    const esp_painter_basic_font_t      *font;
+    uint8_t                              font_idx;
+    uint16_t                             str_off;
+    uint16_t                             str_len;
+} text_op_t;
+
+typedef struct {
+    text_op_t ops[TEXT_MAX_OPS];
+    int       op_num;
+    char      arena[TEXT_ARENA_SIZE];
+    int       arena_used;
+    bool      overflow;  // Did not fit, render it in full
+} text_list_t;
+
+typedef struct {
+    const char *str;
+    int         len;
+    int         pos;
+    uint32_t    x;
+    uint32_t    y;
+} text_layout_t;
+
 typedef struct {
     esp_capture_overlay_if_t   base;
     esp_capture_codec_type_t   codec;
@@ -40,58 +120,540 @@ typedef struct {
     media_lib_mutex_handle_t   mutex;
     bool                       opened;
     uint8_t                    alpha;
+    font_map_t                 fonts[TEXT_MAX_FONTS];
+    glyph_entry_t              glyph_cache[TEXT_GLYPH_CACHE];
+    uint32_t                   glyph_clock;
+    text_list_t                lists[2];
+    uint8_t                    cur;         // List being recorded, the other is the last rendered
+    bool                       recording;
+    bool                       prev_valid;
+    esp_capture_rgn_t          repaint[TEXT_MAX_REPAINT];
+    int                        repaint_num;
+    esp_capture_rgn_t          dirty[TEXT_MAX_DIRTY];
+    int                        dirty_num;
 } text_overlay_t;
 
 static int text_overlay_close(esp_capture_overlay_if_t *h);
 
 const esp_painter_basic_font_t *get_font(uint16_t font_size)
 {
-    switch (font_size) {
-        default:
-            return NULL;
-#if CONFIG_ESP_PAINTER_BASIC_FONT_12
-        case 12:
-            return &esp_painter_basic_font_12;
-#endif
-#if CONFIG_ESP_PAINTER_BASIC_FONT_16
-        case 16:
-            return &esp_painter_basic_font_16;
-#endif
-#if CONFIG_ESP_PAINTER_BASIC_FONT_20
-        case 20:
-            return &esp_painter_basic_font_20;
-#endif
-#if CONFIG_ESP_PAINTER_BASIC_FONT_24
-        case 24:
-            return &esp_painter_basic_font_24;
-#endif
-#if CONFIG_ESP_PAINTER_BASIC_FONT_28
-        case 28:
-            return &esp_painter_basic_font_28;
-#endif
-#if CONFIG_ESP_PAINTER_BASIC_FONT_32
-        case 32:
-            return &esp_painter_basic_font_32;
-#endif
-#if CONFIG_ESP_PAINTER_BASIC_FONT_36
-        case 36:
-            return &esp_painter_basic_font_36;
-#endif
-#if CONFIG_ESP_PAINTER_BASIC_FONT_40
-        case 40:
-            return &esp_painter_basic_font_40;
-#endif
-#if CONFIG_ESP_PAINTER_BASIC_FONT_44
-        case 44:
-            return &esp_painter_basic_font_44;
-#endif
-#if CONFIG_ESP_PAINTER_BASIC_FONT_48
-        case 48:
-            return &esp_painter_basic_font_48;
-#endif
+    for (int i = 0; esp_painter_basic_fonts[i]; i++) {
+        if (esp_painter_basic_fonts[i]->height == font_size) {
+            return esp_painter_basic_fonts[i];
+        }
+    }
+    return NULL;
+}
+
+// ============================================
+// Glyph Cache
+// ============================================
+
+typedef struct {
+    const esp_painter_glyph_t *glyph;
+    uint16_t                  *row_start;  // NULL to count spans only
+    glyph_span_t              *spans;
+    uint32_t                   span_num;
+    uint32_t                   pos;        // Pixels of the box done, row-major
+    uint32_t                   row;        // Rows whose first span is known
+} span_builder_t;
+
+/**
+ * @brief Add a run of pixels of the glyph's box, split into spans at row ends
+ */
+static void span_builder_run(span_builder_t *b, bool set, uint32_t len)
+{
+    const uint32_t w = b->glyph->box_w;
+    while (len) {
+        uint32_t y = b->pos / w;
+        uint32_t x = b->pos % w;
+        uint32_t n = w - x < len ? w - x : len;
+        if (set) {
+            if (b->row_start) {
+                while (b->row <= y) {
+                    b->row_start[b->row++] = (uint16_t)b->span_num;
+                }
+                b->spans[b->span_num] = (glyph_span_t) { (uint8_t)(b->glyph->box_x + x), (uint8_t)n };
+            }
+            b->span_num++;
+        }
+        b->pos += n;
+        len -= n;
+    }
+}
+
+/**
+ * @brief Decode a packed glyph into spans, or only count them
+ */
+static uint32_t glyph_decode(const esp_painter_basic_font_t *font, const esp_painter_glyph_t *glyph,
+                             uint16_t *row_start, glyph_span_t *spans)
+{
+    span_builder_t b = { .glyph = glyph, .row_start = row_start, .spans = spans };
+    const uint32_t total = (uint32_t)glyph->box_w * glyph->box_h;
+    const uint8_t *data = font->bitmap + (glyph->offset & ~ESP_PAINTER_GLYPH_RLE);
+    if (glyph->offset & ESP_PAINTER_GLYPH_RLE) {
+        // Nibble runs, alternating unset / set from unset
+        bool set = false;
+        uint32_t run = 0;
+        for (uint32_t nib = 0; b.pos < total; nib++) {
+            uint8_t v = (data[nib >> 1] >> ((nib & 1) ? 0 : 4)) & 0xF;
+            run += v;
+            if (v == 0xF) {
+                continue;
+            }
+            span_builder_run(&b, set, run < total - b.pos ? run : total - b.pos);
+            set = !set;
+            run = 0;
+        }
+    } else {
+        uint32_t i = 0;
+        while (i < total) {
+            bool set = (data[i >> 3] & (0x80 >> (i & 7))) != 0;
+            uint32_t start = i;
+            while (i < total && ((data[i >> 3] & (0x80 >> (i & 7))) != 0) == set) {
+                i++;
+            }
+            span_builder_run(&b, set, i - start);
+        }
+    }
+    if (row_start) {
+        while (b.row <= glyph->box_h) {
+            row_start[b.row++] = (uint16_t)b.span_num;
+        }
+    }
+    return b.span_num;
+}
+
+static void glyph_entry_free(text_overlay_t *text_overlay, glyph_entry_t *entry)
+{
+    if (entry->font_idx != TEXT_GLYPH_NONE) {
+        text_overlay->fonts[entry->font_idx].slot[entry->glyph] = TEXT_GLYPH_NONE;
+    }
+    free(entry->row_start);
+    entry->row_start = NULL;
+    entry->spans = NULL;
+    entry->font_idx = TEXT_GLYPH_NONE;
+}
+
+/**
+ * @brief Decoded spans of a glyph, from the cache or decoded into its least recently used entry
+ */
+static const glyph_entry_t *get_glyph(text_overlay_t *text_overlay, uint8_t font_idx, uint8_t glyph)
+{
+    font_map_t *map = &text_overlay->fonts[font_idx];
+    uint8_t slot = map->slot[glyph];
+    if (slot != TEXT_GLYPH_NONE) {
+        text_overlay->glyph_cache[slot].last_use = ++text_overlay->glyph_clock;
+        return &text_overlay->glyph_cache[slot];
+    }
+    slot = 0;
+    for (int i = 0; i < TEXT_GLYPH_CACHE; i++) {
+        glyph_entry_t *e = &text_overlay->glyph_cache[i];
+        if (e->font_idx == TEXT_GLYPH_NONE) {
+            slot = (uint8_t)i;
+            break;
+        }
+        if (e->last_use < text_overlay->glyph_cache[slot].last_use) {
+            slot = (uint8_t)i;
+        }
+    }
+    glyph_entry_t *entry = &text_overlay->glyph_cache[slot];
+    glyph_entry_free(text_overlay, entry);
+
+    const esp_painter_glyph_t *g = &map->font->glyphs[glyph];
+    uint32_t span_num = glyph_decode(map->font, g, NULL, NULL);
+    size_t rows_size = (g->box_h + 1) * sizeof(uint16_t);
+    entry->row_start = (uint16_t *)malloc(rows_size + span_num * sizeof(glyph_span_t));
+    if (entry->row_start == NULL) {
+        ESP_LOGE(TAG, "No memory for a glyph");
+        return NULL;
+    }
+    entry->spans = (glyph_span_t *)((uint8_t *)entry->row_start + rows_size);
+    glyph_decode(map->font, g, entry->row_start, entry->spans);
+    entry->font_idx = font_idx;
+    entry->glyph = glyph;
+    entry->last_use = ++text_overlay->glyph_clock;
+    map->slot[glyph] = slot;
+    return entry;
+}
+
+/**
+ * @brief Index of a font in the glyph cache, adding the font on first use
+ */
+static int get_font_idx(text_overlay_t *text_overlay, uint16_t font_size)
+{
+    const esp_painter_basic_font_t *font = get_font(font_size);
+    if (font == NULL) {
+        return -1;
+    }
+    for (int i = 0; i < TEXT_MAX_FONTS; i++) {
+        font_map_t *map = &text_overlay->fonts[i];
+        if (map->font == font) {
+            return i;
+        }
+        if (map->font == NULL) {
+            map->slot = (uint8_t *)malloc(font->count);
+            if (map->slot == NULL) {
+                return -1;
+            }
+            memset(map->slot, TEXT_GLYPH_NONE, font->count);
+            map->font = font;
+            return i;
+        }
+    }
+    ESP_LOGE(TAG, "More than %d font sizes in use", TEXT_MAX_FONTS);
+    return -1;
+}
+
+static void glyph_cache_init(text_overlay_t *text_overlay)
+{
+    for (int i = 0; i < TEXT_GLYPH_CACHE; i++) {
+        text_overlay->glyph_cache[i].font_idx = TEXT_GLYPH_NONE;
+    }
+}
+
+static void glyph_cache_free(text_overlay_t *text_overlay)
+{
+    for (int i = 0; i < TEXT_GLYPH_CACHE; i++) {
+        glyph_entry_free(text_overlay, &text_overlay->glyph_cache[i]);
+    }
+    for (int i = 0; i < TEXT_MAX_FONTS; i++) {
+        free(text_overlay->fonts[i].slot);
+    }
+    memset(text_overlay->fonts, 0, sizeof(text_overlay->fonts));
+    text_overlay->glyph_clock = 0;
+    glyph_cache_init(text_overlay);
+}
+
+// ============================================
+// Rendering
+// ============================================
+
+static bool rgn_intersect(const esp_capture_rgn_t *a, const esp_capture_rgn_t *b, esp_capture_rgn_t *out)
+{
+    uint32_t x0 = a->x > b->x ? a->x : b->x;
+    uint32_t y0 = a->y > b->y ? a->y : b->y;
+    uint32_t x1 = a->x + a->width < b->x + b->width ? a->x + a->width : b->x + b->width;
+    uint32_t y1 = a->y + a->height < b->y + b->height ? a->y + a->height : b->y + b->height;
+    if (x0 >= x1 || y0 >= y1) {
+        return false;
+    }
+    *out = (esp_capture_rgn_t) { .x = x0, .y = y0, .width = x1 - x0, .height = y1 - y0 };
+    return true;
+}
+
+static void rgn_union(esp_capture_rgn_t *a, const esp_capture_rgn_t *b)
+{
+    if (a->width == 0 || a->height == 0) {
+        *a = *b;
+        return;
+    }
+    uint32_t x1 = a->x + a->width > b->x + b->width ? a->x + a->width : b->x + b->width;
+    uint32_t y1 = a->y + a->height > b->y + b->height ? a->y + a->height : b->y + b->height;
+    a->x = a->x < b->x ? a->x : b->x;
+    a->y = a->y < b->y ? a->y : b->y;
+    a->width = x1 - a->x;
+    a->height = y1 - a->y;
+}
+
+static void fill_rect(text_overlay_t *text_overlay, const esp_capture_rgn_t *rgn, uint16_t color)
+{
+    uint16_t *v = (uint16_t *)text_overlay->frame.data + (rgn->y * text_overlay->rgn.width + rgn->x);
+    bool pure_color = (color >> 8) == (color & 0xFF);
+    for (uint32_t i = 0; i < rgn->height; i++) {
+        if (pure_color) {
+            memset(v, color & 0xFF, rgn->width * 2);
+        } else {
+            for (uint32_t j = 0; j < rgn->width; j++) {
+                v[j] = color;
+            }
+        }
+        v += text_overlay->rgn.width;
+    }
+}
+
+/**
+ * @brief Next drawn character of a string: lines break on '\n' and at the region's right edge
+ */
+static bool layout_next(text_overlay_t *text_overlay, const text_op_t *op, text_layout_t *l, char *c)
+{
+    const esp_painter_basic_font_t *font = op->font;
+    while (l->pos < l->len) {
+        char ch = l->str[l->pos];
+        if (ch == '\n' || l->x + font->width > text_overlay->rgn.width) {
+            l->y += font->height;
+            l->x = op->info.x;
+            if (l->y + font->height > text_overlay->rgn.height) {
+                l->pos = l->len;
+                return false;
+            }
+            if (ch == '\n') {
+                l->pos++;
+            }
+            continue;
+        }
+        *c = ch;
+        return true;
     }
+    return false;
 }
 
+static void layout_advance(const text_op_t *op, text_layout_t *l)
+{
+    l->x += op->font->width;
+    l->pos++;
+}
+
+static void layout_init(text_layout_t *l, const text_list_t *list, const text_op_t *op)
+{
+    *l = (text_layout_t) {
+        .str = list->arena + op->str_off,
+        .len = op->str_len,
+        .x = op->info.x,
+        .y = op->info.y,
+    };
+}
+
+static void draw_glyph(text_overlay_t *text_overlay, const text_op_t *op, char c, uint32_t x, uint32_t y,
+                       const esp_capture_rgn_t *clip)
+{
+    const esp_painter_basic_font_t *font = op->font;
+    uint8_t idx = (uint8_t)c - font->first;
+    if ((uint8_t)c < font->first || idx >= font->count || font->glyphs[idx].box_w == 0) {
+        return;
+    }
+    const glyph_entry_t *glyph = get_glyph(text_overlay, op->font_idx, idx);
+    if (glyph == NULL) {
+        return;
+    }
+    // Rows of the glyph's box inside the clip
+    const int box_y = font->glyphs[idx].box_y;
+    const int box_h = font->glyphs[idx].box_h;
+    int r0 = clip->y > y + box_y ? (int)(clip->y - y - box_y) : 0;
+    int r1 = clip->y + clip->height < y + box_y + box_h ? (int)(clip->y + clip->height - y - box_y) : box_h;
+    uint32_t cx0 = clip->x;
+    uint32_t cx1 = clip->x + clip->width;
+    uint16_t *row = (uint16_t *)text_overlay->frame.data + (y + box_y + r0) * text_overlay->rgn.width;
+    for (int r = r0; r < r1; r++) {
+        for (uint32_t s = glyph->row_start[r]; s < glyph->row_start[r + 1]; s++) {
+            uint32_t x0 = x + glyph->spans[s].x;
+            uint32_t x1 = x0 + glyph->spans[s].len;
+            x0 = x0 > cx0 ? x0 : cx0;
+            x1 = x1 < cx1 ? x1 : cx1;
+            for (uint32_t px = x0; px < x1; px++) {
+                row[px] = op->info.color;
+            }
+        }
+        row += text_overlay->rgn.width;
+    }
+}
+
+static void render_op(text_overlay_t *text_overlay, const text_list_t *list, const text_op_t *op,
+                      const esp_capture_rgn_t *clip)
+{
+    if (op->type == TEXT_OP_CLEAR) {
+        esp_capture_rgn_t part;
+        if (rgn_intersect(&op->rgn, clip, &part)) {
+            fill_rect(text_overlay, &part, op->color);
+        }
+        return;
+    }
+    const esp_painter_basic_font_t *font = op->font;
+    text_layout_t l;
+    layout_init(&l, list, op);
+    char c;
+    while (layout_next(text_overlay, op, &l, &c)) {
+        esp_capture_rgn_t cell = { .x = l.x, .y = l.y, .width = font->width, .height = font->height };
+        esp_capture_rgn_t part;
+        if (rgn_intersect(&cell, clip, &part)) {
+            draw_glyph(text_overlay, op, c, l.x, l.y, &part);
+        }
+        layout_advance(op, &l);
+    }
+}
+
+static void op_bounds(text_overlay_t *text_overlay, const text_list_t *list, const text_op_t *op,
+                      esp_capture_rgn_t *bounds)
+{
+    if (op->type == TEXT_OP_CLEAR) {
+        rgn_union(bounds, &op->rgn);
+        return;
+    }
+    const esp_painter_basic_font_t *font = op->font;
+    text_layout_t l;
+    layout_init(&l, list, op);
+    char c;
+    while (layout_next(text_overlay, op, &l, &c)) {
+        esp_capture_rgn_t cell = { .x = l.x, .y = l.y, .width = font->width, .height = font->height };
+        rgn_union(bounds, &cell);
+        layout_advance(op, &l);
+    }
+}
+
+static void add_dirty(text_overlay_t *text_overlay, const esp_capture_rgn_t *rgn)
+{
+    if (text_overlay->dirty_num < TEXT_MAX_DIRTY) {
+        text_overlay->dirty[text_overlay->dirty_num++] = *rgn;
+        return;
+    }
+    // Out of entries: fold everything into one bounding region
+    for (int i = 1; i < text_overlay->dirty_num; i++) {
+        rgn_union(&text_overlay->dirty[0], &text_overlay->dirty[i]);
+    }
+    rgn_union(&text_overlay->dirty[0], rgn);
+    text_overlay->dirty_num = 1;
+}
+
+static void add_repaint(text_overlay_t *text_overlay, const esp_capture_rgn_t *cell)
+{
+    // Cells along a line join into one run
+    if (text_overlay->repaint_num) {
+        esp_capture_rgn_t *last = &text_overlay->repaint[text_overlay->repaint_num - 1];
+        if (last->y == cell->y && last->height == cell->height && last->x + last->width == cell->x) {
+            last->width += cell->width;
+            return;
+        }
+    }
+    if (text_overlay->repaint_num < TEXT_MAX_REPAINT) {
+        text_overlay->repaint[text_overlay->repaint_num++] = *cell;
+        return;
+    }
+    for (int i = 1; i < text_overlay->repaint_num; i++) {
+        rgn_union(&text_overlay->repaint[0], &text_overlay->repaint[i]);
+    }
+    rgn_union(&text_overlay->repaint[0], cell);
+    text_overlay->repaint_num = 1;
+}
+
+static bool same_ops(const text_op_t *a, const text_op_t *b)
+{
+    if (a->type != b->type) {
+        return false;
+    }
+    if (a->type == TEXT_OP_CLEAR) {
+        return memcmp(&a->rgn, &b->rgn, sizeof(a->rgn)) == 0 && a->color == b->color;
+    }
+    return memcmp(&a->info, &b->info, sizeof(a->info)) == 0;
+}
+
+/**
+ * @brief Collect the character cells that differ between two versions of a text operation
+ */
+static void diff_text(text_overlay_t *text_overlay, const text_list_t *old_list, const text_op_t *old_op,
+                      const text_list_t *new_list, const text_op_t *new_op)
+{
+    const esp_painter_basic_font_t *font = new_op->font;
+    text_layout_t lo, ln;
+    layout_init(&lo, old_list, old_op);
+    layout_init(&ln, new_list, new_op);
+    while (1) {
+        char co = 0, cn = 0;
+        bool has_o = layout_next(text_overlay, old_op, &lo, &co);
+        bool has_n = layout_next(text_overlay, new_op, &ln, &cn);
+        if (has_o == false && has_n == false) {
+            break;
+        }
+        bool same = has_o && has_n && co == cn && lo.x == ln.x && lo.y == ln.y;
+        if (same == false) {
+            if (has_o) {
+                add_repaint(text_overlay, &(esp_capture_rgn_t) { .x = lo.x, .y = lo.y, .width = font->width,
+                                                                 .height = font->height });
+            }
+            if (has_n && (has_o == false || lo.x != ln.x || lo.y != ln.y)) {
+                add_repaint(text_overlay, &(esp_capture_rgn_t) { .x = ln.x, .y = ln.y, .width = font->width,
+                                                                 .height = font->height });
+            }
+        }
+        if (has_o) {
+            layout_advance(old_op, &lo);
+        }
+        if (has_n) {
+            layout_advance(new_op, &ln);
+        }
+    }
+}
+
+static void render_list(text_overlay_t *text_overlay)
+{
+    text_list_t *list = &text_overlay->lists[text_overlay->cur];
+    text_list_t *prev = &text_overlay->lists[text_overlay->cur ^ 1];
+    bool incremental = text_overlay->prev_valid && prev->overflow == false && list->overflow == false &&
+                       list->op_num == prev->op_num;
+    for (int i = 0; incremental && i < list->op_num; i++) {
+        incremental = same_ops(&list->ops[i], &prev->ops[i]);
+    }
+    if (list->overflow) {
+        ESP_LOGW(TAG, "Draw list full, later draws are dropped");
+    }
+    if (incremental) {
+        text_overlay->repaint_num = 0;
+        for (int i = 0; i < list->op_num; i++) {
+            if (list->ops[i].type == TEXT_OP_TEXT) {
+                diff_text(text_overlay, prev, &prev->ops[i], list, &list->ops[i]);
+            }
+        }
+        for (int r = 0; r < text_overlay->repaint_num; r++) {
+            for (int i = 0; i < list->op_num; i++) {
+                render_op(text_overlay, list, &list->ops[i], &text_overlay->repaint[r]);
+            }
+            add_dirty(text_overlay, &text_overlay->repaint[r]);
+        }
+    } else {
+        esp_capture_rgn_t all = { .width = text_overlay->rgn.width, .height = text_overlay->rgn.height };
+        esp_capture_rgn_t bounds = { 0 };
+        for (int i = 0; i < list->op_num; i++) {
+            render_op(text_overlay, list, &list->ops[i], &all);
+            op_bounds(text_overlay, list, &list->ops[i], &bounds);
+        }
+        if (bounds.width && bounds.height) {
+            add_dirty(text_overlay, &bounds);
+        }
+    }
+    text_overlay->prev_valid = list->overflow == false;
+    text_overlay->cur ^= 1;
+}
+
+static text_op_t *record_op(text_overlay_t *text_overlay, const char *str, int str_len)
+{
+    text_list_t *list = &text_overlay->lists[text_overlay->cur];
+    if (list->op_num >= TEXT_MAX_OPS || list->arena_used + str_len > TEXT_ARENA_SIZE) {
+        list->overflow = true;
+        return NULL;
+    }
+    text_op_t *op = &list->ops[list->op_num++];
+    memset(op, 0, sizeof(text_op_t));
+    if (str_len) {
+        memcpy(list->arena + list->arena_used, str, str_len);
+        op->str_off = (uint16_t)list->arena_used;
+        op->str_len = (uint16_t)str_len;
+        list->arena_used += str_len;
+    }
+    return op;
+}
+
+/**
+ * @brief Render one operation at once when drawing outside draw_start / draw_finished
+ */
+static void render_now(text_overlay_t *text_overlay, const text_op_t *op)
+{
+    text_list_t *list = &text_overlay->lists[text_overlay->cur];
+    esp_capture_rgn_t all = { .width = text_overlay->rgn.width, .height = text_overlay->rgn.height };
+    esp_capture_rgn_t bounds = { 0 };
+    render_op(text_overlay, list, op, &all);
+    op_bounds(text_overlay, list, op, &bounds);
+    if (bounds.width && bounds.height) {
+        add_dirty(text_overlay, &bounds);
+    }
+    // The frame no longer matches the last list
+    text_overlay->prev_valid = false;
+    list->op_num = 0;
+    list->arena_used = 0;
+}
+
+// ============================================
+// Overlay Interface
+// ============================================
+
 static int text_overlay_open(esp_capture_overlay_if_t *h)
 {
     text_overlay_t *text_overlay = (text_overlay_t *)h;
@@ -107,6 +669,11 @@ static int text_overlay_open(esp_capture_overlay_if_t *h)
         if (text_overlay->frame.data == NULL) {
             break;
         }
+        // Whole frame is new to the mixer
+        text_overlay->dirty[0] = (esp_capture_rgn_t) { .width = text_overlay->rgn.width,
+                                                       .height = text_overlay->rgn.height };
+        text_overlay->dirty_num = 1;
+        text_overlay->prev_valid = false;
         text_overlay->opened = true;
         return ESP_CAPTURE_ERR_OK;
     } while (0);
@@ -153,6 +720,11 @@ int esp_capture_text_overlay_draw_start(esp_capture_overlay_if_t *h)
         return ESP_CAPTURE_ERR_NOT_SUPPORTED;
     }
     media_lib_mutex_lock(text_overlay->mutex, 1000);
+    text_list_t *list = &text_overlay->lists[text_overlay->cur];
+    list->op_num = 0;
+    list->arena_used = 0;
+    list->overflow = false;
+    text_overlay->recording = true;
     return ESP_CAPTURE_ERR_OK;
 }
 
@@ -167,87 +739,56 @@ int esp_capture_text_overlay_clear(esp_capture_overlay_if_t *h, esp_capture_rgn_
         ESP_LOGE(TAG, "Region overflow");
         return ESP_CAPTURE_ERR_INVALID_ARG;
     }
-    bool pure_color = (color >> 8) == (color & 0xFF);
-    if (pure_color) {
-        uint8_t color_l = color & 0xFF;
-        uint16_t *v = (uint16_t *)text_overlay->frame.data;
-        v += (rgn->y * text_overlay->rgn.width + rgn->x);
-        for (int i = 0; i < rgn->height; i++) {
-            memset(v, color_l, rgn->width * 2);
-            v += text_overlay->rgn.width;
-        }
-    } else {
-        uint16_t *v = (uint16_t *)text_overlay->frame.data;
-        v += (rgn->y * text_overlay->rgn.width + rgn->x);
-        for (int i = 0; i < rgn->height; i++) {
-            uint16_t *col = v;
-            for (int j = 0; j < rgn->width; j++) {
-                *(col++) = color;
-            }
-            v += text_overlay->rgn.width;
-        }
+    text_op_t op = {
+        .type = TEXT_OP_CLEAR,
+        .rgn = *rgn,
+        .color = color,
+    };
+    if (text_overlay->recording == false) {
+        render_now(text_overlay, &op);
+        return ESP_CAPTURE_ERR_OK;
+    }
+    text_op_t *rec = record_op(text_overlay, NULL, 0);
+    if (rec) {
+        *rec = op;
     }
     return ESP_CAPTURE_ERR_OK;
 }
+
 int esp_capture_text_overlay_draw_text(esp_capture_overlay_if_t *h, esp_capture_text_overlay_draw_info_t *info, char *str)
 {
     text_overlay_t *text_overlay = (text_overlay_t *)h;
     if (text_overlay->opened == false) {
         return ESP_CAPTURE_ERR_NOT_SUPPORTED;
     }
-
-    const esp_painter_basic_font_t *font = get_font(info->font_size);
-    if (font == NULL) {
+    int font_idx = get_font_idx(text_overlay, info->font_size);
+    if (font_idx < 0) {
         return ESP_CAPTURE_ERR_NOT_SUPPORTED;
     }
-    uint32_t x = info->x;
-    uint32_t y = info->y;
-    uint16_t font_w = font->width;
-    uint16_t font_h = font->height;
-    uint16_t c_size = font->height * ((font->width + 7) / 8);
-
-    if (x + font_w > text_overlay->rgn.width || y + font_h > text_overlay->rgn.height) {
+    const esp_painter_basic_font_t *font = text_overlay->fonts[font_idx].font;
+    if (info->x + font->width > text_overlay->rgn.width ||
+        info->y + font->height > text_overlay->rgn.height) {
         return ESP_CAPTURE_ERR_NOT_SUPPORTED;
     }
-
-    uint16_t *dst = (uint16_t *)(text_overlay->frame.data) + (y * text_overlay->rgn.width + x);
-    uint16_t *pixel = dst;
-
-    while (*str) {
-        if (*str == '\n' || x + font_w > text_overlay->rgn.width) {
-            y += font_h;
-            if (y + font_h > text_overlay->rgn.height) {
-                break;
-            }
-            x = info->x;
-            dst = (uint16_t *)(text_overlay->frame.data) + (y * text_overlay->rgn.width + x);
-            str++;
-            continue;
-        }
-        pixel = dst;
-        uint16_t c_offset = (*str - ' ') * c_size;
-        const uint8_t *p_c = &font->bitmap[c_offset];
-        uint16_t *cur = pixel;
-        int x0 = 0;
-        for (int i = 0; i < c_size; i++) {
-            uint8_t temp = p_c[i];
-            for (int j = 0; j < 8; j++) {
-                if (temp & 0x80) {
-                    cur[x0] = info->color;
-                }
-                temp <<= 1;
-                x0++;
-                if (x0 == font_w) {
-                    x0 = 0;
-                    pixel += text_overlay->rgn.width;
-                    cur = pixel;
-                    break;
-                }
-            }
-        }
-        dst += font_w;
-        x += font_w;
-        str++;
+    int len = (int)strlen(str);
+    if (text_overlay->recording == false) {
+        text_list_t *list = &text_overlay->lists[text_overlay->cur];
+        list->op_num = 0;
+        list->arena_used = 0;
+        text_op_t *op = record_op(text_overlay, str, len > TEXT_ARENA_SIZE ? TEXT_ARENA_SIZE : len);
+        op->type = TEXT_OP_TEXT;
+        op->info = *info;
+        op->font = font;
+        op->font_idx = (uint8_t)font_idx;
+        render_now(text_overlay, op);
+        return ESP_CAPTURE_ERR_OK;
+    }
+    text_op_t *op = record_op(text_overlay, str, len);
+    if (op) {
+        op->type = TEXT_OP_TEXT;
+        op->info = *info;
+        op->font = font;
+        op->font_idx = (uint8_t)font_idx;
     }
     return ESP_CAPTURE_ERR_OK;
 }
@@ -277,10 +818,35 @@ int esp_capture_text_overlay_draw_finished(esp_capture_overlay_if_t *h)
     if (text_overlay->opened == false) {
         return ESP_CAPTURE_ERR_NOT_SUPPORTED;
     }
+    if (text_overlay->recording) {
+        render_list(text_overlay);
+        text_overlay->recording = false;
+    }
     media_lib_mutex_unlock(text_overlay->mutex);
     return ESP_CAPTURE_ERR_OK;
 }
 
+int esp_capture_text_overlay_take_dirty(esp_capture_overlay_if_t *h, esp_capture_rgn_t *rgn, int max_num)
+{
+    text_overlay_t *text_overlay = (text_overlay_t *)h;
+    if (text_overlay == NULL || rgn == NULL || max_num <= 0) {
+        return ESP_CAPTURE_ERR_INVALID_ARG;
+    }
+    if (text_overlay->opened == false) {
+        return ESP_CAPTURE_ERR_NOT_SUPPORTED;
+    }
+    int num = text_overlay->dirty_num;
+    if (num > max_num) {
+        for (int i = max_num; i < num; i++) {
+            rgn_union(&text_overlay->dirty[max_num - 1], &text_overlay->dirty[i]);
+        }
+        num = max_num;
+    }
+    memcpy(rgn, text_overlay->dirty, num * sizeof(esp_capture_rgn_t));
+    text_overlay->dirty_num = 0;
+    return num;
+}
+
 static int text_overlay_set_alpha(esp_capture_overlay_if_t *h, uint8_t alpha)
 {
     text_overlay_t *text_overlay = (text_overlay_t *)h;
@@ -305,6 +871,7 @@ static int text_overlay_close(esp_capture_overlay_if_t *h)
         free(text_overlay->frame.data);
         text_overlay->frame.data = NULL;
     }
+    glyph_cache_free(text_overlay);
     if (text_overlay->mutex) {
         media_lib_mutex_unlock(text_overlay->mutex);
         media_lib_mutex_destroy(text_overlay->mutex);
@@ -328,5 +895,6 @@ esp_capture_overlay_if_t *esp_capture_new_text_overlay(esp_capture_rgn_t *rgn)
     text_overlay->base.release_frame = text_overlay_release_frame;
     text_overlay->base.close = text_overlay_close;
     text_overlay->rgn = *rgn;
+    glyph_cache_init(text_overlay);
     return &text_overlay->base;
-}
\ No newline at end of file
+}
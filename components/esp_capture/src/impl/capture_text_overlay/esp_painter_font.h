@@ -12,53 +12,38 @@
 extern "C" {
 #endif
 
-typedef struct {
-    const uint8_t *bitmap;
-    uint16_t       width;
-    uint16_t       height;
-} esp_painter_basic_font_t;
-
-#define esp_painter_FONT_DECLARE(font_name) extern const esp_painter_basic_font_t font_name;
-
-#if CONFIG_ESP_PAINTER_BASIC_FONT_12
-esp_painter_FONT_DECLARE(esp_painter_basic_font_12);
-#endif
-
-#if CONFIG_ESP_PAINTER_BASIC_FONT_16
-esp_painter_FONT_DECLARE(esp_painter_basic_font_16);
-#endif
-
-#if CONFIG_ESP_PAINTER_BASIC_FONT_20
-esp_painter_FONT_DECLARE(esp_painter_basic_font_20);
-#endif
-
-#if CONFIG_ESP_PAINTER_BASIC_FONT_24
-esp_painter_FONT_DECLARE(esp_painter_basic_font_24);
-#endif
-
-#if CONFIG_ESP_PAINTER_BASIC_FONT_28
-esp_painter_FONT_DECLARE(esp_painter_basic_font_28);
-#endif
-
-#if CONFIG_ESP_PAINTER_BASIC_FONT_32
-esp_painter_FONT_DECLARE(esp_painter_basic_font_32);
-#endif
+/*
+ * Fonts are monospaced cells of 1-bit glyphs, packed by tools/pack_font.py:
+ * each glyph is cropped to the box of its set pixels and stored as the
+ * box's bits, row-major without padding, or run-length coded. Runs
+ * alternate unset / set pixels over the box, starting with unset; a run is
+ * 4-bit nibbles, high nibble first, 15 adding 15 and continuing, 0-14
+ * ending it.
+ */
 
-#if CONFIG_ESP_PAINTER_BASIC_FONT_36
-esp_painter_FONT_DECLARE(esp_painter_basic_font_36);
-#endif
+#define ESP_PAINTER_GLYPH_RLE  (0x8000)
 
-#if CONFIG_ESP_PAINTER_BASIC_FONT_40
-esp_painter_FONT_DECLARE(esp_painter_basic_font_40);
-#endif
+typedef struct {
+    uint16_t offset;   // Of the glyph's data in bitmap, ESP_PAINTER_GLYPH_RLE when run-length coded
+    uint8_t  box_x;    // Box of the set pixels in the cell, box_w 0 when there are none
+    uint8_t  box_y;
+    uint8_t  box_w;
+    uint8_t  box_h;
+} esp_painter_glyph_t;
 
-#if CONFIG_ESP_PAINTER_BASIC_FONT_44
-esp_painter_FONT_DECLARE(esp_painter_basic_font_44);
-#endif
+typedef struct {
+    const uint8_t             *bitmap;
+    const esp_painter_glyph_t *glyphs;
+    uint16_t                   width;
+    uint16_t                   height;
+    uint8_t                    first;  // Character of glyphs[0]
+    uint8_t                    count;
+} esp_painter_basic_font_t;
 
-#if CONFIG_ESP_PAINTER_BASIC_FONT_48
-esp_painter_FONT_DECLARE(esp_painter_basic_font_48);
-#endif
+/**
+ * @brief Fonts enabled in Kconfig, NULL-terminated (font/basic_fonts.c)
+ */
+extern const esp_painter_basic_font_t *const esp_painter_basic_fonts[];
 
 #ifdef __cplusplus
 }
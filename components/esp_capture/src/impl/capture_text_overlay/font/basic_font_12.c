@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: CC0-1.0
  */
 
+/* Packed by tools/pack_font.py: 6x12 cells, 991 bytes (1-bit bitmap: 1140) */
+
 #include "sdkconfig.h"
 
 #include "esp_painter_font.h"
@@ -11,201 +13,207 @@
 #if CONFIG_ESP_PAINTER_BASIC_FONT_12
 
 static const uint8_t bitmap[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*" ",0*/
-
-    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, /*"!",1*/
-
-    0x28, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*""",2*/
-
-    0x00, 0x00, 0x50, 0x50, 0xF8, 0x50, 0x50, 0xF8, 0x50, 0x50, 0x00, 0x00, /*"#",3*/
-
-    0x00, 0x20, 0x70, 0xA8, 0xA0, 0x60, 0x30, 0x28, 0xA8, 0x70, 0x20, 0x00, /*"$",4*/
-
-    0x00, 0x00, 0x48, 0xA8, 0xB0, 0xA8, 0x74, 0x34, 0x54, 0x48, 0x00, 0x00, /*"%",5*/
-
-    0x00, 0x00, 0x20, 0x50, 0x50, 0x6C, 0xA8, 0xA8, 0x94, 0x68, 0x00, 0x00, /*"&",6*/
-
-    0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"'",7*/
-
-    0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x00, /*"(",8*/
-
-    0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x00, /*")",9*/
-
-    0x00, 0x00, 0x00, 0x20, 0xA8, 0x70, 0x70, 0xA8, 0x20, 0x00, 0x00, 0x00, /*"*",10*/
-
-    0x00, 0x00, 0x00, 0x10, 0x10, 0x7C, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, /*"+",11*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x80, 0x00, /*",",12*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"-",13*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, /*".",14*/
-
-    0x00, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0x00, /*"/",15*/
-
-    0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, /*"0",16*/
-
-    0x00, 0x00, 0x20, 0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, /*"1",17*/
-
-    0x00, 0x00, 0x70, 0x88, 0x88, 0x10, 0x20, 0x40, 0x80, 0xF8, 0x00, 0x00, /*"2",18*/
-
-    0x00, 0x00, 0x70, 0x88, 0x08, 0x30, 0x08, 0x08, 0x88, 0x70, 0x00, 0x00, /*"3",19*/
-
-    0x00, 0x00, 0x10, 0x30, 0x30, 0x50, 0x90, 0xF8, 0x10, 0x38, 0x00, 0x00, /*"4",20*/
-
-    0x00, 0x00, 0xF8, 0x80, 0x80, 0xF0, 0x88, 0x08, 0x88, 0x70, 0x00, 0x00, /*"5",21*/
-
-    0x00, 0x00, 0x30, 0x48, 0x80, 0xB0, 0xC8, 0x88, 0x88, 0x70, 0x00, 0x00, /*"6",22*/
-
-    0x00, 0x00, 0x78, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, /*"7",23*/
-
-    0x00, 0x00, 0x70, 0x88, 0x88, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, /*"8",24*/
-
-    0x00, 0x00, 0x70, 0x88, 0x88, 0x98, 0x68, 0x08, 0x90, 0x60, 0x00, 0x00, /*"9",25*/
-
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, /*":",26*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, /*";",27*/
-
-    0x00, 0x00, 0x08, 0x10, 0x20, 0x40, 0x40, 0x20, 0x10, 0x08, 0x00, 0x00, /*"<",28*/
-
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, /*"=",29*/
-
-    0x00, 0x00, 0x40, 0x20, 0x10, 0x08, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00, /*">",30*/
-
-    0x00, 0x00, 0x70, 0x88, 0x88, 0x10, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00, /*"?",31*/
-
-    0x00, 0x00, 0x38, 0x44, 0x94, 0xB4, 0xB4, 0xB8, 0x44, 0x38, 0x00, 0x00, /*"@",32*/
-
-    0x00, 0x00, 0x20, 0x20, 0x30, 0x50, 0x50, 0x78, 0x48, 0xCC, 0x00, 0x00, /*"A",33*/
-
-    0x00, 0x00, 0xF0, 0x48, 0x48, 0x70, 0x48, 0x48, 0x48, 0xF0, 0x00, 0x00, /*"B",34*/
-
-    0x00, 0x00, 0x78, 0x88, 0x80, 0x80, 0x80, 0x80, 0x88, 0x70, 0x00, 0x00, /*"C",35*/
-
-    0x00, 0x00, 0xF0, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0xF0, 0x00, 0x00, /*"D",36*/
-
-    0x00, 0x00, 0xF8, 0x48, 0x50, 0x70, 0x50, 0x40, 0x48, 0xF8, 0x00, 0x00, /*"E",37*/
-
-    0x00, 0x00, 0xF8, 0x48, 0x50, 0x70, 0x50, 0x40, 0x40, 0xE0, 0x00, 0x00, /*"F",38*/
-
-    0x00, 0x00, 0x38, 0x48, 0x80, 0x80, 0x9C, 0x88, 0x48, 0x30, 0x00, 0x00, /*"G",39*/
-
-    0x00, 0x00, 0xCC, 0x48, 0x48, 0x78, 0x48, 0x48, 0x48, 0xCC, 0x00, 0x00, /*"H",40*/
-
-    0x00, 0x00, 0xF8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xF8, 0x00, 0x00, /*"I",41*/
-
-    0x00, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0xE0, /*"J",42*/
-
-    0x00, 0x00, 0xEC, 0x48, 0x50, 0x60, 0x50, 0x48, 0x48, 0xEC, 0x00, 0x00, /*"K",43*/
-
-    0x00, 0x00, 0xE0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x44, 0xFC, 0x00, 0x00, /*"L",44*/
-
-    0x00, 0x00, 0xDC, 0xD8, 0xD8, 0xD8, 0xA8, 0xA8, 0xA8, 0xAC, 0x00, 0x00, /*"M",45*/
-
-    0x00, 0x00, 0xDC, 0x48, 0x68, 0x68, 0x58, 0x58, 0x48, 0xE8, 0x00, 0x00, /*"N",46*/
-
-    0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, /*"O",47*/
-
-    0x00, 0x00, 0xF0, 0x48, 0x48, 0x70, 0x40, 0x40, 0x40, 0xE0, 0x00, 0x00, /*"P",48*/
-
-    0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x88, 0xE8, 0x98, 0x70, 0x18, 0x00, /*"Q",49*/
-
-    0x00, 0x00, 0xF0, 0x48, 0x48, 0x70, 0x50, 0x48, 0x48, 0xEC, 0x00, 0x00, /*"R",50*/
-
-    0x00, 0x00, 0x78, 0x88, 0x80, 0x60, 0x10, 0x08, 0x88, 0xF0, 0x00, 0x00, /*"S",51*/
-
-    0x00, 0x00, 0xF8, 0xA8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, /*"T",52*/
-
-    0x00, 0x00, 0xCC, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00, /*"U",53*/
-
-    0x00, 0x00, 0xCC, 0x48, 0x48, 0x50, 0x50, 0x30, 0x20, 0x20, 0x00, 0x00, /*"V",54*/
-
-    0x00, 0x00, 0xA8, 0xA8, 0xA8, 0xA8, 0x70, 0x50, 0x50, 0x50, 0x00, 0x00, /*"W",55*/
-
-    0x00, 0x00, 0xD8, 0x50, 0x50, 0x20, 0x20, 0x50, 0x50, 0xD8, 0x00, 0x00, /*"X",56*/
-
-    0x00, 0x00, 0xD8, 0x50, 0x50, 0x50, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, /*"Y",57*/
-
-    0x00, 0x00, 0xF8, 0x90, 0x10, 0x20, 0x20, 0x40, 0x48, 0xF8, 0x00, 0x00, /*"Z",58*/
-
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x38, 0x00, /*"[",59*/
-
-    0x00, 0x40, 0x40, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x08, 0x08, 0x00, /*"\",60*/
-
-    0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x70, 0x00, /*"]",61*/
-
-    0x20, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"^",62*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, /*"_",63*/
-
-    0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"`",64*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x48, 0x38, 0x48, 0x3C, 0x00, 0x00, /*"a",65*/
-
-    0x00, 0xC0, 0x40, 0x40, 0x40, 0x70, 0x48, 0x48, 0x48, 0x70, 0x00, 0x00, /*"b",66*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x48, 0x40, 0x48, 0x30, 0x00, 0x00, /*"c",67*/
-
-    0x00, 0x18, 0x08, 0x08, 0x08, 0x38, 0x48, 0x48, 0x48, 0x3C, 0x00, 0x00, /*"d",68*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x48, 0x78, 0x40, 0x38, 0x00, 0x00, /*"e",69*/
-
-    0x00, 0x18, 0x24, 0x20, 0x20, 0x78, 0x20, 0x20, 0x20, 0x78, 0x00, 0x00, /*"f",70*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x48, 0x30, 0x40, 0x38, 0x44, 0x38, /*"g",71*/
-
-    0x00, 0xC0, 0x40, 0x40, 0x40, 0x70, 0x48, 0x48, 0x48, 0xEC, 0x00, 0x00, /*"h",72*/
-
-    0x00, 0x20, 0x20, 0x00, 0x00, 0x60, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, /*"i",73*/
-
-    0x00, 0x10, 0x10, 0x00, 0x00, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0xE0, /*"j",74*/
-
-    0x00, 0xC0, 0x40, 0x40, 0x40, 0x58, 0x50, 0x60, 0x50, 0xC8, 0x00, 0x00, /*"k",75*/
-
-    0x00, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xF8, 0x00, 0x00, /*"l",76*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xA8, 0xA8, 0xA8, 0xA8, 0x00, 0x00, /*"m",77*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x48, 0x48, 0x48, 0xEC, 0x00, 0x00, /*"n",78*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00, /*"o",79*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x48, 0x48, 0x48, 0x70, 0x40, 0xE0, /*"p",80*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x48, 0x48, 0x48, 0x38, 0x08, 0x1C, /*"q",81*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x60, 0x40, 0x40, 0xE0, 0x00, 0x00, /*"r",82*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x40, 0x30, 0x08, 0x78, 0x00, 0x00, /*"s",83*/
-
-    0x00, 0x00, 0x00, 0x20, 0x20, 0x78, 0x20, 0x20, 0x20, 0x38, 0x00, 0x00, /*"t",84*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x48, 0x48, 0x48, 0x3C, 0x00, 0x00, /*"u",85*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x50, 0x50, 0x20, 0x20, 0x00, 0x00, /*"v",86*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xA8, 0x70, 0x50, 0x50, 0x00, 0x00, /*"w",87*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x50, 0x20, 0x50, 0xD8, 0x00, 0x00, /*"x",88*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x48, 0x48, 0x30, 0x10, 0x20, 0xC0, /*"y",89*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x10, 0x20, 0x20, 0x78, 0x00, 0x00, /*"z",90*/
-
-    0x18, 0x10, 0x10, 0x10, 0x10, 0x30, 0x10, 0x10, 0x10, 0x10, 0x18, 0x00, /*"{",91*/
-
-    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, /*"|",92*/
-
-    0x60, 0x20, 0x20, 0x20, 0x20, 0x10, 0x20, 0x20, 0x20, 0x20, 0x60, 0x00, /*"}",93*/
+    0xF9, /*"!",1*/
+    0x55, 0xA0, /*""",2*/
+    0x52, 0xBE, 0xA5, 0x7D, 0x4A, /*"#",3*/
+    0x23, 0xAB, 0x46, 0x18, 0xB5, 0x71, 0x00, /*"$",4*/
+    0x4A, 0xAB, 0x2A, 0x74, 0xD5, 0x52, /*"%",5*/
+    0x21, 0x45, 0x1B, 0xAA, 0xA9, 0x5A, /*"&",6*/
+    0x58, /*"'",7*/
+    0x29, 0x49, 0x24, 0x48, 0x80, /*"(",8*/
+    0x89, 0x12, 0x49, 0x4A, 0x00, /*")",9*/
+    0x25, 0x5C, 0xEA, 0x90, /*"*",10*/
+    0x21, 0x3E, 0x42, 0x00, /*"+",11*/
+    0x58, /*",",12*/
+    0xFC, /*"-",13*/
+    0x80, /*".",14*/
+    0x04, 0x20, 0x84, 0x10, 0x82, 0x10, 0x42, 0x00, /*"/",15*/
+    0x74, 0x63, 0x18, 0xC6, 0x2E, /*"0",16*/
+    0x59, 0x24, 0x97, /*"1",17*/
+    0x74, 0x62, 0x22, 0x22, 0x1F, /*"2",18*/
+    0x74, 0x42, 0x60, 0x86, 0x2E, /*"3",19*/
+    0x11, 0x8C, 0xA9, 0x7C, 0x47, /*"4",20*/
+    0xFC, 0x21, 0xE8, 0x86, 0x2E, /*"5",21*/
+    0x32, 0x61, 0x6C, 0xC6, 0x2E, /*"6",22*/
+    0xF1, 0x22, 0x44, 0x44, /*"7",23*/
+    0x74, 0x62, 0xE8, 0xC6, 0x2E, /*"8",24*/
+    0x74, 0x63, 0x36, 0x86, 0x4C, /*"9",25*/
+    0x84, /*":",26*/
+    0x8C, /*";",27*/
+    0x12, 0x48, 0x84, 0x21, /*"<",28*/
+    0x06, 0x66, /*"=",29*/
+    0x84, 0x21, 0x12, 0x48, /*">",30*/
+    0x74, 0x62, 0x22, 0x10, 0x04, /*"?",31*/
+    0x39, 0x19, 0x6D, 0xB6, 0xE4, 0x4E, /*"@",32*/
+    0x20, 0x83, 0x14, 0x51, 0xE4, 0xB3, /*"A",33*/
+    0xF2, 0x52, 0xE4, 0xA5, 0x3E, /*"B",34*/
+    0x7C, 0x61, 0x08, 0x42, 0x2E, /*"C",35*/
+    0xF2, 0x52, 0x94, 0xA5, 0x3E, /*"D",36*/
+    0xFA, 0x54, 0xE5, 0x21, 0x3F, /*"E",37*/
+    0xFA, 0x54, 0xE5, 0x21, 0x1C, /*"F",38*/
+    0x39, 0x28, 0x20, 0x9E, 0x24, 0x8C, /*"G",39*/
+    0xCD, 0x24, 0x9E, 0x49, 0x24, 0xB3, /*"H",40*/
+    0xF9, 0x08, 0x42, 0x10, 0x9F, /*"I",41*/
+    0x7C, 0x41, 0x04, 0x10, 0x41, 0x04, 0x93, 0x80, /*"J",42*/
+    0xED, 0x25, 0x18, 0x51, 0x24, 0xBB, /*"K",43*/
+    0xE1, 0x04, 0x10, 0x41, 0x04, 0x7F, /*"L",44*/
+    0xDF, 0x6D, 0xB6, 0xAA, 0xAA, 0xAB, /*"M",45*/
+    0xDD, 0x26, 0x9A, 0x59, 0x64, 0xBA, /*"N",46*/
+    0x74, 0x63, 0x18, 0xC6, 0x2E, /*"O",47*/
+    0xF2, 0x52, 0xE4, 0x21, 0x1C, /*"P",48*/
+    0x74, 0x63, 0x18, 0xF6, 0x6E, 0x18, /*"Q",49*/
+    0xF1, 0x24, 0x9C, 0x51, 0x24, 0xBB, /*"R",50*/
+    0x7C, 0x60, 0xC1, 0x06, 0x3E, /*"S",51*/
+    0xFD, 0x48, 0x42, 0x10, 0x8E, /*"T",52*/
+    0xCD, 0x24, 0x92, 0x49, 0x24, 0x8C, /*"U",53*/
+    0xCD, 0x24, 0x94, 0x50, 0xC2, 0x08, /*"V",54*/
+    0xAD, 0x6B, 0x57, 0x29, 0x4A, /*"W",55*/
+    0xDA, 0x94, 0x42, 0x29, 0x5B, /*"X",56*/
+    0xDA, 0x94, 0xA2, 0x10, 0x8E, /*"Y",57*/
+    0xFC, 0x84, 0x42, 0x21, 0x3F, /*"Z",58*/
+    0xF2, 0x49, 0x24, 0x93, 0x80, /*"[",59*/
+    0x88, 0x44, 0x42, 0x22, 0x11, /*"\",60*/
+    0xE4, 0x92, 0x49, 0x27, 0x80, /*"]",61*/
+    0x54, /*"^",62*/
+    0xFC, /*"_",63*/
+    0x90, /*"`",64*/
+    0x64, 0x9D, 0x27, 0x80, /*"a",65*/
+    0xC2, 0x10, 0x87, 0x25, 0x29, 0x70, /*"b",66*/
+    0x79, 0x89, 0x60, /*"c",67*/
+    0x30, 0x84, 0x27, 0x4A, 0x52, 0x78, /*"d",68*/
+    0x69, 0xF8, 0x70, /*"e",69*/
+    0x32, 0x50, 0x8F, 0x21, 0x08, 0xF0, /*"f",70*/
+    0x7C, 0x99, 0x07, 0x45, 0xC0, /*"g",71*/
+    0xC1, 0x04, 0x10, 0x71, 0x24, 0x92, 0xEC, /*"h",72*/
+    0x48, 0x0C, 0x92, 0xE0, /*"i",73*/
+    0x11, 0x00, 0x31, 0x11, 0x11, 0xE0, /*"j",74*/
+    0xC2, 0x10, 0x85, 0xA9, 0x8A, 0xC8, /*"k",75*/
+    0xE1, 0x08, 0x42, 0x10, 0x84, 0xF8, /*"l",76*/
+    0xF5, 0x6B, 0x5A, 0x80, /*"m",77*/
+    0xF1, 0x24, 0x92, 0xEC, /*"n",78*/
+    0x69, 0x99, 0x60, /*"o",79*/
+    0xF2, 0x52, 0x97, 0x23, 0x80, /*"p",80*/
+    0x74, 0xA5, 0x27, 0x08, 0xE0, /*"q",81*/
+    0xDB, 0x10, 0x8E, 0x00, /*"r",82*/
+    0xF8, 0x61, 0xF0, /*"s",83*/
+    0x44, 0xF4, 0x44, 0x70, /*"t",84*/
+    0xD9, 0x24, 0x92, 0x3C, /*"u",85*/
+    0xDA, 0x94, 0x42, 0x00, /*"v",86*/
+    0xAD, 0x5C, 0xA5, 0x00, /*"w",87*/
+    0xDA, 0x88, 0xAD, 0x80, /*"x",88*/
+    0xCD, 0x24, 0x8C, 0x10, 0x8C, 0x00, /*"y",89*/
+    0xF2, 0x44, 0xF0, /*"z",90*/
+    0x69, 0x25, 0x92, 0x49, 0x80, /*"{",91*/
+    0x0C, /*"|",92*/
+    0xC9, 0x24, 0x52, 0x4B, 0x00, /*"}",93*/
+    0x6C, 0x80, /*"~",94*/
+};
 
-    0x68, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"~",94*/
+static const esp_painter_glyph_t glyphs[] = {
+    {0x0000, 0, 0, 0, 0}, /*" ",0*/
+    {0x0000, 2, 2, 1, 8}, /*"!",1*/
+    {0x0001, 1, 0, 4, 3}, /*""",2*/
+    {0x0003, 0, 2, 5, 8}, /*"#",3*/
+    {0x0008, 0, 1, 5, 10}, /*"$",4*/
+    {0x000F, 0, 2, 6, 8}, /*"%",5*/
+    {0x0015, 0, 2, 6, 8}, /*"&",6*/
+    {0x001B, 0, 0, 2, 3}, /*"'",7*/
+    {0x001C, 2, 0, 3, 11}, /*"(",8*/
+    {0x0021, 1, 0, 3, 11}, /*")",9*/
+    {0x0026, 0, 3, 5, 6}, /*"*",10*/
+    {0x002A, 1, 3, 5, 5}, /*"+",11*/
+    {0x002E, 0, 8, 2, 3}, /*",",12*/
+    {0x002F, 0, 5, 6, 1}, /*"-",13*/
+    {0x0030, 1, 9, 1, 1}, /*".",14*/
+    {0x0031, 0, 1, 6, 10}, /*"/",15*/
+    {0x0039, 0, 2, 5, 8}, /*"0",16*/
+    {0x003E, 1, 2, 3, 8}, /*"1",17*/
+    {0x0041, 0, 2, 5, 8}, /*"2",18*/
+    {0x0046, 0, 2, 5, 8}, /*"3",19*/
+    {0x004B, 0, 2, 5, 8}, /*"4",20*/
+    {0x0050, 0, 2, 5, 8}, /*"5",21*/
+    {0x0055, 0, 2, 5, 8}, /*"6",22*/
+    {0x005A, 1, 2, 4, 8}, /*"7",23*/
+    {0x005E, 0, 2, 5, 8}, /*"8",24*/
+    {0x0063, 0, 2, 5, 8}, /*"9",25*/
+    {0x0068, 2, 4, 1, 6}, /*":",26*/
+    {0x0069, 2, 5, 1, 6}, /*";",27*/
+    {0x006A, 1, 2, 4, 8}, /*"<",28*/
+    {0x806E, 0, 4, 6, 3}, /*"=",29*/
+    {0x0070, 1, 2, 4, 8}, /*">",30*/
+    {0x0074, 0, 2, 5, 8}, /*"?",31*/
+    {0x0079, 0, 2, 6, 8}, /*"@",32*/
+    {0x007F, 0, 2, 6, 8}, /*"A",33*/
+    {0x0085, 0, 2, 5, 8}, /*"B",34*/
+    {0x008A, 0, 2, 5, 8}, /*"C",35*/
+    {0x008F, 0, 2, 5, 8}, /*"D",36*/
+    {0x0094, 0, 2, 5, 8}, /*"E",37*/
+    {0x0099, 0, 2, 5, 8}, /*"F",38*/
+    {0x009E, 0, 2, 6, 8}, /*"G",39*/
+    {0x00A4, 0, 2, 6, 8}, /*"H",40*/
+    {0x00AA, 0, 2, 5, 8}, /*"I",41*/
+    {0x00AF, 0, 2, 6, 10}, /*"J",42*/
+    {0x00B7, 0, 2, 6, 8}, /*"K",43*/
+    {0x00BD, 0, 2, 6, 8}, /*"L",44*/
+    {0x00C3, 0, 2, 6, 8}, /*"M",45*/
+    {0x00C9, 0, 2, 6, 8}, /*"N",46*/
+    {0x00CF, 0, 2, 5, 8}, /*"O",47*/
+    {0x00D4, 0, 2, 5, 8}, /*"P",48*/
+    {0x00D9, 0, 2, 5, 9}, /*"Q",49*/
+    {0x00DF, 0, 2, 6, 8}, /*"R",50*/
+    {0x00E5, 0, 2, 5, 8}, /*"S",51*/
+    {0x00EA, 0, 2, 5, 8}, /*"T",52*/
+    {0x00EF, 0, 2, 6, 8}, /*"U",53*/
+    {0x00F5, 0, 2, 6, 8}, /*"V",54*/
+    {0x00FB, 0, 2, 5, 8}, /*"W",55*/
+    {0x0100, 0, 2, 5, 8}, /*"X",56*/
+    {0x0105, 0, 2, 5, 8}, /*"Y",57*/
+    {0x010A, 0, 2, 5, 8}, /*"Z",58*/
+    {0x010F, 2, 0, 3, 11}, /*"[",59*/
+    {0x0114, 1, 1, 4, 10}, /*"\",60*/
+    {0x0119, 1, 0, 3, 11}, /*"]",61*/
+    {0x011E, 1, 0, 3, 2}, /*"^",62*/
+    {0x011F, 0, 11, 6, 1}, /*"_",63*/
+    {0x0120, 1, 0, 2, 2}, /*"`",64*/
+    {0x0121, 1, 5, 5, 5}, /*"a",65*/
+    {0x0125, 0, 1, 5, 9}, /*"b",66*/
+    {0x012B, 1, 5, 4, 5}, /*"c",67*/
+    {0x012E, 1, 1, 5, 9}, /*"d",68*/
+    {0x0134, 1, 5, 4, 5}, /*"e",69*/
+    {0x0137, 1, 1, 5, 9}, /*"f",70*/
+    {0x013D, 1, 5, 5, 7}, /*"g",71*/
+    {0x0142, 0, 1, 6, 9}, /*"h",72*/
+    {0x0149, 1, 1, 3, 9}, /*"i",73*/
+    {0x014D, 0, 1, 4, 11}, /*"j",74*/
+    {0x0153, 0, 1, 5, 9}, /*"k",75*/
+    {0x0159, 0, 1, 5, 9}, /*"l",76*/
+    {0x015F, 0, 5, 5, 5}, /*"m",77*/
+    {0x0163, 0, 5, 6, 5}, /*"n",78*/
+    {0x0167, 1, 5, 4, 5}, /*"o",79*/
+    {0x016A, 0, 5, 5, 7}, /*"p",80*/
+    {0x016F, 1, 5, 5, 7}, /*"q",81*/
+    {0x0174, 0, 5, 5, 5}, /*"r",82*/
+    {0x0178, 1, 5, 4, 5}, /*"s",83*/
+    {0x017B, 1, 3, 4, 7}, /*"t",84*/
+    {0x017F, 0, 5, 6, 5}, /*"u",85*/
+    {0x0183, 0, 5, 5, 5}, /*"v",86*/
+    {0x0187, 0, 5, 5, 5}, /*"w",87*/
+    {0x018B, 0, 5, 5, 5}, /*"x",88*/
+    {0x018F, 0, 5, 6, 7}, /*"y",89*/
+    {0x0195, 1, 5, 4, 5}, /*"z",90*/
+    {0x0198, 2, 0, 3, 11}, /*"{",91*/
+    {0x819D, 3, 0, 1, 12}, /*"|",92*/
+    {0x019E, 1, 0, 3, 11}, /*"}",93*/
+    {0x01A3, 0, 0, 5, 2}, /*"~",94*/
 };
 
 const esp_painter_basic_font_t esp_painter_basic_font_12 = {
     .bitmap = bitmap,
+    .glyphs = glyphs,
     .width = 6,
     .height = 12,
+    .first = 0x20,
+    .count = 95,
 };
 
 #endif
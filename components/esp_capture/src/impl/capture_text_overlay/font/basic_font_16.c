@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: CC0-1.0
  */
 
+/* Packed by tools/pack_font.py: 8x16 cells, 1294 bytes (1-bit bitmap: 1520) */
+
 #include "sdkconfig.h"
 
 #include "esp_painter_font.h"
@@ -11,201 +13,207 @@
 #if CONFIG_ESP_PAINTER_BASIC_FONT_16
 
 static const uint8_t bitmap[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*" ",0*/
-
-    0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, /*"!",1*/
-
-    0x00, 0x12, 0x24, 0x24, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*""",2*/
-
-    0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x7E, 0x24, 0x24, 0x24, 0x7E, 0x24, 0x24, 0x24, 0x00, 0x00, /*"#",3*/
-
-    0x00, 0x00, 0x08, 0x3C, 0x4A, 0x4A, 0x48, 0x38, 0x0C, 0x0A, 0x0A, 0x4A, 0x4A, 0x3C, 0x08, 0x08, /*"$",4*/
-
-    0x00, 0x00, 0x00, 0x44, 0xA4, 0xA8, 0xA8, 0xB0, 0x54, 0x1A, 0x2A, 0x2A, 0x4A, 0x44, 0x00, 0x00, /*"%",5*/
-
-    0x00, 0x00, 0x00, 0x30, 0x48, 0x48, 0x48, 0x50, 0x6E, 0xA4, 0x94, 0x98, 0x89, 0x76, 0x00, 0x00, /*"&",6*/
-
-    0x00, 0x60, 0x20, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"'",7*/
-
-    0x00, 0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x02, 0x00, /*"(",8*/
-
-    0x00, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x00, /*")",9*/
-
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0xD6, 0x38, 0x38, 0xD6, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, /*"*",10*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x7F, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, /*"+",11*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x20, 0x20, 0x40, /*",",12*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"-",13*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, /*".",14*/
-
-    0x00, 0x00, 0x02, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x00, /*"/",15*/
-
-    0x00, 0x00, 0x00, 0x18, 0x24, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x24, 0x18, 0x00, 0x00, /*"0",16*/
-
-    0x00, 0x00, 0x00, 0x08, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3E, 0x00, 0x00, /*"1",17*/
-
-    0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x42, 0x02, 0x04, 0x08, 0x10, 0x20, 0x42, 0x7E, 0x00, 0x00, /*"2",18*/
-
-    0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x02, 0x04, 0x18, 0x04, 0x02, 0x42, 0x42, 0x3C, 0x00, 0x00, /*"3",19*/
-
-    0x00, 0x00, 0x00, 0x04, 0x0C, 0x0C, 0x14, 0x24, 0x24, 0x44, 0x7F, 0x04, 0x04, 0x1F, 0x00, 0x00, /*"4",20*/
-
-    0x00, 0x00, 0x00, 0x7E, 0x40, 0x40, 0x40, 0x78, 0x44, 0x02, 0x02, 0x42, 0x44, 0x38, 0x00, 0x00, /*"5",21*/
-
-    0x00, 0x00, 0x00, 0x18, 0x24, 0x40, 0x40, 0x5C, 0x62, 0x42, 0x42, 0x42, 0x22, 0x1C, 0x00, 0x00, /*"6",22*/
-
-    0x00, 0x00, 0x00, 0x7E, 0x42, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, /*"7",23*/
-
-    0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x42, 0x24, 0x18, 0x24, 0x42, 0x42, 0x42, 0x3C, 0x00, 0x00, /*"8",24*/
-
-    0x00, 0x00, 0x00, 0x38, 0x44, 0x42, 0x42, 0x42, 0x46, 0x3A, 0x02, 0x02, 0x24, 0x18, 0x00, 0x00, /*"9",25*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, /*":",26*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, /*";",27*/
-
-    0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00, /*"<",28*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"=",29*/
-
-    0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00, /*">",30*/
-
-    0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x62, 0x04, 0x08, 0x08, 0x08, 0x00, 0x18, 0x18, 0x00, 0x00, /*"?",31*/
-
-    0x00, 0x00, 0x00, 0x38, 0x44, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5C, 0x42, 0x3C, 0x00, 0x00, /*"@",32*/
-
-    0x00, 0x00, 0x00, 0x10, 0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, 0x00, 0x00, /*"A",33*/
-
-    0x00, 0x00, 0x00, 0xF8, 0x44, 0x44, 0x44, 0x78, 0x44, 0x42, 0x42, 0x42, 0x44, 0xF8, 0x00, 0x00, /*"B",34*/
-
-    0x00, 0x00, 0x00, 0x3E, 0x42, 0x42, 0x80, 0x80, 0x80, 0x80, 0x80, 0x42, 0x44, 0x38, 0x00, 0x00, /*"C",35*/
-
-    0x00, 0x00, 0x00, 0xF8, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0xF8, 0x00, 0x00, /*"D",36*/
-
-    0x00, 0x00, 0x00, 0xFC, 0x42, 0x48, 0x48, 0x78, 0x48, 0x48, 0x40, 0x42, 0x42, 0xFC, 0x00, 0x00, /*"E",37*/
-
-    0x00, 0x00, 0x00, 0xFC, 0x42, 0x48, 0x48, 0x78, 0x48, 0x48, 0x40, 0x40, 0x40, 0xE0, 0x00, 0x00, /*"F",38*/
-
-    0x00, 0x00, 0x00, 0x3C, 0x44, 0x44, 0x80, 0x80, 0x80, 0x8E, 0x84, 0x44, 0x44, 0x38, 0x00, 0x00, /*"G",39*/
-
-    0x00, 0x00, 0x00, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x42, 0xE7, 0x00, 0x00, /*"H",40*/
-
-    0x00, 0x00, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, /*"I",41*/
-
-    0x00, 0x00, 0x00, 0x3E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0xF0, /*"J",42*/
-
-    0x00, 0x00, 0x00, 0xEE, 0x44, 0x48, 0x50, 0x70, 0x50, 0x48, 0x48, 0x44, 0x44, 0xEE, 0x00, 0x00, /*"K",43*/
-
-    0x00, 0x00, 0x00, 0xE0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x42, 0xFE, 0x00, 0x00, /*"L",44*/
-
-    0x00, 0x00, 0x00, 0xEE, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x54, 0x54, 0x54, 0x54, 0xD6, 0x00, 0x00, /*"M",45*/
-
-    0x00, 0x00, 0x00, 0xC7, 0x62, 0x62, 0x52, 0x52, 0x4A, 0x4A, 0x4A, 0x46, 0x46, 0xE2, 0x00, 0x00, /*"N",46*/
-
-    0x00, 0x00, 0x00, 0x38, 0x44, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0x00, 0x00, /*"O",47*/
-
-    0x00, 0x00, 0x00, 0xFC, 0x42, 0x42, 0x42, 0x42, 0x7C, 0x40, 0x40, 0x40, 0x40, 0xE0, 0x00, 0x00, /*"P",48*/
-
-    0x00, 0x00, 0x00, 0x38, 0x44, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xB2, 0x4C, 0x38, 0x06, 0x00, /*"Q",49*/
-
-    0x00, 0x00, 0x00, 0xFC, 0x42, 0x42, 0x42, 0x7C, 0x48, 0x48, 0x44, 0x44, 0x42, 0xE3, 0x00, 0x00, /*"R",50*/
-
-    0x00, 0x00, 0x00, 0x3E, 0x42, 0x42, 0x40, 0x20, 0x18, 0x04, 0x02, 0x42, 0x42, 0x7C, 0x00, 0x00, /*"S",51*/
-
-    0x00, 0x00, 0x00, 0xFE, 0x92, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, /*"T",52*/
-
-    0x00, 0x00, 0x00, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00, 0x00, /*"U",53*/
-
-    0x00, 0x00, 0x00, 0xE7, 0x42, 0x42, 0x44, 0x24, 0x24, 0x28, 0x28, 0x18, 0x10, 0x10, 0x00, 0x00, /*"V",54*/
-
-    0x00, 0x00, 0x00, 0xD6, 0x54, 0x54, 0x54, 0x54, 0x54, 0x6C, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00, /*"W",55*/
-
-    0x00, 0x00, 0x00, 0xE7, 0x42, 0x24, 0x24, 0x18, 0x18, 0x18, 0x24, 0x24, 0x42, 0xE7, 0x00, 0x00, /*"X",56*/
-
-    0x00, 0x00, 0x00, 0xEE, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, /*"Y",57*/
-
-    0x00, 0x00, 0x00, 0x7E, 0x84, 0x04, 0x08, 0x08, 0x10, 0x20, 0x20, 0x42, 0x42, 0xFC, 0x00, 0x00, /*"Z",58*/
-
-    0x00, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x00, /*"[",59*/
-
-    0x00, 0x00, 0x40, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x02, 0x02, /*"\",60*/
-
-    0x00, 0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x00, /*"]",61*/
-
-    0x00, 0x18, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"^",62*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, /*"_",63*/
-
-    0x00, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"`",64*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x0C, 0x34, 0x44, 0x4C, 0x36, 0x00, 0x00, /*"a",65*/
-
-    0x00, 0x00, 0x00, 0x00, 0xC0, 0x40, 0x40, 0x58, 0x64, 0x42, 0x42, 0x42, 0x64, 0x58, 0x00, 0x00, /*"b",66*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x22, 0x40, 0x40, 0x40, 0x22, 0x1C, 0x00, 0x00, /*"c",67*/
-
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x02, 0x3E, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3B, 0x00, 0x00, /*"d",68*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x7E, 0x40, 0x42, 0x3C, 0x00, 0x00, /*"e",69*/
-
-    0x00, 0x00, 0x00, 0x00, 0x0C, 0x12, 0x10, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, /*"f",70*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x44, 0x44, 0x38, 0x40, 0x3C, 0x42, 0x42, 0x3C, /*"g",71*/
-
-    0x00, 0x00, 0x00, 0x00, 0xC0, 0x40, 0x40, 0x5C, 0x62, 0x42, 0x42, 0x42, 0x42, 0xE7, 0x00, 0x00, /*"h",72*/
-
-    0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, /*"i",73*/
-
-    0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x1C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x44, 0x78, /*"j",74*/
-
-    0x00, 0x00, 0x00, 0x00, 0xC0, 0x40, 0x40, 0x4E, 0x48, 0x50, 0x70, 0x48, 0x44, 0xEE, 0x00, 0x00, /*"k",75*/
-
-    0x00, 0x00, 0x00, 0x10, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, /*"l",76*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x49, 0x49, 0x49, 0x49, 0x49, 0xED, 0x00, 0x00, /*"m",77*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x62, 0x42, 0x42, 0x42, 0x42, 0xE7, 0x00, 0x00, /*"n",78*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00, 0x00, /*"o",79*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x64, 0x42, 0x42, 0x42, 0x64, 0x58, 0x40, 0xE0, /*"p",80*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x26, 0x42, 0x42, 0x42, 0x26, 0x1A, 0x02, 0x07, /*"q",81*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x32, 0x20, 0x20, 0x20, 0x20, 0xF8, 0x00, 0x00, /*"r",82*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x42, 0x40, 0x3C, 0x02, 0x42, 0x7C, 0x00, 0x00, /*"s",83*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x12, 0x0C, 0x00, 0x00, /*"t",84*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3B, 0x00, 0x00, /*"u",85*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x00, 0x00, /*"v",86*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0x89, 0x4A, 0x5A, 0x54, 0x24, 0x24, 0x00, 0x00, /*"w",87*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x24, 0x18, 0x18, 0x18, 0x24, 0x6E, 0x00, 0x00, /*"x",88*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x42, 0x24, 0x24, 0x18, 0x18, 0x10, 0x10, 0x60, /*"y",89*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x44, 0x08, 0x10, 0x10, 0x22, 0x7E, 0x00, 0x00, /*"z",90*/
-
-    0x00, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x00, /*"{",91*/
-
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, /*"|",92*/
-
-    0x00, 0xC0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0xC0, 0x00, /*"}",93*/
+    0xFE, 0x60, /*"!",1*/
+    0x25, 0x24, 0xA4, /*""",2*/
+    0x24, 0x92, 0x7F, 0x49, 0x24, 0xBF, 0x49, 0x24, 0x80, /*"#",3*/
+    0x11, 0xE9, 0x65, 0x91, 0xC1, 0x85, 0x16, 0x59, 0x5E, 0x10, 0x40, /*"$",4*/
+    0x45, 0x4A, 0xA5, 0x4B, 0x0A, 0x86, 0x95, 0x2A, 0x95, 0x10, /*"%",5*/
+    0x30, 0x48, 0x48, 0x48, 0x50, 0x6E, 0xA4, 0x94, 0x98, 0x89, 0x76, /*"&",6*/
+    0xD6, /*"'",7*/
+    0x12, 0x44, 0x88, 0x88, 0x88, 0x44, 0x21, /*"(",8*/
+    0x84, 0x22, 0x11, 0x11, 0x11, 0x22, 0x48, /*")",9*/
+    0x10, 0x23, 0x59, 0xC3, 0x9A, 0xC4, 0x08, /*"*",10*/
+    0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00, /*"+",11*/
+    0xD6, /*",",12*/
+    0xFC, /*"-",13*/
+    0xF0, /*".",14*/
+    0x04, 0x20, 0x82, 0x10, 0x42, 0x08, 0x21, 0x04, 0x20, 0x80, /*"/",15*/
+    0x31, 0x28, 0x61, 0x86, 0x18, 0x61, 0x85, 0x23, 0x00, /*"0",16*/
+    0x27, 0x08, 0x42, 0x10, 0x84, 0x21, 0x3E, /*"1",17*/
+    0x7A, 0x18, 0x61, 0x04, 0x21, 0x08, 0x42, 0x1F, 0xC0, /*"2",18*/
+    0x7A, 0x18, 0x41, 0x08, 0xC0, 0x81, 0x86, 0x17, 0x80, /*"3",19*/
+    0x08, 0x30, 0x61, 0x44, 0x89, 0x22, 0x7F, 0x08, 0x10, 0xF8, /*"4",20*/
+    0xFE, 0x08, 0x20, 0xF2, 0x20, 0x41, 0x86, 0x27, 0x00, /*"5",21*/
+    0x31, 0x28, 0x20, 0xBB, 0x18, 0x61, 0x85, 0x13, 0x80, /*"6",22*/
+    0xFE, 0x10, 0x82, 0x10, 0x42, 0x08, 0x20, 0x82, 0x00, /*"7",23*/
+    0x7A, 0x18, 0x61, 0x48, 0xC4, 0xA1, 0x86, 0x17, 0x80, /*"8",24*/
+    0x72, 0x28, 0x61, 0x86, 0x37, 0x41, 0x05, 0x23, 0x00, /*"9",25*/
+    0xF0, 0x0F, /*":",26*/
+    0x83, 0x80, /*";",27*/
+    0x04, 0x21, 0x08, 0x42, 0x04, 0x08, 0x10, 0x20, 0x40, /*"<",28*/
+    0x06, 0xC6, /*"=",29*/
+    0x81, 0x02, 0x04, 0x08, 0x10, 0x84, 0x21, 0x08, 0x00, /*">",30*/
+    0x7A, 0x18, 0x71, 0x08, 0x41, 0x04, 0x00, 0xC3, 0x00, /*"?",31*/
+    0x38, 0x89, 0x6D, 0x5A, 0xB5, 0x6A, 0xD5, 0x5C, 0x84, 0xF0, /*"@",32*/
+    0x10, 0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, /*"A",33*/
+    0xF8, 0x89, 0x12, 0x27, 0x88, 0x90, 0xA1, 0x42, 0x8B, 0xE0, /*"B",34*/
+    0x3E, 0x85, 0x0C, 0x08, 0x10, 0x20, 0x40, 0x42, 0x88, 0xE0, /*"C",35*/
+    0xF8, 0x89, 0x0A, 0x14, 0x28, 0x50, 0xA1, 0x42, 0x8B, 0xE0, /*"D",36*/
+    0xFC, 0x85, 0x22, 0x47, 0x89, 0x12, 0x20, 0x42, 0x87, 0xF0, /*"E",37*/
+    0xFC, 0x85, 0x22, 0x47, 0x89, 0x12, 0x20, 0x40, 0x83, 0x80, /*"F",38*/
+    0x3C, 0x89, 0x14, 0x08, 0x10, 0x23, 0xC2, 0x44, 0x88, 0xE0, /*"G",39*/
+    0xE7, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x42, 0xE7, /*"H",40*/
+    0xF9, 0x08, 0x42, 0x10, 0x84, 0x21, 0x3E, /*"I",41*/
+    0x3E, 0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x24, 0x4F, 0x00, /*"J",42*/
+    0xEE, 0x89, 0x22, 0x87, 0x0A, 0x12, 0x24, 0x44, 0x8B, 0xB8, /*"K",43*/
+    0xE0, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x87, 0xF8, /*"L",44*/
+    0xEE, 0xD9, 0xB3, 0x66, 0xCD, 0x95, 0x2A, 0x54, 0xAB, 0x58, /*"M",45*/
+    0xC7, 0x62, 0x62, 0x52, 0x52, 0x4A, 0x4A, 0x4A, 0x46, 0x46, 0xE2, /*"N",46*/
+    0x38, 0x8A, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x82, 0x88, 0xE0, /*"O",47*/
+    0xFC, 0x85, 0x0A, 0x14, 0x2F, 0x90, 0x20, 0x40, 0x83, 0x80, /*"P",48*/
+    0x38, 0x8A, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0xB2, 0x98, 0xE0, 0x30, /*"Q",49*/
+    0xFC, 0x42, 0x42, 0x42, 0x7C, 0x48, 0x48, 0x44, 0x44, 0x42, 0xE3, /*"R",50*/
+    0x7E, 0x18, 0x60, 0x40, 0xC0, 0x81, 0x86, 0x1F, 0x80, /*"S",51*/
+    0xFF, 0x24, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0xE0, /*"T",52*/
+    0xE7, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, /*"U",53*/
+    0xE7, 0x42, 0x42, 0x44, 0x24, 0x24, 0x28, 0x28, 0x18, 0x10, 0x10, /*"V",54*/
+    0xD6, 0xA9, 0x52, 0xA5, 0x4A, 0x9B, 0x14, 0x28, 0x50, 0xA0, /*"W",55*/
+    0xE7, 0x42, 0x24, 0x24, 0x18, 0x18, 0x18, 0x24, 0x24, 0x42, 0xE7, /*"X",56*/
+    0xEE, 0x89, 0x11, 0x42, 0x82, 0x04, 0x08, 0x10, 0x20, 0xE0, /*"Y",57*/
+    0x7F, 0x08, 0x10, 0x40, 0x82, 0x08, 0x10, 0x42, 0x87, 0xF0, /*"Z",58*/
+    0xF8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8F, /*"[",59*/
+    0x81, 0x04, 0x10, 0x20, 0x82, 0x04, 0x10, 0x20, 0x82, 0x04, 0x10, /*"\",60*/
+    0xF1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1F, /*"]",61*/
+    0x69, /*"^",62*/
+    0xFF, /*"_",63*/
+    0xC4, /*"`",64*/
+    0x72, 0x21, 0x9A, 0x8A, 0x66, 0xC0, /*"a",65*/
+    0xC0, 0x81, 0x02, 0xC6, 0x48, 0x50, 0xA1, 0x64, 0xB0, /*"b",66*/
+    0x39, 0x18, 0x20, 0x81, 0x13, 0x80, /*"c",67*/
+    0x0C, 0x08, 0x13, 0xE8, 0x50, 0xA1, 0x42, 0x8C, 0xEC, /*"d",68*/
+    0x7A, 0x18, 0x7F, 0x82, 0x17, 0x80, /*"e",69*/
+    0x18, 0x92, 0x3E, 0x20, 0x82, 0x08, 0x23, 0xE0, /*"f",70*/
+    0x7E, 0x28, 0x9C, 0x81, 0xE8, 0x61, 0x78, /*"g",71*/
+    0xC0, 0x40, 0x40, 0x5C, 0x62, 0x42, 0x42, 0x42, 0x42, 0xE7, /*"h",72*/
+    0x63, 0x00, 0x0E, 0x10, 0x84, 0x21, 0x3E, /*"i",73*/
+    0x18, 0xC0, 0x03, 0x84, 0x21, 0x08, 0x43, 0x1F, 0x00, /*"j",74*/
+    0xC0, 0x81, 0x02, 0x74, 0x8A, 0x1C, 0x24, 0x45, 0xDC, /*"k",75*/
+    0x27, 0x08, 0x42, 0x10, 0x84, 0x21, 0x3E, /*"l",76*/
+    0xFE, 0x49, 0x49, 0x49, 0x49, 0x49, 0xED, /*"m",77*/
+    0xDC, 0x62, 0x42, 0x42, 0x42, 0x42, 0xE7, /*"n",78*/
+    0x7A, 0x18, 0x61, 0x86, 0x17, 0x80, /*"o",79*/
+    0xD8, 0xC9, 0x0A, 0x14, 0x2C, 0x96, 0x20, 0xE0, /*"p",80*/
+    0x34, 0x9A, 0x14, 0x28, 0x49, 0x8D, 0x02, 0x0E, /*"q",81*/
+    0xEE, 0x64, 0x81, 0x02, 0x04, 0x3E, 0x00, /*"r",82*/
+    0x7E, 0x18, 0x1E, 0x06, 0x1F, 0x80, /*"s",83*/
+    0x20, 0x8F, 0x88, 0x20, 0x82, 0x09, 0x18, /*"t",84*/
+    0xC6, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3B, /*"u",85*/
+    0xEE, 0x89, 0x11, 0x42, 0x82, 0x04, 0x00, /*"v",86*/
+    0xDB, 0x89, 0x4A, 0x5A, 0x54, 0x24, 0x24, /*"w",87*/
+    0xED, 0x23, 0x0C, 0x31, 0x2D, 0xC0, /*"x",88*/
+    0xE7, 0x42, 0x24, 0x24, 0x18, 0x18, 0x10, 0x10, 0x60, /*"y",89*/
+    0xFE, 0x21, 0x08, 0x21, 0x1F, 0xC0, /*"z",90*/
+    0x34, 0x44, 0x44, 0x48, 0x44, 0x44, 0x43, /*"{",91*/
+    0xFF, 0xFF, /*"|",92*/
+    0xC2, 0x22, 0x22, 0x21, 0x22, 0x22, 0x2C, /*"}",93*/
+    0x42, 0xD0, 0x80, /*"~",94*/
+};
 
-    0x20, 0x5A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"~",94*/
+static const esp_painter_glyph_t glyphs[] = {
+    {0x0000, 0, 0, 0, 0}, /*" ",0*/
+    {0x0000, 3, 3, 1, 11}, /*"!",1*/
+    {0x0002, 1, 1, 6, 4}, /*""",2*/
+    {0x0005, 1, 3, 6, 11}, /*"#",3*/
+    {0x000E, 1, 2, 6, 14}, /*"$",4*/
+    {0x0019, 0, 3, 7, 11}, /*"%",5*/
+    {0x0023, 0, 3, 8, 11}, /*"&",6*/
+    {0x002E, 1, 1, 2, 4}, /*"'",7*/
+    {0x002F, 3, 1, 4, 14}, /*"(",8*/
+    {0x0036, 1, 1, 4, 14}, /*")",9*/
+    {0x003D, 0, 4, 7, 8}, /*"*",10*/
+    {0x0044, 1, 5, 7, 7}, /*"+",11*/
+    {0x004B, 1, 12, 2, 4}, /*",",12*/
+    {0x004C, 1, 8, 6, 1}, /*"-",13*/
+    {0x004D, 1, 12, 2, 2}, /*".",14*/
+    {0x004E, 1, 2, 6, 13}, /*"/",15*/
+    {0x0058, 1, 3, 6, 11}, /*"0",16*/
+    {0x0061, 2, 3, 5, 11}, /*"1",17*/
+    {0x0068, 1, 3, 6, 11}, /*"2",18*/
+    {0x0071, 1, 3, 6, 11}, /*"3",19*/
+    {0x007A, 1, 3, 7, 11}, /*"4",20*/
+    {0x0084, 1, 3, 6, 11}, /*"5",21*/
+    {0x008D, 1, 3, 6, 11}, /*"6",22*/
+    {0x0096, 1, 3, 6, 11}, /*"7",23*/
+    {0x009F, 1, 3, 6, 11}, /*"8",24*/
+    {0x00A8, 1, 3, 6, 11}, /*"9",25*/
+    {0x00B1, 3, 6, 2, 8}, /*":",26*/
+    {0x00B3, 3, 7, 1, 9}, /*";",27*/
+    {0x00B5, 1, 3, 6, 11}, /*"<",28*/
+    {0x80BE, 1, 6, 6, 4}, /*"=",29*/
+    {0x00C0, 1, 3, 6, 11}, /*">",30*/
+    {0x00C9, 1, 3, 6, 11}, /*"?",31*/
+    {0x00D2, 0, 3, 7, 11}, /*"@",32*/
+    {0x00DC, 0, 3, 8, 11}, /*"A",33*/
+    {0x00E7, 0, 3, 7, 11}, /*"B",34*/
+    {0x00F1, 0, 3, 7, 11}, /*"C",35*/
+    {0x00FB, 0, 3, 7, 11}, /*"D",36*/
+    {0x0105, 0, 3, 7, 11}, /*"E",37*/
+    {0x010F, 0, 3, 7, 11}, /*"F",38*/
+    {0x0119, 0, 3, 7, 11}, /*"G",39*/
+    {0x0123, 0, 3, 8, 11}, /*"H",40*/
+    {0x012E, 1, 3, 5, 11}, /*"I",41*/
+    {0x0135, 0, 3, 7, 13}, /*"J",42*/
+    {0x0141, 0, 3, 7, 11}, /*"K",43*/
+    {0x014B, 0, 3, 7, 11}, /*"L",44*/
+    {0x0155, 0, 3, 7, 11}, /*"M",45*/
+    {0x015F, 0, 3, 8, 11}, /*"N",46*/
+    {0x016A, 0, 3, 7, 11}, /*"O",47*/
+    {0x0174, 0, 3, 7, 11}, /*"P",48*/
+    {0x017E, 0, 3, 7, 12}, /*"Q",49*/
+    {0x0189, 0, 3, 8, 11}, /*"R",50*/
+    {0x0194, 1, 3, 6, 11}, /*"S",51*/
+    {0x019D, 0, 3, 7, 11}, /*"T",52*/
+    {0x01A7, 0, 3, 8, 11}, /*"U",53*/
+    {0x01B2, 0, 3, 8, 11}, /*"V",54*/
+    {0x01BD, 0, 3, 7, 11}, /*"W",55*/
+    {0x01C7, 0, 3, 8, 11}, /*"X",56*/
+    {0x01D2, 0, 3, 7, 11}, /*"Y",57*/
+    {0x01DC, 0, 3, 7, 11}, /*"Z",58*/
+    {0x01E6, 3, 1, 4, 14}, /*"[",59*/
+    {0x01ED, 1, 2, 6, 14}, /*"\",60*/
+    {0x01F8, 1, 1, 4, 14}, /*"]",61*/
+    {0x01FF, 2, 1, 4, 2}, /*"^",62*/
+    {0x0200, 0, 15, 8, 1}, /*"_",63*/
+    {0x0201, 1, 1, 3, 2}, /*"`",64*/
+    {0x0202, 1, 7, 6, 7}, /*"a",65*/
+    {0x0208, 0, 4, 7, 10}, /*"b",66*/
+    {0x0211, 1, 7, 6, 7}, /*"c",67*/
+    {0x0217, 1, 4, 7, 10}, /*"d",68*/
+    {0x0220, 1, 7, 6, 7}, /*"e",69*/
+    {0x0226, 1, 4, 6, 10}, /*"f",70*/
+    {0x022E, 1, 7, 6, 9}, /*"g",71*/
+    {0x0235, 0, 4, 8, 10}, /*"h",72*/
+    {0x023F, 1, 3, 5, 11}, /*"i",73*/
+    {0x0246, 1, 3, 5, 13}, /*"j",74*/
+    {0x024F, 0, 4, 7, 10}, /*"k",75*/
+    {0x0258, 1, 3, 5, 11}, /*"l",76*/
+    {0x025F, 0, 7, 8, 7}, /*"m",77*/
+    {0x0266, 0, 7, 8, 7}, /*"n",78*/
+    {0x026D, 1, 7, 6, 7}, /*"o",79*/
+    {0x0273, 0, 7, 7, 9}, /*"p",80*/
+    {0x027B, 1, 7, 7, 9}, /*"q",81*/
+    {0x0283, 0, 7, 7, 7}, /*"r",82*/
+    {0x028A, 1, 7, 6, 7}, /*"s",83*/
+    {0x0290, 1, 5, 6, 9}, /*"t",84*/
+    {0x0297, 0, 7, 8, 7}, /*"u",85*/
+    {0x029E, 0, 7, 7, 7}, /*"v",86*/
+    {0x02A5, 0, 7, 8, 7}, /*"w",87*/
+    {0x02AC, 1, 7, 6, 7}, /*"x",88*/
+    {0x02B2, 0, 7, 8, 9}, /*"y",89*/
+    {0x02BB, 1, 7, 6, 7}, /*"z",90*/
+    {0x02C1, 4, 1, 4, 14}, /*"{",91*/
+    {0x02C8, 4, 0, 1, 16}, /*"|",92*/
+    {0x02CA, 0, 1, 4, 14}, /*"}",93*/
+    {0x02D1, 1, 0, 6, 3}, /*"~",94*/
 };
 
 const esp_painter_basic_font_t esp_painter_basic_font_16 = {
     .bitmap = bitmap,
+    .glyphs = glyphs,
     .width = 8,
     .height = 16,
+    .first = 0x20,
+    .count = 95,
 };
 
 #endif
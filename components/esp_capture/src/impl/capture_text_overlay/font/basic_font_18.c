@@ -0,0 +1,218 @@
+/* Generated from DejaVuSansMono.ttf; the license of that font applies */
+
+/* Packed by tools/pack_font.py: 9x18 cells, 1639 bytes (1-bit bitmap: 3420) */
+
+#include "sdkconfig.h"
+
+#include "esp_painter_font.h"
+
+#if CONFIG_ESP_PAINTER_BASIC_FONT_18
+
+static const uint8_t bitmap[] = {
+    0xFF, 0x98, /*"!",1*/
+    0xDE, 0xF7, 0xBD, 0x80, /*""",2*/
+    0x19, 0x0C, 0x84, 0x42, 0x6F, 0xFF, 0xFC, 0xC8, 0x4C, 0xFF, 0xFF, 0xD9, 0x08, 0x84, 0xC6, 0x40, /*"#",3*/
+    0x10, 0x10, 0x7C, 0xFE, 0xD2, 0x90, 0xD0, 0x70, 0x1E, 0x12, 0x13, 0x93, 0xFE, 0x7C, 0x10, 0x10,
+    0x10, /*"$",4*/
+    0x70, 0x48, 0x22, 0x11, 0x09, 0x03, 0x9C, 0x71, 0xCE, 0x0C, 0x84, 0x42, 0x21, 0x90, 0x70, /*"%",5*/
+    0x3E, 0x3F, 0x18, 0x0C, 0x02, 0x03, 0x83, 0x63, 0x19, 0x86, 0xC1, 0xF0, 0xDF, 0xF3, 0xC8, /*"&",6*/
+    0xF8, /*"'",7*/
+    0x32, 0x64, 0xCC, 0xC8, 0x8C, 0xCC, 0x46, 0x23, /*"(",8*/
+    0xC4, 0x62, 0x33, 0x33, 0x33, 0x33, 0x26, 0x4C, /*")",9*/
+    0x11, 0x27, 0x59, 0xC3, 0x9A, 0xE4, 0x88, /*"*",10*/
+    0x41, 0x81, 0x81, 0x81, 0x4F, 0x34, 0x18, 0x18, 0x18, 0x14, /*"+",11*/
+    0xFF, 0x68, /*",",12*/
+    0x0A, /*"-",13*/
+    0x09, /*".",14*/
+    0x01, 0x03, 0x02, 0x06, 0x04, 0x0C, 0x08, 0x18, 0x18, 0x30, 0x30, 0x20, 0x60, 0x40, 0xC0, /*"/",15*/
+    0x3C, 0x3F, 0x18, 0xD8, 0x6C, 0x1E, 0x4F, 0x67, 0x83, 0xC1, 0xE1, 0x98, 0xCF, 0xC3, 0xC0, /*"0",16*/
+    0x38, 0xF8, 0xD8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, /*"1",17*/
+    0x3C, 0xFF, 0x43, 0x03, 0x03, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xFF, 0xFF, /*"2",18*/
+    0x3C, 0x7F, 0x43, 0x03, 0x03, 0x3E, 0x3E, 0x03, 0x01, 0x01, 0x83, 0xFF, 0x7C, /*"3",19*/
+    0x06, 0x07, 0x03, 0x82, 0xC3, 0x61, 0x31, 0x19, 0x8C, 0xFF, 0xFF, 0xC1, 0x80, 0xC0, 0x60, /*"4",20*/
+    0x7E, 0x7E, 0x40, 0x40, 0x7C, 0x7E, 0x47, 0x03, 0x01, 0x03, 0x83, 0xFE, 0x7C, /*"5",21*/
+    0x1E, 0x1F, 0x9C, 0x4C, 0x0C, 0x06, 0xF3, 0xFD, 0xC6, 0xC1, 0xE0, 0xD8, 0xCF, 0xE3, 0xE0, /*"6",22*/
+    0xFF, 0xFF, 0x03, 0x02, 0x06, 0x06, 0x04, 0x0C, 0x0C, 0x18, 0x18, 0x10, 0x30, /*"7",23*/
+    0x3E, 0x3F, 0x98, 0xC8, 0x26, 0x31, 0xF0, 0xF8, 0xC6, 0xC1, 0xE0, 0xF8, 0xEF, 0xE3, 0xE0, /*"8",24*/
+    0x3C, 0x3F, 0x38, 0xD8, 0x2C, 0x17, 0x1D, 0xFE, 0x7B, 0x01, 0x01, 0x91, 0xCF, 0xC3, 0xC0, /*"9",25*/
+    0x09, 0x99, /*":",26*/
+    0xFF, 0x80, 0x3F, 0xDA, 0x00, /*";",27*/
+    0x81, 0x54, 0x34, 0x24, 0x52, 0x74, 0x84, 0x74, 0x81, /*"<",28*/
+    0x0F, 0x3F, 0x3F, 0x30, /*"=",29*/
+    0x01, 0x83, 0x84, 0x83, 0x82, 0x53, 0x34, 0x34, 0x51, 0x80, /*">",30*/
+    0x7D, 0xFE, 0x18, 0x30, 0x61, 0x86, 0x08, 0x30, 0x60, 0x01, 0x83, 0x00, /*"?",31*/
+    0x1E, 0x30, 0xD0, 0x31, 0xF9, 0x9C, 0x86, 0x43, 0x21, 0x90, 0xCC, 0xE3, 0xF8, 0x04, 0x01, 0x80,
+    0x7C, /*"@",32*/
+    0x1C, 0x0E, 0x05, 0x06, 0xC3, 0x61, 0x11, 0x8C, 0xC6, 0x7F, 0x7F, 0xB0, 0x78, 0x38, 0x08, /*"A",33*/
+    0xFE, 0x7F, 0xB0, 0xD8, 0x2C, 0x37, 0xF3, 0xFD, 0x86, 0xC1, 0xE0, 0xF0, 0xFF, 0xEF, 0xE0, /*"B",34*/
+    0x1F, 0x3F, 0x71, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x70, 0x3F, 0x1F, /*"C",35*/
+    0xFC, 0x7F, 0x31, 0xD8, 0x6C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE1, 0xB1, 0xDF, 0xCF, 0xC0, /*"D",36*/
+    0x0F, 0x36, 0x26, 0x26, 0x71, 0x71, 0x26, 0x26, 0x26, 0x26, 0xF1, /*"E",37*/
+    0x0F, 0x36, 0x26, 0x26, 0x71, 0x71, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, /*"F",38*/
+    0x1E, 0x1F, 0x98, 0x58, 0x0C, 0x06, 0x3F, 0x1F, 0x83, 0xC1, 0xE0, 0xD8, 0x67, 0xE1, 0xE0, /*"G",39*/
+    0x02, 0x54, 0x54, 0x54, 0x54, 0x5F, 0x75, 0x45, 0x45, 0x45, 0x45, 0x45, 0x20, /*"H",40*/
+    0x0E, 0x31, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x3E, /*"I",41*/
+    0x3E, 0x7C, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x06, 0x1F, 0xF7, 0xC0, /*"J",42*/
+    0xC1, 0xE1, 0xB1, 0x99, 0x8D, 0x87, 0xC3, 0xE1, 0x98, 0xC6, 0x63, 0x30, 0xD8, 0x3C, 0x18, /*"K",43*/
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, /*"L",44*/
+    0xC1, 0xF1, 0xF8, 0xF4, 0xFB, 0x5C, 0xAE, 0x77, 0x13, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x18, /*"M",45*/
+    0xE1, 0xF0, 0xFC, 0x7E, 0x3D, 0x1E, 0xCF, 0x27, 0x9B, 0xCD, 0xE3, 0xF1, 0xF8, 0x7C, 0x38, /*"N",46*/
+    0x3C, 0x3F, 0x98, 0xD8, 0x2C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0x98, 0xCF, 0xE3, 0xC0, /*"O",47*/
+    0xFC, 0xFE, 0xC7, 0xC3, 0xC3, 0xC7, 0xFE, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, /*"P",48*/
+    0x3C, 0x3F, 0x98, 0xD8, 0x2C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0x98, 0xCF, 0xC3, 0xE0, 0x30,
+    0x0C, /*"Q",49*/
+    0xFC, 0x7F, 0xB0, 0xD8, 0x6C, 0x36, 0x1B, 0xF9, 0xF8, 0xC6, 0x61, 0xB0, 0x58, 0x3C, 0x08, /*"R",50*/
+    0x3E, 0x3F, 0xB8, 0x58, 0x0C, 0x03, 0x80, 0xF8, 0x06, 0x01, 0x80, 0xF0, 0xDF, 0xE3, 0xE0, /*"S",51*/
+    0x0F, 0x34, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x14, /*"T",52*/
+    0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0x98, 0xCF, 0xE3, 0xE0, /*"U",53*/
+    0x81, 0xE0, 0xF0, 0x68, 0x26, 0x33, 0x19, 0x88, 0x4C, 0x36, 0x1B, 0x05, 0x03, 0x81, 0xC0, /*"V",54*/
+    0x80, 0xC0, 0x60, 0x30, 0x19, 0x8C, 0xEE, 0x77, 0xAB, 0xF5, 0xF3, 0x98, 0xCC, 0x66, 0x30, /*"W",55*/
+    0xC1, 0xB0, 0x98, 0xC6, 0xC1, 0xC0, 0xE0, 0x70, 0x38, 0x36, 0x31, 0x98, 0xD8, 0x38, 0x18, /*"X",56*/
+    0x81, 0xE0, 0xD8, 0xCC, 0x43, 0x60, 0xE0, 0x70, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x80, /*"Y",57*/
+    0x18, 0x18, 0x71, 0x72, 0x62, 0x71, 0x71, 0x72, 0x71, 0x71, 0x72, 0x7F, 0x20, /*"Z",58*/
+    0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF, /*"[",59*/
+    0xC0, 0x40, 0x60, 0x20, 0x30, 0x30, 0x18, 0x18, 0x08, 0x0C, 0x04, 0x06, 0x02, 0x03, 0x01, /*"\",60*/
+    0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFF, /*"]",61*/
+    0x1C, 0x1E, 0x09, 0x8C, 0x6C, 0x18, /*"^",62*/
+    0x09, /*"_",63*/
+    0xC8, 0x80, /*"`",64*/
+    0x3C, 0x7F, 0x43, 0x01, 0x3F, 0x7F, 0xC1, 0xC3, 0x7F, 0x39, /*"a",65*/
+    0x80, 0x80, 0x80, 0x80, 0x9C, 0xFE, 0xC6, 0xC3, 0x83, 0x83, 0xC3, 0xC6, 0xFE, 0x9C, /*"b",66*/
+    0x3C, 0xFF, 0x86, 0x0C, 0x10, 0x30, 0x70, 0x7E, 0x78, /*"c",67*/
+    0x01, 0x01, 0x01, 0x01, 0x39, 0x7F, 0xE3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE3, 0x7F, 0x39, /*"d",68*/
+    0x34, 0x37, 0x22, 0x32, 0x12, 0x5F, 0x78, 0x24, 0x12, 0x74, 0x42, /*"e",69*/
+    0x0E, 0x3C, 0xC1, 0x8F, 0xFF, 0xCC, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x00, /*"f",70*/
+    0x39, 0x7F, 0x63, 0xC3, 0xC3, 0xC3, 0xC3, 0x63, 0x7F, 0x39, 0x03, 0x43, 0x7E, /*"g",71*/
+    0x81, 0x02, 0x04, 0x09, 0xDF, 0xF1, 0xE3, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x40, /*"h",72*/
+    0x31, 0x71, 0xF5, 0x44, 0x47, 0x17, 0x17, 0x17, 0x17, 0x17, 0x14, 0xF1, /*"i",73*/
+    0x18, 0xC0, 0x0F, 0xFC, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0xF0, /*"j",74*/
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC6, 0xCC, 0xD8, 0xF0, 0xF8, 0xD8, 0xCC, 0xC6, 0xC2, 0xC3, /*"k",75*/
+    0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0F, 0x0F, /*"l",76*/
+    0xB3, 0x7F, 0xF7, 0x71, 0x38, 0x9C, 0x4E, 0x27, 0x13, 0x89, 0xC4, 0xC0, /*"m",77*/
+    0x9D, 0xFF, 0x1E, 0x38, 0x30, 0x60, 0xC1, 0x83, 0x04, /*"n",78*/
+    0x3E, 0x3F, 0x98, 0xD8, 0x2C, 0x1E, 0x0F, 0x04, 0xC6, 0x7F, 0x1F, 0x00, /*"o",79*/
+    0x9C, 0xFE, 0xC6, 0xC3, 0x83, 0x83, 0xC3, 0xC6, 0xFE, 0xBC, 0x80, 0x80, 0x80, /*"p",80*/
+    0x39, 0x7F, 0x63, 0xC3, 0xC1, 0xC1, 0xC3, 0x63, 0x7F, 0x39, 0x01, 0x01, 0x01, /*"q",81*/
+    0xDF, 0xFF, 0x8E, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x80, /*"r",82*/
+    0x7D, 0xFF, 0x06, 0x07, 0x03, 0x81, 0xC3, 0xFE, 0xF0, /*"s",83*/
+    0x10, 0x10, 0x10, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x1F, 0x0F, /*"t",84*/
+    0x83, 0x06, 0x0C, 0x18, 0x30, 0x61, 0xE3, 0xFE, 0xE4, /*"u",85*/
+    0xC1, 0xE0, 0x90, 0xCC, 0x66, 0x21, 0x30, 0xD8, 0x68, 0x1C, 0x0E, 0x00, /*"v",86*/
+    0x80, 0xC0, 0x60, 0x31, 0x3D, 0xDE, 0xAF, 0x54, 0xEE, 0x63, 0x31, 0x80, /*"w",87*/
+    0xC1, 0x31, 0x8D, 0x83, 0x81, 0xC0, 0xE0, 0xD8, 0x44, 0x63, 0x60, 0xC0, /*"x",88*/
+    0xC1, 0xA0, 0xD8, 0xCC, 0x62, 0x21, 0xB0, 0x58, 0x38, 0x1C, 0x06, 0x06, 0x03, 0x07, 0x00, /*"y",89*/
+    0x0E, 0x51, 0x51, 0x51, 0x52, 0x51, 0x51, 0x5E, /*"z",90*/
+    0x0E, 0x3C, 0x60, 0x81, 0x02, 0x0C, 0x78, 0xE0, 0x60, 0x40, 0x81, 0x02, 0x06, 0x0F, 0x0E, /*"{",91*/
+    0x0F, 0x20, /*"|",92*/
+    0xE1, 0xE0, 0xC0, 0x81, 0x02, 0x06, 0x0F, 0x1E, 0x30, 0x40, 0x81, 0x06, 0x0C, 0x78, 0xE0, /*"}",93*/
+    0x78, 0xFF, 0xE3, 0xC0, /*"~",94*/
+};
+
+static const esp_painter_glyph_t glyphs[] = {
+    {0x0000, 0, 0, 0, 0}, /*" ",0*/
+    {0x0000, 4, 2, 1, 13}, /*"!",1*/
+    {0x0002, 2, 2, 5, 5}, /*""",2*/
+    {0x0006, 0, 1, 9, 14}, /*"#",3*/
+    {0x0016, 1, 1, 8, 17}, /*"$",4*/
+    {0x0027, 0, 2, 9, 13}, /*"%",5*/
+    {0x0036, 0, 2, 9, 13}, /*"&",6*/
+    {0x0045, 4, 2, 1, 5}, /*"'",7*/
+    {0x0046, 3, 1, 4, 16}, /*"(",8*/
+    {0x004E, 2, 1, 4, 16}, /*")",9*/
+    {0x0056, 1, 2, 7, 8}, /*"*",10*/
+    {0x805D, 0, 4, 9, 10}, /*"+",11*/
+    {0x0067, 3, 12, 3, 5}, /*",",12*/
+    {0x8069, 2, 9, 5, 2}, /*"-",13*/
+    {0x806A, 3, 12, 3, 3}, /*".",14*/
+    {0x006B, 0, 2, 8, 15}, /*"/",15*/
+    {0x007A, 0, 2, 9, 13}, /*"0",16*/
+    {0x0089, 1, 2, 8, 13}, /*"1",17*/
+    {0x0096, 0, 2, 8, 13}, /*"2",18*/
+    {0x00A3, 0, 2, 8, 13}, /*"3",19*/
+    {0x00B0, 0, 2, 9, 13}, /*"4",20*/
+    {0x00BF, 0, 2, 8, 13}, /*"5",21*/
+    {0x00CC, 0, 2, 9, 13}, /*"6",22*/
+    {0x00DB, 0, 2, 8, 13}, /*"7",23*/
+    {0x00E8, 0, 2, 9, 13}, /*"8",24*/
+    {0x00F7, 0, 2, 9, 13}, /*"9",25*/
+    {0x8106, 3, 6, 3, 9}, /*":",26*/
+    {0x0108, 3, 6, 3, 11}, /*";",27*/
+    {0x810D, 0, 5, 9, 9}, /*"<",28*/
+    {0x8116, 0, 6, 9, 6}, /*"=",29*/
+    {0x811A, 0, 5, 9, 9}, /*">",30*/
+    {0x0124, 1, 2, 7, 13}, /*"?",31*/
+    {0x0130, 0, 3, 9, 15}, /*"@",32*/
+    {0x0141, 0, 2, 9, 13}, /*"A",33*/
+    {0x0150, 0, 2, 9, 13}, /*"B",34*/
+    {0x015F, 0, 2, 8, 13}, /*"C",35*/
+    {0x016C, 0, 2, 9, 13}, /*"D",36*/
+    {0x817B, 1, 2, 8, 13}, /*"E",37*/
+    {0x8186, 1, 2, 8, 13}, /*"F",38*/
+    {0x0192, 0, 2, 9, 13}, /*"G",39*/
+    {0x81A1, 0, 2, 9, 13}, /*"H",40*/
+    {0x81AE, 1, 2, 7, 13}, /*"I",41*/
+    {0x01B9, 0, 2, 7, 13}, /*"J",42*/
+    {0x01C5, 0, 2, 9, 13}, /*"K",43*/
+    {0x01D4, 1, 2, 8, 13}, /*"L",44*/
+    {0x01E1, 0, 2, 9, 13}, /*"M",45*/
+    {0x01F0, 0, 2, 9, 13}, /*"N",46*/
+    {0x01FF, 0, 2, 9, 13}, /*"O",47*/
+    {0x020E, 1, 2, 8, 13}, /*"P",48*/
+    {0x021B, 0, 2, 9, 15}, /*"Q",49*/
+    {0x022C, 0, 2, 9, 13}, /*"R",50*/
+    {0x023B, 0, 2, 9, 13}, /*"S",51*/
+    {0x824A, 0, 2, 9, 13}, /*"T",52*/
+    {0x0257, 0, 2, 9, 13}, /*"U",53*/
+    {0x0266, 0, 2, 9, 13}, /*"V",54*/
+    {0x0275, 0, 2, 9, 13}, /*"W",55*/
+    {0x0284, 0, 2, 9, 13}, /*"X",56*/
+    {0x0293, 0, 2, 9, 13}, /*"Y",57*/
+    {0x82A2, 0, 2, 9, 13}, /*"Z",58*/
+    {0x02AF, 3, 1, 4, 16}, /*"[",59*/
+    {0x02B7, 0, 2, 8, 15}, /*"\",60*/
+    {0x02C6, 2, 1, 4, 16}, /*"]",61*/
+    {0x02CE, 0, 2, 9, 5}, /*"^",62*/
+    {0x82D4, 0, 17, 9, 1}, /*"_",63*/
+    {0x02D5, 2, 1, 3, 3}, /*"`",64*/
+    {0x02D7, 0, 5, 8, 10}, /*"a",65*/
+    {0x02E1, 1, 1, 8, 14}, /*"b",66*/
+    {0x02EF, 1, 5, 7, 10}, /*"c",67*/
+    {0x02F8, 0, 1, 8, 14}, /*"d",68*/
+    {0x8306, 0, 5, 9, 10}, /*"e",69*/
+    {0x0311, 1, 1, 7, 14}, /*"f",70*/
+    {0x031E, 0, 5, 8, 13}, /*"g",71*/
+    {0x032B, 1, 1, 7, 14}, /*"h",72*/
+    {0x8338, 1, 1, 8, 14}, /*"i",73*/
+    {0x0344, 1, 1, 5, 17}, /*"j",74*/
+    {0x034F, 1, 1, 8, 14}, /*"k",75*/
+    {0x035D, 0, 1, 8, 14}, /*"l",76*/
+    {0x036B, 0, 5, 9, 10}, /*"m",77*/
+    {0x0377, 1, 5, 7, 10}, /*"n",78*/
+    {0x0380, 0, 5, 9, 10}, /*"o",79*/
+    {0x038C, 1, 5, 8, 13}, /*"p",80*/
+    {0x0399, 0, 5, 8, 13}, /*"q",81*/
+    {0x03A6, 2, 5, 7, 10}, /*"r",82*/
+    {0x03AF, 1, 5, 7, 10}, /*"s",83*/
+    {0x03B8, 0, 2, 8, 13}, /*"t",84*/
+    {0x03C5, 1, 5, 7, 10}, /*"u",85*/
+    {0x03CE, 0, 5, 9, 10}, /*"v",86*/
+    {0x03DA, 0, 5, 9, 10}, /*"w",87*/
+    {0x03E6, 0, 5, 9, 10}, /*"x",88*/
+    {0x03F2, 0, 5, 9, 13}, /*"y",89*/
+    {0x8401, 1, 5, 7, 10}, /*"z",90*/
+    {0x0409, 1, 1, 7, 17}, /*"{",91*/
+    {0x8418, 4, 1, 1, 17}, /*"|",92*/
+    {0x041A, 1, 1, 7, 17}, /*"}",93*/
+    {0x0429, 0, 8, 9, 3}, /*"~",94*/
+};
+
+const esp_painter_basic_font_t esp_painter_basic_font_18 = {
+    .bitmap = bitmap,
+    .glyphs = glyphs,
+    .width = 9,
+    .height = 18,
+    .first = 0x20,
+    .count = 95,
+};
+
+#endif
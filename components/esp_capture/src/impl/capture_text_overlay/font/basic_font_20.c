@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: CC0-1.0
  */
 
+/* Packed by tools/pack_font.py: 10x20 cells, 1642 bytes (1-bit bitmap: 3800) */
+
 #include "sdkconfig.h"
 
 #include "esp_painter_font.h"
@@ -11,391 +13,211 @@
 #if CONFIG_ESP_PAINTER_BASIC_FONT_20
 
 static const uint8_t bitmap[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*" ",0*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
-    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"!",1*/
-
-    0x00, 0x00, 0x1B, 0x00, 0x1B, 0x00, 0x36, 0x00, 0x24, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*""",2*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x7F, 0x80, 0x7F, 0x80,
-    0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x22, 0x00, 0x22, 0x00,
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"#",3*/
-
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1E, 0x00, 0x29, 0x00, 0x49, 0x00, 0x49, 0x00, 0x48, 0x00,
-    0x28, 0x00, 0x1C, 0x00, 0x0A, 0x00, 0x09, 0x00, 0x09, 0x00, 0x49, 0x00, 0x49, 0x00, 0x4A, 0x00,
-    0x3C, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, /*"$",4*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x92, 0x00, 0x94, 0x00, 0x94, 0x00, 0x94, 0x00,
-    0x98, 0x00, 0x9B, 0x00, 0x6C, 0x80, 0x14, 0x80, 0x14, 0x80, 0x14, 0x80, 0x24, 0x80, 0x24, 0x80,
-    0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"%",5*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00,
-    0x28, 0x00, 0x33, 0x80, 0x51, 0x00, 0x91, 0x00, 0x89, 0x00, 0x8A, 0x00, 0x86, 0x00, 0x46, 0x40,
-    0x39, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"&",6*/
-
-    0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x20, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"'",7*/
-
-    0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x08, 0x00,
-    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x02, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, /*"(",8*/
-
-    0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x10, 0x00, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00,
-    0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, /*")",9*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0xC9, 0x80,
-    0xEB, 0x80, 0x1C, 0x00, 0x1C, 0x00, 0xEB, 0x80, 0xC9, 0x80, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"*",10*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x7F, 0xC0, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"+",11*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x20, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, /*",",12*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"-",13*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*".",14*/
-
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00, 0x20, 0x00, 0x20, 0x00,
-    0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, /*"/",15*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x21, 0x00, 0x40, 0x80, 0x40, 0x80,
-    0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x21, 0x00, 0x21, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"0",16*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"1",17*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80,
-    0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x80, 0x40, 0x80,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"2",18*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x42, 0x00, 0x41, 0x00, 0x41, 0x00, 0x01, 0x00,
-    0x02, 0x00, 0x0E, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x80, 0x40, 0x80, 0x40, 0x80, 0x41, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"3",19*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x12, 0x00, 0x22, 0x00, 0x22, 0x00, 0x42, 0x00, 0x7F, 0x80, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"4",20*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
-    0x2E, 0x00, 0x31, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x40, 0x80, 0x40, 0x80, 0x41, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"5",21*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x11, 0x00, 0x21, 0x00, 0x40, 0x00, 0x40, 0x00,
-    0x5E, 0x00, 0x61, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x20, 0x80, 0x21, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"6",22*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x40, 0x80, 0x41, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"7",23*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80,
-    0x21, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x21, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"8",24*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x41, 0x00, 0x40, 0x80, 0x40, 0x80,
-    0x40, 0x80, 0x41, 0x80, 0x22, 0x80, 0x1C, 0x80, 0x00, 0x80, 0x01, 0x00, 0x21, 0x00, 0x22, 0x00,
-    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"9",25*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*":",26*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
-    0x0C, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, /*";",27*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00,
-    0x20, 0x00, 0x40, 0x00, 0x40, 0x00, 0x20, 0x00, 0x10, 0x00, 0x08, 0x00, 0x04, 0x00, 0x02, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"<",28*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"=",29*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x08, 0x00, 0x04, 0x00, 0x02, 0x00,
-    0x01, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*">",30*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x40, 0x80, 0x40, 0x80,
-    0x60, 0x80, 0x01, 0x00, 0x06, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"?",31*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x40, 0x80, 0x4E, 0x80, 0x92, 0x80,
-    0x92, 0x80, 0xA4, 0x80, 0xA4, 0x80, 0xA4, 0x80, 0xA5, 0x00, 0x9E, 0x00, 0x40, 0x80, 0x21, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"@",32*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x14, 0x00, 0x14, 0x00,
-    0x14, 0x00, 0x14, 0x00, 0x22, 0x00, 0x22, 0x00, 0x3E, 0x00, 0x22, 0x00, 0x41, 0x00, 0x41, 0x00,
-    0xE3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"A",33*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00,
-    0x44, 0x00, 0x7C, 0x00, 0x42, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x42, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"B",34*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x21, 0x80, 0x40, 0x80, 0x40, 0x80,
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x80, 0x40, 0x80, 0x61, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"C",35*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x42, 0x00, 0x41, 0x00, 0x40, 0x80,
-    0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x41, 0x00, 0x42, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"D",36*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x41, 0x00, 0x40, 0x80, 0x42, 0x00,
-    0x42, 0x00, 0x7E, 0x00, 0x42, 0x00, 0x42, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x80, 0x41, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"E",37*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x41, 0x00, 0x40, 0x80, 0x42, 0x00,
-    0x42, 0x00, 0x7E, 0x00, 0x42, 0x00, 0x42, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"F",38*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x80, 0x11, 0x80, 0x20, 0x80, 0x40, 0x80,
-    0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0xC0, 0x40, 0x80, 0x40, 0x80, 0x20, 0x80, 0x30, 0x80,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"G",39*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x80, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00,
-    0x41, 0x00, 0x41, 0x00, 0x7F, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00,
-    0xE3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"H",40*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
-    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"I",41*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x84, 0x00, 0x88, 0x00, 0x70, 0x00, /*"J",42*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x80, 0x42, 0x00, 0x44, 0x00, 0x44, 0x00,
-    0x48, 0x00, 0x58, 0x00, 0x68, 0x00, 0x44, 0x00, 0x44, 0x00, 0x42, 0x00, 0x42, 0x00, 0x41, 0x00,
-    0xE3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"K",43*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
-    0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x80, 0x41, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"L",44*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x80, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00,
-    0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-    0xEB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"M",45*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x80, 0x61, 0x00, 0x51, 0x00, 0x51, 0x00,
-    0x51, 0x00, 0x49, 0x00, 0x49, 0x00, 0x45, 0x00, 0x45, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00,
-    0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"N",46*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x63, 0x00, 0x41, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x41, 0x00, 0x63, 0x00,
-    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"O",47*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x41, 0x00, 0x40, 0x80, 0x40, 0x80,
-    0x40, 0x80, 0x41, 0x00, 0x7E, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"P",48*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x63, 0x00, 0x41, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB8, 0x80, 0x45, 0x00, 0x63, 0x00,
-    0x1E, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, /*"Q",49*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x42, 0x00, 0x41, 0x00, 0x41, 0x00,
-    0x42, 0x00, 0x7C, 0x00, 0x48, 0x00, 0x44, 0x00, 0x44, 0x00, 0x42, 0x00, 0x42, 0x00, 0x41, 0x00,
-    0xE1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"R",50*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x23, 0x00, 0x41, 0x00, 0x40, 0x00,
-    0x40, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x02, 0x00, 0x01, 0x00, 0x41, 0x00, 0x41, 0x00, 0x62, 0x00,
-    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"S",51*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x88, 0x80, 0x88, 0x80, 0x08, 0x00,
-    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
-    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"T",52*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x80, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00,
-    0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x22, 0x00,
-    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"U",53*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x80, 0x41, 0x00, 0x41, 0x00, 0x22, 0x00,
-    0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x08, 0x00, 0x08, 0x00,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"V",54*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x80, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-    0x49, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00,
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"W",55*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x80, 0x21, 0x00, 0x12, 0x00, 0x12, 0x00,
-    0x14, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x14, 0x00, 0x12, 0x00, 0x22, 0x00, 0x21, 0x00,
-    0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"X",56*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x80, 0x41, 0x00, 0x41, 0x00, 0x22, 0x00,
-    0x22, 0x00, 0x14, 0x00, 0x14, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
-    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"Y",57*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x21, 0x00, 0x41, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00, 0x20, 0x80, 0x21, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"Z",58*/
-
-    0x00, 0x00, 0x0F, 0x80, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
-    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
-    0x08, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, /*"[",59*/
-
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x10, 0x00, 0x10, 0x00, 0x08, 0x00,
-    0x08, 0x00, 0x08, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, /*"\",60*/
-
-    0x00, 0x00, 0x7C, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, /*"]",61*/
-
-    0x00, 0x00, 0x1C, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"^",62*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, /*"_",63*/
-
-    0x00, 0x00, 0x18, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"`",64*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x41, 0x00, 0x41, 0x00, 0x07, 0x00, 0x39, 0x00, 0x41, 0x00, 0x41, 0x00, 0x43, 0x40,
-    0x3D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"a",65*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
-    0x2E, 0x00, 0x31, 0x00, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x31, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"b",66*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x21, 0x00, 0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x80, 0x21, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"c",67*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x1D, 0x00, 0x23, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x23, 0x00,
-    0x1D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"d",68*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x21, 0x00, 0x40, 0x80, 0x40, 0x80, 0x7F, 0x80, 0x40, 0x00, 0x40, 0x80, 0x21, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"e",69*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x80, 0x08, 0x00, 0x08, 0x00,
-    0x3F, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"f",70*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x1E, 0x00, 0x20, 0x00, 0x3F, 0x00,
-    0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x3F, 0x00, /*"g",71*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
-    0x2E, 0x00, 0x31, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00,
-    0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"h",72*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"i",73*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x22, 0x00, 0x3C, 0x00, /*"j",74*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
-    0x27, 0x00, 0x22, 0x00, 0x24, 0x00, 0x28, 0x00, 0x34, 0x00, 0x24, 0x00, 0x22, 0x00, 0x21, 0x00,
-    0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"k",75*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x78, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
-    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"l",76*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xDE, 0x00, 0x69, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-    0xED, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"m",77*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6E, 0x00, 0x31, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00,
-    0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"n",78*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x21, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x21, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"o",79*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6E, 0x00, 0x31, 0x00, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x31, 0x00,
-    0x2E, 0x00, 0x20, 0x00, 0x20, 0x00, 0x70, 0x00, /*"p",80*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1D, 0x00, 0x23, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x23, 0x00,
-    0x1D, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x80, /*"q",81*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x73, 0x80, 0x14, 0x80, 0x18, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"r",82*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x43, 0x00, 0x41, 0x00, 0x60, 0x00, 0x1C, 0x00, 0x03, 0x00, 0x41, 0x00, 0x61, 0x00,
-    0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"s",83*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
-    0x3F, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x80,
-    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"t",84*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x63, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x23, 0x00,
-    0x1D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"u",85*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE3, 0x80, 0x41, 0x00, 0x41, 0x00, 0x22, 0x00, 0x22, 0x00, 0x14, 0x00, 0x14, 0x00, 0x08, 0x00,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"v",86*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xDD, 0x80, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x22, 0x00,
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"w",87*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x73, 0x80, 0x21, 0x00, 0x12, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x12, 0x00, 0x21, 0x00,
-    0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"x",88*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x73, 0x80, 0x21, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x0A, 0x00, 0x0C, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x08, 0x00, 0x28, 0x00, 0x30, 0x00, /*"y",89*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x42, 0x00, 0x44, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x80, 0x20, 0x80, 0x21, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"z",90*/
-
-    0x00, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x01, 0x80, 0x00, 0x00, /*"{",91*/
-
-    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, /*"|",92*/
-
-    0x00, 0x00, 0x60, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00,
-    0x10, 0x00, 0x10, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00,
-    0x10, 0x00, 0x10, 0x00, 0x60, 0x00, 0x00, 0x00, /*"}",93*/
+    0xFF, 0xCC, /*"!",1*/
+    0x36, 0x6D, 0xB2, 0x49, 0x00, /*""",2*/
+    0x22, 0x22, 0x22, 0xFF, 0xFF, 0x44, 0x44, 0x44, 0x44, 0xFF, 0xFF, 0x44, 0x44, 0x44, /*"#",3*/
+    0x10, 0x79, 0x4C, 0x99, 0x32, 0x14, 0x1C, 0x14, 0x24, 0x4C, 0x99, 0x32, 0x9E, 0x08, 0x10, /*"$",4*/
+    0x62, 0x49, 0x25, 0x12, 0x89, 0x44, 0xC2, 0x6C, 0xD9, 0x14, 0x8A, 0x45, 0x24, 0x92, 0x49, 0x18, /*"%",5*/
+    0x18, 0x09, 0x02, 0x40, 0x90, 0x24, 0x0A, 0x03, 0x39, 0x44, 0x91, 0x22, 0x48, 0xA2, 0x18, 0x46,
+    0x4E, 0x60, /*"&",6*/
+    0xF5, 0x80, /*"'",7*/
+    0x08, 0x88, 0x44, 0x22, 0x10, 0x84, 0x21, 0x04, 0x21, 0x04, 0x10, 0x40, /*"(",8*/
+    0x82, 0x08, 0x41, 0x08, 0x21, 0x08, 0x42, 0x11, 0x08, 0x84, 0x44, 0x00, /*")",9*/
+    0x08, 0x04, 0x32, 0x7D, 0x71, 0xC0, 0xE3, 0xAF, 0x93, 0x08, 0x04, 0x00, /*"*",10*/
+    0x41, 0x81, 0x81, 0x81, 0x49, 0x41, 0x81, 0x81, 0x81, 0x40, /*"+",11*/
+    0xF5, 0x80, /*",",12*/
+    0xFF, /*"-",13*/
+    0xF0, /*".",14*/
+    0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80,
+    0x80, /*"/",15*/
+    0x3C, 0x42, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x42, 0x3C, /*"0",16*/
+    0x27, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x7C, /*"1",17*/
+    0x3C, 0x42, 0x81, 0x81, 0x81, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x41, 0x81, 0xFF, /*"2",18*/
+    0x78, 0x84, 0x82, 0x82, 0x02, 0x04, 0x1C, 0x02, 0x01, 0x01, 0x81, 0x81, 0x82, 0x7C, /*"3",19*/
+    0x04, 0x0C, 0x0C, 0x14, 0x14, 0x24, 0x44, 0x44, 0x84, 0xFF, 0x04, 0x04, 0x04, 0x1F, /*"4",20*/
+    0x7F, 0x40, 0x40, 0x40, 0x40, 0x5C, 0x62, 0x01, 0x01, 0x01, 0x81, 0x81, 0x82, 0x7C, /*"5",21*/
+    0x1C, 0x22, 0x42, 0x80, 0x80, 0xBC, 0xC2, 0x81, 0x81, 0x81, 0x81, 0x41, 0x42, 0x3C, /*"6",22*/
+    0xFF, 0x81, 0x82, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, /*"7",23*/
+    0x3C, 0x42, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, /*"8",24*/
+    0x3C, 0x42, 0x82, 0x81, 0x81, 0x81, 0x83, 0x45, 0x39, 0x01, 0x02, 0x42, 0x44, 0x38, /*"9",25*/
+    0x04, 0xC4, /*":",26*/
+    0xF0, 0x03, 0xD8, /*";",27*/
+    0x02, 0x08, 0x20, 0x82, 0x08, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, /*"<",28*/
+    0x08, 0xF9, 0x80, /*"=",29*/
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x04, 0x10, 0x41, 0x04, 0x10, 0x00, /*">",30*/
+    0x3C, 0x42, 0x81, 0x81, 0xC1, 0x02, 0x0C, 0x10, 0x10, 0x10, 0x00, 0x18, 0x18, /*"?",31*/
+    0x1E, 0x10, 0x90, 0x29, 0xD9, 0x2C, 0x96, 0x93, 0x49, 0xA4, 0xD2, 0xA7, 0x88, 0x12, 0x10, 0xF0, /*"@",32*/
+    0x08, 0x04, 0x05, 0x02, 0x81, 0x40, 0xA0, 0x88, 0x44, 0x3E, 0x11, 0x10, 0x48, 0x2E, 0x38, /*"A",33*/
+    0xFC, 0x42, 0x42, 0x42, 0x44, 0x7C, 0x42, 0x41, 0x41, 0x41, 0x41, 0x42, 0xFC, /*"B",34*/
+    0x1E, 0x90, 0xD0, 0x28, 0x18, 0x04, 0x02, 0x01, 0x00, 0x80, 0x40, 0x50, 0x2C, 0x21, 0xE0, /*"C",35*/
+    0xFC, 0x21, 0x10, 0x48, 0x14, 0x0A, 0x05, 0x02, 0x81, 0x40, 0xA0, 0x50, 0x48, 0x4F, 0xC0, /*"D",36*/
+    0xFF, 0x20, 0x90, 0x28, 0x44, 0x23, 0xF1, 0x08, 0x84, 0x40, 0x20, 0x10, 0x28, 0x2F, 0xF0, /*"E",37*/
+    0xFF, 0x20, 0x90, 0x28, 0x44, 0x23, 0xF1, 0x08, 0x84, 0x40, 0x20, 0x10, 0x08, 0x0E, 0x00, /*"F",38*/
+    0x1D, 0x11, 0x90, 0x50, 0x28, 0x04, 0x02, 0x01, 0x07, 0x81, 0x40, 0x90, 0x4C, 0x21, 0xE0, /*"G",39*/
+    0xE3, 0xA0, 0x90, 0x48, 0x24, 0x12, 0x09, 0xFC, 0x82, 0x41, 0x20, 0x90, 0x48, 0x2E, 0x38, /*"H",40*/
+    0xFE, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x8F, 0xE0, /*"I",41*/
+    0x3F, 0x82, 0x01, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x80, 0x44, 0x22,
+    0x20, 0xE0, /*"J",42*/
+    0xE7, 0xA1, 0x11, 0x08, 0x84, 0x82, 0xC1, 0xA0, 0x88, 0x44, 0x21, 0x10, 0x88, 0x2E, 0x38, /*"K",43*/
+    0xE0, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x80, 0x40, 0x20, 0x10, 0x28, 0x2F, 0xF0, /*"L",44*/
+    0xE3, 0xB1, 0x98, 0xCC, 0x65, 0x52, 0xA9, 0x54, 0xAA, 0x55, 0x24, 0x92, 0x49, 0x2E, 0xB8, /*"M",45*/
+    0xE3, 0xB0, 0x94, 0x4A, 0x25, 0x12, 0x49, 0x24, 0x8A, 0x45, 0x21, 0x90, 0xC8, 0x6E, 0x10, /*"N",46*/
+    0x1C, 0x31, 0x90, 0x50, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x50, 0x4C, 0x61, 0xC0, /*"O",47*/
+    0xFE, 0x20, 0x90, 0x28, 0x14, 0x0A, 0x09, 0xF8, 0x80, 0x40, 0x20, 0x10, 0x08, 0x0E, 0x00, /*"P",48*/
+    0x1C, 0x31, 0x90, 0x50, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xDC, 0x51, 0x4C, 0x61, 0xE0, 0x14,
+    0x04, /*"Q",49*/
+    0xFC, 0x21, 0x10, 0x48, 0x24, 0x23, 0xE1, 0x20, 0x88, 0x44, 0x21, 0x10, 0x88, 0x2E, 0x18, /*"R",50*/
+    0x3A, 0x8E, 0x0C, 0x08, 0x0C, 0x06, 0x02, 0x03, 0x06, 0x0E, 0x2B, 0x80, /*"S",51*/
+    0x7F, 0x44, 0x62, 0x21, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01, 0xC0, /*"T",52*/
+    0xE3, 0xA0, 0x90, 0x48, 0x24, 0x12, 0x09, 0x04, 0x82, 0x41, 0x20, 0x90, 0x44, 0x41, 0xC0, /*"U",53*/
+    0xE3, 0xA0, 0x90, 0x44, 0x42, 0x21, 0x10, 0x88, 0x28, 0x14, 0x0A, 0x02, 0x01, 0x00, 0x80, /*"V",54*/
+    0xDD, 0xA4, 0x92, 0x49, 0x24, 0x92, 0xA9, 0x54, 0xAA, 0x55, 0x11, 0x08, 0x84, 0x42, 0x20, /*"W",55*/
+    0xE7, 0x42, 0x24, 0x24, 0x28, 0x18, 0x10, 0x18, 0x28, 0x24, 0x44, 0x42, 0xE7, /*"X",56*/
+    0xE3, 0xA0, 0x90, 0x44, 0x42, 0x20, 0xA0, 0x50, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01, 0xC0, /*"Y",57*/
+    0x7F, 0x42, 0x82, 0x04, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x41, 0x42, 0xFE, /*"Z",58*/
+    0xFC, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0xF8, /*"[",59*/
+    0x81, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0x81, 0x02, 0x02, /*"\",60*/
+    0xF8, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0xF8, /*"]",61*/
+    0x74, 0x40, /*"^",62*/
+    0x0A, /*"_",63*/
+    0xC4, /*"`",64*/
+    0x7C, 0x41, 0x20, 0x81, 0xC7, 0x24, 0x12, 0x09, 0x0D, 0x7B, 0x80, /*"a",65*/
+    0xC0, 0x40, 0x40, 0x40, 0x5C, 0x62, 0x41, 0x41, 0x41, 0x41, 0x41, 0x62, 0x5C, /*"b",66*/
+    0x3C, 0x42, 0x82, 0x80, 0x80, 0x80, 0x81, 0x42, 0x3C, /*"c",67*/
+    0x06, 0x02, 0x02, 0x02, 0x3A, 0x46, 0x82, 0x82, 0x82, 0x82, 0x82, 0x46, 0x3B, /*"d",68*/
+    0x3C, 0x42, 0x81, 0x81, 0xFF, 0x80, 0x81, 0x42, 0x3C, /*"e",69*/
+    0x1C, 0x44, 0x81, 0x0F, 0xC4, 0x08, 0x10, 0x20, 0x40, 0x81, 0x0F, 0xC0, /*"f",70*/
+    0x3F, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x40, 0x7E, 0x81, 0x81, 0x81, 0x7E, /*"g",71*/
+    0xC0, 0x40, 0x40, 0x40, 0x5C, 0x62, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0xE7, /*"h",72*/
+    0x63, 0x00, 0x0E, 0x10, 0x84, 0x21, 0x08, 0x4F, 0x80, /*"i",73*/
+    0x0C, 0x30, 0x00, 0x1C, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x18, 0xBC, /*"j",74*/
+    0xC0, 0x40, 0x40, 0x40, 0x4E, 0x44, 0x48, 0x50, 0x68, 0x48, 0x44, 0x42, 0xE7, /*"k",75*/
+    0x11, 0xE0, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x1F, 0xC0, /*"l",76*/
+    0xDE, 0x34, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0xED, 0x80, /*"m",77*/
+    0xDC, 0x62, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0xE7, /*"n",78*/
+    0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, /*"o",79*/
+    0xDC, 0x62, 0x41, 0x41, 0x41, 0x41, 0x41, 0x62, 0x5C, 0x40, 0x40, 0xE0, /*"p",80*/
+    0x3A, 0x46, 0x82, 0x82, 0x82, 0x82, 0x82, 0x46, 0x3A, 0x02, 0x02, 0x07, /*"q",81*/
+    0xE7, 0x29, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0xF8, /*"r",82*/
+    0x7B, 0x0E, 0x0E, 0x03, 0x80, 0xE0, 0xE1, 0xBC, /*"s",83*/
+    0x20, 0x40, 0x87, 0xE2, 0x04, 0x08, 0x10, 0x20, 0x40, 0x88, 0xE0, /*"t",84*/
+    0xC6, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3B, /*"u",85*/
+    0xE3, 0xA0, 0x90, 0x44, 0x42, 0x20, 0xA0, 0x50, 0x10, 0x08, 0x00, /*"v",86*/
+    0xDD, 0xA4, 0x92, 0x49, 0x25, 0x52, 0xA9, 0x54, 0x44, 0x22, 0x00, /*"w",87*/
+    0xE7, 0x42, 0x24, 0x18, 0x18, 0x18, 0x24, 0x42, 0xE7, /*"x",88*/
+    0xE7, 0x42, 0x24, 0x24, 0x24, 0x14, 0x18, 0x08, 0x08, 0x10, 0x50, 0x60, /*"y",89*/
+    0xFE, 0x84, 0x88, 0x08, 0x10, 0x21, 0x41, 0x42, 0xFE, /*"z",90*/
+    0x19, 0x08, 0x42, 0x10, 0x84, 0x26, 0x08, 0x42, 0x10, 0x84, 0x20, 0xC0, /*"{",91*/
+    0x0F, 0x50, /*"|",92*/
+    0xC1, 0x08, 0x42, 0x10, 0x84, 0x20, 0xC8, 0x42, 0x10, 0x84, 0x26, 0x00, /*"}",93*/
+    0x60, 0x91, 0x89, 0x06, /*"~",94*/
+};
 
-    0x30, 0x00, 0x48, 0x80, 0x44, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"~",94*/
+static const esp_painter_glyph_t glyphs[] = {
+    {0x0000, 0, 0, 0, 0}, /*" ",0*/
+    {0x0000, 4, 3, 1, 14}, /*"!",1*/
+    {0x0002, 1, 1, 7, 5}, /*""",2*/
+    {0x0007, 1, 3, 8, 14}, /*"#",3*/
+    {0x0015, 1, 2, 7, 17}, /*"$",4*/
+    {0x0024, 0, 3, 9, 14}, /*"%",5*/
+    {0x0034, 0, 3, 10, 14}, /*"&",6*/
+    {0x0046, 1, 1, 2, 5}, /*"'",7*/
+    {0x0048, 4, 1, 5, 18}, /*"(",8*/
+    {0x0054, 1, 1, 5, 18}, /*")",9*/
+    {0x0060, 0, 5, 9, 10}, /*"*",10*/
+    {0x806C, 1, 5, 9, 9}, /*"+",11*/
+    {0x0076, 1, 14, 2, 5}, /*",",12*/
+    {0x0078, 1, 9, 8, 1}, /*"-",13*/
+    {0x0079, 1, 15, 2, 2}, /*".",14*/
+    {0x007A, 1, 1, 8, 17}, /*"/",15*/
+    {0x008B, 1, 3, 8, 14}, /*"0",16*/
+    {0x0099, 3, 3, 5, 14}, /*"1",17*/
+    {0x00A2, 1, 3, 8, 14}, /*"2",18*/
+    {0x00B0, 1, 3, 8, 14}, /*"3",19*/
+    {0x00BE, 1, 3, 8, 14}, /*"4",20*/
+    {0x00CC, 1, 3, 8, 14}, /*"5",21*/
+    {0x00DA, 1, 3, 8, 14}, /*"6",22*/
+    {0x00E8, 1, 3, 8, 14}, /*"7",23*/
+    {0x00F6, 1, 3, 8, 14}, /*"8",24*/
+    {0x0104, 1, 3, 8, 14}, /*"9",25*/
+    {0x8112, 4, 7, 2, 10}, /*":",26*/
+    {0x0114, 4, 8, 2, 11}, /*";",27*/
+    {0x0117, 1, 3, 7, 14}, /*"<",28*/
+    {0x8124, 1, 7, 8, 5}, /*"=",29*/
+    {0x0127, 2, 3, 7, 14}, /*">",30*/
+    {0x0134, 1, 4, 8, 13}, /*"?",31*/
+    {0x0141, 0, 3, 9, 14}, /*"@",32*/
+    {0x0151, 0, 4, 9, 13}, /*"A",33*/
+    {0x0160, 0, 4, 8, 13}, /*"B",34*/
+    {0x016D, 0, 4, 9, 13}, /*"C",35*/
+    {0x017C, 0, 4, 9, 13}, /*"D",36*/
+    {0x018B, 0, 4, 9, 13}, /*"E",37*/
+    {0x019A, 0, 4, 9, 13}, /*"F",38*/
+    {0x01A9, 1, 4, 9, 13}, /*"G",39*/
+    {0x01B8, 0, 4, 9, 13}, /*"H",40*/
+    {0x01C7, 1, 4, 7, 13}, /*"I",41*/
+    {0x01D3, 0, 4, 9, 16}, /*"J",42*/
+    {0x01E5, 0, 4, 9, 13}, /*"K",43*/
+    {0x01F4, 0, 4, 9, 13}, /*"L",44*/
+    {0x0203, 0, 4, 9, 13}, /*"M",45*/
+    {0x0212, 0, 4, 9, 13}, /*"N",46*/
+    {0x0221, 0, 4, 9, 13}, /*"O",47*/
+    {0x0230, 0, 4, 9, 13}, /*"P",48*/
+    {0x023F, 0, 4, 9, 15}, /*"Q",49*/
+    {0x0250, 0, 4, 9, 13}, /*"R",50*/
+    {0x025F, 1, 4, 7, 13}, /*"S",51*/
+    {0x026B, 0, 4, 9, 13}, /*"T",52*/
+    {0x027A, 0, 4, 9, 13}, /*"U",53*/
+    {0x0289, 0, 4, 9, 13}, /*"V",54*/
+    {0x0298, 0, 4, 9, 13}, /*"W",55*/
+    {0x02A7, 1, 4, 8, 13}, /*"X",56*/
+    {0x02B4, 0, 4, 9, 13}, /*"Y",57*/
+    {0x02C3, 1, 4, 8, 13}, /*"Z",58*/
+    {0x02D0, 4, 1, 5, 17}, /*"[",59*/
+    {0x02DB, 2, 2, 7, 17}, /*"\",60*/
+    {0x02EA, 1, 1, 5, 17}, /*"]",61*/
+    {0x02F5, 2, 1, 5, 2}, /*"^",62*/
+    {0x82F7, 0, 19, 10, 1}, /*"_",63*/
+    {0x02F8, 3, 1, 3, 2}, /*"`",64*/
+    {0x02F9, 1, 8, 9, 9}, /*"a",65*/
+    {0x0304, 1, 4, 8, 13}, /*"b",66*/
+    {0x0311, 1, 8, 8, 9}, /*"c",67*/
+    {0x031A, 1, 4, 8, 13}, /*"d",68*/
+    {0x0327, 1, 8, 8, 9}, /*"e",69*/
+    {0x0330, 2, 4, 7, 13}, /*"f",70*/
+    {0x033C, 1, 8, 8, 12}, /*"g",71*/
+    {0x0348, 1, 4, 8, 13}, /*"h",72*/
+    {0x0355, 2, 4, 5, 13}, /*"i",73*/
+    {0x035E, 2, 4, 6, 16}, /*"j",74*/
+    {0x036A, 1, 4, 8, 13}, /*"k",75*/
+    {0x0377, 1, 3, 7, 14}, /*"l",76*/
+    {0x0384, 0, 8, 9, 9}, /*"m",77*/
+    {0x038F, 1, 8, 8, 9}, /*"n",78*/
+    {0x0398, 1, 8, 8, 9}, /*"o",79*/
+    {0x03A1, 1, 8, 8, 12}, /*"p",80*/
+    {0x03AD, 1, 8, 8, 12}, /*"q",81*/
+    {0x03B9, 1, 8, 8, 9}, /*"r",82*/
+    {0x03C2, 1, 8, 7, 9}, /*"s",83*/
+    {0x03CA, 2, 5, 7, 12}, /*"t",84*/
+    {0x03D5, 1, 8, 8, 9}, /*"u",85*/
+    {0x03DE, 0, 8, 9, 9}, /*"v",86*/
+    {0x03E9, 0, 8, 9, 9}, /*"w",87*/
+    {0x03F4, 1, 8, 8, 9}, /*"x",88*/
+    {0x03FD, 1, 8, 8, 12}, /*"y",89*/
+    {0x0409, 1, 8, 8, 9}, /*"z",90*/
+    {0x0412, 4, 1, 5, 18}, /*"{",91*/
+    {0x841E, 5, 0, 1, 20}, /*"|",92*/
+    {0x0420, 1, 1, 5, 18}, /*"}",93*/
+    {0x042C, 1, 0, 8, 4}, /*"~",94*/
 };
 
 const esp_painter_basic_font_t esp_painter_basic_font_20 = {
     .bitmap = bitmap,
+    .glyphs = glyphs,
     .width = 10,
     .height = 20,
+    .first = 0x20,
+    .count = 95,
 };
 
 #endif
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: CC0-1.0
  */
 
+/* Packed by tools/pack_font.py: 12x24 cells, 2120 bytes (1-bit bitmap: 4560) */
+
 #include "sdkconfig.h"
 
 #include "esp_painter_font.h"
@@ -11,391 +13,266 @@
 #if CONFIG_ESP_PAINTER_BASIC_FONT_24
 
 static const uint8_t bitmap[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*" ",0*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"!",1*/
-
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x06, 0x60, 0x0C, 0xC0, 0x19, 0x80, 0x11, 0x00, 0x22, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*""",2*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40,
-    0x7F, 0xE0, 0x7F, 0xE0, 0x10, 0x40, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x7F, 0xE0,
-    0x7F, 0xE0, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"#",3*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x0F, 0x80, 0x1A, 0xC0, 0x32, 0xC0,
-    0x33, 0xC0, 0x32, 0x00, 0x1A, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x03, 0x80, 0x02, 0xC0,
-    0x32, 0xC0, 0x3A, 0xC0, 0x32, 0xC0, 0x12, 0x80, 0x0F, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, /*"$",4*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x80, 0x50, 0x80, 0x89, 0x00, 0x89, 0x00,
-    0x89, 0x00, 0x8A, 0x00, 0x8A, 0x00, 0x5C, 0x00, 0x75, 0xC0, 0x05, 0x40, 0x0A, 0x20, 0x0A, 0x20,
-    0x12, 0x20, 0x12, 0x20, 0x12, 0x20, 0x21, 0x40, 0x21, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"%",5*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00,
-    0x36, 0x00, 0x36, 0x00, 0x34, 0x00, 0x19, 0xE0, 0x38, 0x80, 0x58, 0x80, 0xCC, 0x80, 0xCC, 0x80,
-    0xC6, 0x80, 0xC7, 0x00, 0xC3, 0x10, 0x63, 0x90, 0x3C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"&",6*/
-
-    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x38, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"'",7*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, /*"(",8*/
-
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x04, 0x00, 0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, /*")",9*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00,
-    0x02, 0x00, 0x62, 0x30, 0x72, 0xF0, 0x0B, 0x80, 0x0F, 0x80, 0x7A, 0xF0, 0x62, 0x30, 0x02, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"*",10*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x7F, 0xF0, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"+",11*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x38, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, /*",",12*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"-",13*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*".",14*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x60, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x80,
-    0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x06, 0x00, 0x04, 0x00, 0x04, 0x00, 0x08, 0x00,
-    0x08, 0x00, 0x10, 0x00, 0x10, 0x00, 0x30, 0x00, 0x20, 0x00, 0x60, 0x00, 0x40, 0x00, 0x00, 0x00, /*"/",15*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x19, 0x80, 0x30, 0xC0,
-    0x30, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x30, 0xC0, 0x30, 0xC0, 0x19, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"0",16*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3E, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"1",17*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x21, 0x80, 0x40, 0xC0,
-    0x60, 0xC0, 0x60, 0xC0, 0x00, 0xC0, 0x00, 0x80, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x04, 0x00,
-    0x08, 0x00, 0x10, 0x40, 0x20, 0x40, 0x60, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"2",18*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x63, 0x00, 0x61, 0x80,
-    0x61, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00, 0x0E, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0xC0,
-    0x00, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x61, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"3",19*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0x80, 0x03, 0x80,
-    0x05, 0x80, 0x05, 0x80, 0x09, 0x80, 0x11, 0x80, 0x11, 0x80, 0x21, 0x80, 0x41, 0x80, 0x7F, 0xF0,
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"4",20*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x20, 0x00, 0x20, 0x00,
-    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2F, 0x00, 0x31, 0x80, 0x20, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
-    0x60, 0xC0, 0x60, 0xC0, 0x41, 0x80, 0x21, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"5",21*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x18, 0xC0, 0x30, 0xC0,
-    0x30, 0x00, 0x20, 0x00, 0x60, 0x00, 0x67, 0x80, 0x68, 0xC0, 0x70, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x20, 0x60, 0x30, 0x40, 0x18, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"6",22*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x30, 0x60, 0x20, 0x40,
-    0x20, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"7",23*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x30, 0xC0, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x30, 0x40, 0x38, 0xC0, 0x0F, 0x00, 0x13, 0x80, 0x30, 0xC0, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x30, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"8",24*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x30, 0x80, 0x30, 0xC0,
-    0x60, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0x31, 0x60, 0x1E, 0x60, 0x00, 0x60,
-    0x00, 0xC0, 0x00, 0xC0, 0x30, 0x80, 0x31, 0x80, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"9",25*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*":",26*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, /*";",27*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x01, 0x00,
-    0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x10, 0x00, 0x08, 0x00, 0x04, 0x00,
-    0x02, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"<",28*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"=",29*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x08, 0x00, 0x04, 0x00,
-    0x02, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x01, 0x00,
-    0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*">",30*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x18, 0x60, 0x20, 0x30,
-    0x20, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0xE0, 0x01, 0x80, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"?",31*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x18, 0xC0, 0x30, 0x40, 0x33, 0xA0,
-    0x26, 0xA0, 0x66, 0xA0, 0x65, 0xA0, 0x6D, 0x20, 0x6D, 0x20, 0x6D, 0x20, 0x6D, 0x20, 0x6D, 0x40,
-    0x27, 0x80, 0x30, 0x20, 0x30, 0x40, 0x18, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"@",32*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0A, 0x00,
-    0x0B, 0x00, 0x09, 0x00, 0x09, 0x00, 0x11, 0x00, 0x11, 0x80, 0x10, 0x80, 0x1F, 0x80, 0x20, 0xC0,
-    0x20, 0xC0, 0x20, 0x40, 0x40, 0x40, 0x40, 0x60, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"A",33*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x31, 0xC0, 0x30, 0xC0,
-    0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x31, 0x80, 0x3F, 0x00, 0x30, 0xC0, 0x30, 0x40, 0x30, 0x60,
-    0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"B",34*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x18, 0xC0, 0x30, 0x60,
-    0x30, 0x20, 0x20, 0x20, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x60, 0x20, 0x30, 0x20, 0x30, 0x40, 0x18, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"C",35*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x31, 0x80, 0x30, 0xC0,
-    0x30, 0xC0, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60,
-    0x30, 0x60, 0x30, 0xC0, 0x30, 0xC0, 0x31, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"D",36*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x60, 0xC0, 0x60, 0x20,
-    0x60, 0x20, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x7F, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00,
-    0x60, 0x00, 0x60, 0x20, 0x60, 0x20, 0x60, 0x40, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"E",37*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x60, 0xC0, 0x60, 0x20,
-    0x60, 0x20, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x7F, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00,
-    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"F",38*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x18, 0x80, 0x30, 0x40,
-    0x30, 0x40, 0x20, 0x40, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x63, 0xF0, 0x60, 0xC0,
-    0x60, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x18, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"G",39*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x7F, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"H",40*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"I",41*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x63, 0x00, 0x66, 0x00, 0x3C, 0x00, /*"J",42*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xC0, 0x61, 0x80, 0x63, 0x00,
-    0x62, 0x00, 0x64, 0x00, 0x68, 0x00, 0x6C, 0x00, 0x74, 0x00, 0x76, 0x00, 0x62, 0x00, 0x63, 0x00,
-    0x61, 0x00, 0x61, 0x80, 0x60, 0x80, 0x60, 0xC0, 0xF1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"K",43*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x60, 0x00, 0x60, 0x20, 0x60, 0x20, 0x60, 0x40, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"L",44*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x61, 0xC0, 0x61, 0xC0,
-    0x71, 0xC0, 0x71, 0xC0, 0x72, 0xC0, 0x72, 0xC0, 0x52, 0xC0, 0x5A, 0xC0, 0x5A, 0xC0, 0x5C, 0xC0,
-    0x4C, 0xC0, 0x4C, 0xC0, 0x4C, 0xC0, 0x48, 0xC0, 0xE1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"M",45*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xF0, 0x30, 0x40, 0x38, 0x40,
-    0x38, 0x40, 0x2C, 0x40, 0x2C, 0x40, 0x26, 0x40, 0x26, 0x40, 0x22, 0x40, 0x23, 0x40, 0x21, 0x40,
-    0x21, 0xC0, 0x21, 0xC0, 0x20, 0xC0, 0x20, 0xC0, 0xF8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"N",46*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x19, 0x80, 0x30, 0xC0,
-    0x30, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x30, 0x40, 0x30, 0xC0, 0x19, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"O",47*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x60, 0xC0, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0xC0, 0x7F, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"P",48*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x19, 0x80, 0x30, 0xC0,
-    0x30, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x6E, 0x60, 0x32, 0x40, 0x33, 0xC0, 0x19, 0x80, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0xC0, 0x00, 0x00, /*"Q",49*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x60, 0xC0, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0x7F, 0x00, 0x62, 0x00, 0x63, 0x00, 0x61, 0x00,
-    0x61, 0x80, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0x60, 0xF0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"R",50*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x30, 0xC0, 0x60, 0x40,
-    0x60, 0x40, 0x60, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xC0, 0x00, 0xE0,
-    0x40, 0x60, 0x40, 0x60, 0x60, 0x60, 0x30, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"S",51*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x46, 0x20, 0x86, 0x10,
-    0x86, 0x10, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"T",52*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xE0, 0x30, 0x40, 0x30, 0x40,
-    0x30, 0x40, 0x30, 0x40, 0x30, 0x40, 0x30, 0x40, 0x30, 0x40, 0x30, 0x40, 0x30, 0x40, 0x30, 0x40,
-    0x30, 0x40, 0x30, 0x40, 0x30, 0x40, 0x18, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"U",53*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xE0, 0x60, 0x40, 0x20, 0x80,
-    0x20, 0x80, 0x30, 0x80, 0x30, 0x80, 0x11, 0x00, 0x11, 0x00, 0x19, 0x00, 0x19, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"V",54*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x70, 0x46, 0x20, 0x42, 0x20,
-    0x62, 0x20, 0x62, 0x20, 0x26, 0x40, 0x26, 0x40, 0x27, 0x40, 0x27, 0x40, 0x39, 0x40, 0x39, 0x80,
-    0x19, 0x80, 0x19, 0x80, 0x11, 0x80, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"W",55*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xE0, 0x30, 0x80, 0x10, 0x80,
-    0x18, 0x80, 0x09, 0x00, 0x0D, 0x00, 0x06, 0x00, 0x04, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0B, 0x00,
-    0x09, 0x00, 0x11, 0x80, 0x10, 0x80, 0x20, 0xC0, 0x71, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"X",56*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x60, 0x20, 0x20, 0x40,
-    0x30, 0x40, 0x10, 0x80, 0x18, 0x80, 0x1D, 0x00, 0x0D, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"Y",57*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x30, 0x40, 0x60, 0xC0,
-    0x40, 0x80, 0x01, 0x80, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x08, 0x00,
-    0x18, 0x00, 0x10, 0x20, 0x30, 0x20, 0x20, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"Z",58*/
-
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x07, 0xC0, 0x00, 0x00, /*"[",59*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x10, 0x00, 0x10, 0x00,
-    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x20, /*"\",60*/
-
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x3E, 0x00, 0x00, 0x00, /*"]",61*/
-
-    0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"^",62*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, /*"_",63*/
-
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"`",64*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x30, 0xC0, 0x30, 0xC0, 0x00, 0xC0, 0x07, 0xC0, 0x38, 0xC0,
-    0x70, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x71, 0xD0, 0x3E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"a",65*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00,
-    0x30, 0x00, 0x30, 0x00, 0x33, 0x80, 0x3C, 0xC0, 0x38, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60,
-    0x30, 0x60, 0x30, 0x60, 0x30, 0x40, 0x38, 0xC0, 0x27, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"b",66*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x31, 0x80, 0x31, 0x80, 0x61, 0x80, 0x60, 0x00, 0x60, 0x00,
-    0x60, 0x00, 0x60, 0x40, 0x30, 0x40, 0x30, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"c",67*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x03, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
-    0x00, 0xC0, 0x00, 0xC0, 0x1E, 0xC0, 0x31, 0xC0, 0x30, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0,
-    0x60, 0xC0, 0x60, 0xC0, 0x20, 0xC0, 0x31, 0xE0, 0x1E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"d",68*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x18, 0xC0, 0x10, 0x40, 0x30, 0x60, 0x30, 0x60, 0x3F, 0xE0,
-    0x30, 0x00, 0x30, 0x00, 0x18, 0x20, 0x18, 0x40, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"e",69*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x06, 0x60, 0x0C, 0x60,
-    0x0C, 0x00, 0x0C, 0x00, 0x7F, 0x80, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,
-    0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"f",70*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x1B, 0x60, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x19, 0x80,
-    0x1F, 0x00, 0x30, 0x00, 0x3F, 0x00, 0x33, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x71, 0xC0, 0x1F, 0x00, /*"g",71*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00,
-    0x30, 0x00, 0x30, 0x00, 0x37, 0x80, 0x38, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0,
-    0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x79, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"h",72*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x3E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"i",73*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x80, 0x0F, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x33, 0x00, 0x3E, 0x00, /*"j",74*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00,
-    0x30, 0x00, 0x30, 0x00, 0x31, 0xC0, 0x31, 0x00, 0x31, 0x00, 0x32, 0x00, 0x36, 0x00, 0x3A, 0x00,
-    0x31, 0x00, 0x31, 0x80, 0x30, 0x80, 0x30, 0xC0, 0x79, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"k",75*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3E, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"l",76*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xEC, 0xE0, 0x77, 0x60, 0x66, 0x60, 0x66, 0x60, 0x66, 0x60, 0x66, 0x60,
-    0x66, 0x60, 0x66, 0x60, 0x66, 0x60, 0x66, 0x60, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"m",77*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x77, 0x80, 0x38, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0,
-    0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x79, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"n",78*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x19, 0x80, 0x30, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x30, 0xC0, 0x30, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"o",79*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x77, 0x80, 0x38, 0xC0, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60,
-    0x30, 0x60, 0x30, 0x60, 0x30, 0xC0, 0x38, 0xC0, 0x37, 0x80, 0x30, 0x00, 0x30, 0x00, 0x7C, 0x00, /*"p",80*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x31, 0xC0, 0x30, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0,
-    0x60, 0xC0, 0x60, 0xC0, 0x20, 0xC0, 0x31, 0xC0, 0x1E, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x03, 0xE0, /*"q",81*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF9, 0xC0, 0x1A, 0x60, 0x1C, 0x60, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
-    0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"r",82*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x38, 0xC0, 0x30, 0x40, 0x30, 0x40, 0x1C, 0x00, 0x0F, 0x00,
-    0x03, 0xC0, 0x20, 0xC0, 0x20, 0xC0, 0x31, 0xC0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"s",83*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x0C, 0x00, 0x0C, 0x00, 0x7F, 0x80, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,
-    0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x40, 0x0C, 0x40, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"t",84*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x40, 0x71, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0,
-    0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x39, 0xE0, 0x1E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"u",85*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0xE0, 0x30, 0x40, 0x10, 0x80, 0x10, 0x80, 0x18, 0x80, 0x09, 0x00,
-    0x0D, 0x00, 0x0D, 0x00, 0x06, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"v",86*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xEF, 0x70, 0x46, 0x20, 0x62, 0x20, 0x26, 0x40, 0x26, 0x40, 0x37, 0x40,
-    0x39, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"w",87*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0xE0, 0x18, 0x80, 0x08, 0x80, 0x0D, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x07, 0x00, 0x09, 0x00, 0x10, 0x80, 0x10, 0xC0, 0x79, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"x",88*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x79, 0xE0, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x09, 0x00, 0x09, 0x00,
-    0x0D, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x04, 0x00, 0x04, 0x00, 0x24, 0x00, 0x38, 0x00, /*"y",89*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x21, 0x80, 0x23, 0x00, 0x22, 0x00, 0x06, 0x00, 0x04, 0x00,
-    0x0C, 0x00, 0x18, 0x40, 0x10, 0x40, 0x30, 0xC0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"z",90*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, /*"{",91*/
-
-    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, /*"|",92*/
-
-    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
-    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x04, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x08, 0x00,
-    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x30, 0x00, 0x00, 0x00, /*"}",93*/
+    0xFF, 0xFD, 0xA8, 0x0F, 0xC0, /*"!",1*/
+    0x19, 0x8C, 0xCC, 0xCC, 0xC4, 0x44, 0x40, /*""",2*/
+    0x10, 0x84, 0x21, 0x08, 0x42, 0xFF, 0xFF, 0xF2, 0x08, 0x84, 0x21, 0x08, 0x42, 0x13, 0xFF, 0xFF,
+    0xD0, 0x44, 0x11, 0x04, 0x41, 0x00, /*"#",3*/
+    0x08, 0x08, 0x3E, 0x6B, 0xCB, 0xCF, 0xC8, 0x68, 0x38, 0x1C, 0x0E, 0x0E, 0x0B, 0xCB, 0xEB, 0xCB,
+    0x4A, 0x3C, 0x08, 0x08, /*"$",4*/
+    0x70, 0x8A, 0x12, 0x24, 0x44, 0x88, 0x91, 0x14, 0x22, 0x82, 0xE0, 0x75, 0xC0, 0xA8, 0x28, 0x85,
+    0x11, 0x22, 0x24, 0x44, 0x89, 0x0A, 0x21, 0xC0, /*"%",5*/
+    0x1C, 0x03, 0x60, 0x36, 0x03, 0x60, 0x36, 0x03, 0x60, 0x34, 0x01, 0x9E, 0x38, 0x85, 0x88, 0xCC,
+    0x8C, 0xC8, 0xC6, 0x8C, 0x70, 0xC3, 0x16, 0x39, 0x3C, 0xE0, /*"&",6*/
+    0xDC, 0x95, 0x00, /*"'",7*/
+    0x04, 0x21, 0x08, 0x21, 0x04, 0x20, 0x82, 0x08, 0x20, 0x82, 0x04, 0x10, 0x20, 0x81, 0x02, 0x04, /*"(",8*/
+    0x81, 0x02, 0x04, 0x10, 0x20, 0x81, 0x04, 0x10, 0x41, 0x04, 0x10, 0x82, 0x10, 0x42, 0x10, 0x80, /*")",9*/
+    0x04, 0x00, 0xC0, 0x10, 0x62, 0x3E, 0x5E, 0x2E, 0x07, 0xC7, 0xAF, 0xC4, 0x60, 0x80, 0x10, 0x02,
+    0x00, /*"*",10*/
+    0x51, 0xA1, 0xA1, 0xA1, 0xA1, 0x5B, 0x51, 0xA1, 0xA1, 0xA1, 0xA1, 0x50, /*"+",11*/
+    0xDC, 0x95, 0x00, /*",",12*/
+    0x0A, /*"-",13*/
+    0x09, /*".",14*/
+    0x91, 0x82, 0x81, 0x82, 0x81, 0x91, 0x81, 0x91, 0x81, 0x91, 0x82, 0x81, 0x91, 0x81, 0x91, 0x81,
+    0x91, 0x82, 0x81, 0x82, 0x81, 0x90, /*"/",15*/
+    0x1E, 0x0C, 0xC6, 0x19, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x61,
+    0x98, 0x63, 0x30, 0x78, /*"0",16*/
+    0x08, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, /*"1",17*/
+    0x3E, 0x21, 0xA0, 0x78, 0x3C, 0x18, 0x0C, 0x04, 0x06, 0x06, 0x06, 0x02, 0x02, 0x02, 0x0A, 0x07,
+    0x03, 0xFF, /*"2",18*/
+    0x3C, 0x63, 0x30, 0xD8, 0x60, 0x30, 0x18, 0x18, 0x38, 0x03, 0x00, 0x80, 0x60, 0x3C, 0x1E, 0x0F,
+    0x0C, 0x7C, /*"3",19*/
+    0x03, 0x00, 0x60, 0x1C, 0x05, 0x80, 0xB0, 0x26, 0x08, 0xC1, 0x18, 0x43, 0x10, 0x63, 0xFF, 0x81,
+    0x80, 0x30, 0x06, 0x00, 0xC0, 0x7E, /*"4",20*/
+    0x7F, 0xA0, 0x10, 0x08, 0x04, 0x02, 0x01, 0x78, 0xC6, 0x41, 0x80, 0xC0, 0x78, 0x3C, 0x1C, 0x19,
+    0x0C, 0x7C, /*"5",21*/
+    0x0F, 0x0C, 0x66, 0x19, 0x80, 0x40, 0x30, 0x0C, 0xF3, 0x46, 0xE0, 0xF0, 0x3C, 0x0F, 0x03, 0x40,
+    0xD8, 0x23, 0x18, 0x78, /*"6",22*/
+    0x7F, 0xE0, 0xE0, 0x50, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x04, 0x02, 0x03, 0x01, 0x80, 0xC0,
+    0x60, 0x30, /*"7",23*/
+    0x3F, 0x18, 0x6C, 0x0F, 0x03, 0xC0, 0xD8, 0x27, 0x18, 0x78, 0x27, 0x18, 0x6C, 0x0F, 0x03, 0xC0,
+    0xF0, 0x36, 0x18, 0x7C, /*"8",24*/
+    0x1E, 0x18, 0x46, 0x1B, 0x02, 0xC0, 0xF0, 0x3C, 0x0F, 0x07, 0x62, 0xCF, 0x30, 0x0C, 0x06, 0x01,
+    0x98, 0x46, 0x30, 0xF0, /*"9",25*/
+    0x09, 0xF0, 0x90, /*":",26*/
+    0xF0, 0x00, 0x3D, 0xA0, /*";",27*/
+    0x81, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, /*"<",28*/
+    0x0A, 0xFF, 0x0A, /*"=",29*/
+    0x01, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x80, /*">",30*/
+    0x35, 0x32, 0x42, 0x11, 0x73, 0x74, 0x64, 0x62, 0x63, 0x62, 0x71, 0x91, 0x91, 0xFD, 0x37, 0x37,
+    0x34, /*"?",31*/
+    0x0E, 0x0C, 0x66, 0x09, 0x9D, 0x4D, 0x73, 0x5C, 0xB7, 0x69, 0xDA, 0x76, 0x9D, 0xA7, 0x6A, 0x4F,
+    0x18, 0x16, 0x08, 0xC6, 0x1E, 0x00, /*"@",32*/
+    0x06, 0x00, 0x60, 0x0A, 0x00, 0xB0, 0x09, 0x00, 0x90, 0x11, 0x01, 0x18, 0x10, 0x81, 0xF8, 0x20,
+    0xC2, 0x0C, 0x20, 0x44, 0x04, 0x40, 0x6F, 0x0F, /*"A",33*/
+    0xFE, 0x18, 0xE6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x31, 0xF8, 0x61, 0x98, 0x26, 0x0D, 0x83, 0x60,
+    0xD8, 0x36, 0x1B, 0xFC, /*"B",34*/
+    0x0F, 0x8C, 0x66, 0x0D, 0x81, 0x40, 0x70, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x01, 0x60,
+    0x58, 0x23, 0x18, 0x78, /*"C",35*/
+    0xFE, 0x06, 0x30, 0xC3, 0x18, 0x63, 0x06, 0x60, 0xCC, 0x19, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x98,
+    0x33, 0x0C, 0x61, 0x8C, 0x67, 0xF0, /*"D",36*/
+    0xFF, 0xCC, 0x19, 0x80, 0xB0, 0x16, 0x00, 0xC2, 0x18, 0x43, 0xF8, 0x61, 0x0C, 0x21, 0x84, 0x30,
+    0x06, 0x02, 0xC0, 0x58, 0x17, 0xFE, /*"E",37*/
+    0xFF, 0xCC, 0x19, 0x80, 0xB0, 0x16, 0x00, 0xC2, 0x18, 0x43, 0xF8, 0x61, 0x0C, 0x21, 0x84, 0x30,
+    0x06, 0x00, 0xC0, 0x18, 0x07, 0xC0, /*"F",38*/
+    0x1E, 0x06, 0x21, 0x82, 0x30, 0x44, 0x09, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0xFF, 0x06, 0x60,
+    0xC6, 0x18, 0xC3, 0x0C, 0x60, 0xF0, /*"G",39*/
+    0xF0, 0xF6, 0x06, 0x60, 0x66, 0x06, 0x60, 0x66, 0x06, 0x60, 0x67, 0xFE, 0x60, 0x66, 0x06, 0x60,
+    0x66, 0x06, 0x60, 0x66, 0x06, 0x60, 0x6F, 0x0F, /*"H",40*/
+    0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, /*"I",41*/
+    0x28, 0x52, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x32, 0x32, 0x32, 0x22, 0x54, 0x50, /*"J",42*/
+    0xF3, 0xCC, 0x31, 0x8C, 0x31, 0x06, 0x40, 0xD0, 0x1B, 0x03, 0xA0, 0x76, 0x0C, 0x41, 0x8C, 0x30,
+    0x86, 0x18, 0xC1, 0x18, 0x37, 0x8F, /*"K",43*/
+    0x05, 0x72, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x71, 0x12, 0x71,
+    0x12, 0x61, 0x1A, 0x10, /*"L",44*/
+    0xE0, 0xEC, 0x39, 0x87, 0x38, 0xE7, 0x1C, 0xE5, 0x9C, 0xB2, 0x96, 0x5A, 0xCB, 0x59, 0x73, 0x26,
+    0x64, 0xCC, 0x99, 0x92, 0x37, 0x0F, /*"M",45*/
+    0x71, 0xF3, 0x04, 0x38, 0x43, 0x84, 0x2C, 0x42, 0xC4, 0x26, 0x42, 0x64, 0x22, 0x42, 0x34, 0x21,
+    0x42, 0x1C, 0x21, 0xC2, 0x0C, 0x20, 0xCF, 0x84, /*"N",46*/
+    0x1E, 0x0C, 0xC6, 0x19, 0x82, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x60,
+    0x98, 0x63, 0x30, 0x78, /*"O",47*/
+    0xFF, 0x0C, 0x19, 0x81, 0xB0, 0x36, 0x06, 0xC0, 0xD8, 0x1B, 0x0E, 0x7F, 0x0C, 0x01, 0x80, 0x30,
+    0x06, 0x00, 0xC0, 0x18, 0x07, 0xC0, /*"P",48*/
+    0x1E, 0x0C, 0xC6, 0x19, 0x82, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x73, 0x64,
+    0x99, 0xE3, 0x30, 0x78, 0x03, 0xC0, 0x60, /*"Q",49*/
+    0xFF, 0x86, 0x0C, 0x60, 0x66, 0x06, 0x60, 0x66, 0x06, 0x60, 0xC7, 0xF0, 0x62, 0x06, 0x30, 0x61,
+    0x06, 0x18, 0x60, 0xC6, 0x0C, 0x60, 0x6F, 0x07, /*"R",50*/
+    0x3E, 0x98, 0x6C, 0x0B, 0x02, 0xC0, 0x38, 0x07, 0x80, 0xF8, 0x0F, 0x80, 0xE0, 0x1E, 0x03, 0x80,
+    0xF0, 0x36, 0x18, 0x7C, /*"S",51*/
+    0x1A, 0x21, 0x32, 0x31, 0x11, 0x42, 0x42, 0x42, 0x41, 0x52, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+    0xA2, 0xA2, 0xA2, 0xA2, 0x86, 0x30, /*"T",52*/
+    0xF1, 0xD8, 0x26, 0x09, 0x82, 0x60, 0x98, 0x26, 0x09, 0x82, 0x60, 0x98, 0x26, 0x09, 0x82, 0x60,
+    0x98, 0x23, 0x10, 0x78, /*"U",53*/
+    0xF0, 0xEC, 0x08, 0x82, 0x10, 0x43, 0x08, 0x61, 0x04, 0x40, 0x88, 0x19, 0x03, 0x20, 0x28, 0x05,
+    0x00, 0xE0, 0x18, 0x01, 0x00, 0x20, /*"V",54*/
+    0xEF, 0x74, 0x62, 0x42, 0x26, 0x22, 0x62, 0x22, 0x64, 0x26, 0x42, 0x74, 0x27, 0x43, 0x94, 0x39,
+    0x81, 0x98, 0x19, 0x81, 0x18, 0x11, 0x01, 0x10, /*"W",55*/
+    0xF3, 0xD8, 0x42, 0x10, 0xC4, 0x12, 0x06, 0x80, 0xC0, 0x20, 0x0C, 0x03, 0x01, 0x60, 0x48, 0x23,
+    0x08, 0x44, 0x1B, 0x8F, /*"X",56*/
+    0xF0, 0xF6, 0x02, 0x20, 0x43, 0x04, 0x10, 0x81, 0x88, 0x1D, 0x00, 0xD0, 0x0E, 0x00, 0x60, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x01, 0xF8, /*"Y",57*/
+    0x7F, 0xD8, 0x2C, 0x1A, 0x04, 0x03, 0x00, 0x80, 0x40, 0x10, 0x08, 0x02, 0x01, 0x00, 0xC0, 0x20,
+    0x58, 0x14, 0x0B, 0xFE, /*"Z",58*/
+    0xFC, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x0F, 0x80, /*"[",59*/
+    0x01, 0x81, 0x91, 0x81, 0x91, 0x81, 0x81, 0x91, 0x81, 0x91, 0x81, 0x82, 0x81, 0x81, 0x91, 0x81,
+    0x91, 0x81, 0x81, 0x91, /*"\",60*/
+    0xF8, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x1F, 0x80, /*"]",61*/
+    0x31, 0x28, 0x40, /*"^",62*/
+    0x0C, /*"_",63*/
+    0xC3, /*"`",64*/
+    0x1F, 0x0C, 0x31, 0x86, 0x00, 0xC0, 0xF8, 0xE3, 0x38, 0x66, 0x0C, 0xC1, 0x9C, 0x75, 0xF3, 0x80, /*"a",65*/
+    0x20, 0x38, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x71, 0xE6, 0x70, 0xD8, 0x36, 0x0D, 0x83, 0x60,
+    0xD8, 0x36, 0x09, 0xC6, 0x4F, 0x00, /*"b",66*/
+    0x1E, 0x31, 0x98, 0xD8, 0x6C, 0x06, 0x03, 0x01, 0x81, 0x60, 0xB0, 0x87, 0x80, /*"c",67*/
+    0x00, 0x81, 0xE0, 0x18, 0x06, 0x01, 0x80, 0x63, 0xD9, 0x8E, 0x61, 0xB0, 0x6C, 0x1B, 0x06, 0xC1,
+    0xB0, 0x64, 0x19, 0x8F, 0x3D, 0x00, /*"d",68*/
+    0x1E, 0x31, 0x90, 0x58, 0x3C, 0x1F, 0xFF, 0x01, 0x80, 0x60, 0xB0, 0x87, 0x80, /*"e",69*/
+    0x54, 0x52, 0x22, 0x32, 0x32, 0x32, 0x82, 0x58, 0x52, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x67, 0x20, /*"f",70*/
+    0x1F, 0xCD, 0xB6, 0x31, 0x8C, 0x63, 0x0C, 0xC3, 0xE1, 0x80, 0x7E, 0x19, 0xEC, 0x1B, 0x06, 0xE3,
+    0x8F, 0x80, /*"g",71*/
+    0x20, 0x38, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0xF1, 0xC6, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
+    0x98, 0x66, 0x19, 0x86, 0xF3, 0xC0, /*"h",72*/
+    0x32, 0x62, 0xF8, 0x13, 0x56, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x23, 0x80, /*"i",73*/
+    0x0E, 0x1C, 0x00, 0x00, 0x27, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x07, 0x9B,
+    0xE0, /*"j",74*/
+    0x20, 0x38, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x39, 0x88, 0x62, 0x19, 0x06, 0xC1, 0xD0, 0x62,
+    0x18, 0xC6, 0x11, 0x86, 0xF3, 0xC0, /*"k",75*/
+    0x08, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0xFF, /*"l",76*/
+    0xEC, 0xE7, 0x76, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xFF,
+    0xF0, /*"m",77*/
+    0xEF, 0x1C, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x6F, 0x3C, /*"n",78*/
+    0x1E, 0x0C, 0xC6, 0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x61, 0x98, 0x61, 0xE0, /*"o",79*/
+    0xEF, 0x1C, 0x66, 0x0D, 0x83, 0x60, 0xD8, 0x36, 0x0D, 0x83, 0x61, 0x9C, 0x66, 0xF1, 0x80, 0x60,
+    0x3E, 0x00, /*"p",80*/
+    0x3C, 0x98, 0xE6, 0x1B, 0x06, 0xC1, 0xB0, 0x6C, 0x1B, 0x06, 0x41, 0x98, 0xE3, 0xD8, 0x06, 0x01,
+    0x81, 0xF0, /*"q",81*/
+    0xF9, 0xC3, 0x4C, 0x71, 0x8C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x03, 0xFC, 0x00, /*"r",82*/
+    0x3F, 0xE3, 0xC1, 0xC1, 0x70, 0x3C, 0x0F, 0x83, 0x83, 0xC7, 0xFE, /*"s",83*/
+    0x08, 0x04, 0x06, 0x03, 0x0F, 0xF0, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x88, 0xC4,
+    0x3C, /*"t",84*/
+    0x20, 0xB8, 0xE6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x67, 0x3C, 0xF4, /*"u",85*/
+    0xF1, 0xD8, 0x22, 0x10, 0x84, 0x31, 0x04, 0x81, 0xA0, 0x68, 0x0C, 0x03, 0x00, 0x80, /*"v",86*/
+    0xEF, 0x74, 0x62, 0x62, 0x22, 0x64, 0x26, 0x43, 0x74, 0x39, 0x81, 0x98, 0x19, 0x81, 0x98, 0x10,
+    0x00, /*"w",87*/
+    0x7B, 0xCC, 0x41, 0x10, 0x68, 0x0C, 0x03, 0x00, 0xE0, 0x48, 0x21, 0x08, 0x6F, 0x3C, /*"x",88*/
+    0xF3, 0xC8, 0x42, 0x10, 0x84, 0x12, 0x04, 0x81, 0xA0, 0x30, 0x0C, 0x03, 0x00, 0x80, 0x20, 0x48,
+    0x1C, 0x00, /*"y",89*/
+    0xFE, 0x86, 0x8C, 0x88, 0x18, 0x10, 0x30, 0x61, 0x41, 0xC3, 0xFE, /*"z",90*/
+    0x19, 0x08, 0x42, 0x10, 0x84, 0x22, 0x20, 0x82, 0x10, 0x84, 0x21, 0x08, 0x41, 0x80, /*"{",91*/
+    0x0F, 0x90, /*"|",92*/
+    0xC1, 0x08, 0x42, 0x10, 0x84, 0x20, 0x82, 0x22, 0x10, 0x84, 0x21, 0x08, 0x4C, 0x00, /*"}",93*/
+    0x70, 0x22, 0x18, 0x64, 0x0E, /*"~",94*/
+};
 
-    0x00, 0x00, 0x38, 0x00, 0x44, 0x20, 0x43, 0x20, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"~",94*/
+static const esp_painter_glyph_t glyphs[] = {
+    {0x0000, 0, 0, 0, 0}, /*" ",0*/
+    {0x0000, 5, 4, 2, 17}, /*"!",1*/
+    {0x0005, 2, 2, 9, 6}, /*""",2*/
+    {0x000C, 1, 4, 10, 17}, /*"#",3*/
+    {0x0022, 2, 3, 8, 20}, /*"$",4*/
+    {0x0036, 0, 4, 11, 17}, /*"%",5*/
+    {0x004E, 0, 4, 12, 17}, /*"&",6*/
+    {0x0068, 2, 2, 3, 6}, /*"'",7*/
+    {0x006B, 5, 2, 6, 21}, /*"(",8*/
+    {0x007B, 1, 2, 6, 21}, /*")",9*/
+    {0x008B, 1, 6, 11, 12}, /*"*",10*/
+    {0x809C, 1, 7, 11, 11}, /*"+",11*/
+    {0x00A8, 2, 18, 3, 6}, /*",",12*/
+    {0x80AB, 1, 12, 10, 1}, /*"-",13*/
+    {0x80AC, 2, 18, 3, 3}, /*".",14*/
+    {0x80AD, 1, 2, 10, 21}, /*"/",15*/
+    {0x00C3, 1, 5, 10, 16}, /*"0",16*/
+    {0x00D7, 2, 5, 8, 16}, /*"1",17*/
+    {0x00E7, 1, 5, 9, 16}, /*"2",18*/
+    {0x00F9, 1, 5, 9, 16}, /*"3",19*/
+    {0x010B, 1, 5, 11, 16}, /*"4",20*/
+    {0x0121, 1, 5, 9, 16}, /*"5",21*/
+    {0x0133, 1, 5, 10, 16}, /*"6",22*/
+    {0x0147, 2, 5, 9, 16}, /*"7",23*/
+    {0x0159, 1, 5, 10, 16}, /*"8",24*/
+    {0x016D, 1, 5, 10, 16}, /*"9",25*/
+    {0x8181, 5, 10, 3, 11}, /*":",26*/
+    {0x0184, 5, 10, 2, 14}, /*";",27*/
+    {0x8188, 2, 4, 9, 17}, /*"<",28*/
+    {0x8199, 1, 10, 10, 5}, /*"=",29*/
+    {0x819C, 2, 4, 9, 17}, /*">",30*/
+    {0x81AE, 2, 5, 10, 16}, /*"?",31*/
+    {0x01BF, 1, 4, 10, 17}, /*"@",32*/
+    {0x01D5, 0, 5, 12, 16}, /*"A",33*/
+    {0x01ED, 1, 5, 10, 16}, /*"B",34*/
+    {0x0201, 1, 5, 10, 16}, /*"C",35*/
+    {0x0215, 0, 5, 11, 16}, /*"D",36*/
+    {0x022B, 0, 5, 11, 16}, /*"E",37*/
+    {0x0241, 0, 5, 11, 16}, /*"F",38*/
+    {0x0257, 1, 5, 11, 16}, /*"G",39*/
+    {0x026D, 0, 5, 12, 16}, /*"H",40*/
+    {0x0285, 2, 5, 8, 16}, /*"I",41*/
+    {0x8295, 1, 5, 10, 19}, /*"J",42*/
+    {0x02AB, 0, 5, 11, 16}, /*"K",43*/
+    {0x82C1, 0, 5, 11, 16}, /*"L",44*/
+    {0x02D5, 0, 5, 11, 16}, /*"M",45*/
+    {0x02EB, 0, 5, 12, 16}, /*"N",46*/
+    {0x0303, 1, 5, 10, 16}, /*"O",47*/
+    {0x0317, 0, 5, 11, 16}, /*"P",48*/
+    {0x032D, 1, 5, 10, 18}, /*"Q",49*/
+    {0x0344, 0, 5, 12, 16}, /*"R",50*/
+    {0x035C, 1, 5, 10, 16}, /*"S",51*/
+    {0x8370, 0, 5, 12, 16}, /*"T",52*/
+    {0x0386, 1, 5, 10, 16}, /*"U",53*/
+    {0x039A, 0, 5, 11, 16}, /*"V",54*/
+    {0x03B0, 0, 5, 12, 16}, /*"W",55*/
+    {0x03C8, 1, 5, 10, 16}, /*"X",56*/
+    {0x03DC, 0, 5, 12, 16}, /*"Y",57*/
+    {0x03F4, 1, 5, 10, 16}, /*"Z",58*/
+    {0x0408, 5, 2, 5, 21}, /*"[",59*/
+    {0x8416, 2, 4, 9, 20}, /*"\",60*/
+    {0x042A, 2, 2, 5, 21}, /*"]",61*/
+    {0x0438, 3, 1, 6, 3}, /*"^",62*/
+    {0x843B, 0, 23, 12, 1}, /*"_",63*/
+    {0x043C, 3, 2, 4, 2}, /*"`",64*/
+    {0x043D, 1, 10, 11, 11}, /*"a",65*/
+    {0x044D, 1, 4, 10, 17}, /*"b",66*/
+    {0x0463, 1, 10, 9, 11}, /*"c",67*/
+    {0x0470, 1, 4, 10, 17}, /*"d",68*/
+    {0x0486, 2, 10, 9, 11}, /*"e",69*/
+    {0x8493, 1, 5, 10, 16}, /*"f",70*/
+    {0x04A6, 1, 10, 10, 14}, /*"g",71*/
+    {0x04B8, 1, 4, 10, 17}, /*"h",72*/
+    {0x84CE, 2, 5, 8, 16}, /*"i",73*/
+    {0x04DD, 2, 5, 7, 19}, /*"j",74*/
+    {0x04EE, 1, 4, 10, 17}, /*"k",75*/
+    {0x0504, 2, 4, 8, 17}, /*"l",76*/
+    {0x0515, 0, 10, 12, 11}, /*"m",77*/
+    {0x0526, 1, 10, 10, 11}, /*"n",78*/
+    {0x0534, 1, 10, 10, 11}, /*"o",79*/
+    {0x0542, 1, 10, 10, 14}, /*"p",80*/
+    {0x0554, 1, 10, 10, 14}, /*"q",81*/
+    {0x0566, 0, 10, 11, 11}, /*"r",82*/
+    {0x0576, 2, 10, 8, 11}, /*"s",83*/
+    {0x0581, 1, 6, 9, 15}, /*"t",84*/
+    {0x0592, 1, 9, 10, 12}, /*"u",85*/
+    {0x05A1, 1, 10, 10, 11}, /*"v",86*/
+    {0x05AF, 0, 10, 12, 11}, /*"w",87*/
+    {0x05C0, 1, 10, 10, 11}, /*"x",88*/
+    {0x05CE, 1, 10, 10, 14}, /*"y",89*/
+    {0x05E0, 2, 10, 8, 11}, /*"z",90*/
+    {0x05EB, 5, 2, 5, 21}, /*"{",91*/
+    {0x85F9, 6, 0, 1, 24}, /*"|",92*/
+    {0x05FB, 2, 2, 5, 21}, /*"}",93*/
+    {0x0609, 1, 1, 10, 4}, /*"~",94*/
 };
 
 const esp_painter_basic_font_t esp_painter_basic_font_24 = {
     .bitmap = bitmap,
+    .glyphs = glyphs,
     .width = 12,
     .height = 24,
+    .first = 0x20,
+    .count = 95,
 };
 
 #endif
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: CC0-1.0
  */
 
+/* Packed by tools/pack_font.py: 14x28 cells, 2648 bytes (1-bit bitmap: 5320) */
+
 #include "sdkconfig.h"
 
 #include "esp_painter_font.h"
@@ -11,486 +13,292 @@
 #if CONFIG_ESP_PAINTER_BASIC_FONT_28
 
 static const uint8_t bitmap[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*" ",0*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
-    0x07, 0x00, 0x07, 0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"!",1*/
-
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x0E, 0xE0, 0x0C, 0xC0, 0x19, 0x80, 0x19, 0x80, 0x33, 0x00,
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*""",2*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20,
-    0x08, 0x20, 0x7F, 0xF8, 0x7F, 0xF8, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x10, 0x40, 0x10, 0x40,
-    0x10, 0x40, 0x7F, 0xF8, 0x7F, 0xF8, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"#",3*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07, 0xC0, 0x0D, 0x60, 0x19, 0x30,
-    0x19, 0x30, 0x19, 0x70, 0x19, 0x00, 0x0D, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x01, 0xE0,
-    0x01, 0x60, 0x01, 0x30, 0x31, 0x30, 0x39, 0x30, 0x31, 0x30, 0x31, 0x30, 0x19, 0x60, 0x07, 0x80,
-    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, /*"$",4*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x20, 0x48, 0x20, 0x84, 0x40,
-    0x84, 0x40, 0x84, 0x80, 0x84, 0x80, 0x85, 0x00, 0x85, 0x00, 0x4A, 0x00, 0x3A, 0x60, 0x02, 0x90,
-    0x05, 0x08, 0x05, 0x08, 0x09, 0x08, 0x09, 0x08, 0x11, 0x08, 0x11, 0x08, 0x20, 0x90, 0x20, 0x70,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"%",5*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x19, 0x80, 0x31, 0x80,
-    0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x33, 0x00, 0x3E, 0x00, 0x18, 0xF8, 0x38, 0x20, 0x4C, 0x20,
-    0x4C, 0x20, 0xC6, 0x20, 0xC6, 0x40, 0xC3, 0x40, 0xC3, 0x80, 0x61, 0x84, 0x71, 0xCC, 0x3E, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"&",6*/
-
-    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x38, 0x00, 0x38, 0x00, 0x18, 0x00, 0x18, 0x00, 0x10, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"'",7*/
-
-    0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20,
-    0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, /*"(",8*/
-
-    0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x10, 0x00, 0x08, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00,
-    0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, /*")",9*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
-    0x03, 0x80, 0x01, 0x80, 0x61, 0x0C, 0x79, 0x3C, 0x1D, 0x70, 0x03, 0x80, 0x03, 0x80, 0x1D, 0x70,
-    0x79, 0x3C, 0x61, 0x0C, 0x03, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"*",10*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x3F, 0xF8, 0x01, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"+",11*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x38, 0x00, 0x38, 0x00, 0x18, 0x00,
-    0x18, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00, 0x00, /*",",12*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"-",13*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*".",14*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x00, 0x10, 0x00, 0x30, 0x00, 0x20, 0x00, 0x60,
-    0x00, 0x40, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x04, 0x00, 0x04, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x18, 0x00, 0x10, 0x00, 0x30, 0x00, 0x20, 0x00,
-    0x60, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, /*"/",15*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x0C, 0x60, 0x18, 0x20,
-    0x30, 0x30, 0x30, 0x30, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18,
-    0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x30, 0x30, 0x30, 0x30, 0x18, 0x20, 0x0C, 0x40, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"0",16*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x1F, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"1",17*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x30, 0xE0, 0x40, 0x70,
-    0x40, 0x30, 0x60, 0x30, 0x60, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80,
-    0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x10, 0x30, 0x10, 0x60, 0x30, 0x7F, 0xF0, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"2",18*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x10, 0xC0, 0x30, 0x60,
-    0x30, 0x60, 0x30, 0x60, 0x00, 0x60, 0x00, 0x40, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xC0, 0x00, 0x60,
-    0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60, 0x10, 0xC0, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"3",19*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x01, 0xC0,
-    0x03, 0xC0, 0x02, 0xC0, 0x04, 0xC0, 0x04, 0xC0, 0x08, 0xC0, 0x10, 0xC0, 0x10, 0xC0, 0x20, 0xC0,
-    0x40, 0xC0, 0x7F, 0xF8, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"4",20*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x10, 0x00,
-    0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x17, 0xC0, 0x18, 0x60, 0x10, 0x60, 0x00, 0x30,
-    0x00, 0x30, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x20, 0x60, 0x10, 0xE0, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"5",21*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x0C, 0x30, 0x18, 0x30,
-    0x30, 0x30, 0x30, 0x00, 0x20, 0x00, 0x60, 0x00, 0x67, 0xC0, 0x68, 0x70, 0x70, 0x30, 0x60, 0x18,
-    0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x20, 0x18, 0x30, 0x18, 0x30, 0x30, 0x1C, 0x60, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"6",22*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x30, 0x20,
-    0x20, 0x20, 0x20, 0x40, 0x00, 0x40, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"7",23*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x30, 0x60, 0x30, 0x70,
-    0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x30, 0x20, 0x38, 0x60, 0x0F, 0x80, 0x0B, 0x80, 0x31, 0xC0,
-    0x30, 0x60, 0x60, 0x70, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x30, 0x60, 0x18, 0x60, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"8",24*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x18, 0xC0, 0x30, 0x60,
-    0x60, 0x20, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x70, 0x30, 0x70, 0x38, 0xB0,
-    0x1F, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x30, 0x60, 0x30, 0xC0, 0x31, 0x80, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"9",25*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*":",26*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x80, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, /*";",27*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40,
-    0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x10, 0x00,
-    0x08, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"<",28*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"=",29*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x08, 0x00,
-    0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x10, 0x00, 0x20,
-    0x00, 0x40, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*">",30*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x10, 0xE0, 0x20, 0x60,
-    0x40, 0x30, 0x40, 0x30, 0x70, 0x30, 0x70, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"?",31*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0C, 0x60, 0x18, 0x10,
-    0x31, 0xB0, 0x33, 0x68, 0x22, 0x68, 0x66, 0x68, 0x66, 0x48, 0x6C, 0x48, 0x6C, 0x48, 0x6C, 0x48,
-    0x6C, 0x48, 0x6C, 0xD0, 0x6D, 0x50, 0x36, 0x60, 0x30, 0x08, 0x18, 0x10, 0x0C, 0x20, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"@",32*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x07, 0x00,
-    0x05, 0x00, 0x05, 0x00, 0x09, 0x80, 0x09, 0x80, 0x08, 0x80, 0x08, 0x80, 0x10, 0xC0, 0x10, 0xC0,
-    0x1F, 0xC0, 0x10, 0x40, 0x20, 0x60, 0x20, 0x60, 0x20, 0x60, 0x20, 0x20, 0x60, 0x30, 0xF0, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"A",33*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x30, 0x60, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60, 0x30, 0xC0, 0x3F, 0x80, 0x30, 0x60, 0x30, 0x30,
-    0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x30, 0x30, 0x70, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"B",34*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0C, 0x30, 0x18, 0x18,
-    0x30, 0x08, 0x30, 0x08, 0x20, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x08, 0x30, 0x08, 0x18, 0x10, 0x1C, 0x20, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"C",35*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x30, 0xC0, 0x30, 0x60,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18,
-    0x30, 0x18, 0x30, 0x18, 0x30, 0x10, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60, 0x30, 0xC0, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"D",36*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x30, 0x30, 0x30, 0x18,
-    0x30, 0x08, 0x30, 0x00, 0x30, 0x40, 0x30, 0x40, 0x30, 0xC0, 0x3F, 0xC0, 0x30, 0xC0, 0x30, 0x40,
-    0x30, 0x40, 0x30, 0x00, 0x30, 0x00, 0x30, 0x08, 0x30, 0x08, 0x30, 0x10, 0x30, 0x30, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"E",37*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x30, 0x30, 0x30, 0x10,
-    0x30, 0x08, 0x30, 0x08, 0x30, 0x40, 0x30, 0x40, 0x30, 0x40, 0x3F, 0xC0, 0x30, 0xC0, 0x30, 0x40,
-    0x30, 0x40, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"F",38*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x0C, 0x60, 0x18, 0x30,
-    0x30, 0x10, 0x30, 0x10, 0x20, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x60, 0xFC, 0x60, 0x30, 0x60, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x30, 0x0C, 0x70, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"G",39*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3F, 0xF0, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xFC, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"H",40*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"I",41*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xC0, 0x00, 0xC0,
-    0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
-    0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
-    0x60, 0xC0, 0x61, 0x80, 0x63, 0x80, 0x3E, 0x00, /*"J",42*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xF0, 0x30, 0x40, 0x30, 0x80,
-    0x30, 0x80, 0x31, 0x00, 0x32, 0x00, 0x32, 0x00, 0x36, 0x00, 0x36, 0x00, 0x3B, 0x00, 0x33, 0x00,
-    0x31, 0x80, 0x31, 0x80, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0x60, 0x30, 0x60, 0x30, 0x70, 0xFC, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"K",43*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x18, 0x00, 0x18, 0x00,
-    0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
-    0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x08, 0x18, 0x08, 0x18, 0x18, 0x18, 0x30, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"L",44*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x38, 0x30, 0x70, 0x30, 0x70,
-    0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x28, 0xB0, 0x28, 0xB0, 0x2C, 0xB0, 0x2C, 0xB0, 0x2D, 0x30,
-    0x25, 0x30, 0x25, 0x30, 0x27, 0x30, 0x27, 0x30, 0x26, 0x30, 0x22, 0x30, 0x22, 0x30, 0x72, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"M",45*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7C, 0x38, 0x10, 0x38, 0x10,
-    0x3C, 0x10, 0x2C, 0x10, 0x2E, 0x10, 0x26, 0x10, 0x26, 0x10, 0x23, 0x10, 0x23, 0x10, 0x21, 0x90,
-    0x21, 0x90, 0x20, 0xD0, 0x20, 0xD0, 0x20, 0x70, 0x20, 0x70, 0x20, 0x30, 0x20, 0x30, 0xF8, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"N",46*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x08, 0x40, 0x10, 0x20,
-    0x30, 0x30, 0x30, 0x30, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18,
-    0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x30, 0x10, 0x30, 0x30, 0x10, 0x20, 0x08, 0x40, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"O",47*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x30, 0x70, 0x30, 0x30,
-    0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x30, 0x30, 0x70, 0x3F, 0xC0, 0x30, 0x00,
-    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"P",48*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x18, 0x60, 0x10, 0x20,
-    0x30, 0x30, 0x30, 0x10, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18,
-    0x60, 0x18, 0x60, 0x18, 0x67, 0x18, 0x29, 0x10, 0x31, 0xB0, 0x18, 0xA0, 0x18, 0xE0, 0x07, 0xC0,
-    0x00, 0x78, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, /*"Q",49*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x18, 0x60, 0x18, 0x30,
-    0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x60, 0x18, 0x60, 0x1F, 0xC0, 0x19, 0x80,
-    0x18, 0x80, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0x40, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x7E, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"R",50*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x20, 0x30, 0xE0, 0x20, 0x60,
-    0x60, 0x20, 0x60, 0x20, 0x60, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xE0,
-    0x00, 0x60, 0x00, 0x70, 0x40, 0x30, 0x40, 0x30, 0x60, 0x30, 0x20, 0x60, 0x38, 0x60, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"S",51*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x23, 0x10, 0x63, 0x08,
-    0x43, 0x08, 0x43, 0x08, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"T",52*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x7C, 0x30, 0x10, 0x30, 0x10,
-    0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0x10,
-    0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0x30, 0x18, 0x60, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"U",53*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x78, 0x70, 0x30, 0x30, 0x20,
-    0x30, 0x20, 0x30, 0x20, 0x10, 0x40, 0x18, 0x40, 0x18, 0x40, 0x18, 0x40, 0x08, 0x80, 0x0C, 0x80,
-    0x0C, 0x80, 0x0D, 0x00, 0x05, 0x00, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"V",54*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x9C, 0x63, 0x08, 0x63, 0x08,
-    0x61, 0x10, 0x21, 0x10, 0x23, 0x10, 0x23, 0x90, 0x33, 0x90, 0x33, 0x90, 0x33, 0xA0, 0x34, 0xA0,
-    0x14, 0xA0, 0x14, 0xA0, 0x14, 0xE0, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0x40, 0x08, 0x40, 0x08, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"W",55*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x78, 0x18, 0x20, 0x18, 0x20,
-    0x08, 0x40, 0x0C, 0x40, 0x04, 0x80, 0x06, 0x80, 0x07, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x05, 0x80, 0x04, 0x80, 0x08, 0xC0, 0x08, 0xC0, 0x08, 0x60, 0x10, 0x60, 0x10, 0x30, 0x78, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"X",56*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x78, 0x30, 0x30, 0x18, 0x20,
-    0x18, 0x20, 0x18, 0x40, 0x0C, 0x40, 0x0C, 0x40, 0x04, 0x80, 0x06, 0x80, 0x07, 0x80, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"Y",57*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x18, 0x10, 0x30, 0x30,
-    0x20, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00,
-    0x06, 0x00, 0x04, 0x00, 0x0C, 0x00, 0x18, 0x08, 0x18, 0x08, 0x30, 0x10, 0x20, 0x30, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"Z",58*/
-
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, /*"[",59*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x30, 0x00, 0x10, 0x00, 0x18, 0x00,
-    0x08, 0x00, 0x08, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x40, 0x00, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20,
-    0x00, 0x10, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, /*"\",60*/
-
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, /*"]",61*/
-
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x80, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"^",62*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, /*"_",63*/
-
-    0x00, 0x00, 0x3C, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"`",64*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x10, 0xE0, 0x30, 0x60, 0x30, 0x60, 0x00, 0x60,
-    0x07, 0xE0, 0x18, 0x60, 0x30, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x68, 0x31, 0xE8, 0x1E, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"a",65*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x00, 0x30, 0x00, 0x30, 0x00,
-    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x33, 0xC0, 0x34, 0x60, 0x38, 0x60, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60, 0x38, 0x60, 0x27, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"b",66*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x0C, 0x60, 0x18, 0x60, 0x18, 0x60, 0x30, 0x00,
-    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x10, 0x18, 0x20, 0x0C, 0x20, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"c",67*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x00, 0x30, 0x00, 0x30,
-    0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x07, 0xB0, 0x0C, 0x70, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x70, 0x18, 0xFC, 0x07, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"d",68*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x0C, 0x60, 0x18, 0x60, 0x10, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x3F, 0xF0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x10, 0x18, 0x10, 0x0C, 0x20, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"e",69*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0x18, 0x06, 0x18,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x3F, 0xE0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"f",70*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xB8, 0x0C, 0xD8, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60,
-    0x18, 0x60, 0x0C, 0xC0, 0x0F, 0x80, 0x18, 0x00, 0x18, 0x00, 0x0F, 0xC0, 0x19, 0xF0, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x18, 0x60, 0x0F, 0xC0, /*"g",71*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x00, 0x30, 0x00, 0x30, 0x00,
-    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x33, 0xE0, 0x34, 0x70, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xFC, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"h",72*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"i",73*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x03, 0xE0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60,
-    0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60,
-    0x00, 0x60, 0x30, 0x40, 0x30, 0xC0, 0x1F, 0x00, /*"j",74*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x78, 0x00, 0x18, 0x00, 0x18, 0x00,
-    0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0xF0, 0x18, 0x40, 0x18, 0x80, 0x18, 0x80, 0x19, 0x00,
-    0x1B, 0x00, 0x1D, 0x80, 0x1C, 0x80, 0x18, 0xC0, 0x18, 0x60, 0x18, 0x60, 0x18, 0x30, 0x7E, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"k",75*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"l",76*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x70, 0x73, 0x98, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18,
-    0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0xF7, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"m",77*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xC0, 0xF4, 0x60, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xFC, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"n",78*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x18, 0x60, 0x30, 0x30, 0x30, 0x30, 0x60, 0x18,
-    0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x20, 0x10, 0x30, 0x30, 0x18, 0x60, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"o",79*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xC0, 0xF4, 0x70, 0x38, 0x30, 0x30, 0x18, 0x30, 0x18,
-    0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x30, 0x38, 0x60, 0x37, 0xC0,
-    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFC, 0x00, /*"p",80*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x20, 0x18, 0xE0, 0x30, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x30, 0x60, 0x30, 0xE0, 0x0F, 0x60,
-    0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x01, 0xF8, /*"q",81*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x70, 0x7C, 0x98, 0x0D, 0x18, 0x0E, 0x00, 0x0C, 0x00,
-    0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"r",82*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x18, 0x70, 0x30, 0x30, 0x30, 0x10, 0x38, 0x00,
-    0x1E, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x20, 0x70, 0x20, 0x30, 0x30, 0x30, 0x38, 0x60, 0x27, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"s",83*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x3F, 0xE0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x10, 0x06, 0x10, 0x03, 0x20, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"t",84*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xF1, 0xE0, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60,
-    0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x38, 0xF8, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"u",85*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x78, 0x10, 0x30, 0x18, 0x20, 0x18, 0x20, 0x08, 0x40,
-    0x0C, 0x40, 0x0C, 0x40, 0x04, 0x80, 0x06, 0x80, 0x06, 0x80, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"v",86*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xBC, 0x63, 0x08, 0x23, 0x10, 0x23, 0x10, 0x33, 0x10,
-    0x33, 0x90, 0x37, 0xA0, 0x14, 0xA0, 0x1C, 0xA0, 0x1C, 0xC0, 0x18, 0xC0, 0x08, 0x40, 0x08, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"w",87*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xF8, 0x0C, 0x20, 0x0C, 0x40, 0x06, 0x40, 0x06, 0x80,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x80, 0x04, 0xC0, 0x08, 0xC0, 0x08, 0x60, 0x10, 0x30, 0x78, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"x",88*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xF8, 0x10, 0x20, 0x18, 0x20, 0x18, 0x40, 0x08, 0x40,
-    0x0C, 0x40, 0x0C, 0x80, 0x04, 0x80, 0x06, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x34, 0x00, 0x38, 0x00, /*"y",89*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x30, 0x60, 0x20, 0xC0, 0x21, 0x80, 0x01, 0x80,
-    0x03, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0C, 0x10, 0x08, 0x10, 0x18, 0x10, 0x30, 0x20, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"z",90*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x40, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00,
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
-    0x00, 0x40, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, /*"{",91*/
-
-    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, /*"|",92*/
-
-    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x08, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00,
-    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x08, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, /*"}",93*/
+    0xFF, 0xFF, 0xDA, 0x49, 0x24, 0x80, 0x1F, 0xF0, /*"!",1*/
+    0x19, 0x9D, 0xCC, 0xCC, 0xC6, 0x66, 0x62, 0x20, /*""",2*/
+    0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0xFF, 0xFF, 0xFF, 0x10, 0x41, 0x04, 0x10, 0x42, 0x08, 0x20,
+    0x82, 0x08, 0xFF, 0xFF, 0xFF, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x80, /*"#",3*/
+    0x04, 0x01, 0x01, 0xF0, 0xD6, 0x64, 0xD9, 0x36, 0x5D, 0x90, 0x34, 0x0F, 0x01, 0xE0, 0x1C, 0x07,
+    0x81, 0x60, 0x4F, 0x13, 0xE4, 0xF1, 0x3C, 0x4D, 0x96, 0x1E, 0x01, 0x00, 0x40, 0x10, /*"$",4*/
+    0x30, 0x22, 0x41, 0x21, 0x11, 0x08, 0x88, 0x48, 0x42, 0x42, 0x14, 0x10, 0xA0, 0x4A, 0x01, 0xD3,
+    0x00, 0xA4, 0x0A, 0x10, 0x50, 0x84, 0x84, 0x24, 0x22, 0x21, 0x11, 0x09, 0x04, 0x88, 0x1C, /*"%",5*/
+    0x0F, 0x00, 0x66, 0x03, 0x18, 0x0C, 0x60, 0x31, 0x80, 0xC6, 0x03, 0x30, 0x0F, 0x80, 0x18, 0xF8,
+    0xE0, 0x84, 0xC2, 0x13, 0x08, 0xC6, 0x23, 0x19, 0x0C, 0x34, 0x30, 0xE0, 0x61, 0x85, 0xC7, 0x33,
+    0xE3, 0x80, /*"&",6*/
+    0xDF, 0xB6, 0xA0, /*"'",7*/
+    0x02, 0x08, 0x20, 0x82, 0x04, 0x10, 0x20, 0x41, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x40, 0x81,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, /*"(",8*/
+    0x80, 0x80, 0x80, 0x80, 0x81, 0x01, 0x02, 0x04, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x04, 0x08,
+    0x10, 0x40, 0x82, 0x08, 0x20, 0x80, /*")",9*/
+    0x03, 0x00, 0x38, 0x00, 0xC1, 0x84, 0x3F, 0x27, 0x9D, 0x70, 0x1C, 0x00, 0xE0, 0x3A, 0xE7, 0x93,
+    0xF0, 0x86, 0x0C, 0x00, 0x70, 0x03, 0x00, /*"*",10*/
+    0x51, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0x5B, 0x51, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0x50, /*"+",11*/
+    0xDF, 0xB6, 0xA0, /*",",12*/
+    0x0C, /*"-",13*/
+    0x09, /*".",14*/
+    0xB1, 0xA2, 0xA1, 0xA2, 0xA1, 0xA2, 0xA1, 0xA2, 0xA1, 0xB1, 0xA1, 0xB1, 0xA1, 0xB1, 0xA1, 0xB1,
+    0xA2, 0xA1, 0xA2, 0xA1, 0xA2, 0xA1, 0xA2, 0xA1, 0xB0, /*"/",15*/
+    0x0F, 0x01, 0x8C, 0x30, 0x46, 0x06, 0x60, 0x6C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
+    0x3C, 0x03, 0xC0, 0x3C, 0x03, 0x60, 0x66, 0x06, 0x30, 0x41, 0x88, 0x0F, 0x00, /*"0",16*/
+    0x08, 0x18, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0xFF, /*"1",17*/
+    0x35, 0x42, 0x43, 0x11, 0x74, 0x84, 0x74, 0x72, 0x92, 0x82, 0x92, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x61, 0x12, 0x73, 0x7F, 0x81, /*"2",18*/
+    0x3E, 0x10, 0xCC, 0x1B, 0x06, 0xC1, 0x80, 0x60, 0x10, 0x0C, 0x0E, 0x00, 0xC0, 0x18, 0x03, 0x00,
+    0xC0, 0x3C, 0x0F, 0x03, 0xC1, 0x90, 0xC3, 0xE0, /*"3",19*/
+    0x72, 0xA2, 0x93, 0x84, 0x81, 0x12, 0x71, 0x22, 0x71, 0x22, 0x61, 0x32, 0x51, 0x42, 0x51, 0x42,
+    0x41, 0x52, 0x31, 0x62, 0x3C, 0x72, 0xA2, 0xA2, 0xA2, 0xA2, 0x78, /*"4",20*/
+    0x7F, 0xDF, 0xF4, 0x01, 0x00, 0x40, 0x10, 0x04, 0x01, 0x7C, 0x61, 0x90, 0x60, 0x0C, 0x03, 0x00,
+    0xF0, 0x3C, 0x0F, 0x03, 0x81, 0x90, 0xE3, 0xE0, /*"5",21*/
+    0x07, 0x81, 0x86, 0x30, 0x66, 0x06, 0x60, 0x04, 0x00, 0xC0, 0x0C, 0xF8, 0xD0, 0xEE, 0x06, 0xC0,
+    0x3C, 0x03, 0xC0, 0x3C, 0x03, 0x40, 0x36, 0x03, 0x60, 0x63, 0x8C, 0x0F, 0x80, /*"6",22*/
+    0x19, 0x1B, 0x61, 0x11, 0x71, 0x11, 0x61, 0x91, 0x81, 0x91, 0x81, 0x91, 0x81, 0x91, 0x91, 0x91,
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x50, /*"7",23*/
+    0x1F, 0x0C, 0x19, 0x83, 0xE0, 0x3C, 0x07, 0x80, 0xD8, 0x13, 0x86, 0x1F, 0x02, 0xE1, 0x8E, 0x30,
+    0x6C, 0x0F, 0x80, 0xF0, 0x1E, 0x03, 0x60, 0xC6, 0x18, 0x7C, 0x00, /*"8",24*/
+    0x1F, 0x06, 0x31, 0x83, 0x60, 0x2C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0xEC, 0x1D, 0xC5, 0x9F,
+    0x30, 0x06, 0x01, 0x80, 0x33, 0x06, 0x61, 0x8C, 0x60, 0xF8, 0x00, /*"9",25*/
+    0x09, 0xF6, 0x90, /*":",26*/
+    0xFC, 0x00, 0x00, 0x03, 0xF2, 0xB0, /*";",27*/
+    0x91, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+    0xA1, 0xA1, 0xA1, /*"<",28*/
+    0x0C, 0xFF, 0xF3, 0xC0, /*"=",29*/
+    0x01, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, 0x81, 0x90, /*">",30*/
+    0x35, 0x51, 0x43, 0x21, 0x62, 0x11, 0x83, 0x85, 0x65, 0x62, 0x82, 0x82, 0x82, 0x82, 0x91, 0xA1,
+    0xA1, 0xFF, 0x13, 0x83, 0x83, 0x40, /*"?",31*/
+    0x0F, 0x81, 0x8C, 0x30, 0x26, 0x36, 0x66, 0xD4, 0x4D, 0xCC, 0xDC, 0xC9, 0xD8, 0x9D, 0x89, 0xD8,
+    0x9D, 0x89, 0xD9, 0xAD, 0xAA, 0x6C, 0xC6, 0x01, 0x30, 0x21, 0x84, 0x0F, 0x80, /*"@",32*/
+    0x02, 0x00, 0x38, 0x01, 0xC0, 0x0A, 0x00, 0x50, 0x04, 0xC0, 0x26, 0x01, 0x10, 0x08, 0x80, 0x86,
+    0x04, 0x30, 0x3F, 0x81, 0x04, 0x10, 0x30, 0x81, 0x84, 0x0C, 0x20, 0x23, 0x01, 0xBC, 0x3E, /*"A",33*/
+    0xFF, 0xC1, 0x83, 0x0C, 0x0C, 0x60, 0x63, 0x03, 0x18, 0x18, 0xC1, 0x86, 0x18, 0x3F, 0x81, 0x83,
+    0x0C, 0x0C, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0x66, 0x03, 0x30, 0x31, 0x83, 0xBF, 0xF0, /*"B",34*/
+    0x45, 0x62, 0x42, 0x32, 0x62, 0x12, 0x81, 0x12, 0x81, 0x11, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+    0xA2, 0xA2, 0xB2, 0x81, 0x12, 0x81, 0x22, 0x61, 0x33, 0x41, 0x65, 0x30, /*"C",35*/
+    0xFF, 0x01, 0x86, 0x0C, 0x18, 0x60, 0x63, 0x03, 0x18, 0x0C, 0xC0, 0x66, 0x03, 0x30, 0x19, 0x80,
+    0xCC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x08, 0xC0, 0xC6, 0x06, 0x30, 0x61, 0x86, 0x3F, 0xC0, /*"D",36*/
+    0xFF, 0xF1, 0x81, 0x8C, 0x06, 0x60, 0x13, 0x00, 0x18, 0x20, 0xC1, 0x06, 0x18, 0x3F, 0xC1, 0x86,
+    0x0C, 0x10, 0x60, 0x83, 0x00, 0x18, 0x00, 0xC0, 0x26, 0x01, 0x30, 0x11, 0x81, 0xBF, 0xFC, /*"E",37*/
+    0x0C, 0x32, 0x62, 0x32, 0x71, 0x32, 0x81, 0x22, 0x81, 0x22, 0x51, 0x52, 0x51, 0x52, 0x51, 0x58,
+    0x52, 0x42, 0x52, 0x51, 0x52, 0x51, 0x52, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0x96, 0x70, /*"F",38*/
+    0x44, 0x82, 0x32, 0x52, 0x52, 0x32, 0x71, 0x32, 0x71, 0x31, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+    0x58, 0x72, 0x22, 0x72, 0x32, 0x62, 0x32, 0x62, 0x42, 0x52, 0x52, 0x33, 0x65, 0x40, /*"G",39*/
+    0xFC, 0xFC, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x3F, 0xF0,
+    0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xCF,
+    0xCF, 0xC0, /*"H",40*/
+    0x0A, 0x42, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x82, 0x4A, /*"I",41*/
+    0x3A, 0x72, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+    0xB2, 0xB2, 0xB2, 0x42, 0x52, 0x42, 0x42, 0x52, 0x33, 0x65, 0x70, /*"J",42*/
+    0xFD, 0xF1, 0x82, 0x0C, 0x20, 0x61, 0x03, 0x10, 0x19, 0x00, 0xC8, 0x06, 0xC0, 0x36, 0x01, 0xD8,
+    0x0C, 0xC0, 0x63, 0x03, 0x18, 0x18, 0x60, 0xC3, 0x06, 0x0C, 0x30, 0x61, 0x83, 0xBF, 0x3E, /*"K",43*/
+    0x06, 0x82, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x71,
+    0x22, 0x71, 0x22, 0x62, 0x22, 0x52, 0x1B, 0x10, /*"L",44*/
+    0xE0, 0x76, 0x0E, 0x60, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x51, 0x65, 0x16, 0x59, 0x65, 0x96, 0x5A,
+    0x64, 0xA6, 0x4A, 0x64, 0xE6, 0x4E, 0x64, 0xC6, 0x44, 0x64, 0x46, 0xE4, 0xF0, /*"M",45*/
+    0xF0, 0x7C, 0xE0, 0x43, 0x81, 0x0F, 0x04, 0x2C, 0x10, 0xB8, 0x42, 0x61, 0x09, 0x84, 0x23, 0x10,
+    0x8C, 0x42, 0x19, 0x08, 0x64, 0x20, 0xD0, 0x83, 0x42, 0x07, 0x08, 0x1C, 0x20, 0x30, 0x80, 0xCF,
+    0x81, 0x00, /*"N",46*/
+    0x0F, 0x01, 0x08, 0x20, 0x46, 0x06, 0x60, 0x6C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
+    0x3C, 0x03, 0xC0, 0x3C, 0x03, 0x60, 0x26, 0x06, 0x20, 0x41, 0x08, 0x0F, 0x00, /*"O",47*/
+    0x0A, 0x52, 0x53, 0x32, 0x62, 0x32, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x62, 0x32,
+    0x53, 0x38, 0x52, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0x96, 0x70, /*"P",48*/
+    0x0F, 0x03, 0x0C, 0x20, 0x46, 0x06, 0x60, 0x2C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
+    0x3C, 0x03, 0xC0, 0x3C, 0xE3, 0x52, 0x26, 0x36, 0x31, 0x43, 0x1C, 0x0F, 0x80, 0x0F, 0x00, 0xE0, /*"Q",49*/
+    0xFF, 0x83, 0x0C, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x0C, 0x30, 0xC3, 0xF8, 0x33,
+    0x03, 0x10, 0x31, 0x83, 0x18, 0x30, 0x83, 0x0C, 0x30, 0xC3, 0x0C, 0xFC, 0x70, /*"R",50*/
+    0x1E, 0x4C, 0x39, 0x03, 0x60, 0x2C, 0x05, 0x80, 0x38, 0x03, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x00,
+    0x60, 0x0F, 0x00, 0xE0, 0x1E, 0x03, 0x40, 0xCE, 0x18, 0x3C, 0x00, /*"S",51*/
+    0x1A, 0x21, 0x32, 0x31, 0x12, 0x32, 0x42, 0x42, 0x42, 0x42, 0x41, 0x52, 0xA2, 0xA2, 0xA2, 0xA2,
+    0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x86, 0x30, /*"T",52*/
+    0xFC, 0x7C, 0xC0, 0x43, 0x01, 0x0C, 0x04, 0x30, 0x10, 0xC0, 0x43, 0x01, 0x0C, 0x04, 0x30, 0x10,
+    0xC0, 0x43, 0x01, 0x0C, 0x04, 0x30, 0x10, 0xC0, 0x43, 0x01, 0x0C, 0x04, 0x30, 0x30, 0x61, 0x80,
+    0x78, 0x00, /*"U",53*/
+    0xF8, 0x7B, 0x81, 0x8C, 0x08, 0x60, 0x43, 0x02, 0x08, 0x20, 0x61, 0x03, 0x08, 0x18, 0x40, 0x44,
+    0x03, 0x20, 0x19, 0x00, 0xD0, 0x02, 0x80, 0x1C, 0x00, 0xE0, 0x06, 0x00, 0x10, 0x00, 0x80, /*"V",54*/
+    0xF7, 0x9D, 0x8C, 0x26, 0x30, 0x98, 0x44, 0x21, 0x10, 0x8C, 0x42, 0x39, 0x0C, 0xE4, 0x33, 0x90,
+    0xCE, 0x83, 0x4A, 0x05, 0x28, 0x14, 0xA0, 0x53, 0x81, 0x8C, 0x06, 0x30, 0x18, 0x40, 0x21, 0x00,
+    0x84, 0x00, /*"W",55*/
+    0xF8, 0xF3, 0x04, 0x30, 0x41, 0x08, 0x18, 0x80, 0x90, 0x0D, 0x00, 0xE0, 0x06, 0x00, 0x60, 0x06,
+    0x00, 0xB0, 0x09, 0x01, 0x18, 0x11, 0x81, 0x0C, 0x20, 0xC2, 0x06, 0xF1, 0xF0, /*"X",56*/
+    0xF8, 0xF6, 0x06, 0x30, 0x43, 0x04, 0x30, 0x81, 0x88, 0x18, 0x80, 0x90, 0x0D, 0x00, 0xF0, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x1F, 0x80, /*"Y",57*/
+    0x2A, 0x22, 0x61, 0x22, 0x62, 0x21, 0x62, 0xA2, 0x92, 0xA1, 0xA2, 0xA1, 0xA2, 0xA1, 0xA2, 0xA1,
+    0xA2, 0x92, 0x71, 0x22, 0x71, 0x12, 0x71, 0x21, 0x72, 0x1B, 0x10, /*"Z",58*/
+    0xFF, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83,
+    0x06, 0x0C, 0x18, 0x30, 0x7F, /*"[",59*/
+    0x01, 0xA2, 0xA1, 0xA2, 0xA1, 0xA1, 0xB1, 0xA1, 0xB1, 0xA1, 0xA2, 0xA1, 0xA1, 0xB1, 0xA1, 0xB1,
+    0xA1, 0xB1, 0xA1, 0xA1, 0xB1, 0xA1, 0xB1, /*"\",60*/
+    0xFC, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+    0x10, 0x7F, /*"]",61*/
+    0x38, 0x8A, 0x08, /*"^",62*/
+    0x0E, /*"_",63*/
+    0xF0, 0x60, 0x40, /*"`",64*/
+    0x1F, 0x02, 0x1C, 0x60, 0xC6, 0x0C, 0x00, 0xC0, 0xFC, 0x30, 0xC6, 0x0C, 0xC0, 0xCC, 0x0C, 0xC0,
+    0xD6, 0x3D, 0x3C, 0x60, /*"a",65*/
+    0x10, 0x0F, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x3C, 0x34, 0x63, 0x86, 0x30,
+    0x33, 0x03, 0x30, 0x33, 0x03, 0x30, 0x33, 0x03, 0x30, 0x33, 0x06, 0x38, 0x62, 0x78, /*"b",66*/
+    0x1E, 0x0C, 0x66, 0x19, 0x86, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x16, 0x08, 0xC2, 0x1F,
+    0x00, /*"c",67*/
+    0x00, 0x40, 0x3C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC1, 0xEC, 0x31, 0xC6, 0x0C, 0xC0,
+    0xCC, 0x0C, 0xC0, 0xCC, 0x0C, 0xC0, 0xCC, 0x0C, 0xC0, 0xC6, 0x1C, 0x63, 0xF1, 0xC8, /*"d",68*/
+    0x1E, 0x0C, 0x66, 0x19, 0x03, 0xC0, 0xF0, 0x3F, 0xFF, 0x00, 0xC0, 0x30, 0x16, 0x04, 0xC2, 0x1F,
+    0x00, /*"e",69*/
+    0x55, 0x52, 0x32, 0x32, 0x42, 0x32, 0x92, 0x92, 0x69, 0x52, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x69, 0x20, /*"f",70*/
+    0x1E, 0xE6, 0x6D, 0x86, 0x30, 0xC6, 0x18, 0xC3, 0x0C, 0xC1, 0xF0, 0x60, 0x0C, 0x00, 0xFC, 0x33,
+    0xEC, 0x0D, 0x81, 0xB0, 0x33, 0x0C, 0x3F, 0x00, /*"g",71*/
+    0x31, 0xA4, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x25, 0x52, 0x11, 0x33, 0x43, 0x52, 0x42, 0x62,
+    0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62,
+    0x26, 0x26, /*"h",72*/
+    0x24, 0x44, 0xFF, 0x01, 0x35, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+    0x38, /*"i",73*/
+    0x64, 0x64, 0xFF, 0x81, 0x55, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x82, 0x12, 0x51, 0x22, 0x42, 0x35, 0x40, /*"j",74*/
+    0x10, 0x0F, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x1E, 0x30, 0x83, 0x10, 0x31,
+    0x03, 0x20, 0x36, 0x03, 0xB0, 0x39, 0x03, 0x18, 0x30, 0xC3, 0x0C, 0x30, 0x6F, 0xCF, /*"k",75*/
+    0x51, 0x55, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x4A, /*"l",76*/
+    0xEE, 0x71, 0xCE, 0x66, 0x31, 0x98, 0xC6, 0x63, 0x19, 0x8C, 0x66, 0x31, 0x98, 0xC6, 0x63, 0x19,
+    0x8C, 0x66, 0x31, 0x98, 0xC6, 0xF7, 0xBC, /*"m",77*/
+    0x13, 0xC3, 0xD1, 0x83, 0x83, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30,
+    0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0xFC, 0xFC, /*"n",78*/
+    0x0F, 0x03, 0x0C, 0x60, 0x66, 0x06, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x34, 0x02, 0x60,
+    0x63, 0x0C, 0x0F, 0x00, /*"o",79*/
+    0x13, 0xC7, 0xA3, 0x8E, 0x0C, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0x66, 0x03, 0x30, 0x19, 0x80,
+    0xCC, 0x0C, 0x70, 0xC3, 0x7C, 0x18, 0x00, 0xC0, 0x06, 0x00, 0xFC, 0x00, /*"p",80*/
+    0x1E, 0x43, 0x1C, 0x60, 0xCC, 0x0C, 0xC0, 0xCC, 0x0C, 0xC0, 0xCC, 0x0C, 0xC0, 0xCC, 0x0C, 0x60,
+    0xC6, 0x1C, 0x1E, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x03, 0xF0, /*"q",81*/
+    0x32, 0x33, 0x15, 0x21, 0x22, 0x32, 0x11, 0x32, 0x33, 0x92, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+    0xA2, 0x78, 0x40, /*"r",82*/
+    0x3E, 0x58, 0x7C, 0x0F, 0x01, 0xE0, 0x1E, 0x01, 0xF0, 0x1E, 0x81, 0xE0, 0x3C, 0x0F, 0x86, 0x9F,
+    0x00, /*"s",83*/
+    0x41, 0x91, 0x82, 0x73, 0x59, 0x42, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x41, 0x32,
+    0x41, 0x42, 0x21, 0x54, 0x20, /*"t",84*/
+    0x10, 0x27, 0x8F, 0x0C, 0x18, 0x60, 0xC3, 0x06, 0x18, 0x30, 0xC1, 0x86, 0x0C, 0x30, 0x61, 0x83,
+    0x0C, 0x18, 0x60, 0xC3, 0x8F, 0x8F, 0xA0, /*"u",85*/
+    0xF8, 0xF2, 0x06, 0x30, 0x43, 0x04, 0x10, 0x81, 0x88, 0x18, 0x80, 0x90, 0x0D, 0x00, 0xD0, 0x06,
+    0x00, 0x60, 0x04, 0x00, /*"v",86*/
+    0xF7, 0xBD, 0x8C, 0x22, 0x31, 0x08, 0xC4, 0x33, 0x10, 0xCE, 0x43, 0x7A, 0x05, 0x28, 0x1C, 0xA0,
+    0x73, 0x01, 0x8C, 0x02, 0x10, 0x08, 0x40, /*"w",87*/
+    0x7D, 0xF1, 0x84, 0x18, 0x80, 0xC8, 0x0D, 0x00, 0x60, 0x06, 0x00, 0x70, 0x09, 0x81, 0x18, 0x10,
+    0xC2, 0x06, 0xF1, 0xF0, /*"x",88*/
+    0xF9, 0xF2, 0x04, 0x30, 0x43, 0x08, 0x10, 0x81, 0x88, 0x19, 0x00, 0x90, 0x0D, 0x00, 0x60, 0x06,
+    0x00, 0x60, 0x04, 0x00, 0x40, 0x04, 0x06, 0x80, 0x70, 0x00, /*"y",89*/
+    0xFF, 0xB0, 0x68, 0x32, 0x18, 0x06, 0x03, 0x00, 0x80, 0x60, 0x30, 0x48, 0x16, 0x07, 0x02, 0xFF,
+    0x80, /*"z",90*/
+    0x0C, 0x42, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x10, 0x81, 0x02, 0x08, 0x20, 0x82, 0x08, 0x20,
+    0x81, 0x03, /*"{",91*/
+    0x0F, 0xD0, /*"|",92*/
+    0xC0, 0x81, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x02, 0x04, 0x21, 0x04, 0x10, 0x41, 0x04, 0x10,
+    0x42, 0x30, /*"}",93*/
+    0x38, 0x04, 0xC1, 0x86, 0x18, 0x32, 0x01, 0xC0, /*"~",94*/
+};
 
-    0x1C, 0x00, 0x26, 0x08, 0x43, 0x08, 0x41, 0x90, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"~",94*/
+static const esp_painter_glyph_t glyphs[] = {
+    {0x0000, 0, 0, 0, 0}, /*" ",0*/
+    {0x0000, 5, 4, 3, 20}, /*"!",1*/
+    {0x0008, 2, 2, 9, 7}, /*""",2*/
+    {0x0010, 1, 5, 12, 19}, /*"#",3*/
+    {0x002D, 2, 3, 10, 24}, /*"$",4*/
+    {0x004B, 0, 5, 13, 19}, /*"%",5*/
+    {0x006A, 0, 5, 14, 19}, /*"&",6*/
+    {0x008C, 2, 2, 3, 7}, /*"'",7*/
+    {0x008F, 6, 1, 7, 25}, /*"(",8*/
+    {0x00A5, 1, 1, 7, 25}, /*")",9*/
+    {0x00BB, 1, 7, 13, 14}, /*"*",10*/
+    {0x80D2, 2, 7, 11, 13}, /*"+",11*/
+    {0x00E0, 2, 20, 3, 7}, /*",",12*/
+    {0x80E3, 1, 13, 12, 1}, /*"-",13*/
+    {0x80E4, 2, 21, 3, 3}, /*".",14*/
+    {0x80E5, 1, 2, 12, 24}, /*"/",15*/
+    {0x00FE, 1, 5, 12, 19}, /*"0",16*/
+    {0x011B, 3, 5, 8, 19}, /*"1",17*/
+    {0x812E, 1, 5, 11, 19}, /*"2",18*/
+    {0x0144, 2, 5, 10, 19}, /*"3",19*/
+    {0x815C, 1, 5, 12, 19}, /*"4",20*/
+    {0x0177, 2, 5, 10, 19}, /*"5",21*/
+    {0x018F, 1, 5, 12, 19}, /*"6",22*/
+    {0x81AC, 2, 5, 10, 19}, /*"7",23*/
+    {0x01C2, 1, 5, 11, 19}, /*"8",24*/
+    {0x01DD, 1, 5, 11, 19}, /*"9",25*/
+    {0x81F8, 5, 11, 3, 13}, /*":",26*/
+    {0x01FB, 6, 12, 3, 15}, /*";",27*/
+    {0x8201, 2, 5, 10, 19}, /*"<",28*/
+    {0x8214, 1, 11, 12, 6}, /*"=",29*/
+    {0x8218, 2, 5, 10, 19}, /*">",30*/
+    {0x822C, 1, 5, 11, 19}, /*"?",31*/
+    {0x0242, 1, 5, 12, 19}, /*"@",32*/
+    {0x025F, 0, 5, 13, 19}, /*"A",33*/
+    {0x027E, 0, 5, 13, 19}, /*"B",34*/
+    {0x829D, 1, 5, 12, 19}, /*"C",35*/
+    {0x02B9, 0, 5, 13, 19}, /*"D",36*/
+    {0x02D8, 0, 5, 13, 19}, /*"E",37*/
+    {0x82F7, 0, 5, 13, 19}, /*"F",38*/
+    {0x8315, 1, 5, 13, 19}, /*"G",39*/
+    {0x0333, 0, 5, 14, 19}, /*"H",40*/
+    {0x8355, 2, 5, 10, 19}, /*"I",41*/
+    {0x8368, 1, 5, 13, 23}, /*"J",42*/
+    {0x0383, 0, 5, 13, 19}, /*"K",43*/
+    {0x83A2, 1, 5, 12, 19}, /*"L",44*/
+    {0x03BA, 1, 5, 12, 19}, /*"M",45*/
+    {0x03D7, 0, 5, 14, 19}, /*"N",46*/
+    {0x03F9, 1, 5, 12, 19}, /*"O",47*/
+    {0x8416, 0, 5, 13, 19}, /*"P",48*/
+    {0x0432, 1, 5, 12, 21}, /*"Q",49*/
+    {0x0452, 1, 5, 12, 19}, /*"R",50*/
+    {0x046F, 1, 5, 11, 19}, /*"S",51*/
+    {0x848A, 1, 5, 12, 19}, /*"T",52*/
+    {0x04A4, 0, 5, 14, 19}, /*"U",53*/
+    {0x04C6, 0, 5, 13, 19}, /*"V",54*/
+    {0x04E5, 0, 5, 14, 19}, /*"W",55*/
+    {0x0507, 1, 5, 12, 19}, /*"X",56*/
+    {0x0524, 1, 5, 12, 19}, /*"Y",57*/
+    {0x8541, 1, 5, 12, 19}, /*"Z",58*/
+    {0x055C, 5, 2, 7, 24}, /*"[",59*/
+    {0x8571, 2, 4, 11, 23}, /*"\",60*/
+    {0x0588, 2, 2, 6, 24}, /*"]",61*/
+    {0x059A, 3, 2, 7, 3}, /*"^",62*/
+    {0x859D, 0, 27, 14, 1}, /*"_",63*/
+    {0x059E, 2, 1, 6, 3}, /*"`",64*/
+    {0x05A1, 1, 11, 12, 13}, /*"a",65*/
+    {0x05B5, 0, 4, 12, 20}, /*"b",66*/
+    {0x05D3, 2, 11, 10, 13}, /*"c",67*/
+    {0x05E4, 2, 4, 12, 20}, /*"d",68*/
+    {0x0602, 2, 11, 10, 13}, /*"e",69*/
+    {0x8613, 2, 5, 11, 19}, /*"f",70*/
+    {0x0629, 2, 11, 11, 17}, /*"g",71*/
+    {0x8641, 0, 4, 14, 20}, /*"h",72*/
+    {0x8663, 3, 5, 8, 19}, /*"i",73*/
+    {0x8674, 2, 5, 10, 23}, /*"j",74*/
+    {0x068C, 1, 4, 12, 20}, /*"k",75*/
+    {0x86AA, 2, 4, 10, 20}, /*"l",76*/
+    {0x06BE, 0, 11, 14, 13}, /*"m",77*/
+    {0x06D5, 0, 11, 14, 13}, /*"n",78*/
+    {0x06EC, 1, 11, 12, 13}, /*"o",79*/
+    {0x0700, 0, 11, 13, 17}, /*"p",80*/
+    {0x071C, 1, 11, 12, 17}, /*"q",81*/
+    {0x8736, 1, 11, 12, 13}, /*"r",82*/
+    {0x0749, 2, 11, 10, 13}, /*"s",83*/
+    {0x875A, 2, 7, 10, 17}, /*"t",84*/
+    {0x076F, 0, 10, 13, 14}, /*"u",85*/
+    {0x0786, 1, 11, 12, 13}, /*"v",86*/
+    {0x079A, 0, 11, 14, 13}, /*"w",87*/
+    {0x07B1, 1, 11, 12, 13}, /*"x",88*/
+    {0x07C5, 1, 11, 12, 17}, /*"y",89*/
+    {0x07DF, 2, 11, 10, 13}, /*"z",90*/
+    {0x07F0, 6, 2, 6, 24}, /*"{",91*/
+    {0x8802, 7, 0, 1, 28}, /*"|",92*/
+    {0x0804, 2, 2, 6, 24}, /*"}",93*/
+    {0x0816, 1, 0, 12, 5}, /*"~",94*/
 };
 
 const esp_painter_basic_font_t esp_painter_basic_font_28 = {
     .bitmap = bitmap,
+    .glyphs = glyphs,
     .width = 14,
     .height = 28,
+    .first = 0x20,
+    .count = 95,
 };
 
 #endif
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: CC0-1.0
  */
 
+/* Packed by tools/pack_font.py: 18x36 cells, 3609 bytes (1-bit bitmap: 10260) */
+
 #include "sdkconfig.h"
 
 #include "esp_painter_font.h"
@@ -11,771 +13,348 @@
 #if CONFIG_ESP_PAINTER_BASIC_FONT_36
 
 static const uint8_t bitmap[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*" ",0*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0,
-    0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"!",1*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC7, 0x00, 0x01, 0xC7, 0x00, 0x03, 0xCF, 0x00, 0x03,
-    0x8E, 0x00, 0x07, 0x1C, 0x00, 0x06, 0x18, 0x00, 0x0C, 0x30, 0x00, 0x18, 0x60, 0x00, 0x10, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*""",2*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04,
-    0x00, 0x04, 0x04, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x0C, 0x0C, 0x00,
-    0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x08,
-    0x08, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x18, 0x18, 0x00, 0x18, 0x18,
-    0x00, 0x18, 0x18, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"#",3*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x80, 0x00, 0x03, 0xF0, 0x00, 0x06, 0x88, 0x00, 0x0C, 0x84, 0x00, 0x18, 0x86, 0x00, 0x18, 0x86,
-    0x00, 0x18, 0x8E, 0x00, 0x18, 0x8E, 0x00, 0x1C, 0x80, 0x00, 0x0E, 0x80, 0x00, 0x0F, 0x80, 0x00,
-    0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x9C, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x86, 0x00, 0x38, 0x86, 0x00, 0x38, 0x86, 0x00, 0x38, 0x86,
-    0x00, 0x30, 0x84, 0x00, 0x10, 0x8C, 0x00, 0x08, 0x98, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, /*"$",4*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x04, 0x00, 0x66, 0x0C, 0x00, 0x42, 0x08, 0x00, 0xC3, 0x08, 0x00, 0xC3, 0x10,
-    0x00, 0xC3, 0x10, 0x00, 0xC3, 0x20, 0x00, 0xC3, 0x20, 0x00, 0xC3, 0x20, 0x00, 0xC3, 0x40, 0x00,
-    0x42, 0x40, 0x00, 0x66, 0x80, 0x00, 0x3C, 0x9E, 0x00, 0x00, 0xB3, 0x00, 0x01, 0x31, 0x00, 0x01,
-    0x61, 0x80, 0x02, 0x61, 0x80, 0x02, 0x61, 0x80, 0x06, 0x61, 0x80, 0x04, 0x61, 0x80, 0x04, 0x61,
-    0x80, 0x08, 0x61, 0x80, 0x08, 0x21, 0x00, 0x10, 0x33, 0x00, 0x10, 0x1E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"%",5*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x0C, 0x80, 0x00, 0x08, 0xC0, 0x00, 0x18, 0xC0, 0x00, 0x18, 0xC0,
-    0x00, 0x18, 0xC0, 0x00, 0x18, 0xC0, 0x00, 0x18, 0x80, 0x00, 0x19, 0x80, 0x00, 0x1D, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0C, 0x3E, 0x00, 0x1E, 0x18, 0x00, 0x26, 0x08, 0x00, 0x67, 0x08, 0x00, 0x43,
-    0x08, 0x00, 0xC3, 0x10, 0x00, 0xC3, 0x90, 0x00, 0xC1, 0xD0, 0x00, 0xC0, 0xD0, 0x00, 0xC0, 0xE0,
-    0x00, 0x60, 0x70, 0x80, 0x60, 0x79, 0x80, 0x30, 0x9F, 0x00, 0x1F, 0x0E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"&",6*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"'",7*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x20, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"(",8*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0xC0, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*")",9*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xC0,
-    0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x70, 0xC7, 0x00, 0x78, 0x8F, 0x00, 0x3C, 0x9E, 0x00,
-    0x0E, 0xB8, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0xB8, 0x00, 0x3C, 0x9E, 0x00, 0x78,
-    0x8F, 0x00, 0x71, 0x87, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"*",10*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x40, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"+",11*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, /*",",12*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"-",13*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*".",14*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x01, 0x80, 0x00,
-    0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00, 0x30, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00, 0x30, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"/",15*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x06, 0x18, 0x00, 0x04, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x18, 0x06,
-    0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00,
-    0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30,
-    0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06,
-    0x00, 0x0C, 0x0C, 0x00, 0x04, 0x08, 0x00, 0x06, 0x18, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"0",16*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"1",17*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x0C, 0x1C, 0x00, 0x18, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 0x03,
-    0x00, 0x38, 0x03, 0x00, 0x38, 0x03, 0x00, 0x38, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x08, 0x01,
-    0x00, 0x10, 0x03, 0x00, 0x30, 0x07, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"2",18*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x08, 0x38, 0x00, 0x10, 0x0C, 0x00, 0x20, 0x0E, 0x00, 0x30, 0x06,
-    0x00, 0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x30, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x18, 0x03, 0x00, 0x38, 0x03, 0x00, 0x38, 0x03,
-    0x00, 0x38, 0x06, 0x00, 0x18, 0x04, 0x00, 0x0C, 0x18, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"3",19*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x58,
-    0x00, 0x00, 0xD8, 0x00, 0x00, 0x98, 0x00, 0x01, 0x18, 0x00, 0x03, 0x18, 0x00, 0x02, 0x18, 0x00,
-    0x04, 0x18, 0x00, 0x0C, 0x18, 0x00, 0x08, 0x18, 0x00, 0x10, 0x18, 0x00, 0x10, 0x18, 0x00, 0x20,
-    0x18, 0x00, 0x60, 0x18, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"4",20*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x11, 0xF0, 0x00,
-    0x16, 0x0C, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x18, 0x03, 0x00, 0x38, 0x03, 0x00, 0x38, 0x06,
-    0x00, 0x30, 0x06, 0x00, 0x10, 0x0C, 0x00, 0x0C, 0x18, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"5",21*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x03, 0x04, 0x00, 0x06, 0x06, 0x00, 0x0C, 0x06, 0x00, 0x08, 0x06,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00, 0x30, 0x00, 0x00, 0x31, 0xF0, 0x00,
-    0x36, 0x1C, 0x00, 0x34, 0x06, 0x00, 0x38, 0x06, 0x00, 0x38, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30,
-    0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x02,
-    0x00, 0x0C, 0x06, 0x00, 0x0C, 0x04, 0x00, 0x06, 0x08, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"6",22*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x18, 0x02, 0x00, 0x30, 0x04, 0x00, 0x20, 0x04,
-    0x00, 0x20, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x00, 0x01,
-    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80,
-    0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"7",23*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x06, 0x0C, 0x00, 0x0C, 0x06, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03,
-    0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x1C, 0x03, 0x00, 0x0E, 0x06, 0x00, 0x0F, 0x06, 0x00,
-    0x07, 0x88, 0x00, 0x03, 0xF0, 0x00, 0x06, 0xF8, 0x00, 0x0C, 0x3C, 0x00, 0x18, 0x1E, 0x00, 0x18,
-    0x0E, 0x00, 0x30, 0x07, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03,
-    0x00, 0x18, 0x02, 0x00, 0x18, 0x06, 0x00, 0x0E, 0x0C, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"8",24*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x0E, 0x18, 0x00, 0x08, 0x0C, 0x00, 0x18, 0x04, 0x00, 0x10, 0x06,
-    0x00, 0x30, 0x02, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00,
-    0x30, 0x07, 0x00, 0x18, 0x07, 0x00, 0x18, 0x0B, 0x00, 0x0E, 0x13, 0x00, 0x03, 0xE3, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x18, 0x0C,
-    0x00, 0x18, 0x08, 0x00, 0x18, 0x18, 0x00, 0x08, 0x70, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"9",25*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xE0, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*":",26*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00,
-    0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, /*";",27*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"<",28*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"=",29*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x00, 0x01, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*">",30*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x06, 0x0C, 0x00, 0x08, 0x06, 0x00, 0x10, 0x02, 0x00, 0x30, 0x03,
-    0x00, 0x30, 0x03, 0x00, 0x3C, 0x03, 0x00, 0x3C, 0x03, 0x00, 0x1C, 0x03, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x78, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"?",31*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x07, 0x0C, 0x00, 0x0C, 0x02, 0x00, 0x08, 0x01, 0x00, 0x18, 0x7D,
-    0x00, 0x30, 0xCD, 0x00, 0x31, 0x8C, 0x80, 0x21, 0x8C, 0x80, 0x63, 0x08, 0x80, 0x63, 0x08, 0x80,
-    0x63, 0x18, 0x80, 0x66, 0x18, 0x80, 0x66, 0x18, 0x80, 0x66, 0x18, 0x80, 0x66, 0x18, 0x80, 0x66,
-    0x31, 0x00, 0x66, 0x31, 0x00, 0x22, 0x52, 0x00, 0x33, 0x9C, 0x00, 0x30, 0x00, 0x80, 0x10, 0x01,
-    0x00, 0x18, 0x03, 0x00, 0x0C, 0x06, 0x00, 0x06, 0x0C, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"@",32*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x60,
-    0x00, 0x02, 0x60, 0x00, 0x02, 0x60, 0x00, 0x02, 0x60, 0x00, 0x06, 0x30, 0x00, 0x04, 0x30, 0x00,
-    0x04, 0x30, 0x00, 0x04, 0x30, 0x00, 0x0C, 0x38, 0x00, 0x08, 0x18, 0x00, 0x08, 0x18, 0x00, 0x0F,
-    0xF8, 0x00, 0x18, 0x18, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x0C, 0x00, 0x10, 0x0C, 0x00, 0x30, 0x0C,
-    0x00, 0x20, 0x0E, 0x00, 0x20, 0x06, 0x00, 0x30, 0x06, 0x00, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"A",33*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x18, 0x1E, 0x00, 0x18, 0x06, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03,
-    0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00,
-    0x18, 0x18, 0x00, 0x1F, 0xF0, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x06, 0x00, 0x18, 0x03, 0x00, 0x18,
-    0x01, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
-    0x80, 0x18, 0x03, 0x00, 0x18, 0x07, 0x00, 0x18, 0x0E, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"B",34*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF9, 0x00, 0x02, 0x0F, 0x00, 0x0C, 0x03, 0x00, 0x08, 0x01, 0x00, 0x18, 0x01,
-    0x80, 0x30, 0x00, 0x80, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x80, 0x30, 0x00, 0x80, 0x30, 0x01,
-    0x00, 0x18, 0x01, 0x00, 0x0C, 0x02, 0x00, 0x06, 0x0C, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"C",35*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x18, 0x38, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x06, 0x00, 0x18, 0x02,
-    0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
-    0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
-    0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x06,
-    0x00, 0x18, 0x06, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x38, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"D",36*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x00, 0x18, 0x07, 0x00, 0x18, 0x03, 0x00, 0x18, 0x01, 0x80, 0x18, 0x00,
-    0x80, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x08, 0x00, 0x18, 0x08, 0x00, 0x18, 0x08, 0x00,
-    0x18, 0x18, 0x00, 0x1F, 0xF8, 0x00, 0x18, 0x18, 0x00, 0x18, 0x08, 0x00, 0x18, 0x08, 0x00, 0x18,
-    0x08, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x80, 0x18, 0x00,
-    0x80, 0x18, 0x01, 0x00, 0x18, 0x03, 0x00, 0x18, 0x07, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"E",37*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x18, 0x0F, 0x00, 0x18, 0x03, 0x00, 0x18, 0x01, 0x00, 0x18, 0x00,
-    0x80, 0x18, 0x00, 0x80, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x08, 0x00, 0x18, 0x08, 0x00,
-    0x18, 0x18, 0x00, 0x1F, 0xF8, 0x00, 0x18, 0x18, 0x00, 0x18, 0x08, 0x00, 0x18, 0x08, 0x00, 0x18,
-    0x08, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"F",38*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x06, 0x1C, 0x00, 0x0C, 0x0C, 0x00, 0x18, 0x04, 0x00, 0x10, 0x06,
-    0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x20, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x3F, 0x80, 0x60,
-    0x06, 0x00, 0x60, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0x10, 0x06,
-    0x00, 0x18, 0x06, 0x00, 0x0C, 0x06, 0x00, 0x06, 0x08, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"G",39*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x1F, 0x80, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06,
-    0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00,
-    0x18, 0x06, 0x00, 0x1F, 0xFE, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18,
-    0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06,
-    0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"H",40*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"I",41*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x70, 0x18, 0x00,
-    0x70, 0x30, 0x00, 0x70, 0x30, 0x00, 0x30, 0x40, 0x00, 0x1F, 0x80, 0x00, /*"J",42*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x3F, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x08, 0x00, 0x18, 0x10, 0x00, 0x18, 0x30,
-    0x00, 0x18, 0x20, 0x00, 0x18, 0x40, 0x00, 0x18, 0xC0, 0x00, 0x18, 0x80, 0x00, 0x19, 0x80, 0x00,
-    0x19, 0x80, 0x00, 0x1B, 0xC0, 0x00, 0x1C, 0xC0, 0x00, 0x1C, 0xE0, 0x00, 0x18, 0x60, 0x00, 0x18,
-    0x60, 0x00, 0x18, 0x30, 0x00, 0x18, 0x30, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x1C,
-    0x00, 0x18, 0x0C, 0x00, 0x18, 0x0E, 0x00, 0x18, 0x06, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"K",43*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x80, 0x18, 0x00,
-    0x80, 0x18, 0x01, 0x00, 0x18, 0x03, 0x00, 0x18, 0x07, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"L",44*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x07, 0xC0, 0x38, 0x07, 0x00, 0x38, 0x07, 0x00, 0x38, 0x07, 0x00, 0x38, 0x07,
-    0x00, 0x2C, 0x0B, 0x00, 0x2C, 0x0B, 0x00, 0x2C, 0x0B, 0x00, 0x2C, 0x0B, 0x00, 0x2E, 0x13, 0x00,
-    0x26, 0x13, 0x00, 0x26, 0x13, 0x00, 0x26, 0x13, 0x00, 0x26, 0x23, 0x00, 0x23, 0x23, 0x00, 0x23,
-    0x23, 0x00, 0x23, 0x23, 0x00, 0x23, 0x43, 0x00, 0x23, 0xC3, 0x00, 0x21, 0xC3, 0x00, 0x21, 0xC3,
-    0x00, 0x21, 0xC3, 0x00, 0x21, 0x83, 0x00, 0x20, 0x83, 0x00, 0xF8, 0x8F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"M",45*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x0F, 0x80, 0x1C, 0x02, 0x00, 0x1C, 0x02, 0x00, 0x16, 0x02, 0x00, 0x16, 0x02,
-    0x00, 0x16, 0x02, 0x00, 0x13, 0x02, 0x00, 0x13, 0x02, 0x00, 0x11, 0x82, 0x00, 0x11, 0x82, 0x00,
-    0x10, 0xC2, 0x00, 0x10, 0xC2, 0x00, 0x10, 0xE2, 0x00, 0x10, 0x62, 0x00, 0x10, 0x62, 0x00, 0x10,
-    0x32, 0x00, 0x10, 0x32, 0x00, 0x10, 0x1A, 0x00, 0x10, 0x1A, 0x00, 0x10, 0x0E, 0x00, 0x10, 0x0E,
-    0x00, 0x10, 0x0E, 0x00, 0x10, 0x06, 0x00, 0x10, 0x06, 0x00, 0x7C, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"N",46*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x06, 0x18, 0x00, 0x0C, 0x04, 0x00, 0x18, 0x06, 0x00, 0x10, 0x02,
-    0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x20, 0x01, 0x00, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80,
-    0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x60,
-    0x01, 0x80, 0x60, 0x01, 0x80, 0x20, 0x01, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x10, 0x02,
-    0x00, 0x18, 0x06, 0x00, 0x0C, 0x04, 0x00, 0x06, 0x18, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"O",47*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x18, 0x0E, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x01,
-    0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x03, 0x00,
-    0x18, 0x07, 0x00, 0x18, 0x0E, 0x00, 0x1F, 0xF8, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"P",48*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x06, 0x18, 0x00, 0x0C, 0x04, 0x00, 0x18, 0x06, 0x00, 0x10, 0x02,
-    0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80,
-    0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x60,
-    0x01, 0x80, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x27, 0xC1, 0x00, 0x3C, 0x63, 0x00, 0x38, 0x33,
-    0x00, 0x18, 0x32, 0x00, 0x08, 0x3C, 0x00, 0x06, 0x18, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1C, 0x80,
-    0x00, 0x0F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"Q",49*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x06, 0x00, 0x18, 0x07, 0x00, 0x18, 0x03,
-    0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00,
-    0x18, 0x1C, 0x00, 0x1F, 0xF0, 0x00, 0x18, 0x60, 0x00, 0x18, 0x60, 0x00, 0x18, 0x70, 0x00, 0x18,
-    0x30, 0x00, 0x18, 0x30, 0x00, 0x18, 0x38, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x1C,
-    0x00, 0x18, 0x0C, 0x00, 0x18, 0x0E, 0x00, 0x18, 0x06, 0x00, 0x7E, 0x07, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"R",50*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x0C, 0x1E, 0x00, 0x18, 0x0E, 0x00, 0x10, 0x06, 0x00, 0x30, 0x02,
-    0x00, 0x30, 0x02, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x20, 0x03, 0x00, 0x20, 0x03, 0x00, 0x30, 0x03,
-    0x00, 0x10, 0x06, 0x00, 0x18, 0x06, 0x00, 0x1E, 0x0C, 0x00, 0x11, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"S",51*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x30, 0xC3, 0x00, 0x20, 0xC1, 0x00, 0x20, 0xC1, 0x80, 0x40, 0xC0,
-    0x80, 0x40, 0xC0, 0x80, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"T",52*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x0F, 0x80, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02,
-    0x00, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00,
-    0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18,
-    0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02,
-    0x00, 0x18, 0x04, 0x00, 0x0C, 0x04, 0x00, 0x06, 0x18, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"U",53*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x0F, 0x80, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x1C, 0x06, 0x00, 0x0C, 0x04,
-    0x00, 0x0C, 0x04, 0x00, 0x0C, 0x04, 0x00, 0x0E, 0x0C, 0x00, 0x0E, 0x08, 0x00, 0x06, 0x08, 0x00,
-    0x06, 0x08, 0x00, 0x06, 0x18, 0x00, 0x07, 0x10, 0x00, 0x03, 0x10, 0x00, 0x03, 0x10, 0x00, 0x03,
-    0x20, 0x00, 0x03, 0xA0, 0x00, 0x01, 0xA0, 0x00, 0x01, 0xA0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0,
-    0x00, 0x01, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"V",54*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF9, 0xF3, 0xC0, 0x70, 0xC1, 0x80, 0x30, 0xC1, 0x00, 0x30, 0xC1, 0x00, 0x30, 0xC1,
-    0x00, 0x30, 0x61, 0x00, 0x30, 0xE1, 0x00, 0x30, 0xE2, 0x00, 0x30, 0xE2, 0x00, 0x18, 0xE2, 0x00,
-    0x18, 0xE2, 0x00, 0x19, 0x62, 0x00, 0x19, 0x32, 0x00, 0x19, 0x34, 0x00, 0x19, 0x34, 0x00, 0x19,
-    0x34, 0x00, 0x0E, 0x34, 0x00, 0x0E, 0x34, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x18, 0x00, 0x0E, 0x18,
-    0x00, 0x0E, 0x18, 0x00, 0x04, 0x18, 0x00, 0x04, 0x18, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"W",55*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x1F, 0x00, 0x1C, 0x06, 0x00, 0x0C, 0x04, 0x00, 0x0C, 0x08, 0x00, 0x0E, 0x08,
-    0x00, 0x06, 0x18, 0x00, 0x07, 0x10, 0x00, 0x03, 0x30, 0x00, 0x03, 0xA0, 0x00, 0x01, 0xE0, 0x00,
-    0x01, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01,
-    0x70, 0x00, 0x03, 0x30, 0x00, 0x02, 0x30, 0x00, 0x06, 0x18, 0x00, 0x04, 0x18, 0x00, 0x04, 0x1C,
-    0x00, 0x08, 0x0C, 0x00, 0x08, 0x0E, 0x00, 0x18, 0x06, 0x00, 0x7C, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"X",56*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x0F, 0x80, 0x38, 0x06, 0x00, 0x18, 0x06, 0x00, 0x1C, 0x04, 0x00, 0x0C, 0x04,
-    0x00, 0x0C, 0x08, 0x00, 0x06, 0x08, 0x00, 0x06, 0x08, 0x00, 0x07, 0x10, 0x00, 0x03, 0x10, 0x00,
-    0x03, 0x30, 0x00, 0x01, 0xA0, 0x00, 0x01, 0xA0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"Y",57*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x1C, 0x06, 0x00, 0x18, 0x0E, 0x00, 0x30, 0x0C, 0x00, 0x20, 0x1C,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0C, 0x01, 0x00, 0x1C, 0x01,
-    0x00, 0x18, 0x02, 0x00, 0x38, 0x06, 0x00, 0x30, 0x0E, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"Z",58*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"[",59*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x10, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, /*"\",60*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"]",61*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x03, 0x60, 0x00, 0x06, 0x10, 0x00, 0x08,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"^",62*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, /*"_",63*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"`",64*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x0C, 0x18, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x01,
-    0xFC, 0x00, 0x07, 0x0C, 0x00, 0x1C, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C,
-    0x00, 0x30, 0x0C, 0x80, 0x30, 0x1C, 0x80, 0x18, 0x3C, 0x80, 0x0F, 0xC7, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"a",65*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0xF8, 0x00,
-    0x1B, 0x0C, 0x00, 0x1E, 0x06, 0x00, 0x1C, 0x06, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18,
-    0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03,
-    0x00, 0x18, 0x06, 0x00, 0x1C, 0x06, 0x00, 0x1E, 0x0C, 0x00, 0x11, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"b",66*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x07, 0x0C, 0x00, 0x0C, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x30, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x10, 0x01,
-    0x00, 0x18, 0x02, 0x00, 0x0C, 0x02, 0x00, 0x06, 0x0C, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"c",67*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x03, 0xE6, 0x00,
-    0x06, 0x1E, 0x00, 0x0C, 0x0E, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30,
-    0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 0x06,
-    0x00, 0x18, 0x0E, 0x00, 0x18, 0x0E, 0x00, 0x0C, 0x17, 0x80, 0x03, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"d",68*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x06, 0x0C, 0x00, 0x0C, 0x06, 0x00, 0x18, 0x06, 0x00, 0x10, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30,
-    0x03, 0x00, 0x3F, 0xFF, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x10, 0x01,
-    0x00, 0x18, 0x01, 0x00, 0x0C, 0x02, 0x00, 0x06, 0x0C, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"e",69*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xC1, 0x00, 0x01, 0x81, 0x80, 0x01, 0x01, 0x80, 0x03, 0x01,
-    0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"f",70*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE3, 0x80,
-    0x06, 0x3D, 0x80, 0x0C, 0x18, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x18,
-    0x0C, 0x00, 0x0C, 0x18, 0x00, 0x06, 0x18, 0x00, 0x0F, 0xE0, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x18, 0x1E, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00,
-    0x30, 0x03, 0x00, 0x38, 0x02, 0x00, 0x1C, 0x0E, 0x00, 0x07, 0xF8, 0x00, /*"g",71*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0xF8, 0x00,
-    0x1B, 0x0C, 0x00, 0x1C, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18,
-    0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06,
-    0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"h",72*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"i",73*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00,
-    0x18, 0x08, 0x00, 0x18, 0x18, 0x00, 0x18, 0x30, 0x00, 0x0F, 0xC0, 0x00, /*"j",74*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x3F, 0x00,
-    0x18, 0x1C, 0x00, 0x18, 0x10, 0x00, 0x18, 0x30, 0x00, 0x18, 0x60, 0x00, 0x18, 0xC0, 0x00, 0x19,
-    0xC0, 0x00, 0x1B, 0xE0, 0x00, 0x1E, 0x60, 0x00, 0x1C, 0x70, 0x00, 0x18, 0x38, 0x00, 0x18, 0x18,
-    0x00, 0x18, 0x1C, 0x00, 0x18, 0x0E, 0x00, 0x18, 0x06, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"k",75*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"l",76*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x77, 0x9E, 0x00,
-    0x38, 0xE3, 0x00, 0x38, 0xC3, 0x00, 0x30, 0xC3, 0x00, 0x30, 0xC3, 0x00, 0x30, 0xC3, 0x00, 0x30,
-    0xC3, 0x00, 0x30, 0xC3, 0x00, 0x30, 0xC3, 0x00, 0x30, 0xC3, 0x00, 0x30, 0xC3, 0x00, 0x30, 0xC3,
-    0x00, 0x30, 0xC3, 0x00, 0x30, 0xC3, 0x00, 0x30, 0xC3, 0x00, 0x79, 0xE7, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"m",77*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00,
-    0x7B, 0x0C, 0x00, 0x1E, 0x06, 0x00, 0x1C, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18,
-    0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06,
-    0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"n",78*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x06, 0x18, 0x00, 0x0C, 0x0C, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x30, 0x03, 0x00, 0x30,
-    0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x10, 0x02,
-    0x00, 0x18, 0x06, 0x00, 0x0C, 0x0C, 0x00, 0x06, 0x18, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"o",79*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF0, 0x00,
-    0x7B, 0x0C, 0x00, 0x1C, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18,
-    0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x06,
-    0x00, 0x18, 0x06, 0x00, 0x1C, 0x0C, 0x00, 0x1A, 0x18, 0x00, 0x19, 0xF0, 0x00, 0x18, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x7E, 0x00, 0x00, /*"p",80*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE2, 0x00,
-    0x06, 0x1E, 0x00, 0x0C, 0x0E, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30,
-    0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 0x06,
-    0x00, 0x18, 0x06, 0x00, 0x18, 0x0E, 0x00, 0x0C, 0x16, 0x00, 0x03, 0xE6, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x1F, 0x80, /*"q",81*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1E, 0x00,
-    0x7E, 0x23, 0x00, 0x06, 0xC3, 0x00, 0x06, 0x83, 0x00, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"r",82*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF2, 0x00,
-    0x06, 0x0E, 0x00, 0x0C, 0x06, 0x00, 0x0C, 0x02, 0x00, 0x0C, 0x02, 0x00, 0x0E, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1C, 0x00, 0x10, 0x0E, 0x00, 0x10, 0x06,
-    0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x1E, 0x0C, 0x00, 0x11, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"s",83*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x03, 0x02, 0x00, 0x03, 0x04, 0x00, 0x01, 0x84, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"t",84*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x78, 0x1E, 0x00,
-    0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18,
-    0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06,
-    0x00, 0x18, 0x06, 0x00, 0x18, 0x0E, 0x00, 0x0C, 0x17, 0x80, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"u",85*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x00,
-    0x18, 0x0C, 0x00, 0x18, 0x04, 0x00, 0x0C, 0x08, 0x00, 0x0C, 0x08, 0x00, 0x0C, 0x18, 0x00, 0x06,
-    0x10, 0x00, 0x06, 0x10, 0x00, 0x06, 0x20, 0x00, 0x03, 0x20, 0x00, 0x03, 0x20, 0x00, 0x03, 0xC0,
-    0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"v",86*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xE7, 0xC0,
-    0x70, 0xC1, 0x00, 0x30, 0xC1, 0x00, 0x30, 0xC1, 0x00, 0x30, 0xE2, 0x00, 0x10, 0xE2, 0x00, 0x18,
-    0xE2, 0x00, 0x19, 0x66, 0x00, 0x19, 0x34, 0x00, 0x0D, 0x34, 0x00, 0x0F, 0x34, 0x00, 0x0E, 0x38,
-    0x00, 0x0E, 0x18, 0x00, 0x06, 0x18, 0x00, 0x06, 0x18, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"w",87*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00,
-    0x0E, 0x08, 0x00, 0x06, 0x10, 0x00, 0x06, 0x10, 0x00, 0x03, 0x20, 0x00, 0x03, 0xE0, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0x60, 0x00, 0x02, 0x30, 0x00, 0x06, 0x30,
-    0x00, 0x04, 0x18, 0x00, 0x08, 0x18, 0x00, 0x18, 0x0C, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"x",88*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0x80,
-    0x0C, 0x06, 0x00, 0x0C, 0x04, 0x00, 0x06, 0x04, 0x00, 0x06, 0x0C, 0x00, 0x02, 0x08, 0x00, 0x03,
-    0x08, 0x00, 0x03, 0x18, 0x00, 0x01, 0x90, 0x00, 0x01, 0x90, 0x00, 0x01, 0xB0, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x80, 0x00, 0x19, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1E, 0x00, 0x00, /*"y",89*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x38, 0x1C, 0x00, 0x30, 0x38, 0x00, 0x20, 0x30, 0x00, 0x20, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x06, 0x02, 0x00, 0x0E, 0x02,
-    0x00, 0x0C, 0x06, 0x00, 0x18, 0x04, 0x00, 0x38, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"z",90*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x60, 0x00, 0x00, 0x80, 0x00, 0x00, 0x60, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"{",91*/
-
-    0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, /*"|",92*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"}",93*/
+    0x7F, 0xFF, 0xFF, 0xF7, 0x66, 0x66, 0x66, 0x66, 0x60, 0x00, 0x06, 0xFF, 0x60, /*"!",1*/
+    0x0E, 0x38, 0x71, 0xC7, 0x9E, 0x38, 0xE3, 0x8E, 0x18, 0x61, 0x86, 0x18, 0x60, 0x82, 0x00, /*""",2*/
+    0x41, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x3F, 0xFF, 0x33, 0x26,
+    0x26, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x14, 0xFF, 0xF3, 0x22,
+    0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x71, 0x71, 0x71, 0x71, 0x71, 0x50, /*"#",3*/
+    0x02, 0x00, 0x10, 0x00, 0x80, 0x1F, 0x81, 0xA2, 0x19, 0x09, 0x88, 0x6C, 0x43, 0x62, 0x3B, 0x11,
+    0xDC, 0x80, 0x74, 0x03, 0xE0, 0x0F, 0x00, 0x3C, 0x00, 0xF8, 0x03, 0xE0, 0x17, 0x80, 0x9C, 0x04,
+    0x70, 0x21, 0xF1, 0x0F, 0x88, 0x7C, 0x43, 0xC2, 0x12, 0x11, 0x88, 0x98, 0x3F, 0x00, 0x20, 0x01,
+    0x00, 0x08, 0x00, 0x40, /*"$",4*/
+    0x3C, 0x04, 0x33, 0x06, 0x10, 0x82, 0x18, 0x61, 0x0C, 0x31, 0x06, 0x18, 0x83, 0x0C, 0x81, 0x86,
+    0x40, 0xC3, 0x20, 0x61, 0xA0, 0x10, 0x90, 0x0C, 0xD0, 0x03, 0xC9, 0xE0, 0x05, 0x98, 0x04, 0xC4,
+    0x02, 0xC3, 0x02, 0x61, 0x81, 0x30, 0xC1, 0x98, 0x60, 0x8C, 0x30, 0x46, 0x18, 0x43, 0x0C, 0x20,
+    0x84, 0x20, 0x66, 0x10, 0x1E, 0x00, /*"%",5*/
+    0x07, 0x80, 0x06, 0x40, 0x02, 0x30, 0x03, 0x18, 0x01, 0x8C, 0x00, 0xC6, 0x00, 0x63, 0x00, 0x31,
+    0x00, 0x19, 0x80, 0x0E, 0x80, 0x03, 0x80, 0x01, 0x87, 0xC1, 0xE1, 0x81, 0x30, 0x41, 0x9C, 0x20,
+    0x86, 0x10, 0xC3, 0x10, 0x61, 0xC8, 0x30, 0x74, 0x18, 0x1A, 0x0C, 0x0E, 0x03, 0x03, 0x85, 0x81,
+    0xE6, 0x61, 0x3E, 0x1F, 0x0E, 0x00, /*"&",6*/
+    0x33, 0xDE, 0x71, 0x88, 0xCC, 0xC0, /*"'",7*/
+    0x81, 0x71, 0x71, 0x71, 0x72, 0x62, 0x71, 0x72, 0x72, 0x62, 0x72, 0x72, 0x62, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x82, 0x72, 0x72, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x91, 0x91, 0x91, /*"(",8*/
+    0x01, 0x91, 0x91, 0x91, 0x82, 0x82, 0x81, 0x82, 0x72, 0x82, 0x72, 0x72, 0x82, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x62, 0x72, 0x72, 0x71, 0x72, 0x71, 0x72, 0x62, 0x71, 0x71, 0x71, 0x71,
+    0x80, /*")",9*/
+    0x72, 0xC3, 0xC3, 0xC3, 0x63, 0x42, 0x37, 0x31, 0x34, 0x14, 0x21, 0x24, 0x43, 0x11, 0x13, 0x93,
+    0xC3, 0x93, 0x11, 0x13, 0x44, 0x21, 0x24, 0x14, 0x31, 0x37, 0x32, 0x43, 0x63, 0xC3, 0xC3, 0xC3,
+    0x60, /*"*",10*/
+    0x71, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0x7F, 0x07, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+    0x1E, 0x17, /*"+",11*/
+    0x33, 0xDE, 0x71, 0x88, 0xCC, 0xC0, /*",",12*/
+    0xFF, 0xFF, /*"-",13*/
+    0x6F, 0xF6, /*".",14*/
+    0xF0, 0x1E, 0x2E, 0x1E, 0x2E, 0x1E, 0x2E, 0x1E, 0x2E, 0x1E, 0x2E, 0x1E, 0x2E, 0x1E, 0x2E, 0x1E,
+    0x2E, 0x1E, 0x2E, 0x1E, 0x2E, 0x1E, 0x2E, 0x1E, 0x2E, 0x1E, 0x2E, 0x1E, 0x2E, 0x1E, 0x2E, 0x1F,
+    0x00, /*"/",15*/
+    0x54, 0x82, 0x42, 0x61, 0x62, 0x42, 0x62, 0x32, 0x82, 0x22, 0x82, 0x22, 0x82, 0x12, 0xA4, 0xA4,
+    0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA2, 0x12, 0x82, 0x22, 0x82, 0x22, 0x82, 0x32,
+    0x62, 0x51, 0x61, 0x62, 0x42, 0x84, 0x50, /*"0",16*/
+    0x51, 0x82, 0x46, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x74, 0x3A, /*"1",17*/
+    0x46, 0x62, 0x53, 0x32, 0x82, 0x12, 0x92, 0x12, 0xA5, 0x95, 0x95, 0x92, 0xC2, 0xB2, 0xC2, 0xB2,
+    0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xC1, 0xC1, 0x91, 0x21, 0xA1, 0x11, 0xA4, 0x9F, 0x11, 0xD1, /*"2",18*/
+    0x36, 0x71, 0x53, 0x41, 0x82, 0x21, 0x93, 0x12, 0x92, 0x12, 0x92, 0x12, 0x92, 0xC2, 0xB2, 0xC2,
+    0xA2, 0x94, 0xE2, 0xD2, 0xD2, 0xD1, 0xD2, 0xC2, 0x12, 0x95, 0x95, 0x95, 0x82, 0x22, 0x81, 0x42,
+    0x52, 0x75, 0x50, /*"3",19*/
+    0xA2, 0xE2, 0xD3, 0xD3, 0xC1, 0x12, 0xB2, 0x12, 0xB1, 0x22, 0xA1, 0x32, 0x92, 0x32, 0x91, 0x42,
+    0x81, 0x52, 0x72, 0x52, 0x71, 0x62, 0x61, 0x72, 0x61, 0x72, 0x51, 0x82, 0x42, 0x82, 0x4F, 0x1A,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2A, 0x91, /*"4",20*/
+    0x2C, 0x2C, 0x21, 0xD1, 0xC2, 0xC1, 0xD1, 0xD1, 0xD1, 0xD1, 0x35, 0x51, 0x12, 0x52, 0x32, 0x82,
+    0x22, 0x82, 0xD2, 0xC2, 0xC2, 0xC2, 0xC2, 0x12, 0x95, 0x95, 0x82, 0x12, 0x92, 0x21, 0x82, 0x42,
+    0x52, 0x76, 0x40, /*"5",21*/
+    0x65, 0x72, 0x51, 0x52, 0x62, 0x32, 0x72, 0x31, 0x82, 0x22, 0xC2, 0xC1, 0xC2, 0xC2, 0x35, 0x42,
+    0x12, 0x43, 0x22, 0x11, 0x72, 0x13, 0x82, 0x13, 0x94, 0xA4, 0xA4, 0xA4, 0xA4, 0xA2, 0x12, 0x92,
+    0x12, 0x91, 0x32, 0x72, 0x32, 0x71, 0x52, 0x51, 0x85, 0x40, /*"6",22*/
+    0x1D, 0x1D, 0x12, 0x91, 0x12, 0x91, 0x21, 0xA1, 0x21, 0x91, 0xD1, 0xC1, 0xD1, 0xC1, 0xD1, 0xC1,
+    0xD1, 0xC2, 0xC1, 0xC2, 0xC2, 0xC2, 0xC2, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0x70, /*"7",23*/
+    0x07, 0xC0, 0x60, 0xC3, 0x01, 0x98, 0x03, 0x60, 0x0D, 0x80, 0x36, 0x00, 0xDC, 0x03, 0x38, 0x18,
+    0xF0, 0x61, 0xE2, 0x03, 0xF0, 0x1B, 0xE0, 0xC3, 0xC6, 0x07, 0x98, 0x0E, 0xC0, 0x1F, 0x00, 0x3C,
+    0x00, 0xF0, 0x03, 0xC0, 0x0D, 0x80, 0x26, 0x01, 0x8E, 0x0C, 0x0F, 0xC0, /*"8",24*/
+    0x45, 0x73, 0x42, 0x51, 0x72, 0x32, 0x81, 0x31, 0x92, 0x12, 0xA1, 0x12, 0xA4, 0xA4, 0xA4, 0xA4,
+    0x93, 0x12, 0x83, 0x12, 0x71, 0x12, 0x23, 0x41, 0x22, 0x45, 0x32, 0xC2, 0xB2, 0xC2, 0xC2, 0xC2,
+    0x22, 0x72, 0x32, 0x71, 0x42, 0x62, 0x51, 0x43, 0x75, 0x60, /*"9",25*/
+    0x12, 0x18, 0x12, 0xFF, 0x82, 0x18, 0x12, 0x10, /*":",26*/
+    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x6B, 0x60, /*";",27*/
+    0xC1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xC2, 0xC2, 0xC2,
+    0xC2, 0xC2, 0xC2, 0xC1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, /*"<",28*/
+    0x0F, 0x1F, 0xFF, 0xFF, 0xF6, 0xF1, /*"=",29*/
+    0x01, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xA2, 0xA2, 0xA2,
+    0xA2, 0xA2, 0xA2, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xC0, /*">",30*/
+    0x46, 0x72, 0x52, 0x41, 0x82, 0x21, 0xA1, 0x12, 0xA4, 0xA6, 0x86, 0x82, 0x13, 0x82, 0xB3, 0xA3,
+    0xA3, 0x94, 0xA2, 0xB2, 0xC1, 0xD1, 0xD1, 0xD1, 0xFF, 0xB2, 0xB4, 0xA4, 0xB2, 0x60, /*"?",31*/
+    0x03, 0xE0, 0x0E, 0x18, 0x18, 0x04, 0x10, 0x02, 0x30, 0xFA, 0x61, 0x9A, 0x63, 0x19, 0x43, 0x19,
+    0xC6, 0x11, 0xC6, 0x11, 0xC6, 0x31, 0xCC, 0x31, 0xCC, 0x31, 0xCC, 0x31, 0xCC, 0x31, 0xCC, 0x62,
+    0xCC, 0x62, 0x44, 0xA4, 0x67, 0x38, 0x60, 0x01, 0x20, 0x02, 0x30, 0x06, 0x18, 0x0C, 0x0C, 0x18,
+    0x03, 0xE0, /*"@",32*/
+    0x73, 0xE3, 0xE3, 0xE3, 0xD2, 0x12, 0xC1, 0x22, 0xC1, 0x22, 0xC1, 0x22, 0xB2, 0x32, 0xA1, 0x42,
+    0xA1, 0x42, 0xA1, 0x42, 0x92, 0x43, 0x81, 0x62, 0x81, 0x62, 0x89, 0x72, 0x62, 0x71, 0x73, 0x61,
+    0x82, 0x61, 0x82, 0x52, 0x82, 0x51, 0x93, 0x41, 0xA2, 0x42, 0x92, 0x25, 0x66, /*"A",33*/
+    0x0C, 0x62, 0x64, 0x42, 0x82, 0x42, 0x92, 0x32, 0x92, 0x32, 0x92, 0x32, 0x92, 0x32, 0x92, 0x32,
+    0x82, 0x42, 0x82, 0x42, 0x62, 0x69, 0x72, 0x72, 0x52, 0x82, 0x42, 0x92, 0x32, 0xA1, 0x32, 0xA2,
+    0x22, 0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0x92, 0x32, 0x83, 0x32, 0x73, 0x2C, 0x40, /*"B",34*/
+    0x66, 0x21, 0x61, 0x54, 0x42, 0x82, 0x41, 0xA1, 0x32, 0xA2, 0x12, 0xC1, 0x12, 0xE2, 0xD2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xF0, 0x2C, 0x11, 0x2C, 0x11, 0x2B, 0x13, 0x2A,
+    0x14, 0x28, 0x16, 0x25, 0x29, 0x55, /*"C",35*/
+    0x0A, 0x82, 0x53, 0x62, 0x72, 0x52, 0x82, 0x42, 0x91, 0x42, 0x92, 0x32, 0x92, 0x32, 0xA2, 0x22,
+    0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x22,
+    0xA2, 0x22, 0xA1, 0x32, 0x92, 0x32, 0x92, 0x32, 0x82, 0x42, 0x82, 0x42, 0x72, 0x52, 0x53, 0x4A,
+    0x60, /*"D",36*/
+    0x0F, 0x03, 0x28, 0x33, 0x29, 0x23, 0x2A, 0x22, 0x2B, 0x12, 0x2E, 0x2E, 0x27, 0x16, 0x27, 0x16,
+    0x27, 0x16, 0x26, 0x26, 0xA6, 0x26, 0x26, 0x27, 0x16, 0x27, 0x16, 0x27, 0x16, 0x2E, 0x2E, 0x2E,
+    0x2B, 0x12, 0x2B, 0x12, 0x2A, 0x13, 0x29, 0x23, 0x28, 0x31, 0xF0, 0x10, /*"E",37*/
+    0x0E, 0x42, 0x74, 0x32, 0x92, 0x32, 0xA1, 0x32, 0xB1, 0x22, 0xB1, 0x22, 0xE2, 0xE2, 0x71, 0x62,
+    0x71, 0x62, 0x62, 0x6A, 0x62, 0x62, 0x62, 0x71, 0x62, 0x71, 0x62, 0x71, 0x62, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xC6, 0xA0, /*"F",38*/
+    0x64, 0xA2, 0x43, 0x62, 0x62, 0x52, 0x81, 0x51, 0x92, 0x32, 0xA1, 0x32, 0xA1, 0x31, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x79, 0xA2, 0x22, 0xA2, 0x32, 0x92, 0x32, 0x92, 0x32, 0x92, 0x41,
+    0x92, 0x42, 0x82, 0x52, 0x72, 0x62, 0x51, 0x96, 0x50, /*"G",39*/
+    0x06, 0x46, 0x22, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82,
+    0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x4C, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42,
+    0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x26,
+    0x46, /*"H",40*/
+    0x0C, 0x52, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+    0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x5C, /*"I",41*/
+    0x5C, 0xA2, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
+    0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02,
+    0xF0, 0x2F, 0x02, 0xF0, 0x25, 0x37, 0x25, 0x36, 0x26, 0x36, 0x27, 0x25, 0x1A, 0x69, /*"J",42*/
+    0xFC, 0x7E, 0x30, 0x18, 0x30, 0x10, 0x30, 0x20, 0x30, 0x60, 0x30, 0x40, 0x30, 0x80, 0x31, 0x80,
+    0x31, 0x00, 0x33, 0x00, 0x33, 0x00, 0x37, 0x80, 0x39, 0x80, 0x39, 0xC0, 0x30, 0xC0, 0x30, 0xC0,
+    0x30, 0x60, 0x30, 0x60, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x30, 0x18, 0x30, 0x1C, 0x30, 0x0C,
+    0xFC, 0x3F, /*"K",43*/
+    0x06, 0xC2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xB1, 0x22, 0xB1, 0x22, 0xA1, 0x32, 0x92, 0x32, 0x83, 0x1F, 0x01, /*"L",44*/
+    0xF8, 0x07, 0xCE, 0x01, 0xC3, 0x80, 0x70, 0xE0, 0x1C, 0x38, 0x07, 0x0B, 0x02, 0xC2, 0xC0, 0xB0,
+    0xB0, 0x2C, 0x2C, 0x0B, 0x0B, 0x84, 0xC2, 0x61, 0x30, 0x98, 0x4C, 0x26, 0x13, 0x09, 0x88, 0xC2,
+    0x32, 0x30, 0x8C, 0x8C, 0x23, 0x23, 0x08, 0xD0, 0xC2, 0x3C, 0x30, 0x87, 0x0C, 0x21, 0xC3, 0x08,
+    0x70, 0xC2, 0x18, 0x30, 0x82, 0x0C, 0xF8, 0x8F, 0xC0, /*"M",45*/
+    0xF0, 0x1F, 0x38, 0x04, 0x38, 0x04, 0x2C, 0x04, 0x2C, 0x04, 0x2C, 0x04, 0x26, 0x04, 0x26, 0x04,
+    0x23, 0x04, 0x23, 0x04, 0x21, 0x84, 0x21, 0x84, 0x21, 0xC4, 0x20, 0xC4, 0x20, 0xC4, 0x20, 0x64,
+    0x20, 0x64, 0x20, 0x34, 0x20, 0x34, 0x20, 0x1C, 0x20, 0x1C, 0x20, 0x1C, 0x20, 0x0C, 0x20, 0x0C,
+    0xF8, 0x04, /*"N",46*/
+    0x56, 0x92, 0x42, 0x72, 0x71, 0x52, 0x82, 0x41, 0xA1, 0x32, 0xA2, 0x22, 0xA2, 0x21, 0xC1, 0x12,
+    0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0x11, 0xC1, 0x22, 0xA2, 0x22, 0xA2, 0x31,
+    0xA1, 0x42, 0x82, 0x52, 0x71, 0x72, 0x42, 0xA4, 0x60, /*"O",47*/
+    0x0C, 0x62, 0x73, 0x42, 0x92, 0x32, 0x92, 0x32, 0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x22,
+    0xA2, 0x22, 0x92, 0x32, 0x83, 0x32, 0x73, 0x4A, 0x62, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xC6, 0xA0, /*"P",48*/
+    0x56, 0x92, 0x42, 0x72, 0x71, 0x52, 0x82, 0x41, 0xA1, 0x32, 0xA2, 0x22, 0xA2, 0x12, 0xC4, 0xC4,
+    0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0x11, 0x25, 0x51, 0x24, 0x32, 0x32, 0x23,
+    0x52, 0x22, 0x32, 0x52, 0x21, 0x51, 0x54, 0x72, 0x42, 0xA6, 0xE3, 0x21, 0xB4, 0xC3, 0x20, /*"Q",49*/
+    0x0B, 0x72, 0x63, 0x52, 0x82, 0x42, 0x83, 0x32, 0x92, 0x32, 0x92, 0x32, 0x92, 0x32, 0x92, 0x32,
+    0x82, 0x42, 0x82, 0x42, 0x63, 0x59, 0x72, 0x42, 0x82, 0x42, 0x82, 0x43, 0x72, 0x52, 0x72, 0x52,
+    0x72, 0x53, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x52, 0x72, 0x52, 0x73, 0x42, 0x82, 0x26, 0x64, /*"R",50*/
+    0x45, 0x72, 0x54, 0x22, 0x73, 0x21, 0x92, 0x12, 0xA1, 0x12, 0xA1, 0x12, 0xC2, 0xC3, 0xC4, 0xB4,
+    0xC4, 0xC4, 0xC4, 0xC3, 0xC2, 0xC3, 0xC3, 0xB3, 0xB4, 0xA2, 0x11, 0x92, 0x22, 0x82, 0x24, 0x52,
+    0x31, 0x35, 0x40, /*"S",51*/
+    0x1E, 0x22, 0x42, 0x42, 0x21, 0x52, 0x51, 0x21, 0x52, 0x53, 0x62, 0x62, 0x62, 0x61, 0x72, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xB8, 0x40, /*"T",52*/
+    0xFC, 0x1F, 0x30, 0x04, 0x30, 0x04, 0x30, 0x04, 0x30, 0x04, 0x30, 0x04, 0x30, 0x04, 0x30, 0x04,
+    0x30, 0x04, 0x30, 0x04, 0x30, 0x04, 0x30, 0x04, 0x30, 0x04, 0x30, 0x04, 0x30, 0x04, 0x30, 0x04,
+    0x30, 0x04, 0x30, 0x04, 0x30, 0x04, 0x30, 0x04, 0x30, 0x04, 0x30, 0x08, 0x18, 0x08, 0x0C, 0x30,
+    0x07, 0xC0, /*"U",53*/
+    0x06, 0x55, 0x22, 0x91, 0x42, 0x91, 0x43, 0x72, 0x52, 0x71, 0x62, 0x71, 0x62, 0x71, 0x63, 0x52,
+    0x63, 0x51, 0x82, 0x51, 0x82, 0x51, 0x82, 0x42, 0x83, 0x31, 0xA2, 0x31, 0xA2, 0x31, 0xA2, 0x21,
+    0xB3, 0x11, 0xC2, 0x11, 0xC2, 0x11, 0xC3, 0xD3, 0xD3, 0xE2, 0xE1, 0xF0, 0x18, /*"V",54*/
+    0xF9, 0xF3, 0xDC, 0x30, 0x63, 0x0C, 0x10, 0xC3, 0x04, 0x30, 0xC1, 0x0C, 0x18, 0x43, 0x0E, 0x10,
+    0xC3, 0x88, 0x30, 0xE2, 0x06, 0x38, 0x81, 0x8E, 0x20, 0x65, 0x88, 0x19, 0x32, 0x06, 0x4D, 0x01,
+    0x93, 0x40, 0x64, 0xD0, 0x0E, 0x34, 0x03, 0x8D, 0x00, 0xE3, 0x80, 0x38, 0x60, 0x0E, 0x18, 0x03,
+    0x86, 0x00, 0x41, 0x80, 0x10, 0x60, 0x04, 0x10, 0x00, /*"W",55*/
+    0x06, 0x45, 0x33, 0x72, 0x52, 0x71, 0x62, 0x61, 0x73, 0x51, 0x82, 0x42, 0x83, 0x31, 0xA2, 0x22,
+    0xA3, 0x11, 0xC4, 0xC3, 0xE2, 0xE2, 0xE3, 0xC4, 0xC1, 0x13, 0xA2, 0x22, 0xA1, 0x32, 0x92, 0x42,
+    0x81, 0x52, 0x81, 0x53, 0x61, 0x72, 0x61, 0x73, 0x42, 0x82, 0x25, 0x56, /*"X",56*/
+    0x06, 0x55, 0x13, 0x82, 0x42, 0x82, 0x43, 0x71, 0x62, 0x71, 0x62, 0x61, 0x82, 0x51, 0x82, 0x51,
+    0x83, 0x31, 0xA2, 0x31, 0xA2, 0x22, 0xB2, 0x11, 0xC2, 0x11, 0xC3, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0x40, /*"Y",57*/
+    0x2D, 0x23, 0x72, 0x32, 0x73, 0x22, 0x82, 0x31, 0x83, 0xC2, 0xC3, 0xC2, 0xC3, 0xC2, 0xC3, 0xC2,
+    0xC3, 0xC2, 0xC3, 0xC2, 0xC3, 0xC2, 0xC3, 0xC2, 0x91, 0x23, 0x91, 0x22, 0x91, 0x23, 0x82, 0x22,
+    0x83, 0x1E, 0x10, /*"Z",58*/
+    0x09, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x78, /*"[",59*/
+    0x02, 0xC1, 0xC2, 0xB2, 0xC1, 0xC2, 0xB2, 0xC2, 0xB2, 0xB2, 0xC2, 0xB2, 0xC1, 0xC2, 0xB2, 0xC2,
+    0xB2, 0xB2, 0xC2, 0xB2, 0xC1, 0xC2, 0xB2, 0xC2, 0xB2, 0xB2, 0xC2, 0xB2, 0xB2, 0xC2, /*"\",60*/
+    0x09, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x7B, /*"]",61*/
+    0x1E, 0x1B, 0x18, 0x50, 0x10, /*"^",62*/
+    0x0F, 0x30, /*"_",63*/
+    0xF0, 0x70, 0x30, 0x10, /*"`",64*/
+    0x0F, 0xC0, 0x60, 0xC1, 0x80, 0xC3, 0x01, 0x86, 0x03, 0x00, 0x06, 0x01, 0xFC, 0x0E, 0x18, 0x70,
+    0x30, 0xC0, 0x63, 0x00, 0xC6, 0x01, 0x8C, 0x03, 0x38, 0x0E, 0x58, 0x3C, 0x9F, 0x8E, /*"a",65*/
+    0x31, 0xB4, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0x35, 0x52, 0x12, 0x42, 0x44,
+    0x62, 0x33, 0x72, 0x32, 0x92, 0x22, 0x92, 0x22, 0x92, 0x22, 0x92, 0x22, 0x92, 0x22, 0x92, 0x22,
+    0x92, 0x22, 0x92, 0x22, 0x82, 0x33, 0x72, 0x34, 0x52, 0x41, 0x35, 0x40, /*"b",66*/
+    0x56, 0x63, 0x42, 0x42, 0x72, 0x22, 0x82, 0x22, 0x82, 0x12, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xD1,
+    0xB1, 0x12, 0x91, 0x32, 0x81, 0x42, 0x52, 0x66, 0x40, /*"c",67*/
+    0xC1, 0xB4, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0x65, 0x22, 0x52, 0x44, 0x42, 0x63,
+    0x32, 0x82, 0x32, 0x82, 0x22, 0x92, 0x22, 0x92, 0x22, 0x92, 0x22, 0x92, 0x22, 0x92, 0x22, 0x92,
+    0x22, 0x92, 0x32, 0x73, 0x32, 0x73, 0x42, 0x51, 0x14, 0x45, 0x21, 0x30, /*"d",68*/
+    0x55, 0x72, 0x52, 0x42, 0x72, 0x22, 0x82, 0x21, 0xA4, 0xA4, 0xAF, 0x3C, 0x2C, 0x2D, 0x1B, 0x11,
+    0x2A, 0x12, 0x28, 0x14, 0x25, 0x27, 0x63, /*"e",69*/
+    0x85, 0x82, 0x51, 0x62, 0x62, 0x51, 0x72, 0x42, 0x72, 0x42, 0xD2, 0xD2, 0xD2, 0x9C, 0x72, 0xD2,
+    0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0x9B, 0x40, /*"f",70*/
+    0x45, 0x33, 0x32, 0x34, 0x12, 0x22, 0x52, 0x52, 0x72, 0x42, 0x72, 0x42, 0x72, 0x42, 0x72, 0x52,
+    0x52, 0x72, 0x42, 0x67, 0x72, 0xD2, 0xD7, 0xA9, 0x42, 0x64, 0x22, 0xA2, 0x12, 0xA2, 0x12, 0xA2,
+    0x13, 0x91, 0x33, 0x63, 0x58, 0x40, /*"g",71*/
+    0x31, 0xC4, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x35, 0x62, 0x12, 0x42, 0x53,
+    0x72, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42,
+    0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x26, 0x46, /*"h",72*/
+    0x42, 0x74, 0x64, 0x72, 0xFF, 0xF4, 0x14, 0x68, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x24, 0xA0, /*"i",73*/
+    0x92, 0x94, 0x84, 0x92, 0xFF, 0xFE, 0x16, 0x6A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+    0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x21, 0x27, 0x12, 0x26, 0x22, 0x25, 0x24, 0x65, /*"j",74*/
+    0x31, 0xC4, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x56, 0x32, 0x63, 0x52, 0x61,
+    0x72, 0x52, 0x72, 0x42, 0x82, 0x32, 0x92, 0x23, 0x92, 0x15, 0x84, 0x22, 0x83, 0x33, 0x72, 0x53,
+    0x62, 0x62, 0x62, 0x63, 0x52, 0x73, 0x42, 0x82, 0x26, 0x46, /*"k",75*/
+    0x61, 0x66, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+    0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x5C, /*"l",76*/
+    0x20, 0x00, 0xEF, 0x3C, 0x71, 0xC6, 0x71, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86,
+    0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86,
+    0xF3, 0xCF, /*"m",77*/
+    0x11, 0xF0, 0xF6, 0x18, 0x3C, 0x0C, 0x38, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C,
+    0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0xFC, 0x3F, /*"n",78*/
+    0x46, 0x72, 0x42, 0x52, 0x62, 0x32, 0x82, 0x22, 0x82, 0x12, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA2,
+    0x11, 0xA1, 0x22, 0x82, 0x32, 0x62, 0x52, 0x42, 0x76, 0x40, /*"o",79*/
+    0x13, 0xE1, 0xEC, 0x30, 0xE0, 0x31, 0x80, 0x63, 0x00, 0x66, 0x00, 0xCC, 0x01, 0x98, 0x03, 0x30,
+    0x06, 0x60, 0x0C, 0xC0, 0x19, 0x80, 0x63, 0x00, 0xC7, 0x03, 0x0D, 0x0C, 0x19, 0xF0, 0x30, 0x00,
+    0x60, 0x00, 0xC0, 0x01, 0x80, 0x0F, 0xC0, 0x00, /*"p",80*/
+    0x45, 0x31, 0x52, 0x44, 0x42, 0x63, 0x32, 0x82, 0x32, 0x82, 0x22, 0x92, 0x22, 0x92, 0x22, 0x92,
+    0x22, 0x92, 0x22, 0x92, 0x22, 0x92, 0x22, 0x92, 0x32, 0x82, 0x32, 0x73, 0x42, 0x51, 0x12, 0x65,
+    0x22, 0xD2, 0xD2, 0xD2, 0xD2, 0xB6, /*"q",81*/
+    0x42, 0x44, 0x16, 0x31, 0x32, 0x42, 0x12, 0x42, 0x42, 0x11, 0x52, 0x43, 0xC2, 0xD2, 0xD2, 0xD2,
+    0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0x9A, 0x50, /*"r",82*/
+    0x0F, 0x93, 0x07, 0x60, 0x36, 0x01, 0x60, 0x17, 0x00, 0x3C, 0x01, 0xF0, 0x07, 0xC0, 0x0E, 0x80,
+    0x78, 0x03, 0xC0, 0x3C, 0x03, 0xF0, 0x68, 0xF8, /*"s",83*/
+    0x51, 0xC1, 0xC1, 0xB2, 0xA3, 0x7C, 0x52, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+    0xB2, 0xB2, 0x61, 0x42, 0x51, 0x62, 0x41, 0x75, 0x20, /*"t",84*/
+    0x10, 0x04, 0xF0, 0x3C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C,
+    0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x1C, 0x18, 0x2F,
+    0x0F, 0xC8, /*"u",85*/
+    0x06, 0x45, 0x22, 0x72, 0x42, 0x81, 0x52, 0x61, 0x62, 0x61, 0x62, 0x52, 0x72, 0x41, 0x82, 0x41,
+    0x82, 0x31, 0xA2, 0x21, 0xA2, 0x21, 0xA4, 0xC3, 0xC3, 0xC2, 0xE1, 0x70, /*"v",86*/
+    0xFB, 0xE7, 0xDC, 0x30, 0x43, 0x0C, 0x10, 0xC3, 0x04, 0x30, 0xE2, 0x04, 0x38, 0x81, 0x8E, 0x20,
+    0x65, 0x98, 0x19, 0x34, 0x03, 0x4D, 0x00, 0xF3, 0x40, 0x38, 0xE0, 0x0E, 0x18, 0x01, 0x86, 0x00,
+    0x61, 0x80, 0x10, 0x40, /*"w",87*/
+    0x16, 0x25, 0x43, 0x51, 0x72, 0x41, 0x82, 0x41, 0x92, 0x21, 0xA5, 0xB3, 0xD2, 0xC3, 0xC1, 0x12,
+    0xA1, 0x32, 0x82, 0x32, 0x81, 0x52, 0x61, 0x62, 0x52, 0x72, 0x25, 0x46, /*"x",88*/
+    0x06, 0x36, 0x22, 0x72, 0x42, 0x71, 0x62, 0x61, 0x62, 0x52, 0x71, 0x51, 0x82, 0x41, 0x82, 0x32,
+    0x92, 0x21, 0xA2, 0x21, 0xA2, 0x12, 0xB3, 0xC3, 0xD2, 0xD1, 0xE1, 0xD1, 0xE1, 0x92, 0x22, 0x95,
+    0xA4, 0xA0, /*"y",89*/
+    0x7F, 0xF7, 0x03, 0xB0, 0x39, 0x01, 0x88, 0x1C, 0x01, 0xC0, 0x0C, 0x00, 0xE0, 0x0E, 0x00, 0x60,
+    0x06, 0x02, 0x70, 0x13, 0x01, 0xB0, 0x0B, 0x80, 0xDF, 0xFE, /*"z",90*/
+    0x06, 0x10, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x30, 0x80, 0xC0,
+    0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x02, 0x03, /*"{",91*/
+    0x0F, 0xF6, /*"|",92*/
+    0xC0, 0x40, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x04, 0x06, 0x10,
+    0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x08, 0x60, /*"}",93*/
+    0x3C, 0x00, 0x46, 0x00, 0x43, 0x01, 0x81, 0x81, 0x80, 0xC2, 0x00, 0x62, 0x00, 0x3C, /*"~",94*/
+};
 
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x23, 0x00, 0x00, 0x21, 0x80, 0x80, 0x40, 0xC0, 0x80, 0x40,
-    0x61, 0x00, 0x00, 0x31, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"~",94*/
+static const esp_painter_glyph_t glyphs[] = {
+    {0x0000, 0, 0, 0, 0}, /*" ",0*/
+    {0x0000, 7, 6, 4, 25}, /*"!",1*/
+    {0x000D, 3, 2, 13, 9}, /*""",2*/
+    {0x801C, 1, 6, 16, 25}, /*"#",3*/
+    {0x0048, 2, 3, 13, 32}, /*"$",4*/
+    {0x007C, 0, 6, 17, 25}, /*"%",5*/
+    {0x00B2, 0, 6, 17, 25}, /*"&",6*/
+    {0x00E8, 2, 2, 5, 9}, /*"'",7*/
+    {0x80EE, 8, 2, 9, 32}, /*"(",8*/
+    {0x810E, 1, 2, 9, 32}, /*")",9*/
+    {0x812F, 1, 9, 15, 18}, /*"*",10*/
+    {0x8150, 2, 9, 15, 17}, /*"+",11*/
+    {0x0162, 2, 26, 5, 9}, /*",",12*/
+    {0x0168, 1, 17, 16, 1}, /*"-",13*/
+    {0x016A, 2, 27, 4, 4}, /*".",14*/
+    {0x816C, 1, 3, 16, 31}, /*"/",15*/
+    {0x818D, 2, 6, 14, 25}, /*"0",16*/
+    {0x81B4, 4, 6, 10, 25}, /*"1",17*/
+    {0x81CD, 2, 6, 14, 25}, /*"2",18*/
+    {0x81ED, 2, 6, 14, 25}, /*"3",19*/
+    {0x8210, 1, 6, 16, 25}, /*"4",20*/
+    {0x8237, 2, 6, 14, 25}, /*"5",21*/
+    {0x825A, 2, 6, 14, 25}, /*"6",22*/
+    {0x8284, 2, 6, 14, 25}, /*"7",23*/
+    {0x02A2, 2, 6, 14, 25}, /*"8",24*/
+    {0x82CE, 2, 6, 14, 25}, /*"9",25*/
+    {0x82F8, 7, 14, 4, 17}, /*":",26*/
+    {0x0300, 7, 15, 3, 20}, /*";",27*/
+    {0x8308, 2, 6, 13, 25}, /*"<",28*/
+    {0x8321, 1, 14, 16, 8}, /*"=",29*/
+    {0x8327, 3, 6, 13, 25}, /*">",30*/
+    {0x8341, 2, 6, 14, 25}, /*"?",31*/
+    {0x035F, 1, 6, 16, 25}, /*"@",32*/
+    {0x8391, 0, 6, 17, 25}, /*"A",33*/
+    {0x83BE, 1, 6, 16, 25}, /*"B",34*/
+    {0x83EE, 1, 6, 16, 25}, /*"C",35*/
+    {0x8414, 1, 6, 16, 25}, /*"D",36*/
+    {0x8445, 1, 6, 16, 25}, /*"E",37*/
+    {0x8471, 1, 6, 16, 25}, /*"F",38*/
+    {0x8497, 1, 6, 16, 25}, /*"G",39*/
+    {0x84C0, 1, 6, 16, 25}, /*"H",40*/
+    {0x84F1, 3, 6, 12, 25}, /*"I",41*/
+    {0x850A, 1, 6, 17, 30}, /*"J",42*/
+    {0x0538, 1, 6, 16, 25}, /*"K",43*/
+    {0x856A, 1, 6, 16, 25}, /*"L",44*/
+    {0x0589, 0, 6, 18, 25}, /*"M",45*/
+    {0x05C2, 1, 6, 16, 25}, /*"N",46*/
+    {0x85F4, 1, 6, 16, 25}, /*"O",47*/
+    {0x861D, 1, 6, 16, 25}, /*"P",48*/
+    {0x8642, 1, 6, 16, 28}, /*"Q",49*/
+    {0x8671, 1, 6, 16, 25}, /*"R",50*/
+    {0x86A1, 2, 6, 14, 25}, /*"S",51*/
+    {0x86C4, 1, 6, 16, 25}, /*"T",52*/
+    {0x06E6, 1, 6, 16, 25}, /*"U",53*/
+    {0x8718, 1, 6, 16, 25}, /*"V",54*/
+    {0x0745, 0, 6, 18, 25}, /*"W",55*/
+    {0x877E, 1, 6, 16, 25}, /*"X",56*/
+    {0x87AA, 1, 6, 16, 25}, /*"Y",57*/
+    {0x87D1, 1, 6, 15, 25}, /*"Z",58*/
+    {0x87F4, 7, 2, 8, 32}, /*"[",59*/
+    {0x8813, 3, 5, 13, 30}, /*"\",60*/
+    {0x8831, 2, 2, 9, 32}, /*"]",61*/
+    {0x0850, 4, 2, 9, 4}, /*"^",62*/
+    {0x8855, 0, 35, 18, 1}, /*"_",63*/
+    {0x0857, 3, 2, 7, 4}, /*"`",64*/
+    {0x085B, 2, 15, 15, 16}, /*"a",65*/
+    {0x8879, 1, 5, 15, 26}, /*"b",66*/
+    {0x88A5, 2, 15, 14, 16}, /*"c",67*/
+    {0x88BE, 2, 5, 15, 26}, /*"d",68*/
+    {0x88EA, 2, 15, 14, 16}, /*"e",69*/
+    {0x8901, 2, 6, 15, 25}, /*"f",70*/
+    {0x891F, 2, 15, 15, 21}, /*"g",71*/
+    {0x8945, 1, 5, 16, 26}, /*"h",72*/
+    {0x8970, 4, 6, 10, 25}, /*"i",73*/
+    {0x8987, 3, 6, 12, 30}, /*"j",74*/
+    {0x89A6, 1, 5, 16, 26}, /*"k",75*/
+    {0x89D0, 3, 5, 12, 26}, /*"l",76*/
+    {0x09EA, 1, 14, 16, 17}, /*"m",77*/
+    {0x0A0C, 1, 15, 16, 16}, /*"n",78*/
+    {0x8A2C, 2, 15, 14, 16}, /*"o",79*/
+    {0x0A46, 1, 15, 15, 21}, /*"p",80*/
+    {0x8A6E, 2, 15, 15, 21}, /*"q",81*/
+    {0x8A94, 1, 15, 15, 16}, /*"r",82*/
+    {0x0AAC, 3, 15, 12, 16}, /*"s",83*/
+    {0x8AC4, 2, 10, 13, 21}, /*"t",84*/
+    {0x0ADD, 1, 14, 16, 17}, /*"u",85*/
+    {0x8AFF, 1, 15, 15, 16}, /*"v",86*/
+    {0x0B1B, 0, 15, 18, 16}, /*"w",87*/
+    {0x8B3F, 1, 15, 15, 16}, /*"x",88*/
+    {0x8B5B, 2, 15, 15, 21}, /*"y",89*/
+    {0x0B7D, 2, 15, 13, 16}, /*"z",90*/
+    {0x0B97, 8, 2, 7, 32}, /*"{",91*/
+    {0x8BB3, 8, 0, 1, 36}, /*"|",92*/
+    {0x0BB5, 3, 2, 7, 32}, /*"}",93*/
+    {0x0BD1, 1, 1, 16, 7}, /*"~",94*/
 };
 
 const esp_painter_basic_font_t esp_painter_basic_font_36 = {
     .bitmap = bitmap,
+    .glyphs = glyphs,
     .width = 18,
     .height = 36,
+    .first = 0x20,
+    .count = 95,
 };
 
 #endif
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: CC0-1.0
  */
 
+/* Packed by tools/pack_font.py: 20x40 cells, 4107 bytes (1-bit bitmap: 11400) */
+
 #include "sdkconfig.h"
 
 #include "esp_painter_font.h"
@@ -11,866 +13,381 @@
 #if CONFIG_ESP_PAINTER_BASIC_FONT_40
 
 static const uint8_t bitmap[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*" ",0*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"!",1*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x01, 0xE7, 0x80, 0x01, 0xE7, 0x80, 0x03,
-    0xCF, 0x00, 0x03, 0x8E, 0x00, 0x07, 0x1C, 0x00, 0x06, 0x18, 0x00, 0x0C, 0x30, 0x00, 0x18, 0x60,
-    0x00, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*""",2*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x02, 0x02,
-    0x00, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0,
-    0x06, 0x06, 0x00, 0x06, 0x06, 0x00, 0x06, 0x06, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04,
-    0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF,
-    0xC0, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00,
-    0x0C, 0x0C, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"#",3*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x22, 0x00, 0x06, 0x21, 0x00, 0x04, 0x21,
-    0x80, 0x0C, 0x21, 0x80, 0x0C, 0x23, 0x80, 0x0C, 0x23, 0x80, 0x0E, 0x20, 0x00, 0x07, 0x20, 0x00,
-    0x07, 0xA0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x27, 0x00, 0x00, 0x23, 0x80, 0x00, 0x23, 0x80, 0x0C, 0x21,
-    0x80, 0x1C, 0x21, 0x80, 0x1C, 0x21, 0x80, 0x18, 0x21, 0x80, 0x18, 0x21, 0x00, 0x08, 0x23, 0x00,
-    0x06, 0x24, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"$",4*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x01, 0x00, 0x66, 0x03, 0x00, 0x62, 0x02, 0x00, 0x42, 0x06, 0x00, 0xC3, 0x04,
-    0x00, 0xC3, 0x0C, 0x00, 0xC3, 0x08, 0x00, 0xC3, 0x08, 0x00, 0xC3, 0x18, 0x00, 0xC3, 0x10, 0x00,
-    0xC3, 0x30, 0x00, 0xC3, 0x20, 0x00, 0x66, 0x60, 0x00, 0x66, 0x47, 0x80, 0x3C, 0x44, 0xC0, 0x00,
-    0x8C, 0xC0, 0x00, 0x88, 0x40, 0x01, 0x98, 0x60, 0x01, 0x18, 0x60, 0x03, 0x18, 0x60, 0x02, 0x18,
-    0x60, 0x02, 0x18, 0x60, 0x04, 0x18, 0x60, 0x04, 0x18, 0x60, 0x0C, 0x08, 0x60, 0x08, 0x08, 0x40,
-    0x18, 0x04, 0xC0, 0x10, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"%",5*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x04, 0x60, 0x00, 0x08, 0x30, 0x00, 0x18, 0x30, 0x00, 0x18, 0x30,
-    0x00, 0x18, 0x30, 0x00, 0x18, 0x30, 0x00, 0x18, 0x30, 0x00, 0x18, 0x60, 0x00, 0x1C, 0x60, 0x00,
-    0x0C, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x0E, 0x1F, 0xC0, 0x1E, 0x07, 0x00, 0x36, 0x06, 0x00, 0x27,
-    0x06, 0x00, 0x67, 0x06, 0x00, 0x43, 0x84, 0x00, 0xC3, 0x84, 0x00, 0xC1, 0xC4, 0x00, 0xC1, 0xCC,
-    0x00, 0xC0, 0xE8, 0x00, 0xC0, 0x78, 0x00, 0xC0, 0x70, 0x00, 0x60, 0x38, 0x20, 0x60, 0x3C, 0x60,
-    0x38, 0x4F, 0xC0, 0x0F, 0x87, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"&",6*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"'",7*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x00,
-    0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"(",8*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
-    0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*")",9*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x70, 0xE1, 0xC0, 0x78, 0x43, 0xC0, 0x7C, 0x47, 0xC0,
-    0x1E, 0x4F, 0x00, 0x07, 0x5C, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x5C, 0x00, 0x1E,
-    0x4F, 0x00, 0x7C, 0x47, 0xC0, 0x78, 0x43, 0xC0, 0x70, 0xE1, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"*",10*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x20, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"+",11*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, /*",",12*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"-",13*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*".",14*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x80, 0x00, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x30, 0x00, 0x00, 0x20, 0x00, 0x00, 0x60, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"/",15*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x0C, 0x00, 0x06, 0x06, 0x00, 0x0C, 0x03,
-    0x00, 0x0C, 0x01, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x30, 0x00, 0xC0,
-    0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30,
-    0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x18, 0x01,
-    0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x0C, 0x01, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x06, 0x00,
-    0x03, 0x0C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"0",16*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x60, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"1",17*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x06, 0x0E, 0x00, 0x1C, 0x03, 0x00, 0x18, 0x03,
-    0x00, 0x38, 0x01, 0x80, 0x38, 0x01, 0x80, 0x3C, 0x01, 0x80, 0x3C, 0x01, 0x80, 0x1C, 0x01, 0x80,
-    0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x80, 0x0C, 0x00, 0x80, 0x18, 0x01, 0x80, 0x30, 0x03, 0x00,
-    0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"2",18*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0C, 0x1C, 0x00, 0x18, 0x06, 0x00, 0x30, 0x06,
-    0x00, 0x38, 0x03, 0x00, 0x38, 0x03, 0x00, 0x38, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
-    0x80, 0x18, 0x01, 0x80, 0x3C, 0x01, 0x80, 0x3C, 0x01, 0x00, 0x38, 0x03, 0x00, 0x1C, 0x06, 0x00,
-    0x0E, 0x0C, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"3",19*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x8C, 0x00, 0x01, 0x8C, 0x00,
-    0x01, 0x0C, 0x00, 0x02, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x04, 0x0C, 0x00, 0x08, 0x0C, 0x00, 0x18,
-    0x0C, 0x00, 0x10, 0x0C, 0x00, 0x20, 0x0C, 0x00, 0x60, 0x0C, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0C,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"4",20*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x08, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x11, 0xF8, 0x00, 0x16, 0x0C, 0x00, 0x1C, 0x06, 0x00, 0x18, 0x03, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x1C, 0x01,
-    0x80, 0x3C, 0x01, 0x80, 0x3C, 0x01, 0x80, 0x38, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x06, 0x00,
-    0x0E, 0x0C, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"5",21*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0x83, 0x00, 0x02, 0x03, 0x80, 0x04, 0x03,
-    0x80, 0x08, 0x03, 0x80, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0x30, 0xFC, 0x00, 0x33, 0x06, 0x00, 0x34, 0x03, 0x00, 0x3C, 0x01, 0x80, 0x38,
-    0x01, 0x80, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00,
-    0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x06, 0x03, 0x00,
-    0x03, 0x06, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"6",22*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x0C, 0x00, 0x80, 0x18, 0x01,
-    0x80, 0x10, 0x03, 0x00, 0x10, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0,
-    0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"7",23*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x07, 0x07, 0x00, 0x0C, 0x01, 0x80, 0x0C, 0x01,
-    0x80, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x1C, 0x00, 0xC0,
-    0x0E, 0x01, 0x80, 0x0F, 0x83, 0x00, 0x07, 0xE6, 0x00, 0x01, 0xF8, 0x00, 0x03, 0x7C, 0x00, 0x06,
-    0x1E, 0x00, 0x0C, 0x07, 0x00, 0x18, 0x03, 0x80, 0x38, 0x01, 0xC0, 0x30, 0x01, 0xC0, 0x30, 0x00,
-    0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x0C, 0x01, 0x00,
-    0x06, 0x06, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"8",24*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x06, 0x04, 0x00, 0x0C, 0x02, 0x00, 0x18, 0x01,
-    0x00, 0x18, 0x01, 0x80, 0x30, 0x00, 0x80, 0x30, 0x00, 0x80, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0,
-    0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x18, 0x01, 0xC0, 0x18, 0x03, 0xC0, 0x0C,
-    0x06, 0xC0, 0x06, 0x0C, 0xC0, 0x03, 0xF0, 0xC0, 0x00, 0x00, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
-    0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x1C, 0x03, 0x00, 0x1C, 0x06, 0x00, 0x1C, 0x0C, 0x00,
-    0x0C, 0x18, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"9",25*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*":",26*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*";",27*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x00,
-    0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"<",28*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"=",29*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00,
-    0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*">",30*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x06, 0x00, 0x06, 0x01, 0x00, 0x0C, 0x01, 0x80, 0x08, 0x00,
-    0xC0, 0x18, 0x00, 0xC0, 0x1C, 0x00, 0xC0, 0x1E, 0x00, 0xC0, 0x1E, 0x00, 0xC0, 0x0E, 0x00, 0xC0,
-    0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"?",31*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0x83, 0x00, 0x03, 0x01, 0x80, 0x06, 0x00, 0x80, 0x0C, 0x00,
-    0x40, 0x08, 0x1F, 0x40, 0x18, 0x67, 0x20, 0x18, 0x63, 0x20, 0x10, 0xC3, 0x20, 0x30, 0x86, 0x20,
-    0x31, 0x86, 0x20, 0x31, 0x86, 0x20, 0x33, 0x06, 0x20, 0x33, 0x06, 0x20, 0x33, 0x06, 0x20, 0x33,
-    0x0E, 0x20, 0x33, 0x0C, 0x40, 0x33, 0x0C, 0x40, 0x33, 0x1C, 0x40, 0x11, 0x14, 0x80, 0x18, 0xE7,
-    0x00, 0x18, 0x00, 0x20, 0x08, 0x00, 0x40, 0x0C, 0x00, 0x40, 0x04, 0x00, 0x80, 0x02, 0x01, 0x00,
-    0x01, 0x86, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"@",32*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xF0,
-    0x00, 0x01, 0x30, 0x00, 0x01, 0x30, 0x00, 0x01, 0x30, 0x00, 0x03, 0x38, 0x00, 0x03, 0x38, 0x00,
-    0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x06, 0x18, 0x00, 0x06, 0x1C, 0x00, 0x04, 0x0C, 0x00, 0x04,
-    0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0F, 0xFE, 0x00, 0x08, 0x06, 0x00, 0x08, 0x06, 0x00, 0x18, 0x06,
-    0x00, 0x10, 0x07, 0x00, 0x10, 0x07, 0x00, 0x10, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x80,
-    0x30, 0x03, 0x80, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"A",33*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x18, 0x07, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01,
-    0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0,
-    0x18, 0x01, 0x80, 0x18, 0x03, 0x00, 0x18, 0x0E, 0x00, 0x1F, 0xF8, 0x00, 0x18, 0x06, 0x00, 0x18,
-    0x01, 0x80, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00,
-    0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0xE0, 0x18, 0x00, 0xC0, 0x18, 0x01, 0x80,
-    0x18, 0x07, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"B",34*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x40, 0x03, 0x03, 0xC0, 0x06, 0x01, 0xC0, 0x0C, 0x00,
-    0xC0, 0x18, 0x00, 0x40, 0x18, 0x00, 0x60, 0x30, 0x00, 0x20, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x30, 0x00, 0x20, 0x30, 0x00, 0x40, 0x18, 0x00, 0x40, 0x18, 0x00, 0x80, 0x0C, 0x01, 0x00,
-    0x03, 0x06, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"C",35*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x06, 0x00, 0x18, 0x03,
-    0x00, 0x18, 0x01, 0x80, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0x60,
-    0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18,
-    0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x40, 0x18, 0x00,
-    0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0x80, 0x18, 0x01, 0x80, 0x18, 0x03, 0x00, 0x18, 0x06, 0x00,
-    0x18, 0x1C, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"D",36*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x18, 0x03, 0xC0, 0x18, 0x01, 0xC0, 0x18, 0x00,
-    0xC0, 0x18, 0x00, 0x60, 0x18, 0x00, 0x20, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x04, 0x00,
-    0x18, 0x04, 0x00, 0x18, 0x04, 0x00, 0x18, 0x0C, 0x00, 0x1F, 0xFC, 0x00, 0x18, 0x0C, 0x00, 0x18,
-    0x04, 0x00, 0x18, 0x04, 0x00, 0x18, 0x04, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x20, 0x18, 0x00, 0x60, 0x18, 0x00, 0x40, 0x18, 0x00, 0xC0,
-    0x18, 0x03, 0xC0, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"E",37*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x18, 0x03, 0xC0, 0x18, 0x01, 0xC0, 0x18, 0x00,
-    0xC0, 0x18, 0x00, 0x60, 0x18, 0x00, 0x20, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x02, 0x00,
-    0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x06, 0x00, 0x1F, 0xFE, 0x00, 0x18, 0x06, 0x00, 0x18,
-    0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"F",38*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x03, 0x0F, 0x00, 0x04, 0x03, 0x00, 0x0C, 0x03,
-    0x00, 0x18, 0x01, 0x80, 0x10, 0x00, 0x80, 0x30, 0x00, 0x80, 0x30, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x0F, 0xF0, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01,
-    0x80, 0x30, 0x01, 0x80, 0x10, 0x01, 0x80, 0x18, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80,
-    0x07, 0x06, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"G",39*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
-    0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
-    0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18,
-    0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
-    0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
-    0x18, 0x01, 0x80, 0x7E, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"H",40*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"I",41*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x70, 0x0C, 0x00, 0x70, 0x18, 0x00, 0x70, 0x10, 0x00, 0x30,
-    0x60, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, /*"J",42*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0xC0, 0x18, 0x07, 0x00, 0x18, 0x06, 0x00, 0x18, 0x04,
-    0x00, 0x18, 0x08, 0x00, 0x18, 0x18, 0x00, 0x18, 0x30, 0x00, 0x18, 0x20, 0x00, 0x18, 0x40, 0x00,
-    0x18, 0xC0, 0x00, 0x18, 0xC0, 0x00, 0x19, 0xC0, 0x00, 0x1A, 0xE0, 0x00, 0x1E, 0xE0, 0x00, 0x1C,
-    0x70, 0x00, 0x18, 0x70, 0x00, 0x18, 0x38, 0x00, 0x18, 0x38, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x1C,
-    0x00, 0x18, 0x0E, 0x00, 0x18, 0x0E, 0x00, 0x18, 0x06, 0x00, 0x18, 0x07, 0x00, 0x18, 0x03, 0x00,
-    0x18, 0x03, 0x80, 0x7E, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"K",43*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x20, 0x0C, 0x00, 0x20, 0x0C, 0x00, 0x40, 0x0C, 0x00, 0xC0,
-    0x0C, 0x01, 0xC0, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"L",44*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03,
-    0x80, 0x3C, 0x07, 0x80, 0x2C, 0x05, 0x80, 0x2C, 0x05, 0x80, 0x2C, 0x05, 0x80, 0x2C, 0x05, 0x80,
-    0x26, 0x09, 0x80, 0x26, 0x09, 0x80, 0x26, 0x09, 0x80, 0x26, 0x09, 0x80, 0x27, 0x11, 0x80, 0x23,
-    0x11, 0x80, 0x23, 0x11, 0x80, 0x23, 0x11, 0x80, 0x23, 0x21, 0x80, 0x23, 0xA1, 0x80, 0x21, 0xA1,
-    0x80, 0x21, 0xA1, 0x80, 0x21, 0xE1, 0x80, 0x21, 0xC1, 0x80, 0x20, 0xC1, 0x80, 0x20, 0xC1, 0x80,
-    0x20, 0xC1, 0x80, 0xF8, 0x87, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"M",45*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x07, 0xF0, 0x1C, 0x00, 0x80, 0x1C, 0x00, 0x80, 0x16, 0x00,
-    0x80, 0x16, 0x00, 0x80, 0x13, 0x00, 0x80, 0x13, 0x00, 0x80, 0x11, 0x80, 0x80, 0x11, 0x80, 0x80,
-    0x10, 0xC0, 0x80, 0x10, 0xC0, 0x80, 0x10, 0x60, 0x80, 0x10, 0x60, 0x80, 0x10, 0x30, 0x80, 0x10,
-    0x30, 0x80, 0x10, 0x38, 0x80, 0x10, 0x18, 0x80, 0x10, 0x1C, 0x80, 0x10, 0x0C, 0x80, 0x10, 0x0E,
-    0x80, 0x10, 0x06, 0x80, 0x10, 0x07, 0x80, 0x10, 0x03, 0x80, 0x10, 0x03, 0x80, 0x10, 0x01, 0x80,
-    0x10, 0x01, 0x80, 0xFE, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"N",46*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x03, 0x04, 0x00, 0x0C, 0x03, 0x00, 0x08, 0x01,
-    0x00, 0x18, 0x01, 0x80, 0x30, 0x00, 0x80, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x20, 0x00, 0x40,
-    0x60, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60,
-    0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0x60, 0x20, 0x00, 0x40, 0x30, 0x00,
-    0xC0, 0x30, 0x00, 0xC0, 0x10, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x08, 0x01, 0x00, 0x04, 0x03, 0x00,
-    0x03, 0x0C, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"O",47*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x18, 0x06, 0x00, 0x18, 0x03, 0x00, 0x18, 0x01,
-    0x80, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0,
-    0x18, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x18, 0x03, 0x00, 0x18, 0x0E, 0x00, 0x1F, 0xF8, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"P",48*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x07, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x08, 0x01,
-    0x00, 0x18, 0x00, 0x80, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x60, 0x00, 0x60,
-    0x60, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60,
-    0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0x60, 0x23, 0xE0,
-    0x40, 0x37, 0xF0, 0xC0, 0x3E, 0x38, 0xC0, 0x1C, 0x1C, 0x80, 0x18, 0x1D, 0x80, 0x0C, 0x1F, 0x00,
-    0x06, 0x0E, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"Q",49*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0C, 0x0E, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03,
-    0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80,
-    0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x0E, 0x00, 0x0F, 0xF8, 0x00, 0x0C, 0x30, 0x00, 0x0C,
-    0x30, 0x00, 0x0C, 0x38, 0x00, 0x0C, 0x18, 0x00, 0x0C, 0x1C, 0x00, 0x0C, 0x1C, 0x00, 0x0C, 0x0C,
-    0x00, 0x0C, 0x0E, 0x00, 0x0C, 0x06, 0x00, 0x0C, 0x07, 0x00, 0x0C, 0x07, 0x00, 0x0C, 0x03, 0x00,
-    0x0C, 0x03, 0x80, 0x3F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"R",50*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x06, 0x0F, 0x00, 0x08, 0x03, 0x80, 0x18, 0x03,
-    0x80, 0x30, 0x01, 0x80, 0x30, 0x00, 0x80, 0x30, 0x00, 0x80, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xC0, 0x20, 0x00,
-    0xC0, 0x20, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x10, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x1C, 0x01, 0x00,
-    0x1F, 0x06, 0x00, 0x10, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"S",51*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x38, 0x60, 0xC0, 0x30, 0x60, 0x40, 0x20, 0x60,
-    0x40, 0x60, 0x60, 0x20, 0x40, 0x60, 0x20, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"T",52*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xE0, 0x18, 0x00, 0x80, 0x18, 0x00, 0x80, 0x18, 0x00,
-    0x80, 0x18, 0x00, 0x80, 0x18, 0x00, 0x80, 0x18, 0x00, 0x80, 0x18, 0x00, 0x80, 0x18, 0x00, 0x80,
-    0x18, 0x00, 0x80, 0x18, 0x00, 0x80, 0x18, 0x00, 0x80, 0x18, 0x00, 0x80, 0x18, 0x00, 0x80, 0x18,
-    0x00, 0x80, 0x18, 0x00, 0x80, 0x18, 0x00, 0x80, 0x18, 0x00, 0x80, 0x18, 0x00, 0x80, 0x18, 0x00,
-    0x80, 0x18, 0x00, 0x80, 0x18, 0x00, 0x80, 0x18, 0x00, 0x80, 0x08, 0x01, 0x00, 0x0C, 0x03, 0x00,
-    0x06, 0x06, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"U",53*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xE0, 0x1C, 0x01, 0x80, 0x1C, 0x01, 0x80, 0x0C, 0x01,
-    0x00, 0x0C, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x03, 0x00, 0x0E, 0x02, 0x00, 0x06, 0x02, 0x00,
-    0x07, 0x02, 0x00, 0x07, 0x04, 0x00, 0x07, 0x04, 0x00, 0x03, 0x04, 0x00, 0x03, 0x04, 0x00, 0x03,
-    0x88, 0x00, 0x03, 0x88, 0x00, 0x01, 0x88, 0x00, 0x01, 0x98, 0x00, 0x01, 0xD0, 0x00, 0x01, 0xD0,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"V",54*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xF9, 0xF0, 0x70, 0x60, 0x40, 0x30, 0x60, 0x40, 0x30, 0x60,
-    0x40, 0x30, 0x70, 0x40, 0x30, 0x70, 0xC0, 0x38, 0x30, 0x80, 0x38, 0x70, 0x80, 0x18, 0x70, 0x80,
-    0x18, 0x70, 0x80, 0x18, 0x70, 0x80, 0x18, 0xF9, 0x00, 0x18, 0xB9, 0x00, 0x1C, 0x99, 0x00, 0x0C,
-    0x99, 0x00, 0x0C, 0x99, 0x00, 0x0D, 0x9B, 0x00, 0x0D, 0x1A, 0x00, 0x0D, 0x1E, 0x00, 0x0D, 0x0E,
-    0x00, 0x0F, 0x0E, 0x00, 0x07, 0x0E, 0x00, 0x06, 0x0E, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00,
-    0x06, 0x04, 0x00, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"W",55*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x1C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0E, 0x02,
-    0x00, 0x06, 0x06, 0x00, 0x07, 0x04, 0x00, 0x03, 0x0C, 0x00, 0x03, 0x88, 0x00, 0x01, 0x98, 0x00,
-    0x01, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x01, 0x98, 0x00, 0x01, 0x1C, 0x00, 0x03, 0x0C,
-    0x00, 0x02, 0x0E, 0x00, 0x06, 0x0E, 0x00, 0x04, 0x07, 0x00, 0x0C, 0x07, 0x00, 0x08, 0x03, 0x00,
-    0x18, 0x03, 0x80, 0x7E, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"X",56*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xE0, 0x1C, 0x01, 0x80, 0x1C, 0x01, 0x00, 0x0C, 0x01,
-    0x00, 0x0E, 0x03, 0x00, 0x0E, 0x02, 0x00, 0x06, 0x06, 0x00, 0x07, 0x04, 0x00, 0x03, 0x04, 0x00,
-    0x03, 0x08, 0x00, 0x01, 0x88, 0x00, 0x01, 0x98, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"Y",57*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x1E, 0x01, 0x80, 0x18, 0x03, 0x80, 0x18, 0x03,
-    0x00, 0x30, 0x07, 0x00, 0x20, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x40, 0x1C, 0x00, 0xC0, 0x18, 0x00, 0x80, 0x38, 0x01, 0x80,
-    0x30, 0x07, 0x80, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"Z",58*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"[",59*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"\",60*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"]",61*/
-
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x01, 0x9C, 0x00, 0x03, 0x0C, 0x00, 0x04,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"^",62*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, /*"_",63*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"`",64*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x0C, 0x06, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0xFB, 0x00, 0x07, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x18, 0x03,
-    0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x20, 0x18, 0x07, 0x20,
-    0x1C, 0x1B, 0x20, 0x07, 0xE1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"a",65*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x18, 0x7C, 0x00, 0x19, 0x87, 0x00, 0x1A, 0x01, 0x00, 0x1C, 0x01, 0x80, 0x1C, 0x01, 0x80, 0x18,
-    0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00,
-    0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1C, 0x03, 0x00,
-    0x1E, 0x06, 0x00, 0x11, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"b",66*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x03, 0x06, 0x00, 0x0E, 0x02, 0x00, 0x0C, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18,
-    0x03, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x80, 0x18, 0x00, 0x80, 0x18, 0x01, 0x00, 0x0C, 0x03, 0x00,
-    0x06, 0x06, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"c",67*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
-    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80,
-    0x01, 0xF9, 0x80, 0x06, 0x0D, 0x80, 0x0C, 0x03, 0x80, 0x08, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
-    0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01,
-    0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x03, 0x80, 0x0C, 0x07, 0x80,
-    0x06, 0x0D, 0xE0, 0x01, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"d",68*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x03, 0x06, 0x00, 0x06, 0x03, 0x00, 0x04, 0x01, 0x80, 0x0C, 0x00, 0x80, 0x08,
-    0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x1F, 0xFF, 0xC0, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x40, 0x0C, 0x00, 0x80, 0x06, 0x01, 0x80,
-    0x03, 0x83, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"e",69*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x70, 0x40, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x01, 0x80,
-    0x60, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
-    0x3F, 0xFF, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
-    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80,
-    0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
-    0x01, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"f",70*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0xE0, 0x06, 0x0F, 0xE0, 0x0C, 0x06, 0x60, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18,
-    0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x0C, 0x06, 0x00, 0x06, 0x0C, 0x00, 0x0D, 0xF8,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x0C, 0x7F, 0x80,
-    0x18, 0x01, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x0E,
-    0x03, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, /*"g",71*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x18, 0x7C, 0x00, 0x19, 0x87, 0x00, 0x1E, 0x03, 0x00, 0x1C, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
-    0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
-    0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
-    0x18, 0x01, 0x80, 0x7E, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"h",72*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"i",73*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x1C,
-    0x30, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, /*"j",74*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,
-    0x0C, 0x1F, 0xC0, 0x0C, 0x06, 0x00, 0x0C, 0x04, 0x00, 0x0C, 0x08, 0x00, 0x0C, 0x18, 0x00, 0x0C,
-    0x30, 0x00, 0x0C, 0x60, 0x00, 0x0C, 0xE0, 0x00, 0x0D, 0xB0, 0x00, 0x0F, 0x38, 0x00, 0x0E, 0x18,
-    0x00, 0x0C, 0x1C, 0x00, 0x0C, 0x0E, 0x00, 0x0C, 0x06, 0x00, 0x0C, 0x07, 0x00, 0x0C, 0x03, 0x00,
-    0x0C, 0x03, 0x80, 0x3F, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"k",75*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"l",76*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x73, 0xC7, 0x80, 0x3C, 0x78, 0xC0, 0x38, 0x70, 0xC0, 0x30, 0x60, 0xC0, 0x30, 0x60, 0xC0, 0x30,
-    0x60, 0xC0, 0x30, 0x60, 0xC0, 0x30, 0x60, 0xC0, 0x30, 0x60, 0xC0, 0x30, 0x60, 0xC0, 0x30, 0x60,
-    0xC0, 0x30, 0x60, 0xC0, 0x30, 0x60, 0xC0, 0x30, 0x60, 0xC0, 0x30, 0x60, 0xC0, 0x30, 0x60, 0xC0,
-    0x30, 0x60, 0xC0, 0xFD, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"m",77*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x7C, 0x00, 0x79, 0x87, 0x00, 0x1E, 0x03, 0x00, 0x1C, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
-    0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
-    0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
-    0x18, 0x01, 0x80, 0x7E, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"n",78*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x03, 0x0E, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x01, 0x00, 0x18, 0x01, 0x80, 0x18,
-    0x00, 0x80, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00,
-    0xC0, 0x30, 0x00, 0xC0, 0x10, 0x00, 0x80, 0x18, 0x01, 0x80, 0x08, 0x01, 0x00, 0x0C, 0x03, 0x00,
-    0x07, 0x0E, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"o",79*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0xF8, 0x00, 0x7B, 0x86, 0x00, 0x1E, 0x03, 0x00, 0x1C, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
-    0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00,
-    0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1C, 0x03, 0x00,
-    0x1B, 0x0E, 0x00, 0x19, 0xF8, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, /*"p",80*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF1, 0x00, 0x06, 0x09, 0x00, 0x0C, 0x07, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x30,
-    0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03,
-    0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x10, 0x03, 0x00, 0x18, 0x03, 0x00, 0x0C, 0x07, 0x00,
-    0x06, 0x1B, 0x00, 0x03, 0xF3, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, /*"q",81*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x07, 0x80, 0x3F, 0x18, 0xC0, 0x03, 0x30, 0xC0, 0x03, 0x60, 0xC0, 0x03, 0xC0, 0x00, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"r",82*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x03, 0x07, 0x80, 0x04, 0x03, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x00, 0x80, 0x0C,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x03, 0x80, 0x10, 0x01, 0x80, 0x10, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1C, 0x01, 0x00,
-    0x1E, 0x07, 0x00, 0x11, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"s",83*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0x00,
-    0x3F, 0xFF, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
-    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80,
-    0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x80, 0x01, 0x80, 0x80, 0x00, 0x81, 0x00,
-    0x00, 0xC2, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"t",84*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00,
-    0x78, 0x0F, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18,
-    0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03,
-    0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x07, 0x00,
-    0x0E, 0x1B, 0xC0, 0x03, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"u",85*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x0F, 0xC0, 0x1C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x02, 0x00, 0x0E, 0x06, 0x00, 0x06,
-    0x04, 0x00, 0x06, 0x04, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x08, 0x00, 0x03, 0x08, 0x00, 0x03, 0x98,
-    0x00, 0x01, 0x90, 0x00, 0x01, 0x90, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"v",86*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0xF1, 0xF0, 0x70, 0x60, 0x40, 0x30, 0x60, 0x40, 0x30, 0x60, 0x80, 0x38, 0x70, 0x80, 0x18,
-    0x70, 0x80, 0x18, 0x71, 0x80, 0x18, 0xB1, 0x00, 0x1C, 0xB9, 0x00, 0x0C, 0x99, 0x00, 0x0C, 0x9B,
-    0x00, 0x0D, 0x1A, 0x00, 0x0F, 0x1A, 0x00, 0x07, 0x0E, 0x00, 0x07, 0x0E, 0x00, 0x06, 0x0C, 0x00,
-    0x06, 0x0C, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"w",87*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x9F, 0x80, 0x0E, 0x06, 0x00, 0x06, 0x04, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x88, 0x00, 0x01,
-    0x90, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB0,
-    0x00, 0x01, 0x38, 0x00, 0x03, 0x18, 0x00, 0x02, 0x0C, 0x00, 0x04, 0x0E, 0x00, 0x0C, 0x06, 0x00,
-    0x1C, 0x07, 0x00, 0x7E, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"x",88*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x8F, 0xE0, 0x0E, 0x03, 0x80, 0x06, 0x01, 0x00, 0x06, 0x03, 0x00, 0x07, 0x02, 0x00, 0x03,
-    0x06, 0x00, 0x03, 0x06, 0x00, 0x01, 0x84, 0x00, 0x01, 0x8C, 0x00, 0x01, 0x88, 0x00, 0x00, 0xC8,
-    0x00, 0x00, 0xD8, 0x00, 0x00, 0x50, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x60, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x1C, 0x80, 0x00, 0x1F,
-    0x80, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, /*"y",89*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x1C, 0x07, 0x00, 0x18, 0x0E, 0x00, 0x18, 0x0C, 0x00, 0x10, 0x1C, 0x00, 0x10,
-    0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0,
-    0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0x80, 0x07, 0x00, 0x80, 0x06, 0x01, 0x80, 0x0E, 0x01, 0x00,
-    0x1C, 0x03, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"z",90*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x30, 0x00, 0x00, 0x40, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"{",91*/
-
-    0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, /*"|",92*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x20, 0x00, 0x00, 0xC0, 0x00, 0x01,
-    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"}",93*/
+    0x6F, 0xFF, 0xFF, 0xFF, 0x76, 0x66, 0x66, 0x66, 0x66, 0x60, 0x00, 0x00, 0x6F, 0xF6, /*"!",1*/
+    0x07, 0x18, 0x3C, 0xF0, 0xF3, 0xC7, 0x9E, 0x1C, 0x70, 0xE3, 0x83, 0x0C, 0x18, 0x60, 0xC3, 0x02,
+    0x08, 0x00, /*""",2*/
+    0x51, 0x71, 0x81, 0x71, 0x81, 0x71, 0x81, 0x71, 0x81, 0x71, 0x81, 0x71, 0x81, 0x71, 0x3F, 0xFF,
+    0x64, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x17, 0x18, 0x17, 0x18, 0x17, 0x18, 0x17, 0x18, 0x17,
+    0x14, 0xFF, 0xF6, 0x32, 0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 0x62, 0x71,
+    0x71, 0x50, /*"#",3*/
+    0x01, 0x00, 0x04, 0x00, 0x10, 0x01, 0xF8, 0x19, 0x10, 0xC4, 0x22, 0x10, 0xD8, 0x43, 0x61, 0x1D,
+    0x84, 0x77, 0x10, 0x0E, 0x40, 0x3D, 0x00, 0x7C, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xE0, 0x07, 0xC0,
+    0x17, 0x00, 0x4E, 0x01, 0x1C, 0x04, 0x76, 0x10, 0xF8, 0x43, 0xE1, 0x0F, 0x04, 0x3C, 0x10, 0x90,
+    0x46, 0x31, 0x20, 0x3F, 0x00, 0x10, 0x00, 0x40, 0x01, 0x00, 0x04, 0x00, /*"$",4*/
+    0x3C, 0x01, 0x0C, 0xC0, 0x61, 0x88, 0x08, 0x21, 0x03, 0x0C, 0x30, 0x41, 0x86, 0x18, 0x30, 0xC2,
+    0x06, 0x18, 0x40, 0xC3, 0x18, 0x18, 0x62, 0x03, 0x0C, 0xC0, 0x61, 0x90, 0x06, 0x66, 0x00, 0xCC,
+    0x8F, 0x0F, 0x11, 0x30, 0x04, 0x66, 0x00, 0x88, 0x40, 0x33, 0x0C, 0x04, 0x61, 0x81, 0x8C, 0x30,
+    0x21, 0x86, 0x04, 0x30, 0xC1, 0x06, 0x18, 0x20, 0xC3, 0x0C, 0x08, 0x61, 0x01, 0x08, 0x60, 0x13,
+    0x08, 0x01, 0xC0, /*"%",5*/
+    0x64, 0xE1, 0x32, 0xC1, 0x52, 0xA2, 0x52, 0xA2, 0x52, 0xA2, 0x52, 0xA2, 0x52, 0xA2, 0x52, 0xA2,
+    0x42, 0xB3, 0x32, 0xC2, 0x22, 0xD4, 0xF0, 0x34, 0x74, 0x46, 0x35, 0x21, 0x26, 0x26, 0x12, 0x35,
+    0x25, 0x22, 0x35, 0x25, 0x14, 0x34, 0x15, 0x24, 0x34, 0x15, 0x25, 0x33, 0x15, 0x25, 0x32, 0x25,
+    0x26, 0x31, 0x16, 0x27, 0x46, 0x27, 0x38, 0x27, 0x35, 0x11, 0x27, 0x43, 0x22, 0x34, 0x12, 0x65,
+    0x54, 0x42, /*"&",6*/
+    0x39, 0xF7, 0xCF, 0x0C, 0x30, 0x84, 0x63, 0x00, /*"'",7*/
+    0x91, 0x81, 0x81, 0x81, 0x82, 0x72, 0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x82, 0x72, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x92, 0x82, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92, 0x92, 0x91,
+    0x92, 0xA1, 0xA1, /*"(",8*/
+    0x01, 0xA1, 0xA1, 0xA1, 0x92, 0x92, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82, 0x82, 0x92, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x72, 0x82, 0x82, 0x72, 0x82, 0x72, 0x82, 0x72, 0x72, 0x81,
+    0x82, 0x71, 0x81, 0x90, /*")",9*/
+    0x73, 0xE3, 0xE3, 0xE3, 0x73, 0x43, 0x47, 0x41, 0x49, 0x31, 0x35, 0x24, 0x21, 0x24, 0x63, 0x11,
+    0x13, 0xB3, 0xE3, 0xB3, 0x11, 0x13, 0x64, 0x21, 0x24, 0x25, 0x31, 0x39, 0x41, 0x47, 0x43, 0x43,
+    0x73, 0xE3, 0xE3, 0xE3, 0x70, /*"*",10*/
+    0x81, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x11, 0x8F, 0x28, 0x1F,
+    0x11, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x11, 0xF1, 0x18, /*"+",11*/
+    0x39, 0xF7, 0xCF, 0x0C, 0x30, 0x84, 0x63, 0x00, /*",",12*/
+    0x0F, 0x30, /*"-",13*/
+    0x77, 0xFF, 0xF7, 0x00, /*".",14*/
+    0xF1, 0x1F, 0x02, 0xF0, 0x1F, 0x02, 0xF0, 0x1F, 0x02, 0xF0, 0x1F, 0x02, 0xF0, 0x1F, 0x02, 0xF0,
+    0x1F, 0x02, 0xF0, 0x1F, 0x11, 0xF0, 0x1F, 0x11, 0xF0, 0x1F, 0x11, 0xF0, 0x1F, 0x11, 0xF0, 0x1F,
+    0x11, 0xF0, 0x2F, 0x01, 0xF0, 0x2F, 0x01, 0xF0, 0x2F, 0x01, 0xF0, 0x2F, 0x01, 0xF0, 0x2F, 0x01,
+    0xF0, 0x2F, 0x01, 0xF1, /*"/",15*/
+    0x64, 0xA2, 0x42, 0x72, 0x62, 0x52, 0x82, 0x42, 0x91, 0x32, 0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x12,
+    0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0x12, 0xA2, 0x22, 0xA2, 0x22,
+    0xA2, 0x32, 0x91, 0x42, 0x82, 0x52, 0x62, 0x72, 0x42, 0xA4, 0x60, /*"0",16*/
+    0x51, 0x92, 0x56, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x84, 0x4B, /*"1",17*/
+    0x56, 0x72, 0x53, 0x33, 0x82, 0x22, 0x92, 0x13, 0xA5, 0xA6, 0x96, 0x92, 0x13, 0x92, 0xC2, 0xD2,
+    0xD2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xD1, 0xA1, 0x22, 0xA1, 0x12, 0xA4,
+    0xA2, 0x1E, 0x1E, 0x10, /*"2",18*/
+    0x46, 0x72, 0x53, 0x42, 0x82, 0x22, 0x92, 0x23, 0x92, 0x13, 0x92, 0x13, 0x92, 0xD2, 0xD2, 0xC2,
+    0xC2, 0xC2, 0x95, 0xE3, 0xE2, 0xE2, 0xD2, 0xE2, 0xD2, 0xD2, 0x12, 0xA6, 0x96, 0x91, 0x13, 0x92,
+    0x23, 0x72, 0x43, 0x52, 0x76, 0x50, /*"3",19*/
+    0xB2, 0xF0, 0x2E, 0x3D, 0x4D, 0x11, 0x2C, 0x21, 0x2C, 0x12, 0x2B, 0x13, 0x2A, 0x23, 0x2A, 0x14,
+    0x29, 0x15, 0x28, 0x25, 0x28, 0x16, 0x27, 0x17, 0x26, 0x27, 0x26, 0x18, 0x25, 0x19, 0x24, 0x29,
+    0x24, 0xF2, 0xB2, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x03, 0xAA, /*"4",20*/
+    0x2D, 0x2D, 0x21, 0xE1, 0xE1, 0xD2, 0xD2, 0xD2, 0xD1, 0xE1, 0xE1, 0x36, 0x51, 0x12, 0x52, 0x43,
+    0x72, 0x32, 0x92, 0xD2, 0xE2, 0xD2, 0xD2, 0xD2, 0x13, 0x96, 0x96, 0x95, 0x92, 0x22, 0x92, 0x22,
+    0x82, 0x43, 0x52, 0x76, 0x50, /*"5",21*/
+    0x76, 0x82, 0x52, 0x61, 0x73, 0x41, 0x83, 0x31, 0x93, 0x31, 0xE2, 0xE1, 0xF0, 0x1E, 0x2E, 0x24,
+    0x64, 0x22, 0x25, 0x23, 0x21, 0x18, 0x22, 0x49, 0x21, 0x3A, 0x21, 0x2C, 0x4C, 0x4C, 0x4C, 0x4C,
+    0x21, 0x2B, 0x21, 0x2B, 0x21, 0x2A, 0x23, 0x29, 0x24, 0x27, 0x26, 0x25, 0x29, 0x55, /*"6",22*/
+    0x1E, 0x1E, 0x12, 0xA1, 0x12, 0xA2, 0x11, 0xA2, 0x21, 0xA1, 0xD2, 0xD2, 0xC2, 0xD2, 0xC2, 0xD2,
+    0xC2, 0xD2, 0xC3, 0xC3, 0xC2, 0xC3, 0xC3, 0xC3, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xC3, 0x70, /*"7",23*/
+    0x57, 0x73, 0x53, 0x42, 0x92, 0x32, 0x92, 0x22, 0xB2, 0x12, 0xB2, 0x12, 0xB2, 0x12, 0xB2, 0x13,
+    0xA2, 0x23, 0x82, 0x35, 0x52, 0x56, 0x22, 0x86, 0x92, 0x15, 0x72, 0x44, 0x52, 0x73, 0x32, 0x93,
+    0x13, 0xA5, 0xB5, 0xC4, 0xC4, 0xC4, 0xC2, 0x12, 0xA2, 0x32, 0x91, 0x52, 0x62, 0x86, 0x50, /*"8",24*/
+    0x56, 0x82, 0x61, 0x62, 0x81, 0x42, 0xA1, 0x32, 0xA2, 0x12, 0xC1, 0x12, 0xC1, 0x12, 0xC4, 0xC4,
+    0xC4, 0xC4, 0xC2, 0x12, 0xA3, 0x12, 0x94, 0x22, 0x72, 0x12, 0x32, 0x52, 0x22, 0x46, 0x42, 0xE1,
+    0xE2, 0xE2, 0xE2, 0xD2, 0x33, 0x82, 0x33, 0x72, 0x43, 0x62, 0x62, 0x52, 0x86, 0x70, /*"9",25*/
+    0x12, 0x18, 0x12, 0xFF, 0xF1, 0x21, 0x81, 0x21, /*":",26*/
+    0x0C, 0xFF, 0xF3, 0xC2, 0x21, 0x22, 0x21, 0x22, /*";",27*/
+    0xD1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xD1, 0xE1,
+    0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, /*"<",28*/
+    0x0F, 0x3F, 0xFF, 0xFF, 0xFF, 0xF6, 0xF3, /*"=",29*/
+    0x01, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xD1, 0xC1,
+    0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xD0, /*">",30*/
+    0x56, 0x72, 0x52, 0x52, 0x81, 0x32, 0x92, 0x21, 0xB4, 0xB5, 0xA6, 0x96, 0x92, 0x13, 0x92, 0xC3,
+    0xB3, 0xB3, 0xA4, 0xA3, 0xB2, 0xD1, 0xE1, 0xE1, 0xE1, 0xE1, 0xFF, 0xFE, 0x2C, 0x4B, 0x4C, 0x27, /*"?",31*/
+    0x01, 0xF0, 0x03, 0x06, 0x03, 0x01, 0x83, 0x00, 0x43, 0x00, 0x11, 0x03, 0xE9, 0x86, 0x72, 0xC3,
+    0x19, 0x43, 0x0C, 0xE1, 0x0C, 0x71, 0x86, 0x38, 0xC3, 0x1C, 0xC1, 0x8E, 0x60, 0xC7, 0x30, 0x63,
+    0x98, 0x71, 0xCC, 0x31, 0x66, 0x18, 0xB3, 0x1C, 0x48, 0x8A, 0x46, 0x39, 0xC3, 0x00, 0x04, 0x80,
+    0x04, 0x60, 0x02, 0x10, 0x02, 0x04, 0x02, 0x01, 0x86, 0x00, 0x7E, 0x00, /*"@",32*/
+    0x83, 0xF1, 0x3F, 0x13, 0xF0, 0x5E, 0x12, 0x2E, 0x12, 0x2E, 0x12, 0x2D, 0x22, 0x3C, 0x22, 0x3C,
+    0x14, 0x2C, 0x14, 0x2B, 0x24, 0x2B, 0x24, 0x3A, 0x16, 0x2A, 0x16, 0x29, 0x26, 0x29, 0xB8, 0x18,
+    0x28, 0x18, 0x27, 0x28, 0x27, 0x19, 0x36, 0x19, 0x36, 0x1A, 0x25, 0x2A, 0x25, 0x2A, 0x34, 0x2A,
+    0x32, 0x66, 0x70, /*"A",33*/
+    0x0E, 0x82, 0x83, 0x62, 0xA2, 0x52, 0xA3, 0x42, 0xB2, 0x42, 0xB2, 0x42, 0xB2, 0x42, 0xB2, 0x42,
+    0xB2, 0x42, 0xA2, 0x52, 0x92, 0x62, 0x73, 0x7A, 0x92, 0x82, 0x72, 0xA2, 0x52, 0xB2, 0x42, 0xB2,
+    0x42, 0xC2, 0x32, 0xC2, 0x32, 0xC2, 0x32, 0xC2, 0x32, 0xC2, 0x32, 0xB3, 0x32, 0xB2, 0x42, 0xA2,
+    0x52, 0x83, 0x3E, 0x50, /*"B",34*/
+    0x76, 0x31, 0x62, 0x64, 0x52, 0x83, 0x42, 0xA2, 0x32, 0xC1, 0x32, 0xC2, 0x12, 0xE1, 0x12, 0xF1,
+    0x2F, 0x02, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F,
+    0x22, 0xF1, 0x2E, 0x11, 0x2D, 0x13, 0x2C, 0x13, 0x2B, 0x15, 0x29, 0x18, 0x25, 0x2B, 0x65, /*"C",35*/
+    0x0B, 0xB2, 0x63, 0x82, 0x82, 0x72, 0x92, 0x62, 0xA2, 0x52, 0xB2, 0x42, 0xB2, 0x42, 0xB2, 0x42,
+    0xC2, 0x32, 0xC2, 0x32, 0xC2, 0x32, 0xC2, 0x32, 0xC2, 0x32, 0xC2, 0x32, 0xC2, 0x32, 0xC2, 0x32,
+    0xC2, 0x32, 0xC2, 0x32, 0xC1, 0x42, 0xB2, 0x42, 0xB2, 0x42, 0xB1, 0x52, 0xA2, 0x52, 0x92, 0x62,
+    0x82, 0x72, 0x63, 0x5B, 0x80, /*"D",36*/
+    0x0F, 0x14, 0x29, 0x43, 0x2A, 0x33, 0x2B, 0x23, 0x2C, 0x22, 0x2D, 0x12, 0x2F, 0x12, 0xF1, 0x28,
+    0x17, 0x28, 0x17, 0x28, 0x17, 0x27, 0x27, 0xB7, 0x27, 0x27, 0x28, 0x17, 0x28, 0x17, 0x28, 0x17,
+    0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2D, 0x12, 0x2C, 0x22, 0x2C, 0x13, 0x2B, 0x23, 0x29, 0x41,
+    0xF1, 0x20, /*"E",37*/
+    0x1F, 0x15, 0x29, 0x44, 0x2A, 0x34, 0x2B, 0x24, 0x2C, 0x23, 0x2D, 0x13, 0x2F, 0x22, 0xF2, 0x29,
+    0x17, 0x29, 0x17, 0x29, 0x17, 0x28, 0x27, 0xC7, 0x28, 0x27, 0x29, 0x17, 0x29, 0x17, 0x29, 0x17,
+    0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2E, 0x8B, /*"F",38*/
+    0x74, 0x31, 0x92, 0x44, 0x81, 0x82, 0x72, 0x82, 0x62, 0xA2, 0x51, 0xC1, 0x42, 0xC1, 0x42, 0xF2,
+    0x1F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0x9A, 0xC2, 0x32, 0xC2, 0x42,
+    0xB2, 0x42, 0xB2, 0x42, 0xB2, 0x51, 0xB2, 0x52, 0xA2, 0x62, 0x92, 0x62, 0x92, 0x73, 0x52, 0xB6,
+    0x70, /*"G",39*/
+    0x06, 0x66, 0x22, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2,
+    0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x4E, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42,
+    0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42,
+    0xA2, 0x42, 0xA2, 0x26, 0x66, /*"H",40*/
+    0x0C, 0x52, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+    0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x5C, /*"I",41*/
+    0x6C, 0xB2, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F,
+    0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12,
+    0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x25, 0x38, 0x25, 0x37, 0x26, 0x37, 0x18, 0x25, 0x2A,
+    0x6A, /*"J",42*/
+    0x06, 0x47, 0x32, 0x83, 0x52, 0x82, 0x62, 0x81, 0x72, 0x71, 0x82, 0x62, 0x82, 0x52, 0x92, 0x51,
+    0xA2, 0x41, 0xB2, 0x32, 0xB2, 0x32, 0xB2, 0x23, 0xB2, 0x11, 0x13, 0xA4, 0x13, 0xA3, 0x33, 0x92,
+    0x43, 0x92, 0x53, 0x82, 0x53, 0x82, 0x63, 0x72, 0x63, 0x72, 0x73, 0x62, 0x73, 0x62, 0x82, 0x62,
+    0x83, 0x52, 0x92, 0x52, 0x93, 0x26, 0x66, /*"K",43*/
+    0x17, 0xD2, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F,
+    0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12,
+    0xC1, 0x32, 0xC1, 0x32, 0xB1, 0x42, 0xA2, 0x42, 0x93, 0x1F, 0x21, /*"L",44*/
+    0xF8, 0x03, 0xE7, 0x00, 0x70, 0xE0, 0x0E, 0x1C, 0x01, 0xC3, 0xC0, 0x78, 0x58, 0x0B, 0x0B, 0x01,
+    0x61, 0x60, 0x2C, 0x2C, 0x05, 0x84, 0xC1, 0x30, 0x98, 0x26, 0x13, 0x04, 0xC2, 0x60, 0x98, 0x4E,
+    0x23, 0x08, 0xC4, 0x61, 0x18, 0x8C, 0x23, 0x11, 0x84, 0x64, 0x30, 0x8E, 0x86, 0x10, 0xD0, 0xC2,
+    0x1A, 0x18, 0x43, 0xC3, 0x08, 0x70, 0x61, 0x06, 0x0C, 0x20, 0xC1, 0x84, 0x18, 0x33, 0xE2, 0x1F,
+    0x80, /*"M",45*/
+    0x78, 0x07, 0xF1, 0xC0, 0x08, 0x1C, 0x00, 0x81, 0x60, 0x08, 0x16, 0x00, 0x81, 0x30, 0x08, 0x13,
+    0x00, 0x81, 0x18, 0x08, 0x11, 0x80, 0x81, 0x0C, 0x08, 0x10, 0xC0, 0x81, 0x06, 0x08, 0x10, 0x60,
+    0x81, 0x03, 0x08, 0x10, 0x30, 0x81, 0x03, 0x88, 0x10, 0x18, 0x81, 0x01, 0xC8, 0x10, 0x0C, 0x81,
+    0x00, 0xE8, 0x10, 0x06, 0x81, 0x00, 0x78, 0x10, 0x03, 0x81, 0x00, 0x38, 0x10, 0x01, 0x81, 0x00,
+    0x18, 0xFE, 0x00, 0x80, /*"N",46*/
+    0x66, 0xB2, 0x51, 0x82, 0x82, 0x61, 0xA1, 0x52, 0xA2, 0x32, 0xC1, 0x32, 0xC2, 0x22, 0xC2, 0x21,
+    0xE1, 0x12, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE2, 0x11, 0xE1, 0x22, 0xC2, 0x22,
+    0xC2, 0x31, 0xC2, 0x32, 0xA2, 0x51, 0xA1, 0x71, 0x82, 0x82, 0x42, 0xB6, 0x60, /*"O",47*/
+    0x1C, 0x82, 0x82, 0x62, 0x92, 0x52, 0xA2, 0x42, 0xB2, 0x32, 0xB2, 0x32, 0xB2, 0x32, 0xB2, 0x32,
+    0xB2, 0x32, 0xB2, 0x32, 0xA2, 0x42, 0x92, 0x52, 0x73, 0x6A, 0x82, 0xF1, 0x2F, 0x12, 0xF1, 0x2F,
+    0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2D, 0x8A, /*"P",48*/
+    0x66, 0xA3, 0x52, 0x72, 0x82, 0x61, 0xA1, 0x52, 0xB1, 0x32, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x12,
+    0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE2, 0x11, 0x35, 0x61, 0x22, 0x17,
+    0x42, 0x25, 0x33, 0x32, 0x33, 0x53, 0x21, 0x42, 0x63, 0x12, 0x52, 0x55, 0x72, 0x53, 0xA8, 0xF0,
+    0x7C, 0x5E, 0x32, /*"Q",49*/
+    0x0B, 0x82, 0x63, 0x62, 0x82, 0x52, 0x83, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42,
+    0x92, 0x42, 0x82, 0x52, 0x82, 0x52, 0x63, 0x69, 0x82, 0x42, 0x92, 0x42, 0x92, 0x43, 0x82, 0x52,
+    0x82, 0x53, 0x72, 0x53, 0x72, 0x62, 0x72, 0x63, 0x62, 0x72, 0x62, 0x73, 0x52, 0x73, 0x52, 0x82,
+    0x52, 0x83, 0x26, 0x65, /*"R",50*/
+    0x47, 0x82, 0x54, 0x41, 0x93, 0x22, 0x93, 0x12, 0xB2, 0x12, 0xC1, 0x12, 0xC1, 0x12, 0xE3, 0xE3,
+    0xD4, 0xE4, 0xE5, 0xD5, 0xD4, 0xE3, 0xE3, 0xE3, 0xE3, 0xD3, 0xD4, 0xC2, 0x11, 0xC2, 0x12, 0xA2,
+    0x23, 0x91, 0x35, 0x52, 0x41, 0x46, 0x40, /*"S",51*/
+    0x1F, 0x12, 0x34, 0x25, 0x22, 0x25, 0x26, 0x12, 0x16, 0x26, 0x11, 0x26, 0x27, 0x27, 0x27, 0x18,
+    0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F,
+    0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xD8, 0x50, /*"T",52*/
+    0x06, 0x75, 0x22, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1,
+    0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1,
+    0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x51, 0xA1,
+    0x62, 0x82, 0x72, 0x62, 0xA6, 0x60, /*"U",53*/
+    0x07, 0x56, 0x23, 0x92, 0x43, 0x92, 0x52, 0x91, 0x62, 0x91, 0x63, 0x81, 0x63, 0x72, 0x63, 0x71,
+    0x82, 0x71, 0x83, 0x61, 0x83, 0x51, 0x93, 0x51, 0xA2, 0x51, 0xA2, 0x51, 0xA3, 0x31, 0xB3, 0x31,
+    0xC2, 0x31, 0xC2, 0x22, 0xC3, 0x11, 0xD3, 0x11, 0xE2, 0x11, 0xE4, 0xE3, 0xF0, 0x3F, 0x12, 0xF1,
+    0x1F, 0x21, 0x90, /*"V",54*/
+    0xFD, 0xF9, 0xF7, 0x06, 0x04, 0x30, 0x60, 0x43, 0x06, 0x04, 0x30, 0x70, 0x43, 0x07, 0x0C, 0x38,
+    0x30, 0x83, 0x87, 0x08, 0x18, 0x70, 0x81, 0x87, 0x08, 0x18, 0x70, 0x81, 0x8F, 0x90, 0x18, 0xB9,
+    0x01, 0xC9, 0x90, 0x0C, 0x99, 0x00, 0xC9, 0x90, 0x0D, 0x9B, 0x00, 0xD1, 0xA0, 0x0D, 0x1E, 0x00,
+    0xD0, 0xE0, 0x0F, 0x0E, 0x00, 0x70, 0xE0, 0x06, 0x0E, 0x00, 0x60, 0xC0, 0x06, 0x0C, 0x00, 0x60,
+    0x40, 0x06, 0x04, 0x00, /*"W",55*/
+    0x07, 0x46, 0x33, 0x82, 0x62, 0x82, 0x63, 0x71, 0x82, 0x62, 0x83, 0x51, 0xA2, 0x42, 0xA3, 0x31,
+    0xC2, 0x22, 0xC3, 0x11, 0xE4, 0xE3, 0xF1, 0x2F, 0x12, 0xF1, 0x3E, 0x4E, 0x11, 0x3C, 0x22, 0x2C,
+    0x13, 0x3A, 0x24, 0x2A, 0x15, 0x38, 0x25, 0x38, 0x17, 0x36, 0x27, 0x36, 0x19, 0x25, 0x29, 0x32,
+    0x65, 0x70, /*"X",56*/
+    0x07, 0x56, 0x23, 0x92, 0x43, 0x91, 0x62, 0x91, 0x63, 0x72, 0x63, 0x71, 0x82, 0x62, 0x83, 0x51,
+    0xA2, 0x51, 0xA2, 0x41, 0xC2, 0x31, 0xC2, 0x22, 0xC3, 0x11, 0xE2, 0x11, 0xE3, 0xF1, 0x2F, 0x12,
+    0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2D, 0x85, /*"Y",57*/
+    0x3E, 0x24, 0x82, 0x32, 0x93, 0x32, 0x92, 0x32, 0x93, 0x31, 0x93, 0xE3, 0xD3, 0xE2, 0xE3, 0xE2,
+    0xE3, 0xE2, 0xE3, 0xE2, 0xE3, 0xE2, 0xE3, 0xE2, 0xE3, 0xD3, 0xE3, 0xA1, 0x23, 0xA2, 0x22, 0xB1,
+    0x23, 0xA2, 0x22, 0x94, 0x1F, 0x02, /*"Z",58*/
+    0x0A, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x89, /*"[",59*/
+    0x02, 0xE2, 0xD2, 0xD2, 0xE2, 0xD2, 0xE2, 0xD2, 0xD2, 0xE2, 0xD2, 0xE2, 0xD2, 0xD2, 0xE2, 0xD2,
+    0xE1, 0xE2, 0xD2, 0xE2, 0xD2, 0xE1, 0xE2, 0xD2, 0xE2, 0xD2, 0xD2, 0xE2, 0xD2, 0xE2, 0xD2, 0xD2,
+    0xE2, /*"\",60*/
+    0x09, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x7B, /*"]",61*/
+    0x1E, 0x0F, 0xC3, 0x39, 0x86, 0x80, 0x40, /*"^",62*/
+    0x0F, 0x50, /*"_",63*/
+    0xF8, 0x3C, 0x06, 0x01, /*"`",64*/
+    0x47, 0x82, 0x72, 0x52, 0x92, 0x42, 0x92, 0x42, 0x92, 0xF0, 0x2E, 0x39, 0x51, 0x26, 0x36, 0x25,
+    0x28, 0x24, 0x29, 0x23, 0x2A, 0x23, 0x2A, 0x23, 0x2A, 0x23, 0x2A, 0x22, 0x11, 0x28, 0x32, 0x11,
+    0x35, 0x21, 0x22, 0x13, 0x64, 0x31, /*"a",65*/
+    0x31, 0xD4, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
+    0x02, 0x45, 0x62, 0x22, 0x43, 0x42, 0x11, 0x81, 0x43, 0x92, 0x33, 0x92, 0x32, 0xB2, 0x22, 0xB2,
+    0x22, 0xB2, 0x22, 0xB2, 0x22, 0xB2, 0x22, 0xB2, 0x22, 0xB2, 0x22, 0xB2, 0x22, 0xA2, 0x32, 0xA2,
+    0x33, 0x82, 0x44, 0x62, 0x51, 0x36, 0x50, /*"b",66*/
+    0x56, 0x82, 0x52, 0x43, 0x71, 0x42, 0x82, 0x22, 0x92, 0x22, 0x92, 0x12, 0xD2, 0xD2, 0xD2, 0xD2,
+    0xD2, 0xD2, 0xC1, 0x12, 0xB1, 0x12, 0xA1, 0x32, 0x82, 0x42, 0x62, 0x76, 0x40, /*"c",67*/
+    0xE1, 0xC5, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x27,
+    0x62, 0x25, 0x25, 0x21, 0x24, 0x28, 0x34, 0x1A, 0x23, 0x2A, 0x23, 0x2A, 0x22, 0x2B, 0x22, 0x2B,
+    0x22, 0x2B, 0x22, 0x2B, 0x22, 0x2B, 0x22, 0x2B, 0x22, 0x2B, 0x23, 0x2A, 0x23, 0x29, 0x34, 0x27,
+    0x45, 0x25, 0x21, 0x45, 0x53, 0x13, /*"d",68*/
+    0x55, 0x82, 0x52, 0x52, 0x72, 0x41, 0x92, 0x22, 0xA1, 0x21, 0xB4, 0xB4, 0xBF, 0x4D, 0x2D, 0x2D,
+    0x2E, 0x2B, 0x11, 0x2A, 0x13, 0x28, 0x24, 0x35, 0x27, 0x64, /*"e",69*/
+    0x96, 0x93, 0x51, 0x72, 0x72, 0x62, 0x72, 0x52, 0x82, 0x52, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02,
+    0xAE, 0x82, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
+    0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2B, 0xB5, /*"f",70*/
+    0x56, 0x33, 0x32, 0x57, 0x22, 0x72, 0x22, 0x12, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42,
+    0x92, 0x52, 0x72, 0x72, 0x52, 0x72, 0x16, 0x72, 0xF0, 0x2F, 0x06, 0xCB, 0x62, 0x38, 0x32, 0xA3,
+    0x12, 0xC2, 0x12, 0xC2, 0x12, 0xC2, 0x22, 0xA2, 0x43, 0x72, 0x78, 0x50, /*"g",71*/
+    0x31, 0xE4, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F,
+    0x12, 0x45, 0x72, 0x22, 0x43, 0x54, 0x72, 0x53, 0x92, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42,
+    0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42,
+    0xA2, 0x42, 0xA2, 0x26, 0x66, /*"h",72*/
+    0x52, 0x94, 0x84, 0x92, 0xFF, 0xFF, 0xB1, 0x57, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+    0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x5C, /*"i",73*/
+    0xA2, 0xA4, 0x94, 0xA2, 0xFF, 0xFF, 0xF2, 0x16, 0x7B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x21, 0x27, 0x22, 0x27, 0x22, 0x34,
+    0x26, 0x65, /*"j",74*/
+    0x31, 0xD4, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
+    0x02, 0x57, 0x32, 0x72, 0x62, 0x71, 0x72, 0x61, 0x82, 0x52, 0x82, 0x42, 0x92, 0x32, 0xA2, 0x23,
+    0xA2, 0x12, 0x12, 0x94, 0x23, 0x83, 0x42, 0x82, 0x53, 0x72, 0x63, 0x62, 0x72, 0x62, 0x73, 0x52,
+    0x82, 0x52, 0x83, 0x26, 0x56, /*"k",75*/
+    0x52, 0x57, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+    0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x5C, /*"l",76*/
+    0x10, 0x00, 0x07, 0x3C, 0x78, 0x3C, 0x78, 0xC3, 0x87, 0x0C, 0x30, 0x60, 0xC3, 0x06, 0x0C, 0x30,
+    0x60, 0xC3, 0x06, 0x0C, 0x30, 0x60, 0xC3, 0x06, 0x0C, 0x30, 0x60, 0xC3, 0x06, 0x0C, 0x30, 0x60,
+    0xC3, 0x06, 0x0C, 0x30, 0x60, 0xC3, 0x06, 0x0C, 0x30, 0x60, 0xC3, 0x06, 0x0C, 0xFD, 0xFB, 0xF0, /*"m",77*/
+    0x31, 0x45, 0x54, 0x22, 0x43, 0x54, 0x72, 0x53, 0x92, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42,
+    0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42,
+    0xA2, 0x42, 0xA2, 0x26, 0x66, /*"n",78*/
+    0x56, 0x92, 0x43, 0x52, 0x82, 0x42, 0x91, 0x32, 0xA2, 0x22, 0xB1, 0x12, 0xC4, 0xC4, 0xC4, 0xC4,
+    0xC4, 0xC2, 0x11, 0xC1, 0x22, 0xA2, 0x31, 0xA1, 0x42, 0x82, 0x53, 0x43, 0x86, 0x50, /*"o",79*/
+    0x31, 0x35, 0x54, 0x13, 0x42, 0x54, 0x72, 0x43, 0x92, 0x32, 0xA2, 0x32, 0xB2, 0x22, 0xB2, 0x22,
+    0xB2, 0x22, 0xB2, 0x22, 0xB2, 0x22, 0xB2, 0x22, 0xB2, 0x22, 0xB2, 0x22, 0xA2, 0x32, 0xA2, 0x33,
+    0x82, 0x42, 0x12, 0x43, 0x52, 0x26, 0x72, 0xF0, 0x2F, 0x02, 0xF0, 0x2D, 0x7A, /*"p",80*/
+    0x55, 0x31, 0x52, 0x51, 0x21, 0x42, 0x73, 0x32, 0x92, 0x32, 0x92, 0x22, 0xA2, 0x22, 0xA2, 0x22,
+    0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x31, 0xA2, 0x32, 0x92, 0x42,
+    0x73, 0x52, 0x42, 0x12, 0x66, 0x22, 0xE2, 0xE2, 0xE2, 0xE2, 0xB7, /*"q",81*/
+    0x52, 0x54, 0x26, 0x32, 0x32, 0x52, 0x22, 0x42, 0x52, 0x12, 0x52, 0x54, 0xD3, 0xE2, 0xF0, 0x2F,
+    0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xAC, 0x50, /*"r",82*/
+    0x46, 0x72, 0x54, 0x21, 0x83, 0x12, 0x92, 0x12, 0xA1, 0x12, 0xC3, 0xC5, 0xB6, 0xA6, 0xB4, 0xC4,
+    0xB3, 0xB4, 0xA5, 0x91, 0x14, 0x63, 0x11, 0x37, 0x30, /*"s",83*/
+    0x61, 0xE1, 0xE1, 0xD2, 0xD2, 0xC3, 0x8E, 0x62, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+    0xD2, 0xD2, 0xD2, 0xD2, 0x71, 0x52, 0x71, 0x61, 0x61, 0x72, 0x41, 0x95, 0x30, /*"t",84*/
+    0x31, 0xA1, 0x24, 0x74, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92,
+    0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x83,
+    0x52, 0x73, 0x53, 0x42, 0x14, 0x55, 0x31, 0x30, /*"u",85*/
+    0x07, 0x46, 0x23, 0x82, 0x52, 0x82, 0x52, 0x81, 0x63, 0x62, 0x72, 0x61, 0x82, 0x61, 0x83, 0x42,
+    0x92, 0x41, 0xA2, 0x41, 0xA3, 0x22, 0xB2, 0x21, 0xC2, 0x21, 0xC4, 0xE3, 0xE3, 0xE2, 0xF1, 0x18, /*"v",86*/
+    0xFD, 0xF1, 0xF7, 0x06, 0x04, 0x30, 0x60, 0x43, 0x06, 0x08, 0x38, 0x70, 0x81, 0x87, 0x08, 0x18,
+    0x71, 0x81, 0x8B, 0x10, 0x1C, 0xB9, 0x00, 0xC9, 0x90, 0x0C, 0x9B, 0x00, 0xD1, 0xA0, 0x0F, 0x1A,
+    0x00, 0x70, 0xE0, 0x07, 0x0E, 0x00, 0x60, 0xC0, 0x06, 0x0C, 0x00, 0x20, 0x40, /*"w",87*/
+    0x17, 0x26, 0x43, 0x62, 0x72, 0x61, 0x83, 0x42, 0x93, 0x31, 0xB2, 0x21, 0xC5, 0xD3, 0xE3, 0xE4,
+    0xD1, 0x12, 0xC1, 0x23, 0xA2, 0x32, 0xA1, 0x52, 0x81, 0x63, 0x62, 0x72, 0x53, 0x73, 0x26, 0x47, /*"x",88*/
+    0x07, 0x37, 0x23, 0x73, 0x52, 0x81, 0x62, 0x72, 0x63, 0x61, 0x82, 0x52, 0x82, 0x52, 0x92, 0x41,
+    0xA2, 0x32, 0xA2, 0x31, 0xC2, 0x21, 0xC2, 0x12, 0xD1, 0x11, 0xE3, 0xE3, 0xF0, 0x1F, 0x11, 0xF0,
+    0x2F, 0x01, 0xF1, 0x1A, 0x32, 0x1B, 0x6C, 0x3C, /*"y",89*/
+    0x1C, 0x13, 0x73, 0x12, 0x73, 0x22, 0x72, 0x31, 0x73, 0x31, 0x63, 0xB2, 0xB3, 0xA3, 0xB3, 0xA3,
+    0xB2, 0xB3, 0x71, 0x23, 0x81, 0x22, 0x82, 0x13, 0x81, 0x13, 0x82, 0x1D, 0x10, /*"z",90*/
+    0x07, 0x0C, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x60, 0x80, 0x60, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x08, 0x0C, 0x07, /*"{",91*/
+    0x0F, 0xF9, /*"|",92*/
+    0xE0, 0x30, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0C,
+    0x06, 0x01, 0x06, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x10, 0x30, 0xE0, /*"}",93*/
+    0x34, 0xB2, 0x23, 0xA1, 0x43, 0x72, 0x63, 0x62, 0x73, 0x41, 0xA3, 0x21, 0xD3, 0x30, /*"~",94*/
+};
 
-    0x07, 0x80, 0x00, 0x19, 0xC0, 0x00, 0x10, 0xE0, 0x20, 0x20, 0x70, 0x20, 0x20, 0x38, 0x40, 0x00,
-    0x1C, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"~",94*/
+static const esp_painter_glyph_t glyphs[] = {
+    {0x0000, 0, 0, 0, 0}, /*" ",0*/
+    {0x0000, 8, 6, 4, 28}, /*"!",1*/
+    {0x000E, 3, 2, 14, 10}, /*""",2*/
+    {0x8020, 1, 6, 17, 28}, /*"#",3*/
+    {0x0052, 3, 4, 14, 34}, /*"$",4*/
+    {0x008E, 0, 6, 19, 28}, /*"%",5*/
+    {0x80D1, 0, 6, 19, 28}, /*"&",6*/
+    {0x0113, 2, 2, 6, 10}, /*"'",7*/
+    {0x811B, 9, 2, 10, 35}, /*"(",8*/
+    {0x813E, 1, 2, 10, 35}, /*")",9*/
+    {0x8162, 1, 9, 17, 20}, /*"*",10*/
+    {0x8187, 2, 10, 17, 19}, /*"+",11*/
+    {0x01A3, 2, 29, 6, 10}, /*",",12*/
+    {0x81AB, 1, 19, 18, 1}, /*"-",13*/
+    {0x01AD, 3, 29, 5, 5}, /*".",14*/
+    {0x81B1, 1, 3, 17, 34}, /*"/",15*/
+    {0x81E5, 2, 7, 16, 27}, /*"0",16*/
+    {0x8210, 5, 7, 11, 27}, /*"1",17*/
+    {0x822B, 2, 7, 15, 27}, /*"2",18*/
+    {0x824F, 2, 7, 15, 27}, /*"3",19*/
+    {0x8275, 1, 7, 17, 27}, /*"4",20*/
+    {0x82A2, 2, 7, 15, 27}, /*"5",21*/
+    {0x82C7, 2, 7, 16, 27}, /*"6",22*/
+    {0x82F5, 3, 7, 15, 27}, /*"7",23*/
+    {0x8315, 2, 7, 16, 27}, /*"8",24*/
+    {0x8344, 2, 7, 16, 27}, /*"9",25*/
+    {0x8372, 8, 15, 4, 19}, /*":",26*/
+    {0x837A, 8, 16, 4, 22}, /*";",27*/
+    {0x8382, 4, 6, 14, 28}, /*"<",28*/
+    {0x839E, 1, 15, 18, 9}, /*"=",29*/
+    {0x83A5, 3, 6, 14, 28}, /*">",30*/
+    {0x83C2, 3, 6, 15, 28}, /*"?",31*/
+    {0x03E2, 2, 6, 17, 28}, /*"@",32*/
+    {0x841E, 0, 7, 19, 27}, /*"A",33*/
+    {0x8451, 0, 7, 19, 27}, /*"B",34*/
+    {0x8485, 1, 7, 18, 27}, /*"C",35*/
+    {0x84B4, 0, 7, 19, 27}, /*"D",36*/
+    {0x84E9, 1, 7, 18, 27}, /*"E",37*/
+    {0x851B, 0, 7, 19, 27}, /*"F",38*/
+    {0x8549, 1, 7, 19, 27}, /*"G",39*/
+    {0x857A, 1, 7, 18, 27}, /*"H",40*/
+    {0x85AF, 4, 7, 12, 27}, /*"I",41*/
+    {0x85CA, 1, 7, 18, 32}, /*"J",42*/
+    {0x85FB, 1, 7, 18, 27}, /*"K",43*/
+    {0x8632, 1, 7, 18, 27}, /*"L",44*/
+    {0x065D, 0, 7, 19, 27}, /*"M",45*/
+    {0x069E, 0, 7, 20, 27}, /*"N",46*/
+    {0x86E2, 1, 7, 18, 27}, /*"O",47*/
+    {0x870F, 0, 7, 18, 27}, /*"P",48*/
+    {0x873C, 1, 7, 18, 30}, /*"Q",49*/
+    {0x876F, 2, 7, 17, 27}, /*"R",50*/
+    {0x87A3, 2, 7, 16, 27}, /*"S",51*/
+    {0x87CA, 1, 7, 18, 27}, /*"T",52*/
+    {0x87F9, 1, 7, 18, 27}, /*"U",53*/
+    {0x882F, 1, 7, 18, 27}, /*"V",54*/
+    {0x0862, 0, 7, 20, 27}, /*"W",55*/
+    {0x88A6, 1, 7, 18, 27}, /*"X",56*/
+    {0x88D8, 1, 7, 18, 27}, /*"Y",57*/
+    {0x8907, 1, 7, 17, 27}, /*"Z",58*/
+    {0x892D, 8, 2, 9, 35}, /*"[",59*/
+    {0x894F, 3, 5, 15, 33}, /*"\",60*/
+    {0x8970, 3, 2, 9, 35}, /*"]",61*/
+    {0x0992, 5, 1, 10, 5}, /*"^",62*/
+    {0x8999, 0, 38, 20, 1}, /*"_",63*/
+    {0x099B, 3, 2, 8, 4}, /*"`",64*/
+    {0x899F, 2, 16, 17, 18}, /*"a",65*/
+    {0x89C5, 1, 5, 17, 29}, /*"b",66*/
+    {0x89FC, 2, 16, 15, 18}, /*"c",67*/
+    {0x8A19, 2, 5, 17, 29}, /*"d",68*/
+    {0x8A4F, 3, 16, 15, 18}, /*"e",69*/
+    {0x8A69, 2, 6, 17, 28}, /*"f",70*/
+    {0x8A93, 2, 16, 17, 23}, /*"g",71*/
+    {0x8ABF, 1, 5, 18, 29}, /*"h",72*/
+    {0x8AF4, 4, 6, 12, 28}, /*"i",73*/
+    {0x8B0D, 3, 6, 13, 33}, /*"j",74*/
+    {0x8B2F, 2, 5, 17, 29}, /*"k",75*/
+    {0x8B64, 4, 5, 12, 29}, /*"l",76*/
+    {0x0B81, 0, 15, 20, 19}, /*"m",77*/
+    {0x8BB1, 1, 16, 18, 18}, /*"n",78*/
+    {0x8BD6, 2, 16, 16, 18}, /*"o",79*/
+    {0x8BF4, 1, 16, 17, 23}, /*"p",80*/
+    {0x8C21, 2, 16, 16, 23}, /*"q",81*/
+    {0x8C4C, 1, 16, 17, 18}, /*"r",82*/
+    {0x8C6B, 3, 16, 14, 18}, /*"s",83*/
+    {0x8C84, 2, 10, 15, 24}, /*"t",84*/
+    {0x8CA1, 1, 15, 17, 19}, /*"u",85*/
+    {0x8CC9, 1, 16, 17, 18}, /*"v",86*/
+    {0x0CE9, 0, 16, 20, 18}, /*"w",87*/
+    {0x8D16, 1, 16, 17, 18}, /*"x",88*/
+    {0x8D36, 2, 16, 17, 23}, /*"y",89*/
+    {0x8D5E, 3, 16, 14, 18}, /*"z",90*/
+    {0x0D7B, 9, 2, 8, 35}, /*"{",91*/
+    {0x8D9E, 9, 0, 1, 39}, /*"|",92*/
+    {0x0DA0, 3, 2, 8, 35}, /*"}",93*/
+    {0x8DC3, 2, 0, 17, 7}, /*"~",94*/
 };
 
 const esp_painter_basic_font_t esp_painter_basic_font_40 = {
     .bitmap = bitmap,
+    .glyphs = glyphs,
     .width = 20,
     .height = 40,
+    .first = 0x20,
+    .count = 95,
 };
 
 #endif
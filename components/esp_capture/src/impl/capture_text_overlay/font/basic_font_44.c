@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: CC0-1.0
  */
 
+/* Packed by tools/pack_font.py: 22x44 cells, 4617 bytes (1-bit bitmap: 12540) */
+
 #include "sdkconfig.h"
 
 #include "esp_painter_font.h"
@@ -11,961 +13,409 @@
 #if CONFIG_ESP_PAINTER_BASIC_FONT_44
 
 static const uint8_t bitmap[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*" ",0*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"!",1*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x80, 0x01, 0xE3, 0xC0, 0x01,
-    0xE3, 0xC0, 0x03, 0xC7, 0x80, 0x03, 0x87, 0x00, 0x07, 0x8F, 0x00, 0x07, 0x0E, 0x00, 0x0E, 0x1C,
-    0x00, 0x0C, 0x18, 0x00, 0x18, 0x30, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*""",2*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0xC0, 0x01, 0x00, 0x80, 0x01, 0x00,
-    0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03,
-    0x01, 0x80, 0x03, 0x01, 0x80, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
-    0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x06, 0x03, 0x00,
-    0x06, 0x03, 0x00, 0x06, 0x03, 0x00, 0x06, 0x03, 0x00, 0x06, 0x03, 0x00, 0x06, 0x03, 0x00, 0x06,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"#",3*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xB3, 0x00, 0x03, 0x31,
-    0x80, 0x06, 0x31, 0xC0, 0x0E, 0x31, 0xC0, 0x0E, 0x33, 0xC0, 0x0E, 0x33, 0xC0, 0x0E, 0x33, 0x80,
-    0x0F, 0x30, 0x00, 0x07, 0x30, 0x00, 0x07, 0xB0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x37, 0x80, 0x00, 0x33,
-    0x80, 0x00, 0x33, 0xC0, 0x00, 0x31, 0xC0, 0x0E, 0x31, 0xC0, 0x1E, 0x31, 0xC0, 0x1E, 0x31, 0xC0,
-    0x1E, 0x31, 0xC0, 0x1C, 0x31, 0x80, 0x0C, 0x31, 0x80, 0x0C, 0x33, 0x00, 0x07, 0x36, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"$",4*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x80, 0x11, 0x01, 0x80, 0x31, 0x81,
-    0x00, 0x20, 0x83, 0x00, 0x60, 0xC2, 0x00, 0x60, 0xC2, 0x00, 0x60, 0xC6, 0x00, 0x60, 0xC4, 0x00,
-    0x60, 0xCC, 0x00, 0x60, 0xC8, 0x00, 0x60, 0xC8, 0x00, 0x60, 0xD8, 0x00, 0x20, 0x90, 0x00, 0x31,
-    0xB0, 0x00, 0x11, 0xA1, 0xC0, 0x0E, 0x22, 0x20, 0x00, 0x46, 0x30, 0x00, 0x44, 0x10, 0x00, 0xCC,
-    0x18, 0x00, 0x8C, 0x18, 0x00, 0x8C, 0x18, 0x01, 0x0C, 0x18, 0x01, 0x0C, 0x18, 0x03, 0x0C, 0x18,
-    0x02, 0x0C, 0x18, 0x02, 0x0C, 0x18, 0x04, 0x04, 0x10, 0x04, 0x06, 0x30, 0x0C, 0x02, 0x20, 0x08,
-    0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"%",5*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x03, 0x38, 0x00, 0x06, 0x18,
-    0x00, 0x0E, 0x1C, 0x00, 0x0E, 0x1C, 0x00, 0x0E, 0x1C, 0x00, 0x0E, 0x1C, 0x00, 0x0E, 0x1C, 0x00,
-    0x0E, 0x18, 0x00, 0x0E, 0x38, 0x00, 0x0F, 0x30, 0x00, 0x07, 0x60, 0x00, 0x07, 0xC0, 0x00, 0x07,
-    0x87, 0xF0, 0x0F, 0x81, 0xC0, 0x1B, 0x81, 0x80, 0x1B, 0xC1, 0x80, 0x31, 0xC1, 0x80, 0x31, 0xC1,
-    0x80, 0x70, 0xE1, 0x00, 0x70, 0xE1, 0x00, 0x70, 0x73, 0x00, 0x70, 0x7A, 0x00, 0x70, 0x3A, 0x00,
-    0x70, 0x3C, 0x00, 0x38, 0x1E, 0x08, 0x38, 0x1E, 0x18, 0x1E, 0x37, 0x10, 0x0F, 0xE3, 0xF0, 0x07,
-    0xC1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"&",6*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"'",7*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x20, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"(",8*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x20, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*")",9*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x70, 0x70, 0x70, 0x78, 0x20, 0xF0, 0x7E, 0x23, 0xF0, 0x1F, 0x27, 0xC0, 0x03, 0xAE, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x03, 0xAE, 0x00, 0x1F, 0x27, 0xC0, 0x7E, 0x23, 0xF0, 0x78, 0x20,
-    0xF0, 0x70, 0x70, 0x70, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"*",10*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x7F,
-    0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"+",11*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*",",12*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"-",13*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*".",14*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x20, 0x00, 0x00, 0x60, 0x00, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x30, 0x00, 0x00, 0x20, 0x00, 0x00, 0x60, 0x00, 0x00, 0x40, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x30, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"/",15*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x86, 0x00, 0x03, 0x03,
-    0x00, 0x06, 0x01, 0x80, 0x0E, 0x01, 0xC0, 0x0C, 0x00, 0xC0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0,
-    0x1C, 0x00, 0x60, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38,
-    0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00,
-    0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x1C, 0x00, 0x60, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0,
-    0x0C, 0x00, 0xC0, 0x0E, 0x01, 0xC0, 0x06, 0x01, 0x80, 0x03, 0x03, 0x00, 0x01, 0x86, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"0",16*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x7C, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"1",17*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x07, 0x00, 0x04, 0x03,
-    0x80, 0x08, 0x01, 0xC0, 0x08, 0x00, 0xE0, 0x18, 0x00, 0xE0, 0x18, 0x00, 0xE0, 0x1C, 0x00, 0xE0,
-    0x1C, 0x00, 0xE0, 0x0C, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00,
-    0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x20, 0x06, 0x00, 0x20,
-    0x0C, 0x00, 0x60, 0x18, 0x00, 0x60, 0x30, 0x00, 0xC0, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"2",18*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x0E, 0x00, 0x06, 0x03,
-    0x00, 0x0C, 0x03, 0x80, 0x0C, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x06, 0x01, 0xC0,
-    0x00, 0x01, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x0C, 0x00, 0xE0, 0x1C, 0x00, 0xE0,
-    0x1C, 0x00, 0xC0, 0x1C, 0x01, 0xC0, 0x08, 0x01, 0x80, 0x0C, 0x03, 0x80, 0x06, 0x0F, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"3",19*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00,
-    0x00, 0x47, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x87, 0x00, 0x01, 0x07, 0x00, 0x01, 0x07, 0x00, 0x02,
-    0x07, 0x00, 0x06, 0x07, 0x00, 0x04, 0x07, 0x00, 0x0C, 0x07, 0x00, 0x08, 0x07, 0x00, 0x10, 0x07,
-    0x00, 0x30, 0x07, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"4",20*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x07, 0xFF,
-    0xE0, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x7C, 0x00, 0x0D, 0xFF, 0x00, 0x0B, 0x07, 0x80, 0x0A,
-    0x03, 0xC0, 0x0C, 0x01, 0xC0, 0x0C, 0x01, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x0C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0,
-    0x1C, 0x01, 0xC0, 0x18, 0x01, 0xC0, 0x08, 0x01, 0x80, 0x04, 0x03, 0x80, 0x02, 0x07, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"5",21*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xC1, 0x80, 0x03, 0x01,
-    0x80, 0x06, 0x01, 0xC0, 0x06, 0x01, 0xC0, 0x0C, 0x01, 0xC0, 0x0C, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x7E, 0x00, 0x39, 0xFF, 0x80, 0x3B,
-    0x83, 0xC0, 0x3B, 0x01, 0xE0, 0x3E, 0x00, 0xE0, 0x3C, 0x00, 0xE0, 0x38, 0x00, 0x70, 0x38, 0x00,
-    0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x18, 0x00, 0x70, 0x1C, 0x00, 0x70,
-    0x1C, 0x00, 0x60, 0x0C, 0x00, 0xE0, 0x0E, 0x00, 0xC0, 0x07, 0x01, 0x80, 0x03, 0x83, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"6",22*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xC0, 0x0C, 0x00, 0xC0, 0x08, 0x00, 0x80, 0x18, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x02, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"7",23*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x87, 0x00, 0x06, 0x01,
-    0x80, 0x0E, 0x01, 0xC0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0,
-    0x1E, 0x00, 0xE0, 0x1E, 0x00, 0xC0, 0x0F, 0x01, 0xC0, 0x0F, 0x81, 0x80, 0x07, 0xE3, 0x00, 0x01,
-    0xFE, 0x00, 0x01, 0xFC, 0x00, 0x07, 0x3F, 0x00, 0x0E, 0x0F, 0x80, 0x0C, 0x07, 0x80, 0x1C, 0x03,
-    0xC0, 0x38, 0x01, 0xE0, 0x38, 0x01, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0,
-    0x38, 0x00, 0xE0, 0x18, 0x00, 0xC0, 0x1C, 0x01, 0xC0, 0x0E, 0x01, 0x80, 0x07, 0x07, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"8",24*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x07, 0x00, 0x06, 0x01,
-    0x80, 0x0C, 0x00, 0xC0, 0x1C, 0x00, 0xC0, 0x18, 0x00, 0xE0, 0x38, 0x00, 0x60, 0x38, 0x00, 0x60,
-    0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0xF0, 0x3C,
-    0x00, 0xF0, 0x1C, 0x01, 0xF0, 0x1E, 0x03, 0x70, 0x0F, 0x06, 0x70, 0x07, 0xFC, 0x70, 0x01, 0xF8,
-    0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0,
-    0x0E, 0x01, 0xC0, 0x0E, 0x01, 0x80, 0x0E, 0x03, 0x00, 0x0E, 0x07, 0x00, 0x06, 0x0C, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"9",25*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*":",26*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x20, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x00, /*";",27*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x01,
-    0x80, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"<",28*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"=",29*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00,
-    0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*">",30*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x07, 0x03,
-    0xC0, 0x0C, 0x00, 0xE0, 0x18, 0x00, 0xE0, 0x30, 0x00, 0x70, 0x30, 0x00, 0x70, 0x38, 0x00, 0x70,
-    0x3C, 0x00, 0x70, 0x3C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00,
-    0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"?",31*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xC1, 0x80, 0x03, 0x80,
-    0xC0, 0x03, 0x00, 0x60, 0x06, 0x00, 0x30, 0x0C, 0x0D, 0xB0, 0x0C, 0x1B, 0xB0, 0x1C, 0x33, 0x98,
-    0x1C, 0x73, 0x18, 0x18, 0x63, 0x18, 0x38, 0xE3, 0x18, 0x38, 0xE3, 0x18, 0x38, 0xC3, 0x18, 0x39,
-    0xC3, 0x18, 0x39, 0xC3, 0x18, 0x39, 0xC2, 0x18, 0x39, 0xC6, 0x18, 0x39, 0xC6, 0x30, 0x39, 0xC6,
-    0x30, 0x39, 0xC6, 0x30, 0x19, 0xCE, 0x60, 0x1C, 0xF7, 0xC0, 0x1C, 0x63, 0x80, 0x0C, 0x00, 0x08,
-    0x0E, 0x00, 0x10, 0x07, 0x00, 0x30, 0x07, 0x00, 0x60, 0x03, 0xC1, 0xC0, 0x01, 0xFF, 0x80, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"@",32*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x98, 0x00, 0x00, 0x98, 0x00, 0x01, 0x9C, 0x00,
-    0x01, 0x9C, 0x00, 0x01, 0x0C, 0x00, 0x01, 0x0C, 0x00, 0x03, 0x0E, 0x00, 0x03, 0x0E, 0x00, 0x02,
-    0x06, 0x00, 0x02, 0x06, 0x00, 0x06, 0x07, 0x00, 0x06, 0x07, 0x00, 0x04, 0x07, 0x00, 0x07, 0xFF,
-    0x00, 0x0C, 0x03, 0x80, 0x0C, 0x03, 0x80, 0x08, 0x03, 0x80, 0x08, 0x01, 0x80, 0x18, 0x01, 0xC0,
-    0x18, 0x01, 0xC0, 0x10, 0x01, 0xC0, 0x10, 0x01, 0xC0, 0x30, 0x00, 0xE0, 0x38, 0x01, 0xE0, 0xFC,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"A",33*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x0E, 0x07, 0x80, 0x0E, 0x01,
-    0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
-    0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x01, 0xC0, 0x0E, 0x03, 0x80, 0x0E, 0x07, 0x00, 0x0F,
-    0xFC, 0x00, 0x0E, 0x03, 0x00, 0x0E, 0x01, 0xC0, 0x0E, 0x00, 0xC0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
-    0x60, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70,
-    0x0E, 0x00, 0x70, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x01, 0xC0, 0x0E, 0x03, 0x80, 0x7F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"B",34*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x20, 0x01, 0x83, 0xE0, 0x03, 0x00,
-    0xE0, 0x06, 0x00, 0x60, 0x0C, 0x00, 0x60, 0x1C, 0x00, 0x30, 0x18, 0x00, 0x30, 0x38, 0x00, 0x10,
-    0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x10, 0x38, 0x00, 0x10, 0x38, 0x00, 0x20,
-    0x1C, 0x00, 0x20, 0x1C, 0x00, 0x40, 0x0E, 0x00, 0xC0, 0x07, 0x83, 0x80, 0x03, 0xFF, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"C",35*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0E, 0x0C, 0x00, 0x0E, 0x03,
-    0x00, 0x0E, 0x01, 0x80, 0x0E, 0x01, 0xC0, 0x0E, 0x00, 0xC0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
-    0x0E, 0x00, 0x60, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E,
-    0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00,
-    0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x60, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
-    0x0E, 0x00, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x03, 0x80, 0x0E, 0x07, 0x00, 0x0E, 0x1C, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"D",36*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x0E, 0x01, 0xE0, 0x0E, 0x00,
-    0x60, 0x0E, 0x00, 0x20, 0x0E, 0x00, 0x30, 0x0E, 0x00, 0x10, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x03, 0x00, 0x0F,
-    0xFF, 0x00, 0x0E, 0x03, 0x00, 0x0E, 0x03, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01,
-    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x08,
-    0x0E, 0x00, 0x08, 0x0E, 0x00, 0x10, 0x0E, 0x00, 0x30, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0xF0, 0x7F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"E",37*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x0E, 0x01, 0xE0, 0x0E, 0x00,
-    0x70, 0x0E, 0x00, 0x30, 0x0E, 0x00, 0x10, 0x0E, 0x00, 0x18, 0x0E, 0x00, 0x08, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x80, 0x0E,
-    0x01, 0x80, 0x0F, 0xFF, 0x80, 0x0E, 0x01, 0x80, 0x0E, 0x01, 0x80, 0x0E, 0x00, 0x80, 0x0E, 0x00,
-    0x80, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"F",38*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x80, 0x03, 0x87, 0x80, 0x07, 0x03,
-    0x80, 0x0E, 0x01, 0x80, 0x0C, 0x00, 0x80, 0x1C, 0x00, 0xC0, 0x18, 0x00, 0x40, 0x38, 0x00, 0x40,
-    0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x0F, 0xF8, 0x70, 0x03,
-    0xC0, 0x70, 0x01, 0xC0, 0x30, 0x01, 0xC0, 0x38, 0x01, 0xC0, 0x38, 0x01, 0xC0, 0x38, 0x01, 0xC0,
-    0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x0C, 0x01, 0xC0, 0x06, 0x03, 0xC0, 0x03, 0x86, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"G",39*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF8, 0x1C, 0x00, 0xE0, 0x1C, 0x00,
-    0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0,
-    0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C,
-    0x00, 0xE0, 0x1F, 0xFF, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00,
-    0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0,
-    0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x7F,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"H",40*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x38, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"I",41*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0E, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x18, 0x0E, 0x00, 0x3C, 0x0C, 0x00, 0x3C, 0x1C, 0x00, 0x3C, 0x18, 0x00, 0x1C, 0x30,
-    0x00, 0x0F, 0xC0, 0x00, /*"J",42*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC7, 0xF0, 0x0E, 0x01, 0xC0, 0x0E, 0x01,
-    0x80, 0x0E, 0x03, 0x00, 0x0E, 0x02, 0x00, 0x0E, 0x06, 0x00, 0x0E, 0x04, 0x00, 0x0E, 0x08, 0x00,
-    0x0E, 0x18, 0x00, 0x0E, 0x10, 0x00, 0x0E, 0x20, 0x00, 0x0E, 0x20, 0x00, 0x0E, 0x70, 0x00, 0x0E,
-    0xF0, 0x00, 0x0E, 0xB8, 0x00, 0x0F, 0x38, 0x00, 0x0F, 0x1C, 0x00, 0x0E, 0x1C, 0x00, 0x0E, 0x0C,
-    0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x06, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x03, 0x80,
-    0x0E, 0x03, 0x80, 0x0E, 0x01, 0x80, 0x0E, 0x01, 0xC0, 0x0E, 0x00, 0xC0, 0x0E, 0x00, 0xE0, 0x7F,
-    0xC3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"K",43*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x08,
-    0x0E, 0x00, 0x08, 0x0E, 0x00, 0x10, 0x0E, 0x00, 0x30, 0x0E, 0x00, 0x30, 0x0E, 0x00, 0xF0, 0x7F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"L",44*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0xF8, 0x1C, 0x01, 0xE0, 0x1C, 0x01,
-    0xE0, 0x1C, 0x01, 0xE0, 0x1E, 0x01, 0xE0, 0x1E, 0x02, 0xE0, 0x1E, 0x02, 0xE0, 0x1E, 0x02, 0xE0,
-    0x16, 0x02, 0xE0, 0x17, 0x06, 0xE0, 0x17, 0x04, 0xE0, 0x17, 0x04, 0xE0, 0x17, 0x04, 0xE0, 0x13,
-    0x0C, 0xE0, 0x13, 0x88, 0xE0, 0x13, 0x88, 0xE0, 0x13, 0x88, 0xE0, 0x11, 0x88, 0xE0, 0x11, 0x98,
-    0xE0, 0x11, 0xD0, 0xE0, 0x11, 0xD0, 0xE0, 0x11, 0xD0, 0xE0, 0x10, 0xF0, 0xE0, 0x10, 0xF0, 0xE0,
-    0x10, 0xE0, 0xE0, 0x10, 0xE0, 0xE0, 0x10, 0x60, 0xE0, 0x10, 0x60, 0xE0, 0x10, 0x60, 0xE0, 0x7C,
-    0x43, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"M",45*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x1C, 0x00, 0x20, 0x1E, 0x00,
-    0x20, 0x1E, 0x00, 0x20, 0x1F, 0x00, 0x20, 0x17, 0x00, 0x20, 0x17, 0x80, 0x20, 0x13, 0x80, 0x20,
-    0x13, 0xC0, 0x20, 0x11, 0xE0, 0x20, 0x10, 0xE0, 0x20, 0x10, 0xF0, 0x20, 0x10, 0x70, 0x20, 0x10,
-    0x78, 0x20, 0x10, 0x38, 0x20, 0x10, 0x3C, 0x20, 0x10, 0x1C, 0x20, 0x10, 0x1E, 0x20, 0x10, 0x0E,
-    0x20, 0x10, 0x0F, 0x20, 0x10, 0x07, 0x20, 0x10, 0x07, 0xA0, 0x10, 0x03, 0xE0, 0x10, 0x01, 0xE0,
-    0x10, 0x01, 0xE0, 0x10, 0x00, 0xE0, 0x10, 0x00, 0xE0, 0x10, 0x00, 0x60, 0x10, 0x00, 0x60, 0xFE,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"N",46*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0x83, 0x00, 0x03, 0x01,
-    0x80, 0x06, 0x00, 0xC0, 0x0E, 0x00, 0xE0, 0x0C, 0x00, 0x60, 0x1C, 0x00, 0x60, 0x1C, 0x00, 0x70,
-    0x18, 0x00, 0x30, 0x18, 0x00, 0x30, 0x38, 0x00, 0x38, 0x38, 0x00, 0x38, 0x38, 0x00, 0x38, 0x38,
-    0x00, 0x38, 0x38, 0x00, 0x38, 0x38, 0x00, 0x38, 0x38, 0x00, 0x38, 0x38, 0x00, 0x38, 0x38, 0x00,
-    0x38, 0x38, 0x00, 0x38, 0x18, 0x00, 0x30, 0x1C, 0x00, 0x30, 0x1C, 0x00, 0x70, 0x0C, 0x00, 0x70,
-    0x0C, 0x00, 0x60, 0x06, 0x00, 0xE0, 0x06, 0x00, 0xC0, 0x03, 0x01, 0x80, 0x01, 0x83, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"O",47*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x0E, 0x03, 0x80, 0x0E, 0x01,
-    0xC0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x60, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70,
-    0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E,
-    0x01, 0xC0, 0x0E, 0x07, 0x80, 0x0F, 0xFE, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"P",48*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x83, 0x00, 0x06, 0x01,
-    0x80, 0x0E, 0x00, 0xC0, 0x1C, 0x00, 0xE0, 0x18, 0x00, 0x60, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70,
-    0x38, 0x00, 0x30, 0x30, 0x00, 0x30, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70,
-    0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00,
-    0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x31, 0xF0, 0x30, 0x3B, 0xF8, 0x70, 0x3B, 0x1C, 0x70,
-    0x1E, 0x0C, 0x60, 0x1C, 0x0E, 0x60, 0x0E, 0x0E, 0xC0, 0x06, 0x07, 0x80, 0x03, 0x87, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x07, 0x90, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"Q",49*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x0E, 0x07, 0x80, 0x0E, 0x03,
-    0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
-    0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x03, 0x80, 0x0E,
-    0x07, 0x00, 0x0F, 0xFC, 0x00, 0x0E, 0x18, 0x00, 0x0E, 0x1C, 0x00, 0x0E, 0x0C, 0x00, 0x0E, 0x0E,
-    0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x06, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x03, 0x80,
-    0x0E, 0x03, 0x80, 0x0E, 0x01, 0x80, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x00, 0xE0, 0x7F,
-    0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"R",50*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x07, 0x07, 0x80, 0x0C, 0x03,
-    0xC0, 0x1C, 0x01, 0xC0, 0x18, 0x00, 0xC0, 0x38, 0x00, 0xC0, 0x38, 0x00, 0x40, 0x38, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x07,
-    0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03,
-    0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xE0, 0x20, 0x00, 0xE0, 0x20, 0x00, 0xE0, 0x30, 0x00, 0xE0,
-    0x10, 0x00, 0xE0, 0x18, 0x00, 0xC0, 0x18, 0x01, 0xC0, 0x1C, 0x03, 0x80, 0x1F, 0x07, 0x00, 0x10,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"S",51*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x38, 0x70, 0xE0, 0x30, 0x70,
-    0x60, 0x20, 0x70, 0x20, 0x20, 0x70, 0x30, 0x60, 0x70, 0x10, 0x40, 0x70, 0x10, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"T",52*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF8, 0x1C, 0x00, 0x40, 0x1C, 0x00,
-    0x40, 0x1C, 0x00, 0x40, 0x1C, 0x00, 0x40, 0x1C, 0x00, 0x40, 0x1C, 0x00, 0x40, 0x1C, 0x00, 0x40,
-    0x1C, 0x00, 0x40, 0x1C, 0x00, 0x40, 0x1C, 0x00, 0x40, 0x1C, 0x00, 0x40, 0x1C, 0x00, 0x40, 0x1C,
-    0x00, 0x40, 0x1C, 0x00, 0x40, 0x1C, 0x00, 0x40, 0x1C, 0x00, 0x40, 0x1C, 0x00, 0x40, 0x1C, 0x00,
-    0x40, 0x1C, 0x00, 0x40, 0x1C, 0x00, 0x40, 0x1C, 0x00, 0x40, 0x1C, 0x00, 0x40, 0x1C, 0x00, 0x40,
-    0x1C, 0x00, 0x40, 0x1C, 0x00, 0x80, 0x0E, 0x00, 0x80, 0x0E, 0x01, 0x00, 0x03, 0x86, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"U",53*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xF8, 0x1E, 0x00, 0x60, 0x0C, 0x00,
-    0x40, 0x0E, 0x00, 0x40, 0x0E, 0x00, 0xC0, 0x0E, 0x00, 0xC0, 0x0E, 0x00, 0x80, 0x07, 0x00, 0x80,
-    0x07, 0x01, 0x80, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x83, 0x00, 0x03,
-    0x82, 0x00, 0x03, 0x82, 0x00, 0x01, 0x82, 0x00, 0x01, 0xC6, 0x00, 0x01, 0xC4, 0x00, 0x01, 0xC4,
-    0x00, 0x00, 0xC4, 0x00, 0x00, 0xEC, 0x00, 0x00, 0xE8, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x68, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"V",54*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x7C, 0x30, 0x38, 0x30, 0x30, 0x30,
-    0x10, 0x30, 0x38, 0x30, 0x38, 0x38, 0x30, 0x38, 0x38, 0x20, 0x38, 0x38, 0x20, 0x18, 0x38, 0x20,
-    0x18, 0x38, 0x20, 0x18, 0x38, 0x60, 0x18, 0x3C, 0x40, 0x1C, 0x3C, 0x40, 0x1C, 0x7C, 0x40, 0x1C,
-    0x5C, 0x40, 0x0C, 0x4C, 0x40, 0x0C, 0x4C, 0xC0, 0x0C, 0x4C, 0x80, 0x0C, 0xCE, 0x80, 0x0E, 0x8E,
-    0x80, 0x0E, 0x8E, 0x80, 0x06, 0x86, 0x80, 0x06, 0x87, 0x80, 0x07, 0x87, 0x00, 0x07, 0x07, 0x00,
-    0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x03, 0x03, 0x00, 0x02, 0x02, 0x00, 0x02,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"W",55*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x0E, 0x00, 0xC0, 0x0E, 0x00,
-    0x80, 0x06, 0x01, 0x80, 0x07, 0x01, 0x00, 0x07, 0x03, 0x00, 0x03, 0x82, 0x00, 0x03, 0x86, 0x00,
-    0x01, 0xC6, 0x00, 0x01, 0xCC, 0x00, 0x00, 0xEC, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78, 0x00, 0x00, 0x5C, 0x00, 0x00, 0xDC,
-    0x00, 0x00, 0x8E, 0x00, 0x01, 0x8E, 0x00, 0x01, 0x06, 0x00, 0x03, 0x07, 0x00, 0x03, 0x03, 0x00,
-    0x02, 0x03, 0x80, 0x06, 0x03, 0x80, 0x04, 0x01, 0xC0, 0x0C, 0x01, 0xC0, 0x1C, 0x01, 0xE0, 0x7F,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"X",56*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xF8, 0x1C, 0x00, 0xE0, 0x1C, 0x00,
-    0x40, 0x0E, 0x00, 0xC0, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x80, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
-    0x03, 0x03, 0x00, 0x03, 0x82, 0x00, 0x03, 0x82, 0x00, 0x01, 0xC4, 0x00, 0x01, 0xC4, 0x00, 0x01,
-    0xCC, 0x00, 0x00, 0xE8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"Y",57*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x0F, 0x00, 0xE0, 0x0E, 0x00,
-    0xE0, 0x0C, 0x01, 0xC0, 0x18, 0x01, 0xC0, 0x10, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0,
-    0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x10,
-    0x07, 0x00, 0x30, 0x0E, 0x00, 0x20, 0x0E, 0x00, 0x60, 0x1C, 0x00, 0xE0, 0x1C, 0x01, 0xE0, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"Z",58*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00,
-    0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"[",59*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0x00, /*"\",60*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x08, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"]",61*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0x01,
-    0xC6, 0x00, 0x03, 0x03, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"^",62*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, /*"_",63*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"`",64*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x07, 0x07, 0x00, 0x0C, 0x03, 0x80, 0x1C,
-    0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xF9,
-    0xC0, 0x07, 0x81, 0xC0, 0x0E, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x38, 0x01, 0xC0,
-    0x38, 0x01, 0xC0, 0x38, 0x01, 0xC4, 0x38, 0x01, 0xC4, 0x1C, 0x03, 0xC4, 0x0E, 0x0D, 0xC8, 0x07,
-    0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"a",65*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x1F, 0x00, 0x0E, 0x61, 0x80, 0x0E, 0x80, 0xC0, 0x0F,
-    0x00, 0xE0, 0x0F, 0x00, 0xE0, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00,
-    0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70,
-    0x0E, 0x00, 0x60, 0x0E, 0x00, 0xE0, 0x0F, 0x00, 0xC0, 0x0F, 0x01, 0xC0, 0x0C, 0x83, 0x80, 0x08,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"b",66*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xC3, 0x00, 0x03, 0x81, 0x80, 0x07,
-    0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x0E, 0x00, 0x20, 0x0E, 0x00, 0x40, 0x06, 0x00, 0x40, 0x07, 0x00, 0x80, 0x01, 0xC1, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"c",67*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01,
-    0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0,
-    0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0xF9, 0xC0, 0x03, 0x85, 0xC0, 0x07, 0x03, 0xC0, 0x06,
-    0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01,
-    0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0,
-    0x0C, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x03, 0xC0, 0x07, 0x07, 0xC0, 0x03, 0x8D, 0xF8, 0x00,
-    0xF1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"d",68*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0x87, 0x00, 0x03, 0x03, 0x80, 0x06,
-    0x01, 0xC0, 0x0E, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00,
-    0xE0, 0x1F, 0xFF, 0xE0, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x0C, 0x00, 0x40, 0x0E, 0x00, 0x40, 0x06, 0x00, 0x80, 0x07, 0x01, 0x00, 0x03, 0xC3, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"e",69*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x18, 0x30, 0x00, 0x70,
-    0x38, 0x00, 0x60, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"f",70*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x38, 0x03, 0x07, 0xF8, 0x06, 0x03, 0x98, 0x0E,
-    0x03, 0x80, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01,
-    0xC0, 0x0E, 0x01, 0x80, 0x06, 0x03, 0x80, 0x03, 0x07, 0x00, 0x0E, 0xFC, 0x00, 0x1C, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x0E, 0x3F, 0xE0, 0x1C, 0x00, 0xF0, 0x38,
-    0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x1C, 0x00, 0xE0, 0x0F, 0x03,
-    0xC0, 0x01, 0xFE, 0x00, /*"g",71*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x3E, 0x00, 0x0E, 0x43, 0x80, 0x0F, 0x81, 0x80, 0x0F,
-    0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01,
-    0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0,
-    0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x3F,
-    0x87, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"h",72*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"i",73*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x07,
-    0xC0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00,
-    0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
-    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80,
-    0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00,
-    0x03, 0x80, 0x00, 0x03, 0x80, 0x1C, 0x03, 0x00, 0x1C, 0x07, 0x00, 0x1C, 0x06, 0x00, 0x0E, 0x1C,
-    0x00, 0x07, 0xF0, 0x00, /*"j",74*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x07, 0xF0, 0x0E, 0x01, 0x80, 0x0E, 0x03, 0x00, 0x0E,
-    0x06, 0x00, 0x0E, 0x04, 0x00, 0x0E, 0x0C, 0x00, 0x0E, 0x18, 0x00, 0x0E, 0x30, 0x00, 0x0E, 0x78,
-    0x00, 0x0E, 0xDC, 0x00, 0x0F, 0x9C, 0x00, 0x0F, 0x0E, 0x00, 0x0E, 0x06, 0x00, 0x0E, 0x07, 0x00,
-    0x0E, 0x03, 0x80, 0x0E, 0x03, 0x80, 0x0E, 0x01, 0xC0, 0x0E, 0x00, 0xC0, 0x0E, 0x00, 0xE0, 0x3F,
-    0x83, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"k",75*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"l",76*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xF9, 0xF1, 0xE0, 0x3A, 0x3E, 0x30, 0x3C, 0x3C, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xFE,
-    0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"m",77*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x0E, 0x43, 0x80, 0x0E, 0x83, 0x80, 0x0F,
-    0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01,
-    0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0,
-    0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x3F,
-    0x87, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"n",78*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x87, 0x00, 0x07, 0x01, 0x80, 0x0E,
-    0x01, 0xC0, 0x0C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x18, 0x00, 0x60, 0x38, 0x00, 0x70, 0x38, 0x00,
-    0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x18, 0x00, 0x70,
-    0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x0E, 0x00, 0xC0, 0x06, 0x01, 0x80, 0x03, 0x87, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"o",79*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x3E, 0x00, 0x7E, 0x43, 0x80, 0x0E, 0x81, 0xC0, 0x0F,
-    0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x60, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00,
-    0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70,
-    0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0F, 0x00, 0xC0, 0x0F, 0x01, 0xC0, 0x0E, 0xC3, 0x80, 0x0E,
-    0x3E, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, /*"p",80*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x40, 0x03, 0x04, 0xC0, 0x06, 0x03, 0xC0, 0x0C,
-    0x03, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x38, 0x01, 0xC0, 0x38, 0x01, 0xC0, 0x38, 0x01,
-    0xC0, 0x38, 0x01, 0xC0, 0x38, 0x01, 0xC0, 0x38, 0x01, 0xC0, 0x38, 0x01, 0xC0, 0x38, 0x01, 0xC0,
-    0x18, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x03, 0xC0, 0x0E, 0x03, 0xC0, 0x07, 0x0D, 0xC0, 0x01,
-    0xF1, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01,
-    0xC0, 0x00, 0x0F, 0xF8, /*"q",81*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x7F, 0x83, 0xE0, 0x03, 0x8C, 0x70, 0x03, 0x98, 0x70, 0x03,
-    0xB0, 0x70, 0x03, 0xA0, 0x70, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80,
-    0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00,
-    0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"r",82*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xC3, 0xC0, 0x03, 0x81, 0xC0, 0x07,
-    0x00, 0xC0, 0x07, 0x00, 0x40, 0x07, 0x00, 0x40, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x08, 0x01, 0xE0,
-    0x08, 0x00, 0xE0, 0x0C, 0x00, 0xE0, 0x0C, 0x00, 0xE0, 0x0E, 0x01, 0xC0, 0x0F, 0x83, 0x80, 0x08,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"s",83*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0xE0, 0x20, 0x00, 0xE0, 0x20, 0x00, 0x60, 0x40, 0x00, 0x70, 0x80, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"t",84*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x40, 0x7E, 0x0F, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E,
-    0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01,
-    0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0,
-    0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x03, 0xC0, 0x07, 0x03, 0xC0, 0x07, 0x8D, 0xF8, 0x01,
-    0xF1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"u",85*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xF0, 0x0E, 0x00, 0xC0, 0x06, 0x00, 0x80, 0x07,
-    0x00, 0x80, 0x07, 0x01, 0x80, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x83, 0x00, 0x01, 0x82,
-    0x00, 0x01, 0x82, 0x00, 0x01, 0xC6, 0x00, 0x00, 0xC4, 0x00, 0x00, 0xC4, 0x00, 0x00, 0xEC, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x68, 0x00, 0x00, 0x78, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"v",86*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0x38, 0x70, 0x30, 0x38, 0x30, 0x30, 0x38,
-    0x30, 0x20, 0x18, 0x38, 0x20, 0x18, 0x38, 0x60, 0x1C, 0x38, 0x40, 0x1C, 0x78, 0x40, 0x0C, 0x5C,
-    0x40, 0x0C, 0x4C, 0x40, 0x0E, 0xCC, 0x80, 0x0E, 0xCC, 0x80, 0x06, 0x8C, 0x80, 0x07, 0x8E, 0x80,
-    0x07, 0x87, 0x00, 0x07, 0x87, 0x00, 0x03, 0x07, 0x00, 0x03, 0x07, 0x00, 0x03, 0x02, 0x00, 0x03,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"w",87*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xE0, 0x07, 0x81, 0x80, 0x03, 0x81, 0x00, 0x01,
-    0x83, 0x00, 0x01, 0xC2, 0x00, 0x00, 0xC4, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x8E, 0x00,
-    0x01, 0x86, 0x00, 0x01, 0x03, 0x00, 0x03, 0x03, 0x80, 0x06, 0x01, 0x80, 0x0E, 0x01, 0xC0, 0x3F,
-    0x87, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"x",88*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x0E, 0x01, 0xC0, 0x06, 0x01, 0x80, 0x06,
-    0x01, 0x00, 0x07, 0x01, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x03, 0x82, 0x00, 0x01, 0x86,
-    0x00, 0x01, 0x86, 0x00, 0x00, 0xC4, 0x00, 0x00, 0xCC, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x68, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x60, 0x00, 0x00, 0x40, 0x00, 0x1C, 0xC0, 0x00, 0x1F, 0x80,
-    0x00, 0x0F, 0x00, 0x00, /*"y",89*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x0E, 0x01, 0xC0, 0x18, 0x03, 0x80, 0x18,
-    0x07, 0x00, 0x10, 0x07, 0x00, 0x10, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x20,
-    0x03, 0x80, 0x20, 0x07, 0x00, 0x60, 0x07, 0x00, 0x40, 0x0E, 0x00, 0xC0, 0x1C, 0x01, 0xC0, 0x1F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"z",90*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x60, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"{",91*/
-
-    0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x30, 0x00, /*"|",92*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80,
-    0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
-    0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x18, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80,
-    0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
-    0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
-    0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"}",93*/
+    0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x71, 0x8C, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x00, 0x00, 0x00,
+    0x1D, 0xFF, 0xFD, 0xC0, /*"!",1*/
+    0x07, 0x0C, 0x1E, 0x3C, 0x3C, 0x78, 0xF1, 0xE1, 0xC3, 0x87, 0x8F, 0x0E, 0x1C, 0x38, 0x70, 0x60,
+    0xC1, 0x83, 0x02, 0x04, 0x00, /*""",2*/
+    0x52, 0x72, 0x71, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x3F, 0xFF,
+    0xFC, 0x42, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x71, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x4F, 0xFF, 0xFC, 0x32, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x40, /*"#",3*/
+    0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x3F, 0x80, 0xD9, 0x83, 0x31, 0x8C, 0x63, 0xB8, 0xC7, 0x71,
+    0x9E, 0xE3, 0x3D, 0xC6, 0x73, 0xCC, 0x03, 0x98, 0x07, 0xB0, 0x07, 0xE0, 0x07, 0xC0, 0x07, 0xC0,
+    0x07, 0xC0, 0x07, 0xC0, 0x0F, 0xC0, 0x1B, 0xC0, 0x33, 0x80, 0x67, 0x80, 0xC7, 0x71, 0x8F, 0xE3,
+    0x1F, 0xC6, 0x3F, 0x8C, 0x7E, 0x18, 0xCC, 0x31, 0x98, 0x66, 0x1C, 0xD8, 0x0F, 0xE0, 0x03, 0x00,
+    0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, /*"$",4*/
+    0x1C, 0x01, 0x02, 0x20, 0x30, 0x63, 0x02, 0x04, 0x10, 0x60, 0xC1, 0x84, 0x0C, 0x18, 0x40, 0xC1,
+    0x8C, 0x0C, 0x18, 0x80, 0xC1, 0x98, 0x0C, 0x19, 0x00, 0xC1, 0x90, 0x0C, 0x1B, 0x00, 0x41, 0x20,
+    0x06, 0x36, 0x00, 0x23, 0x43, 0x81, 0xC4, 0x44, 0x00, 0x8C, 0x60, 0x08, 0x82, 0x01, 0x98, 0x30,
+    0x11, 0x83, 0x01, 0x18, 0x30, 0x21, 0x83, 0x02, 0x18, 0x30, 0x61, 0x83, 0x04, 0x18, 0x30, 0x41,
+    0x83, 0x08, 0x08, 0x20, 0x80, 0xC6, 0x18, 0x04, 0x41, 0x00, 0x38, /*"%",5*/
+    0x65, 0xE2, 0x23, 0xC2, 0x42, 0xB3, 0x43, 0xA3, 0x43, 0xA3, 0x43, 0xA3, 0x43, 0xA3, 0x43, 0xA3,
+    0x42, 0xB3, 0x33, 0xB4, 0x22, 0xD3, 0x12, 0xE5, 0xF0, 0x44, 0x74, 0x56, 0x35, 0x21, 0x36, 0x26,
+    0x21, 0x45, 0x25, 0x23, 0x35, 0x25, 0x23, 0x35, 0x24, 0x34, 0x34, 0x15, 0x34, 0x34, 0x15, 0x35,
+    0x32, 0x25, 0x35, 0x41, 0x16, 0x36, 0x31, 0x16, 0x36, 0x48, 0x36, 0x45, 0x11, 0x36, 0x44, 0x22,
+    0x43, 0x21, 0x33, 0x14, 0x73, 0x65, 0x55, 0x42, /*"&",6*/
+    0x39, 0xF7, 0xDF, 0x3C, 0x71, 0x86, 0x31, 0x8C, 0x00, /*"'",7*/
+    0x91, 0x81, 0x82, 0x72, 0x72, 0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x82, 0x81, 0x82,
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x91, 0x92, 0x82, 0x82, 0x92, 0x82, 0x92, 0x82,
+    0x92, 0x82, 0x92, 0x92, 0x92, 0x91, 0xA1, /*"(",8*/
+    0x01, 0xA1, 0x92, 0x92, 0x92, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82, 0x82, 0x91, 0x92,
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x72, 0x82, 0x72, 0x82,
+    0x72, 0x82, 0x72, 0x72, 0x72, 0x81, 0x81, 0x90, /*")",9*/
+    0x92, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0x83, 0x53, 0x57, 0x51, 0x5A, 0x31, 0x36, 0x25, 0x21,
+    0x25, 0x73, 0x11, 0x13, 0xD3, 0xF1, 0x3D, 0x31, 0x11, 0x37, 0x52, 0x12, 0x52, 0x63, 0x13, 0xA5,
+    0x15, 0x75, 0x35, 0x38, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x38, /*"*",10*/
+    0x92, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x29, 0xFF,
+    0xA9, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0x90, /*"+",11*/
+    0x39, 0xF7, 0xDF, 0x3C, 0x71, 0x86, 0x31, 0x8C, 0x00, /*",",12*/
+    0x0F, 0xF8, /*"-",13*/
+    0x77, 0xFF, 0xF7, 0x00, /*".",14*/
+    0xF2, 0x1F, 0x12, 0xF1, 0x1F, 0x12, 0xF1, 0x1F, 0x12, 0xF1, 0x1F, 0x12, 0xF1, 0x1F, 0x21, 0xF1,
+    0x1F, 0x21, 0xF1, 0x1F, 0x21, 0xF1, 0x2F, 0x11, 0xF1, 0x2F, 0x11, 0xF1, 0x2F, 0x11, 0xF1, 0x2F,
+    0x11, 0xF1, 0x2F, 0x11, 0xF2, 0x1F, 0x11, 0xF2, 0x1F, 0x11, 0xF2, 0x1F, 0x12, 0xF1, 0x1F, 0x12,
+    0xF1, 0x1F, 0x12, 0xF1, 0x1F, 0x12, 0xF1, 0x1F, 0x20, /*"/",15*/
+    0x66, 0xB2, 0x42, 0x92, 0x62, 0x72, 0x82, 0x53, 0x83, 0x42, 0xA2, 0x33, 0xA3, 0x23, 0xA3, 0x23,
+    0xB2, 0x13, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC3, 0x13, 0xB2,
+    0x23, 0xA3, 0x23, 0xA3, 0x32, 0xA2, 0x43, 0x83, 0x52, 0x82, 0x72, 0x62, 0x92, 0x42, 0xC5, 0x60, /*"0",16*/
+    0x71, 0xB2, 0xA3, 0x58, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+    0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0x95, 0x4D, /*"1",17*/
+    0x66, 0x92, 0x53, 0x61, 0x83, 0x41, 0xA3, 0x31, 0xB3, 0x12, 0xB3, 0x12, 0xB3, 0x13, 0xA3, 0x13,
+    0xA3, 0x22, 0xA3, 0xD3, 0xE3, 0xD3, 0xE3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+    0xA1, 0x32, 0xB1, 0x22, 0xB2, 0x12, 0xC4, 0xC2, 0x1F, 0x11, 0xF1, 0x1F, 0x11, /*"2",18*/
+    0x56, 0x82, 0x43, 0x62, 0x72, 0x42, 0x83, 0x32, 0x93, 0x23, 0x83, 0x23, 0x83, 0x32, 0x83, 0xD3,
+    0xD2, 0xD3, 0xC3, 0xC3, 0xA4, 0xF0, 0x3F, 0x03, 0xE2, 0xE3, 0xE2, 0xE3, 0xD3, 0xD3, 0x12, 0xA6,
+    0xA6, 0xA2, 0x13, 0x93, 0x21, 0xA2, 0x32, 0x83, 0x42, 0x54, 0x77, 0x50, /*"3",19*/
+    0xC2, 0xF1, 0x3F, 0x13, 0xF0, 0x4E, 0x11, 0x3E, 0x11, 0x3D, 0x12, 0x3D, 0x12, 0x3C, 0x13, 0x3B,
+    0x23, 0x3B, 0x14, 0x3A, 0x15, 0x3A, 0x15, 0x39, 0x16, 0x38, 0x26, 0x38, 0x17, 0x37, 0x27, 0x37,
+    0x18, 0x36, 0x19, 0x35, 0x29, 0x35, 0xF4, 0xB3, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F,
+    0x13, 0xF0, 0x5B, 0xB1, /*"4",20*/
+    0x2E, 0x2E, 0x2E, 0x21, 0xF0, 0x1F, 0x01, 0xF0, 0x1E, 0x2E, 0x2E, 0x2E, 0x23, 0x56, 0x21, 0x94,
+    0x11, 0x25, 0x43, 0x11, 0x17, 0x42, 0x29, 0x32, 0x29, 0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x31, 0x2A,
+    0x6A, 0x6A, 0x69, 0x31, 0x2A, 0x32, 0x1A, 0x24, 0x18, 0x35, 0x16, 0x37, 0x75, /*"5",21*/
+    0x85, 0xB2, 0x52, 0x72, 0x72, 0x62, 0x83, 0x52, 0x83, 0x42, 0x93, 0x42, 0xF0, 0x3F, 0x02, 0xF1,
+    0x2F, 0x03, 0xF0, 0x34, 0x65, 0x32, 0xA3, 0x31, 0x35, 0x42, 0x31, 0x27, 0x41, 0x59, 0x31, 0x4A,
+    0x31, 0x3C, 0x6C, 0x6C, 0x6C, 0x6C, 0x31, 0x2C, 0x31, 0x3B, 0x31, 0x3B, 0x23, 0x2A, 0x33, 0x39,
+    0x25, 0x37, 0x27, 0x35, 0x2A, 0x66, /*"6",22*/
+    0x1F, 0x01, 0xF0, 0x1E, 0x22, 0xA2, 0x21, 0xB1, 0x22, 0xA1, 0x31, 0xB1, 0x31, 0xA1, 0xF0, 0x1E,
+    0x1F, 0x01, 0xE2, 0xE1, 0xF0, 0x1E, 0x1F, 0x01, 0xE2, 0xE2, 0xE1, 0xE2, 0xE2, 0xE2, 0xE2, 0xD3,
+    0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xE2, 0x80, /*"7",23*/
+    0x66, 0x93, 0x43, 0x62, 0x82, 0x43, 0x83, 0x23, 0xA3, 0x13, 0xA3, 0x13, 0xA3, 0x13, 0xA3, 0x14,
+    0x93, 0x14, 0x92, 0x34, 0x73, 0x35, 0x62, 0x56, 0x32, 0x88, 0x97, 0x83, 0x26, 0x53, 0x55, 0x42,
+    0x74, 0x33, 0x84, 0x13, 0xA7, 0xA7, 0xB6, 0xB6, 0xB6, 0xB3, 0x12, 0xB2, 0x23, 0x93, 0x33, 0x82,
+    0x53, 0x53, 0x87, 0x50, /*"8",24*/
+    0x66, 0xA2, 0x53, 0x72, 0x82, 0x52, 0xA2, 0x33, 0xA2, 0x32, 0xB3, 0x13, 0xC2, 0x13, 0xC2, 0x13,
+    0xC6, 0xC6, 0xC6, 0xC6, 0xB8, 0xA4, 0x13, 0x95, 0x14, 0x72, 0x13, 0x24, 0x52, 0x23, 0x39, 0x33,
+    0x56, 0x43, 0xE3, 0xF0, 0x3F, 0x03, 0xF0, 0x3E, 0x34, 0x38, 0x34, 0x38, 0x25, 0x37, 0x26, 0x36,
+    0x37, 0x25, 0x2B, 0x58, /*"9",25*/
+    0x13, 0x1F, 0x01, 0x3F, 0xFF, 0xC3, 0x1F, 0x01, 0x31, /*":",26*/
+    0x0F, 0x1F, 0xFF, 0x3F, 0x12, 0x21, 0x22, 0x22, 0x12, 0x22, /*";",27*/
+    0xE1, 0xF0, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+    0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
+    0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2E, 0x11, /*"<",28*/
+    0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x80, /*"=",29*/
+    0x11, 0xE2, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
+    0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2,
+    0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xF0, 0x1E, /*">",30*/
+    0x67, 0x9B, 0x63, 0x64, 0x42, 0xA3, 0x22, 0xB3, 0x12, 0xD5, 0xD6, 0xC7, 0xB7, 0xB3, 0x13, 0xB3,
+    0xE3, 0xE3, 0xE3, 0xD3, 0xE3, 0xE3, 0xF0, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0xFF, 0xF9,
+    0x3E, 0x5D, 0x5D, 0x5E, 0x38, /*"?",31*/
+    0x00, 0xF8, 0x00, 0x60, 0xC0, 0x38, 0x0C, 0x06, 0x00, 0xC1, 0x80, 0x0C, 0x60, 0x6D, 0x8C, 0x1B,
+    0xB3, 0x86, 0x73, 0x71, 0xCC, 0x6C, 0x31, 0x8F, 0x8E, 0x31, 0xF1, 0xC6, 0x3E, 0x30, 0xC7, 0xCE,
+    0x18, 0xF9, 0xC3, 0x1F, 0x38, 0x43, 0xE7, 0x18, 0x7C, 0xE3, 0x1B, 0x9C, 0x63, 0x73, 0x8C, 0x66,
+    0x73, 0x98, 0xE7, 0xBE, 0x1C, 0x63, 0x81, 0x80, 0x01, 0x38, 0x00, 0x43, 0x80, 0x18, 0x70, 0x06,
+    0x07, 0x83, 0x80, 0x7F, 0xE0, 0x03, 0xF0, 0x00, /*"@",32*/
+    0x93, 0xF3, 0x3F, 0x33, 0xF2, 0x5F, 0x15, 0xF1, 0x12, 0x2F, 0x11, 0x22, 0xF0, 0x22, 0x3E, 0x22,
+    0x3E, 0x14, 0x2E, 0x14, 0x2D, 0x24, 0x3C, 0x24, 0x3C, 0x16, 0x2C, 0x16, 0x2B, 0x26, 0x3A, 0x26,
+    0x3A, 0x17, 0x3A, 0xB9, 0x28, 0x38, 0x28, 0x38, 0x19, 0x38, 0x1A, 0x27, 0x2A, 0x36, 0x2A, 0x36,
+    0x1B, 0x36, 0x1B, 0x35, 0x2C, 0x34, 0x3A, 0x42, 0x68, 0x70, /*"A",33*/
+    0x0E, 0x83, 0x64, 0x63, 0x83, 0x53, 0x83, 0x53, 0x93, 0x43, 0x93, 0x43, 0x93, 0x43, 0x93, 0x43,
+    0x93, 0x43, 0x93, 0x43, 0x83, 0x53, 0x73, 0x63, 0x63, 0x7A, 0x93, 0x72, 0x73, 0x83, 0x53, 0x92,
+    0x53, 0x93, 0x43, 0xA2, 0x43, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3,
+    0x33, 0x93, 0x43, 0x93, 0x43, 0x83, 0x53, 0x73, 0x3E, 0x50, /*"B",34*/
+    0x86, 0x31, 0x72, 0x55, 0x62, 0x83, 0x52, 0xA2, 0x42, 0xB2, 0x33, 0xC2, 0x22, 0xD2, 0x13, 0xE1,
+    0x13, 0xF1, 0x2F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13,
+    0xF1, 0x3F, 0x13, 0xF2, 0x3E, 0x11, 0x3E, 0x11, 0x3D, 0x13, 0x3C, 0x13, 0x3B, 0x15, 0x39, 0x26,
+    0x45, 0x38, 0xAB, 0x66, /*"C",35*/
+    0x0B, 0xB3, 0x52, 0x93, 0x72, 0x73, 0x82, 0x63, 0x83, 0x53, 0x92, 0x53, 0x93, 0x43, 0x93, 0x43,
+    0xA2, 0x43, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33,
+    0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA2, 0x43, 0x93, 0x43, 0x93, 0x43, 0x93, 0x43,
+    0x92, 0x53, 0x83, 0x53, 0x73, 0x63, 0x63, 0x73, 0x43, 0x6B, 0x80, /*"D",36*/
+    0x1F, 0x16, 0x38, 0x45, 0x3A, 0x25, 0x3B, 0x15, 0x3B, 0x24, 0x3C, 0x14, 0x3F, 0x23, 0xF2, 0x3F,
+    0x23, 0x81, 0x83, 0x81, 0x83, 0x81, 0x83, 0x72, 0x8C, 0x83, 0x72, 0x83, 0x72, 0x83, 0x81, 0x83,
+    0x81, 0x83, 0x81, 0x83, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xD1, 0x33, 0xD1, 0x33, 0xC1, 0x43,
+    0xB2, 0x43, 0xA3, 0x43, 0x94, 0x1F, 0x32, /*"E",37*/
+    0x0F, 0x35, 0x38, 0x45, 0x3A, 0x34, 0x3B, 0x24, 0x3C, 0x14, 0x3C, 0x23, 0x3D, 0x13, 0x3F, 0x23,
+    0xF2, 0x3F, 0x23, 0x91, 0x73, 0x91, 0x73, 0x91, 0x73, 0x82, 0x7D, 0x73, 0x82, 0x73, 0x82, 0x73,
+    0x91, 0x73, 0x91, 0x73, 0x91, 0x73, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2,
+    0x3F, 0x23, 0xE9, 0xB0, /*"F",38*/
+    0x75, 0x31, 0x93, 0x44, 0x83, 0x63, 0x73, 0x82, 0x72, 0xA1, 0x63, 0xA2, 0x52, 0xC1, 0x43, 0xC1,
+    0x43, 0xF2, 0x2F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x38, 0xCA,
+    0x43, 0x3B, 0x34, 0x2B, 0x34, 0x3A, 0x34, 0x3A, 0x34, 0x3A, 0x35, 0x39, 0x35, 0x39, 0x36, 0x29,
+    0x37, 0x27, 0x48, 0x34, 0x2D, 0x67, /*"G",39*/
+    0x07, 0x67, 0x23, 0xA3, 0x43, 0xA3, 0x43, 0xA3, 0x43, 0xA3, 0x43, 0xA3, 0x43, 0xA3, 0x43, 0xA3,
+    0x43, 0xA3, 0x43, 0xA3, 0x43, 0xA3, 0x43, 0xA3, 0x43, 0xA3, 0x43, 0xA3, 0x4F, 0x14, 0x3A, 0x34,
+    0x3A, 0x34, 0x3A, 0x34, 0x3A, 0x34, 0x3A, 0x34, 0x3A, 0x34, 0x3A, 0x34, 0x3A, 0x34, 0x3A, 0x34,
+    0x3A, 0x34, 0x3A, 0x34, 0x3A, 0x34, 0x3A, 0x34, 0x3A, 0x32, 0x76, 0x70, /*"H",40*/
+    0x0F, 0x06, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x36, 0xF0, /*"I",41*/
+    0x4F, 0x0A, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13,
+    0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1,
+    0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x37, 0x27, 0x36, 0x46,
+    0x27, 0x45, 0x37, 0x45, 0x29, 0x34, 0x2B, 0x6B, /*"J",42*/
+    0x09, 0x37, 0x43, 0x83, 0x63, 0x82, 0x73, 0x72, 0x83, 0x71, 0x93, 0x62, 0x93, 0x61, 0xA3, 0x51,
+    0xB3, 0x42, 0xB3, 0x41, 0xC3, 0x31, 0xD3, 0x31, 0xD3, 0x23, 0xC3, 0x14, 0xC3, 0x11, 0x13, 0xB4,
+    0x23, 0xB4, 0x33, 0xA3, 0x43, 0xA3, 0x52, 0xA3, 0x53, 0x93, 0x62, 0x93, 0x63, 0x83, 0x63, 0x83,
+    0x73, 0x73, 0x73, 0x73, 0x82, 0x73, 0x83, 0x63, 0x92, 0x63, 0x93, 0x29, 0x47, /*"K",43*/
+    0x09, 0xE3, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F,
+    0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23,
+    0xF2, 0x3F, 0x23, 0xD1, 0x33, 0xD1, 0x33, 0xC1, 0x43, 0xB2, 0x43, 0xB2, 0x43, 0x94, 0x1F, 0x41, /*"L",44*/
+    0xF8, 0x03, 0xF3, 0x80, 0x3C, 0x38, 0x03, 0xC3, 0x80, 0x3C, 0x3C, 0x03, 0xC3, 0xC0, 0x5C, 0x3C,
+    0x05, 0xC3, 0xC0, 0x5C, 0x2C, 0x05, 0xC2, 0xE0, 0xDC, 0x2E, 0x09, 0xC2, 0xE0, 0x9C, 0x2E, 0x09,
+    0xC2, 0x61, 0x9C, 0x27, 0x11, 0xC2, 0x71, 0x1C, 0x27, 0x11, 0xC2, 0x31, 0x1C, 0x23, 0x31, 0xC2,
+    0x3A, 0x1C, 0x23, 0xA1, 0xC2, 0x3A, 0x1C, 0x21, 0xE1, 0xC2, 0x1E, 0x1C, 0x21, 0xC1, 0xC2, 0x1C,
+    0x1C, 0x20, 0xC1, 0xC2, 0x0C, 0x1C, 0x20, 0xC1, 0xCF, 0x88, 0x7F, /*"M",45*/
+    0x06, 0x97, 0x33, 0xC1, 0x64, 0xB1, 0x64, 0xB1, 0x65, 0xA1, 0x61, 0x13, 0xA1, 0x61, 0x14, 0x91,
+    0x61, 0x23, 0x91, 0x61, 0x24, 0x81, 0x61, 0x34, 0x71, 0x61, 0x43, 0x71, 0x61, 0x44, 0x61, 0x61,
+    0x53, 0x61, 0x61, 0x54, 0x51, 0x61, 0x63, 0x51, 0x61, 0x64, 0x41, 0x61, 0x73, 0x41, 0x61, 0x74,
+    0x31, 0x61, 0x83, 0x31, 0x61, 0x84, 0x21, 0x61, 0x93, 0x21, 0x61, 0x94, 0x11, 0x61, 0xA5, 0x61,
+    0xB4, 0x61, 0xB4, 0x61, 0xC3, 0x61, 0xC3, 0x61, 0xD2, 0x61, 0xD2, 0x37, 0xB1, 0x30, /*"N",46*/
+    0x75, 0xC2, 0x52, 0x92, 0x72, 0x72, 0x92, 0x53, 0x93, 0x42, 0xB2, 0x33, 0xB2, 0x33, 0xB3, 0x22,
+    0xD2, 0x22, 0xD2, 0x13, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD3, 0x12, 0xD2,
+    0x23, 0xC2, 0x23, 0xB3, 0x32, 0xB3, 0x32, 0xB2, 0x52, 0x93, 0x52, 0x92, 0x72, 0x72, 0x92, 0x52,
+    0xC5, 0x70, /*"O",47*/
+    0x0E, 0x83, 0x73, 0x63, 0x83, 0x53, 0x93, 0x43, 0xA2, 0x43, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33,
+    0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0x93, 0x43, 0x93, 0x43, 0x83, 0x53, 0x64, 0x6B, 0x83, 0xF1,
+    0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F,
+    0x13, 0xD9, 0xA0, /*"P",48*/
+    0x76, 0xC3, 0x52, 0x92, 0x82, 0x73, 0x92, 0x53, 0xA3, 0x42, 0xC2, 0x33, 0xC3, 0x23, 0xC3, 0x23,
+    0xD2, 0x22, 0xE2, 0x13, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE3, 0x12,
+    0x35, 0x62, 0x23, 0x17, 0x43, 0x23, 0x12, 0x33, 0x33, 0x34, 0x52, 0x32, 0x43, 0x63, 0x22, 0x53,
+    0x53, 0x12, 0x72, 0x64, 0x93, 0x43, 0xC8, 0xF2, 0x42, 0x1E, 0x6E, 0x5F, 0x13, 0x30, /*"Q",49*/
+    0x0E, 0x93, 0x64, 0x73, 0x74, 0x63, 0x83, 0x63, 0x93, 0x53, 0x93, 0x53, 0x93, 0x53, 0x93, 0x53,
+    0x93, 0x53, 0x93, 0x53, 0x92, 0x63, 0x83, 0x63, 0x73, 0x73, 0x63, 0x8A, 0xA3, 0x42, 0xB3, 0x43,
+    0xA3, 0x52, 0xA3, 0x53, 0x93, 0x53, 0x93, 0x62, 0x93, 0x63, 0x83, 0x63, 0x83, 0x73, 0x73, 0x73,
+    0x73, 0x82, 0x73, 0x83, 0x63, 0x83, 0x63, 0x93, 0x29, 0x65, /*"R",50*/
+    0x57, 0x83, 0x54, 0x42, 0x84, 0x23, 0x93, 0x22, 0xB2, 0x13, 0xB2, 0x13, 0xC1, 0x13, 0xE3, 0xE4,
+    0xE4, 0xD6, 0xC7, 0xB8, 0xB7, 0xC7, 0xC6, 0xD5, 0xD4, 0xE4, 0xE4, 0xD4, 0xD5, 0xC3, 0x11, 0xC3,
+    0x12, 0xB2, 0x22, 0xA3, 0x23, 0x83, 0x35, 0x53, 0x41, 0x46, 0x50, /*"S",51*/
+    0x1F, 0x22, 0x34, 0x34, 0x32, 0x25, 0x35, 0x22, 0x16, 0x36, 0x12, 0x16, 0x36, 0x46, 0x37, 0x27,
+    0x37, 0x18, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13,
+    0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1,
+    0x3F, 0x13, 0xD9, 0x50, /*"T",52*/
+    0x07, 0x67, 0x23, 0xB1, 0x53, 0xB1, 0x53, 0xB1, 0x53, 0xB1, 0x53, 0xB1, 0x53, 0xB1, 0x53, 0xB1,
+    0x53, 0xB1, 0x53, 0xB1, 0x53, 0xB1, 0x53, 0xB1, 0x53, 0xB1, 0x53, 0xB1, 0x53, 0xB1, 0x53, 0xB1,
+    0x53, 0xB1, 0x53, 0xB1, 0x53, 0xB1, 0x53, 0xB1, 0x53, 0xB1, 0x53, 0xB1, 0x53, 0xB1, 0x53, 0xB1,
+    0x53, 0xB1, 0x53, 0xA1, 0x73, 0x91, 0x73, 0x81, 0xA3, 0x42, 0xD5, 0x80, /*"U",53*/
+    0x07, 0x76, 0x24, 0xA2, 0x52, 0xB1, 0x63, 0xA1, 0x63, 0x92, 0x63, 0x92, 0x63, 0x91, 0x83, 0x81,
+    0x83, 0x72, 0x83, 0x71, 0x93, 0x71, 0xA2, 0x71, 0xA3, 0x52, 0xA3, 0x51, 0xB3, 0x51, 0xC2, 0x51,
+    0xC3, 0x32, 0xC3, 0x31, 0xD3, 0x31, 0xE2, 0x31, 0xE3, 0x12, 0xE3, 0x11, 0xF0, 0x31, 0x1F, 0x12,
+    0x11, 0xF1, 0x4F, 0x13, 0xF2, 0x3F, 0x23, 0xF3, 0x1F, 0x41, 0xA0, /*"V",54*/
+    0xFC, 0xFC, 0x7C, 0xC0, 0xE0, 0xC3, 0x03, 0x01, 0x0C, 0x0E, 0x0C, 0x38, 0x38, 0x30, 0xE0, 0xE0,
+    0x83, 0x83, 0x82, 0x06, 0x0E, 0x08, 0x18, 0x38, 0x20, 0x60, 0xE1, 0x81, 0x83, 0xC4, 0x07, 0x0F,
+    0x10, 0x1C, 0x7C, 0x40, 0x71, 0x71, 0x00, 0xC4, 0xC4, 0x03, 0x13, 0x30, 0x0C, 0x4C, 0x80, 0x33,
+    0x3A, 0x00, 0xE8, 0xE8, 0x03, 0xA3, 0xA0, 0x06, 0x86, 0x80, 0x1A, 0x1E, 0x00, 0x78, 0x70, 0x01,
+    0xC1, 0xC0, 0x07, 0x07, 0x00, 0x1C, 0x1C, 0x00, 0x70, 0x70, 0x00, 0xC0, 0xC0, 0x02, 0x02, 0x00,
+    0x08, 0x08, 0x00, /*"W",55*/
+    0x17, 0x47, 0x43, 0x92, 0x63, 0x91, 0x82, 0x82, 0x83, 0x71, 0x93, 0x62, 0xA3, 0x51, 0xB3, 0x42,
+    0xC3, 0x32, 0xC3, 0x22, 0xE3, 0x12, 0xE3, 0x11, 0xF1, 0x4F, 0x13, 0xF3, 0x2F, 0x33, 0xF1, 0x4F,
+    0x11, 0x13, 0xE2, 0x13, 0xE1, 0x33, 0xC2, 0x33, 0xC1, 0x52, 0xB2, 0x53, 0xA2, 0x62, 0xA1, 0x73,
+    0x82, 0x73, 0x81, 0x93, 0x62, 0x93, 0x53, 0x94, 0x27, 0x67, /*"X",56*/
+    0x08, 0x57, 0x23, 0xA3, 0x43, 0xB1, 0x63, 0x92, 0x63, 0x91, 0x73, 0x91, 0x83, 0x71, 0x93, 0x71,
+    0xA2, 0x62, 0xA3, 0x51, 0xB3, 0x51, 0xC3, 0x31, 0xD3, 0x31, 0xD3, 0x22, 0xE3, 0x11, 0xF0, 0x5F,
+    0x04, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23,
+    0xF2, 0x3F, 0x23, 0xE9, 0x60, /*"Y",57*/
+    0x3F, 0x02, 0x48, 0x33, 0x39, 0x33, 0x29, 0x33, 0x2A, 0x33, 0x1A, 0x3F, 0x03, 0xE3, 0xF0, 0x3E,
+    0x3F, 0x03, 0xE3, 0xF0, 0x3E, 0x3F, 0x03, 0xE3, 0xF0, 0x3E, 0x3F, 0x03, 0xE3, 0xF0, 0x3E, 0x3F,
+    0x03, 0xE3, 0xB1, 0x33, 0xA2, 0x23, 0xB1, 0x33, 0xA2, 0x23, 0xA3, 0x23, 0x94, 0x1F, 0x12, /*"Z",58*/
+    0x0F, 0x69, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0xF5, /*"[",59*/
+    0x02, 0xF1, 0x2F, 0x02, 0xF1, 0x2F, 0x02, 0xF0, 0x2F, 0x12, 0xF0, 0x2F, 0x12, 0xF0, 0x2F, 0x02,
+    0xF1, 0x2F, 0x02, 0xF1, 0x2F, 0x02, 0xF0, 0x2F, 0x12, 0xF0, 0x2F, 0x12, 0xF0, 0x2F, 0x02, 0xF1,
+    0x2F, 0x02, 0xF1, 0x2F, 0x02, 0xF0, 0x2F, 0x12, 0xF0, 0x2F, 0x12, 0xF0, 0x2F, 0x02, 0xF1, 0x2F,
+    0x02, 0xF1, 0x2F, 0x02, 0xF0, 0x2F, 0x12, /*"\",60*/
+    0x0F, 0x59, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0xF6, /*"]",61*/
+    0x0F, 0x81, 0xF8, 0x38, 0xC6, 0x06, 0x80, 0x10, /*"^",62*/
+    0x0F, 0x70, /*"_",63*/
+    0x06, 0x64, 0x73, 0x91, /*"`",64*/
+    0x58, 0xA3, 0x53, 0x82, 0x83, 0x63, 0x93, 0x53, 0x93, 0x53, 0x93, 0xF2, 0x3E, 0x6A, 0x52, 0x37,
+    0x46, 0x36, 0x38, 0x35, 0x39, 0x35, 0x39, 0x34, 0x3A, 0x34, 0x3A, 0x34, 0x3A, 0x33, 0x4A, 0x33,
+    0x11, 0x38, 0x43, 0x12, 0x35, 0x21, 0x32, 0x14, 0x74, 0x42, /*"a",65*/
+    0x51, 0xD6, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F,
+    0x13, 0x45, 0x73, 0x22, 0x42, 0x63, 0x11, 0x72, 0x54, 0x83, 0x44, 0x83, 0x43, 0xA3, 0x33, 0xA3,
+    0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA2,
+    0x43, 0x93, 0x44, 0x82, 0x54, 0x73, 0x52, 0x21, 0x53, 0x61, 0x46, 0x50, /*"b",66*/
+    0x66, 0x83, 0x42, 0x63, 0x62, 0x43, 0x73, 0x23, 0x83, 0x23, 0x83, 0x13, 0x93, 0x13, 0xD3, 0xD3,
+    0xD3, 0xD3, 0xD3, 0xD3, 0xE3, 0xB1, 0x13, 0xA1, 0x32, 0xA1, 0x33, 0x81, 0x63, 0x51, 0x87, 0x40, /*"c",67*/
+    0xE1, 0xC6, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x38,
+    0x52, 0x36, 0x34, 0x11, 0x35, 0x36, 0x45, 0x28, 0x34, 0x38, 0x34, 0x38, 0x33, 0x39, 0x33, 0x39,
+    0x33, 0x39, 0x33, 0x39, 0x33, 0x39, 0x33, 0x39, 0x33, 0x39, 0x33, 0x39, 0x34, 0x29, 0x34, 0x38,
+    0x34, 0x37, 0x45, 0x35, 0x56, 0x33, 0x21, 0x65, 0x43, 0x24, /*"d",68*/
+    0x65, 0x92, 0x43, 0x62, 0x63, 0x42, 0x83, 0x23, 0x92, 0x22, 0xA2, 0x13, 0xA6, 0xA6, 0xAF, 0x7D,
+    0x3D, 0x3D, 0x3E, 0x2B, 0x12, 0x3A, 0x13, 0x29, 0x14, 0x37, 0x16, 0x44, 0x28, 0x65, /*"e",69*/
+    0x97, 0xA2, 0x52, 0x73, 0x63, 0x62, 0x73, 0x53, 0x73, 0x53, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03,
+    0xAF, 0x08, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03,
+    0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xBD, 0x40, /*"f",70*/
+    0x57, 0x43, 0x42, 0x58, 0x32, 0x73, 0x22, 0x23, 0x73, 0x53, 0x93, 0x43, 0x93, 0x43, 0x93, 0x43,
+    0x93, 0x43, 0x93, 0x53, 0x82, 0x72, 0x73, 0x82, 0x53, 0x73, 0x16, 0x83, 0xF1, 0x3F, 0x19, 0xCC,
+    0x63, 0x39, 0x33, 0xA4, 0x13, 0xC3, 0x13, 0xC3, 0x13, 0xC3, 0x13, 0xC3, 0x23, 0xA3, 0x44, 0x64,
+    0x88, 0x60, /*"g",71*/
+    0x41, 0xD5, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F,
+    0x03, 0x35, 0x73, 0x21, 0x43, 0x55, 0x62, 0x54, 0x73, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43,
+    0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43,
+    0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x27, 0x47, /*"h",72*/
+    0x53, 0x95, 0x85, 0x93, 0xFF, 0xFF, 0xF1, 0x25, 0x8A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+    0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x35, 0xD0, /*"i",73*/
+    0xB3, 0xB5, 0xA5, 0xB3, 0xFF, 0xFF, 0xFD, 0x27, 0x8C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x31, 0x38, 0x22, 0x37,
+    0x32, 0x37, 0x24, 0x34, 0x36, 0x76, /*"j",74*/
+    0x51, 0xE6, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F,
+    0x23, 0x67, 0x43, 0x82, 0x73, 0x72, 0x83, 0x62, 0x93, 0x61, 0xA3, 0x52, 0xA3, 0x42, 0xB3, 0x32,
+    0xC3, 0x24, 0xB3, 0x12, 0x13, 0xA5, 0x23, 0xA4, 0x43, 0x93, 0x62, 0x93, 0x63, 0x83, 0x73, 0x73,
+    0x73, 0x73, 0x83, 0x63, 0x92, 0x63, 0x93, 0x37, 0x57, /*"k",75*/
+    0x72, 0x78, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x6F, 0x00, /*"l",76*/
+    0x08, 0x00, 0x03, 0xE7, 0xC7, 0x83, 0xA3, 0xE3, 0x0F, 0x0F, 0x0E, 0x38, 0x38, 0x38, 0xE0, 0xE0,
+    0xE3, 0x83, 0x83, 0x8E, 0x0E, 0x0E, 0x38, 0x38, 0x38, 0xE0, 0xE0, 0xE3, 0x83, 0x83, 0x8E, 0x0E,
+    0x0E, 0x38, 0x38, 0x38, 0xE0, 0xE0, 0xE3, 0x83, 0x83, 0x8E, 0x0E, 0x0E, 0x38, 0x38, 0x38, 0xE0,
+    0xE0, 0xE3, 0x83, 0x83, 0x8E, 0x0E, 0x0E, 0xFE, 0xFE, 0xFC, /*"m",77*/
+    0x41, 0xD5, 0x35, 0x73, 0x21, 0x43, 0x53, 0x11, 0x53, 0x54, 0x73, 0x43, 0x83, 0x43, 0x83, 0x43,
+    0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43,
+    0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x27, 0x47, /*"n",78*/
+    0x66, 0xA3, 0x43, 0x73, 0x72, 0x53, 0x83, 0x42, 0xA3, 0x23, 0xA3, 0x22, 0xC2, 0x13, 0xC6, 0xC6,
+    0xC6, 0xC6, 0xC6, 0xC3, 0x12, 0xC3, 0x13, 0xA3, 0x23, 0xA3, 0x33, 0x92, 0x52, 0x82, 0x73, 0x43,
+    0xA6, 0x60, /*"o",79*/
+    0x51, 0x35, 0x56, 0x21, 0x43, 0x63, 0x11, 0x63, 0x54, 0x83, 0x43, 0x93, 0x43, 0xA2, 0x43, 0xA3,
+    0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0x93,
+    0x43, 0x93, 0x44, 0x82, 0x54, 0x73, 0x53, 0x12, 0x43, 0x63, 0x35, 0x83, 0xF1, 0x3F, 0x13, 0xF1,
+    0x3F, 0x13, 0xD9, 0xA0, /*"p",80*/
+    0x56, 0x41, 0x72, 0x51, 0x22, 0x62, 0x74, 0x52, 0x84, 0x43, 0x93, 0x43, 0x93, 0x33, 0xA3, 0x33,
+    0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x42, 0xA3, 0x43,
+    0x93, 0x43, 0x84, 0x53, 0x74, 0x63, 0x42, 0x13, 0x85, 0x33, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13,
+    0xF1, 0x3D, 0x90, /*"q",81*/
+    0x62, 0xB8, 0x55, 0x63, 0x32, 0x33, 0x53, 0x22, 0x43, 0x53, 0x12, 0x53, 0x53, 0x11, 0x63, 0x54,
+    0xF0, 0x4F, 0x03, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1,
+    0x3F, 0x13, 0xF1, 0x3B, 0xD6, /*"r",82*/
+    0x46, 0x83, 0x44, 0x33, 0x63, 0x23, 0x82, 0x23, 0x91, 0x23, 0x91, 0x24, 0xC4, 0xB7, 0xA7, 0xA7,
+    0xA6, 0xB6, 0xA5, 0xB5, 0xA5, 0xA6, 0x83, 0x15, 0x53, 0x21, 0x46, 0x40, /*"s",83*/
+    0x71, 0xE2, 0xE2, 0xE2, 0xE2, 0xD3, 0xB5, 0x8F, 0x06, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x37, 0x15, 0x37, 0x16, 0x26, 0x17, 0x34, 0x1A, 0x53, /*"t",84*/
+    0x51, 0xA1, 0x36, 0x56, 0x63, 0x83, 0x63, 0x83, 0x63, 0x83, 0x63, 0x83, 0x63, 0x83, 0x63, 0x83,
+    0x63, 0x83, 0x63, 0x83, 0x63, 0x83, 0x63, 0x83, 0x63, 0x83, 0x63, 0x83, 0x63, 0x83, 0x63, 0x83,
+    0x63, 0x83, 0x63, 0x74, 0x73, 0x64, 0x74, 0x32, 0x16, 0x65, 0x32, 0x40, /*"u",85*/
+    0x07, 0x56, 0x23, 0x92, 0x52, 0x91, 0x63, 0x81, 0x63, 0x72, 0x72, 0x71, 0x82, 0x71, 0x83, 0x52,
+    0x92, 0x51, 0xA2, 0x51, 0xA3, 0x32, 0xB2, 0x31, 0xC2, 0x31, 0xC3, 0x12, 0xD2, 0x11, 0xE2, 0x11,
+    0xE4, 0xF0, 0x2F, 0x12, 0xF1, 0x19, /*"v",86*/
+    0xFC, 0xFC, 0xFC, 0xE1, 0xC0, 0xC3, 0x83, 0x03, 0x0E, 0x0C, 0x08, 0x18, 0x38, 0x20, 0x60, 0xE1,
+    0x81, 0xC3, 0x84, 0x07, 0x1E, 0x10, 0x0C, 0x5C, 0x40, 0x31, 0x31, 0x00, 0xEC, 0xC8, 0x03, 0xB3,
+    0x20, 0x06, 0x8C, 0x80, 0x1E, 0x3A, 0x00, 0x78, 0x70, 0x01, 0xE1, 0xC0, 0x03, 0x07, 0x00, 0x0C,
+    0x1C, 0x00, 0x30, 0x20, 0x00, 0xC0, 0x80, /*"w",87*/
+    0x17, 0x36, 0x44, 0x62, 0x73, 0x61, 0x92, 0x52, 0x93, 0x41, 0xB2, 0x31, 0xC3, 0x12, 0xD4, 0xE4,
+    0xF0, 0x3F, 0x03, 0xE5, 0xD1, 0x22, 0xC1, 0x33, 0xA2, 0x42, 0xA1, 0x62, 0x82, 0x63, 0x62, 0x82,
+    0x53, 0x83, 0x27, 0x47, /*"x",88*/
+    0x07, 0x47, 0x23, 0x83, 0x52, 0x82, 0x62, 0x81, 0x73, 0x71, 0x82, 0x62, 0x82, 0x62, 0x83, 0x51,
+    0xA2, 0x42, 0xA2, 0x42, 0xB2, 0x31, 0xC2, 0x22, 0xC2, 0x22, 0xD2, 0x11, 0xE4, 0xE4, 0xF0, 0x2F,
+    0x12, 0xF1, 0x2F, 0x11, 0xF2, 0x1F, 0x12, 0xF1, 0x1B, 0x32, 0x2B, 0x6D, 0x4C, /*"y",89*/
+    0x1E, 0x23, 0x83, 0x12, 0x93, 0x22, 0x83, 0x31, 0x93, 0x31, 0x83, 0xC3, 0xD3, 0xC3, 0xC3, 0xD3,
+    0xC3, 0xC3, 0xD3, 0x81, 0x33, 0x91, 0x23, 0x92, 0x23, 0x91, 0x23, 0x92, 0x13, 0x93, 0x1F, 0x01, /*"z",90*/
+    0x73, 0x53, 0x72, 0x72, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x72, 0x73, 0x52, 0xA3, 0x82, 0x92, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x82, 0x92, 0x83, 0x93, /*"{",91*/
+    0x0F, 0xFF, 0xFF, 0xD0, /*"|",92*/
+    0x03, 0x93, 0x82, 0x92, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x92, 0x92, 0xA2, 0x62, 0x72, 0x72, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x82, 0x72, 0x73, 0x53, 0x70, /*"}",93*/
+    0x34, 0xE7, 0xB2, 0x34, 0x81, 0x11, 0x54, 0x72, 0x74, 0x51, 0x11, 0x84, 0x32, 0xB7, 0xE4, 0x30, /*"~",94*/
+};
 
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x18, 0xF0, 0x08, 0x10, 0x78, 0x08, 0x20,
-    0x3C, 0x10, 0x20, 0x1E, 0x30, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, /*"~",94*/
+static const esp_painter_glyph_t glyphs[] = {
+    {0x0000, 0, 0, 0, 0}, /*" ",0*/
+    {0x0000, 8, 7, 5, 31}, /*"!",1*/
+    {0x0014, 3, 3, 15, 11}, /*""",2*/
+    {0x8029, 2, 8, 18, 30}, /*"#",3*/
+    {0x005C, 3, 5, 15, 37}, /*"$",4*/
+    {0x00A2, 1, 8, 20, 30}, /*"%",5*/
+    {0x80ED, 1, 8, 20, 30}, /*"&",6*/
+    {0x0135, 2, 3, 6, 11}, /*"'",7*/
+    {0x813E, 9, 3, 10, 39}, /*"(",8*/
+    {0x8165, 2, 3, 10, 39}, /*")",9*/
+    {0x818D, 1, 11, 19, 22}, /*"*",10*/
+    {0x81B8, 1, 11, 20, 22}, /*"+",11*/
+    {0x01D8, 2, 32, 6, 11}, /*",",12*/
+    {0x81E1, 1, 21, 19, 2}, /*"-",13*/
+    {0x01E3, 3, 33, 5, 5}, /*".",14*/
+    {0x81E7, 2, 4, 18, 37}, /*"/",15*/
+    {0x8220, 2, 8, 18, 30}, /*"0",16*/
+    {0x8250, 5, 8, 13, 30}, /*"1",17*/
+    {0x826E, 2, 8, 17, 30}, /*"2",18*/
+    {0x829B, 3, 8, 16, 30}, /*"3",19*/
+    {0x82C7, 2, 8, 19, 30}, /*"4",20*/
+    {0x82FB, 3, 8, 16, 30}, /*"5",21*/
+    {0x8328, 2, 8, 18, 30}, /*"6",22*/
+    {0x835E, 3, 8, 16, 30}, /*"7",23*/
+    {0x8385, 2, 8, 17, 30}, /*"8",24*/
+    {0x83B9, 2, 8, 18, 30}, /*"9",25*/
+    {0x83ED, 8, 17, 5, 21}, /*":",26*/
+    {0x83F6, 9, 18, 4, 25}, /*";",27*/
+    {0x8400, 3, 7, 16, 31}, /*"<",28*/
+    {0x8427, 1, 17, 19, 10}, /*"=",29*/
+    {0x842F, 3, 7, 16, 31}, /*">",30*/
+    {0x8456, 2, 8, 18, 30}, /*"?",31*/
+    {0x047B, 2, 8, 19, 30}, /*"@",32*/
+    {0x84C3, 0, 8, 21, 30}, /*"A",33*/
+    {0x84FD, 1, 8, 19, 30}, /*"B",34*/
+    {0x8537, 1, 8, 19, 30}, /*"C",35*/
+    {0x856B, 1, 8, 19, 30}, /*"D",36*/
+    {0x85A6, 1, 8, 20, 30}, /*"E",37*/
+    {0x85DD, 1, 8, 20, 30}, /*"F",38*/
+    {0x8611, 1, 8, 20, 30}, /*"G",39*/
+    {0x8647, 1, 8, 20, 30}, /*"H",40*/
+    {0x8683, 4, 8, 15, 30}, /*"I",41*/
+    {0x86A2, 2, 8, 19, 36}, /*"J",42*/
+    {0x86DA, 1, 8, 20, 30}, /*"K",43*/
+    {0x8717, 1, 8, 20, 30}, /*"L",44*/
+    {0x0747, 1, 8, 20, 30}, /*"M",45*/
+    {0x8792, 0, 8, 22, 30}, /*"N",46*/
+    {0x87E0, 2, 8, 19, 30}, /*"O",47*/
+    {0x8812, 1, 8, 19, 30}, /*"P",48*/
+    {0x8845, 1, 8, 20, 34}, /*"Q",49*/
+    {0x8883, 1, 8, 20, 30}, /*"R",50*/
+    {0x88BD, 2, 8, 17, 30}, /*"S",51*/
+    {0x88E8, 1, 8, 19, 30}, /*"T",52*/
+    {0x891C, 1, 8, 20, 30}, /*"U",53*/
+    {0x8958, 1, 8, 20, 30}, /*"V",54*/
+    {0x0993, 0, 8, 22, 30}, /*"W",55*/
+    {0x89E6, 1, 8, 20, 30}, /*"X",56*/
+    {0x8A20, 1, 8, 20, 30}, /*"Y",57*/
+    {0x8A55, 2, 8, 18, 30}, /*"Z",58*/
+    {0x8A84, 9, 3, 10, 38}, /*"[",59*/
+    {0x8AA8, 3, 6, 17, 37}, /*"\",60*/
+    {0x8ADF, 3, 3, 10, 38}, /*"]",61*/
+    {0x0B03, 5, 3, 12, 5}, /*"^",62*/
+    {0x8B0B, 0, 43, 22, 1}, /*"_",63*/
+    {0x8B0D, 4, 3, 9, 4}, /*"`",64*/
+    {0x8B11, 2, 18, 20, 20}, /*"a",65*/
+    {0x8B3B, 1, 7, 19, 31}, /*"b",66*/
+    {0x8B77, 3, 18, 16, 20}, /*"c",67*/
+    {0x8B97, 3, 7, 18, 31}, /*"d",68*/
+    {0x8BD1, 3, 18, 16, 20}, /*"e",69*/
+    {0x8BEF, 3, 8, 18, 30}, /*"f",70*/
+    {0x8C1D, 2, 18, 19, 26}, /*"g",71*/
+    {0x8C4F, 2, 7, 18, 31}, /*"h",72*/
+    {0x8C88, 5, 8, 13, 30}, /*"i",73*/
+    {0x8CA4, 3, 8, 15, 36}, /*"j",74*/
+    {0x8CCA, 1, 7, 20, 31}, /*"k",75*/
+    {0x8D03, 4, 7, 15, 31}, /*"l",76*/
+    {0x0D23, 0, 17, 22, 21}, /*"m",77*/
+    {0x8D5D, 2, 17, 18, 21}, /*"n",78*/
+    {0x8D88, 2, 18, 18, 20}, /*"o",79*/
+    {0x8DAA, 1, 18, 19, 26}, /*"p",80*/
+    {0x8DDE, 2, 18, 19, 26}, /*"q",81*/
+    {0x8E11, 1, 17, 19, 21}, /*"r",82*/
+    {0x8E36, 4, 18, 15, 20}, /*"s",83*/
+    {0x8E52, 3, 11, 16, 27}, /*"t",84*/
+    {0x8E72, 1, 17, 20, 21}, /*"u",85*/
+    {0x8E9E, 2, 18, 18, 20}, /*"v",86*/
+    {0x0EC4, 0, 18, 22, 20}, /*"w",87*/
+    {0x8EFB, 2, 18, 18, 20}, /*"x",88*/
+    {0x8F1F, 2, 18, 18, 26}, /*"y",89*/
+    {0x8F4C, 3, 18, 16, 20}, /*"z",90*/
+    {0x8F6C, 9, 3, 10, 39}, /*"{",91*/
+    {0x8F93, 10, 0, 2, 44}, /*"|",92*/
+    {0x8F97, 3, 3, 10, 39}, /*"}",93*/
+    {0x8FBF, 2, 1, 19, 8}, /*"~",94*/
 };
 
 const esp_painter_basic_font_t esp_painter_basic_font_44 = {
     .bitmap = bitmap,
+    .glyphs = glyphs,
     .width = 22,
     .height = 44,
+    .first = 0x20,
+    .count = 95,
 };
 
 #endif
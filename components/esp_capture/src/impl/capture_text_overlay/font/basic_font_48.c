@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: CC0-1.0
  */
 
+/* Packed by tools/pack_font.py: 24x48 cells, 5158 bytes (1-bit bitmap: 13680) */
+
 #include "sdkconfig.h"
 
 #include "esp_painter_font.h"
@@ -11,961 +13,451 @@
 #if CONFIG_ESP_PAINTER_BASIC_FONT_48
 
 static const uint8_t bitmap[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*" ",0*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"!",1*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0xF0, 0xF0, 0x01,
-    0xF1, 0xF0, 0x01, 0xF1, 0xF0, 0x03, 0xE3, 0xE0, 0x03, 0xC3, 0xC0, 0x07, 0x87, 0x80, 0x07, 0x07,
-    0x00, 0x0E, 0x0E, 0x00, 0x0C, 0x0C, 0x00, 0x18, 0x18, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*""",2*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80,
-    0x60, 0x01, 0x00, 0x40, 0x01, 0x00, 0x40, 0x01, 0x00, 0x40, 0x01, 0x00, 0x40, 0x01, 0x00, 0x40,
-    0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x03, 0x00, 0xC0, 0x03,
-    0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00,
-    0xC0, 0x02, 0x00, 0x80, 0x02, 0x00, 0x80, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFC, 0x06, 0x01, 0x80, 0x06, 0x01, 0x80, 0x06, 0x01, 0x80, 0x06, 0x01, 0x80, 0x06,
-    0x01, 0x80, 0x06, 0x01, 0x80, 0x06, 0x01, 0x80, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"#",3*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xD9, 0xC0, 0x03, 0x18,
-    0xE0, 0x07, 0x18, 0x60, 0x06, 0x18, 0x70, 0x0E, 0x18, 0x70, 0x0E, 0x18, 0xF0, 0x0E, 0x18, 0xF0,
-    0x0E, 0x18, 0xE0, 0x0F, 0x18, 0x00, 0x07, 0x98, 0x00, 0x07, 0xD8, 0x00, 0x03, 0xF8, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F,
-    0xC0, 0x00, 0x1B, 0xE0, 0x00, 0x19, 0xE0, 0x00, 0x18, 0xF0, 0x00, 0x18, 0xF0, 0x0E, 0x18, 0x70,
-    0x1E, 0x18, 0x70, 0x1E, 0x18, 0x70, 0x1E, 0x18, 0x70, 0x1C, 0x18, 0x70, 0x0C, 0x18, 0x60, 0x0C,
-    0x18, 0xE0, 0x06, 0x18, 0xC0, 0x03, 0x1B, 0x80, 0x00, 0xFE, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"$",4*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x18, 0x80, 0x60, 0x30, 0xC0,
-    0x40, 0x20, 0x40, 0xC0, 0x60, 0x60, 0x80, 0x60, 0x60, 0x80, 0x60, 0x61, 0x80, 0x60, 0x61, 0x00,
-    0x60, 0x63, 0x00, 0x60, 0x62, 0x00, 0x60, 0x62, 0x00, 0x60, 0x66, 0x00, 0x60, 0x64, 0x00, 0x30,
-    0x4C, 0x00, 0x30, 0xC8, 0x00, 0x19, 0x88, 0x00, 0x0F, 0x18, 0xF0, 0x00, 0x11, 0x98, 0x00, 0x33,
-    0x0C, 0x00, 0x23, 0x0C, 0x00, 0x22, 0x04, 0x00, 0x66, 0x06, 0x00, 0x46, 0x06, 0x00, 0x46, 0x06,
-    0x00, 0x86, 0x06, 0x00, 0x86, 0x06, 0x01, 0x86, 0x06, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x02,
-    0x02, 0x04, 0x02, 0x03, 0x0C, 0x06, 0x01, 0x98, 0x04, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"%",5*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x03, 0x38, 0x00, 0x07, 0x18,
-    0x00, 0x06, 0x1C, 0x00, 0x0E, 0x1C, 0x00, 0x0E, 0x1C, 0x00, 0x0E, 0x1C, 0x00, 0x0E, 0x1C, 0x00,
-    0x0E, 0x1C, 0x00, 0x0E, 0x18, 0x00, 0x0E, 0x38, 0x00, 0x0F, 0x30, 0x00, 0x07, 0x70, 0x00, 0x07,
-    0x60, 0x00, 0x07, 0x80, 0x00, 0x07, 0x87, 0xF8, 0x0B, 0x80, 0xE0, 0x1B, 0xC0, 0xC0, 0x39, 0xC0,
-    0xC0, 0x31, 0xE0, 0xC0, 0x31, 0xE0, 0xC0, 0x70, 0xF0, 0x80, 0x70, 0xF0, 0x80, 0x70, 0x79, 0x80,
-    0x70, 0x39, 0x80, 0x70, 0x3D, 0x00, 0x70, 0x1F, 0x00, 0x78, 0x0E, 0x00, 0x38, 0x0F, 0x02, 0x3C,
-    0x0F, 0x86, 0x1E, 0x1B, 0xC4, 0x0F, 0xF1, 0xFC, 0x07, 0xC0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"&",6*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"'",7*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"(",8*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*")",9*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x30, 0x38, 0x38, 0x7C, 0x38, 0x7C, 0x7E, 0x10, 0xFC, 0x3F, 0x11, 0xF8, 0x0F,
-    0x93, 0xE0, 0x01, 0xD7, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x01, 0xD7, 0x00, 0x0F, 0x93,
-    0xE0, 0x3F, 0x11, 0xF8, 0x7E, 0x10, 0xFC, 0x7C, 0x38, 0x7C, 0x70, 0x38, 0x1C, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"*",10*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x18, 0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x18, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"+",11*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, /*",",12*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"-",13*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F,
-    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*".",14*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x60, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80,
-    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x60, 0x00, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"/",15*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xC3, 0x80, 0x03, 0x80,
-    0xC0, 0x03, 0x00, 0xE0, 0x06, 0x00, 0x60, 0x0E, 0x00, 0x70, 0x0C, 0x00, 0x30, 0x1C, 0x00, 0x38,
-    0x1C, 0x00, 0x38, 0x1C, 0x00, 0x38, 0x18, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38,
-    0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00,
-    0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x18, 0x00, 0x18, 0x1C, 0x00, 0x38,
-    0x1C, 0x00, 0x38, 0x1C, 0x00, 0x38, 0x0C, 0x00, 0x30, 0x0E, 0x00, 0x70, 0x06, 0x00, 0x60, 0x03,
-    0x00, 0xE0, 0x03, 0x80, 0xC0, 0x00, 0xC3, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"0",16*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x1C,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"1",17*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x83, 0xC0, 0x06, 0x00,
-    0xE0, 0x0C, 0x00, 0x70, 0x0C, 0x00, 0x70, 0x1C, 0x00, 0x38, 0x1C, 0x00, 0x38, 0x1C, 0x00, 0x38,
-    0x1E, 0x00, 0x38, 0x1E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00,
-    0x03, 0x80, 0x00, 0x07, 0x00, 0x08, 0x06, 0x00, 0x08, 0x0C, 0x00, 0x18, 0x1C, 0x00, 0x10, 0x38,
-    0x00, 0x70, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"2",18*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0x83, 0x80, 0x02, 0x01,
-    0xC0, 0x04, 0x00, 0xE0, 0x0C, 0x00, 0xE0, 0x0C, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70,
-    0x06, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x00,
-    0x01, 0x80, 0x00, 0x07, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
-    0x0C, 0x00, 0x38, 0x1E, 0x00, 0x38, 0x1E, 0x00, 0x38, 0x1E, 0x00, 0x30, 0x1C, 0x00, 0x70, 0x0C,
-    0x00, 0x60, 0x06, 0x00, 0xC0, 0x03, 0x03, 0x80, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"3",19*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
-    0x80, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x13, 0x80, 0x00, 0x13, 0x80,
-    0x00, 0x23, 0x80, 0x00, 0x63, 0x80, 0x00, 0x43, 0x80, 0x00, 0xC3, 0x80, 0x00, 0x83, 0x80, 0x01,
-    0x03, 0x80, 0x03, 0x03, 0x80, 0x02, 0x03, 0x80, 0x06, 0x03, 0x80, 0x04, 0x03, 0x80, 0x0C, 0x03,
-    0x80, 0x18, 0x03, 0x80, 0x18, 0x03, 0x80, 0x30, 0x03, 0x80, 0x3F, 0xFF, 0xFC, 0x00, 0x03, 0x80,
-    0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00,
-    0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"4",20*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x07, 0xFF, 0xF0, 0x07, 0xFF,
-    0xF0, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x7F, 0x00, 0x0C,
-    0xFF, 0x80, 0x0D, 0x81, 0xE0, 0x0F, 0x00, 0xE0, 0x0E, 0x00, 0x70, 0x0C, 0x00, 0x70, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x38,
-    0x1E, 0x00, 0x38, 0x1E, 0x00, 0x38, 0x1E, 0x00, 0x30, 0x1C, 0x00, 0x70, 0x0C, 0x00, 0x70, 0x0C,
-    0x00, 0xE0, 0x06, 0x00, 0xC0, 0x03, 0x83, 0x80, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"5",21*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0xE0, 0x40, 0x01, 0x80,
-    0x60, 0x03, 0x00, 0x70, 0x06, 0x00, 0x70, 0x06, 0x00, 0x70, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x3F, 0x00, 0x38,
-    0xFF, 0xC0, 0x39, 0xC1, 0xE0, 0x3B, 0x00, 0x70, 0x3E, 0x00, 0x38, 0x3C, 0x00, 0x38, 0x3C, 0x00,
-    0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C,
-    0x18, 0x00, 0x1C, 0x1C, 0x00, 0x1C, 0x1C, 0x00, 0x18, 0x0C, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x07,
-    0x00, 0x30, 0x03, 0x80, 0x60, 0x01, 0xC1, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"6",22*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xF0, 0x0E, 0x00, 0x30, 0x0C, 0x00, 0x20, 0x18, 0x00, 0x40, 0x18, 0x00, 0xC0, 0x10, 0x00, 0x80,
-    0x00, 0x01, 0x80, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"7",23*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0x81, 0xC0, 0x07, 0x00,
-    0xE0, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x1C, 0x00, 0x38, 0x1C, 0x00, 0x38, 0x1C, 0x00, 0x38,
-    0x1C, 0x00, 0x38, 0x1E, 0x00, 0x38, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x70, 0x07, 0xC0, 0xE0, 0x07,
-    0xE1, 0xC0, 0x01, 0xFB, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xBF, 0x00, 0x07, 0x0F, 0xC0, 0x0E, 0x03,
-    0xE0, 0x0C, 0x01, 0xE0, 0x1C, 0x00, 0xF0, 0x1C, 0x00, 0x70, 0x38, 0x00, 0x78, 0x38, 0x00, 0x38,
-    0x38, 0x00, 0x38, 0x38, 0x00, 0x38, 0x38, 0x00, 0x38, 0x18, 0x00, 0x30, 0x1C, 0x00, 0x70, 0x0C,
-    0x00, 0x60, 0x06, 0x00, 0xC0, 0x03, 0x81, 0x80, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"8",24*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x83, 0x00, 0x06, 0x01,
-    0x80, 0x0E, 0x00, 0xC0, 0x1C, 0x00, 0x60, 0x1C, 0x00, 0x60, 0x18, 0x00, 0x70, 0x38, 0x00, 0x30,
-    0x38, 0x00, 0x30, 0x38, 0x00, 0x38, 0x38, 0x00, 0x38, 0x38, 0x00, 0x38, 0x38, 0x00, 0x38, 0x38,
-    0x00, 0x38, 0x3C, 0x00, 0x78, 0x1C, 0x00, 0xF8, 0x1C, 0x00, 0xB8, 0x1E, 0x01, 0xB8, 0x0F, 0x87,
-    0x38, 0x07, 0xFE, 0x38, 0x01, 0xF8, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0xC0, 0x0E, 0x01, 0xC0, 0x0E,
-    0x03, 0x80, 0x0E, 0x07, 0x00, 0x06, 0x0E, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"9",25*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*":",26*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*";",27*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"<",28*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"=",29*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*">",30*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x07, 0x03,
-    0xC0, 0x0C, 0x01, 0xE0, 0x18, 0x00, 0xF0, 0x10, 0x00, 0x70, 0x30, 0x00, 0x78, 0x30, 0x00, 0x78,
-    0x3C, 0x00, 0x78, 0x3E, 0x00, 0x78, 0x3E, 0x00, 0x78, 0x1E, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00,
-    0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"?",31*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xE0, 0xC0, 0x01, 0x80,
-    0x60, 0x03, 0x00, 0x10, 0x07, 0x00, 0x18, 0x06, 0x00, 0x0C, 0x0C, 0x07, 0x6C, 0x0C, 0x0C, 0xEC,
-    0x1C, 0x1C, 0xE6, 0x1C, 0x18, 0xE6, 0x18, 0x38, 0xC6, 0x38, 0x30, 0xC6, 0x38, 0x70, 0xC6, 0x38,
-    0x70, 0xC6, 0x38, 0x60, 0xC6, 0x38, 0x61, 0xC6, 0x38, 0xE1, 0xC6, 0x38, 0xE1, 0x86, 0x38, 0xE1,
-    0x86, 0x38, 0xE1, 0x8C, 0x38, 0xE1, 0x8C, 0x38, 0xE3, 0x8C, 0x1C, 0xE3, 0x98, 0x1C, 0x65, 0x98,
-    0x1C, 0x7D, 0xF0, 0x0C, 0x38, 0xE0, 0x0E, 0x00, 0x06, 0x0E, 0x00, 0x04, 0x07, 0x00, 0x0C, 0x03,
-    0x80, 0x38, 0x01, 0xE0, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"@",32*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x4C, 0x00, 0x00, 0xCC, 0x00, 0x00, 0xCE, 0x00,
-    0x00, 0x8E, 0x00, 0x00, 0x86, 0x00, 0x01, 0x86, 0x00, 0x01, 0x87, 0x00, 0x01, 0x07, 0x00, 0x01,
-    0x03, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x80, 0x02, 0x03, 0x80, 0x02, 0x03, 0x80, 0x06, 0x01,
-    0x80, 0x07, 0xFF, 0xC0, 0x04, 0x01, 0xC0, 0x04, 0x01, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xE0,
-    0x08, 0x00, 0xE0, 0x08, 0x00, 0xE0, 0x18, 0x00, 0xE0, 0x18, 0x00, 0x70, 0x18, 0x00, 0x70, 0x18,
-    0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x78, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"A",33*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0E, 0x03, 0xC0, 0x0E, 0x00,
-    0xE0, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38,
-    0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E,
-    0x00, 0xE0, 0x0E, 0x03, 0x80, 0x0F, 0xFE, 0x00, 0x0E, 0x01, 0xC0, 0x0E, 0x00, 0x60, 0x0E, 0x00,
-    0x70, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C,
-    0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x38, 0x0E,
-    0x00, 0x38, 0x0E, 0x00, 0x70, 0x0E, 0x01, 0xC0, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"B",34*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xE0, 0xF8, 0x01, 0x80,
-    0x38, 0x03, 0x00, 0x18, 0x07, 0x00, 0x18, 0x06, 0x00, 0x08, 0x0E, 0x00, 0x0C, 0x0C, 0x00, 0x04,
-    0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x04,
-    0x1C, 0x00, 0x04, 0x1C, 0x00, 0x08, 0x0E, 0x00, 0x08, 0x0E, 0x00, 0x18, 0x07, 0x00, 0x30, 0x07,
-    0x80, 0x60, 0x03, 0xC0, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"C",35*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0x07, 0x00, 0x0E, 0x01,
-    0x80, 0x0E, 0x00, 0xC0, 0x0E, 0x00, 0x60, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x30, 0x0E, 0x00, 0x38,
-    0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E,
-    0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00,
-    0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x18, 0x0E, 0x00, 0x38,
-    0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x30, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0xE0, 0x0E,
-    0x01, 0xC0, 0x0E, 0x03, 0x80, 0x0E, 0x0F, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"D",36*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
-    0x70, 0x0E, 0x00, 0x30, 0x0E, 0x00, 0x10, 0x0E, 0x00, 0x18, 0x0E, 0x00, 0x08, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x80, 0x0E,
-    0x00, 0x80, 0x0E, 0x01, 0x80, 0x0F, 0xFF, 0x80, 0x0E, 0x03, 0x80, 0x0E, 0x01, 0x80, 0x0E, 0x00,
-    0x80, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x04, 0x0E, 0x00, 0x04, 0x0E, 0x00, 0x08, 0x0E, 0x00, 0x08, 0x0E,
-    0x00, 0x18, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0xF0, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"E",37*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x0E, 0x00, 0x78, 0x0E, 0x00,
-    0x3C, 0x0E, 0x00, 0x0C, 0x0E, 0x00, 0x04, 0x0E, 0x00, 0x06, 0x0E, 0x00, 0x02, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x40, 0x0E, 0x00, 0x40, 0x0E, 0x00, 0x40, 0x0E,
-    0x00, 0x40, 0x0E, 0x00, 0xC0, 0x0F, 0xFF, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x00, 0xC0, 0x0E, 0x00,
-    0x40, 0x0E, 0x00, 0x40, 0x0E, 0x00, 0x40, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"F",38*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x20, 0x01, 0xC3, 0xE0, 0x03, 0x00,
-    0xE0, 0x06, 0x00, 0xE0, 0x0E, 0x00, 0x60, 0x0C, 0x00, 0x20, 0x1C, 0x00, 0x30, 0x18, 0x00, 0x30,
-    0x38, 0x00, 0x10, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x03,
-    0xFE, 0x70, 0x00, 0xF8, 0x70, 0x00, 0x70, 0x70, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70,
-    0x38, 0x00, 0x70, 0x18, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x0C, 0x00, 0x70, 0x06,
-    0x00, 0x70, 0x07, 0x00, 0xF0, 0x01, 0xC1, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"G",39*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x83, 0xFE, 0x1C, 0x00, 0x70, 0x1C, 0x00,
-    0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70,
-    0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C,
-    0x00, 0x70, 0x1C, 0x00, 0x70, 0x1F, 0xFF, 0xF0, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00,
-    0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70,
-    0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C,
-    0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"H",40*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x1C, 0x00, 0x00, 0x1C,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"I",41*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0x80, 0x00, 0x03,
-    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80,
-    0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00,
-    0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
-    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80,
-    0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00,
-    0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x18, 0x03, 0x00, 0x3C, 0x07,
-    0x00, 0x3C, 0x06, 0x00, 0x3C, 0x0C, 0x00, 0x1C, 0x18, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, /*"J",42*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x0E, 0x00, 0xF0, 0x0E, 0x00,
-    0xE0, 0x0E, 0x00, 0xC0, 0x0E, 0x01, 0x80, 0x0E, 0x01, 0x00, 0x0E, 0x03, 0x00, 0x0E, 0x06, 0x00,
-    0x0E, 0x04, 0x00, 0x0E, 0x0C, 0x00, 0x0E, 0x08, 0x00, 0x0E, 0x10, 0x00, 0x0E, 0x30, 0x00, 0x0E,
-    0x38, 0x00, 0x0E, 0x78, 0x00, 0x0E, 0xF8, 0x00, 0x0E, 0x9C, 0x00, 0x0F, 0x1C, 0x00, 0x0F, 0x0E,
-    0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x03, 0x80, 0x0E, 0x03, 0x80,
-    0x0E, 0x03, 0x80, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E,
-    0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x78, 0x7F, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"K",43*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x07, 0x00, 0x04, 0x07, 0x00, 0x04, 0x07, 0x00, 0x0C, 0x07, 0x00, 0x08, 0x07,
-    0x00, 0x18, 0x07, 0x00, 0x38, 0x07, 0x00, 0x78, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"L",44*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x7E, 0x1C, 0x00, 0x78, 0x1C, 0x00,
-    0x78, 0x1E, 0x00, 0x78, 0x1E, 0x00, 0xB8, 0x1E, 0x00, 0xB8, 0x1E, 0x00, 0xB8, 0x1E, 0x00, 0xB8,
-    0x17, 0x01, 0xB8, 0x17, 0x01, 0x38, 0x17, 0x01, 0x38, 0x17, 0x01, 0x38, 0x13, 0x81, 0x38, 0x13,
-    0x83, 0x38, 0x13, 0x82, 0x38, 0x13, 0x82, 0x38, 0x13, 0x82, 0x38, 0x11, 0xC6, 0x38, 0x11, 0xC4,
-    0x38, 0x11, 0xC4, 0x38, 0x11, 0xC4, 0x38, 0x10, 0xEC, 0x38, 0x10, 0xEC, 0x38, 0x10, 0xE8, 0x38,
-    0x10, 0xE8, 0x38, 0x10, 0xF8, 0x38, 0x10, 0x78, 0x38, 0x10, 0x70, 0x38, 0x10, 0x70, 0x38, 0x10,
-    0x70, 0x38, 0x10, 0x30, 0x38, 0x10, 0x30, 0x38, 0x7C, 0x21, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"M",45*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xFE, 0x0E, 0x00, 0x10, 0x0F, 0x00,
-    0x10, 0x0F, 0x00, 0x10, 0x0F, 0x80, 0x10, 0x0B, 0x80, 0x10, 0x0B, 0xC0, 0x10, 0x09, 0xC0, 0x10,
-    0x09, 0xE0, 0x10, 0x08, 0xE0, 0x10, 0x08, 0xE0, 0x10, 0x08, 0x70, 0x10, 0x08, 0x70, 0x10, 0x08,
-    0x38, 0x10, 0x08, 0x38, 0x10, 0x08, 0x1C, 0x10, 0x08, 0x1C, 0x10, 0x08, 0x0E, 0x10, 0x08, 0x0E,
-    0x10, 0x08, 0x07, 0x10, 0x08, 0x07, 0x10, 0x08, 0x03, 0x90, 0x08, 0x03, 0x90, 0x08, 0x03, 0xD0,
-    0x08, 0x01, 0xD0, 0x08, 0x01, 0xF0, 0x08, 0x00, 0xF0, 0x08, 0x00, 0xF0, 0x08, 0x00, 0x70, 0x08,
-    0x00, 0x70, 0x08, 0x00, 0x30, 0x08, 0x00, 0x30, 0x7F, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"N",46*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xC1, 0x80, 0x01, 0x80,
-    0x40, 0x03, 0x00, 0x60, 0x06, 0x00, 0x30, 0x0E, 0x00, 0x38, 0x0C, 0x00, 0x18, 0x1C, 0x00, 0x18,
-    0x1C, 0x00, 0x1C, 0x1C, 0x00, 0x1C, 0x18, 0x00, 0x0C, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38,
-    0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00,
-    0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x18, 0x00, 0x0C, 0x1C, 0x00, 0x0C,
-    0x1C, 0x00, 0x1C, 0x0C, 0x00, 0x1C, 0x0C, 0x00, 0x18, 0x0E, 0x00, 0x38, 0x06, 0x00, 0x30, 0x03,
-    0x00, 0x60, 0x01, 0x80, 0xC0, 0x00, 0xC1, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"O",47*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0E, 0x01, 0xC0, 0x0E, 0x00,
-    0x70, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C,
-    0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x38, 0x0E,
-    0x00, 0x30, 0x0E, 0x00, 0x70, 0x0E, 0x01, 0xC0, 0x0F, 0xFF, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"P",48*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xC3, 0x80, 0x03, 0x00,
-    0xC0, 0x07, 0x00, 0x60, 0x06, 0x00, 0x60, 0x0E, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x1C, 0x00, 0x38,
-    0x1C, 0x00, 0x38, 0x18, 0x00, 0x18, 0x18, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38,
-    0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00,
-    0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x18, 0xF8, 0x18,
-    0x1D, 0xFC, 0x18, 0x1D, 0x8E, 0x38, 0x0F, 0x0E, 0x38, 0x0F, 0x07, 0x30, 0x06, 0x07, 0x60, 0x07,
-    0x07, 0x60, 0x03, 0x03, 0xC0, 0x01, 0xC3, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xC8, 0x00, 0x01,
-    0xF8, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"Q",49*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0E, 0x03, 0xC0, 0x0E, 0x00,
-    0xE0, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x78, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38,
-    0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E,
-    0x00, 0xE0, 0x0E, 0x03, 0xC0, 0x0F, 0xFF, 0x00, 0x0E, 0x0C, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E,
-    0x00, 0x0E, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x03, 0x80, 0x0E, 0x03, 0x80,
-    0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E,
-    0x00, 0xF0, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x78, 0x7F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"R",50*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x03, 0x03, 0xE0, 0x0E, 0x00,
-    0xE0, 0x0C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x38, 0x00, 0x30, 0x38, 0x00, 0x30, 0x38, 0x00, 0x10,
-    0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F,
-    0xE0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07,
-    0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
-    0x20, 0x00, 0x38, 0x30, 0x00, 0x38, 0x30, 0x00, 0x38, 0x10, 0x00, 0x30, 0x18, 0x00, 0x70, 0x1C,
-    0x00, 0x60, 0x1E, 0x00, 0xE0, 0x1F, 0x81, 0x80, 0x10, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"S",51*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x38, 0x38, 0x38, 0x30, 0x38,
-    0x18, 0x30, 0x38, 0x08, 0x20, 0x38, 0x08, 0x60, 0x38, 0x0C, 0x40, 0x38, 0x04, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"T",52*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFE, 0x1C, 0x00, 0x10, 0x1C, 0x00,
-    0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10,
-    0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x1C,
-    0x00, 0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00,
-    0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10,
-    0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x1C, 0x00, 0x10, 0x0C, 0x00, 0x20, 0x0E,
-    0x00, 0x60, 0x07, 0x00, 0xC0, 0x03, 0x81, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"U",53*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFE, 0x1E, 0x00, 0x38, 0x0E, 0x00,
-    0x30, 0x0E, 0x00, 0x30, 0x0E, 0x00, 0x30, 0x0F, 0x00, 0x20, 0x07, 0x00, 0x20, 0x07, 0x00, 0x60,
-    0x07, 0x00, 0x60, 0x07, 0x00, 0x40, 0x03, 0x80, 0x40, 0x03, 0x80, 0xC0, 0x03, 0x80, 0x80, 0x03,
-    0x80, 0x80, 0x01, 0xC0, 0x80, 0x01, 0xC1, 0x80, 0x01, 0xC1, 0x00, 0x01, 0xC1, 0x00, 0x00, 0xE1,
-    0x00, 0x00, 0xE3, 0x00, 0x00, 0xE2, 0x00, 0x00, 0xE2, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x76, 0x00,
-    0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"V",54*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7E, 0x3F, 0x38, 0x1C, 0x0C, 0x38, 0x1C,
-    0x0C, 0x38, 0x1C, 0x0C, 0x38, 0x1C, 0x08, 0x38, 0x1C, 0x08, 0x18, 0x1C, 0x08, 0x18, 0x1C, 0x08,
-    0x1C, 0x1C, 0x18, 0x1C, 0x1E, 0x18, 0x1C, 0x1E, 0x10, 0x1C, 0x1E, 0x10, 0x1C, 0x3E, 0x10, 0x0C,
-    0x3E, 0x10, 0x0C, 0x2E, 0x30, 0x0E, 0x26, 0x20, 0x0E, 0x27, 0x20, 0x0E, 0x67, 0x20, 0x0E, 0x67,
-    0x20, 0x06, 0x47, 0x60, 0x06, 0x47, 0x60, 0x06, 0x43, 0x40, 0x07, 0xC3, 0x40, 0x07, 0xC3, 0xC0,
-    0x07, 0x83, 0xC0, 0x07, 0x83, 0xC0, 0x03, 0x83, 0xC0, 0x03, 0x83, 0x80, 0x03, 0x81, 0x80, 0x03,
-    0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x01, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"W",55*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x0E, 0x00, 0x70, 0x0E, 0x00,
-    0x60, 0x07, 0x00, 0x60, 0x07, 0x00, 0xC0, 0x03, 0x80, 0xC0, 0x03, 0x81, 0x80, 0x01, 0xC1, 0x80,
-    0x01, 0xC3, 0x00, 0x00, 0xE3, 0x00, 0x00, 0xE2, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x6E, 0x00, 0x00, 0x6E, 0x00, 0x00, 0xC7, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x83, 0x80,
-    0x01, 0x83, 0x80, 0x01, 0x01, 0xC0, 0x03, 0x01, 0xC0, 0x02, 0x01, 0xE0, 0x06, 0x00, 0xE0, 0x06,
-    0x00, 0xF0, 0x0C, 0x00, 0x70, 0x1C, 0x00, 0x78, 0x7F, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"X",56*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x81, 0xFC, 0x1E, 0x00, 0x70, 0x0E, 0x00,
-    0x60, 0x0E, 0x00, 0x60, 0x0E, 0x00, 0x40, 0x07, 0x00, 0xC0, 0x07, 0x00, 0x80, 0x07, 0x00, 0x80,
-    0x03, 0x81, 0x80, 0x03, 0x81, 0x00, 0x03, 0xC1, 0x00, 0x01, 0xC3, 0x00, 0x01, 0xC2, 0x00, 0x00,
-    0xE2, 0x00, 0x00, 0xE2, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x74, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"Y",57*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x07, 0x80, 0x38, 0x0F, 0x00,
-    0x78, 0x0C, 0x00, 0x70, 0x0C, 0x00, 0xF0, 0x18, 0x00, 0xE0, 0x10, 0x01, 0xE0, 0x00, 0x01, 0xC0,
-    0x00, 0x03, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xC0, 0x00,
-    0x03, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x80, 0x04, 0x07, 0x00, 0x0C, 0x0F, 0x00, 0x08, 0x0E,
-    0x00, 0x18, 0x1E, 0x00, 0x38, 0x1C, 0x00, 0xF0, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"Z",58*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xF8, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"[",59*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"\",60*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
-    0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"]",61*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x77, 0x00, 0x00,
-    0xE1, 0x80, 0x01, 0x80, 0xC0, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"^",62*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, /*"_",63*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"`",64*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x03, 0x03, 0x80, 0x0C,
-    0x01, 0xC0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x00, 0x00,
-    0xE0, 0x00, 0x0F, 0xE0, 0x00, 0xF0, 0xE0, 0x03, 0x80, 0xE0, 0x0E, 0x00, 0xE0, 0x1C, 0x00, 0xE0,
-    0x1C, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE2, 0x38,
-    0x00, 0xE2, 0x1C, 0x03, 0xE2, 0x0E, 0x0E, 0xE4, 0x03, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"a",65*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x1F, 0x00, 0x0E, 0x61, 0xC0, 0x0E,
-    0xC0, 0xE0, 0x0F, 0x80, 0x70, 0x0F, 0x00, 0x70, 0x0F, 0x00, 0x30, 0x0E, 0x00, 0x38, 0x0E, 0x00,
-    0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38,
-    0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x30, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0F,
-    0x00, 0x60, 0x0F, 0x00, 0xC0, 0x0C, 0xC1, 0x80, 0x08, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"b",66*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xE0, 0xC0, 0x03,
-    0x80, 0x60, 0x03, 0x00, 0x70, 0x07, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x1C, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0C, 0x00, 0x08, 0x0E, 0x00, 0x08, 0x0E, 0x00, 0x10, 0x07,
-    0x00, 0x30, 0x03, 0x80, 0x60, 0x01, 0xC0, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"c",67*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x30, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x7C, 0x70, 0x01, 0xC3, 0x70, 0x03,
-    0x00, 0xF0, 0x07, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x1C, 0x00,
-    0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70,
-    0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x0C, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0xF0, 0x06,
-    0x00, 0xF0, 0x03, 0x01, 0x70, 0x01, 0x82, 0x7E, 0x00, 0xFC, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"d",68*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xC1, 0x80, 0x03,
-    0x80, 0xC0, 0x07, 0x00, 0x60, 0x06, 0x00, 0x70, 0x0E, 0x00, 0x30, 0x0C, 0x00, 0x38, 0x1C, 0x00,
-    0x38, 0x1C, 0x00, 0x38, 0x1C, 0x00, 0x38, 0x1F, 0xFF, 0xF8, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0E, 0x00, 0x10, 0x0E, 0x00, 0x20, 0x07,
-    0x00, 0x20, 0x03, 0x80, 0x40, 0x01, 0xC1, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"e",69*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x1C,
-    0x0C, 0x00, 0x30, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"f",70*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1C, 0x01, 0x83, 0xFC, 0x03,
-    0x01, 0xCC, 0x07, 0x01, 0xC0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
-    0xE0, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0xC0, 0x03, 0x01, 0xC0, 0x01, 0x83, 0x80, 0x07, 0x7E, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x03,
-    0xFF, 0xF0, 0x0E, 0x01, 0xF0, 0x0C, 0x00, 0x78, 0x1C, 0x00, 0x38, 0x1C, 0x00, 0x38, 0x1C, 0x00,
-    0x38, 0x1C, 0x00, 0x30, 0x0E, 0x00, 0x70, 0x07, 0x81, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, /*"g",71*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x1F, 0x80, 0x0E, 0x61, 0xC0, 0x0E,
-    0xC0, 0xE0, 0x0F, 0x80, 0x70, 0x0F, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00,
-    0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70,
-    0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E,
-    0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x7F, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"h",72*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"i",73*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x01,
-    0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x0E, 0x00,
-    0xC0, 0x0E, 0x01, 0xC0, 0x0E, 0x03, 0x80, 0x07, 0x06, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, /*"j",74*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x07, 0xF0, 0x0E, 0x01, 0x80, 0x0E,
-    0x03, 0x00, 0x0E, 0x03, 0x00, 0x0E, 0x06, 0x00, 0x0E, 0x0C, 0x00, 0x0E, 0x18, 0x00, 0x0E, 0x30,
-    0x00, 0x0E, 0x38, 0x00, 0x0E, 0x78, 0x00, 0x0E, 0xDC, 0x00, 0x0F, 0x9C, 0x00, 0x0F, 0x0E, 0x00,
-    0x0E, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x03, 0x80, 0x0E, 0x03, 0x80, 0x0E, 0x01, 0xC0, 0x0E,
-    0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xF0, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"k",75*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1C, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1C,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"l",76*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x7C, 0xF8, 0xF0, 0x1D, 0x3D, 0x38, 0x1E,
-    0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"m",77*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x0E, 0x61, 0xC0, 0x0E,
-    0xC0, 0xE0, 0x0F, 0x80, 0x60, 0x0F, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00,
-    0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70,
-    0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E,
-    0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x7F, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"n",78*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xC3, 0x80, 0x03,
-    0x00, 0xC0, 0x06, 0x00, 0x60, 0x0E, 0x00, 0x30, 0x1C, 0x00, 0x38, 0x1C, 0x00, 0x38, 0x18, 0x00,
-    0x18, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C,
-    0x38, 0x00, 0x1C, 0x38, 0x00, 0x1C, 0x1C, 0x00, 0x38, 0x1C, 0x00, 0x38, 0x0C, 0x00, 0x30, 0x06,
-    0x00, 0x60, 0x07, 0x00, 0xC0, 0x01, 0xC1, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"o",79*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x7E, 0x60, 0xC0, 0x0E,
-    0x80, 0x60, 0x0F, 0x00, 0x30, 0x0F, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x1C, 0x0E, 0x00,
-    0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C,
-    0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0F,
-    0x00, 0x70, 0x0F, 0x80, 0xE0, 0x0E, 0xC1, 0xC0, 0x0E, 0x3F, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, /*"p",80*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x10, 0x01, 0x83, 0x30, 0x07,
-    0x01, 0xF0, 0x0E, 0x00, 0xF0, 0x0C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x38, 0x00,
-    0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x70,
-    0x38, 0x00, 0x70, 0x38, 0x00, 0x70, 0x18, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x70, 0x0C,
-    0x00, 0xF0, 0x06, 0x01, 0xF0, 0x03, 0x83, 0x70, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, /*"q",81*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x3F, 0xC0, 0xF0, 0x01, 0xC3, 0x1C, 0x01,
-    0xC6, 0x1C, 0x01, 0xC8, 0x1C, 0x01, 0xD8, 0x1C, 0x01, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0,
-    0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00,
-    0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01,
-    0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"r",82*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xC1, 0xC0, 0x03,
-    0x80, 0xE0, 0x07, 0x00, 0x60, 0x07, 0x00, 0x60, 0x07, 0x00, 0x20, 0x07, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xE0,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x08, 0x00, 0x70, 0x08, 0x00, 0x70, 0x0C, 0x00, 0x70, 0x0C,
-    0x00, 0x60, 0x0E, 0x00, 0xE0, 0x0F, 0x81, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"s",83*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x10, 0x00, 0x70, 0x10, 0x00,
-    0x70, 0x20, 0x00, 0x38, 0x20, 0x00, 0x18, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"t",84*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x7E, 0x03, 0xF0, 0x0E, 0x00, 0x70, 0x0E,
-    0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00,
-    0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70,
-    0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0xF0, 0x06,
-    0x00, 0xF0, 0x07, 0x01, 0x70, 0x03, 0x82, 0x7E, 0x01, 0xFC, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"u",85*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFC, 0x0F, 0x00, 0x70, 0x07,
-    0x00, 0x60, 0x07, 0x00, 0x60, 0x03, 0x00, 0x40, 0x03, 0x80, 0x40, 0x03, 0x80, 0xC0, 0x01, 0x80,
-    0x80, 0x01, 0xC0, 0x80, 0x01, 0xC1, 0x80, 0x00, 0xC1, 0x00, 0x00, 0xE1, 0x00, 0x00, 0xE3, 0x00,
-    0x00, 0xE2, 0x00, 0x00, 0x62, 0x00, 0x00, 0x76, 0x00, 0x00, 0x74, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"v",86*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7E, 0x3F, 0x38, 0x3C, 0x0C, 0x38,
-    0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x1C, 0x18, 0x1C, 0x1C, 0x18, 0x1C, 0x1C, 0x10, 0x1C, 0x3C,
-    0x10, 0x0C, 0x2E, 0x30, 0x0E, 0x2E, 0x30, 0x0E, 0x26, 0x20, 0x0E, 0x66, 0x20, 0x06, 0x46, 0x20,
-    0x07, 0x47, 0x60, 0x07, 0xC7, 0x40, 0x07, 0xC3, 0x40, 0x03, 0x83, 0x40, 0x03, 0x83, 0xC0, 0x03,
-    0x83, 0x80, 0x03, 0x81, 0x80, 0x01, 0x81, 0x80, 0x01, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"w",87*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE3, 0xF8, 0x07, 0x80, 0xE0, 0x03,
-    0x80, 0xC0, 0x01, 0xC0, 0x80, 0x01, 0xC1, 0x80, 0x00, 0xE3, 0x00, 0x00, 0x72, 0x00, 0x00, 0x76,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x67, 0x00, 0x00, 0x67, 0x00, 0x00, 0xC3, 0x80, 0x00, 0x83, 0x80, 0x01, 0x81, 0xC0, 0x03,
-    0x00, 0xC0, 0x03, 0x00, 0xE0, 0x07, 0x00, 0xF0, 0x3F, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"x",88*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x0F, 0x00, 0xE0, 0x07,
-    0x00, 0x60, 0x07, 0x00, 0x40, 0x03, 0x00, 0xC0, 0x03, 0x80, 0x80, 0x03, 0x80, 0x80, 0x01, 0x81,
-    0x80, 0x01, 0xC1, 0x00, 0x01, 0xC1, 0x00, 0x00, 0xC3, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x62, 0x00,
-    0x00, 0x66, 0x00, 0x00, 0x74, 0x00, 0x00, 0x34, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x30, 0x00, 0x00, 0x20,
-    0x00, 0x0C, 0x60, 0x00, 0x1E, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, /*"y",89*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x0E, 0x00, 0xF0, 0x1C,
-    0x00, 0xE0, 0x18, 0x01, 0xC0, 0x18, 0x03, 0xC0, 0x10, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xC0, 0x08, 0x03, 0x80, 0x18, 0x07, 0x80, 0x18, 0x07,
-    0x00, 0x30, 0x0E, 0x00, 0x30, 0x1E, 0x00, 0xF0, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"z",90*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xC0, 0x00,
-    0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"{",91*/
-
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, /*"|",92*/
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x00, 0x01, 0x80,
-    0x00, 0x03, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"}",93*/
+    0x33, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x8C, 0x62, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x80, 0x00,
+    0x00, 0x00, 0x3B, 0xFF, 0xFB, 0x80, /*"!",1*/
+    0x62, 0x62, 0x64, 0x44, 0x45, 0x35, 0x45, 0x35, 0x35, 0x35, 0x44, 0x44, 0x44, 0x44, 0x53, 0x53,
+    0x53, 0x53, 0x62, 0x62, 0x62, 0x62, 0x71, 0x71, 0x80, /*""",2*/
+    0x52, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x4F, 0xFF, 0xFF, 0x54, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x19, 0x19, 0x19, 0x15, 0xFF, 0xFF, 0xF5, 0x32, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x50, /*"#",3*/
+    0x82, 0xF0, 0x2F, 0x02, 0xD7, 0x83, 0x12, 0x23, 0x52, 0x32, 0x33, 0x33, 0x32, 0x42, 0x32, 0x42,
+    0x43, 0x13, 0x42, 0x43, 0x13, 0x42, 0x34, 0x13, 0x42, 0x34, 0x13, 0x42, 0x33, 0x24, 0x32, 0x94,
+    0x22, 0x95, 0x12, 0xA7, 0xB6, 0xC6, 0xC6, 0xC6, 0xC6, 0xB7, 0xA2, 0x15, 0x92, 0x24, 0x92, 0x34,
+    0x82, 0x34, 0x13, 0x42, 0x47, 0x42, 0x47, 0x42, 0x47, 0x42, 0x46, 0x52, 0x43, 0x12, 0x52, 0x42,
+    0x22, 0x52, 0x33, 0x32, 0x42, 0x32, 0x52, 0x32, 0x13, 0x87, 0xD2, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
+    0x02, 0x70, /*"$",4*/
+    0x1E, 0x00, 0x40, 0xC4, 0x03, 0x06, 0x18, 0x08, 0x10, 0x20, 0x60, 0xC0, 0xC1, 0x03, 0x03, 0x04,
+    0x0C, 0x0C, 0x30, 0x30, 0x30, 0x80, 0xC0, 0xC6, 0x03, 0x03, 0x10, 0x0C, 0x0C, 0x40, 0x30, 0x33,
+    0x00, 0xC0, 0xC8, 0x01, 0x82, 0x60, 0x06, 0x19, 0x00, 0x0C, 0xC4, 0x00, 0x1E, 0x31, 0xE0, 0x00,
+    0x8C, 0xC0, 0x06, 0x61, 0x80, 0x11, 0x86, 0x00, 0x44, 0x08, 0x03, 0x30, 0x30, 0x08, 0xC0, 0xC0,
+    0x23, 0x03, 0x01, 0x0C, 0x0C, 0x04, 0x30, 0x30, 0x30, 0xC0, 0xC0, 0x83, 0x03, 0x02, 0x0C, 0x0C,
+    0x10, 0x10, 0x20, 0x40, 0x61, 0x83, 0x00, 0xCC, 0x08, 0x01, 0xE0, /*"%",5*/
+    0x65, 0xF1, 0x22, 0x3E, 0x33, 0x2E, 0x24, 0x3C, 0x34, 0x3C, 0x34, 0x3C, 0x34, 0x3C, 0x34, 0x3C,
+    0x34, 0x3C, 0x34, 0x2D, 0x33, 0x3D, 0x42, 0x2F, 0x03, 0x13, 0xF0, 0x31, 0x2F, 0x14, 0xF3, 0x44,
+    0x85, 0x11, 0x37, 0x36, 0x21, 0x46, 0x26, 0x32, 0x36, 0x26, 0x23, 0x45, 0x26, 0x23, 0x45, 0x25,
+    0x34, 0x44, 0x16, 0x34, 0x44, 0x16, 0x35, 0x42, 0x26, 0x36, 0x32, 0x26, 0x36, 0x41, 0x17, 0x37,
+    0x57, 0x47, 0x39, 0x37, 0x46, 0x11, 0x46, 0x54, 0x22, 0x44, 0x21, 0x43, 0x14, 0x83, 0x75, 0x57,
+    0x33, /*"&",6*/
+    0x38, 0xF9, 0xFB, 0xF3, 0xE1, 0xC3, 0x86, 0x18, 0x71, 0xC6, 0x00, /*"'",7*/
+    0xA1, 0x91, 0x92, 0x82, 0x82, 0x82, 0x91, 0x92, 0x82, 0x92, 0x82, 0x92, 0x92, 0x82, 0x92, 0x92,
+    0x82, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xA2, 0x92, 0x92, 0xA1, 0xA2,
+    0x92, 0xA2, 0x92, 0xA2, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xB1, /*"(",8*/
+    0x01, 0xB1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA2, 0xA2, 0x92, 0xA2, 0x92, 0x92, 0xA2, 0x92, 0x92,
+    0xA2, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x82, 0x92, 0x92, 0x91, 0x92,
+    0x92, 0x82, 0x92, 0x82, 0x91, 0x92, 0x82, 0x82, 0x82, 0x91, 0x91, 0xA0, /*")",9*/
+    0x93, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xA2, 0x63, 0x53, 0x15, 0x43, 0x4B, 0x41, 0x46, 0x16,
+    0x31, 0x36, 0x45, 0x21, 0x25, 0x93, 0x11, 0x13, 0xF0, 0x3F, 0x33, 0xF0, 0x31, 0x11, 0x39, 0x52,
+    0x12, 0x54, 0x63, 0x13, 0x61, 0x64, 0x14, 0xB4, 0x34, 0x86, 0x36, 0x39, 0x3F, 0x33, 0xF3, 0x3F,
+    0x33, 0xF3, 0x39, /*"*",10*/
+    0x92, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32,
+    0x9F, 0xFA, 0x92, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3,
+    0x2F, 0x32, 0x90, /*"+",11*/
+    0x38, 0xF9, 0xFB, 0xF3, 0xE1, 0xC3, 0x86, 0x18, 0x71, 0xC6, 0x00, /*",",12*/
+    0x0F, 0xFA, /*"-",13*/
+    0x14, 0x1F, 0x91, 0x41, /*".",14*/
+    0xF4, 0x1F, 0x32, 0xF3, 0x1F, 0x32, 0xF3, 0x1F, 0x32, 0xF3, 0x1F, 0x32, 0xF3, 0x1F, 0x41, 0xF3,
+    0x1F, 0x41, 0xF3, 0x1F, 0x41, 0xF3, 0x2F, 0x31, 0xF3, 0x2F, 0x31, 0xF3, 0x2F, 0x31, 0xF3, 0x2F,
+    0x31, 0xF3, 0x2F, 0x31, 0xF3, 0x2F, 0x31, 0xF3, 0x2F, 0x31, 0xF4, 0x1F, 0x31, 0xF4, 0x1F, 0x31,
+    0xF4, 0x1F, 0x32, 0xF3, 0x1F, 0x32, 0xF3, 0x1F, 0x32, 0xF3, 0x1F, 0x32, 0xF3, 0x1F, 0x40, /*"/",15*/
+    0x76, 0xC3, 0x43, 0x93, 0x72, 0x82, 0x83, 0x62, 0xA2, 0x53, 0xA3, 0x42, 0xC2, 0x33, 0xC3, 0x23,
+    0xC3, 0x23, 0xC3, 0x22, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE3,
+    0x12, 0xE2, 0x23, 0xC3, 0x23, 0xC3, 0x23, 0xC3, 0x32, 0xC2, 0x43, 0xA3, 0x52, 0xA2, 0x72, 0x83,
+    0x73, 0x72, 0xA2, 0x43, 0xC6, 0x70, /*"0",16*/
+    0x71, 0xB2, 0xA3, 0x58, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+    0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0x95,
+    0x4D, /*"1",17*/
+    0x77, 0xA2, 0x54, 0x62, 0x93, 0x42, 0xB3, 0x32, 0xB3, 0x23, 0xC3, 0x13, 0xC3, 0x13, 0xC3, 0x14,
+    0xB3, 0x14, 0xB3, 0x23, 0xB3, 0xF0, 0x3F, 0x13, 0xF0, 0x3F, 0x13, 0xF0, 0x3F, 0x03, 0xF0, 0x3F,
+    0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3C, 0x13, 0x2D, 0x12, 0x2D,
+    0x21, 0x3D, 0x11, 0x3C, 0x31, 0xF3, 0x1F, 0x31, 0xF3, 0x10, /*"2",18*/
+    0x66, 0xA2, 0x53, 0x71, 0x83, 0x51, 0xA3, 0x32, 0xA3, 0x32, 0xB3, 0x23, 0xA3, 0x23, 0xA3, 0x32,
+    0xA3, 0xF0, 0x3F, 0x02, 0xF0, 0x3F, 0x02, 0xF0, 0x2E, 0x3B, 0x5F, 0x23, 0xF2, 0x3F, 0x13, 0xF1,
+    0x3F, 0x12, 0xF1, 0x3F, 0x03, 0xF0, 0x31, 0x2C, 0x7B, 0x7B, 0x7B, 0x21, 0x3B, 0x32, 0x2B, 0x24,
+    0x29, 0x26, 0x26, 0x39, 0x76, /*"3",19*/
+    0xD2, 0xF2, 0x3F, 0x23, 0xF1, 0x4F, 0x05, 0xF0, 0x11, 0x3E, 0x12, 0x3E, 0x12, 0x3D, 0x13, 0x3C,
+    0x23, 0x3C, 0x14, 0x3B, 0x24, 0x3B, 0x15, 0x3A, 0x16, 0x39, 0x26, 0x39, 0x17, 0x38, 0x27, 0x38,
+    0x18, 0x37, 0x28, 0x36, 0x29, 0x36, 0x29, 0x35, 0x2A, 0x35, 0xF5, 0xC3, 0xF2, 0x3F, 0x23, 0xF2,
+    0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x15, 0xBD, /*"4",20*/
+    0x2F, 0x03, 0xF0, 0x3F, 0x03, 0x1F, 0x21, 0xF2, 0x1F, 0x21, 0xF2, 0x1F, 0x12, 0xF1, 0x2F, 0x12,
+    0xF1, 0x2F, 0x12, 0x37, 0x62, 0x29, 0x52, 0x12, 0x64, 0x34, 0x83, 0x33, 0xA3, 0x22, 0xB3, 0xF0,
+    0x4F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x31, 0x2C, 0x7B, 0x7B, 0x7B, 0x21, 0x3B, 0x32, 0x2B, 0x32,
+    0x2A, 0x34, 0x29, 0x26, 0x35, 0x39, 0x76, /*"5",21*/
+    0x96, 0xB3, 0x61, 0x92, 0x82, 0x72, 0x93, 0x52, 0xA3, 0x52, 0xA3, 0x42, 0xF3, 0x2F, 0x23, 0xF2,
+    0x3F, 0x22, 0xF3, 0x2F, 0x23, 0x56, 0x63, 0x3A, 0x43, 0x23, 0x54, 0x33, 0x12, 0x93, 0x25, 0xB3,
+    0x14, 0xC3, 0x14, 0xD6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE3, 0x12, 0xE3, 0x13, 0xD3, 0x13, 0xD2, 0x32,
+    0xC3, 0x33, 0xB3, 0x43, 0xA2, 0x63, 0x82, 0x83, 0x53, 0xB7, 0x60, /*"6",22*/
+    0x1F, 0x21, 0xF2, 0x1F, 0x12, 0x3B, 0x22, 0x2C, 0x12, 0x2C, 0x13, 0x2B, 0x23, 0x1C, 0x1F, 0x12,
+    0xF1, 0x1F, 0x12, 0xF1, 0x1F, 0x12, 0xF1, 0x2F, 0x02, 0xF1, 0x2F, 0x02, 0xF1, 0x2F, 0x12, 0xF0,
+    0x3F, 0x02, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0,
+    0x2A, /*"7",23*/
+    0x77, 0x93, 0x63, 0x63, 0x83, 0x43, 0xA3, 0x33, 0xA3, 0x23, 0xC3, 0x13, 0xC3, 0x13, 0xC3, 0x13,
+    0xC3, 0x14, 0xB3, 0x14, 0xB2, 0x34, 0x93, 0x45, 0x63, 0x56, 0x43, 0x86, 0x13, 0xA7, 0xA3, 0x16,
+    0x83, 0x46, 0x53, 0x75, 0x42, 0x94, 0x33, 0xA4, 0x23, 0xB3, 0x13, 0xC7, 0xD6, 0xD6, 0xD6, 0xD3,
+    0x12, 0xD2, 0x23, 0xB3, 0x32, 0xB2, 0x52, 0x92, 0x73, 0x62, 0xA7, 0x60, /*"8",24*/
+    0x66, 0xB3, 0x52, 0x82, 0x82, 0x63, 0x92, 0x43, 0xB2, 0x33, 0xB2, 0x32, 0xC3, 0x13, 0xD2, 0x13,
+    0xD2, 0x13, 0xD6, 0xD6, 0xD6, 0xD6, 0xD7, 0xB4, 0x13, 0xA5, 0x13, 0xA1, 0x13, 0x14, 0x82, 0x13,
+    0x25, 0x43, 0x23, 0x3A, 0x33, 0x56, 0x53, 0xF0, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x2F, 0x13,
+    0x43, 0x92, 0x53, 0x83, 0x53, 0x73, 0x63, 0x63, 0x82, 0x53, 0xB6, 0x80, /*"9",25*/
+    0x13, 0x1F, 0x01, 0x3F, 0xFF, 0xF7, 0x31, 0xF0, 0x13, 0x10, /*":",26*/
+    0x0F, 0x1F, 0xFF, 0x7F, 0x12, 0x21, 0x22, 0x22, 0x12, 0x22, /*";",27*/
+    0xF1, 0x1F, 0x13, 0xE3, 0xE3, 0xE3, 0xE3, 0xE2, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
+    0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22,
+    0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x11, 0x10, /*"<",28*/
+    0x0F, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xA0, /*"=",29*/
+    0x11, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22,
+    0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0,
+    0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xF1, 0x1F, 0x10, /*">",30*/
+    0x67, 0xAB, 0x73, 0x64, 0x52, 0x94, 0x32, 0xB4, 0x21, 0xD3, 0x12, 0xD6, 0xD8, 0xB9, 0xA9, 0xA4,
+    0x14, 0xA4, 0xE4, 0xE5, 0xD5, 0xD4, 0xE3, 0xF0, 0x3F, 0x03, 0xF1, 0x2F, 0x22, 0xF2, 0x2F, 0x22,
+    0xF2, 0x2F, 0x22, 0xFF, 0xFF, 0xE3, 0xF0, 0x5E, 0x5E, 0x5F, 0x03, 0x80, /*"?",31*/
+    0x00, 0xFC, 0x00, 0x1C, 0x18, 0x01, 0x80, 0x60, 0x18, 0x00, 0x81, 0xC0, 0x06, 0x0C, 0x00, 0x18,
+    0xC0, 0x76, 0xC6, 0x06, 0x76, 0x70, 0x73, 0x9B, 0x83, 0x1C, 0xD8, 0x38, 0xC7, 0xC1, 0x86, 0x3E,
+    0x1C, 0x31, 0xF0, 0xE1, 0x8F, 0x86, 0x0C, 0x7C, 0x30, 0xE3, 0xE3, 0x87, 0x1F, 0x1C, 0x30, 0xF8,
+    0xE1, 0x87, 0xC7, 0x0C, 0x6E, 0x38, 0x63, 0x71, 0xC7, 0x19, 0xCE, 0x39, 0x8E, 0x32, 0xCC, 0x71,
+    0xF7, 0xC1, 0x87, 0x1C, 0x0E, 0x00, 0x06, 0x70, 0x00, 0x21, 0xC0, 0x03, 0x07, 0x00, 0x70, 0x1E,
+    0x0F, 0x00, 0x7F, 0xF0, 0x00, 0xFC, 0x00, /*"@",32*/
+    0xA3, 0xF5, 0x3F, 0x45, 0xF3, 0x5F, 0x35, 0xF3, 0x12, 0x2F, 0x22, 0x22, 0xF2, 0x22, 0x3F, 0x11,
+    0x33, 0xF1, 0x14, 0x2F, 0x02, 0x42, 0xF0, 0x24, 0x3E, 0x15, 0x3E, 0x16, 0x2D, 0x26, 0x2D, 0x26,
+    0x3C, 0x17, 0x3C, 0x17, 0x3B, 0x28, 0x2B, 0xDA, 0x19, 0x3A, 0x19, 0x39, 0x2A, 0x29, 0x2A, 0x38,
+    0x1B, 0x38, 0x1B, 0x37, 0x2B, 0x37, 0x2C, 0x36, 0x2C, 0x36, 0x2C, 0x35, 0x3C, 0x35, 0x3C, 0x42,
+    0x78, 0x80, /*"A",33*/
+    0x0F, 0x09, 0x37, 0x47, 0x39, 0x36, 0x3A, 0x35, 0x3B, 0x34, 0x3B, 0x34, 0x3B, 0x34, 0x3B, 0x34,
+    0x3B, 0x34, 0x3B, 0x34, 0x3B, 0x34, 0x3A, 0x35, 0x3A, 0x35, 0x39, 0x36, 0x37, 0x38, 0xBA, 0x38,
+    0x37, 0x3A, 0x26, 0x3A, 0x35, 0x3B, 0x34, 0x3B, 0x34, 0x3C, 0x33, 0x3C, 0x33, 0x3C, 0x33, 0x3C,
+    0x33, 0x3C, 0x33, 0x3C, 0x33, 0x3C, 0x33, 0x3B, 0x34, 0x3B, 0x34, 0x3A, 0x35, 0x38, 0x34, 0xF0,
+    0x60, /*"B",34*/
+    0x86, 0xC3, 0x55, 0x62, 0x93, 0x52, 0xB2, 0x43, 0xB2, 0x42, 0xD1, 0x33, 0xD2, 0x22, 0xF0, 0x11,
+    0x3F, 0x23, 0xF2, 0x2F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F,
+    0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x33, 0xF0, 0x11, 0x3F, 0x01, 0x13, 0xE1, 0x33, 0xD1, 0x33,
+    0xC2, 0x43, 0xA2, 0x54, 0x82, 0x74, 0x63, 0x99, 0xD6, 0x60, /*"C",35*/
+    0x0C, 0xC4, 0x53, 0x93, 0x82, 0x83, 0x92, 0x73, 0xA2, 0x63, 0xA3, 0x53, 0xB2, 0x53, 0xB3, 0x43,
+    0xB3, 0x43, 0xB3, 0x43, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33,
+    0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC2, 0x43, 0xB3, 0x43,
+    0xB3, 0x43, 0xB3, 0x43, 0xB2, 0x53, 0xA3, 0x53, 0x93, 0x63, 0x83, 0x73, 0x73, 0x83, 0x54, 0x6C,
+    0x90, /*"D",36*/
+    0x0F, 0x36, 0x39, 0x36, 0x3A, 0x35, 0x3B, 0x25, 0x3C, 0x15, 0x3C, 0x24, 0x3D, 0x14, 0x3F, 0x33,
+    0xF3, 0x3F, 0x33, 0x91, 0x83, 0x91, 0x83, 0x91, 0x83, 0x91, 0x83, 0x82, 0x8D, 0x83, 0x73, 0x83,
+    0x82, 0x83, 0x91, 0x83, 0x91, 0x83, 0x91, 0x83, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xE1, 0x33,
+    0xE1, 0x33, 0xD1, 0x43, 0xD1, 0x43, 0xC2, 0x43, 0xB3, 0x43, 0x94, 0x2F, 0x42, /*"E",37*/
+    0x0F, 0x55, 0x3A, 0x45, 0x3B, 0x44, 0x3D, 0x24, 0x3E, 0x14, 0x3E, 0x23, 0x3F, 0x01, 0x33, 0xF4,
+    0x3F, 0x43, 0xF4, 0x3A, 0x18, 0x3A, 0x18, 0x3A, 0x18, 0x3A, 0x18, 0x39, 0x28, 0xE8, 0x38, 0x38,
+    0x39, 0x28, 0x3A, 0x18, 0x3A, 0x18, 0x3A, 0x18, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43,
+    0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x19, 0xD0, /*"F",38*/
+    0x86, 0x31, 0xA3, 0x45, 0x92, 0x83, 0x82, 0x93, 0x73, 0xA2, 0x72, 0xC1, 0x63, 0xC2, 0x52, 0xD2,
+    0x43, 0xE1, 0x43, 0xF4, 0x2F, 0x52, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4,
+    0x3A, 0xCC, 0x52, 0x3D, 0x33, 0x3D, 0x34, 0x3C, 0x34, 0x3C, 0x34, 0x3C, 0x35, 0x2C, 0x35, 0x3B,
+    0x35, 0x3B, 0x36, 0x2B, 0x37, 0x2A, 0x37, 0x38, 0x49, 0x35, 0x2E, 0x68, /*"G",39*/
+    0x09, 0x59, 0x33, 0xB3, 0x63, 0xB3, 0x63, 0xB3, 0x63, 0xB3, 0x63, 0xB3, 0x63, 0xB3, 0x63, 0xB3,
+    0x63, 0xB3, 0x63, 0xB3, 0x63, 0xB3, 0x63, 0xB3, 0x63, 0xB3, 0x63, 0xB3, 0x63, 0xB3, 0x6F, 0x26,
+    0x3B, 0x36, 0x3B, 0x36, 0x3B, 0x36, 0x3B, 0x36, 0x3B, 0x36, 0x3B, 0x36, 0x3B, 0x36, 0x3B, 0x36,
+    0x3B, 0x36, 0x3B, 0x36, 0x3B, 0x36, 0x3B, 0x36, 0x3B, 0x36, 0x3B, 0x36, 0x3B, 0x36, 0x3B, 0x33,
+    0x95, 0x90, /*"H",40*/
+    0x0F, 0x06, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x36, 0xF0, /*"I",41*/
+    0x6F, 0x0C, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33,
+    0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3,
+    0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F,
+    0x33, 0x72, 0x92, 0x74, 0x73, 0x74, 0x72, 0x84, 0x62, 0xA3, 0x52, 0xD6, 0xC0, /*"J",42*/
+    0x09, 0x48, 0x43, 0x94, 0x63, 0x93, 0x73, 0x92, 0x83, 0x82, 0x93, 0x81, 0xA3, 0x72, 0xA3, 0x62,
+    0xB3, 0x61, 0xC3, 0x52, 0xC3, 0x51, 0xD3, 0x41, 0xE3, 0x32, 0xE3, 0x33, 0xD3, 0x24, 0xD3, 0x15,
+    0xD3, 0x11, 0x23, 0xC4, 0x33, 0xC4, 0x43, 0xB3, 0x53, 0xB3, 0x63, 0xA3, 0x63, 0xA3, 0x73, 0x93,
+    0x73, 0x93, 0x73, 0x93, 0x83, 0x83, 0x83, 0x83, 0x93, 0x73, 0x93, 0x73, 0xA3, 0x63, 0xA3, 0x63,
+    0xA4, 0x29, 0x58, /*"K",43*/
+    0x09, 0xE3, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F,
+    0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23,
+    0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xD1, 0x33, 0xD1, 0x33, 0xC2, 0x33, 0xC1, 0x43, 0xB2, 0x43,
+    0xA3, 0x43, 0x94, 0x1F, 0x41, /*"L",44*/
+    0xF8, 0x00, 0xFC, 0xE0, 0x03, 0xC3, 0x80, 0x0F, 0x0F, 0x00, 0x3C, 0x3C, 0x01, 0x70, 0xF0, 0x05,
+    0xC3, 0xC0, 0x17, 0x0F, 0x00, 0x5C, 0x2E, 0x03, 0x70, 0xB8, 0x09, 0xC2, 0xE0, 0x27, 0x0B, 0x80,
+    0x9C, 0x27, 0x02, 0x70, 0x9C, 0x19, 0xC2, 0x70, 0x47, 0x09, 0xC1, 0x1C, 0x27, 0x04, 0x70, 0x8E,
+    0x31, 0xC2, 0x38, 0x87, 0x08, 0xE2, 0x1C, 0x23, 0x88, 0x70, 0x87, 0x61, 0xC2, 0x1D, 0x87, 0x08,
+    0x74, 0x1C, 0x21, 0xD0, 0x70, 0x87, 0xC1, 0xC2, 0x0F, 0x07, 0x08, 0x38, 0x1C, 0x20, 0xE0, 0x70,
+    0x83, 0x81, 0xC2, 0x06, 0x07, 0x08, 0x18, 0x1C, 0xF8, 0x43, 0xFC, /*"M",45*/
+    0x06, 0x97, 0x33, 0xC1, 0x64, 0xB1, 0x64, 0xB1, 0x65, 0xA1, 0x61, 0x13, 0xA1, 0x61, 0x14, 0x91,
+    0x61, 0x23, 0x91, 0x61, 0x24, 0x81, 0x61, 0x33, 0x81, 0x61, 0x33, 0x81, 0x61, 0x43, 0x71, 0x61,
+    0x43, 0x71, 0x61, 0x53, 0x61, 0x61, 0x53, 0x61, 0x61, 0x63, 0x51, 0x61, 0x63, 0x51, 0x61, 0x73,
+    0x41, 0x61, 0x73, 0x41, 0x61, 0x83, 0x31, 0x61, 0x83, 0x31, 0x61, 0x93, 0x21, 0x61, 0x93, 0x21,
+    0x61, 0x94, 0x11, 0x61, 0xA3, 0x11, 0x61, 0xA5, 0x61, 0xB4, 0x61, 0xB4, 0x61, 0xC3, 0x61, 0xC3,
+    0x61, 0xD2, 0x61, 0xD2, 0x37, 0xB1, 0x30, /*"N",46*/
+    0x85, 0xE2, 0x52, 0xB2, 0x81, 0x92, 0x92, 0x72, 0xB2, 0x53, 0xB3, 0x42, 0xD2, 0x33, 0xD2, 0x33,
+    0xD3, 0x23, 0xD3, 0x22, 0xF0, 0x21, 0x3F, 0x06, 0xF0, 0x6F, 0x06, 0xF0, 0x6F, 0x06, 0xF0, 0x6F,
+    0x06, 0xF0, 0x6F, 0x06, 0xF0, 0x6F, 0x03, 0x12, 0xF0, 0x22, 0x3E, 0x22, 0x3D, 0x33, 0x2D, 0x33,
+    0x2D, 0x24, 0x3B, 0x35, 0x2B, 0x27, 0x29, 0x29, 0x27, 0x2B, 0x25, 0x2E, 0x58, /*"O",47*/
+    0x0F, 0x09, 0x38, 0x37, 0x3A, 0x35, 0x3B, 0x34, 0x3B, 0x34, 0x3C, 0x33, 0x3C, 0x33, 0x3C, 0x33,
+    0x3C, 0x33, 0x3C, 0x33, 0x3C, 0x33, 0x3C, 0x33, 0x3B, 0x34, 0x3B, 0x25, 0x3A, 0x35, 0x38, 0x37,
+    0xC9, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3,
+    0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x09, 0xC0, /*"P",48*/
+    0x76, 0xC3, 0x43, 0x92, 0x82, 0x73, 0x92, 0x62, 0xA2, 0x53, 0xB2, 0x42, 0xC2, 0x33, 0xC3, 0x23,
+    0xC3, 0x22, 0xE2, 0x22, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+    0xE3, 0x12, 0x35, 0x62, 0x23, 0x17, 0x52, 0x23, 0x12, 0x33, 0x33, 0x34, 0x43, 0x33, 0x34, 0x53,
+    0x22, 0x52, 0x63, 0x12, 0x63, 0x53, 0x12, 0x72, 0x64, 0x93, 0x43, 0xC8, 0xF2, 0x42, 0x1E, 0x6E,
+    0x5F, 0x13, 0x30, /*"Q",49*/
+    0x0F, 0x0A, 0x37, 0x48, 0x39, 0x37, 0x3A, 0x36, 0x3A, 0x45, 0x3B, 0x35, 0x3B, 0x35, 0x3B, 0x35,
+    0x3B, 0x35, 0x3B, 0x35, 0x3B, 0x35, 0x3A, 0x36, 0x3A, 0x36, 0x39, 0x37, 0x37, 0x48, 0xCA, 0x35,
+    0x2C, 0x35, 0x3B, 0x35, 0x3B, 0x36, 0x3A, 0x36, 0x3A, 0x36, 0x3A, 0x37, 0x39, 0x37, 0x39, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x37, 0x39, 0x37, 0x39, 0x46, 0x3A, 0x36, 0x3A, 0x42, 0x98,
+    0x50, /*"R",50*/
+    0x67, 0xA2, 0x65, 0x43, 0x93, 0x42, 0xB3, 0x23, 0xB3, 0x13, 0xD2, 0x13, 0xD2, 0x13, 0xE1, 0x13,
+    0xF1, 0x3F, 0x14, 0xF1, 0x4F, 0x06, 0xE7, 0xE7, 0xD8, 0xD7, 0xF0, 0x6E, 0x6F, 0x05, 0xF0, 0x4F,
+    0x14, 0xF1, 0x3F, 0x14, 0xF0, 0x5E, 0x5E, 0x31, 0x1E, 0x22, 0x2C, 0x32, 0x3B, 0x23, 0x49, 0x33,
+    0x66, 0x25, 0x15, 0x66, /*"S",51*/
+    0x2F, 0x32, 0x35, 0x35, 0x32, 0x26, 0x36, 0x22, 0x26, 0x37, 0x12, 0x17, 0x37, 0x11, 0x27, 0x37,
+    0x38, 0x38, 0x19, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F,
+    0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33,
+    0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x09, 0x60, /*"T",52*/
+    0x09, 0x77, 0x33, 0xD1, 0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1,
+    0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1,
+    0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1,
+    0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1, 0x63, 0xD1, 0x72, 0xC1, 0x83, 0xA2, 0x93, 0x82, 0xB3, 0x61,
+    0xF0, 0x78, /*"U",53*/
+    0x08, 0x77, 0x24, 0xB3, 0x53, 0xB2, 0x63, 0xB2, 0x63, 0xB2, 0x64, 0xA1, 0x83, 0xA1, 0x83, 0x92,
+    0x83, 0x92, 0x83, 0x91, 0xA3, 0x81, 0xA3, 0x72, 0xA3, 0x71, 0xB3, 0x71, 0xC3, 0x61, 0xC3, 0x52,
+    0xC3, 0x51, 0xD3, 0x51, 0xE3, 0x41, 0xE3, 0x32, 0xE3, 0x31, 0xF0, 0x33, 0x1F, 0x04, 0x21, 0xF1,
+    0x31, 0x2F, 0x13, 0x11, 0xF2, 0x31, 0x1F, 0x25, 0xF3, 0x4F, 0x33, 0xF4, 0x3F, 0x43, 0xF5, 0x1F,
+    0x61, 0xB0, /*"V",54*/
+    0x07, 0x26, 0x36, 0x23, 0x63, 0x62, 0x43, 0x63, 0x62, 0x43, 0x63, 0x62, 0x43, 0x63, 0x61, 0x53,
+    0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x63, 0x53, 0x52, 0x63, 0x54, 0x42, 0x63, 0x54,
+    0x41, 0x73, 0x54, 0x41, 0x73, 0x45, 0x41, 0x82, 0x45, 0x41, 0x82, 0x41, 0x13, 0x32, 0x83, 0x31,
+    0x22, 0x31, 0x93, 0x31, 0x23, 0x21, 0x93, 0x22, 0x23, 0x21, 0x93, 0x22, 0x23, 0x21, 0xA2, 0x21,
+    0x33, 0x12, 0xA2, 0x21, 0x33, 0x12, 0xA2, 0x21, 0x42, 0x11, 0xB5, 0x42, 0x11, 0xB5, 0x44, 0xB4,
+    0x54, 0xB4, 0x54, 0xC3, 0x54, 0xC3, 0x53, 0xD3, 0x62, 0xD2, 0x72, 0xD2, 0x72, 0xD2, 0x72, 0xE1,
+    0x72, 0x70, /*"W",55*/
+    0x17, 0x67, 0x43, 0xA3, 0x63, 0xA2, 0x83, 0x92, 0x83, 0x82, 0xA3, 0x72, 0xA3, 0x62, 0xC3, 0x52,
+    0xC3, 0x42, 0xE3, 0x32, 0xE3, 0x31, 0xF0, 0x41, 0x2F, 0x13, 0x11, 0xF2, 0x5F, 0x33, 0xF4, 0x3F,
+    0x53, 0xF3, 0x4F, 0x35, 0xF1, 0x21, 0x3F, 0x12, 0x13, 0xF0, 0x23, 0x3E, 0x23, 0x3E, 0x15, 0x3C,
+    0x25, 0x3C, 0x17, 0x3A, 0x27, 0x3A, 0x18, 0x48, 0x29, 0x38, 0x29, 0x46, 0x2B, 0x35, 0x3B, 0x42,
+    0x77, 0x80, /*"X",56*/
+    0x08, 0x67, 0x24, 0xA3, 0x53, 0xA2, 0x63, 0xA2, 0x63, 0xA1, 0x83, 0x82, 0x83, 0x81, 0x93, 0x81,
+    0xA3, 0x62, 0xA3, 0x61, 0xB4, 0x51, 0xC3, 0x42, 0xC3, 0x41, 0xE3, 0x31, 0xE3, 0x31, 0xE3, 0x21,
+    0xF1, 0x31, 0x1F, 0x15, 0xF1, 0x4F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33,
+    0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF0, 0x96, /*"Y",57*/
+    0x3F, 0x23, 0x49, 0x33, 0x49, 0x43, 0x2B, 0x34, 0x2A, 0x43, 0x2B, 0x34, 0x1B, 0x4F, 0x13, 0xF1,
+    0x4F, 0x13, 0xF1, 0x4F, 0x13, 0xF1, 0x4F, 0x13, 0xF1, 0x4F, 0x13, 0xF1, 0x4F, 0x13, 0xF1, 0x4F,
+    0x13, 0xF1, 0x4F, 0x13, 0xF1, 0x4F, 0x13, 0xF1, 0x4F, 0x13, 0xF1, 0x4C, 0x13, 0x3C, 0x22, 0x4C,
+    0x13, 0x3C, 0x22, 0x4B, 0x32, 0x3A, 0x42, 0xF3, 0x20, /*"Z",58*/
+    0x0F, 0xBA, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+    0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+    0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0xF9, /*"[",59*/
+    0x02, 0xF1, 0x2F, 0x13, 0xF1, 0x2F, 0x12, 0xF2, 0x2F, 0x12, 0xF1, 0x3F, 0x12, 0xF1, 0x2F, 0x22,
+    0xF1, 0x2F, 0x22, 0xF1, 0x2F, 0x13, 0xF1, 0x2F, 0x12, 0xF2, 0x2F, 0x12, 0xF1, 0x3F, 0x12, 0xF1,
+    0x2F, 0x22, 0xF1, 0x2F, 0x22, 0xF1, 0x2F, 0x12, 0xF2, 0x2F, 0x12, 0xF2, 0x2F, 0x12, 0xF1, 0x3F,
+    0x12, 0xF1, 0x2F, 0x22, 0xF1, 0x2F, 0x22, 0xF1, 0x2F, 0x12, 0xF2, 0x20, /*"\",60*/
+    0x0F, 0x7A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0xF8, /*"]",61*/
+    0x0F, 0x80, 0xEE, 0x0E, 0x18, 0xC0, 0x68, 0x00, 0x80, /*"^",62*/
+    0x0F, 0x90, /*"_",63*/
+    0x06, 0x65, 0x74, 0x83, 0xA1, /*"`",64*/
+    0x67, 0xC2, 0x63, 0x82, 0x93, 0x63, 0xA3, 0x53, 0xA3, 0x53, 0xA3, 0x53, 0xA3, 0xF3, 0x3E, 0x7A,
+    0x44, 0x38, 0x37, 0x36, 0x39, 0x35, 0x3A, 0x35, 0x3A, 0x34, 0x3B, 0x34, 0x3B, 0x34, 0x3B, 0x34,
+    0x3B, 0x33, 0x4B, 0x33, 0x11, 0x38, 0x53, 0x12, 0x35, 0x31, 0x32, 0x15, 0x74, 0x42, /*"a",65*/
+    0x51, 0xF3, 0x2E, 0x6F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F,
+    0x23, 0xF2, 0x34, 0x58, 0x32, 0x24, 0x36, 0x31, 0x26, 0x35, 0x58, 0x34, 0x49, 0x34, 0x4A, 0x24,
+    0x3B, 0x33, 0x3B, 0x33, 0x3B, 0x33, 0x3B, 0x33, 0x3B, 0x33, 0x3B, 0x33, 0x3B, 0x33, 0x3B, 0x33,
+    0x3B, 0x33, 0x3B, 0x24, 0x3A, 0x34, 0x3A, 0x34, 0x49, 0x25, 0x48, 0x26, 0x22, 0x25, 0x27, 0x15,
+    0x56, /*"b",66*/
+    0x76, 0xA3, 0x52, 0x63, 0x82, 0x52, 0x93, 0x33, 0x93, 0x23, 0xA3, 0x23, 0xA3, 0x13, 0xF0, 0x3F,
+    0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x12, 0xE1, 0x13, 0xD1, 0x13, 0xC1, 0x33,
+    0xA2, 0x43, 0x82, 0x63, 0x62, 0x97, 0x50, /*"c",67*/
+    0xF1, 0x1F, 0x32, 0xE6, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23,
+    0xF2, 0x39, 0x53, 0x37, 0x34, 0x21, 0x36, 0x28, 0x45, 0x39, 0x34, 0x3A, 0x34, 0x3A, 0x34, 0x3A,
+    0x33, 0x3B, 0x33, 0x3B, 0x33, 0x3B, 0x33, 0x3B, 0x33, 0x3B, 0x33, 0x3B, 0x33, 0x3B, 0x33, 0x3B,
+    0x34, 0x2B, 0x34, 0x3A, 0x34, 0x39, 0x45, 0x29, 0x46, 0x27, 0x11, 0x37, 0x25, 0x12, 0x65, 0x63,
+    0x24, /*"d",68*/
+    0x66, 0xA3, 0x52, 0x73, 0x72, 0x53, 0x92, 0x42, 0xA3, 0x23, 0xB2, 0x22, 0xC6, 0xC6, 0xC6, 0xCF,
+    0x9F, 0x03, 0xF0, 0x3F, 0x03, 0xF1, 0x2F, 0x13, 0xC1, 0x23, 0xB1, 0x43, 0xA1, 0x53, 0x81, 0x73,
+    0x52, 0xA6, 0x60, /*"e",69*/
+    0xB7, 0xC3, 0x62, 0x92, 0x83, 0x73, 0x83, 0x63, 0x93, 0x63, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33,
+    0xCF, 0x2A, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33,
+    0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xDE,
+    0x60, /*"f",70*/
+    0x57, 0x43, 0x42, 0x58, 0x32, 0x73, 0x22, 0x23, 0x73, 0x53, 0x93, 0x43, 0x93, 0x43, 0x93, 0x43,
+    0x93, 0x43, 0x93, 0x53, 0x82, 0x72, 0x73, 0x82, 0x53, 0x73, 0x16, 0x83, 0xF1, 0x3F, 0x13, 0xF1,
+    0x8C, 0xD7, 0xE3, 0x38, 0x53, 0x2B, 0x41, 0x3C, 0x31, 0x3C, 0x31, 0x3C, 0x31, 0x3C, 0x23, 0x3A,
+    0x34, 0x46, 0x39, 0x86, /*"g",71*/
+    0x51, 0xF5, 0x2F, 0x16, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43,
+    0xF4, 0x3F, 0x43, 0x46, 0x93, 0x22, 0x43, 0x83, 0x12, 0x63, 0x75, 0x83, 0x64, 0x93, 0x63, 0xA3,
+    0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3,
+    0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x39, 0x49, /*"h",72*/
+    0x63, 0xB5, 0xA5, 0xA5, 0xB3, 0xFF, 0xFF, 0xFD, 0x26, 0x9C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x36, 0xF0, /*"i",73*/
+    0xC3, 0xC5, 0xB5, 0xB5, 0xC3, 0xFF, 0xFF, 0xFF, 0x42, 0x88, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+    0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+    0x13, 0x92, 0x23, 0x83, 0x23, 0x73, 0x43, 0x52, 0x77, 0x70, /*"j",74*/
+    0x51, 0xF4, 0x2F, 0x06, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33,
+    0xF3, 0x3F, 0x33, 0x67, 0x53, 0x82, 0x83, 0x72, 0x93, 0x72, 0x93, 0x62, 0xA3, 0x52, 0xB3, 0x42,
+    0xC3, 0x32, 0xD3, 0x33, 0xC3, 0x24, 0xC3, 0x12, 0x13, 0xB5, 0x23, 0xB4, 0x43, 0xA3, 0x63, 0x93,
+    0x63, 0x93, 0x73, 0x83, 0x73, 0x83, 0x83, 0x73, 0x93, 0x63, 0x93, 0x63, 0x94, 0x29, 0x48, /*"k",75*/
+    0x81, 0xC3, 0x69, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+    0xC3, 0x6F, 0x00, /*"l",76*/
+    0x08, 0x00, 0x01, 0xF3, 0xE3, 0xC0, 0xE9, 0xE9, 0xC1, 0xE1, 0xE1, 0xC3, 0x83, 0x83, 0x87, 0x07,
+    0x07, 0x0E, 0x0E, 0x0E, 0x1C, 0x1C, 0x1C, 0x38, 0x38, 0x38, 0x70, 0x70, 0x70, 0xE0, 0xE0, 0xE1,
+    0xC1, 0xC1, 0xC3, 0x83, 0x83, 0x87, 0x07, 0x07, 0x0E, 0x0E, 0x0E, 0x1C, 0x1C, 0x1C, 0x38, 0x38,
+    0x38, 0x70, 0x70, 0x70, 0xE0, 0xE0, 0xE1, 0xC1, 0xC1, 0xC3, 0x83, 0x83, 0x87, 0x07, 0x07, 0x3F,
+    0xBF, 0xBF, 0x80, /*"m",77*/
+    0x51, 0xF1, 0x64, 0x69, 0x32, 0x24, 0x38, 0x31, 0x26, 0x37, 0x58, 0x27, 0x49, 0x36, 0x3A, 0x36,
+    0x3A, 0x36, 0x3A, 0x36, 0x3A, 0x36, 0x3A, 0x36, 0x3A, 0x36, 0x3A, 0x36, 0x3A, 0x36, 0x3A, 0x36,
+    0x3A, 0x36, 0x3A, 0x36, 0x3A, 0x36, 0x3A, 0x36, 0x3A, 0x36, 0x3A, 0x36, 0x3A, 0x33, 0x94, 0x90, /*"n",78*/
+    0x76, 0xC3, 0x43, 0x92, 0x82, 0x72, 0xA2, 0x53, 0xB2, 0x33, 0xC3, 0x23, 0xC3, 0x22, 0xE2, 0x13,
+    0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE3, 0x13, 0xC3, 0x23, 0xC3, 0x32, 0xC2, 0x52, 0xA2, 0x63,
+    0x82, 0x93, 0x52, 0xC6, 0x70, /*"o",79*/
+    0x51, 0x45, 0x66, 0x22, 0x52, 0x73, 0x11, 0x82, 0x64, 0xA2, 0x54, 0xA3, 0x43, 0xB3, 0x43, 0xC3,
+    0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3,
+    0x33, 0xB3, 0x43, 0xB3, 0x43, 0xB3, 0x44, 0x93, 0x55, 0x73, 0x63, 0x12, 0x53, 0x73, 0x36, 0x93,
+    0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF0, 0x9C, /*"p",80*/
+    0x66, 0x51, 0x82, 0x52, 0x22, 0x63, 0x75, 0x53, 0x94, 0x52, 0xB3, 0x43, 0xB3, 0x43, 0xB3, 0x33,
+    0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x42,
+    0xC3, 0x43, 0xB3, 0x43, 0xB3, 0x52, 0xA4, 0x62, 0x85, 0x73, 0x52, 0x13, 0x96, 0x33, 0xF3, 0x3F,
+    0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x09, /*"q",81*/
+    0x62, 0xC8, 0x64, 0x73, 0x42, 0x33, 0x53, 0x32, 0x43, 0x53, 0x21, 0x63, 0x53, 0x12, 0x63, 0x55,
+    0xF0, 0x4F, 0x14, 0xF1, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2,
+    0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3C, 0xE6, /*"r",82*/
+    0x56, 0x83, 0x53, 0x43, 0x73, 0x23, 0x92, 0x23, 0x92, 0x23, 0xA1, 0x23, 0xD4, 0xD5, 0xC6, 0xB8,
+    0xA7, 0xC6, 0xC4, 0xD5, 0xC4, 0xC5, 0xB5, 0xB2, 0x13, 0x93, 0x15, 0x63, 0x77, 0x40, /*"s",83*/
+    0x81, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xE3, 0xC5, 0x8F, 0x17, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x37, 0x16, 0x37, 0x16, 0x36, 0x18,
+    0x35, 0x19, 0x24, 0x1B, 0x53, /*"t",84*/
+    0x51, 0xC1, 0x36, 0x76, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3,
+    0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0xA3,
+    0x63, 0xA3, 0x63, 0xA3, 0x63, 0x94, 0x72, 0x94, 0x73, 0x71, 0x13, 0x83, 0x51, 0x26, 0x67, 0x32,
+    0x40, /*"u",85*/
+    0x08, 0x57, 0x24, 0x93, 0x53, 0x92, 0x63, 0x92, 0x72, 0x91, 0x83, 0x81, 0x83, 0x72, 0x92, 0x71,
+    0xA3, 0x61, 0xA3, 0x52, 0xB2, 0x51, 0xC3, 0x41, 0xC3, 0x32, 0xC3, 0x31, 0xE2, 0x31, 0xE3, 0x12,
+    0xE3, 0x11, 0xF1, 0x4F, 0x14, 0xF1, 0x3F, 0x32, 0xF3, 0x29, /*"v",86*/
+    0xFE, 0x7E, 0x3F, 0x38, 0x3C, 0x0C, 0x38, 0x18, 0x08, 0x18, 0x18, 0x08, 0x18, 0x1C, 0x18, 0x1C,
+    0x1C, 0x18, 0x1C, 0x1C, 0x10, 0x1C, 0x3C, 0x10, 0x0C, 0x2E, 0x30, 0x0E, 0x2E, 0x30, 0x0E, 0x26,
+    0x20, 0x0E, 0x66, 0x20, 0x06, 0x46, 0x20, 0x07, 0x47, 0x60, 0x07, 0xC7, 0x40, 0x07, 0xC3, 0x40,
+    0x03, 0x83, 0x40, 0x03, 0x83, 0xC0, 0x03, 0x83, 0x80, 0x03, 0x81, 0x80, 0x01, 0x81, 0x80, 0x01,
+    0x01, 0x80, /*"w",87*/
+    0x18, 0x37, 0x44, 0x73, 0x73, 0x72, 0x93, 0x61, 0xA3, 0x52, 0xB3, 0x32, 0xD3, 0x21, 0xE3, 0x12,
+    0xF0, 0x4F, 0x14, 0xF2, 0x3F, 0x23, 0xF1, 0x5E, 0x22, 0x3D, 0x22, 0x3C, 0x24, 0x3B, 0x15, 0x3A,
+    0x26, 0x38, 0x28, 0x28, 0x28, 0x36, 0x38, 0x42, 0x75, 0x80, /*"x",88*/
+    0x08, 0x48, 0x24, 0x83, 0x63, 0x92, 0x63, 0x91, 0x82, 0x82, 0x83, 0x71, 0x93, 0x71, 0xA2, 0x62,
+    0xA3, 0x51, 0xB3, 0x51, 0xC2, 0x42, 0xC3, 0x31, 0xE2, 0x31, 0xE2, 0x22, 0xE3, 0x11, 0xF1, 0x21,
+    0x1F, 0x14, 0xF1, 0x3F, 0x32, 0xF3, 0x2F, 0x31, 0xF4, 0x1F, 0x32, 0xF3, 0x1D, 0x23, 0x2C, 0x42,
+    0x1D, 0x7E, 0x4E, /*"y",89*/
+    0x1F, 0x12, 0x39, 0x41, 0x3A, 0x32, 0x2A, 0x33, 0x29, 0x43, 0x1A, 0x3E, 0x3E, 0x4E, 0x3E, 0x3E,
+    0x3E, 0x4E, 0x3E, 0x3E, 0x4E, 0x3A, 0x13, 0x3A, 0x22, 0x4A, 0x22, 0x3A, 0x22, 0x3B, 0x21, 0x49,
+    0x41, 0xF2, 0x10, /*"z",90*/
+    0x83, 0x62, 0x82, 0x82, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0x92, 0x92, 0x82, 0x82, 0x72, 0xB2, 0xA2, 0xA2, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xA2, 0x92, 0xA2, 0xB3, /*"{",91*/
+    0x0F, 0xFF, 0xFF, 0xF6, /*"|",92*/
+    0x03, 0xB2, 0xA2, 0xA2, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0x92, 0x92, 0xA2, 0xA2, 0xB2, 0x72, 0x82, 0x82, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x92, 0x82, 0x63, 0x80, /*"}",93*/
+    0x44, 0xF0, 0x7E, 0x14, 0x3A, 0x11, 0x16, 0x39, 0x11, 0x17, 0x37, 0x11, 0x19, 0x36, 0x11, 0x1A,
+    0x43, 0x1E, 0x7F, 0x04, 0x40, /*"~",94*/
+};
 
-    0x03, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x08, 0x70, 0x02, 0x10, 0x38, 0x02, 0x10, 0x1C, 0x04, 0x20,
-    0x0E, 0x04, 0x20, 0x07, 0x88, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*"~",94*/
+static const esp_painter_glyph_t glyphs[] = {
+    {0x0000, 0, 0, 0, 0}, /*" ",0*/
+    {0x0000, 9, 7, 5, 34}, /*"!",1*/
+    {0x8016, 3, 3, 17, 12}, /*""",2*/
+    {0x802F, 2, 8, 20, 33}, /*"#",3*/
+    {0x8069, 3, 5, 17, 41}, /*"$",4*/
+    {0x00BB, 1, 8, 22, 33}, /*"%",5*/
+    {0x8116, 1, 8, 22, 33}, /*"&",6*/
+    {0x0167, 2, 3, 7, 12}, /*"'",7*/
+    {0x8172, 10, 2, 11, 43}, /*"(",8*/
+    {0x819D, 3, 2, 11, 43}, /*")",9*/
+    {0x81C9, 1, 12, 21, 24}, /*"*",10*/
+    {0x81FC, 2, 12, 20, 24}, /*"+",11*/
+    {0x021F, 2, 35, 7, 12}, /*",",12*/
+    {0x822A, 2, 23, 20, 2}, /*"-",13*/
+    {0x822C, 3, 35, 6, 6}, /*".",14*/
+    {0x8230, 2, 4, 20, 41}, /*"/",15*/
+    {0x826F, 2, 8, 20, 33}, /*"0",16*/
+    {0x82A5, 6, 8, 13, 33}, /*"1",17*/
+    {0x82C6, 2, 8, 19, 33}, /*"2",18*/
+    {0x8300, 3, 8, 18, 33}, /*"3",19*/
+    {0x8335, 2, 8, 20, 33}, /*"4",20*/
+    {0x836E, 3, 8, 18, 33}, /*"5",21*/
+    {0x83A5, 2, 8, 20, 33}, /*"6",22*/
+    {0x83E0, 3, 8, 18, 33}, /*"7",23*/
+    {0x8411, 2, 8, 19, 33}, /*"8",24*/
+    {0x844D, 2, 8, 19, 33}, /*"9",25*/
+    {0x8489, 9, 18, 5, 23}, /*":",26*/
+    {0x8493, 10, 20, 4, 26}, /*";",27*/
+    {0x849D, 3, 8, 18, 33}, /*"<",28*/
+    {0x84CD, 2, 18, 20, 11}, /*"=",29*/
+    {0x84D6, 3, 8, 18, 33}, /*">",30*/
+    {0x8506, 2, 8, 19, 33}, /*"?",31*/
+    {0x0532, 2, 8, 21, 33}, /*"@",32*/
+    {0x8589, 0, 8, 23, 33}, /*"A",33*/
+    {0x85CB, 1, 8, 21, 33}, /*"B",34*/
+    {0x860C, 2, 8, 20, 33}, /*"C",35*/
+    {0x8646, 1, 8, 21, 33}, /*"D",36*/
+    {0x8687, 1, 8, 21, 33}, /*"E",37*/
+    {0x86C4, 1, 8, 22, 33}, /*"F",38*/
+    {0x86FE, 1, 8, 22, 33}, /*"G",39*/
+    {0x873A, 0, 8, 23, 33}, /*"H",40*/
+    {0x877C, 5, 8, 15, 33}, /*"I",41*/
+    {0x879E, 2, 8, 21, 39}, /*"J",42*/
+    {0x87DB, 1, 8, 22, 33}, /*"K",43*/
+    {0x881E, 2, 8, 20, 33}, /*"L",44*/
+    {0x0853, 1, 8, 22, 33}, /*"M",45*/
+    {0x88AE, 1, 8, 22, 33}, /*"N",46*/
+    {0x8905, 2, 8, 21, 33}, /*"O",47*/
+    {0x8942, 1, 8, 21, 33}, /*"P",48*/
+    {0x897B, 2, 8, 20, 37}, /*"Q",49*/
+    {0x89BE, 1, 8, 22, 33}, /*"R",50*/
+    {0x89FF, 2, 8, 19, 33}, /*"S",51*/
+    {0x8A33, 1, 8, 21, 33}, /*"T",52*/
+    {0x8A6D, 0, 8, 23, 33}, /*"U",53*/
+    {0x8AAF, 1, 8, 22, 33}, /*"V",54*/
+    {0x8AF1, 0, 8, 24, 33}, /*"W",55*/
+    {0x8B53, 1, 8, 22, 33}, /*"X",56*/
+    {0x8B95, 1, 8, 21, 33}, /*"Y",57*/
+    {0x8BD0, 2, 8, 20, 33}, /*"Z",58*/
+    {0x8C09, 9, 3, 12, 42}, /*"[",59*/
+    {0x8C31, 4, 6, 18, 40}, /*"\",60*/
+    {0x8C6D, 3, 3, 11, 42}, /*"]",61*/
+    {0x0C95, 6, 3, 13, 5}, /*"^",62*/
+    {0x8C9E, 0, 47, 24, 1}, /*"_",63*/
+    {0x8CA0, 4, 2, 10, 5}, /*"`",64*/
+    {0x8CA5, 2, 19, 21, 22}, /*"a",65*/
+    {0x8CD3, 1, 7, 20, 34}, /*"b",66*/
+    {0x8D14, 3, 19, 18, 22}, /*"c",67*/
+    {0x8D3B, 3, 7, 20, 34}, /*"d",68*/
+    {0x8D7C, 3, 19, 18, 22}, /*"e",69*/
+    {0x8D9F, 2, 9, 21, 32}, /*"f",70*/
+    {0x8DD0, 3, 19, 19, 28}, /*"g",71*/
+    {0x8E04, 1, 7, 22, 34}, /*"h",72*/
+    {0x8E44, 5, 8, 15, 33}, /*"i",73*/
+    {0x8E63, 4, 8, 16, 39}, /*"j",74*/
+    {0x8E8D, 1, 7, 21, 34}, /*"k",75*/
+    {0x8ECC, 5, 7, 15, 34}, /*"l",76*/
+    {0x0EEF, 1, 18, 23, 23}, /*"m",77*/
+    {0x8F32, 1, 18, 22, 23}, /*"n",78*/
+    {0x8F62, 2, 19, 20, 22}, /*"o",79*/
+    {0x8F87, 1, 19, 21, 28}, /*"p",80*/
+    {0x8FBF, 2, 19, 21, 28}, /*"q",81*/
+    {0x8FF6, 2, 18, 20, 23}, /*"r",82*/
+    {0x901E, 4, 19, 16, 22}, /*"s",83*/
+    {0x903C, 3, 12, 17, 29}, /*"t",84*/
+    {0x9061, 1, 18, 22, 23}, /*"u",85*/
+    {0x9092, 2, 19, 20, 22}, /*"v",86*/
+    {0x10BC, 0, 19, 24, 22}, /*"w",87*/
+    {0x90FE, 2, 19, 20, 22}, /*"x",88*/
+    {0x9128, 2, 19, 20, 28}, /*"y",89*/
+    {0x915B, 3, 19, 18, 22}, /*"z",90*/
+    {0x917E, 10, 3, 11, 42}, /*"{",91*/
+    {0x91A8, 11, 0, 2, 48}, /*"|",92*/
+    {0x91AC, 3, 3, 11, 42}, /*"}",93*/
+    {0x91D7, 2, 0, 21, 9}, /*"~",94*/
 };
 
 const esp_painter_basic_font_t esp_painter_basic_font_48 = {
     .bitmap = bitmap,
+    .glyphs = glyphs,
     .width = 24,
     .height = 48,
+    .first = 0x20,
+    .count = 95,
 };
 
 #endif
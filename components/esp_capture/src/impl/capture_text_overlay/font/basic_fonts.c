@@ -0,0 +1,84 @@
+/*
+ * SPDX-FileCopyrightText: 2021-2022 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+/* Generated by tools/pack_font.py: the fonts enabled in Kconfig, by size */
+
+#include <stddef.h>
+
+#include "sdkconfig.h"
+
+#include "esp_painter_font.h"
+
+#if CONFIG_ESP_PAINTER_BASIC_FONT_12
+extern const esp_painter_basic_font_t esp_painter_basic_font_12;
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_16
+extern const esp_painter_basic_font_t esp_painter_basic_font_16;
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_18
+extern const esp_painter_basic_font_t esp_painter_basic_font_18;
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_20
+extern const esp_painter_basic_font_t esp_painter_basic_font_20;
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_24
+extern const esp_painter_basic_font_t esp_painter_basic_font_24;
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_28
+extern const esp_painter_basic_font_t esp_painter_basic_font_28;
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_32
+extern const esp_painter_basic_font_t esp_painter_basic_font_32;
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_36
+extern const esp_painter_basic_font_t esp_painter_basic_font_36;
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_40
+extern const esp_painter_basic_font_t esp_painter_basic_font_40;
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_44
+extern const esp_painter_basic_font_t esp_painter_basic_font_44;
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_48
+extern const esp_painter_basic_font_t esp_painter_basic_font_48;
+#endif
+
+const esp_painter_basic_font_t *const esp_painter_basic_fonts[] = {
+#if CONFIG_ESP_PAINTER_BASIC_FONT_12
+    &esp_painter_basic_font_12,
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_16
+    &esp_painter_basic_font_16,
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_18
+    &esp_painter_basic_font_18,
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_20
+    &esp_painter_basic_font_20,
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_24
+    &esp_painter_basic_font_24,
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_28
+    &esp_painter_basic_font_28,
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_32
+    &esp_painter_basic_font_32,
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_36
+    &esp_painter_basic_font_36,
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_40
+    &esp_painter_basic_font_40,
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_44
+    &esp_painter_basic_font_44,
+#endif
+#if CONFIG_ESP_PAINTER_BASIC_FONT_48
+    &esp_painter_basic_font_48,
+#endif
+    NULL,
+};
@@ -0,0 +1,348 @@
+#!/usr/bin/env python3
+"""
+Generate the packed text overlay fonts (font/basic_font_<size>.c).
+
+Each glyph is cropped to the box of its set pixels and stored either as
+the box's bits, row-major without padding, or run-length coded, whichever
+is smaller. Runs alternate unset / set pixels over the box, starting with
+unset; each run is a sequence of 4-bit nibbles, high nibble first, where
+15 adds 15 and continues and 0-14 ends the run; a trailing pad nibble
+is never read. A per-font index gives each glyph's data
+offset (bit 15: run-length coded) and box. esp_capture_text_overlay.c
+decodes glyphs on first use into a small LRU cache.
+
+Sources:
+  --ttf FONT.ttf --sizes 12,24      rasterize a TTF at 1 bit per pixel into
+                                    monospaced cells of size/2 x size
+                                    (needs Pillow)
+  --from font/basic_font_24.c ...   repack existing font sources, raw
+                                    bitmaps or packed, pixel for pixel
+
+Besides the fonts, font/basic_fonts.c (the table of fonts) and
+font/Kconfig.fonts (one option per size) are rewritten from every
+basic_font_<size>.c in the output directory, so adding a size is one run:
+
+  tools/pack_font.py --ttf DejaVuSansMono.ttf --sizes 18 --out font
+
+Reports the raw 1-bit bitmap size and the packed size of each font.
+
+With --reference FILE nothing is packed: FILE gets the CRC-32 of every
+glyph's cell as loaded, which host/overlay/font_check compares with the
+glyphs esp_capture_text_overlay.c decodes from the packed fonts.
+"""
+
+import argparse
+import os
+import re
+import sys
+import zlib
+
+FIRST = 0x20
+COUNT = 95
+RLE_FLAG = 0x8000
+DEFAULT_ON = (12, 24)
+
+CC0_HEADER = """/*
+ * SPDX-FileCopyrightText: 2021-2022 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+"""
+
+
+# ============================================
+# Sources
+# ============================================
+
+def c_bytes(text):
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    return [int(x, 16) for x in re.findall(r'0x([0-9A-Fa-f]{1,2})\b', text)]
+
+
+def c_field(src, name):
+    m = re.search(r'\.%s\s*=\s*(\d+)' % name, src)
+    if m is None:
+        raise ValueError('no .%s' % name)
+    return int(m.group(1))
+
+
+def load_c(path):
+    """Glyphs of a font source: a list of rows of 0/1 per glyph"""
+    src = open(path).read()
+    w = c_field(src, 'width')
+    h = c_field(src, 'height')
+    bitmap = src[src.index('bitmap[]'):]
+    bitmap = bitmap[bitmap.index('{') + 1:bitmap.index('};')]
+    data = c_bytes(bitmap)
+    header = src[:src.index('*/') + 3] if src.startswith('/*') and 'SPDX' in src[:300] else None
+
+    if 'glyphs[]' not in src:
+        # Raw bitmap: COUNT glyphs of h rows of (w + 7) / 8 bytes
+        row_bytes = (w + 7) // 8
+        glyphs = []
+        for g in range(COUNT):
+            rows = []
+            for r in range(h):
+                b = data[(g * h + r) * row_bytes:(g * h + r + 1) * row_bytes]
+                rows.append([(b[x >> 3] >> (7 - (x & 7))) & 1 for x in range(w)])
+            glyphs.append(rows)
+        return w, h, glyphs, header
+
+    index = src[src.index('glyphs[]'):]
+    index = index[index.index('{') + 1:index.index('};')]
+    entries = re.findall(r'\{\s*0x([0-9A-Fa-f]+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+)\s*\}', index)
+    glyphs = []
+    for off, bx, by, bw, bh in entries:
+        off, bx, by, bw, bh = int(off, 16), int(bx), int(by), int(bw), int(bh)
+        bits = decode(data, off & ~RLE_FLAG, bool(off & RLE_FLAG), bw * bh)
+        rows = [[0] * w for _ in range(h)]
+        for i, bit in enumerate(bits):
+            if bit:
+                rows[by + i // bw][bx + i % bw] = 1
+        glyphs.append(rows)
+    return w, h, glyphs, header
+
+
+def load_ttf(path, size, threshold):
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        sys.exit('--ttf needs Pillow (pip install pillow)')
+    w, h = size // 2, size
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    # Fit ascent + descent into the cell, centered
+    y_off = (h - (ascent + descent)) // 2
+    glyphs = []
+    for code in range(FIRST, FIRST + COUNT):
+        img = Image.new('L', (w, h), 0)
+        draw = ImageDraw.Draw(img)
+        ch = chr(code)
+        x_off = (w - font.getlength(ch)) / 2
+        draw.text((x_off, y_off), ch, fill=255, font=font)
+        px = img.load()
+        glyphs.append([[1 if px[x, y] >= threshold else 0 for x in range(w)] for y in range(h)])
+    return w, h, glyphs
+
+
+# ============================================
+# Packing
+# ============================================
+
+def glyph_box(rows, w, h):
+    ys = [y for y in range(h) if any(rows[y])]
+    if not ys:
+        return 0, 0, 0, 0
+    xs = [x for x in range(w) if any(rows[y][x] for y in ys)]
+    return min(xs), min(ys), max(xs) - min(xs) + 1, max(ys) - min(ys) + 1
+
+
+def pack_bits(bits):
+    out = bytearray((len(bits) + 7) // 8)
+    for i, bit in enumerate(bits):
+        if bit:
+            out[i >> 3] |= 0x80 >> (i & 7)
+    return bytes(out)
+
+
+def pack_runs(bits):
+    runs = []
+    cur, n = 0, 0
+    for bit in bits:
+        if bit == cur:
+            n += 1
+        else:
+            runs.append(n)
+            cur, n = bit, 1
+    if n:
+        runs.append(n)
+    nibbles = []
+    for r in runs:
+        while r >= 15:
+            nibbles.append(15)
+            r -= 15
+        nibbles.append(r)
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return bytes((nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2))
+
+
+def decode(data, off, rle, n):
+    if not rle:
+        return [(data[off + (i >> 3)] >> (7 - (i & 7))) & 1 for i in range(n)]
+    bits = []
+    bit, run, pos = 0, 0, off * 2
+    while len(bits) < n:
+        nib = (data[pos >> 1] >> (4 if pos % 2 == 0 else 0)) & 0xF
+        pos += 1
+        run += nib
+        if nib == 15:
+            continue
+        bits.extend([bit] * min(run, n - len(bits)))
+        bit ^= 1
+        run = 0
+    return bits
+
+
+def pack(w, h, glyphs):
+    data = bytearray()
+    index = []
+    for rows in glyphs:
+        bx, by, bw, bh = glyph_box(rows, w, h)
+        bits = [rows[y][x] for y in range(by, by + bh) for x in range(bx, bx + bw)]
+        raw = pack_bits(bits)
+        rle = pack_runs(bits)
+        use_rle = len(rle) < len(raw)
+        off = len(data)
+        if off >= RLE_FLAG:
+            sys.exit('font %d too large for 15-bit offsets' % h)
+        data += rle if use_rle else raw
+        index.append((off | (RLE_FLAG if use_rle else 0), bx, by, bw, bh))
+        assert decode(data, off, use_rle, bw * bh) == bits
+    return bytes(data), index
+
+
+# ============================================
+# Output
+# ============================================
+
+def glyph_comment(code):
+    return '/*"%s",%d*/' % (chr(code), code - FIRST)
+
+
+def write_font(out_dir, w, h, data, index, header, source):
+    raw = COUNT * h * ((w + 7) // 8)
+    packed = len(data) + len(index) * 6
+    lines = [header or '/* Generated from %s; the license of that font applies */\n' % os.path.basename(source)]
+    lines.append('/* Packed by tools/pack_font.py: %dx%d cells, %d bytes (1-bit bitmap: %d) */\n'
+                 % (w, h, packed, raw))
+    lines.append('#include "sdkconfig.h"\n')
+    lines.append('#include "esp_painter_font.h"\n')
+    lines.append('#if CONFIG_ESP_PAINTER_BASIC_FONT_%d\n' % h)
+    lines.append('static const uint8_t bitmap[] = {')
+    for g, (off, bx, by, bw, bh) in enumerate(index):
+        start = off & ~RLE_FLAG
+        end = (index[g + 1][0] & ~RLE_FLAG) if g + 1 < len(index) else len(data)
+        chunk = data[start:end]
+        for i in range(0, len(chunk), 16):
+            tail = ' ' + glyph_comment(FIRST + g) if i + 16 >= len(chunk) else ''
+            lines.append('    ' + ' '.join('0x%02X,' % b for b in chunk[i:i + 16]) + tail)
+    lines.append('};\n')
+    lines.append('static const esp_painter_glyph_t glyphs[] = {')
+    for g, (off, bx, by, bw, bh) in enumerate(index):
+        lines.append('    {0x%04X, %d, %d, %d, %d}, %s' % (off, bx, by, bw, bh, glyph_comment(FIRST + g)))
+    lines.append('};\n')
+    lines.append('const esp_painter_basic_font_t esp_painter_basic_font_%d = {' % h)
+    lines.append('    .bitmap = bitmap,')
+    lines.append('    .glyphs = glyphs,')
+    lines.append('    .width = %d,' % w)
+    lines.append('    .height = %d,' % h)
+    lines.append('    .first = 0x%02X,' % FIRST)
+    lines.append('    .count = %d,' % COUNT)
+    lines.append('};\n')
+    lines.append('#endif')
+    with open(os.path.join(out_dir, 'basic_font_%d.c' % h), 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+    return raw, packed
+
+
+def write_table(out_dir):
+    sizes = sorted(int(m.group(1)) for m in
+                   (re.match(r'basic_font_(\d+)\.c$', n) for n in os.listdir(out_dir)) if m)
+    lines = [CC0_HEADER]
+    lines.append('/* Generated by tools/pack_font.py: the fonts enabled in Kconfig, by size */\n')
+    lines.append('#include <stddef.h>\n')
+    lines.append('#include "sdkconfig.h"\n')
+    lines.append('#include "esp_painter_font.h"\n')
+    for s in sizes:
+        lines.append('#if CONFIG_ESP_PAINTER_BASIC_FONT_%d' % s)
+        lines.append('extern const esp_painter_basic_font_t esp_painter_basic_font_%d;' % s)
+        lines.append('#endif')
+    lines.append('\nconst esp_painter_basic_font_t *const esp_painter_basic_fonts[] = {')
+    for s in sizes:
+        lines.append('#if CONFIG_ESP_PAINTER_BASIC_FONT_%d' % s)
+        lines.append('    &esp_painter_basic_font_%d,' % s)
+        lines.append('#endif')
+    lines.append('    NULL,')
+    lines.append('};')
+    with open(os.path.join(out_dir, 'basic_fonts.c'), 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+    kconfig = ['# Generated by tools/pack_font.py, one option per font in font/\n']
+    for s in sizes:
+        kconfig.append('config ESP_PAINTER_BASIC_FONT_%d' % s)
+        kconfig.append('    bool "Enable basic_font_%d"' % s)
+        kconfig.append('    default %s\n' % ('y' if s in DEFAULT_ON else 'n'))
+    with open(os.path.join(out_dir, 'Kconfig.fonts'), 'w') as f:
+        f.write('\n'.join(kconfig).rstrip('\n') + '\n')
+    return sizes
+
+
+def glyph_crc(rows):
+    return zlib.crc32(bytes(bit for row in rows for bit in row))
+
+
+def write_reference(path, fonts):
+    lines = ['/* Generated by tools/pack_font.py --reference: the CRC-32 of each glyph\'s cell,']
+    lines.append('   width x height bytes of 0 or 1, row-major, as rasterized or read from the source */\n')
+    lines.append('#pragma once\n')
+    lines.append('#include <stdint.h>\n')
+    lines.append('typedef struct {')
+    lines.append('    uint16_t width;')
+    lines.append('    uint16_t height;')
+    lines.append('    uint32_t crc[%d];' % COUNT)
+    lines.append('} font_reference_t;\n')
+    lines.append('static const font_reference_t font_reference[] = {')
+    for w, h, glyphs, header, source in sorted(fonts, key=lambda f: f[1]):
+        lines.append('    {%d, %d, { // %s' % (w, h, os.path.basename(source)))
+        crcs = [glyph_crc(rows) for rows in glyphs]
+        for i in range(0, len(crcs), 6):
+            lines.append('        ' + ' '.join('0x%08X,' % c for c in crcs[i:i + 6]))
+        lines.append('    }},')
+    lines.append('};')
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('--ttf', help='TrueType font to rasterize')
+    parser.add_argument('--sizes', help='comma-separated cell heights for --ttf')
+    parser.add_argument('--threshold', type=int, default=128, help='coverage (0-255) of a set pixel for --ttf')
+    parser.add_argument('--from', dest='sources', nargs='+', default=[], help='font sources to repack')
+    parser.add_argument('--out', default=os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'font'),
+                        help='output directory (default: the component font/)')
+    parser.add_argument('--reference', help='write glyph CRCs to this file instead of packing')
+    args = parser.parse_args()
+    if not (args.ttf or args.sources) or bool(args.ttf) != bool(args.sizes):
+        parser.error('give --ttf with --sizes, --from, or both')
+
+    fonts = []
+    if args.ttf:
+        for size in sorted(int(s) for s in args.sizes.split(',')):
+            w, h, glyphs = load_ttf(args.ttf, size, args.threshold)
+            fonts.append((w, h, glyphs, None, args.ttf))
+    for path in args.sources:
+        w, h, glyphs, header = load_c(path)
+        fonts.append((w, h, glyphs, header, path))
+    if args.reference:
+        write_reference(args.reference, fonts)
+        print('%s: %s' % (args.reference, ', '.join('%dx%d' % (f[0], f[1]) for f in sorted(fonts, key=lambda f: f[1]))))
+        return
+
+    os.makedirs(args.out, exist_ok=True)
+    total_raw = total_packed = 0
+    print('%-16s %8s %8s %6s' % ('font', 'bitmap', 'packed', 'saved'))
+    for w, h, glyphs, header, source in fonts:
+        data, index = pack(w, h, glyphs)
+        raw, packed = write_font(args.out, w, h, data, index, header, source)
+        total_raw += raw
+        total_packed += packed
+        print('%-16s %8d %8d %5.0f%%' % ('basic_font_%d' % h, raw, packed, 100.0 * (raw - packed) / raw))
+    print('%-16s %8d %8d %5.0f%%' % ('total', total_raw, total_packed, 100.0 * (total_raw - total_packed) / total_raw))
+    sizes = write_table(args.out)
+    print('font table and Kconfig.fonts: sizes %s' % ', '.join(str(s) for s in sizes))
+
+
+if __name__ == '__main__':
+    main()
@@ -30,15 +30,41 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdatomic.h>
+
+/*
+ * Frames in flight sit in a ring of q_count slots. A slot's ref counts the
+ * users still holding its frame plus one for the slot itself: the user
+ * whose release brings it down to SHARE_SLOT_HELD calls release_frame and
+ * then frees the slot. Each user receives frames through its own SPSC ring
+ * (or its external msg_q). share_q_add and share_q_release never take a
+ * lock; a mutex and condition are only used to sleep, by the producer when
+ * the slot it needs is still held, by a user reading an empty ring and by
+ * share_q_enable() waiting out adds in flight, and the other side only
+ * touches them when it sees a sleeper flagged.
+ */
+
+#define SHARE_SLOT_FREE  (0)
+#define SHARE_SLOT_HELD  (1)
+#define SHARE_MAX_USERS  (32)
 
 typedef struct {
-    int   ref_count;
-    void *frame_data;
+    atomic_int      ref;
+    _Atomic(void *) frame_data;
 } share_item_t;
 
 typedef struct {
-    msg_q_handle_t q;
-    bool           enable;
+    uint8_t        *items;  // q_count item copies
+    atomic_uint     head;   // Next to read (CAS, so a drain may run beside the user)
+    atomic_uint     tail;   // Next to write, producer only
+    atomic_bool     waiting;
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+} share_ring_t;
+
+typedef struct {
+    msg_q_handle_t q;       // External queue
+    share_ring_t   ring;    // Own queue when not external
 } share_user_info_t;
 
 // Shared queue structure
@@ -47,16 +73,123 @@ typedef struct share_q_t {
     share_q_cfg_t      cfg;
     share_user_info_t *user_q;
     share_item_t      *items;
-    uint8_t            valid_count;
-    uint8_t            rp;
-    uint8_t            wp;
+    atomic_uint        wp;          // Next slot to fill, written by the producer only
+    atomic_uint        enable_mask;
+    atomic_int         adding;      // share_q_add calls in flight
+    atomic_uint        added;       // share_q_add calls finished
+    atomic_int         disabling;   // share_q_enable calls waiting for adds to finish
+    atomic_bool        producer_waiting;
     pthread_mutex_t    lock;
     pthread_cond_t     cond;
 } share_q_t;
 
+static void wake(atomic_bool *waiting, pthread_mutex_t *lock, pthread_cond_t *cond)
+{
+    if (atomic_load(waiting)) {
+        pthread_mutex_lock(lock);
+        pthread_cond_broadcast(cond);
+        pthread_mutex_unlock(lock);
+    }
+}
+
+static int ring_init(share_ring_t *r, share_q_cfg_t *cfg)
+{
+    r->items = (uint8_t *)calloc(cfg->q_count, cfg->item_size);
+    if (r->items == NULL) {
+        return -1;
+    }
+    atomic_init(&r->head, 0);
+    atomic_init(&r->tail, 0);
+    atomic_init(&r->waiting, false);
+    pthread_mutex_init(&r->lock, NULL);
+    pthread_cond_init(&r->cond, NULL);
+    return 0;
+}
+
+static void ring_deinit(share_ring_t *r)
+{
+    if (r->items) {
+        free(r->items);
+        r->items = NULL;
+        pthread_mutex_destroy(&r->lock);
+        pthread_cond_destroy(&r->cond);
+    }
+}
+
+static int ring_push(share_q_t *q, share_ring_t *r, void *item)
+{
+    unsigned int tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+    // Every queued frame holds a slot, so a ring of q_count entries cannot overflow
+    if (tail - atomic_load_explicit(&r->head, memory_order_acquire) >= q->cfg.q_count) {
+        return -1;
+    }
+    memcpy(r->items + (tail % q->cfg.q_count) * q->cfg.item_size, item, q->cfg.item_size);
+    atomic_store(&r->tail, tail + 1);
+    wake(&r->waiting, &r->lock, &r->cond);
+    return 0;
+}
+
+static int ring_pop(share_q_t *q, share_ring_t *r, void *item, bool no_wait)
+{
+    while (1) {
+        unsigned int head = atomic_load_explicit(&r->head, memory_order_acquire);
+        if (head != atomic_load_explicit(&r->tail, memory_order_acquire)) {
+            // The producer cannot refill this entry before head moves past it; a copy torn by
+            // a concurrent drain is discarded when the CAS fails
+            memcpy(item, r->items + (head % q->cfg.q_count) * q->cfg.item_size, q->cfg.item_size);
+            if (atomic_compare_exchange_weak(&r->head, &head, head + 1)) {
+                return 0;
+            }
+            continue;
+        }
+        if (no_wait) {
+            return 1;
+        }
+        atomic_store(&r->waiting, true);
+        pthread_mutex_lock(&r->lock);
+        while (atomic_load(&r->head) == atomic_load(&r->tail)) {
+            pthread_cond_wait(&r->cond, &r->lock);
+        }
+        pthread_mutex_unlock(&r->lock);
+        atomic_store(&r->waiting, false);
+    }
+}
+
+static bool user_has_queue(share_q_t *q, int index)
+{
+    return q->external == false || q->user_q[index].q != NULL;
+}
+
+static void add_done(share_q_t *q)
+{
+    atomic_fetch_add(&q->added, 1);
+    atomic_fetch_sub(&q->adding, 1);
+    if (atomic_load(&q->disabling) > 0) {
+        pthread_mutex_lock(&q->lock);
+        pthread_cond_broadcast(&q->cond);
+        pthread_mutex_unlock(&q->lock);
+    }
+}
+
+static int user_send(share_q_t *q, int index, void *item)
+{
+    if (q->external) {
+        return msg_q_send(q->user_q[index].q, item, q->cfg.item_size);
+    }
+    return ring_push(q, &q->user_q[index].ring, item);
+}
+
+static int user_recv(share_q_t *q, int index, void *frame, bool no_wait)
+{
+    if (q->external) {
+        return msg_q_recv(q->user_q[index].q, frame, q->cfg.item_size, no_wait);
+    }
+    return ring_pop(q, &q->user_q[index].ring, frame, no_wait);
+}
+
 share_q_t *share_q_create(share_q_cfg_t *cfg)
 {
-    if (cfg == NULL) {
+    if (cfg == NULL || cfg->q_count == 0 || cfg->user_count > SHARE_MAX_USERS) {
         return NULL;
     }
     share_q_t *q = (share_q_t *)calloc(1, sizeof(share_q_t));
@@ -64,27 +197,32 @@ share_q_t *share_q_create(share_q_cfg_t *cfg)
         return NULL;
     }
     q->cfg = *cfg;
+    pthread_mutex_init(&q->lock, NULL);
+    pthread_cond_init(&q->cond, NULL);
     q->items = (share_item_t *)calloc(cfg->q_count, sizeof(share_item_t));
     q->user_q = (share_user_info_t *)calloc(cfg->user_count, sizeof(share_user_info_t));
     if (q->items == NULL || q->user_q == NULL) {
         goto _exit;
     }
+    for (int i = 0; i < cfg->q_count; i++) {
+        atomic_init(&q->items[i].ref, SHARE_SLOT_FREE);
+        atomic_init(&q->items[i].frame_data, NULL);
+    }
     q->external = cfg->use_external_q;
     if (cfg->use_external_q == false) {
+        // All outports start disabled
         for (int i = 0; i < cfg->user_count; i++) {
-            // TODO default all outports not enabled
-            // q->user_q[i].enable = true;
-            q->user_q[i].q = msg_q_create(cfg->q_count, cfg->item_size);
-            if (q->user_q[i].q == NULL) {
+            if (ring_init(&q->user_q[i].ring, cfg) != 0) {
                 goto _exit;
             }
         }
-        q->valid_count = cfg->user_count;
     }
-    pthread_cond_init(&q->cond, NULL);
-    q->rp = 0;
-    q->wp = 0;
-    pthread_mutex_init(&q->lock, NULL);
+    atomic_init(&q->wp, 0);
+    atomic_init(&q->enable_mask, 0);
+    atomic_init(&q->adding, 0);
+    atomic_init(&q->added, 0);
+    atomic_init(&q->disabling, 0);
+    atomic_init(&q->producer_waiting, false);
     return q;
 _exit:
     share_q_destroy(q);
@@ -96,39 +234,48 @@ int share_q_set_external(share_q_t *q, uint8_t index, msg_q_handle_t handle)
     if (q == NULL || index >= q->cfg.user_count || q->cfg.use_external_q == false) {
         return -1;
     }
-    pthread_mutex_lock(&q->lock);
     q->user_q[index].q = handle;
-    pthread_mutex_unlock(&q->lock);
     return 0;
 }
+
 int share_q_enable(share_q_t *q, uint8_t index, bool enable)
 {
     if (q == NULL || index >= q->cfg.user_count) {
         return -1;
     }
-    pthread_mutex_lock(&q->lock);
-    q->user_q[index].enable = enable;
-    uint8_t valid_count = 0;
-    for (int i = 0; i < q->cfg.user_count; i++) {
-        if (q->user_q[i].enable) {
-            valid_count++;
-        }
+    if (enable) {
+        atomic_fetch_or(&q->enable_mask, 1u << index);
+        return 0;
     }
-    q->valid_count = valid_count;
+    atomic_fetch_and(&q->enable_mask, ~(1u << index));
 
-    // When disable, receive all from queues
-    if (enable == false) {
-        pthread_mutex_unlock(&q->lock);
-        void *frame = calloc(1, q->cfg.item_size);
-        if (frame) {
-            while (msg_q_recv(q->user_q[index].q, frame, q->cfg.item_size, true) == 0) {
-                share_q_release(q, frame);
+    // When disable, receive all from queues; an add that saw the output enabled may still be
+    // delivering, so keep draining until none is in flight
+    void *frame = calloc(1, q->cfg.item_size);
+    if (frame == NULL || user_has_queue(q, index) == false) {
+        free(frame);
+        return 0;
+    }
+    // Drain again after every add that finishes: a later one may be waiting for a slot this
+    // queue still holds
+    atomic_fetch_add(&q->disabling, 1);
+    bool idle;
+    do {
+        unsigned int added = atomic_load(&q->added);
+        idle = atomic_load(&q->adding) == 0;
+        while (user_recv(q, index, frame, true) == 0) {
+            share_q_release(q, frame);
+        }
+        if (idle == false) {
+            pthread_mutex_lock(&q->lock);
+            while (atomic_load(&q->added) == added) {
+                pthread_cond_wait(&q->cond, &q->lock);
             }
-            free(frame);
+            pthread_mutex_unlock(&q->lock);
         }
-        pthread_mutex_lock(&q->lock);
-    }
-    pthread_mutex_unlock(&q->lock);
+    } while (idle == false);
+    atomic_fetch_sub(&q->disabling, 1);
+    free(frame);
     return 0;
 }
 
@@ -137,13 +284,10 @@ bool share_q_is_enabled(share_q_handle_t q, uint8_t index)
     if (q == NULL || index >= q->cfg.user_count) {
         return false;
     }
-    pthread_mutex_lock(&q->lock);
-    bool enabled = q->user_q[index].enable;
-    pthread_mutex_unlock(&q->lock);
-    return enabled;
+    return (atomic_load(&q->enable_mask) & (1u << index)) != 0;
 }
 
-// Get a user queue handle
+// Get a user queue handle (external queues only)
 msg_q_handle_t share_q_get_q(share_q_t *q, uint8_t index)
 {
     if (q == NULL || index >= q->cfg.user_count) {
@@ -155,11 +299,10 @@ msg_q_handle_t share_q_get_q(share_q_t *q, uint8_t index)
 // Receive a frame from a user queue
 int share_q_recv(share_q_t *q, uint8_t index, void *frame)
 {
-    if (q == NULL || index >= q->cfg.user_count) {
+    if (q == NULL || index >= q->cfg.user_count || user_has_queue(q, index) == false) {
         return -1;
     }
-    int ret = msg_q_recv(q->user_q[index].q, frame, q->cfg.item_size, false);
-    return ret;
+    return user_recv(q, index, frame, false);
 }
 
 int share_q_recv_all(share_q_handle_t q, void *frame)
@@ -167,15 +310,14 @@ int share_q_recv_all(share_q_handle_t q, void *frame)
     if (q == NULL || frame == NULL) {
         return -1;
     }
-    // pthread_mutex_lock(&q->lock);
+    uint32_t mask = atomic_load(&q->enable_mask);
     for (int i = 0; i < q->cfg.user_count; i++) {
-        if (q->user_q[i].enable) {
-            while (msg_q_recv(q->user_q[i].q, frame, q->cfg.item_size, true) == 0) {
+        if ((mask & (1u << i)) && user_has_queue(q, i)) {
+            while (user_recv(q, i, frame, true) == 0) {
                 share_q_release(q, frame);
             }
         }
     }
-    // pthread_mutex_unlock(&q->lock);
     return 0;
 }
 
@@ -185,35 +327,51 @@ int share_q_add(share_q_t *q, void *item)
     if (q == NULL || item == NULL) {
         return -1;
     }
-    pthread_mutex_lock(&q->lock);
-    if (q->valid_count == 0) {
+    atomic_fetch_add(&q->adding, 1);
+    uint32_t mask = atomic_load(&q->enable_mask);
+    int users = 0;
+    for (int i = 0; i < q->cfg.user_count; i++) {
+        if ((mask & (1u << i)) && user_has_queue(q, i)) {
+            users++;
+        } else {
+            mask &= ~(1u << i);
+        }
+    }
+    if (users == 0) {
         q->cfg.release_frame(item, q->cfg.ctx);
-        pthread_mutex_unlock(&q->lock);
+        add_done(q);
         return 0;
     }
-    // Check if the next write position will overwrite an unreleased item
-    int next_wp = (q->wp + 1) % q->cfg.q_count;
-    while (next_wp == q->rp) {
-        // Queue is full, cannot add new item
-        pthread_cond_wait(&q->cond, &q->lock);
-    }
-    // Add into items first
-    share_item_t *q_item = q->items + q->wp;
-    q_item->frame_data = q->cfg.get_frame_data(item);
-    q_item->ref_count = q->valid_count;
-    q->wp = next_wp;
+    // Wait until every user has released the frame this slot held
+    unsigned int wp = atomic_load_explicit(&q->wp, memory_order_relaxed);
+    share_item_t *slot = &q->items[wp];
+    if (atomic_load_explicit(&slot->ref, memory_order_acquire) != SHARE_SLOT_FREE) {
+        atomic_store(&q->producer_waiting, true);
+        pthread_mutex_lock(&q->lock);
+        while (atomic_load(&slot->ref) != SHARE_SLOT_FREE) {
+            pthread_cond_wait(&q->cond, &q->lock);
+        }
+        pthread_mutex_unlock(&q->lock);
+        atomic_store(&q->producer_waiting, false);
+    }
+    // Publish the slot before any user can receive the frame
+    atomic_store_explicit(&slot->frame_data, q->cfg.get_frame_data(item), memory_order_relaxed);
+    atomic_store_explicit(&slot->ref, users + SHARE_SLOT_HELD, memory_order_release);
+    atomic_store_explicit(&q->wp, (wp + 1) % q->cfg.q_count, memory_order_relaxed);
     // Add items into user queues
+    int ret = 0;
     for (int i = 0; i < q->cfg.user_count; i++) {
-        if (q->user_q[i].enable == false || q->user_q[i].q == NULL) {
+        if ((mask & (1u << i)) == 0) {
             continue;
         }
-        if (msg_q_send(q->user_q[i].q, item, q->cfg.item_size) != 0) {
-            pthread_mutex_unlock(&q->lock);
-            return -1;
+        if (user_send(q, i, item) != 0) {
+            // Drop the reference the user will never release
+            share_q_release(q, item);
+            ret = -1;
         }
     }
-    pthread_mutex_unlock(&q->lock);
-    return 0;
+    add_done(q);
+    return ret;
 }
 
 // Release an item from the shared queue
@@ -222,26 +380,27 @@ int share_q_release(share_q_t *q, void *item)
     if (q == NULL || item == NULL) {
         return -1;
     }
-    pthread_mutex_lock(&q->lock);
-    // Find and decrement reference count
-    int rp = q->rp;
-    int wp = q->wp;
     void *frame_data = q->cfg.get_frame_data(item);
-    while (rp != wp) {
-        share_item_t *q_item = &q->items[rp];
-        if (q_item->frame_data == frame_data) {
-            q_item->ref_count--;
-            if (q_item->ref_count == 0) {
+    // The slot after the last filled one is the oldest
+    unsigned int start = atomic_load_explicit(&q->wp, memory_order_relaxed);
+    for (int n = 0; n < q->cfg.q_count; n++) {
+        share_item_t *slot = &q->items[(start + n) % q->cfg.q_count];
+        int ref = atomic_load_explicit(&slot->ref, memory_order_acquire);
+        // A slot holding a frame this user still holds cannot be recycled under it
+        while (ref > SHARE_SLOT_HELD && atomic_load_explicit(&slot->frame_data, memory_order_relaxed) == frame_data) {
+            if (atomic_compare_exchange_weak_explicit(&slot->ref, &ref, ref - 1, memory_order_acq_rel,
+                                                      memory_order_acquire) == false) {
+                continue;
+            }
+            if (ref - 1 == SHARE_SLOT_HELD) {
+                // Last user: release the frame, then hand the slot back to the producer
                 q->cfg.release_frame(item, q->cfg.ctx);
-                q->rp = (q->rp + 1) % q->cfg.q_count;
-                pthread_cond_signal(&q->cond);
+                atomic_store(&slot->ref, SHARE_SLOT_FREE);
+                wake(&q->producer_waiting, &q->lock, &q->cond);
             }
-            pthread_mutex_unlock(&q->lock);
             return 0;
         }
-        rp = (rp + 1) % (q->cfg.q_count);
     }
-    pthread_mutex_unlock(&q->lock);
     printf("Not found frame data in q %p\n", frame_data);
     return -1;
 }
@@ -257,9 +416,7 @@ void share_q_destroy(share_q_t *q)
     if (q->user_q) {
         if (q->external == false) {
             for (int i = 0; i < q->cfg.user_count; i++) {
-                if (q->user_q[i].q) {
-                    msg_q_destroy(q->user_q[i].q);
-                }
+                ring_deinit(&q->user_q[i].ring);
             }
         }
         free(q->user_q);
@@ -267,4 +424,4 @@ void share_q_destroy(share_q_t *q)
     pthread_mutex_destroy(&(q->lock));
     pthread_cond_destroy(&(q->cond));
     free(q);
-}
\ No newline at end of file
+}
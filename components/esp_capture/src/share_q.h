@@ -55,6 +55,11 @@ typedef struct {
  *        frame data from the queue and releases it when done. The shared queue tracks
  *        the release actions of consumers and uses a reference count to determine when
  *        to release the actual frame data.
+ *
+ * @note  Adding and releasing are lock-free: reference counts are atomic, each consumer
+ *        owns a single-producer ring (or its external queue), and release_frame runs on
+ *        whichever consumer drops the last reference. Frames must be added from one thread
+ *        at a time; release may be called from any thread.
  */
 typedef struct share_q_t *share_q_handle_t;
 
@@ -72,6 +77,8 @@ share_q_handle_t share_q_create(share_q_cfg_t *cfg);
 /**
  * @brief  Set external queue for share queue by index
  *
+ * @note  Set it before enabling the output
+ *
  * @param[in]  q       Share queue handle
  * @param[in]  index   Index of the queue
  * @param[in]  handle  Message queue handle
@@ -23,10 +23,13 @@
  */
 
 #include <sys/param.h>
+#include <stdlib.h>
 #include <string.h>
 #include "esp_log.h"
 #include "https_client.h"
 #include "esp_tls.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
 #include <sdkconfig.h>
 #ifdef CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
 #include "esp_crt_bundle.h"
@@ -35,15 +38,55 @@
 
 static const char *TAG = "HTTPS_CLIENT";
 
+#define HTTPS_HOST_MAX_LEN   128
+#define HTTPS_BODY_MIN_SIZE  512
+
 typedef struct {
-    http_header_t header;
-    http_body_t   body;
-    uint8_t      *data;
-    int           fill_size;
-    int           size;
-    void         *ctx;
+    http_header_t     header;
+    http_body_t       body;
+    http_body_chunk_t chunk;
+    void             *ctx;
+    char             *data;      /* Body buffer, kept across requests on the same connection */
+    int               fill_size;
+    int               size;
+    bool              connected; /* A new connection was opened for this request */
+    bool              sent;      /* Request headers were written */
+    bool              streamed;  /* Body data was handed to the chunk callback */
 } http_info_t;
 
+typedef struct {
+    esp_http_client_handle_t client;
+    char                     host[HTTPS_HOST_MAX_LEN];
+    int64_t                  last_used_us;
+    bool                     busy;
+    http_info_t              info;
+} https_conn_t;
+
+static portMUX_TYPE         s_pool_lock = portMUX_INITIALIZER_UNLOCKED;
+static https_conn_t         s_pool[HTTPS_POOL_SIZE];
+static bool                 s_keep_alive = true;
+static https_client_stats_t s_stats;
+static uint64_t             s_new_total_ms;
+static uint64_t             s_reused_total_ms;
+
+static int body_reserve(http_info_t *info, int need)
+{
+    if (need + 1 <= info->size) {
+        return 0;
+    }
+    int size = info->size ? info->size : HTTPS_BODY_MIN_SIZE;
+    while (size < need + 1) {
+        size *= 2;
+    }
+    char *data = realloc(info->data, size);
+    if (data == NULL) {
+        return -1;
+    }
+    info->data = data;
+    info->size = size;
+    return 0;
+}
+
 esp_err_t _http_event_handler(esp_http_client_event_t *evt)
 {
     http_info_t *info = evt->user_data;
@@ -53,9 +96,11 @@ esp_err_t _http_event_handler(esp_http_client_event_t *evt)
             break;
         case HTTP_EVENT_ON_CONNECTED:
             ESP_LOGD(TAG, "HTTP_EVENT_ON_CONNECTED");
+            info->connected = true;
             break;
         case HTTP_EVENT_HEADER_SENT:
             ESP_LOGD(TAG, "HTTP_EVENT_HEADER_SENT");
+            info->sent = true;
             break;
         case HTTP_EVENT_ON_HEADER:
             if (info->header) {
@@ -66,29 +111,38 @@ esp_err_t _http_event_handler(esp_http_client_event_t *evt)
             break;
         case HTTP_EVENT_ON_DATA:
             ESP_LOGD(TAG, "HTTP_EVENT_ON_DATA, len=%d", evt->data_len);
-            if (!esp_http_client_is_chunked_response(evt->client)) {
-                int content_len = esp_http_client_get_content_length(evt->client);
-                if (info->data == NULL && content_len) {
-                    info->data = malloc(content_len);
-                    if (info->data) {
-                        info->size = content_len;
-                    }
-                }
-                if (evt->data_len && info->fill_size + evt->data_len <= info->size) {
-                    memcpy(info->data + info->fill_size, evt->data, evt->data_len);
-                    info->fill_size += evt->data_len;
-                }
+            if (evt->data_len <= 0) {
+                break;
+            }
+            if (info->chunk) {
+                info->streamed = true;
+                info->chunk((const char *)evt->data, evt->data_len, info->ctx);
+                break;
+            }
+            if (info->body == NULL) {
+                break;
             }
+            // Size for the whole body up front when the length is known
+            int content_len = (int)esp_http_client_get_content_length(evt->client);
+            int need = MAX(content_len, info->fill_size + evt->data_len);
+            if (body_reserve(info, need) != 0) {
+                ESP_LOGE(TAG, "No memory for %d bytes of body", need);
+                break;
+            }
+            memcpy(info->data + info->fill_size, evt->data, evt->data_len);
+            info->fill_size += evt->data_len;
+            info->data[info->fill_size] = 0;
             break;
         case HTTP_EVENT_ON_FINISH:
             ESP_LOGD(TAG, "HTTP_EVENT_ON_FINISH");
             if (info->fill_size && info->body) {
                 http_resp_t resp = {
-                    .data = (char *)info->data,
+                    .data = info->data,
                     .size = info->fill_size,
                 };
                 info->body(&resp, info->ctx);
             }
+            info->fill_size = 0;
             break;
         case HTTP_EVENT_DISCONNECTED:
             ESP_LOGD(TAG, "HTTP_EVENT_DISCONNECTED");
@@ -103,85 +157,317 @@ esp_err_t _http_event_handler(esp_http_client_event_t *evt)
         case HTTP_EVENT_REDIRECT:
             esp_http_client_set_redirection(evt->client);
             break;
+        default:
+            break;
     }
     return ESP_OK;
 }
 
-int https_send_request(const char *method, char **headers, const char *url, char *data, http_header_t header_cb, http_body_t body, void *ctx)
+/* Pool key: "scheme://host[:port]" part of the URL */
+static int url_host(const char *url, char *host, int size)
 {
-    http_info_t info = {
-        .body = body,
-        .header = header_cb,
-        .ctx = ctx,
-    };
-    esp_http_client_config_t config = {
-        .url = url,
-        .event_handler = _http_event_handler,
-#ifdef CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
-        .crt_bundle_attach = esp_crt_bundle_attach,
-#endif
-        .user_data = &info,
-        .timeout_ms = 10000, // Change default timeout to be 10s
-    };
-    esp_http_client_handle_t client = esp_http_client_init(&config);
-    if (client == NULL) {
-        ESP_LOGE(TAG, "Fail to init client");
+    const char *p = strstr(url, "://");
+    p = p ? p + 3 : url;
+    int len = strcspn(p, "/?#") + (int)(p - url);
+    if (len >= size) {
         return -1;
     }
-    // POST
-    int err = 0;
-    esp_http_client_set_url(client, url);
-    if (strcmp(method, "POST") == 0) {
-        esp_http_client_set_method(client, HTTP_METHOD_POST);
-    } else if (strcmp(method, "DELETE") == 0) {
-        esp_http_client_set_method(client, HTTP_METHOD_DELETE);
-    } else if (strcmp(method, "PATCH") == 0) {
-        esp_http_client_set_method(client, HTTP_METHOD_PATCH);
+    memcpy(host, url, len);
+    host[len] = 0;
+    return 0;
+}
+
+static void conn_close(https_conn_t *conn)
+{
+    if (conn->client) {
+        esp_http_client_cleanup(conn->client);
+        conn->client = NULL;
+    }
+    free(conn->info.data);
+    memset(&conn->info, 0, sizeof(conn->info));
+    conn->host[0] = 0;
+}
+
+/* Take a pooled connection for host, or a free / least recently used slot. NULL if all busy. */
+static https_conn_t *pool_acquire(const char *host)
+{
+    https_conn_t *stale[HTTPS_POOL_SIZE];
+    int stale_num = 0;
+    https_conn_t *conn = NULL;
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&s_pool_lock);
+    for (int i = 0; i < HTTPS_POOL_SIZE; i++) {
+        https_conn_t *c = &s_pool[i];
+        if (c->busy || c->client == NULL) {
+            continue;
+        }
+        if (now - c->last_used_us > (int64_t)HTTPS_POOL_IDLE_MS * 1000) {
+            c->busy = true;
+            stale[stale_num++] = c;
+        } else if (conn == NULL && strcmp(c->host, host) == 0) {
+            conn = c;
+        }
+    }
+    if (conn == NULL) {
+        https_conn_t *lru = NULL;
+        for (int i = 0; i < HTTPS_POOL_SIZE; i++) {
+            https_conn_t *c = &s_pool[i];
+            if (c->busy) {
+                continue;
+            }
+            if (c->client == NULL) {
+                conn = c;
+                break;
+            }
+            if (lru == NULL || c->last_used_us < lru->last_used_us) {
+                lru = c;
+            }
+        }
+        if (conn == NULL && lru) {
+            lru->busy = true;
+            stale[stale_num++] = lru;
+            conn = lru;
+        }
+    }
+    if (conn) {
+        conn->busy = true;
+    }
+    portEXIT_CRITICAL(&s_pool_lock);
+
+    // Close outside the lock: cleanup tears down TLS
+    for (int i = 0; i < stale_num; i++) {
+        conn_close(stale[i]);
+        if (stale[i] != conn) {
+            portENTER_CRITICAL(&s_pool_lock);
+            stale[i]->busy = false;
+            portEXIT_CRITICAL(&s_pool_lock);
+        }
+    }
+    if (conn && conn->client == NULL) {
+        strcpy(conn->host, host);
+    }
+    return conn;
+}
+
+static void pool_release(https_conn_t *conn, bool keep)
+{
+    if (!keep) {
+        conn_close(conn);
+    }
+    portENTER_CRITICAL(&s_pool_lock);
+    conn->last_used_us = esp_timer_get_time();
+    conn->busy = false;
+    portEXIT_CRITICAL(&s_pool_lock);
+}
+
+static void update_stats(int err, bool connected, uint32_t ms)
+{
+    portENTER_CRITICAL(&s_pool_lock);
+    s_stats.requests++;
+    s_stats.last_ms = ms;
+    s_stats.max_ms = MAX(s_stats.max_ms, ms);
+    if (err != ESP_OK) {
+        s_stats.failures++;
+    } else if (connected) {
+        s_stats.connects++;
+        s_new_total_ms += ms;
+        s_stats.avg_new_ms = (uint32_t)(s_new_total_ms / s_stats.connects);
     } else {
-        err = -1;
-        goto _exit;
+        s_stats.reused++;
+        s_reused_total_ms += ms;
+        s_stats.avg_reused_ms = (uint32_t)(s_reused_total_ms / s_stats.reused);
     }
-    bool has_content_type = false;
-    if (headers) {
-        int i = 0;
-        // TODO suppose header writable
-        while (headers[i]) {
-            char *dot = strchr(headers[i], ':');
-            if (dot) {
-                *dot = 0;
-                if (strcmp(headers[i], "Content-Type") == 0) {
-                    has_content_type = true;
-                }
-                char *cont = dot + 2;
-                esp_http_client_set_header(client, headers[i], cont);
-                *dot = ':';
+    portEXIT_CRITICAL(&s_pool_lock);
+}
+
+static void apply_headers(esp_http_client_handle_t client, char **headers, bool set, bool *has_content_type)
+{
+    if (headers == NULL) {
+        return;
+    }
+    // TODO suppose header writable
+    for (int i = 0; headers[i]; i++) {
+        char *dot = strchr(headers[i], ':');
+        if (dot == NULL) {
+            continue;
+        }
+        *dot = 0;
+        if (set) {
+            if (strcmp(headers[i], "Content-Type") == 0) {
+                *has_content_type = true;
+            }
+            esp_http_client_set_header(client, headers[i], dot + 2);
+        } else {
+            esp_http_client_delete_header(client, headers[i]);
+        }
+        *dot = ':';
+    }
+}
+
+int https_request(const https_request_t *req)
+{
+    if (req == NULL || req->url == NULL || req->method == NULL) {
+        return -1;
+    }
+    esp_http_client_method_t method;
+    if (strcmp(req->method, "POST") == 0) {
+        method = HTTP_METHOD_POST;
+    } else if (strcmp(req->method, "DELETE") == 0) {
+        method = HTTP_METHOD_DELETE;
+    } else if (strcmp(req->method, "PATCH") == 0) {
+        method = HTTP_METHOD_PATCH;
+    } else {
+        return -1;
+    }
+
+    char host[HTTPS_HOST_MAX_LEN];
+    https_conn_t one_shot = { 0 };
+    https_conn_t *conn = NULL;
+    if (s_keep_alive && url_host(req->url, host, sizeof(host)) == 0) {
+        conn = pool_acquire(host);
+    }
+    bool pooled = conn != NULL;
+    if (conn == NULL) {
+        conn = &one_shot;
+    }
+
+    http_info_t *info = &conn->info;
+    info->header = req->header_cb;
+    info->body = req->body_cb;
+    info->chunk = req->chunk_cb;
+    info->ctx = req->ctx;
+    info->fill_size = 0;
+    info->connected = false;
+    info->sent = false;
+    info->streamed = false;
+
+    if (conn->client == NULL) {
+        esp_http_client_config_t config = {
+            .url = req->url,
+            .event_handler = _http_event_handler,
+#ifdef CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
+            .crt_bundle_attach = esp_crt_bundle_attach,
+#endif
+            .user_data = info,
+            .timeout_ms = 10000, // Change default timeout to be 10s
+            .keep_alive_enable = true, // TCP keep-alive so dead pooled sockets are noticed
+        };
+        conn->client = esp_http_client_init(&config);
+        if (conn->client == NULL) {
+            ESP_LOGE(TAG, "Fail to init client");
+            if (pooled) {
+                pool_release(conn, false);
             }
-            i++;
+            return -1;
         }
     }
-    if (data != NULL) {
+    esp_http_client_handle_t client = conn->client;
+
+    int64_t start = esp_timer_get_time();
+    esp_http_client_set_url(client, req->url);
+    esp_http_client_set_method(client, method);
+    bool has_content_type = false;
+    apply_headers(client, req->headers, true, &has_content_type);
+    if (req->data != NULL) {
         if (has_content_type == false) {
             esp_http_client_set_header(client, "Content-Type", "text/plain;charset=UTF-8");
         }
-        esp_http_client_set_post_field(client, data, strlen(data));
+        esp_http_client_set_post_field(client, req->data, strlen(req->data));
+    }
+    int err = esp_http_client_perform(client);
+    // The server may have dropped the idle connection; retry once on a fresh one, but never
+    // re-send a POST or PATCH the server may already have acted on
+    bool idempotent = method == HTTP_METHOD_DELETE;
+    if (err != ESP_OK && !info->connected && pooled &&
+        (!info->sent || (idempotent && !info->streamed))) {
+        ESP_LOGW(TAG, "Pooled connection to %s failed (%s), reconnecting", conn->host, esp_err_to_name(err));
+        esp_http_client_close(client);
+        info->fill_size = 0;
+        info->sent = false;
+        err = esp_http_client_perform(client);
     }
-    err = esp_http_client_perform(client);
+    uint32_t ms = (uint32_t)((esp_timer_get_time() - start) / 1000);
+    update_stats(err, info->connected, ms);
+
     if (err == ESP_OK) {
-        ESP_LOGI(TAG, "HTTP POST Status = %d, content_length = %lld",
-                 esp_http_client_get_status_code(client),
-                 esp_http_client_get_content_length(client));
+        ESP_LOGI(TAG, "HTTP %s Status = %d, content_length = %lld, %u ms (%s connection)",
+                 req->method, esp_http_client_get_status_code(client),
+                 esp_http_client_get_content_length(client), (unsigned)ms,
+                 info->connected ? "new" : "reused");
     } else {
-        ESP_LOGE(TAG, "HTTP POST request failed: %s", esp_err_to_name(err));
+        ESP_LOGE(TAG, "HTTP %s request failed: %s", req->method, esp_err_to_name(err));
     }
-_exit:
-    esp_http_client_cleanup(client);
-    if (info.data) {
-        free(info.data);
+
+    // Leave the handle clean for the next request on this connection
+    apply_headers(client, req->headers, false, &has_content_type);
+    if (req->data != NULL) {
+        esp_http_client_delete_header(client, "Content-Type");
+        esp_http_client_set_post_field(client, NULL, 0);
+    }
+    info->header = NULL;
+    info->body = NULL;
+    info->chunk = NULL;
+    info->ctx = NULL;
+
+    if (pooled) {
+        pool_release(conn, err == ESP_OK);
+    } else {
+        conn_close(conn);
     }
     return err;
 }
 
+int https_send_request(const char *method, char **headers, const char *url, char *data, http_header_t header_cb, http_body_t body, void *ctx)
+{
+    https_request_t req = {
+        .method = method,
+        .url = url,
+        .headers = headers,
+        .data = data,
+        .header_cb = header_cb,
+        .body_cb = body,
+        .ctx = ctx,
+    };
+    return https_request(&req);
+}
+
 int https_post(const char *url, char **headers, char *data, http_header_t header_cb, http_body_t body, void *ctx)
 {
     return https_send_request("POST", headers, url, data, header_cb, body, ctx);
 }
+
+void https_client_set_keep_alive(bool enable)
+{
+    s_keep_alive = enable;
+    if (!enable) {
+        https_client_pool_flush();
+    }
+}
+
+void https_client_pool_flush(void)
+{
+    for (int i = 0; i < HTTPS_POOL_SIZE; i++) {
+        https_conn_t *c = &s_pool[i];
+        portENTER_CRITICAL(&s_pool_lock);
+        bool idle = !c->busy && c->client != NULL;
+        if (idle) {
+            c->busy = true;
+        }
+        portEXIT_CRITICAL(&s_pool_lock);
+        if (idle) {
+            conn_close(c);
+            pool_release(c, false);
+        }
+    }
+}
+
+void https_client_get_stats(https_client_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&s_pool_lock);
+    *stats = s_stats;
+    portEXIT_CRITICAL(&s_pool_lock);
+}
@@ -24,10 +24,23 @@
 
 #pragma once
 
+#include <stdint.h>
+#include <stdbool.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief  Keep-alive connection pool settings (override at build time)
+ */
+#ifndef HTTPS_POOL_SIZE
+#define HTTPS_POOL_SIZE     2     /*!< Pooled connections, one per host */
+#endif
+#ifndef HTTPS_POOL_IDLE_MS
+#define HTTPS_POOL_IDLE_MS  30000 /*!< Pooled connections idle longer than this are closed */
+#endif
+
 /**
  * @brief  Https response data
  */
@@ -53,6 +66,60 @@ typedef void (*http_body_t)(http_resp_t *resp, void *ctx);
  */
 typedef void (*http_header_t)(const char *key, const char *value, void *ctx);
 
+/**
+ * @brief  Https body chunk callback, called as body data arrives
+ *
+ * @param[in]  data  Chunk data (valid only during the call)
+ * @param[in]  size  Chunk size
+ * @param[in]  ctx   User context
+ */
+typedef void (*http_body_chunk_t)(const char *data, int size, void *ctx);
+
+/**
+ * @brief  Https request description
+ */
+typedef struct {
+    const char        *method;    /*!< "POST", "PATCH" or "DELETE" */
+    const char        *url;       /*!< HTTPS URL */
+    char             **headers;   /*!< "Type: Info" array terminated by NULL, may be NULL */
+    const char        *data;      /*!< Content data to be sent, may be NULL */
+    http_header_t      header_cb; /*!< Header callback, may be NULL */
+    http_body_t        body_cb;   /*!< Whole-body callback (NUL terminated), may be NULL */
+    http_body_chunk_t  chunk_cb;  /*!< Streamed body callback, replaces body_cb when set */
+    void              *ctx;       /*!< User context */
+} https_request_t;
+
+/**
+ * @brief  Https client statistics since boot
+ */
+typedef struct {
+    uint32_t requests;       /*!< Requests performed */
+    uint32_t failures;       /*!< Requests that returned an error */
+    uint32_t connects;       /*!< New TCP + TLS connections */
+    uint32_t reused;         /*!< Requests served on a pooled connection */
+    uint32_t last_ms;        /*!< Latency of the last request */
+    uint32_t avg_new_ms;     /*!< Mean latency of requests that opened a connection */
+    uint32_t avg_reused_ms;  /*!< Mean latency of requests on a pooled connection */
+    uint32_t max_ms;
+} https_client_stats_t;
+
+/**
+ * @brief  Send https request through the keep-alive pool
+ *
+ * @note  Connections are pooled per scheme, host and port and reused while idle for less than
+ *        HTTPS_POOL_IDLE_MS. A request that fails on a reused connection before it was written
+ *        is retried once on a fresh one; DELETE is also retried if no body had been streamed.
+ *        Body data is either streamed to `chunk_cb` or collected in a buffer owned by
+ *        the pooled connection and handed to `body_cb`, so steady-state requests do not allocate.
+ *
+ * @param[in]  req  Request description
+ *
+ * @return
+ *       - 0       On success
+ *       - Others  Fail to do https request
+ */
+int https_request(const https_request_t *req);
+
 /**
  * @brief  Send https requests
  *
@@ -90,6 +157,27 @@ int https_send_request(const char *method, char **headers, const char *url, char
  */
 int https_post(const char *url, char **headers, char *data, http_header_t header_cb, http_body_t body, void *ctx);
 
+/**
+ * @brief  Enable or disable connection reuse (enabled by default)
+ *
+ * @note  When disabled every request opens and closes its own connection, as before pooling
+ *
+ * @param[in]  enable  Whether to keep connections alive between requests
+ */
+void https_client_set_keep_alive(bool enable);
+
+/**
+ * @brief  Close all idle pooled connections (e.g. after a network change)
+ */
+void https_client_pool_flush(void);
+
+/**
+ * @brief  Get https client statistics
+ *
+ * @param[out]  stats  Statistics
+ */
+void https_client_get_stats(https_client_stats_t *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -236,6 +236,40 @@ typedef struct {
     int (*on_data)(esp_peer_data_frame_t* frame, void* ctx);
 } esp_peer_cfg_t;
 
+/**
+ * @brief  Flags telling which fields of `esp_peer_stats_t` a realization filled
+ */
+#define ESP_PEER_STATS_RTT        (1 << 0) /*!< `rtt_ms` is valid */
+#define ESP_PEER_STATS_LOSS       (1 << 1) /*!< `loss_permille`, `packets_sent` and `packets_lost` are valid */
+#define ESP_PEER_STATS_SEND_QUEUE (1 << 2) /*!< `send_queue_bytes` is valid */
+
+/**
+ * @brief  Peer connection transport statistics
+ *
+ * @note  Loss and RTT come from the receiver reports of the remote side, so they describe the uplink.
+ *        Counters are cumulative since the connection was created.
+ */
+typedef struct {
+    uint32_t valid;            /*!< Bitmask of ESP_PEER_STATS_* */
+    uint32_t rtt_ms;           /*!< Latest round trip time */
+    uint16_t loss_permille;    /*!< Fraction of packets lost in the latest report interval (0-1000) */
+    uint32_t packets_sent;     /*!< RTP packets sent */
+    uint32_t packets_lost;     /*!< RTP packets reported lost by the remote side */
+    uint32_t send_queue_bytes; /*!< Bytes waiting in the send queue */
+} esp_peer_stats_t;
+
+/**
+ * @brief  Statistics callback of a peer realization
+ *
+ * @note  Kept out of `esp_peer_ops_t` so that prebuilt realizations keep their layout,
+ *        register it with `esp_peer_register_stats`
+ *
+ * @param[in]   peer   Peer handle of the realization
+ * @param[out]  stats  Statistics, set `valid` for the fields filled
+ * @return             Status code indicating success or failure.
+ */
+typedef int (*esp_peer_get_stats_func_t)(esp_peer_handle_t peer, esp_peer_stats_t *stats);
+
 /**
  * @brief  Peer connection interface
  */
@@ -468,6 +502,35 @@ int esp_peer_disconnect(esp_peer_handle_t handle);
  */
 int esp_peer_query(esp_peer_handle_t handle);
 
+/**
+ * @brief  Register the statistics callback of a peer realization
+ *
+ * @note  Peer connections opened with `ops` afterwards report statistics through `get_stats`
+ *        Registering again for the same `ops` replaces the callback, NULL removes it
+ *
+ * @param[in]  ops        Peer connection implementation
+ * @param[in]  get_stats  Statistics callback
+ *
+ * @return
+ *       - ESP_PEER_ERR_NONE          Register success
+ *       - ESP_PEER_ERR_INVALID_ARG   Invalid argument
+ *       - ESP_PEER_ERR_OVER_LIMITED  Too many realizations registered
+ */
+int esp_peer_register_stats(const esp_peer_ops_t *ops, esp_peer_get_stats_func_t get_stats);
+
+/**
+ * @brief  Get transport statistics of peer connection
+ *
+ * @param[in]   peer   Peer handle
+ * @param[out]  stats  Statistics, `valid` tells which fields the realization filled
+ *
+ * @return
+ *       - ESP_PEER_ERR_NONE         Get statistics success
+ *       - ESP_PEER_ERR_INVALID_ARG  Invalid argument
+ *       - ESP_PEER_ERR_NOT_SUPPORT  Realization has no statistics (`stats` is cleared)
+ */
+int esp_peer_get_stats(esp_peer_handle_t handle, esp_peer_stats_t *stats);
+
 /**
  * @brief  Close peer connection
  *
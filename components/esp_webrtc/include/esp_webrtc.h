@@ -115,6 +115,36 @@ typedef struct {
     av_render_handle_t   player;  /*!< Player handle */
 } esp_webrtc_media_provider_t;
 
+/**
+ * @brief  WebRTC send statistics
+ *
+ * @note  Counters are cumulative since the stream started, take differences between two calls for rates
+ *        `peer` holds the transport statistics when the peer realization reports them (`peer.valid` not 0)
+ */
+typedef struct {
+    uint32_t         aud_send_frames;   /*!< Audio frames handed to the peer */
+    uint32_t         aud_send_bytes;    /*!< Audio payload bytes handed to the peer */
+    uint32_t         aud_send_fail;     /*!< Audio frames the peer refused */
+    uint32_t         vid_send_frames;   /*!< Video frames handed to the peer */
+    uint32_t         vid_send_bytes;    /*!< Video payload bytes handed to the peer */
+    uint32_t         vid_send_fail;     /*!< Video frames the peer refused */
+    uint32_t         send_backlog_max;  /*!< Most audio frames found waiting at one send tick in the stats interval */
+    uint32_t         send_block_max_ms; /*!< Longest single send call in the stats interval */
+    uint32_t         aud_bitrate;       /*!< Audio encoder bitrate set through `esp_webrtc_set_bitrate` (0 for default) */
+    uint32_t         vid_bitrate;       /*!< Video encoder bitrate set through `esp_webrtc_set_bitrate` (0 for default) */
+    esp_peer_stats_t peer;              /*!< Transport statistics of the peer connection */
+} esp_webrtc_stats_t;
+
+/**
+ * @brief  WebRTC send statistics handler
+ *
+ * @note  Called from the media send task, so it can adjust bitrate without racing stream stop
+ *
+ * @param[in]  stats  Send statistics as from `esp_webrtc_get_stats`
+ * @param[in]  ctx    User context
+ */
+typedef void (*esp_webrtc_stats_handler_t)(esp_webrtc_stats_t *stats, void *ctx);
+
 /**
  * @brief  WebRTC event handler
  *
@@ -210,6 +240,56 @@ int esp_webrtc_send_custom_data(esp_webrtc_handle_t rtc_handle, esp_webrtc_custo
  */
 int esp_webrtc_query(esp_webrtc_handle_t rtc_handle);
 
+/**
+ * @brief  Get send statistics of WebRTC
+ *
+ * @note  Reading does not reset anything: `send_backlog_max` and `send_block_max_ms` cover the current
+ *        stats handler interval (since stream start when no handler is set)
+ *
+ * @param[in]   rtc_handle  WebRTC handle
+ * @param[out]  stats       Send statistics
+ *
+ * @return
+ *      - ESP_PEER_ERR_NONE         On success
+ *      - ESP_PEER_ERR_INVALID_ARG  Invalid argument
+ *      - ESP_PEER_ERR_WRONG_STATE  Peer not connected
+ */
+int esp_webrtc_get_stats(esp_webrtc_handle_t rtc_handle, esp_webrtc_stats_t *stats);
+
+/**
+ * @brief  Set periodic send statistics handler
+ *
+ * @note  `send_backlog_max` and `send_block_max_ms` restart from 0 after each report
+ *
+ * @param[in]  rtc_handle   WebRTC handle
+ * @param[in]  interval_ms  Report interval while media is being sent
+ * @param[in]  handler      Statistics handler, NULL to stop reporting
+ * @param[in]  ctx          Handler user context
+ *
+ * @return
+ *      - ESP_PEER_ERR_NONE         On success
+ *      - ESP_PEER_ERR_INVALID_ARG  Invalid argument
+ */
+int esp_webrtc_set_stats_handler(esp_webrtc_handle_t rtc_handle, uint32_t interval_ms,
+                                 esp_webrtc_stats_handler_t handler, void *ctx);
+
+/**
+ * @brief  Set encoder bitrate of the capture path
+ *
+ * @note  Takes effect on the next encoded frame, bitrate of 0 leaves that stream unchanged
+ *
+ * @param[in]  rtc_handle   WebRTC handle
+ * @param[in]  aud_bitrate  Audio bitrate in bits per second
+ * @param[in]  vid_bitrate  Video bitrate in bits per second
+ *
+ * @return
+ *      - ESP_PEER_ERR_NONE         On success
+ *      - ESP_PEER_ERR_INVALID_ARG  Invalid argument
+ *      - ESP_PEER_ERR_WRONG_STATE  Capture path not set up yet
+ *      - Others                    Encoder refused the bitrate
+ */
+int esp_webrtc_set_bitrate(esp_webrtc_handle_t rtc_handle, uint32_t aud_bitrate, uint32_t vid_bitrate);
+
 /**
  * @brief  Stop WebRTC
  *
@@ -26,11 +26,61 @@
 #include <stdlib.h>
 #include <string.h>
 
+#define MAX_STATS_IMPL (4)
+
 typedef struct {
-    esp_peer_ops_t    ops;
-    esp_peer_handle_t handle;
+    esp_peer_ops_t            ops;
+    esp_peer_get_stats_func_t get_stats;
+    esp_peer_handle_t         handle;
 } peer_wrapper_t;
 
+typedef struct {
+    const esp_peer_ops_t     *ops;
+    esp_peer_get_stats_func_t get_stats;
+} stats_impl_t;
+
+// Registered once at init, before any peer is opened
+static stats_impl_t stats_impl[MAX_STATS_IMPL];
+
+static esp_peer_get_stats_func_t get_stats_impl(const esp_peer_ops_t *ops)
+{
+    for (int i = 0; i < MAX_STATS_IMPL; i++) {
+        if (stats_impl[i].ops == ops) {
+            return stats_impl[i].get_stats;
+        }
+    }
+    return NULL;
+}
+
+int esp_peer_register_stats(const esp_peer_ops_t *ops, esp_peer_get_stats_func_t get_stats)
+{
+    if (ops == NULL) {
+        return ESP_PEER_ERR_INVALID_ARG;
+    }
+    stats_impl_t *free_slot = NULL;
+    for (int i = 0; i < MAX_STATS_IMPL; i++) {
+        if (stats_impl[i].ops == ops) {
+            stats_impl[i].get_stats = get_stats;
+            if (get_stats == NULL) {
+                stats_impl[i].ops = NULL;
+            }
+            return ESP_PEER_ERR_NONE;
+        }
+        if (stats_impl[i].ops == NULL && free_slot == NULL) {
+            free_slot = &stats_impl[i];
+        }
+    }
+    if (get_stats == NULL) {
+        return ESP_PEER_ERR_NONE;
+    }
+    if (free_slot == NULL) {
+        return ESP_PEER_ERR_OVER_LIMITED;
+    }
+    free_slot->ops = ops;
+    free_slot->get_stats = get_stats;
+    return ESP_PEER_ERR_NONE;
+}
+
 int esp_peer_open(esp_peer_cfg_t *cfg, const esp_peer_ops_t *ops, esp_peer_handle_t *handle)
 {
     if (cfg == NULL || ops == NULL || handle == NULL || ops->open == NULL) {
@@ -41,6 +91,7 @@ int esp_peer_open(esp_peer_cfg_t *cfg, const esp_peer_ops_t *ops, esp_peer_handl
         return ESP_PEER_ERR_NO_MEM;
     }
     memcpy(&peer->ops, ops, sizeof(esp_peer_ops_t));
+    peer->get_stats = get_stats_impl(ops);
     int ret = ops->open(cfg, &peer->handle);
     if (ret != ESP_PEER_ERR_NONE) {
         free(peer);
@@ -159,6 +210,19 @@ int esp_peer_query(esp_peer_handle_t handle)
     return ESP_PEER_ERR_NOT_SUPPORT;
 }
 
+int esp_peer_get_stats(esp_peer_handle_t handle, esp_peer_stats_t *stats)
+{
+    if (handle == NULL || stats == NULL) {
+        return ESP_PEER_ERR_INVALID_ARG;
+    }
+    memset(stats, 0, sizeof(esp_peer_stats_t));
+    peer_wrapper_t *peer = (peer_wrapper_t *)handle;
+    if (peer->get_stats) {
+        return peer->get_stats(peer->handle, stats);
+    }
+    return ESP_PEER_ERR_NOT_SUPPORT;
+}
+
 int esp_peer_close(esp_peer_handle_t handle)
 {
     if (handle == NULL) {
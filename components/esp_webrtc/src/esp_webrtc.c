@@ -95,6 +95,20 @@ typedef struct {
     uint8_t  vid_send_num;
     uint8_t  aud_recv_num;
     uint8_t  vid_recv_num;
+    // Send statistics for rate control
+    uint32_t aud_send_total;
+    uint32_t aud_send_bytes;
+    uint32_t aud_send_fail;
+    uint32_t vid_send_total;
+    uint32_t vid_send_bytes;
+    uint32_t vid_send_fail;
+    uint32_t send_backlog_max;
+    uint32_t send_block_max_ms;
+    uint32_t aud_bitrate;
+    uint32_t vid_bitrate;
+    esp_webrtc_stats_handler_t stats_handler;
+    void                      *stats_ctx;
+    uint32_t                   stats_interval;
 } webrtc_t;
 
 static const char *TAG = "webrtc";
@@ -109,21 +123,34 @@ static void _media_send(void *ctx)
             .stream_type = ESP_CAPTURE_STREAM_TYPE_AUDIO,
         };
         // Get and send all audio frame without wait
+        uint32_t backlog = 0;
         while (esp_capture_acquire_path_frame(rtc->capture_path, &audio_frame, true) == ESP_CAPTURE_ERR_OK) {
             esp_peer_audio_frame_t audio_send_frame = {
                 .pts = audio_frame.pts,
                 .data = audio_frame.data,
                 .size = audio_frame.size,
             };
-            esp_peer_send_audio(rtc->pc, &audio_send_frame);
+            int64_t send_start = esp_timer_get_time();
+            int ret = esp_peer_send_audio(rtc->pc, &audio_send_frame);
+            uint32_t block_ms = (uint32_t)((esp_timer_get_time() - send_start) / 1000);
             esp_capture_release_path_frame(rtc->capture_path, &audio_frame);
             rtc->aud_send_pts = audio_frame.pts;
             rtc->aud_send_num++;
             rtc->aud_send_size += audio_frame.size;
+            // Frames queue up in capture when the peer send blocks
+            backlog++;
+            rtc->send_block_max_ms = MAX(rtc->send_block_max_ms, block_ms);
+            if (ret == ESP_PEER_ERR_NONE) {
+                rtc->aud_send_total++;
+                rtc->aud_send_bytes += audio_frame.size;
+            } else {
+                rtc->aud_send_fail++;
+            }
             if (webrtc_tracing) {
                 printf("A\n");
             }
         }
+        rtc->send_backlog_max = MAX(rtc->send_backlog_max, backlog);
     }
     if (rtc->rtc_cfg.peer_cfg.video_info.codec) {
         esp_capture_stream_frame_t video_frame = {
@@ -137,14 +164,20 @@ static void _media_send(void *ctx)
                     .data = video_frame.data,
                     .size = video_frame.size,
                 };
-                esp_peer_send_data(rtc->pc, &data_frame);
+                ret = esp_peer_send_data(rtc->pc, &data_frame);
             } else {
                 esp_peer_video_frame_t video_send_frame = {
                     .pts = video_frame.pts,
                     .data = video_frame.data,
                     .size = video_frame.size,
                 };
-                esp_peer_send_video(rtc->pc, &video_send_frame);
+                ret = esp_peer_send_video(rtc->pc, &video_send_frame);
+            }
+            if (ret == ESP_PEER_ERR_NONE) {
+                rtc->vid_send_total++;
+                rtc->vid_send_bytes += video_frame.size;
+            } else {
+                rtc->vid_send_fail++;
             }
             esp_capture_release_path_frame(rtc->capture_path, &video_frame);
             rtc->vid_send_pts = video_frame.pts;
@@ -157,11 +190,42 @@ static void _media_send(void *ctx)
     }
 }
 
+static void fill_stats(webrtc_t *rtc, esp_webrtc_stats_t *stats, bool restart_peaks)
+{
+    stats->aud_send_frames = rtc->aud_send_total;
+    stats->aud_send_bytes = rtc->aud_send_bytes;
+    stats->aud_send_fail = rtc->aud_send_fail;
+    stats->vid_send_frames = rtc->vid_send_total;
+    stats->vid_send_bytes = rtc->vid_send_bytes;
+    stats->vid_send_fail = rtc->vid_send_fail;
+    stats->send_backlog_max = rtc->send_backlog_max;
+    stats->send_block_max_ms = rtc->send_block_max_ms;
+    stats->aud_bitrate = rtc->aud_bitrate;
+    stats->vid_bitrate = rtc->vid_bitrate;
+    // Peak values restart only for the stats handler, so each report covers its own interval
+    if (restart_peaks) {
+        rtc->send_backlog_max = 0;
+        rtc->send_block_max_ms = 0;
+    }
+    // Default realization has no statistics, peer.valid stays 0
+    esp_peer_get_stats(rtc->pc, &stats->peer);
+}
+
 void media_send_task(void *arg)
 {
     webrtc_t *rtc = (webrtc_t *)arg;
+    uint32_t stats_time = (uint32_t)(esp_timer_get_time() / 1000);
     while (rtc->send_going) {
         _media_send(arg);
+        if (rtc->stats_handler) {
+            uint32_t now = (uint32_t)(esp_timer_get_time() / 1000);
+            if (now - stats_time >= rtc->stats_interval) {
+                stats_time = now;
+                esp_webrtc_stats_t stats = { 0 };
+                fill_stats(rtc, &stats, true);
+                rtc->stats_handler(&stats, rtc->stats_ctx);
+            }
+        }
         media_lib_thread_sleep(AUDIO_FRAME_INTERVAL);
     }
     SET_WAIT_BITS(PC_SEND_QUIT_BIT);
@@ -172,6 +236,9 @@ static int start_stream(webrtc_t *rtc)
 {
     int ret = esp_capture_start(rtc->media_provider.capture);
     if (ret == ESP_CAPTURE_ERR_OK) {
+        rtc->aud_send_total = rtc->aud_send_bytes = rtc->aud_send_fail = 0;
+        rtc->vid_send_total = rtc->vid_send_bytes = rtc->vid_send_fail = 0;
+        rtc->send_backlog_max = rtc->send_block_max_ms = 0;
         media_lib_thread_handle_t handle = NULL;
         rtc->send_going = true;
         ret = media_lib_thread_create_from_scheduler(&handle, "pc_send", media_send_task, rtc);
@@ -847,6 +914,62 @@ int esp_webrtc_query(esp_webrtc_handle_t handle)
     return ESP_PEER_ERR_NONE;
 }
 
+int esp_webrtc_get_stats(esp_webrtc_handle_t handle, esp_webrtc_stats_t *stats)
+{
+    if (handle == NULL || stats == NULL) {
+        return ESP_PEER_ERR_INVALID_ARG;
+    }
+    webrtc_t *rtc = (webrtc_t *)handle;
+    memset(stats, 0, sizeof(esp_webrtc_stats_t));
+    if (rtc->pc == NULL || rtc->peer_state != ESP_PEER_STATE_CONNECTED) {
+        return ESP_PEER_ERR_WRONG_STATE;
+    }
+    fill_stats(rtc, stats, false);
+    return ESP_PEER_ERR_NONE;
+}
+
+int esp_webrtc_set_stats_handler(esp_webrtc_handle_t handle, uint32_t interval_ms,
+                                 esp_webrtc_stats_handler_t handler, void *ctx)
+{
+    if (handle == NULL || (handler && interval_ms == 0)) {
+        return ESP_PEER_ERR_INVALID_ARG;
+    }
+    webrtc_t *rtc = (webrtc_t *)handle;
+    rtc->stats_interval = interval_ms;
+    rtc->stats_ctx = ctx;
+    rtc->stats_handler = handler;
+    return ESP_PEER_ERR_NONE;
+}
+
+int esp_webrtc_set_bitrate(esp_webrtc_handle_t handle, uint32_t aud_bitrate, uint32_t vid_bitrate)
+{
+    if (handle == NULL) {
+        return ESP_PEER_ERR_INVALID_ARG;
+    }
+    webrtc_t *rtc = (webrtc_t *)handle;
+    if (rtc->capture_path == NULL) {
+        return ESP_PEER_ERR_WRONG_STATE;
+    }
+    int ret = ESP_PEER_ERR_NONE;
+    if (aud_bitrate && rtc->rtc_cfg.peer_cfg.audio_info.codec) {
+        ret = esp_capture_set_path_bitrate(rtc->capture_path, ESP_CAPTURE_STREAM_TYPE_AUDIO, aud_bitrate);
+        if (ret != ESP_CAPTURE_ERR_OK) {
+            ESP_LOGW(TAG, "Fail to set audio bitrate %d ret %d", (int)aud_bitrate, ret);
+            return ret;
+        }
+        rtc->aud_bitrate = aud_bitrate;
+    }
+    if (vid_bitrate && rtc->rtc_cfg.peer_cfg.video_info.codec) {
+        ret = esp_capture_set_path_bitrate(rtc->capture_path, ESP_CAPTURE_STREAM_TYPE_VIDEO, vid_bitrate);
+        if (ret != ESP_CAPTURE_ERR_OK) {
+            ESP_LOGW(TAG, "Fail to set video bitrate %d ret %d", (int)vid_bitrate, ret);
+            return ret;
+        }
+        rtc->vid_bitrate = vid_bitrate;
+    }
+    return ESP_PEER_ERR_NONE;
+}
+
 int esp_webrtc_stop(esp_webrtc_handle_t handle)
 {
     if (handle == NULL) {
@@ -0,0 +1,188 @@
+/**
+ * @file latency_ledger.h
+ * @brief Conversation-turn latency ledger with persistent percentiles
+ *
+ * Stamps each milestone of a conversation turn (end of user speech through
+ * response done), folds the intervals into per-provider log-scaled
+ * histograms and persists them to NVS so p50/p90/p99 survive reboots.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================
+// Ledger Configuration
+// ============================================
+
+#define LATENCY_LEDGER_BUCKETS      64      // 4 buckets per octave, 0 ms .. ~131 s
+#define LATENCY_LEDGER_SAVE_EVERY   4       // Persist to NVS every N completed turns, from a low-priority task
+
+/**
+ * @brief Realtime transport that served the turn
+ */
+typedef enum {
+    LATENCY_PROVIDER_COZE_WS = 0,       // Coze Audio Speech WebSocket
+    LATENCY_PROVIDER_AZURE_WS,          // Azure OpenAI Realtime WebSocket
+    LATENCY_PROVIDER_WEBRTC,            // Azure OpenAI Realtime WebRTC
+    LATENCY_PROVIDER_MAX,
+} latency_provider_t;
+
+/**
+ * @brief Turn milestones, in the order they normally occur
+ *
+ * Every interval is measured from LATENCY_MARK_VOICE_END.
+ */
+typedef enum {
+    LATENCY_MARK_VOICE_END = 0,         // End of user speech (VAD or tap)
+    LATENCY_MARK_COMMIT_SENT,           // Audio buffer commit sent / acknowledged
+    LATENCY_MARK_FIRST_SERVER_EVENT,    // First server event after voice end
+    LATENCY_MARK_FIRST_AUDIO_DELTA,     // First response audio received
+    LATENCY_MARK_FIRST_I2S_WRITE,       // First response sample written to I2S
+    LATENCY_MARK_RESPONSE_DONE,         // Server finished the response
+    LATENCY_MARK_MAX,
+} latency_mark_t;
+
+/**
+ * @brief Clock source returning monotonic microseconds
+ *
+ * Replaceable so host builds can drive the ledger with a simulated clock.
+ */
+typedef int64_t (*latency_clock_fn_t)(void);
+
+/**
+ * @brief Percentile summary for one provider/milestone pair
+ */
+typedef struct {
+    uint32_t count;                     // Turns that reached this milestone
+    uint32_t p50_ms;
+    uint32_t p90_ms;
+    uint32_t p99_ms;
+    uint32_t last_ms;                   // Most recent turn, 0 if none this boot
+} latency_stats_t;
+
+// ============================================
+// Latency Ledger Function Declarations
+// ============================================
+
+/**
+ * @brief Initialize the ledger and load persisted histograms from NVS
+ *
+ * NVS flash must already be initialized. A missing or incompatible blob
+ * starts the ledger empty. Starts the low-priority task that persists the
+ * histograms every LATENCY_LEDGER_SAVE_EVERY turns and on restart.
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t latency_ledger_init(void);
+
+/**
+ * @brief Stop recording; the next latency_ledger_init() reloads from NVS
+ *
+ * Histograms recorded since the last save are not persisted.
+ */
+void latency_ledger_deinit(void);
+
+/**
+ * @brief Override the clock source (NULL restores the default)
+ *
+ * @param clock Clock function returning microseconds
+ */
+void latency_ledger_set_clock(latency_clock_fn_t clock);
+
+/**
+ * @brief Start a new turn and stamp LATENCY_MARK_VOICE_END
+ *
+ * A previous turn that already reached RESPONSE_DONE is recorded first;
+ * any other unfinished turn is discarded.
+ *
+ * @param provider Transport serving this turn
+ */
+void latency_ledger_begin_turn(latency_provider_t provider);
+
+/**
+ * @brief Stamp a milestone of the active turn
+ *
+ * Only the first stamp of each milestone counts. Cheap and safe to call
+ * from any task, including per-frame audio paths; ignored when no turn is
+ * active.
+ *
+ * @param mark Milestone to stamp
+ */
+void latency_ledger_mark(latency_mark_t mark);
+
+/**
+ * @brief Finish the active turn and fold its intervals into the histograms
+ *
+ * Never writes flash on the caller's task; a due save is handed to the
+ * ledger's save task.
+ */
+void latency_ledger_end_turn(void);
+
+/**
+ * @brief Discard the active turn without recording it (e.g. user cancel)
+ */
+void latency_ledger_abort_turn(void);
+
+/**
+ * @brief Check whether a turn is being measured
+ *
+ * @return true if a turn is active
+ */
+bool latency_ledger_turn_active(void);
+
+/**
+ * @brief Get percentile summary for a provider/milestone pair
+ *
+ * @param provider Transport
+ * @param mark Milestone (interval from VOICE_END)
+ * @param stats Output summary
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on bad arguments
+ */
+esp_err_t latency_ledger_get_stats(latency_provider_t provider, latency_mark_t mark,
+                                   latency_stats_t *stats);
+
+/**
+ * @brief Persist histograms to NVS now
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t latency_ledger_save(void);
+
+/**
+ * @brief Clear all histograms (in memory and in NVS)
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t latency_ledger_reset(void);
+
+/**
+ * @brief Print the percentile table for every provider to stdout
+ */
+void latency_ledger_print(void);
+
+/**
+ * @brief Get provider name string
+ *
+ * @param provider Provider
+ * @return Provider name string
+ */
+const char *latency_ledger_provider_to_string(latency_provider_t provider);
+
+/**
+ * @brief Get milestone name string
+ *
+ * @param mark Milestone
+ * @return Milestone name string
+ */
+const char *latency_ledger_mark_to_string(latency_mark_t mark);
+
+#ifdef __cplusplus
+}
+#endif
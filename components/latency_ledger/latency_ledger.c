@@ -0,0 +1,565 @@
+/**
+ * @file latency_ledger.c
+ * @brief Conversation-turn latency ledger implementation
+ *
+ * Histograms use 4 log-spaced buckets per octave of milliseconds, so each
+ * percentile is accurate to roughly +/-12% while a full provider table stays
+ * under 1.3 KB. The platform layer (lock, default clock, NVS) is isolated at
+ * the top of the file; everything else builds on the host unchanged.
+ */
+
+#include "latency_ledger.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "nvs.h"
+#else
+#include <pthread.h>
+#include <time.h>
+#define ESP_LOGI(tag, fmt, ...) printf("I %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) printf("W %s: " fmt "\n", tag, ##__VA_ARGS__)
+#endif
+
+static const char *TAG = "LATENCY";
+
+#define NVS_NAMESPACE       "latency"
+#define NVS_KEY             "ledger"
+#define LEDGER_MAGIC        0x4C544E31  // "LTN1"
+#define LEDGER_INTERVALS    (LATENCY_MARK_MAX - 1)  // Every mark except VOICE_END
+
+// ============================================
+// Platform Layer
+// ============================================
+
+#ifdef ESP_PLATFORM
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+#define LEDGER_LOCK()       portENTER_CRITICAL(&s_lock)
+#define LEDGER_UNLOCK()     portEXIT_CRITICAL(&s_lock)
+
+// Serializes saves, so an older snapshot never overwrites a newer one
+static StaticSemaphore_t s_save_lock_buf;
+static SemaphoreHandle_t s_save_lock = NULL;
+#define SAVE_LOCK_INIT()    do { if (!s_save_lock) s_save_lock = xSemaphoreCreateMutexStatic(&s_save_lock_buf); } while (0)
+#define SAVE_LOCK()         xSemaphoreTake(s_save_lock, portMAX_DELAY)
+#define SAVE_UNLOCK()       xSemaphoreGive(s_save_lock)
+
+// Flash commits stall the caller (and both cores while the cache is off),
+// so turns only request a save and this task does it
+#define SAVE_TASK_STACK     3072
+#define SAVE_TASK_PRIO      1
+static TaskHandle_t s_save_task = NULL;
+
+static void save_task(void *arg)
+{
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        latency_ledger_save();
+    }
+}
+
+// Turns recorded since the last save are written before a restart
+static void shutdown_save(void)
+{
+    latency_ledger_save();
+}
+
+static esp_err_t saver_start(void)
+{
+    if (s_save_task) {
+        return ESP_OK;
+    }
+    if (xTaskCreate(save_task, "ledger_save", SAVE_TASK_STACK, NULL, SAVE_TASK_PRIO, &s_save_task) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_register_shutdown_handler(shutdown_save);
+    return ESP_OK;
+}
+
+static void saver_kick(void)
+{
+    if (s_save_task) {
+        xTaskNotifyGive(s_save_task);
+    }
+}
+
+static int64_t default_clock(void)
+{
+    return esp_timer_get_time();
+}
+#else
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+#define LEDGER_LOCK()       pthread_mutex_lock(&s_lock)
+#define LEDGER_UNLOCK()     pthread_mutex_unlock(&s_lock)
+
+static pthread_mutex_t s_save_lock = PTHREAD_MUTEX_INITIALIZER;
+#define SAVE_LOCK_INIT()    do { } while (0)
+#define SAVE_LOCK()         pthread_mutex_lock(&s_save_lock)
+#define SAVE_UNLOCK()       pthread_mutex_unlock(&s_save_lock)
+
+static pthread_cond_t s_save_cond = PTHREAD_COND_INITIALIZER;
+static bool s_save_requested = false;
+static bool s_saver_started = false;
+
+static void *save_thread(void *arg)
+{
+    (void)arg;
+    while (1) {
+        pthread_mutex_lock(&s_lock);
+        while (!s_save_requested) {
+            pthread_cond_wait(&s_save_cond, &s_lock);
+        }
+        s_save_requested = false;
+        pthread_mutex_unlock(&s_lock);
+        latency_ledger_save();
+    }
+    return NULL;
+}
+
+static esp_err_t saver_start(void)
+{
+    if (s_saver_started) {
+        return ESP_OK;
+    }
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, save_thread, NULL) != 0) {
+        return ESP_ERR_NO_MEM;
+    }
+    pthread_detach(thread);
+    s_saver_started = true;
+    return ESP_OK;
+}
+
+static void saver_kick(void)
+{
+    pthread_mutex_lock(&s_lock);
+    s_save_requested = true;
+    pthread_cond_signal(&s_save_cond);
+    pthread_mutex_unlock(&s_lock);
+}
+
+static int64_t default_clock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+#endif
+
+// ============================================
+// Private Types and Variables
+// ============================================
+
+/**
+ * @brief Persisted histogram table (NVS blob layout)
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t buckets;
+    uint32_t hist[LATENCY_PROVIDER_MAX][LEDGER_INTERVALS][LATENCY_LEDGER_BUCKETS];
+} ledger_blob_t;
+
+/**
+ * @brief Milestone timestamps of the turn being measured
+ */
+typedef struct {
+    volatile bool active;
+    latency_provider_t provider;
+    uint32_t stamped;                   // Bitmask of stamped marks
+    int64_t t_us[LATENCY_MARK_MAX];
+} ledger_turn_t;
+
+static ledger_blob_t s_blob;
+static ledger_blob_t s_io_blob;         // Flash side of load and save (save lock held)
+static ledger_turn_t s_turn;
+static uint32_t s_last_ms[LATENCY_PROVIDER_MAX][LEDGER_INTERVALS];
+static uint32_t s_unsaved_turns = 0;   // Recorded since the last save (lock held)
+static latency_clock_fn_t s_clock = default_clock;
+static bool s_initialized = false;
+
+// ============================================
+// Private Functions - Histogram
+// ============================================
+
+/**
+ * @brief Map a latency in ms to its bucket
+ *
+ * 0..3 ms map 1:1; above that each octave [2^k, 2^(k+1)) is split into
+ * four equal sub-buckets.
+ */
+static int ms_to_bucket(uint32_t ms)
+{
+    if (ms < 4) {
+        return (int)ms;
+    }
+    int octave = 31 - __builtin_clz(ms);
+    int sub = (ms >> (octave - 2)) & 3;
+    int bucket = octave * 4 + sub - 4;
+    return bucket < LATENCY_LEDGER_BUCKETS ? bucket : LATENCY_LEDGER_BUCKETS - 1;
+}
+
+/**
+ * @brief Representative value (bucket midpoint) in ms
+ */
+static uint32_t bucket_to_ms(int bucket)
+{
+    if (bucket < 4) {
+        return (uint32_t)bucket;
+    }
+    int octave = bucket / 4 + 1;
+    int sub = bucket % 4;
+    uint32_t width = 1u << (octave - 2);
+    return ((uint32_t)(4 + sub) << (octave - 2)) + width / 2;
+}
+
+static uint32_t hist_percentile(const uint32_t *hist, uint32_t total, uint32_t pct)
+{
+    if (total == 0) {
+        return 0;
+    }
+    // Rank of the requested percentile, 1-based, rounded up
+    uint32_t rank = (uint32_t)(((uint64_t)total * pct + 99) / 100);
+    uint32_t seen = 0;
+    for (int i = 0; i < LATENCY_LEDGER_BUCKETS; i++) {
+        seen += hist[i];
+        if (seen >= rank) {
+            return bucket_to_ms(i);
+        }
+    }
+    return bucket_to_ms(LATENCY_LEDGER_BUCKETS - 1);
+}
+
+/**
+ * @brief Fold the active turn into the histograms (lock held)
+ *
+ * @return true if anything was recorded
+ */
+static bool record_turn_locked(void)
+{
+    if (!s_turn.active || !(s_turn.stamped & (1u << LATENCY_MARK_VOICE_END))) {
+        return false;
+    }
+
+    bool recorded = false;
+    int64_t origin = s_turn.t_us[LATENCY_MARK_VOICE_END];
+    for (int mark = LATENCY_MARK_VOICE_END + 1; mark < LATENCY_MARK_MAX; mark++) {
+        if (!(s_turn.stamped & (1u << mark))) {
+            continue;
+        }
+        int64_t delta_us = s_turn.t_us[mark] - origin;
+        uint32_t ms = delta_us > 0 ? (uint32_t)(delta_us / 1000) : 0;
+        s_blob.hist[s_turn.provider][mark - 1][ms_to_bucket(ms)]++;
+        s_last_ms[s_turn.provider][mark - 1] = ms;
+        recorded = true;
+    }
+    s_turn.active = false;
+    return recorded;
+}
+
+// ============================================
+// Private Functions - Persistence
+// ============================================
+
+#ifdef ESP_PLATFORM
+static esp_err_t load_blob(ledger_blob_t *blob)
+{
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    size_t size = sizeof(*blob);
+    ret = nvs_get_blob(nvs, NVS_KEY, blob, &size);
+    nvs_close(nvs);
+
+    if (ret == ESP_OK && (size != sizeof(*blob) || blob->magic != LEDGER_MAGIC ||
+                          blob->buckets != LATENCY_LEDGER_BUCKETS)) {
+        ESP_LOGW(TAG, "Discarding incompatible ledger blob (%u bytes)", (unsigned)size);
+        ret = ESP_ERR_INVALID_VERSION;
+    }
+    return ret;
+}
+
+static esp_err_t store_blob(const ledger_blob_t *blob)
+{
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    ret = nvs_set_blob(nvs, NVS_KEY, blob, sizeof(*blob));
+    if (ret == ESP_OK) {
+        ret = nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+    return ret;
+}
+#else
+// Host builds persist to memory, so a deinit / init cycle reloads the table
+static ledger_blob_t s_host_flash;
+static bool s_host_flash_valid = false;
+
+static esp_err_t load_blob(ledger_blob_t *blob)
+{
+    if (!s_host_flash_valid) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    memcpy(blob, &s_host_flash, sizeof(*blob));
+    return ESP_OK;
+}
+
+static esp_err_t store_blob(const ledger_blob_t *blob)
+{
+    memcpy(&s_host_flash, blob, sizeof(s_host_flash));
+    s_host_flash_valid = true;
+    return ESP_OK;
+}
+#endif
+
+static void reset_blob(void)
+{
+    memset(&s_blob, 0, sizeof(s_blob));
+    s_blob.magic = LEDGER_MAGIC;
+    s_blob.buckets = LATENCY_LEDGER_BUCKETS;
+}
+
+// ============================================
+// Public Functions
+// ============================================
+
+esp_err_t latency_ledger_init(void)
+{
+    if (s_initialized) {
+        return ESP_OK;
+    }
+
+    SAVE_LOCK_INIT();
+    esp_err_t ret = saver_start();
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    // The save task may still be writing a table from before a deinit
+    SAVE_LOCK();
+    bool loaded = load_blob(&s_io_blob) == ESP_OK;
+    LEDGER_LOCK();
+    if (loaded) {
+        memcpy(&s_blob, &s_io_blob, sizeof(s_blob));
+    } else {
+        reset_blob();
+    }
+    memset(&s_turn, 0, sizeof(s_turn));
+    memset(s_last_ms, 0, sizeof(s_last_ms));
+    s_unsaved_turns = 0;
+    LEDGER_UNLOCK();
+    SAVE_UNLOCK();
+
+    s_initialized = true;
+    ESP_LOGI(TAG, "Latency ledger initialized (%u bytes persisted)", (unsigned)sizeof(s_blob));
+    return ESP_OK;
+}
+
+void latency_ledger_deinit(void)
+{
+    LEDGER_LOCK();
+    s_turn.active = false;
+    LEDGER_UNLOCK();
+    s_initialized = false;
+}
+
+void latency_ledger_set_clock(latency_clock_fn_t clock)
+{
+    s_clock = clock ? clock : default_clock;
+}
+
+void latency_ledger_begin_turn(latency_provider_t provider)
+{
+    if (!s_initialized || provider >= LATENCY_PROVIDER_MAX) {
+        return;
+    }
+
+    int64_t now = s_clock();
+    bool save = false;
+
+    LEDGER_LOCK();
+    // A turn that got its response but was never closed still counts
+    if (s_turn.active && (s_turn.stamped & (1u << LATENCY_MARK_RESPONSE_DONE)) && record_turn_locked()) {
+        save = ++s_unsaved_turns >= LATENCY_LEDGER_SAVE_EVERY;
+    }
+    s_turn.provider = provider;
+    s_turn.stamped = 1u << LATENCY_MARK_VOICE_END;
+    s_turn.t_us[LATENCY_MARK_VOICE_END] = now;
+    s_turn.active = true;
+    LEDGER_UNLOCK();
+
+    if (save) {
+        saver_kick();
+    }
+}
+
+void latency_ledger_mark(latency_mark_t mark)
+{
+    // Unlocked fast path: per-frame callers return here between turns
+    if (!s_turn.active || mark <= LATENCY_MARK_VOICE_END || mark >= LATENCY_MARK_MAX ||
+        (s_turn.stamped & (1u << mark))) {
+        return;
+    }
+
+    int64_t now = s_clock();
+
+    LEDGER_LOCK();
+    if (s_turn.active && !(s_turn.stamped & (1u << mark))) {
+        s_turn.t_us[mark] = now;
+        s_turn.stamped |= 1u << mark;
+    }
+    LEDGER_UNLOCK();
+}
+
+void latency_ledger_end_turn(void)
+{
+    if (!s_turn.active) {
+        return;
+    }
+
+    bool save = false;
+    LEDGER_LOCK();
+    if (record_turn_locked()) {
+        save = ++s_unsaved_turns >= LATENCY_LEDGER_SAVE_EVERY;
+    }
+    LEDGER_UNLOCK();
+
+    if (save) {
+        saver_kick();
+    }
+}
+
+void latency_ledger_abort_turn(void)
+{
+    LEDGER_LOCK();
+    s_turn.active = false;
+    LEDGER_UNLOCK();
+}
+
+bool latency_ledger_turn_active(void)
+{
+    return s_turn.active;
+}
+
+esp_err_t latency_ledger_get_stats(latency_provider_t provider, latency_mark_t mark,
+                                   latency_stats_t *stats)
+{
+    if (stats == NULL || provider >= LATENCY_PROVIDER_MAX ||
+        mark <= LATENCY_MARK_VOICE_END || mark >= LATENCY_MARK_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint32_t hist[LATENCY_LEDGER_BUCKETS];
+    LEDGER_LOCK();
+    memcpy(hist, s_blob.hist[provider][mark - 1], sizeof(hist));
+    stats->last_ms = s_last_ms[provider][mark - 1];
+    LEDGER_UNLOCK();
+
+    uint32_t total = 0;
+    for (int i = 0; i < LATENCY_LEDGER_BUCKETS; i++) {
+        total += hist[i];
+    }
+    stats->count = total;
+    stats->p50_ms = hist_percentile(hist, total, 50);
+    stats->p90_ms = hist_percentile(hist, total, 90);
+    stats->p99_ms = hist_percentile(hist, total, 99);
+    return ESP_OK;
+}
+
+esp_err_t latency_ledger_save(void)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Snapshot under the ledger lock, write flash under the save lock only
+    SAVE_LOCK();
+    LEDGER_LOCK();
+    memcpy(&s_io_blob, &s_blob, sizeof(s_io_blob));
+    uint32_t turns = s_unsaved_turns;
+    LEDGER_UNLOCK();
+
+    esp_err_t ret = store_blob(&s_io_blob);
+    SAVE_UNLOCK();
+    if (ret == ESP_OK) {
+        // Turns recorded while writing stay counted for the next save
+        LEDGER_LOCK();
+        s_unsaved_turns = s_unsaved_turns > turns ? s_unsaved_turns - turns : 0;
+        LEDGER_UNLOCK();
+    } else {
+        ESP_LOGW(TAG, "Failed to persist ledger: %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+esp_err_t latency_ledger_reset(void)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    LEDGER_LOCK();
+    reset_blob();
+    memset(s_last_ms, 0, sizeof(s_last_ms));
+    s_turn.active = false;
+    LEDGER_UNLOCK();
+
+    return latency_ledger_save();
+}
+
+void latency_ledger_print(void)
+{
+    printf("%-9s %-18s %6s %7s %7s %7s %7s\n",
+           "provider", "voice_end ->", "turns", "p50", "p90", "p99", "last");
+    for (int p = 0; p < LATENCY_PROVIDER_MAX; p++) {
+        for (int m = LATENCY_MARK_VOICE_END + 1; m < LATENCY_MARK_MAX; m++) {
+            latency_stats_t st;
+            latency_ledger_get_stats((latency_provider_t)p, (latency_mark_t)m, &st);
+            if (st.count == 0) {
+                continue;
+            }
+            printf("%-9s %-18s %6lu %5lums %5lums %5lums %5lums\n",
+                   latency_ledger_provider_to_string((latency_provider_t)p),
+                   latency_ledger_mark_to_string((latency_mark_t)m),
+                   (unsigned long)st.count, (unsigned long)st.p50_ms,
+                   (unsigned long)st.p90_ms, (unsigned long)st.p99_ms,
+                   (unsigned long)st.last_ms);
+        }
+    }
+}
+
+const char *latency_ledger_provider_to_string(latency_provider_t provider)
+{
+    switch (provider) {
+        case LATENCY_PROVIDER_COZE_WS: return "coze_ws";
+        case LATENCY_PROVIDER_AZURE_WS: return "azure_ws";
+        case LATENCY_PROVIDER_WEBRTC: return "webrtc";
+        default: return "unknown";
+    }
+}
+
+const char *latency_ledger_mark_to_string(latency_mark_t mark)
+{
+    switch (mark) {
+        case LATENCY_MARK_VOICE_END: return "voice_end";
+        case LATENCY_MARK_COMMIT_SENT: return "commit_sent";
+        case LATENCY_MARK_FIRST_SERVER_EVENT: return "first_server_event";
+        case LATENCY_MARK_FIRST_AUDIO_DELTA: return "first_audio_delta";
+        case LATENCY_MARK_FIRST_I2S_WRITE: return "first_i2s_write";
+        case LATENCY_MARK_RESPONSE_DONE: return "response_done";
+        default: return "unknown";
+    }
+}
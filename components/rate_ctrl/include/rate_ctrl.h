@@ -0,0 +1,167 @@
+/**
+ * @file rate_ctrl.h
+ * @brief Uplink bitrate controller for the WebRTC capture path
+ *
+ * Estimates the bandwidth available to the uplink from what the sender sees
+ * each interval (loss and RTT from receiver reports when the peer provides
+ * them; send failures, blocked send calls and capture backlog always) and
+ * turns the estimate into encoder bitrates: a multiplicative cut on
+ * congestion, a hold while the queue drains, then a ramp back up that slows
+ * near the rate where congestion last set in. Bitrates only reach the
+ * encoder when they move by a noticeable step, so Opus is not reconfigured
+ * every interval.
+ *
+ * Pure computation with no OS calls, so the host build can drive it against
+ * a simulated link.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================
+// Controller Configuration
+// ============================================
+
+#ifndef CONFIG_RATE_CTRL_INTERVAL_MS
+#define CONFIG_RATE_CTRL_INTERVAL_MS        500
+#endif
+#ifndef CONFIG_RATE_CTRL_AUDIO_MIN_KBPS
+#define CONFIG_RATE_CTRL_AUDIO_MIN_KBPS     16
+#endif
+#ifndef CONFIG_RATE_CTRL_AUDIO_MAX_KBPS
+#define CONFIG_RATE_CTRL_AUDIO_MAX_KBPS     90
+#endif
+#ifndef CONFIG_RATE_CTRL_AUDIO_START_KBPS
+#define CONFIG_RATE_CTRL_AUDIO_START_KBPS   64
+#endif
+#ifndef CONFIG_RATE_CTRL_VIDEO_MIN_KBPS
+#define CONFIG_RATE_CTRL_VIDEO_MIN_KBPS     100
+#endif
+#ifndef CONFIG_RATE_CTRL_VIDEO_MAX_KBPS
+#define CONFIG_RATE_CTRL_VIDEO_MAX_KBPS     1000
+#endif
+
+#define RATE_CTRL_HOLD_MS           2000    // No increase for this long after a cut
+#define RATE_CTRL_LOSS_HIGH         100     // Loss above this (permille) cuts the rate
+#define RATE_CTRL_LOSS_LOW          20      // Loss above this (permille) holds the rate
+#define RATE_CTRL_RTT_RISE_MS       150     // RTT above the baseline by this much is queueing
+#define RATE_CTRL_QUEUE_MS          200     // Send queue worth this long at the estimate is queueing
+#define RATE_CTRL_BACKLOG_FRAMES    3       // Frames waiting at one send tick (3 x 20 ms)
+#define RATE_CTRL_BLOCK_MS          60      // Longest send call counted as blocked
+#define RATE_CTRL_STEP_BPS          2000    // Smallest bitrate change pushed to the encoder
+
+/**
+ * @brief Bitrate limits
+ *
+ * Video limits of 0 mean the session has no video; the audio share is then
+ * the whole estimate.
+ */
+typedef struct {
+    uint32_t audio_min_bps;
+    uint32_t audio_max_bps;
+    uint32_t audio_start_bps;
+    uint32_t video_min_bps;
+    uint32_t video_max_bps;
+} rate_ctrl_config_t;
+
+/**
+ * @brief What the sender observed over one interval
+ */
+typedef struct {
+    uint32_t interval_ms;
+    uint32_t sent_bytes;                // Payload the peer accepted
+    uint32_t send_fail;                 // Frames the peer refused
+    uint32_t backlog_frames;            // Most audio frames waiting at one send tick
+    uint32_t block_ms;                  // Longest single send call
+    bool has_loss;                      // Fields below come from the peer when set
+    uint16_t loss_permille;
+    bool has_rtt;
+    uint32_t rtt_ms;
+    bool has_queue;
+    uint32_t queue_bytes;
+} rate_ctrl_sample_t;
+
+/**
+ * @brief Controller verdict for an interval
+ */
+typedef enum {
+    RATE_CTRL_HOLD = 0,
+    RATE_CTRL_INCREASE,
+    RATE_CTRL_DECREASE,
+} rate_ctrl_action_t;
+
+/**
+ * @brief Result of rate_ctrl_update()
+ */
+typedef struct {
+    rate_ctrl_action_t action;
+    const char *reason;                 // Signal behind the action
+    uint32_t estimate_bps;              // Bandwidth estimate for all streams
+    uint32_t throughput_bps;            // Accepted payload rate this interval
+    uint32_t audio_bps;                 // Encoder targets
+    uint32_t video_bps;                 // 0 without video
+    bool apply;                         // Targets moved: push them to the encoder
+} rate_ctrl_decision_t;
+
+/**
+ * @brief Controller state (one per connection)
+ */
+typedef struct {
+    rate_ctrl_config_t cfg;
+    uint32_t estimate_bps;
+    uint32_t congested_bps;             // Estimate when congestion last set in
+    uint32_t hold_ms;
+    uint32_t rtt_base_ms;               // Lowest recent RTT, 0 before the first report
+    uint32_t prev_rtt_ms;
+    uint32_t prev_queue_bytes;
+    uint32_t audio_bps;                 // Last applied targets, 0 before the first
+    uint32_t video_bps;
+    uint32_t decreases;
+    uint32_t increases;
+} rate_ctrl_t;
+
+// ============================================
+// Rate Control Function Declarations
+// ============================================
+
+/**
+ * @brief Config from CONFIG_RATE_CTRL_* (video limits 0 unless with_video)
+ */
+void rate_ctrl_default_config(rate_ctrl_config_t *cfg, bool with_video);
+
+/**
+ * @brief Reset the controller for a new connection
+ *
+ * The first rate_ctrl_update() afterwards applies the start bitrate.
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if the limits are inconsistent
+ */
+esp_err_t rate_ctrl_init(rate_ctrl_t *ctrl, const rate_ctrl_config_t *cfg);
+
+/**
+ * @brief Feed one interval of observations
+ *
+ * Logs every change of the applied bitrate with the signal behind it.
+ *
+ * @param decision Output; when apply is set the caller pushes audio_bps /
+ *                 video_bps to the encoder
+ * @return ESP_OK, ESP_ERR_INVALID_ARG on NULL or a zero interval
+ */
+esp_err_t rate_ctrl_update(rate_ctrl_t *ctrl, const rate_ctrl_sample_t *sample,
+                           rate_ctrl_decision_t *decision);
+
+/**
+ * @brief Name of an action ("hold", "increase", "decrease")
+ */
+const char *rate_ctrl_action_name(rate_ctrl_action_t action);
+
+#ifdef __cplusplus
+}
+#endif
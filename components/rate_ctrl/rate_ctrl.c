@@ -0,0 +1,289 @@
+/**
+ * @file rate_ctrl.c
+ * @brief Uplink bitrate controller for the WebRTC capture path
+ *
+ * Loss follows the usual receiver-report rule: above 10% the estimate is
+ * cut in proportion to the loss, between 2% and 10% it is held. Queueing
+ * (RTT over its baseline, a deep send queue, frames backing up in capture,
+ * sends that block or fail) cuts the estimate to 85%, below the accepted
+ * throughput when that is lower. The baseline RTT follows the minimum and
+ * creeps towards persistent RTT so a route change is not read as queueing
+ * forever.
+ */
+
+#include "rate_ctrl.h"
+
+#include <stdio.h>
+#include <string.h>
+#include "esp_log.h"
+
+static const char *TAG = "RATE_CTRL";
+
+#define RECOVER_PCT_PER_S   8       // Ramp well below the last congestion point
+#define PROBE_PCT_PER_S     3       // Ramp near it
+#define DELAY_CUT_PCT       85
+#define DRAIN_MS            2000    // Time allowed to empty a standing send queue
+#define RTT_BASE_CREEP      16      // Baseline moves 1/16 of the gap per interval
+
+// ============================================
+// Private Helpers
+// ============================================
+
+static uint32_t clamp_u32(uint32_t v, uint32_t lo, uint32_t hi)
+{
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+static uint32_t round_kbps(uint32_t bps)
+{
+    return (bps + 500) / 1000 * 1000;
+}
+
+static uint32_t total_min(const rate_ctrl_config_t *cfg)
+{
+    return cfg->audio_min_bps + cfg->video_min_bps;
+}
+
+static uint32_t total_max(const rate_ctrl_config_t *cfg)
+{
+    return cfg->audio_max_bps + cfg->video_max_bps;
+}
+
+static bool target_moved(uint32_t target, uint32_t applied, uint32_t lo, uint32_t hi)
+{
+    if (target == applied) {
+        return false;
+    }
+    uint32_t diff = target > applied ? target - applied : applied - target;
+    // Reaching a limit is always worth applying, even in a small step
+    return diff >= RATE_CTRL_STEP_BPS || target == lo || target == hi;
+}
+
+static void update_rtt_base(rate_ctrl_t *ctrl, uint32_t rtt_ms)
+{
+    if (ctrl->rtt_base_ms == 0 || rtt_ms < ctrl->rtt_base_ms) {
+        ctrl->rtt_base_ms = rtt_ms;
+    } else {
+        ctrl->rtt_base_ms += (rtt_ms - ctrl->rtt_base_ms + RTT_BASE_CREEP - 1) / RTT_BASE_CREEP;
+    }
+}
+
+/**
+ * @brief Queueing signal of the sample, NULL when there is none
+ */
+static const char *delay_signal(rate_ctrl_t *ctrl, const rate_ctrl_sample_t *s)
+{
+    if (s->send_fail > 0) {
+        return "send fail";
+    }
+    if (s->has_queue && ctrl->estimate_bps &&
+        (uint64_t)s->queue_bytes * 8000 / ctrl->estimate_bps > RATE_CTRL_QUEUE_MS) {
+        return "send queue";
+    }
+    if (s->has_rtt) {
+        bool rising = ctrl->rtt_base_ms && s->rtt_ms > ctrl->rtt_base_ms + RATE_CTRL_RTT_RISE_MS;
+        update_rtt_base(ctrl, s->rtt_ms);
+        if (rising) {
+            return "rtt";
+        }
+    }
+    if (s->backlog_frames >= RATE_CTRL_BACKLOG_FRAMES) {
+        return "backlog";
+    }
+    if (s->block_ms >= RATE_CTRL_BLOCK_MS) {
+        return "blocked send";
+    }
+    return NULL;
+}
+
+static void log_decision(const rate_ctrl_t *ctrl, const rate_ctrl_sample_t *s,
+                         const rate_ctrl_decision_t *d, uint32_t prev_audio)
+{
+    char detail[64] = "";
+    int n = 0;
+    if (s->has_loss) {
+        n += snprintf(detail + n, sizeof(detail) - n, " loss %u.%u%%",
+                      s->loss_permille / 10, s->loss_permille % 10);
+    }
+    if (s->has_rtt) {
+        n += snprintf(detail + n, sizeof(detail) - n, " rtt %lu ms", (unsigned long)s->rtt_ms);
+    }
+    snprintf(detail + n, sizeof(detail) - n, " tput %lu kbps", (unsigned long)(d->throughput_bps / 1000));
+
+    if (prev_audio == 0) {
+        ESP_LOGI(TAG, "🎚️ Uplink audio %lu kbps to start", (unsigned long)(d->audio_bps / 1000));
+        return;
+    }
+    const char *icon = d->action == RATE_CTRL_DECREASE ? "📉" : "📈";
+    if (ctrl->cfg.video_max_bps) {
+        ESP_LOGI(TAG, "%s Uplink audio %lu → %lu kbps, video %lu kbps (%s:%s)", icon,
+                 (unsigned long)(prev_audio / 1000), (unsigned long)(d->audio_bps / 1000),
+                 (unsigned long)(d->video_bps / 1000), d->reason, detail);
+    } else {
+        ESP_LOGI(TAG, "%s Uplink audio %lu → %lu kbps (%s:%s)", icon,
+                 (unsigned long)(prev_audio / 1000), (unsigned long)(d->audio_bps / 1000),
+                 d->reason, detail);
+    }
+}
+
+// ============================================
+// Public API
+// ============================================
+
+void rate_ctrl_default_config(rate_ctrl_config_t *cfg, bool with_video)
+{
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->audio_min_bps = CONFIG_RATE_CTRL_AUDIO_MIN_KBPS * 1000;
+    cfg->audio_max_bps = CONFIG_RATE_CTRL_AUDIO_MAX_KBPS * 1000;
+    cfg->audio_start_bps = CONFIG_RATE_CTRL_AUDIO_START_KBPS * 1000;
+    if (with_video) {
+        cfg->video_min_bps = CONFIG_RATE_CTRL_VIDEO_MIN_KBPS * 1000;
+        cfg->video_max_bps = CONFIG_RATE_CTRL_VIDEO_MAX_KBPS * 1000;
+    }
+}
+
+esp_err_t rate_ctrl_init(rate_ctrl_t *ctrl, const rate_ctrl_config_t *cfg)
+{
+    if (ctrl == NULL || cfg == NULL || cfg->audio_min_bps == 0 ||
+        cfg->audio_min_bps > cfg->audio_max_bps || cfg->video_min_bps > cfg->video_max_bps) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(ctrl, 0, sizeof(*ctrl));
+    ctrl->cfg = *cfg;
+    uint32_t start = clamp_u32(cfg->audio_start_bps, cfg->audio_min_bps, cfg->audio_max_bps);
+    ctrl->estimate_bps = start + cfg->video_min_bps;
+    return ESP_OK;
+}
+
+esp_err_t rate_ctrl_update(rate_ctrl_t *ctrl, const rate_ctrl_sample_t *sample,
+                           rate_ctrl_decision_t *decision)
+{
+    if (ctrl == NULL || sample == NULL || decision == NULL || sample->interval_ms == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const rate_ctrl_config_t *cfg = &ctrl->cfg;
+    rate_ctrl_decision_t d = {
+        .action = RATE_CTRL_HOLD,
+        .throughput_bps = (uint32_t)((uint64_t)sample->sent_bytes * 8000 / sample->interval_ms),
+    };
+    uint32_t estimate = ctrl->estimate_bps;
+    const char *delay = delay_signal(ctrl, sample);
+    // After a cut the standing queue takes a while to drain; cutting again
+    // for the same queue would overshoot far below the link rate. An RTT
+    // that has not risen is usually the same receiver report seen again.
+    bool draining = ctrl->hold_ms > 0 &&
+                    ((sample->has_queue && sample->queue_bytes < ctrl->prev_queue_bytes) ||
+                     (sample->has_rtt && sample->rtt_ms <= ctrl->prev_rtt_ms));
+    uint32_t prev_queue = ctrl->prev_queue_bytes;
+    ctrl->prev_queue_bytes = sample->has_queue ? sample->queue_bytes : 0;
+    ctrl->prev_rtt_ms = sample->has_rtt ? sample->rtt_ms : 0;
+
+    if (sample->has_loss && sample->loss_permille > RATE_CTRL_LOSS_HIGH) {
+        // Cut by half the loss fraction, as for receiver reports
+        uint32_t loss = sample->loss_permille > 1000 ? 1000 : sample->loss_permille;
+        estimate = (uint32_t)((uint64_t)estimate * (2000 - loss) / 2000);
+        d.action = RATE_CTRL_DECREASE;
+        d.reason = "loss";
+    } else if (delay && draining && (strcmp(delay, "send queue") == 0 || strcmp(delay, "rtt") == 0)) {
+        d.reason = "draining";
+    } else if (delay) {
+        // Below what got through when sends were refused or held up
+        if (d.throughput_bps && d.throughput_bps < estimate) {
+            estimate = d.throughput_bps;
+        }
+        estimate = (uint32_t)((uint64_t)estimate * DELAY_CUT_PCT / 100);
+        if (sample->has_queue) {
+            // What left the queue is what the link carried; aim below it by
+            // enough to drain the standing queue in DRAIN_MS
+            int64_t drained = (int64_t)sample->sent_bytes + prev_queue - sample->queue_bytes;
+            int64_t link_bps = drained > 0 ? drained * 8000 / sample->interval_ms : 0;
+            int64_t target = link_bps * DELAY_CUT_PCT / 100 - (int64_t)sample->queue_bytes * 8000 / DRAIN_MS;
+            if (target < estimate) {
+                estimate = target > 0 ? (uint32_t)target : 0;
+            }
+        } else if (sample->has_rtt && sample->rtt_ms > ctrl->rtt_base_ms) {
+            // Link rate unknown: shed the queueing delay over DRAIN_MS, at most half the rate
+            uint32_t queued_ms = sample->rtt_ms - ctrl->rtt_base_ms;
+            uint32_t keep = queued_ms >= DRAIN_MS / 2 ? 500 : 1000 - queued_ms * 1000 / DRAIN_MS;
+            estimate = (uint32_t)((uint64_t)estimate * keep / 1000);
+        }
+        d.action = RATE_CTRL_DECREASE;
+        d.reason = delay;
+    } else if (sample->has_loss && sample->loss_permille > RATE_CTRL_LOSS_LOW) {
+        d.reason = "loss";
+    } else if (ctrl->hold_ms > 0) {
+        ctrl->hold_ms = ctrl->hold_ms > sample->interval_ms ? ctrl->hold_ms - sample->interval_ms : 0;
+        d.reason = "settle";
+    } else if (estimate >= total_max(cfg)) {
+        d.reason = "at max";
+    } else {
+        // Slow down near the rate that last congested the link
+        bool near = ctrl->congested_bps &&
+                    estimate >= ctrl->congested_bps / 10 * 9 && estimate <= ctrl->congested_bps / 10 * 11;
+        uint32_t pct = near ? PROBE_PCT_PER_S : RECOVER_PCT_PER_S;
+        uint32_t step = (uint32_t)((uint64_t)estimate * pct * sample->interval_ms / 100000);
+        estimate += step ? step : 1;
+        d.action = RATE_CTRL_INCREASE;
+        d.reason = near ? "probe" : "recover";
+    }
+
+    if (d.action == RATE_CTRL_DECREASE) {
+        if (ctrl->hold_ms == 0) {
+            ctrl->congested_bps = ctrl->estimate_bps;
+            if (d.throughput_bps && d.throughput_bps < ctrl->congested_bps) {
+                ctrl->congested_bps = d.throughput_bps;
+            }
+        }
+        ctrl->hold_ms = RATE_CTRL_HOLD_MS;
+    }
+    ctrl->estimate_bps = clamp_u32(estimate, total_min(cfg), total_max(cfg));
+    d.estimate_bps = ctrl->estimate_bps;
+
+    // Audio is served first: a voice session without voice is useless
+    if (cfg->video_max_bps) {
+        d.audio_bps = clamp_u32(d.estimate_bps - cfg->video_min_bps, cfg->audio_min_bps, cfg->audio_max_bps);
+        d.video_bps = clamp_u32(d.estimate_bps > d.audio_bps ? d.estimate_bps - d.audio_bps : 0,
+                                cfg->video_min_bps, cfg->video_max_bps);
+        d.video_bps = clamp_u32(round_kbps(d.video_bps), cfg->video_min_bps, cfg->video_max_bps);
+    } else {
+        d.audio_bps = d.estimate_bps;
+    }
+    d.audio_bps = clamp_u32(round_kbps(d.audio_bps), cfg->audio_min_bps, cfg->audio_max_bps);
+
+    d.apply = ctrl->audio_bps == 0 ||
+              target_moved(d.audio_bps, ctrl->audio_bps, cfg->audio_min_bps, cfg->audio_max_bps) ||
+              (cfg->video_max_bps &&
+               target_moved(d.video_bps, ctrl->video_bps, cfg->video_min_bps, cfg->video_max_bps));
+    if (d.apply) {
+        uint32_t prev_audio = ctrl->audio_bps;
+        log_decision(ctrl, sample, &d, prev_audio);
+        if (d.action == RATE_CTRL_DECREASE) {
+            ctrl->decreases++;
+        } else if (d.action == RATE_CTRL_INCREASE) {
+            ctrl->increases++;
+        }
+        ctrl->audio_bps = d.audio_bps;
+        ctrl->video_bps = d.video_bps;
+    } else {
+        // Report what the encoder actually runs at
+        d.audio_bps = ctrl->audio_bps;
+        d.video_bps = ctrl->video_bps;
+    }
+    ESP_LOGD(TAG, "%s (%s) est %lu tput %lu audio %lu", rate_ctrl_action_name(d.action),
+             d.reason ? d.reason : "-", (unsigned long)d.estimate_bps,
+             (unsigned long)d.throughput_bps, (unsigned long)d.audio_bps);
+    *decision = d;
+    return ESP_OK;
+}
+
+const char *rate_ctrl_action_name(rate_ctrl_action_t action)
+{
+    switch (action) {
+        case RATE_CTRL_INCREASE:
+            return "increase";
+        case RATE_CTRL_DECREASE:
+            return "decrease";
+        default:
+            return "hold";
+    }
+}
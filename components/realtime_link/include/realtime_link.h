@@ -0,0 +1,165 @@
+/**
+ * @file realtime_link.h
+ * @brief Connection management shared by the realtime WebSocket providers
+ *
+ * Jittered exponential reconnect backoff, a pre-warm hook that cuts a
+ * pending backoff short when the user is about to talk, TLS session reuse
+ * across reconnects and per-link handshake / connect-to-ready timing.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_websocket_client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================
+// Link Configuration
+// ============================================
+
+#ifndef CONFIG_REALTIME_LINK_BACKOFF_BASE_MS
+#define CONFIG_REALTIME_LINK_BACKOFF_BASE_MS    500
+#endif
+#ifndef CONFIG_REALTIME_LINK_BACKOFF_MAX_MS
+#define CONFIG_REALTIME_LINK_BACKOFF_MAX_MS     30000
+#endif
+
+#define REALTIME_LINK_MAX_LINKS     4
+
+/**
+ * @brief Opaque link handle (one per provider)
+ */
+typedef struct realtime_link *realtime_link_handle_t;
+
+/**
+ * @brief Link statistics since boot
+ */
+typedef struct {
+    const char *name;
+    uint32_t attempts;                  // Connection attempts started
+    uint32_t connects;                  // Handshakes completed (WebSocket open)
+    uint32_t resumed;                   // Handshakes that offered a cached TLS session
+    uint32_t ready;                     // Sessions that reached ready
+    uint32_t prewarms;                  // Backoff waits cut short by a pre-warm
+    uint32_t backoff_ms;                // Last backoff delay chosen
+    uint32_t handshake_last_ms;         // Attempt start to WebSocket open
+    uint32_t handshake_full_avg_ms;     // Mean over handshakes without a cached session
+    uint32_t handshake_resumed_avg_ms;  // Mean over handshakes offering a cached session
+    uint32_t ready_last_ms;             // Attempt start to session ready
+    uint32_t ready_avg_ms;
+} realtime_link_stats_t;
+
+typedef void (*realtime_link_stats_cb_t)(const realtime_link_stats_t *stats, void *ctx);
+
+// ============================================
+// Realtime Link Function Declarations
+// ============================================
+
+/**
+ * @brief Create a link
+ *
+ * @param name Short provider name used in logs and stats (static string)
+ * @return Link handle, NULL on allocation failure or when all slots are used
+ */
+realtime_link_handle_t realtime_link_create(const char *name);
+
+/**
+ * @brief Route a WebSocket client config through the link's TLS transport
+ *
+ * With CONFIG_REALTIME_LINK_TLS_RESUME the link owns one WebSocket-over-TLS
+ * transport that outlives client re-creation, so the TLS session ticket from
+ * the last handshake is offered on the next one. The transport is created on
+ * the first call from the config's CA bundle and common-name settings; path
+ * and headers are refreshed on every call. Without the option this is a no-op.
+ *
+ * @param link Link handle
+ * @param config Client config to update (uri must be set)
+ * @param headers Extra request headers ("Key: value\r\n" lines), or NULL
+ * @return ESP_OK on success (config unchanged on failure)
+ */
+esp_err_t realtime_link_attach_transport(realtime_link_handle_t link,
+                                         esp_websocket_client_config_t *config,
+                                         const char *headers);
+
+/**
+ * @brief Get the delay before the next connection attempt
+ *
+ * 0 for the first attempt after a session was ready, then exponential from
+ * CONFIG_REALTIME_LINK_BACKOFF_BASE_MS up to CONFIG_REALTIME_LINK_BACKOFF_MAX_MS
+ * with equal jitter (half fixed, half random) so devices don't reconnect in
+ * lockstep after an outage.
+ *
+ * @param link Link handle
+ * @return Delay in milliseconds
+ */
+uint32_t realtime_link_next_delay_ms(realtime_link_handle_t link);
+
+/**
+ * @brief Block for a backoff delay, returning early on pre-warm
+ *
+ * @param link Link handle
+ * @param delay_ms Delay from realtime_link_next_delay_ms()
+ * @return true if woken by realtime_link_prewarm()
+ */
+bool realtime_link_wait(realtime_link_handle_t link, uint32_t delay_ms);
+
+/**
+ * @brief Ask for a connection now (e.g. when the UI leaves idle)
+ *
+ * Wakes a pending realtime_link_wait(); ignored otherwise. Safe from any task.
+ *
+ * @param link Link handle
+ */
+void realtime_link_prewarm(realtime_link_handle_t link);
+
+/**
+ * @brief Record the start of a connection attempt
+ *
+ * Call right before esp_websocket_client_start(). Offers the cached TLS
+ * session when one is available.
+ *
+ * @param link Link handle
+ */
+void realtime_link_on_connecting(realtime_link_handle_t link);
+
+/**
+ * @brief Record WEBSOCKET_EVENT_CONNECTED and cache the TLS session
+ *
+ * @param link Link handle
+ */
+void realtime_link_on_connected(realtime_link_handle_t link);
+
+/**
+ * @brief Record the session becoming ready and reset the backoff
+ *
+ * Only the first call after realtime_link_on_connecting() counts.
+ *
+ * @param link Link handle
+ */
+void realtime_link_on_ready(realtime_link_handle_t link);
+
+/**
+ * @brief Get link statistics
+ *
+ * @param link Link handle
+ * @param stats Output statistics
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on bad arguments
+ */
+esp_err_t realtime_link_get_stats(realtime_link_handle_t link, realtime_link_stats_t *stats);
+
+/**
+ * @brief Call cb with the statistics of every link
+ *
+ * @param cb Callback
+ * @param ctx Callback context
+ */
+void realtime_link_foreach(realtime_link_stats_cb_t cb, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
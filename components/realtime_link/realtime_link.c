@@ -0,0 +1,334 @@
+/**
+ * @file realtime_link.c
+ * @brief Connection management shared by the realtime WebSocket providers
+ *
+ * TLS session reuse relies on the link owning the transport: the WebSocket
+ * client is destroyed and re-created on reconnect (azure_realtime) and the
+ * ticket lives in the esp_transport_ssl handle, so the providers hand the
+ * client an external transport created once per link. Tickets stay in RAM;
+ * esp_transport does not expose the session for export, so a reboot starts
+ * with a full handshake.
+ */
+
+#include "realtime_link.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_random.h"
+
+#if CONFIG_REALTIME_LINK_TLS_RESUME
+#include "esp_transport.h"
+#include "esp_transport_ssl.h"
+#include "esp_transport_ws.h"
+#endif
+
+static const char *TAG = "RT_LINK";
+
+#define BACKOFF_MAX_SHIFT   16
+
+// ============================================
+// Private Types and Variables
+// ============================================
+
+struct realtime_link {
+    const char *name;
+    SemaphoreHandle_t wake;
+    volatile bool waiting;
+
+    uint32_t failures;                  // Attempts since the last ready session
+    int64_t attempt_start_us;           // 0 when no attempt is being timed
+    bool attempt_resumed;
+
+#if CONFIG_REALTIME_LINK_TLS_RESUME
+    esp_transport_handle_t ssl;
+    esp_transport_handle_t ws;
+    bool has_session;
+#endif
+
+    realtime_link_stats_t stats;
+    uint64_t handshake_full_sum_ms;
+    uint32_t handshake_full_count;
+    uint64_t handshake_resumed_sum_ms;
+    uint64_t ready_sum_ms;
+};
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static struct realtime_link *s_links[REALTIME_LINK_MAX_LINKS];
+
+static uint32_t elapsed_ms(int64_t since_us)
+{
+    return (uint32_t)((esp_timer_get_time() - since_us) / 1000);
+}
+
+// ============================================
+// Lifecycle
+// ============================================
+
+realtime_link_handle_t realtime_link_create(const char *name)
+{
+    struct realtime_link *link = calloc(1, sizeof(*link));
+    if (link == NULL) {
+        return NULL;
+    }
+    link->wake = xSemaphoreCreateBinary();
+    if (link->wake == NULL) {
+        free(link);
+        return NULL;
+    }
+    link->name = name;
+    link->stats.name = name;
+
+    portENTER_CRITICAL(&s_lock);
+    int slot = -1;
+    for (int i = 0; i < REALTIME_LINK_MAX_LINKS; i++) {
+        if (s_links[i] == NULL) {
+            s_links[i] = link;
+            slot = i;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    if (slot < 0) {
+        ESP_LOGE(TAG, "No free link slot for %s", name);
+        vSemaphoreDelete(link->wake);
+        free(link);
+        return NULL;
+    }
+    return link;
+}
+
+// ============================================
+// TLS Transport
+// ============================================
+
+#if CONFIG_REALTIME_LINK_TLS_RESUME
+/**
+ * @brief Path and query of a ws(s):// URI ("/" when there is none)
+ */
+static const char *uri_path(const char *uri)
+{
+    const char *p = strstr(uri, "://");
+    p = p ? p + 3 : uri;
+    p = strchr(p, '/');
+    return p ? p : "/";
+}
+#endif
+
+esp_err_t realtime_link_attach_transport(realtime_link_handle_t link,
+                                         esp_websocket_client_config_t *config,
+                                         const char *headers)
+{
+    if (link == NULL || config == NULL || config->uri == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+#if CONFIG_REALTIME_LINK_TLS_RESUME
+    if (link->ws == NULL) {
+        esp_transport_handle_t ssl = esp_transport_ssl_init();
+        if (ssl == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+        if (config->crt_bundle_attach) {
+            esp_transport_ssl_crt_bundle_attach(ssl, config->crt_bundle_attach);
+        }
+        if (config->skip_cert_common_name_check) {
+            esp_transport_ssl_skip_common_name_check(ssl);
+        }
+        esp_transport_ssl_session_ticket_operation(ssl, ESP_TRANSPORT_SESSION_TICKET_INIT);
+
+        esp_transport_handle_t ws = esp_transport_ws_init(ssl);
+        if (ws == NULL) {
+            esp_transport_destroy(ssl);
+            return ESP_ERR_NO_MEM;
+        }
+        link->ssl = ssl;
+        link->ws = ws;
+    }
+
+    esp_transport_ws_set_path(link->ws, uri_path(config->uri));
+    if (headers) {
+        esp_transport_ws_set_headers(link->ws, headers);
+    }
+    config->ext_transport = link->ws;
+#endif
+    return ESP_OK;
+}
+
+// ============================================
+// Backoff and Pre-warm
+// ============================================
+
+uint32_t realtime_link_next_delay_ms(realtime_link_handle_t link)
+{
+    if (link == NULL) {
+        return CONFIG_REALTIME_LINK_BACKOFF_MAX_MS;
+    }
+
+    uint32_t failures = link->failures++;
+    uint32_t delay = 0;
+    if (failures > 0) {
+        uint32_t shift = failures - 1 < BACKOFF_MAX_SHIFT ? failures - 1 : BACKOFF_MAX_SHIFT;
+        uint64_t cap = (uint64_t)CONFIG_REALTIME_LINK_BACKOFF_BASE_MS << shift;
+        if (cap > CONFIG_REALTIME_LINK_BACKOFF_MAX_MS) {
+            cap = CONFIG_REALTIME_LINK_BACKOFF_MAX_MS;
+        }
+        uint32_t half = (uint32_t)cap / 2;
+        delay = half + (half ? esp_random() % (half + 1) : 0);
+    }
+
+    portENTER_CRITICAL(&s_lock);
+    link->stats.backoff_ms = delay;
+    portEXIT_CRITICAL(&s_lock);
+    return delay;
+}
+
+bool realtime_link_wait(realtime_link_handle_t link, uint32_t delay_ms)
+{
+    if (link == NULL || delay_ms == 0) {
+        return false;
+    }
+
+    // Drop a wake-up given before this wait started
+    xSemaphoreTake(link->wake, 0);
+    link->waiting = true;
+    bool woken = xSemaphoreTake(link->wake, pdMS_TO_TICKS(delay_ms)) == pdTRUE;
+    link->waiting = false;
+
+    if (woken) {
+        portENTER_CRITICAL(&s_lock);
+        link->stats.prewarms++;
+        portEXIT_CRITICAL(&s_lock);
+        ESP_LOGI(TAG, "🔥 %s: pre-warm, reconnecting now", link->name);
+    }
+    return woken;
+}
+
+void realtime_link_prewarm(realtime_link_handle_t link)
+{
+    if (link != NULL && link->waiting) {
+        xSemaphoreGive(link->wake);
+    }
+}
+
+// ============================================
+// Connection Milestones
+// ============================================
+
+void realtime_link_on_connecting(realtime_link_handle_t link)
+{
+    if (link == NULL) {
+        return;
+    }
+
+    bool resumed = false;
+#if CONFIG_REALTIME_LINK_TLS_RESUME
+    if (link->ssl && link->has_session) {
+        esp_transport_ssl_session_ticket_operation(link->ssl, ESP_TRANSPORT_SESSION_TICKET_USE);
+        resumed = true;
+    }
+#endif
+
+    portENTER_CRITICAL(&s_lock);
+    link->attempt_start_us = esp_timer_get_time();
+    link->attempt_resumed = resumed;
+    link->stats.attempts++;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void realtime_link_on_connected(realtime_link_handle_t link)
+{
+    if (link == NULL) {
+        return;
+    }
+
+#if CONFIG_REALTIME_LINK_TLS_RESUME
+    if (link->ssl) {
+        esp_transport_ssl_session_ticket_operation(link->ssl, ESP_TRANSPORT_SESSION_TICKET_SAVE);
+        link->has_session = true;
+    }
+#endif
+
+    portENTER_CRITICAL(&s_lock);
+    if (link->attempt_start_us != 0) {
+        uint32_t ms = elapsed_ms(link->attempt_start_us);
+        link->stats.connects++;
+        link->stats.handshake_last_ms = ms;
+        if (link->attempt_resumed) {
+            link->stats.resumed++;
+            link->handshake_resumed_sum_ms += ms;
+            link->stats.handshake_resumed_avg_ms = (uint32_t)(link->handshake_resumed_sum_ms / link->stats.resumed);
+        } else {
+            link->handshake_full_count++;
+            link->handshake_full_sum_ms += ms;
+            link->stats.handshake_full_avg_ms = (uint32_t)(link->handshake_full_sum_ms / link->handshake_full_count);
+        }
+    }
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void realtime_link_on_ready(realtime_link_handle_t link)
+{
+    if (link == NULL) {
+        return;
+    }
+
+    portENTER_CRITICAL(&s_lock);
+    int64_t start = link->attempt_start_us;
+    link->attempt_start_us = 0;
+    uint32_t ms = 0;
+    if (start != 0) {
+        ms = elapsed_ms(start);
+        link->stats.ready++;
+        link->stats.ready_last_ms = ms;
+        link->ready_sum_ms += ms;
+        link->stats.ready_avg_ms = (uint32_t)(link->ready_sum_ms / link->stats.ready);
+    }
+    uint32_t handshake = link->stats.handshake_last_ms;
+    bool resumed = link->attempt_resumed;
+    portEXIT_CRITICAL(&s_lock);
+
+    if (start != 0) {
+        link->failures = 0;
+        ESP_LOGI(TAG, "🔗 %s ready: handshake %lu ms%s, connect-to-ready %lu ms", link->name,
+                 (unsigned long)handshake, resumed ? " (cached session offered)" : "", (unsigned long)ms);
+    }
+}
+
+// ============================================
+// Statistics
+// ============================================
+
+esp_err_t realtime_link_get_stats(realtime_link_handle_t link, realtime_link_stats_t *stats)
+{
+    if (link == NULL || stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&s_lock);
+    *stats = link->stats;
+    portEXIT_CRITICAL(&s_lock);
+    return ESP_OK;
+}
+
+void realtime_link_foreach(realtime_link_stats_cb_t cb, void *ctx)
+{
+    if (cb == NULL) {
+        return;
+    }
+    for (int i = 0; i < REALTIME_LINK_MAX_LINKS; i++) {
+        realtime_link_stats_t stats;
+        portENTER_CRITICAL(&s_lock);
+        bool present = s_links[i] != NULL;
+        if (present) {
+            stats = s_links[i]->stats;
+        }
+        portEXIT_CRITICAL(&s_lock);
+        if (present) {
+            cb(&stats, ctx);
+        }
+    }
+}
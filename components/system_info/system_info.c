@@ -4,6 +4,9 @@
  */
 
 #include "system_info.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "esp_log.h"
 #include "esp_timer.h"
 #include "esp_heap_caps.h"
@@ -16,28 +19,68 @@
 #include "axp2101_driver.h"
 #include "pcf85063_driver.h"
 #include "app_wifi.h"
+#include "latency_ledger.h"
 
 static const char *TAG = "system_info";
 
-// Polling interval in milliseconds
+// Polling interval in milliseconds (task period, the finest field cadence)
 #define POLL_INTERVAL_MS    1000
-#define POLL_TASK_STACK     4096
+#define POLL_TASK_STACK     6144    // Subscriber callbacks run on it
 #define POLL_TASK_PRIORITY  5
 
+// Field cadences; the RTC is read when the minute changes
+#define WIFI_POLL_MS        5000
+#define BATTERY_POLL_MS     30000   // I2C, about 14 register reads
+#define MEMORY_POLL_MS      1000
+#define GPS_POLL_MS         10000
+#define LATENCY_POLL_MS     5000
+#define RTC_RETRY_US        (60 * 1000000LL)
+
+// Change thresholds for notifications
+#define RSSI_NOTIFY_DBM         3
+#define BATTERY_NOTIFY_PERCENT  1
+#define TEMP_NOTIFY_C           1.0f
+#define HEAP_NOTIFY_BYTES       4096
+
+typedef struct {
+    system_info_cb_t cb;
+    void *ctx;
+    uint32_t fields;
+    bool fresh;                 // Not called yet: gets every subscribed group
+} subscriber_t;
+
 // State
 static bool s_initialized = false;
 static system_info_t s_info = {0};
 static SemaphoreHandle_t s_mutex = NULL;
 static TaskHandle_t s_poll_task = NULL;
 static bool s_has_gps = false;
+static subscriber_t s_subscribers[SYSTEM_INFO_MAX_SUBSCRIBERS];
+
+// Poll task only
+static system_info_t s_notified;            // Values subscribers were last told about
+static pcf85063_datetime_t s_rtc_base;      // Last RTC reading
+static int64_t s_rtc_base_us = 0;           // esp_timer time of that reading
+static bool s_rtc_valid = false;
+static int64_t s_rtc_retry_us = 0;
+
+static const uint32_t s_poll_ms[SYSTEM_INFO_FIELD_MAX] = {
+    [SYSTEM_INFO_WIFI] = WIFI_POLL_MS,
+    [SYSTEM_INFO_BATTERY] = BATTERY_POLL_MS,
+    [SYSTEM_INFO_MEMORY] = MEMORY_POLL_MS,
+    [SYSTEM_INFO_RTC] = POLL_INTERVAL_MS,
+    [SYSTEM_INFO_GPS] = GPS_POLL_MS,
+    [SYSTEM_INFO_LATENCY] = LATENCY_POLL_MS,
+};
 
 // Forward declarations
 static void poll_task(void *arg);
-static void update_wifi_info(void);
-static void update_battery_info(void);
-static void update_memory_info(void);
-static void update_rtc_info(void);
-static void update_gps_info(void);
+static void update_wifi_info(system_info_t *info);
+static void update_battery_info(system_info_t *info);
+static void update_memory_info(system_info_t *info);
+static void update_rtc_info(system_info_t *info, int64_t now_us);
+static void update_gps_info(system_info_t *info);
+static void update_latency_info(system_info_t *info);
 
 esp_err_t system_info_init(void)
 {
@@ -55,6 +98,10 @@ esp_err_t system_info_init(void)
 
     // Initialize info structure
     memset(&s_info, 0, sizeof(s_info));
+    memset(&s_notified, 0, sizeof(s_notified));
+    memset(s_subscribers, 0, sizeof(s_subscribers));
+    s_rtc_valid = false;
+    s_rtc_retry_us = 0;
 
     // Check for GPS availability (compile-time or runtime detection)
 #ifdef CONFIG_GPS_ENABLED
@@ -96,6 +143,8 @@ esp_err_t system_info_deinit(void)
         s_poll_task = NULL;
     }
 
+    memset(s_subscribers, 0, sizeof(s_subscribers));
+
     // Delete mutex
     if (s_mutex != NULL) {
         vSemaphoreDelete(s_mutex);
@@ -123,6 +172,56 @@ esp_err_t system_info_get(system_info_t *info)
     return ESP_ERR_TIMEOUT;
 }
 
+esp_err_t system_info_subscribe(uint32_t fields, system_info_cb_t cb, void *ctx)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (cb == NULL || (fields & SYSTEM_INFO_MASK_ALL) == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = ESP_ERR_NO_MEM;
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    for (int i = 0; i < SYSTEM_INFO_MAX_SUBSCRIBERS; i++) {
+        if (s_subscribers[i].cb == NULL) {
+            s_subscribers[i] = (subscriber_t) {
+                .cb = cb,
+                .ctx = ctx,
+                .fields = fields & SYSTEM_INFO_MASK_ALL,
+                .fresh = true,
+            };
+            ret = ESP_OK;
+            break;
+        }
+    }
+    xSemaphoreGive(s_mutex);
+
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "No free subscriber slot");
+    }
+    return ret;
+}
+
+esp_err_t system_info_unsubscribe(system_info_cb_t cb, void *ctx)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    for (int i = 0; i < SYSTEM_INFO_MAX_SUBSCRIBERS; i++) {
+        if (s_subscribers[i].cb == cb && s_subscribers[i].ctx == ctx) {
+            memset(&s_subscribers[i], 0, sizeof(s_subscribers[i]));
+            ret = ESP_OK;
+            break;
+        }
+    }
+    xSemaphoreGive(s_mutex);
+    return ret;
+}
+
 const char* system_info_rssi_to_string(int8_t rssi)
 {
     if (rssi == 0) {
@@ -186,102 +285,297 @@ bool system_info_has_gps(void)
 // Private Functions
 // ============================================
 
+/**
+ * @brief Groups that moved past their threshold since subscribers were last notified
+ */
+static uint32_t changed_fields(const system_info_t *info, uint32_t polled)
+{
+    const system_info_t *was = &s_notified;
+    uint32_t changed = 0;
+
+    if ((polled & SYSTEM_INFO_MASK(SYSTEM_INFO_WIFI)) &&
+        (info->wifi_connected != was->wifi_connected ||
+         abs(info->wifi_rssi - was->wifi_rssi) >= RSSI_NOTIFY_DBM ||
+         strcmp(info->wifi_ssid, was->wifi_ssid) != 0 ||
+         strcmp(info->wifi_ip, was->wifi_ip) != 0)) {
+        changed |= SYSTEM_INFO_MASK(SYSTEM_INFO_WIFI);
+    }
+    if ((polled & SYSTEM_INFO_MASK(SYSTEM_INFO_BATTERY)) &&
+        (abs(info->battery_percent - was->battery_percent) >= BATTERY_NOTIFY_PERCENT ||
+         info->battery_charging != was->battery_charging ||
+         info->battery_present != was->battery_present ||
+         info->temperature_c - was->temperature_c >= TEMP_NOTIFY_C ||
+         was->temperature_c - info->temperature_c >= TEMP_NOTIFY_C)) {
+        changed |= SYSTEM_INFO_MASK(SYSTEM_INFO_BATTERY);
+    }
+    if ((polled & SYSTEM_INFO_MASK(SYSTEM_INFO_MEMORY)) &&
+        (info->heap_usage_percent != was->heap_usage_percent ||
+         labs((long)info->free_heap - (long)was->free_heap) >= HEAP_NOTIFY_BYTES)) {
+        changed |= SYSTEM_INFO_MASK(SYSTEM_INFO_MEMORY);
+    }
+    if ((polled & SYSTEM_INFO_MASK(SYSTEM_INFO_RTC)) &&
+        (info->rtc_second != was->rtc_second || info->rtc_minute != was->rtc_minute ||
+         info->rtc_hour != was->rtc_hour || info->rtc_day != was->rtc_day ||
+         info->rtc_month != was->rtc_month || info->rtc_year != was->rtc_year ||
+         info->rtc_weekday != was->rtc_weekday)) {
+        changed |= SYSTEM_INFO_MASK(SYSTEM_INFO_RTC);
+    }
+    if ((polled & SYSTEM_INFO_MASK(SYSTEM_INFO_GPS)) &&
+        (info->gps_available != was->gps_available || info->gps_fix != was->gps_fix ||
+         info->gps_satellites != was->gps_satellites ||
+         info->gps_latitude != was->gps_latitude || info->gps_longitude != was->gps_longitude)) {
+        changed |= SYSTEM_INFO_MASK(SYSTEM_INFO_GPS);
+    }
+    if ((polled & SYSTEM_INFO_MASK(SYSTEM_INFO_LATENCY)) &&
+        (info->turn_count != was->turn_count ||
+         info->turn_latency_p50_ms != was->turn_latency_p50_ms ||
+         info->turn_latency_p90_ms != was->turn_latency_p90_ms ||
+         info->turn_latency_p99_ms != was->turn_latency_p99_ms)) {
+        changed |= SYSTEM_INFO_MASK(SYSTEM_INFO_LATENCY);
+    }
+    return changed;
+}
+
+/**
+ * @brief Record a group's values as notified
+ */
+static void remember_field(system_info_field_t field, const system_info_t *info)
+{
+    system_info_t *was = &s_notified;
+
+    switch (field) {
+        case SYSTEM_INFO_WIFI:
+            was->wifi_connected = info->wifi_connected;
+            was->wifi_rssi = info->wifi_rssi;
+            memcpy(was->wifi_ssid, info->wifi_ssid, sizeof(was->wifi_ssid));
+            memcpy(was->wifi_ip, info->wifi_ip, sizeof(was->wifi_ip));
+            break;
+        case SYSTEM_INFO_BATTERY:
+            was->battery_percent = info->battery_percent;
+            was->battery_voltage_mv = info->battery_voltage_mv;
+            was->battery_charging = info->battery_charging;
+            was->battery_present = info->battery_present;
+            was->temperature_c = info->temperature_c;
+            break;
+        case SYSTEM_INFO_MEMORY:
+            was->free_heap = info->free_heap;
+            was->min_free_heap = info->min_free_heap;
+            was->heap_usage_percent = info->heap_usage_percent;
+            break;
+        case SYSTEM_INFO_RTC:
+            was->rtc_year = info->rtc_year;
+            was->rtc_month = info->rtc_month;
+            was->rtc_day = info->rtc_day;
+            was->rtc_weekday = info->rtc_weekday;
+            was->rtc_hour = info->rtc_hour;
+            was->rtc_minute = info->rtc_minute;
+            was->rtc_second = info->rtc_second;
+            break;
+        case SYSTEM_INFO_GPS:
+            was->gps_available = info->gps_available;
+            was->gps_fix = info->gps_fix;
+            was->gps_latitude = info->gps_latitude;
+            was->gps_longitude = info->gps_longitude;
+            was->gps_altitude = info->gps_altitude;
+            was->gps_satellites = info->gps_satellites;
+            break;
+        case SYSTEM_INFO_LATENCY:
+            was->turn_count = info->turn_count;
+            was->turn_latency_p50_ms = info->turn_latency_p50_ms;
+            was->turn_latency_p90_ms = info->turn_latency_p90_ms;
+            was->turn_latency_p99_ms = info->turn_latency_p99_ms;
+            break;
+        default:
+            break;
+    }
+}
+
 static void poll_task(void *arg)
 {
     TickType_t last_wake = xTaskGetTickCount();
+    uint32_t pass = 0;
+    system_info_t next;
+    subscriber_t subscribers[SYSTEM_INFO_MAX_SUBSCRIBERS];
+
+    // Only this task writes s_info, so it can be read without the mutex here
+    memcpy(&next, &s_info, sizeof(next));
 
     while (1) {
-        // Update all info with mutex protection
-        if (xSemaphoreTake(s_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
-            update_wifi_info();
-            update_battery_info();
-            update_memory_info();
-            update_rtc_info();
-            update_gps_info();
+        // Poll the groups that are due, without holding the mutex over I2C
+        uint32_t polled = 0;
+        for (int f = 0; f < SYSTEM_INFO_FIELD_MAX; f++) {
+            if (pass % (s_poll_ms[f] / POLL_INTERVAL_MS) == 0) {
+                polled |= SYSTEM_INFO_MASK(f);
+            }
+        }
+        int64_t now_us = esp_timer_get_time();
+        if (polled & SYSTEM_INFO_MASK(SYSTEM_INFO_WIFI)) {
+            update_wifi_info(&next);
+        }
+        if (polled & SYSTEM_INFO_MASK(SYSTEM_INFO_BATTERY)) {
+            update_battery_info(&next);
+        }
+        if (polled & SYSTEM_INFO_MASK(SYSTEM_INFO_MEMORY)) {
+            update_memory_info(&next);
+        }
+        if (polled & SYSTEM_INFO_MASK(SYSTEM_INFO_RTC)) {
+            update_rtc_info(&next, now_us);
+        }
+        if (polled & SYSTEM_INFO_MASK(SYSTEM_INFO_GPS)) {
+            update_gps_info(&next);
+        }
+        if (polled & SYSTEM_INFO_MASK(SYSTEM_INFO_LATENCY)) {
+            update_latency_info(&next);
+        }
+
+        // Update uptime
+        next.uptime_seconds = (uint32_t)(now_us / 1000000);
+        next.last_update_ms = xTaskGetTickCount() * portTICK_PERIOD_MS;
 
-            // Update uptime
-            s_info.uptime_seconds = (uint32_t)(esp_timer_get_time() / 1000000);
-            s_info.last_update_ms = xTaskGetTickCount() * portTICK_PERIOD_MS;
+        uint32_t changed = changed_fields(&next, polled);
 
+        if (xSemaphoreTake(s_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+            memcpy(&s_info, &next, sizeof(s_info));
+            memcpy(subscribers, s_subscribers, sizeof(subscribers));
+            for (int i = 0; i < SYSTEM_INFO_MAX_SUBSCRIBERS; i++) {
+                s_subscribers[i].fresh = false;
+            }
             xSemaphoreGive(s_mutex);
+
+            // Notify outside the mutex so callbacks can call system_info_get()
+            for (int i = 0; i < SYSTEM_INFO_MAX_SUBSCRIBERS; i++) {
+                const subscriber_t *sub = &subscribers[i];
+                uint32_t fields = sub->fresh ? sub->fields : (changed & sub->fields);
+                if (sub->cb && fields) {
+                    sub->cb(&next, fields, sub->ctx);
+                }
+            }
+
+            // Only now notified; if the mutex was busy the change is reported next pass
+            for (int f = 0; f < SYSTEM_INFO_FIELD_MAX; f++) {
+                if (changed & SYSTEM_INFO_MASK(f)) {
+                    remember_field((system_info_field_t)f, &next);
+                }
+            }
         }
 
+        pass++;
+
         // Wait for next poll interval
         vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(POLL_INTERVAL_MS));
     }
 }
 
-static void update_wifi_info(void)
+static void update_wifi_info(system_info_t *info)
 {
-    s_info.wifi_connected = app_wifi_is_connected();
+    info->wifi_connected = app_wifi_is_connected();
 
-    if (s_info.wifi_connected) {
-        s_info.wifi_rssi = app_wifi_get_rssi();
-        app_wifi_get_ip_string(s_info.wifi_ip, sizeof(s_info.wifi_ip));
+    if (info->wifi_connected) {
+        info->wifi_rssi = app_wifi_get_rssi();
+        app_wifi_get_ip_string(info->wifi_ip, sizeof(info->wifi_ip));
 
         // Get SSID from AP info
         wifi_ap_record_t ap_info;
         if (esp_wifi_sta_get_ap_info(&ap_info) == ESP_OK) {
-            strncpy(s_info.wifi_ssid, (char*)ap_info.ssid, sizeof(s_info.wifi_ssid) - 1);
-            s_info.wifi_ssid[sizeof(s_info.wifi_ssid) - 1] = '\0';
+            strncpy(info->wifi_ssid, (char*)ap_info.ssid, sizeof(info->wifi_ssid) - 1);
+            info->wifi_ssid[sizeof(info->wifi_ssid) - 1] = '\0';
         }
     } else {
-        s_info.wifi_rssi = 0;
-        s_info.wifi_ip[0] = '\0';
-        s_info.wifi_ssid[0] = '\0';
+        info->wifi_rssi = 0;
+        info->wifi_ip[0] = '\0';
+        info->wifi_ssid[0] = '\0';
     }
 }
 
-static void update_battery_info(void)
+static void update_battery_info(system_info_t *info)
 {
     axp2101_info_t batt_info;
     if (axp2101_get_info(&batt_info) == ESP_OK) {
-        s_info.battery_percent = batt_info.percent;
-        s_info.battery_voltage_mv = batt_info.voltage_mv;
-        s_info.battery_charging = batt_info.is_charging;
-        s_info.battery_present = batt_info.is_battery_present;
-        s_info.temperature_c = batt_info.temperature_c;
+        info->battery_percent = batt_info.percent;
+        info->battery_voltage_mv = batt_info.voltage_mv;
+        info->battery_charging = batt_info.is_charging;
+        info->battery_present = batt_info.is_battery_present;
+        info->temperature_c = batt_info.temperature_c;
     }
 }
 
-static void update_memory_info(void)
+static void update_memory_info(system_info_t *info)
 {
-    s_info.free_heap = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
-    s_info.min_free_heap = heap_caps_get_minimum_free_size(MALLOC_CAP_DEFAULT);
+    info->free_heap = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    info->min_free_heap = heap_caps_get_minimum_free_size(MALLOC_CAP_DEFAULT);
 
     // Calculate usage percentage
-    if (s_info.total_heap > 0) {
-        uint32_t used = s_info.total_heap - s_info.free_heap;
-        s_info.heap_usage_percent = (uint8_t)((used * 100) / s_info.total_heap);
+    if (info->total_heap > 0) {
+        uint32_t used = info->total_heap - info->free_heap;
+        info->heap_usage_percent = (uint8_t)((used * 100) / info->total_heap);
     }
 }
 
-static void update_rtc_info(void)
+/**
+ * @brief Count seconds on esp_timer, reading the RTC when the minute changes
+ */
+static void update_rtc_info(system_info_t *info, int64_t now_us)
 {
+    if (s_rtc_valid) {
+        // Passes are a whole period apart; rounding absorbs wake-up jitter
+        int64_t second = s_rtc_base.second + (now_us - s_rtc_base_us + 500000) / 1000000;
+        if (second < 60) {
+            info->rtc_second = (uint8_t)second;
+            return;
+        }
+    } else if (now_us < s_rtc_retry_us) {
+        return;
+    }
+
     pcf85063_datetime_t dt;
-    if (pcf85063_get_datetime(&dt) == ESP_OK) {
-        s_info.rtc_year = dt.year;
-        s_info.rtc_month = dt.month;
-        s_info.rtc_day = dt.day;
-        s_info.rtc_weekday = dt.weekday;
-        s_info.rtc_hour = dt.hour;
-        s_info.rtc_minute = dt.minute;
-        s_info.rtc_second = dt.second;
+    if (pcf85063_get_datetime(&dt) != ESP_OK) {
+        s_rtc_valid = false;
+        s_rtc_retry_us = now_us + RTC_RETRY_US;
+        return;
     }
+    s_rtc_base = dt;
+    s_rtc_base_us = now_us;
+    s_rtc_valid = true;
+
+    info->rtc_year = dt.year;
+    info->rtc_month = dt.month;
+    info->rtc_day = dt.day;
+    info->rtc_weekday = dt.weekday;
+    info->rtc_hour = dt.hour;
+    info->rtc_minute = dt.minute;
+    info->rtc_second = dt.second;
 }
 
-static void update_gps_info(void)
+static void update_gps_info(system_info_t *info)
 {
     if (!s_has_gps) {
-        s_info.gps_fix = false;
+        info->gps_fix = false;
         return;
     }
 
     // TODO: Integrate with GPS driver when available
     // For now, just mark as no fix
-    s_info.gps_fix = false;
-    s_info.gps_latitude = 0.0;
-    s_info.gps_longitude = 0.0;
-    s_info.gps_altitude = 0.0f;
-    s_info.gps_satellites = 0;
+    info->gps_fix = false;
+    info->gps_latitude = 0.0;
+    info->gps_longitude = 0.0;
+    info->gps_altitude = 0.0f;
+    info->gps_satellites = 0;
+}
+
+static void update_latency_info(system_info_t *info)
+{
+    // Report the provider that has served the most turns
+    latency_stats_t best = {0};
+    for (int p = 0; p < LATENCY_PROVIDER_MAX; p++) {
+        latency_stats_t stats;
+        if (latency_ledger_get_stats((latency_provider_t)p, LATENCY_MARK_FIRST_I2S_WRITE,
+                                     &stats) == ESP_OK && stats.count > best.count) {
+            best = stats;
+        }
+    }
+
+    info->turn_count = best.count;
+    info->turn_latency_p50_ms = best.p50_ms;
+    info->turn_latency_p90_ms = best.p90_ms;
+    info->turn_latency_p99_ms = best.p99_ms;
 }
@@ -4,6 +4,12 @@
  *
  * Collects WiFi, battery, memory, temperature, GPS, and RTC data
  * in a background task with thread-safe access.
+ *
+ * Each field group is polled at its own cadence: heap every second,
+ * Wi-Fi and turn latency every 5 s, the AXP2101 every 30 s. The PCF85063
+ * is read only when the minute changes; seconds in between come from
+ * esp_timer. Subscribers are called when a group changed past its
+ * threshold, measured from the value they were last notified of.
  */
 
 #ifndef SYSTEM_INFO_H
@@ -62,15 +68,50 @@ typedef struct {
     // System info
     uint32_t uptime_seconds;      // seconds since boot
 
+    // Turn latency (voice end -> first I2S write, busiest provider)
+    uint32_t turn_count;          // recorded turns, persisted across boots
+    uint32_t turn_latency_p50_ms;
+    uint32_t turn_latency_p90_ms;
+    uint32_t turn_latency_p99_ms;
+
     // Update timestamp
     uint32_t last_update_ms;      // tick when last updated
 } system_info_t;
 
+/**
+ * @brief Field groups, polled and notified together
+ */
+typedef enum {
+    SYSTEM_INFO_WIFI = 0,         // wifi_*: connection, SSID, IP, RSSI (3 dBm)
+    SYSTEM_INFO_BATTERY,          // battery_*, temperature_c (1 %, 1 degree)
+    SYSTEM_INFO_MEMORY,           // *_heap, heap_usage_percent (4 KB, 1 %)
+    SYSTEM_INFO_RTC,              // rtc_*: every second
+    SYSTEM_INFO_GPS,              // gps_*
+    SYSTEM_INFO_LATENCY,          // turn_*
+    SYSTEM_INFO_FIELD_MAX
+} system_info_field_t;
+
+#define SYSTEM_INFO_MASK(field)   (1u << (field))
+#define SYSTEM_INFO_MASK_ALL      ((1u << SYSTEM_INFO_FIELD_MAX) - 1)
+
+#define SYSTEM_INFO_MAX_SUBSCRIBERS 4
+
+/**
+ * @brief Change callback
+ *
+ * Runs on the system info task without its lock held; keep it short and
+ * do not call system_info_subscribe() / system_info_unsubscribe() from it.
+ *
+ * @param info    Snapshot after the change
+ * @param changed SYSTEM_INFO_MASK() bits of the groups that changed
+ * @param ctx     Context given to system_info_subscribe()
+ */
+typedef void (*system_info_cb_t)(const system_info_t *info, uint32_t changed, void *ctx);
+
 /**
  * @brief Initialize system info module
  *
- * Starts background polling task that updates all system info
- * every 1 second.
+ * Starts the background polling task; its first pass reads every field.
  *
  * @return ESP_OK on success
  */
@@ -95,6 +136,31 @@ esp_err_t system_info_deinit(void);
  */
 esp_err_t system_info_get(system_info_t *info);
 
+/**
+ * @brief Subscribe to changes
+ *
+ * The callback is first called from the next poll with every subscribed
+ * group, then only with groups that changed.
+ *
+ * @param fields SYSTEM_INFO_MASK() bits of the groups of interest
+ * @param cb     Callback
+ * @param ctx    Callback context
+ * @return ESP_OK, ESP_ERR_INVALID_STATE if not initialized,
+ *         ESP_ERR_NO_MEM if SYSTEM_INFO_MAX_SUBSCRIBERS are subscribed
+ */
+esp_err_t system_info_subscribe(uint32_t fields, system_info_cb_t cb, void *ctx);
+
+/**
+ * @brief Remove a subscription
+ *
+ * A poll already in progress may still call the callback once.
+ *
+ * @param cb  Callback given to system_info_subscribe()
+ * @param ctx Context given to system_info_subscribe()
+ * @return ESP_OK, ESP_ERR_NOT_FOUND if not subscribed
+ */
+esp_err_t system_info_unsubscribe(system_info_cb_t cb, void *ctx);
+
 /**
  * @brief Get WiFi signal strength description
  *
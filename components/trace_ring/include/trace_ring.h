@@ -0,0 +1,176 @@
+/**
+ * @file trace_ring.h
+ * @brief Lock-free binary trace ring with deferred formatting
+ *
+ * Hot paths record fixed-size binary events (id, timestamp, core, two
+ * arguments) instead of formatting log lines. The ring is formatted only on
+ * demand, as Chrome / Perfetto trace JSON (chrome://tracing, ui.perfetto.dev).
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "esp_err.h"
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#else
+// Host builds: enabled with the default capacity unless overridden
+#ifndef CONFIG_TRACE_RING_ENABLE
+#define CONFIG_TRACE_RING_ENABLE    1
+#endif
+#ifndef CONFIG_TRACE_RING_CAPACITY
+#define CONFIG_TRACE_RING_CAPACITY  1024
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================
+// Event Definitions
+// ============================================
+
+/**
+ * @brief Trace event table: X(id, name, arg0 name, arg1 name)
+ *
+ * Names are only used by the exporter; add new events at the end so ids in
+ * saved dumps stay stable.
+ */
+#define TRACE_EVENT_LIST(X) \
+    X(TRACE_EV_REC_FRAME,       "rec_frame",        "energy",   "vad")      \
+    X(TRACE_EV_REC_DSP,         "rec_dsp",          "samples",  "aec")      \
+    X(TRACE_EV_REC_DROP,        "rec_drop",         "bytes",    "unused")   \
+    X(TRACE_EV_PIPE_FRAME,      "pipe_frame",       "bytes",    "vad")      \
+    X(TRACE_EV_AUDIO_CB,        "audio_cb",         "bytes",    "vad")      \
+    X(TRACE_EV_APP_STATE,       "app_state",        "from",     "to")       \
+    X(TRACE_EV_WS_RECV,         "ws_recv",          "src",      "bytes")    \
+    X(TRACE_EV_WS_SEND,         "ws_send",          "src",      "bytes")    \
+    X(TRACE_EV_WS_QUEUE_DROP,   "ws_queue_drop",    "src",      "bytes")    \
+    X(TRACE_EV_PLAY_WRITE,      "play_write",       "bytes",    "muted")    \
+    X(TRACE_EV_RENDER_WRITE,    "render_write",     "bytes",    "unused")   \
+    X(TRACE_EV_SELF_TEST,       "self_test",        "index",    "unused")
+
+#define TRACE_EVENT_ENUM(id, name, a0, a1) id,
+
+typedef enum {
+    TRACE_EVENT_LIST(TRACE_EVENT_ENUM)
+    TRACE_EV_MAX,
+} trace_event_id_t;
+
+/**
+ * @brief Event phase (maps to Chrome trace "ph")
+ */
+typedef enum {
+    TRACE_PHASE_INSTANT = 0,            // "i"
+    TRACE_PHASE_BEGIN,                  // "B"
+    TRACE_PHASE_END,                    // "E"
+    TRACE_PHASE_COUNTER,                // "C", arg0 is the value
+} trace_phase_t;
+
+/**
+ * @brief Source tag for TRACE_EV_WS_* events
+ */
+#define TRACE_SRC_COZE      0
+#define TRACE_SRC_AZURE     1
+
+/**
+ * @brief Ring statistics
+ */
+typedef struct {
+    uint32_t recorded;                  // Events recorded since last clear
+    uint32_t capacity;                  // Ring capacity in events
+    uint32_t overwritten;               // Events lost to wrap-around
+    bool enabled;
+} trace_ring_stats_t;
+
+// ============================================
+// Instrumentation Macros
+// ============================================
+
+#if CONFIG_TRACE_RING_ENABLE
+#define TRACE_EVENT(id, a0, a1)     trace_ring_record((id), TRACE_PHASE_INSTANT, (uint32_t)(a0), (uint32_t)(a1))
+#define TRACE_BEGIN(id, a0, a1)     trace_ring_record((id), TRACE_PHASE_BEGIN, (uint32_t)(a0), (uint32_t)(a1))
+#define TRACE_END(id, a0, a1)       trace_ring_record((id), TRACE_PHASE_END, (uint32_t)(a0), (uint32_t)(a1))
+#define TRACE_COUNTER(id, value)    trace_ring_record((id), TRACE_PHASE_COUNTER, (uint32_t)(value), 0)
+#else
+#define TRACE_EVENT(id, a0, a1)     do { (void)(a0); (void)(a1); } while (0)
+#define TRACE_BEGIN(id, a0, a1)     do { (void)(a0); (void)(a1); } while (0)
+#define TRACE_END(id, a0, a1)       do { (void)(a0); (void)(a1); } while (0)
+#define TRACE_COUNTER(id, value)    do { (void)(value); } while (0)
+#endif
+
+// ============================================
+// Trace Ring Function Declarations
+// ============================================
+
+/**
+ * @brief Record one event (use the TRACE_* macros instead)
+ *
+ * Lock-free: one atomic increment plus a 20-byte store. Safe from tasks
+ * and from ISRs that run with the flash cache enabled; the record path is
+ * not in IRAM, so not from IRAM (ESP_INTR_FLAG_IRAM) ISRs. The oldest
+ * events are overwritten when the ring is full.
+ *
+ * @param id Event id
+ * @param phase Event phase
+ * @param arg0 First argument
+ * @param arg1 Second argument
+ */
+void trace_ring_record(trace_event_id_t id, trace_phase_t phase, uint32_t arg0, uint32_t arg1);
+
+/**
+ * @brief Enable or disable recording
+ *
+ * @param enabled true to record events
+ */
+void trace_ring_set_enabled(bool enabled);
+
+/**
+ * @brief Discard all recorded events
+ */
+void trace_ring_clear(void);
+
+/**
+ * @brief Get ring statistics
+ *
+ * @param stats Output statistics
+ */
+void trace_ring_get_stats(trace_ring_stats_t *stats);
+
+/**
+ * @brief Write the ring contents as Chrome trace JSON
+ *
+ * Recording is paused while exporting so the snapshot is consistent.
+ *
+ * @param out Destination stream (stdout for the console, or a file on SD)
+ * @param written Optional output, number of events written
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if out is NULL,
+ *         ESP_FAIL on a stream write error
+ */
+esp_err_t trace_ring_export_json(FILE *out, uint32_t *written);
+
+/**
+ * @brief Measure the cost of recording one event
+ *
+ * Records iterations TRACE_EV_SELF_TEST events and clears the ring afterwards.
+ *
+ * @param iterations Number of events to record
+ * @return Average cost per event in nanoseconds
+ */
+uint32_t trace_ring_measure_cost(uint32_t iterations);
+
+/**
+ * @brief Get event name string
+ *
+ * @param id Event id
+ * @return Event name string
+ */
+const char *trace_ring_event_name(trace_event_id_t id);
+
+#ifdef __cplusplus
+}
+#endif
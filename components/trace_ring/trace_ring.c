@@ -0,0 +1,269 @@
+/**
+ * @file trace_ring.c
+ * @brief Lock-free binary trace ring implementation
+ *
+ * Writers claim a slot with one atomic fetch-add on the head index and
+ * publish it seqlock-style: the slot sequence is cleared, the payload is
+ * stored, then the sequence is set to index + 1. The exporter only accepts
+ * slots whose sequence matches before and after copying, so a slot being
+ * overwritten concurrently is skipped instead of emitted torn.
+ */
+
+#include "trace_ring.h"
+
+#include <stdatomic.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_timer.h"
+#include "esp_cpu.h"
+#else
+#include <time.h>
+#endif
+
+#define RING_CAPACITY   CONFIG_TRACE_RING_CAPACITY
+#define RING_MASK       (RING_CAPACITY - 1)
+
+_Static_assert((RING_CAPACITY & RING_MASK) == 0, "CONFIG_TRACE_RING_CAPACITY must be a power of two");
+
+// ============================================
+// Platform Layer
+// ============================================
+
+#ifdef ESP_PLATFORM
+static inline uint32_t now_us(void)
+{
+    return (uint32_t)esp_timer_get_time();
+}
+
+static inline uint8_t core_id(void)
+{
+    return (uint8_t)esp_cpu_get_core_id();
+}
+#else
+static inline uint32_t now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static inline uint8_t core_id(void)
+{
+    return 0;
+}
+#endif
+
+// ============================================
+// Private Types and Variables
+// ============================================
+
+/**
+ * @brief One ring slot (20 bytes)
+ */
+typedef struct {
+    _Atomic uint32_t seq;               // Slot index + 1 once published, 0 while writing
+    uint32_t ts_us;                     // Wraps every ~71 minutes
+    uint16_t id;
+    uint8_t core;
+    uint8_t phase;
+    uint32_t arg0;
+    uint32_t arg1;
+} trace_slot_t;
+
+typedef struct {
+    const char *name;
+    const char *arg0;
+    const char *arg1;
+} trace_event_desc_t;
+
+#define TRACE_EVENT_DESC(id, name, a0, a1) [id] = { name, a0, a1 },
+
+static const trace_event_desc_t s_event_desc[TRACE_EV_MAX] = {
+    TRACE_EVENT_LIST(TRACE_EVENT_DESC)
+};
+
+static trace_slot_t s_ring[RING_CAPACITY];
+static _Atomic uint32_t s_head = 0;     // Next index to claim
+static _Atomic uint32_t s_tail = 0;     // First index after the last clear
+static _Atomic bool s_enabled = true;
+
+static const char s_phase_char[] = { 'i', 'B', 'E', 'C' };
+
+// ============================================
+// Recording
+// ============================================
+
+void trace_ring_record(trace_event_id_t id, trace_phase_t phase, uint32_t arg0, uint32_t arg1)
+{
+    if (!atomic_load_explicit(&s_enabled, memory_order_relaxed)) {
+        return;
+    }
+
+    uint32_t index = atomic_fetch_add_explicit(&s_head, 1, memory_order_relaxed);
+    trace_slot_t *slot = &s_ring[index & RING_MASK];
+
+    atomic_store_explicit(&slot->seq, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    slot->ts_us = now_us();
+    slot->id = (uint16_t)id;
+    slot->core = core_id();
+    slot->phase = (uint8_t)phase;
+    slot->arg0 = arg0;
+    slot->arg1 = arg1;
+
+    atomic_store_explicit(&slot->seq, index + 1, memory_order_release);
+}
+
+void trace_ring_set_enabled(bool enabled)
+{
+    atomic_store(&s_enabled, enabled);
+}
+
+void trace_ring_clear(void)
+{
+    atomic_store(&s_tail, atomic_load(&s_head));
+}
+
+void trace_ring_get_stats(trace_ring_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+
+    uint32_t recorded = atomic_load(&s_head) - atomic_load(&s_tail);
+    stats->recorded = recorded;
+    stats->capacity = RING_CAPACITY;
+    stats->overwritten = recorded > RING_CAPACITY ? recorded - RING_CAPACITY : 0;
+    stats->enabled = atomic_load(&s_enabled);
+}
+
+/**
+ * @brief Copy one published slot, rejecting slots being overwritten
+ */
+static bool read_slot(uint32_t index, trace_slot_t *out)
+{
+    const trace_slot_t *slot = &s_ring[index & RING_MASK];
+
+    uint32_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+    if (seq != index + 1) {
+        return false;
+    }
+
+    out->ts_us = slot->ts_us;
+    out->id = slot->id;
+    out->core = slot->core;
+    out->phase = slot->phase;
+    out->arg0 = slot->arg0;
+    out->arg1 = slot->arg1;
+
+    atomic_thread_fence(memory_order_acquire);
+    return atomic_load_explicit(&slot->seq, memory_order_relaxed) == seq &&
+           out->id < TRACE_EV_MAX && out->phase <= TRACE_PHASE_COUNTER;
+}
+
+// ============================================
+// Export
+// ============================================
+
+esp_err_t trace_ring_export_json(FILE *out, uint32_t *written)
+{
+    if (out == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    bool was_enabled = atomic_exchange(&s_enabled, false);
+
+    uint32_t head = atomic_load(&s_head);
+    uint32_t start = atomic_load(&s_tail);
+    if (head - start > RING_CAPACITY) {
+        start = head - RING_CAPACITY;
+    }
+
+    // Timestamps are emitted relative to the oldest event, which also
+    // absorbs the 32-bit microsecond wrap.
+    trace_slot_t ev;
+    uint32_t base_us = 0;
+    bool have_base = false;
+    for (uint32_t i = start; i != head && !have_base; i++) {
+        if (read_slot(i, &ev)) {
+            base_us = ev.ts_us;
+            have_base = true;
+        }
+    }
+
+    uint32_t count = 0;
+    int err = fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (int core = 0; core < 2 && err >= 0; core++) {
+        err = fprintf(out, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,"
+                      "\"args\":{\"name\":\"core%d\"}},\n", core, core);
+    }
+
+    for (uint32_t i = start; i != head && err >= 0; i++) {
+        if (!read_slot(i, &ev)) {
+            continue;
+        }
+
+        const trace_event_desc_t *desc = &s_event_desc[ev.id];
+        uint32_t ts = ev.ts_us - base_us;
+
+        if (ev.phase == TRACE_PHASE_COUNTER) {
+            err = fprintf(out, "%s{\"name\":\"%s\",\"ph\":\"C\",\"ts\":%lu,\"pid\":1,"
+                          "\"args\":{\"%s\":%lu}}",
+                          count ? ",\n" : "", desc->name, (unsigned long)ts,
+                          desc->arg0, (unsigned long)ev.arg0);
+        } else {
+            err = fprintf(out, "%s{\"name\":\"%s\",\"ph\":\"%c\",%s\"ts\":%lu,\"pid\":1,\"tid\":%u,"
+                          "\"args\":{\"%s\":%lu,\"%s\":%lu}}",
+                          count ? ",\n" : "", desc->name, s_phase_char[ev.phase],
+                          ev.phase == TRACE_PHASE_INSTANT ? "\"s\":\"t\"," : "",
+                          (unsigned long)ts, ev.core,
+                          desc->arg0, (unsigned long)ev.arg0,
+                          desc->arg1, (unsigned long)ev.arg1);
+        }
+        count++;
+    }
+    if (err >= 0) {
+        err = fprintf(out, "\n]}\n");
+    }
+
+    atomic_store(&s_enabled, was_enabled);
+
+    if (written) {
+        *written = count;
+    }
+    return err < 0 ? ESP_FAIL : ESP_OK;
+}
+
+// ============================================
+// Utilities
+// ============================================
+
+uint32_t trace_ring_measure_cost(uint32_t iterations)
+{
+    if (iterations == 0) {
+        return 0;
+    }
+
+    bool was_enabled = atomic_exchange(&s_enabled, true);
+
+    uint32_t start = now_us();
+    for (uint32_t i = 0; i < iterations; i++) {
+        trace_ring_record(TRACE_EV_SELF_TEST, TRACE_PHASE_INSTANT, i, 0);
+    }
+    uint32_t elapsed_us = now_us() - start;
+
+    trace_ring_clear();
+    atomic_store(&s_enabled, was_enabled);
+
+    return (uint32_t)(((uint64_t)elapsed_us * 1000) / iterations);
+}
+
+const char *trace_ring_event_name(trace_event_id_t id)
+{
+    if (id < 0 || id >= TRACE_EV_MAX) {
+        return "unknown";
+    }
+    return s_event_desc[id].name;
+}
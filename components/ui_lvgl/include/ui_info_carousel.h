@@ -14,6 +14,7 @@
  * - Auto-rotation every 5 seconds
  * - Swipe gesture support
  * - Animated page transitions
+ * - Updates driven by system_info change notifications
  */
 
 #ifndef UI_INFO_CAROUSEL_H
@@ -79,10 +80,11 @@ void ui_info_carousel_hide(void);
 bool ui_info_carousel_is_visible(void);
 
 /**
- * @brief Update carousel data from system_info
+ * @brief Apply pending system_info changes to the tiles
  *
- * Should be called periodically (e.g., every 1 second) to
- * refresh displayed information.
+ * While visible, the carousel updates itself when system_info reports a
+ * change; call this after showing it to catch up on changes made while it
+ * was hidden. Only labels whose text changed are set.
  */
 void ui_info_carousel_update(void);
 
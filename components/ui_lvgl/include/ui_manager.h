@@ -166,13 +166,6 @@ void ui_manager_update_transcript(const char *text, bool is_user);
  */
 void ui_manager_clear_transcript(void);
 
-/**
- * @brief Update audio level indicator
- *
- * @param level Audio level (0-100)
- */
-void ui_manager_update_audio_level(uint8_t level);
-
 /**
  * @brief Show/hide WiFi indicator
  *
@@ -45,6 +45,10 @@ void ui_speaking_update_text(const char *text);
 /**
  * @brief Append text to response display
  *
+ * Safe from any task without the display lock. The text is added to the
+ * transcript ring at once; the labels are updated at most once per LVGL
+ * refresh period, so bursts of deltas cost one redraw.
+ *
  * @param text Text to append
  */
 void ui_speaking_append_text(const char *text);
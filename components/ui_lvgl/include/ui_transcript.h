@@ -0,0 +1,116 @@
+/**
+ * @file ui_transcript.h
+ * @brief Wrapped transcript text kept as a ring of lines
+ *
+ * Streamed response text is appended delta by delta. Only the last line is
+ * laid out again (word wrap at the line width, any character for CJK);
+ * finished lines keep their span in a text ring until they are evicted by
+ * the line or byte limit. A view asks which lines changed since it last
+ * looked and copies just those, instead of setting and wrapping the whole
+ * text on every delta.
+ *
+ * Independent of LVGL (glyph widths come from a callback) so the host
+ * bench can use it. Not thread-safe; the caller serializes access.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Transcript handle
+ */
+typedef struct ui_transcript *ui_transcript_handle_t;
+
+/**
+ * @brief Advance of one glyph in pixels
+ *
+ * @param letter Unicode code point
+ * @param ctx    Callback context
+ */
+typedef uint16_t (*ui_transcript_glyph_width_t)(uint32_t letter, void *ctx);
+
+/**
+ * @brief Transcript configuration
+ */
+typedef struct {
+    uint16_t                    max_width;    // Line width in pixels
+    uint16_t                    max_lines;    // Lines kept, the oldest are evicted
+    uint16_t                    text_size;    // Text bytes kept, the oldest lines are evicted
+    ui_transcript_glyph_width_t glyph_width;  // Glyph advance
+    void                       *ctx;          // Glyph advance context
+} ui_transcript_cfg_t;
+
+/**
+ * @brief Create a transcript
+ *
+ * @param cfg Configuration
+ * @return Transcript handle, NULL on invalid configuration or no memory
+ */
+ui_transcript_handle_t ui_transcript_create(const ui_transcript_cfg_t *cfg);
+
+/**
+ * @brief Destroy a transcript
+ */
+void ui_transcript_destroy(ui_transcript_handle_t t);
+
+/**
+ * @brief Drop all text
+ *
+ * The next ui_transcript_take_dirty() reports every line as changed.
+ */
+void ui_transcript_clear(ui_transcript_handle_t t);
+
+/**
+ * @brief Append a UTF-8 delta
+ *
+ * A sequence split across deltas is completed by the next one; '\n'
+ * starts a new line.
+ *
+ * @param t    Transcript
+ * @param text Text to append
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on NULL arguments
+ */
+esp_err_t ui_transcript_append(ui_transcript_handle_t t, const char *text);
+
+/**
+ * @brief Get the range of lines kept
+ *
+ * Lines have increasing ids; [first, end) are still kept.
+ *
+ * @param t     Transcript
+ * @param first Id of the oldest line kept
+ * @param end   Id after the newest line
+ */
+void ui_transcript_get_lines(ui_transcript_handle_t t, uint32_t *first, uint32_t *end);
+
+/**
+ * @brief Copy a line
+ *
+ * @param t    Transcript
+ * @param id   Line id
+ * @param buf  Output, NUL-terminated
+ * @param size Output size
+ * @return Bytes copied, 0 for an empty or evicted line
+ */
+size_t ui_transcript_copy_line(ui_transcript_handle_t t, uint32_t id, char *buf, size_t size);
+
+/**
+ * @brief Take the lines changed since the last call
+ *
+ * @param t    Transcript
+ * @param from First changed line id; lines from it to the end changed
+ * @return false if nothing changed
+ */
+bool ui_transcript_take_dirty(ui_transcript_handle_t t, uint32_t *from);
+
+#ifdef __cplusplus
+}
+#endif
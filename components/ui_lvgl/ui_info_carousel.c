@@ -8,6 +8,8 @@
 #include "system_info.h"
 #include "esp_log.h"
 #include <stdio.h>
+#include <string.h>
+#include <stdatomic.h>
 
 static const char *TAG = "ui_carousel";
 
@@ -34,6 +36,9 @@ static lv_obj_t *s_indicators[CAROUSEL_PAGE_MAX] = {0};
 static lv_timer_t *s_auto_rotate_timer = NULL;
 static carousel_page_t s_current_page = CAROUSEL_PAGE_WIFI;
 
+// system_info groups changed since the tiles were last updated
+static atomic_uint s_pending = SYSTEM_INFO_MASK_ALL;
+
 // Tile content labels
 static lv_obj_t *s_wifi_icon = NULL;
 static lv_obj_t *s_wifi_ssid_label = NULL;
@@ -73,6 +78,7 @@ static void create_page_indicator(lv_obj_t *parent);
 static void update_page_indicator(carousel_page_t page);
 static void auto_rotate_timer_cb(lv_timer_t *timer);
 static void tileview_event_cb(lv_event_t *e);
+static void info_changed_cb(const system_info_t *info, uint32_t changed, void *ctx);
 
 // ============================================
 // Tile Creation Functions
@@ -355,6 +361,204 @@ static void tileview_event_cb(lv_event_t *e)
     }
 }
 
+// ============================================
+// Tile Updates
+// ============================================
+
+/**
+ * @brief Set a label's text only if it differs (setting it always redraws)
+ */
+static void set_label_text(lv_obj_t *label, const char *text)
+{
+    if (label && strcmp(lv_label_get_text(label), text) != 0) {
+        lv_label_set_text(label, text);
+    }
+}
+
+/**
+ * @brief Set an icon's symbol (NULL keeps it) and color only if they differ
+ */
+static void set_icon(lv_obj_t *icon, const char *symbol, lv_color_t color)
+{
+    if (icon == NULL) {
+        return;
+    }
+    if (symbol) {
+        set_label_text(icon, symbol);
+    }
+    if (!lv_color_eq(lv_obj_get_style_text_color(icon, LV_PART_MAIN), color)) {
+        lv_obj_set_style_text_color(icon, color, 0);
+    }
+}
+
+static void update_wifi_tile(const system_info_t *info)
+{
+    char buf[64];
+
+    if (info->wifi_connected) {
+        set_label_text(s_wifi_ssid_label, info->wifi_ssid[0] ? info->wifi_ssid : "Connected");
+        set_icon(s_wifi_icon, NULL, UI_COLOR_SECONDARY);
+
+        snprintf(buf, sizeof(buf), "Signal: %s (%d dBm)",
+                 system_info_rssi_to_string(info->wifi_rssi), info->wifi_rssi);
+        set_label_text(s_wifi_rssi_label, buf);
+    } else {
+        set_label_text(s_wifi_ssid_label, "Not Connected");
+        set_label_text(s_wifi_rssi_label, "Signal: --");
+        set_icon(s_wifi_icon, NULL, UI_COLOR_ERROR);
+    }
+}
+
+static void update_battery_tile(const system_info_t *info)
+{
+    char buf[64];
+
+    snprintf(buf, sizeof(buf), "%d%%", info->battery_percent);
+    set_label_text(s_batt_percent_label, buf);
+    set_label_text(s_batt_status_label,
+                   system_info_battery_status(info->battery_percent, info->battery_charging));
+
+    // Update icon color based on level
+    if (info->battery_charging) {
+        set_icon(s_batt_icon, LV_SYMBOL_CHARGE, UI_COLOR_SECONDARY);
+    } else if (info->battery_percent < 20) {
+        set_icon(s_batt_icon, LV_SYMBOL_BATTERY_EMPTY, UI_COLOR_ERROR);
+    } else if (info->battery_percent < 50) {
+        set_icon(s_batt_icon, LV_SYMBOL_BATTERY_2, UI_COLOR_THINKING);
+    } else if (info->battery_percent < 80) {
+        set_icon(s_batt_icon, LV_SYMBOL_BATTERY_3, UI_COLOR_SECONDARY);
+    } else {
+        set_icon(s_batt_icon, LV_SYMBOL_BATTERY_FULL, UI_COLOR_SECONDARY);
+    }
+}
+
+static void update_memory_tile(const system_info_t *info)
+{
+    char buf[64];
+
+    snprintf(buf, sizeof(buf), "%d%%", info->heap_usage_percent);
+    set_label_text(s_mem_usage_label, buf);
+
+    snprintf(buf, sizeof(buf), "Free: %lu KB", (unsigned long)(info->free_heap / 1024));
+    set_label_text(s_mem_detail_label, buf);
+
+    // Update color based on usage
+    if (info->heap_usage_percent > 90) {
+        set_icon(s_mem_icon, NULL, UI_COLOR_ERROR);
+    } else if (info->heap_usage_percent > 70) {
+        set_icon(s_mem_icon, NULL, UI_COLOR_THINKING);
+    } else {
+        set_icon(s_mem_icon, NULL, UI_COLOR_ACCENT);
+    }
+}
+
+static void update_temperature_tile(const system_info_t *info)
+{
+    char buf[64];
+
+    snprintf(buf, sizeof(buf), "%.1f°C", info->temperature_c);
+    set_label_text(s_temp_value_label, buf);
+
+    // Update color based on temperature
+    if (info->temperature_c > 60) {
+        set_icon(s_temp_icon, NULL, UI_COLOR_ERROR);
+        set_label_text(s_temp_status_label, "High Temperature!");
+    } else if (info->temperature_c > 45) {
+        set_icon(s_temp_icon, NULL, UI_COLOR_THINKING);
+        set_label_text(s_temp_status_label, "Warm");
+    } else {
+        set_icon(s_temp_icon, NULL, UI_COLOR_SECONDARY);
+        set_label_text(s_temp_status_label, "Normal");
+    }
+}
+
+static void update_gps_tile(const system_info_t *info)
+{
+    char buf[64];
+
+    if (!info->gps_available) {
+        set_label_text(s_gps_status_label, "Not Available");
+        set_label_text(s_gps_coord_label, "");
+        set_icon(s_gps_icon, NULL, UI_COLOR_TEXT_DIM);
+    } else if (info->gps_fix) {
+        set_label_text(s_gps_status_label, "GPS Fixed");
+        snprintf(buf, sizeof(buf), "%.6f, %.6f", info->gps_latitude, info->gps_longitude);
+        set_label_text(s_gps_coord_label, buf);
+        set_icon(s_gps_icon, NULL, UI_COLOR_SECONDARY);
+    } else {
+        set_label_text(s_gps_status_label, "Searching...");
+        snprintf(buf, sizeof(buf), "Satellites: %d", info->gps_satellites);
+        set_label_text(s_gps_coord_label, buf);
+        set_icon(s_gps_icon, NULL, UI_COLOR_THINKING);
+    }
+}
+
+static void update_datetime_tile(const system_info_t *info)
+{
+    char buf[64];
+
+    snprintf(buf, sizeof(buf), "%02d:%02d:%02d",
+             info->rtc_hour, info->rtc_minute, info->rtc_second);
+    set_label_text(s_time_label, buf);
+
+    snprintf(buf, sizeof(buf), "%04d/%02d/%02d",
+             info->rtc_year, info->rtc_month, info->rtc_day);
+    set_label_text(s_date_label, buf);
+
+    // Weekday names
+    static const char *weekdays[] = {
+        "Sunday", "Monday", "Tuesday", "Wednesday",
+        "Thursday", "Friday", "Saturday"
+    };
+    if (info->rtc_weekday < 7) {
+        set_label_text(s_weekday_label, weekdays[info->rtc_weekday]);
+    }
+}
+
+/**
+ * @brief Update the tiles of every pending group from a snapshot
+ */
+static void apply_pending(const system_info_t *info)
+{
+    uint32_t changed = atomic_exchange(&s_pending, 0);
+
+    if (changed & SYSTEM_INFO_MASK(SYSTEM_INFO_WIFI)) {
+        update_wifi_tile(info);
+    }
+    if (changed & SYSTEM_INFO_MASK(SYSTEM_INFO_BATTERY)) {
+        update_battery_tile(info);
+        update_temperature_tile(info);
+    }
+    if (changed & SYSTEM_INFO_MASK(SYSTEM_INFO_MEMORY)) {
+        update_memory_tile(info);
+    }
+    if (changed & SYSTEM_INFO_MASK(SYSTEM_INFO_GPS)) {
+        update_gps_tile(info);
+    }
+    if (changed & SYSTEM_INFO_MASK(SYSTEM_INFO_RTC)) {
+        update_datetime_tile(info);
+    }
+}
+
+/**
+ * @brief system_info change callback - runs on the system info task
+ *
+ * While the carousel is hidden the changes only accumulate; showing it
+ * applies them.
+ */
+static void info_changed_cb(const system_info_t *info, uint32_t changed, void *ctx)
+{
+    (void)ctx;
+    atomic_fetch_or(&s_pending, changed);
+
+    if (s_visible && ui_manager_lock(50)) {
+        if (s_initialized && s_visible) {
+            apply_pending(info);
+        }
+        ui_manager_unlock();
+    }
+}
+
 // ============================================
 // Public Functions
 // ============================================
@@ -414,6 +618,12 @@ esp_err_t ui_info_carousel_init(lv_obj_t *parent)
     s_visible = false;
     s_current_page = CAROUSEL_PAGE_WIFI;
 
+    // Tiles follow system_info changes; everything is pending until first shown
+    atomic_store(&s_pending, SYSTEM_INFO_MASK_ALL);
+    if (system_info_subscribe(SYSTEM_INFO_MASK_ALL, info_changed_cb, NULL) != ESP_OK) {
+        ESP_LOGW(TAG, "system_info not running, tiles update only when shown");
+    }
+
     ESP_LOGI(TAG, "Info carousel initialized");
     return ESP_OK;
 }
@@ -425,6 +635,7 @@ esp_err_t ui_info_carousel_deinit(void)
     }
 
     ui_info_carousel_stop_auto_rotate();
+    system_info_unsubscribe(info_changed_cb, NULL);
 
     if (s_auto_rotate_timer) {
         lv_timer_delete(s_auto_rotate_timer);
@@ -551,7 +762,7 @@ bool ui_info_carousel_is_visible(void)
 
 void ui_info_carousel_update(void)
 {
-    if (!s_initialized) {
+    if (!s_initialized || atomic_load(&s_pending) == 0) {
         return;
     }
 
@@ -559,126 +770,7 @@ void ui_info_carousel_update(void)
     if (system_info_get(&info) != ESP_OK) {
         return;
     }
-
-    char buf[64];
-
-    // Update WiFi tile
-    if (s_wifi_ssid_label) {
-        if (info.wifi_connected) {
-            lv_label_set_text(s_wifi_ssid_label, info.wifi_ssid[0] ? info.wifi_ssid : "Connected");
-            lv_obj_set_style_text_color(s_wifi_icon, UI_COLOR_SECONDARY, 0);
-
-            snprintf(buf, sizeof(buf), "Signal: %s (%d dBm)",
-                     system_info_rssi_to_string(info.wifi_rssi), info.wifi_rssi);
-            lv_label_set_text(s_wifi_rssi_label, buf);
-        } else {
-            lv_label_set_text(s_wifi_ssid_label, "Not Connected");
-            lv_label_set_text(s_wifi_rssi_label, "Signal: --");
-            lv_obj_set_style_text_color(s_wifi_icon, UI_COLOR_ERROR, 0);
-        }
-    }
-
-    // Update Battery tile
-    if (s_batt_percent_label) {
-        snprintf(buf, sizeof(buf), "%d%%", info.battery_percent);
-        lv_label_set_text(s_batt_percent_label, buf);
-
-        const char *status = system_info_battery_status(info.battery_percent, info.battery_charging);
-        lv_label_set_text(s_batt_status_label, status);
-
-        // Update icon color based on level
-        if (info.battery_charging) {
-            lv_obj_set_style_text_color(s_batt_icon, UI_COLOR_SECONDARY, 0);
-            lv_label_set_text(s_batt_icon, LV_SYMBOL_CHARGE);
-        } else if (info.battery_percent < 20) {
-            lv_obj_set_style_text_color(s_batt_icon, UI_COLOR_ERROR, 0);
-            lv_label_set_text(s_batt_icon, LV_SYMBOL_BATTERY_EMPTY);
-        } else if (info.battery_percent < 50) {
-            lv_obj_set_style_text_color(s_batt_icon, UI_COLOR_THINKING, 0);
-            lv_label_set_text(s_batt_icon, LV_SYMBOL_BATTERY_2);
-        } else if (info.battery_percent < 80) {
-            lv_obj_set_style_text_color(s_batt_icon, UI_COLOR_SECONDARY, 0);
-            lv_label_set_text(s_batt_icon, LV_SYMBOL_BATTERY_3);
-        } else {
-            lv_obj_set_style_text_color(s_batt_icon, UI_COLOR_SECONDARY, 0);
-            lv_label_set_text(s_batt_icon, LV_SYMBOL_BATTERY_FULL);
-        }
-    }
-
-    // Update Memory tile
-    if (s_mem_usage_label) {
-        snprintf(buf, sizeof(buf), "%d%%", info.heap_usage_percent);
-        lv_label_set_text(s_mem_usage_label, buf);
-
-        snprintf(buf, sizeof(buf), "Free: %lu KB", (unsigned long)(info.free_heap / 1024));
-        lv_label_set_text(s_mem_detail_label, buf);
-
-        // Update color based on usage
-        if (info.heap_usage_percent > 90) {
-            lv_obj_set_style_text_color(s_mem_icon, UI_COLOR_ERROR, 0);
-        } else if (info.heap_usage_percent > 70) {
-            lv_obj_set_style_text_color(s_mem_icon, UI_COLOR_THINKING, 0);
-        } else {
-            lv_obj_set_style_text_color(s_mem_icon, UI_COLOR_ACCENT, 0);
-        }
-    }
-
-    // Update Temperature tile
-    if (s_temp_value_label) {
-        snprintf(buf, sizeof(buf), "%.1f°C", info.temperature_c);
-        lv_label_set_text(s_temp_value_label, buf);
-
-        // Update color based on temperature
-        if (info.temperature_c > 60) {
-            lv_obj_set_style_text_color(s_temp_icon, UI_COLOR_ERROR, 0);
-            lv_label_set_text(s_temp_status_label, "High Temperature!");
-        } else if (info.temperature_c > 45) {
-            lv_obj_set_style_text_color(s_temp_icon, UI_COLOR_THINKING, 0);
-            lv_label_set_text(s_temp_status_label, "Warm");
-        } else {
-            lv_obj_set_style_text_color(s_temp_icon, UI_COLOR_SECONDARY, 0);
-            lv_label_set_text(s_temp_status_label, "Normal");
-        }
-    }
-
-    // Update GPS tile
-    if (s_gps_status_label) {
-        if (!info.gps_available) {
-            lv_label_set_text(s_gps_status_label, "Not Available");
-            lv_label_set_text(s_gps_coord_label, "");
-            lv_obj_set_style_text_color(s_gps_icon, UI_COLOR_TEXT_DIM, 0);
-        } else if (info.gps_fix) {
-            lv_label_set_text(s_gps_status_label, "GPS Fixed");
-            snprintf(buf, sizeof(buf), "%.6f, %.6f", info.gps_latitude, info.gps_longitude);
-            lv_label_set_text(s_gps_coord_label, buf);
-            lv_obj_set_style_text_color(s_gps_icon, UI_COLOR_SECONDARY, 0);
-        } else {
-            lv_label_set_text(s_gps_status_label, "Searching...");
-            snprintf(buf, sizeof(buf), "Satellites: %d", info.gps_satellites);
-            lv_label_set_text(s_gps_coord_label, buf);
-            lv_obj_set_style_text_color(s_gps_icon, UI_COLOR_THINKING, 0);
-        }
-    }
-
-    // Update DateTime tile
-    if (s_time_label) {
-        snprintf(buf, sizeof(buf), "%02d:%02d:%02d",
-                 info.rtc_hour, info.rtc_minute, info.rtc_second);
-        lv_label_set_text(s_time_label, buf);
-
-        snprintf(buf, sizeof(buf), "%04d/%02d/%02d",
-                 info.rtc_year, info.rtc_month, info.rtc_day);
-        lv_label_set_text(s_date_label, buf);
-
-        // Weekday names
-        static const char *weekdays[] = {
-            "Sunday", "Monday", "Tuesday", "Wednesday",
-            "Thursday", "Friday", "Saturday"
-        };
-        if (info.rtc_weekday < 7) {
-            lv_label_set_text(s_weekday_label, weekdays[info.rtc_weekday]);
-        }
-    }
+    apply_pending(&info);
 }
 
 void ui_info_carousel_start_auto_rotate(void)
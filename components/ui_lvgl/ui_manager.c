@@ -12,8 +12,10 @@
 
 // Manual display initialization (bypasses BSP display for proper SPI synchronization)
 #include "display_init.h"
+#include "audio_telemetry.h"
 
 #include <string.h>
+#include <stdatomic.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
@@ -33,7 +35,7 @@ extern lv_indev_t *app_get_input_dev(void);
 // ============================================
 
 static bool s_initialized = false;
-static ui_page_t s_current_page = UI_PAGE_BOOT;
+static _Atomic ui_page_t s_current_page = UI_PAGE_BOOT;    // Written under the lock, read without it
 static SemaphoreHandle_t s_ui_mutex = NULL;
 
 // Task
@@ -45,7 +47,7 @@ static volatile bool s_task_running = false;
 #define UI_TASK_DELAY_MS     10
 
 // LVGL timers
-static lv_timer_t *s_carousel_timer = NULL;
+static lv_timer_t *s_telemetry_timer = NULL;
 
 // Callback
 static ui_event_callback_t s_event_callback = NULL;
@@ -297,14 +299,39 @@ static void screen_event_cb(lv_event_t *e)
     }
 }
 
-static void carousel_timer_cb(lv_timer_t *timer)
+/**
+ * @brief Sample audio telemetry once per frame on the LVGL task
+ *
+ * Runs only while a page shows audio levels. The audio tasks publish
+ * without taking the display lock; levels are the peaks since the last
+ * frame.
+ */
+static void telemetry_timer_cb(lv_timer_t *timer)
 {
     (void)timer;
-    if (s_current_page == UI_PAGE_IDLE && ui_info_carousel_is_visible()) {
-        if (ui_manager_lock(50)) {
-            ui_info_carousel_update();
-            ui_manager_unlock();
-        }
+    audio_telemetry_t t;
+    if (!audio_telemetry_read(&t)) {
+        return;
+    }
+    if (s_current_page == UI_PAGE_LISTENING) {
+        ui_listening_update_level(t.mic_level);
+    } else if (s_current_page == UI_PAGE_SPEAKING) {
+        ui_speaking_update_level(t.play_level);
+    }
+}
+
+static void telemetry_timer_update(ui_page_t page)
+{
+    if (s_telemetry_timer == NULL) {
+        return;
+    }
+    if (page == UI_PAGE_LISTENING || page == UI_PAGE_SPEAKING) {
+        // Drop the peaks of the previous page
+        audio_telemetry_t t;
+        audio_telemetry_read(&t);
+        lv_timer_resume(s_telemetry_timer);
+    } else {
+        lv_timer_pause(s_telemetry_timer);
     }
 }
 
@@ -377,10 +404,11 @@ esp_err_t ui_manager_init(void)
     s_initialized = true;
     s_current_page = UI_PAGE_BOOT;
 
-    // Carousel update every 2 seconds (reduced frequency to minimize flickering)
-    s_carousel_timer = lv_timer_create(carousel_timer_cb, 2000, NULL);
-    if (!s_carousel_timer) {
-        ESP_LOGW(TAG, "Failed to create carousel timer");
+    s_telemetry_timer = lv_timer_create(telemetry_timer_cb, LV_DEF_REFR_PERIOD, NULL);
+    if (s_telemetry_timer) {
+        lv_timer_pause(s_telemetry_timer);
+    } else {
+        ESP_LOGW(TAG, "Failed to create telemetry timer");
     }
 
     ui_manager_unlock();
@@ -397,6 +425,11 @@ esp_err_t ui_manager_deinit(void)
 
     ui_manager_stop_task();
 
+    if (s_telemetry_timer) {
+        lv_timer_delete(s_telemetry_timer);
+        s_telemetry_timer = NULL;
+    }
+
     // Destroy carousel
     ui_info_carousel_deinit();
 
@@ -522,7 +555,8 @@ esp_err_t ui_manager_set_page(ui_page_t page)
             break;
     }
 
-    s_current_page = page;
+    atomic_store(&s_current_page, page);
+    telemetry_timer_update(page);
     ui_manager_unlock();
 
     return ESP_OK;
@@ -530,7 +564,7 @@ esp_err_t ui_manager_set_page(ui_page_t page)
 
 ui_page_t ui_manager_get_page(void)
 {
-    return s_current_page;
+    return atomic_load(&s_current_page);
 }
 
 void ui_manager_show_boot_screen(void)
@@ -563,12 +597,18 @@ void ui_manager_update_transcript(const char *text, bool is_user)
         return;
     }
 
+    // Response deltas go to the transcript ring without the display lock
+    if (!is_user) {
+        if (atomic_load(&s_current_page) == UI_PAGE_SPEAKING) {
+            ui_speaking_append_text(text);
+        }
+        return;
+    }
+
     if (!ui_manager_lock(50)) return;
 
-    if (is_user && s_current_page == UI_PAGE_LISTENING) {
+    if (s_current_page == UI_PAGE_LISTENING) {
         ui_listening_update_text(text);
-    } else if (!is_user && s_current_page == UI_PAGE_SPEAKING) {
-        ui_speaking_append_text(text);
     }
 
     ui_manager_unlock();
@@ -588,24 +628,6 @@ void ui_manager_clear_transcript(void)
     ui_manager_unlock();
 }
 
-void ui_manager_update_audio_level(uint8_t level)
-{
-    // Skip if UI not initialized or display not available
-    if (!s_initialized || app_get_display() == NULL) {
-        return;
-    }
-
-    if (!ui_manager_lock(10)) return;
-
-    if (s_current_page == UI_PAGE_LISTENING) {
-        ui_listening_update_level(level);
-    } else if (s_current_page == UI_PAGE_SPEAKING) {
-        ui_speaking_update_level(level);
-    }
-
-    ui_manager_unlock();
-}
-
 void ui_manager_update_wifi_status(bool connected, int rssi)
 {
     s_wifi_connected = connected;
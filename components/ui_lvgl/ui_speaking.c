@@ -1,12 +1,20 @@
 /**
  * @file ui_speaking.c
  * @brief Speaking page implementation (AI response display)
+ *
+ * The response is kept in a ui_transcript line ring and shown one label per
+ * row. Deltas only append to the ring; a paused LVGL timer is resumed on
+ * the first delta and, once per refresh period, sets the text of the rows
+ * whose line changed (usually just the last one).
  */
 
 #include "ui_speaking.h"
 #include "ui_manager.h"
+#include "ui_transcript.h"
 #include "esp_log.h"
-#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <stdatomic.h>
 
 static const char *TAG = "UI_SPEAKING";
 
@@ -15,6 +23,10 @@ static const char *TAG = "UI_SPEAKING";
 // ============================================
 
 #define MAX_TRANSCRIPT_LEN  2048
+#define MAX_TRANSCRIPT_ROWS 16      // Labels in the transcript box
+#define MAX_LINE_LEN        256     // Bytes of one wrapped line
+#define TRANSCRIPT_LINES    48      // Lines kept in the ring
+#define ROW_NONE            UINT32_MAX
 
 // ============================================
 // Private Variables
@@ -23,10 +35,20 @@ static const char *TAG = "UI_SPEAKING";
 static lv_obj_t *s_page = NULL;
 static lv_obj_t *s_title_label = NULL;
 static lv_obj_t *s_transcript_container = NULL;
-static lv_obj_t *s_transcript_label = NULL;
 static lv_obj_t *s_wave_bars[5] = {NULL};
-static char s_transcript_buffer[MAX_TRANSCRIPT_LEN] = {0};
-static size_t s_transcript_len = 0;
+
+// Row r shows the line whose id modulo s_rows is r, so rows keep their text as lines scroll
+static lv_obj_t *s_row_labels[MAX_TRANSCRIPT_ROWS] = {NULL};
+static uint32_t s_row_line[MAX_TRANSCRIPT_ROWS];
+static uint32_t s_rows = 0;
+static int32_t s_row_height = 0;
+static uint32_t s_top_line = ROW_NONE;
+
+// Transcript ring, appended to from the app task and read by the apply timer
+static ui_transcript_handle_t s_transcript = NULL;
+static SemaphoreHandle_t s_transcript_mutex = NULL;
+static lv_timer_t *s_apply_timer = NULL;
+static atomic_bool s_apply_scheduled = false;
 
 // ============================================
 // Private Functions
@@ -65,6 +87,68 @@ static void update_wave_bars(uint8_t level)
     }
 }
 
+static uint16_t transcript_glyph_width(uint32_t letter, void *ctx)
+{
+    return lv_font_get_glyph_width((const lv_font_t *)ctx, letter, 0);
+}
+
+/**
+ * @brief Show the last rows of the transcript, setting only changed lines
+ */
+static void transcript_apply_cb(lv_timer_t *timer)
+{
+    // A delta appended from here on resumes the timer for the next period
+    lv_timer_pause(timer);
+    atomic_store(&s_apply_scheduled, false);
+
+    static char line[MAX_LINE_LEN];
+    xSemaphoreTake(s_transcript_mutex, portMAX_DELAY);
+    uint32_t from = ROW_NONE;
+    uint32_t first, end;
+    ui_transcript_take_dirty(s_transcript, &from);
+    ui_transcript_get_lines(s_transcript, &first, &end);
+    uint32_t top = end - first > s_rows ? end - s_rows : first;
+
+    for (uint32_t r = 0; r < s_rows; r++) {
+        uint32_t id = top + (r + s_rows - top % s_rows) % s_rows;
+        if (id >= end) {
+            if (s_row_line[r] != ROW_NONE) {
+                lv_label_set_text(s_row_labels[r], "");
+                s_row_line[r] = ROW_NONE;
+            }
+            continue;
+        }
+        if (s_row_line[r] != id || id >= from) {
+            ui_transcript_copy_line(s_transcript, id, line, sizeof(line));
+            lv_label_set_text(s_row_labels[r], line);
+            s_row_line[r] = id;
+        }
+        if (top != s_top_line) {
+            lv_obj_set_y(s_row_labels[r], (int32_t)(id - top) * s_row_height);
+        }
+    }
+    s_top_line = top;
+    xSemaphoreGive(s_transcript_mutex);
+}
+
+/**
+ * @brief Have the apply timer run in the next LVGL pass, unless it already will
+ */
+static void schedule_apply(void)
+{
+    if (atomic_exchange(&s_apply_scheduled, true)) {
+        return;
+    }
+    if (ui_manager_lock(100)) {
+        if (s_apply_timer) {
+            lv_timer_resume(s_apply_timer);
+        }
+        ui_manager_unlock();
+    } else {
+        atomic_store(&s_apply_scheduled, false);
+    }
+}
+
 // ============================================
 // Public Functions
 // ============================================
@@ -115,16 +199,49 @@ lv_obj_t *ui_speaking_create(lv_obj_t *parent)
     lv_obj_set_style_radius(s_transcript_container, 15, 0);
     lv_obj_set_style_pad_all(s_transcript_container, 15, 0);
     lv_obj_align(s_transcript_container, LV_ALIGN_CENTER, 0, 30);
-    lv_obj_set_scroll_dir(s_transcript_container, LV_DIR_VER);
-
-    // Transcript label inside container
-    s_transcript_label = lv_label_create(s_transcript_container);
-    lv_label_set_text(s_transcript_label, "");
-    lv_label_set_long_mode(s_transcript_label, LV_LABEL_LONG_WRAP);
-    lv_obj_set_width(s_transcript_label, lv_obj_get_content_width(s_transcript_container));
-    lv_obj_set_style_text_color(s_transcript_label, UI_COLOR_TEXT, 0);
-    lv_obj_set_style_text_font(s_transcript_label, &lv_font_montserrat_16, 0);
-    lv_obj_align(s_transcript_label, LV_ALIGN_TOP_LEFT, 0, 0);
+    lv_obj_clear_flag(s_transcript_container, LV_OBJ_FLAG_SCROLLABLE);
+
+    // One label per row inside the container, the newest line at the bottom
+    const lv_font_t *font = &lv_font_montserrat_16;
+    lv_obj_update_layout(s_transcript_container);
+    int32_t content_width = lv_obj_get_content_width(s_transcript_container);
+    s_row_height = lv_font_get_line_height(font);
+    s_rows = (uint32_t)(lv_obj_get_content_height(s_transcript_container) / s_row_height);
+    if (s_rows > MAX_TRANSCRIPT_ROWS) {
+        s_rows = MAX_TRANSCRIPT_ROWS;
+    }
+    for (uint32_t r = 0; r < s_rows; r++) {
+        s_row_labels[r] = lv_label_create(s_transcript_container);
+        lv_label_set_text(s_row_labels[r], "");
+        lv_label_set_long_mode(s_row_labels[r], LV_LABEL_LONG_CLIP);
+        lv_obj_set_width(s_row_labels[r], content_width);
+        lv_obj_set_style_text_color(s_row_labels[r], UI_COLOR_TEXT, 0);
+        lv_obj_set_style_text_font(s_row_labels[r], font, 0);
+        lv_obj_set_pos(s_row_labels[r], 0, (int32_t)r * s_row_height);
+        s_row_line[r] = ROW_NONE;
+    }
+    s_top_line = ROW_NONE;
+
+    // The ring outlives the page: the app task may append at any time
+    if (s_transcript == NULL) {
+        s_transcript_mutex = xSemaphoreCreateMutex();
+        ui_transcript_cfg_t cfg = {
+            .max_width = (uint16_t)content_width,
+            .max_lines = TRANSCRIPT_LINES,
+            .text_size = MAX_TRANSCRIPT_LEN,
+            .glyph_width = transcript_glyph_width,
+            .ctx = (void *)font,
+        };
+        s_transcript = s_transcript_mutex ? ui_transcript_create(&cfg) : NULL;
+        if (s_transcript == NULL) {
+            ESP_LOGE(TAG, "Failed to create transcript");
+        }
+    }
+    if (s_transcript) {
+        // Runs once to show what was appended before the page existed, then pauses
+        atomic_store(&s_apply_scheduled, true);
+        s_apply_timer = lv_timer_create(transcript_apply_cb, LV_DEF_REFR_PERIOD, NULL);
+    }
 
     // Hint at bottom
     lv_obj_t *hint = lv_label_create(s_page);
@@ -142,13 +259,23 @@ void ui_speaking_destroy(void)
         s_page = NULL;
         s_title_label = NULL;
         s_transcript_container = NULL;
-        s_transcript_label = NULL;
         for (int i = 0; i < 5; i++) {
             s_wave_bars[i] = NULL;
         }
+        for (uint32_t r = 0; r < MAX_TRANSCRIPT_ROWS; r++) {
+            s_row_labels[r] = NULL;
+        }
+        s_rows = 0;
+    }
+    if (s_apply_timer) {
+        lv_timer_delete(s_apply_timer);
+        s_apply_timer = NULL;
+    }
+    if (s_transcript) {
+        xSemaphoreTake(s_transcript_mutex, portMAX_DELAY);
+        ui_transcript_clear(s_transcript);
+        xSemaphoreGive(s_transcript_mutex);
     }
-    s_transcript_len = 0;
-    s_transcript_buffer[0] = '\0';
 }
 
 void ui_speaking_enter(void)
@@ -183,35 +310,33 @@ void ui_speaking_exit(void)
 
 void ui_speaking_update_text(const char *text)
 {
-    if (s_transcript_label && text) {
+    if (s_transcript && text) {
         // Replace entire text
-        strncpy(s_transcript_buffer, text, MAX_TRANSCRIPT_LEN - 1);
-        s_transcript_buffer[MAX_TRANSCRIPT_LEN - 1] = '\0';
-        s_transcript_len = strlen(s_transcript_buffer);
-        lv_label_set_text(s_transcript_label, s_transcript_buffer);
-        ui_speaking_scroll_to_bottom();
+        xSemaphoreTake(s_transcript_mutex, portMAX_DELAY);
+        ui_transcript_clear(s_transcript);
+        ui_transcript_append(s_transcript, text);
+        xSemaphoreGive(s_transcript_mutex);
+        schedule_apply();
     }
 }
 
 void ui_speaking_append_text(const char *text)
 {
-    if (s_transcript_label && text) {
-        size_t append_len = strlen(text);
-        if (s_transcript_len + append_len < MAX_TRANSCRIPT_LEN - 1) {
-            strcat(s_transcript_buffer, text);
-            s_transcript_len += append_len;
-            lv_label_set_text(s_transcript_label, s_transcript_buffer);
-            ui_speaking_scroll_to_bottom();
-        }
+    if (s_transcript && text) {
+        xSemaphoreTake(s_transcript_mutex, portMAX_DELAY);
+        ui_transcript_append(s_transcript, text);
+        xSemaphoreGive(s_transcript_mutex);
+        schedule_apply();
     }
 }
 
 void ui_speaking_clear_text(void)
 {
-    s_transcript_buffer[0] = '\0';
-    s_transcript_len = 0;
-    if (s_transcript_label) {
-        lv_label_set_text(s_transcript_label, "");
+    if (s_transcript) {
+        xSemaphoreTake(s_transcript_mutex, portMAX_DELAY);
+        ui_transcript_clear(s_transcript);
+        xSemaphoreGive(s_transcript_mutex);
+        schedule_apply();
     }
 }
 
@@ -222,7 +347,8 @@ void ui_speaking_update_level(uint8_t level)
 
 void ui_speaking_scroll_to_bottom(void)
 {
-    if (s_transcript_container) {
-        lv_obj_scroll_to_y(s_transcript_container, LV_COORD_MAX, LV_ANIM_ON);
+    // The rows always follow the newest line; just make sure they are current
+    if (s_transcript) {
+        schedule_apply();
     }
 }
@@ -0,0 +1,254 @@
+/**
+ * @file ui_transcript.c
+ * @brief Wrapped transcript text kept as a ring of lines
+ */
+
+#include "ui_transcript.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Ideographs, kana and hangul wrap at any character
+#define CJK_FIRST   0x2E80
+
+// ============================================
+// Private Types
+// ============================================
+
+typedef struct {
+    uint32_t start;     // Offset of the first byte in the text stream
+    uint16_t len;       // Bytes
+    uint16_t width;     // Pixels
+} line_t;
+
+struct ui_transcript {
+    ui_transcript_cfg_t cfg;
+    char    *text;          // Ring of cfg.text_size bytes, indexed by stream offset
+    line_t  *lines;         // Ring of cfg.max_lines lines, indexed by line id
+    uint32_t head;          // Stream offset of the next byte
+    uint32_t tail;          // Stream offset of the oldest byte kept
+    uint32_t first;         // Oldest line kept
+    uint32_t end;           // After the newest line, which is the one appended to
+    uint32_t brk;           // Where the last line may wrap (stream offset)
+    uint16_t brk_width;     // Width of the last line after brk
+    bool     has_brk;
+    uint8_t  seq[4];        // UTF-8 sequence split across deltas
+    uint8_t  seq_len;
+    uint8_t  seq_need;
+    bool     dirty;
+    uint32_t dirty_from;
+};
+
+// ============================================
+// Private Functions
+// ============================================
+
+static line_t *line_at(ui_transcript_handle_t t, uint32_t id)
+{
+    return &t->lines[id % t->cfg.max_lines];
+}
+
+static void mark_dirty(ui_transcript_handle_t t, uint32_t id)
+{
+    if (!t->dirty || id < t->dirty_from) {
+        t->dirty_from = id;
+    }
+    t->dirty = true;
+}
+
+static void evict_line(ui_transcript_handle_t t)
+{
+    t->first++;
+    t->tail = line_at(t, t->first)->start;
+}
+
+static void new_line(ui_transcript_handle_t t, uint32_t start, uint16_t width)
+{
+    if (t->end - t->first == t->cfg.max_lines) {
+        evict_line(t);
+    }
+    // Bytes already written from start on move to the new line
+    *line_at(t, t->end) = (line_t) {.start = start, .len = (uint16_t)(t->head - start), .width = width};
+    t->end++;
+    t->has_brk = false;
+}
+
+static void make_room(ui_transcript_handle_t t, uint32_t bytes)
+{
+    while (t->head + bytes - t->tail > t->cfg.text_size) {
+        if (t->end - t->first == 1) {
+            // One line as long as the ring: break it where it is
+            new_line(t, t->head, 0);
+            mark_dirty(t, t->end - 1);
+        }
+        evict_line(t);
+    }
+}
+
+/**
+ * @brief Lay out one character on the last line
+ */
+static void put_char(ui_transcript_handle_t t, uint32_t letter, const uint8_t *bytes, uint8_t len)
+{
+    if (letter == '\n') {
+        new_line(t, t->head, 0);
+        mark_dirty(t, t->end - 1);
+        return;
+    }
+    uint16_t w = t->cfg.glyph_width(letter, t->cfg.ctx);
+    bool cjk = letter >= CJK_FIRST;
+    line_t *line = line_at(t, t->end - 1);
+    if (cjk && line->len) {
+        t->brk = t->head;
+        t->brk_width = 0;
+        t->has_brk = true;
+    }
+    // A space may hang past the edge; anything else wraps
+    if (letter != ' ' && line->len && line->width + w > t->cfg.max_width) {
+        if (t->has_brk && t->brk > line->start) {
+            // Move the word after the last break to a new line
+            line->len = (uint16_t)(t->brk - line->start);
+            line->width -= t->brk_width;
+            mark_dirty(t, t->end - 1);
+            new_line(t, t->brk, t->brk_width);
+        } else {
+            new_line(t, t->head, 0);
+        }
+    }
+    make_room(t, len);
+    line = line_at(t, t->end - 1);
+    for (uint8_t i = 0; i < len; i++) {
+        t->text[(t->head + i) % t->cfg.text_size] = (char)bytes[i];
+    }
+    t->head += len;
+    line->len += len;
+    line->width += w;
+    t->brk_width += w;
+    if (letter == ' ' || cjk) {
+        t->brk = t->head;
+        t->brk_width = 0;
+        t->has_brk = true;
+    }
+    mark_dirty(t, t->end - 1);
+}
+
+// ============================================
+// Public Functions
+// ============================================
+
+ui_transcript_handle_t ui_transcript_create(const ui_transcript_cfg_t *cfg)
+{
+    if (cfg == NULL || cfg->glyph_width == NULL || cfg->max_width == 0 || cfg->max_lines < 2 ||
+        cfg->text_size < 16) {
+        return NULL;
+    }
+    ui_transcript_handle_t t = calloc(1, sizeof(struct ui_transcript));
+    if (t == NULL) {
+        return NULL;
+    }
+    t->cfg = *cfg;
+    t->text = malloc(cfg->text_size);
+    t->lines = calloc(cfg->max_lines, sizeof(line_t));
+    if (t->text == NULL || t->lines == NULL) {
+        ui_transcript_destroy(t);
+        return NULL;
+    }
+    new_line(t, 0, 0);
+    return t;
+}
+
+void ui_transcript_destroy(ui_transcript_handle_t t)
+{
+    if (t) {
+        free(t->text);
+        free(t->lines);
+        free(t);
+    }
+}
+
+void ui_transcript_clear(ui_transcript_handle_t t)
+{
+    if (t == NULL) {
+        return;
+    }
+    // Ids keep increasing so a view sees every line it shows as gone
+    t->first = t->end;
+    t->tail = t->head;
+    t->seq_len = 0;
+    t->seq_need = 0;
+    new_line(t, t->head, 0);
+    mark_dirty(t, t->first);
+}
+
+esp_err_t ui_transcript_append(ui_transcript_handle_t t, const char *text)
+{
+    if (t == NULL || text == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (const uint8_t *p = (const uint8_t *)text; *p; p++) {
+        uint8_t c = *p;
+        if (t->seq_need) {
+            if ((c & 0xC0) == 0x80) {
+                t->seq[t->seq_len++] = c;
+                if (t->seq_len == t->seq_need) {
+                    uint32_t letter = t->seq[0] & (0x7F >> t->seq_need);
+                    for (uint8_t i = 1; i < t->seq_len; i++) {
+                        letter = (letter << 6) | (t->seq[i] & 0x3F);
+                    }
+                    put_char(t, letter, t->seq, t->seq_len);
+                    t->seq_need = 0;
+                }
+                continue;
+            }
+            // Truncated sequence: drop it and take this byte afresh
+            t->seq_need = 0;
+        }
+        if (c < 0x80) {
+            put_char(t, c, &c, 1);
+        } else if (c >= 0xC0 && c < 0xF8) {
+            t->seq[0] = c;
+            t->seq_len = 1;
+            t->seq_need = c < 0xE0 ? 2 : (c < 0xF0 ? 3 : 4);
+        }
+    }
+    return ESP_OK;
+}
+
+void ui_transcript_get_lines(ui_transcript_handle_t t, uint32_t *first, uint32_t *end)
+{
+    *first = t->first;
+    *end = t->end;
+}
+
+size_t ui_transcript_copy_line(ui_transcript_handle_t t, uint32_t id, char *buf, size_t size)
+{
+    if (size == 0) {
+        return 0;
+    }
+    buf[0] = '\0';
+    if (id < t->first || id >= t->end) {
+        return 0;
+    }
+    const line_t *line = line_at(t, id);
+    size_t len = line->len < size - 1 ? line->len : size - 1;
+    uint32_t off = line->start % t->cfg.text_size;
+    size_t part = t->cfg.text_size - off;
+    if (part >= len) {
+        memcpy(buf, t->text + off, len);
+    } else {
+        memcpy(buf, t->text + off, part);
+        memcpy(buf + part, t->text, len - part);
+    }
+    buf[len] = '\0';
+    return len;
+}
+
+bool ui_transcript_take_dirty(ui_transcript_handle_t t, uint32_t *from)
+{
+    if (!t->dirty) {
+        return false;
+    }
+    *from = t->dirty_from > t->first ? t->dirty_from : t->first;
+    t->dirty = false;
+    return true;
+}
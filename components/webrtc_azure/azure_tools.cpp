@@ -0,0 +1,107 @@
+/* Function-calling tools offered over the WebRTC data channel
+ *
+ * Demo controls for the light, speaker volume and door. Each control is
+ * bound to its parameter in the tool declarations below; tool_registry.hpp
+ * generates the schema and the argument decoders from them.
+ */
+
+#include "azure_tools.h"
+
+#include "esp_log.h"
+#include "tool_registry.hpp"
+
+#define TAG "AZURE_TOOLS"
+
+namespace tr = tool_registry;
+
+// ============================================
+// Demo Controls
+// ============================================
+
+static void set_light_on_off(bool on)
+{
+    ESP_LOGI(TAG, "Light set to %s", on ? "ON" : "OFF");
+}
+
+static void set_light_color_red(int value)
+{
+    ESP_LOGI(TAG, "Red set to %d", value);
+}
+
+static void set_light_color_green(int value)
+{
+    ESP_LOGI(TAG, "Green set to %d", value);
+}
+
+static void set_light_color_blue(int value)
+{
+    ESP_LOGI(TAG, "Blue set to %d", value);
+}
+
+static void set_speaker_volume(int value)
+{
+    ESP_LOGI(TAG, "Volume set to %d", value);
+}
+
+static void set_door_state(bool open)
+{
+    ESP_LOGI(TAG, "Door is %s", open ? "Opened" : "Closed");
+}
+
+// ============================================
+// Tool Declarations
+// ============================================
+
+using SetLightState = tr::tool<"SetLightState", "Changes the state of the light",
+    tr::boolean<"LightState", "New light state (true or false is expected)", set_light_on_off>,
+    tr::object<"LightColor", "Set light color of red, green and blue", false,
+        tr::integer<"red", "Red value in the range of 0-255", set_light_color_red>,
+        tr::integer<"green", "Green value in the range of 0-255", set_light_color_green>,
+        tr::integer<"blue", "Blue value in the range of 0-255", set_light_color_blue>>>;
+
+using SetVolume = tr::tool<"SetVolume", "Changes speaker volume",
+    tr::integer<"volume", "Speaker volume range 0-100", set_speaker_volume>>;
+
+using OpenDoor = tr::tool<"OpenDoor", "Toggle the door state to open or close",
+    tr::boolean<"open", "Open or close the door", set_door_state>>;
+
+using Tools = tr::registry<SetLightState, SetVolume, OpenDoor>;
+
+// Without AEC the microphone hears the speaker: a high VAD threshold (0.9)
+// keeps echo from triggering turns while loud speech still does, and 1.5 s
+// of silence keeps brief pauses from ending the turn.
+static constexpr auto s_session_update =
+    "{\"type\":\"session.update\",\"session\":{"
+    "\"modalities\":[\"text\",\"audio\"],"
+    "\"input_audio_transcription\":null,"
+    "\"turn_detection\":{\"type\":\"server_vad\",\"threshold\":0.9,"
+    "\"prefix_padding_ms\":500,\"silence_duration_ms\":1500},"
+    "\"tools\":" + Tools::schema + "}}";
+
+// ============================================
+// Public API
+// ============================================
+
+extern "C" const char *azure_tools_session_update(size_t *len)
+{
+    if (len) {
+        *len = s_session_update.size();
+    }
+    return s_session_update.c_str();
+}
+
+extern "C" const char *azure_tools_schema(size_t *len)
+{
+    if (len) {
+        *len = Tools::schema.size();
+    }
+    return Tools::schema.c_str();
+}
+
+extern "C" esp_err_t azure_tools_call(const char *name, size_t name_len, const char *args, size_t args_len)
+{
+    if (name == NULL || args == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return Tools::call(name, name_len, rtc_span_t{ args, args_len }) ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
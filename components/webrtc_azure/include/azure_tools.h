@@ -0,0 +1,47 @@
+/* Function-calling tools offered over the WebRTC data channel
+ *
+ * The demo controls (light, volume, door) declared with tool_registry.hpp.
+ * The session.update that announces them is a compile-time constant in
+ * flash, and calls are decoded without allocating.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AZURE_TOOLS_ARGS_MAX    512     // Decoded arguments of one call
+
+/**
+ * @brief session.update event carrying the session settings and the tools
+ *
+ * @param len Output, message length (may be NULL)
+ * @return NUL-terminated JSON in flash
+ */
+const char *azure_tools_session_update(size_t *len);
+
+/**
+ * @brief JSON array of the tool schemas (the session.update "tools" member)
+ *
+ * @param len Output, array length (may be NULL)
+ */
+const char *azure_tools_schema(size_t *len);
+
+/**
+ * @brief Run a tool
+ *
+ * @param name Tool name (not necessarily NUL-terminated)
+ * @param name_len Name length
+ * @param args Arguments object, already decoded from its JSON string
+ * @param args_len Arguments length
+ * @return ESP_OK, ESP_ERR_NOT_FOUND when no tool has that name
+ */
+esp_err_t azure_tools_call(const char *name, size_t name_len, const char *args, size_t args_len);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,89 @@
+/* Ephemeral token manager
+ *
+ * Keeps one realtime session token (client_secret) ready for the WebRTC
+ * signaling layer so session setup starts with the SDP exchange instead of
+ * a token round-trip.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#else
+// Host builds: prefetch enabled with the default timings unless overridden
+#ifndef CONFIG_WEBRTC_AZURE_TOKEN_PREFETCH
+#define CONFIG_WEBRTC_AZURE_TOKEN_PREFETCH          1
+#endif
+#ifndef CONFIG_WEBRTC_AZURE_TOKEN_REFRESH_MARGIN_S
+#define CONFIG_WEBRTC_AZURE_TOKEN_REFRESH_MARGIN_S  15
+#endif
+#ifndef CONFIG_WEBRTC_AZURE_TOKEN_DEFAULT_TTL_S
+#define CONFIG_WEBRTC_AZURE_TOKEN_DEFAULT_TTL_S     60
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Token manager statistics since boot
+ */
+typedef struct {
+    uint32_t fetches;            /*!< Token requests completed */
+    uint32_t failures;           /*!< Token requests that failed */
+    uint32_t hits;               /*!< Takes served from the prefetched token */
+    uint32_t waits;              /*!< Takes that waited for a prefetch in flight */
+    uint32_t misses;             /*!< Takes that had to fetch synchronously */
+    uint32_t expired;            /*!< Prefetched tokens discarded unused */
+    uint32_t fetch_last_ms;
+    uint32_t fetch_avg_ms;
+    uint32_t take_last_ms;       /*!< Time the last take spent waiting for a token */
+} openai_token_stats_t;
+
+/**
+ * @brief Start the background manager
+ *
+ * Fetches a token right away and refreshes it CONFIG_WEBRTC_AZURE_TOKEN_REFRESH_MARGIN_S
+ * before it expires, retrying with backoff while the network is down.
+ *
+ * @return
+ *       - ESP_OK  On success (or when already started)
+ *       - Others  Failed to create the task
+ */
+esp_err_t openai_token_start(void);
+
+/**
+ * @brief Take a token for a new session
+ *
+ * Returns the prefetched token when it is still valid, waits for a prefetch
+ * in flight, or fetches one synchronously. A taken token is not handed out
+ * again; the manager prefetches the next one once the session is up (see
+ * openai_token_session_up()), or 10 s after the take if it never reports.
+ *
+ * @return Token (caller frees), NULL on failure
+ */
+char *openai_token_take(void);
+
+/**
+ * @brief Report that the session using the last taken token is connected
+ *
+ * Lets the manager prefetch the next token now that the SDP exchange and
+ * handshake no longer share the network with it.
+ */
+void openai_token_session_up(void);
+
+/**
+ * @brief Get token manager statistics
+ *
+ * @param[out]  stats  Statistics
+ */
+void openai_token_get_stats(openai_token_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,224 @@
+/* Data channel event router
+ *
+ * Single-pass scanner for the Realtime API server events that arrive on the
+ * WebRTC data channel. The event type is classified through a perfect hash
+ * over the known event names and the fields the handlers need (transcript,
+ * delta, function name and arguments, error) are returned as spans into the
+ * message, so no cJSON tree is built on the receive path.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RTC_NAME_TABLE_SLOTS    128     // Power of two, at least twice the name count
+
+/**
+ * @brief Server event types known to the router
+ */
+typedef enum {
+    RTC_EVENT_UNKNOWN = 0,               /*!< Valid message, type not in the table */
+    RTC_EVENT_ERROR,                     /*!< error */
+    RTC_EVENT_SESSION_CREATED,           /*!< session.created */
+    RTC_EVENT_SESSION_UPDATED,           /*!< session.updated */
+    RTC_EVENT_SPEECH_STARTED,            /*!< input_audio_buffer.speech_started */
+    RTC_EVENT_SPEECH_STOPPED,            /*!< input_audio_buffer.speech_stopped */
+    RTC_EVENT_BUFFER_COMMITTED,          /*!< input_audio_buffer.committed */
+    RTC_EVENT_BUFFER_CLEARED,            /*!< input_audio_buffer.cleared */
+    RTC_EVENT_ITEM_CREATED,              /*!< conversation.item.created */
+    RTC_EVENT_ITEM_TRUNCATED,            /*!< conversation.item.truncated */
+    RTC_EVENT_INPUT_TRANSCRIPT_DELTA,    /*!< conversation.item.input_audio_transcription.delta */
+    RTC_EVENT_INPUT_TRANSCRIPT_DONE,     /*!< conversation.item.input_audio_transcription.completed */
+    RTC_EVENT_INPUT_TRANSCRIPT_FAILED,   /*!< conversation.item.input_audio_transcription.failed */
+    RTC_EVENT_RESPONSE_CREATED,          /*!< response.created */
+    RTC_EVENT_RESPONSE_DONE,             /*!< response.done */
+    RTC_EVENT_OUTPUT_ITEM_ADDED,         /*!< response.output_item.added */
+    RTC_EVENT_OUTPUT_ITEM_DONE,          /*!< response.output_item.done */
+    RTC_EVENT_CONTENT_PART_ADDED,        /*!< response.content_part.added */
+    RTC_EVENT_CONTENT_PART_DONE,         /*!< response.content_part.done */
+    RTC_EVENT_TEXT_DELTA,                /*!< response.text.delta */
+    RTC_EVENT_TEXT_DONE,                 /*!< response.text.done */
+    RTC_EVENT_TRANSCRIPT_DELTA,          /*!< response.audio_transcript.delta */
+    RTC_EVENT_TRANSCRIPT_DONE,           /*!< response.audio_transcript.done */
+    RTC_EVENT_AUDIO_DONE,                /*!< response.audio.done */
+    RTC_EVENT_FUNCTION_ARGS_DELTA,       /*!< response.function_call_arguments.delta */
+    RTC_EVENT_FUNCTION_ARGS_DONE,        /*!< response.function_call_arguments.done */
+    RTC_EVENT_AUDIO_STARTED,             /*!< output_audio_buffer.started */
+    RTC_EVENT_AUDIO_STOPPED,             /*!< output_audio_buffer.stopped */
+    RTC_EVENT_AUDIO_CLEARED,             /*!< output_audio_buffer.cleared */
+    RTC_EVENT_RATE_LIMITS_UPDATED,       /*!< rate_limits.updated */
+    RTC_EVENT_MAX,
+} rtc_event_type_t;
+
+/**
+ * @brief Slice of a JSON message
+ *
+ * For strings the span is the body between the quotes with escapes left in
+ * place; ptr is NULL when the field is absent.
+ */
+typedef struct {
+    const char *ptr;
+    size_t len;
+} rtc_span_t;
+
+/**
+ * @brief JSON value kinds seen by the scanner
+ */
+typedef enum {
+    RTC_JSON_NONE = 0,
+    RTC_JSON_STRING,
+    RTC_JSON_NUMBER,
+    RTC_JSON_TRUE,
+    RTC_JSON_FALSE,
+    RTC_JSON_NULL,
+    RTC_JSON_OBJECT,
+    RTC_JSON_ARRAY,
+} rtc_json_kind_t;
+
+/**
+ * @brief One scanned value (objects and arrays span their brackets)
+ */
+typedef struct {
+    rtc_json_kind_t kind;
+    rtc_span_t span;
+} rtc_json_value_t;
+
+/**
+ * @brief Iterator over the members of one JSON object
+ */
+typedef struct {
+    const char *pos;
+    const char *end;
+    bool done;
+    bool error;                          /*!< Set when the object is malformed */
+} rtc_json_iter_t;
+
+/**
+ * @brief A routed server event
+ */
+typedef struct {
+    rtc_event_type_t type;
+    rtc_span_t type_name;                /*!< Raw "type" string */
+    rtc_span_t delta;                    /*!< "delta" (transcript, text and argument deltas) */
+    rtc_span_t transcript;               /*!< "transcript" */
+    rtc_span_t text;                     /*!< "text" */
+    rtc_span_t name;                     /*!< "name" (function calls) */
+    rtc_span_t arguments;                /*!< "arguments" (function calls) */
+    rtc_span_t call_id;                  /*!< "call_id" (function calls) */
+    rtc_span_t error;                    /*!< "error" object, brackets included */
+} rtc_event_t;
+
+/**
+ * @brief Perfect hash over a fixed set of names
+ *
+ * The builder searches for a seed under which every name lands in its own
+ * slot, so a lookup is one hash and one compare.
+ */
+typedef struct {
+    uint32_t seed;
+    uint8_t slot[RTC_NAME_TABLE_SLOTS];  /*!< Name index + 1, 0 for an empty slot */
+    const char *const *names;
+    uint8_t count;
+} rtc_name_table_t;
+
+// ============================================
+// Router Function Declarations
+// ============================================
+
+/**
+ * @brief Build the event name table
+ *
+ * Call once before the first rtc_event_parse() (webrtc_azure_init() does).
+ *
+ * @return ESP_OK, ESP_FAIL if no collision-free seed was found
+ */
+esp_err_t rtc_event_router_init(void);
+
+/**
+ * @brief Classify a server event and pick out its fields in one pass
+ *
+ * Only top-level members are looked at; nested objects are skipped without
+ * being scanned for fields. The message does not need to be NUL-terminated.
+ *
+ * @param data Message
+ * @param size Message length
+ * @param event Output, spans point into data
+ * @return ESP_OK (type may be RTC_EVENT_UNKNOWN), ESP_ERR_INVALID_ARG if the
+ *         message is not an object or has no string "type"
+ */
+esp_err_t rtc_event_parse(const char *data, size_t size, rtc_event_t *event);
+
+/**
+ * @brief Event name of a type ("unknown" for RTC_EVENT_UNKNOWN)
+ */
+const char *rtc_event_name(rtc_event_type_t type);
+
+/**
+ * @brief Decode a string span (escapes, \\uXXXX to UTF-8) into out
+ *
+ * The result is always NUL-terminated and cut at a character boundary when
+ * out is too small; span.len + 1 bytes are always enough.
+ *
+ * @return Decoded length
+ */
+size_t rtc_span_unescape(rtc_span_t span, char *out, size_t out_size);
+
+/**
+ * @brief Compare a raw span with a plain name
+ */
+bool rtc_span_equals(rtc_span_t span, const char *name);
+
+// ============================================
+// JSON Scanning
+// ============================================
+
+/**
+ * @brief Start iterating the members of an object span (brackets included)
+ */
+void rtc_json_iter_init(rtc_json_iter_t *it, const char *obj, size_t len);
+
+/**
+ * @brief Next member of the object
+ *
+ * @param key Raw key body (escapes left in place)
+ * @param value Member value
+ * @return false at the end of the object or on malformed input (it->error)
+ */
+bool rtc_json_iter_next(rtc_json_iter_t *it, rtc_span_t *key, rtc_json_value_t *value);
+
+/**
+ * @brief Integer value of a number span, truncated and clamped as cJSON's valueint
+ */
+int rtc_json_to_int(rtc_span_t span);
+
+// ============================================
+// Name Tables
+// ============================================
+
+/**
+ * @brief Build a perfect hash over names
+ *
+ * @param names Name array, kept by reference
+ * @param count Name count, at most RTC_NAME_TABLE_SLOTS / 2
+ * @return ESP_OK, ESP_ERR_INVALID_ARG on bad arguments or duplicate names,
+ *         ESP_FAIL if no seed was found
+ */
+esp_err_t rtc_name_table_build(rtc_name_table_t *table, const char *const *names, size_t count);
+
+/**
+ * @brief Index of a name in the table
+ *
+ * @return Index into the names passed to rtc_name_table_build(), -1 if absent
+ */
+int rtc_name_table_find(const rtc_name_table_t *table, const char *name, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
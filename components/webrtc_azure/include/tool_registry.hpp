@@ -0,0 +1,306 @@
+/* Compile-time tool registry
+ *
+ * Function-calling tools are declared once as types: the tool name, its
+ * description and typed parameters, each parameter with the control it
+ * drives. From that declaration the compiler emits the JSON tool schema as
+ * a constant string (placed in flash) and a decoder per tool that walks the
+ * call arguments with the data channel scanner, calling each control with
+ * its typed value. Nothing is allocated at run time.
+ *
+ *   using SetVolume = tool_registry::tool<"SetVolume", "Changes speaker volume",
+ *       tool_registry::integer<"volume", "Speaker volume range 0-100", set_volume>>;
+ *   using Tools = tool_registry::registry<SetVolume, ...>;
+ *
+ *   Tools::schema.c_str()      // [{"type":"function","name":"SetVolume",...}]
+ *   Tools::call(name, len, args_span);
+ *
+ * Needs C++20 (class-type template parameters). Names and descriptions are
+ * emitted verbatim, so they must not contain '"' or '\'.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include "esp_log.h"
+#include "rtc_event_router.h"
+
+namespace tool_registry {
+
+// ============================================
+// Compile-time Strings
+// ============================================
+
+/**
+ * @brief String literal usable as a template argument and in constant expressions
+ */
+template <size_t N>
+struct fixed_string {
+    char data[N] = {};
+
+    constexpr fixed_string() = default;
+    constexpr fixed_string(const char (&s)[N])
+    {
+        for (size_t i = 0; i < N; i++) {
+            data[i] = s[i];
+        }
+    }
+
+    static constexpr size_t size() { return N - 1; }
+    constexpr const char *c_str() const { return data; }
+};
+
+template <size_t A, size_t B>
+constexpr fixed_string<A + B - 1> operator+(const fixed_string<A> &a, const fixed_string<B> &b)
+{
+    fixed_string<A + B - 1> out;
+    for (size_t i = 0; i < A - 1; i++) {
+        out.data[i] = a.data[i];
+    }
+    for (size_t i = 0; i < B; i++) {
+        out.data[A - 1 + i] = b.data[i];
+    }
+    return out;
+}
+
+template <size_t A, size_t B>
+constexpr fixed_string<A + B - 1> operator+(const fixed_string<A> &a, const char (&b)[B])
+{
+    return a + fixed_string<B>(b);
+}
+
+template <size_t A, size_t B>
+constexpr fixed_string<A + B - 1> operator+(const char (&a)[A], const fixed_string<B> &b)
+{
+    return fixed_string<A>(a) + b;
+}
+
+/**
+ * @brief Drop the first character (used to strip a leading separator)
+ */
+template <size_t N>
+constexpr fixed_string<N - 1> drop_first(const fixed_string<N> &s)
+{
+    fixed_string<N - 1> out;
+    for (size_t i = 0; i < N - 1; i++) {
+        out.data[i] = s.data[i + 1];
+    }
+    return out;
+}
+
+template <size_t N>
+constexpr bool json_safe(const fixed_string<N> &s)
+{
+    for (size_t i = 0; i < N - 1; i++) {
+        if (s.data[i] == '"' || s.data[i] == '\\' || (unsigned char)s.data[i] < 0x20) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <fixed_string S>
+constexpr auto quoted()
+{
+    static_assert(json_safe(S), "tool names and descriptions must not need JSON escaping");
+    return "\"" + S + "\"";
+}
+
+// ============================================
+// Parameters
+// ============================================
+
+namespace detail {
+
+inline constexpr const char *TAG = "TOOLS";
+
+template <fixed_string Name, fixed_string Type, fixed_string Desc>
+constexpr auto leaf_property()
+{
+    return quoted<Name>() + ":{\"type\":\"" + Type + "\",\"description\":" + quoted<Desc>() + "}";
+}
+
+/**
+ * @brief "properties" and "required" members of an object schema
+ */
+template <typename... Params>
+constexpr auto object_members()
+{
+    if constexpr (sizeof...(Params) == 0) {
+        return fixed_string("\"properties\":{}");
+    } else {
+        constexpr auto properties = drop_first(("" + ... + ("," + Params::property)));
+        constexpr auto required = ("" + ... + Params::required_item);
+        if constexpr (required.size() == 0) {
+            return "\"properties\":{" + properties + "}";
+        } else {
+            return "\"properties\":{" + properties + "},\"required\":[" + drop_first(required) + "]";
+        }
+    }
+}
+
+template <typename P>
+bool apply_if_named(rtc_span_t key, const rtc_json_value_t &value)
+{
+    if (!rtc_span_equals(key, P::name.c_str())) {
+        return false;
+    }
+    if (!P::apply(value)) {
+        ESP_LOGW(TAG, "Unhandled attribute type or invalid value for: %s", P::name.c_str());
+    }
+    return true;
+}
+
+template <typename P>
+void check_required(bool seen)
+{
+    if (P::required && !seen) {
+        ESP_LOGW(TAG, "Missing required attribute: %s", P::name.c_str());
+    }
+}
+
+/**
+ * @brief Apply the members of an arguments object to Params in one pass
+ */
+template <typename... Params, size_t... I>
+void apply_members(rtc_span_t obj, std::index_sequence<I...>)
+{
+    static_assert(sizeof...(Params) <= 32, "at most 32 parameters per object");
+    uint32_t seen = 0;
+    rtc_json_iter_t it;
+    rtc_span_t key;
+    rtc_json_value_t value;
+
+    rtc_json_iter_init(&it, obj.ptr, obj.len);
+    while (rtc_json_iter_next(&it, &key, &value)) {
+        (void)((apply_if_named<Params>(key, value) && (seen |= 1u << I, true)) || ...);
+    }
+    if (it.error) {
+        ESP_LOGW(TAG, "Error parsing arguments JSON");
+    }
+    (check_required<Params>(seen & (1u << I)), ...);
+}
+
+} // namespace detail
+
+/**
+ * @brief Parameter with required/optional bookkeeping shared by all kinds
+ */
+template <fixed_string Name, bool Required>
+struct param_base {
+    static constexpr auto name = Name;
+    static constexpr bool required = Required;
+    static constexpr auto required_item = [] {
+        if constexpr (Required) {
+            return "," + quoted<Name>();
+        } else {
+            return fixed_string("");
+        }
+    }();
+};
+
+/**
+ * @brief Boolean parameter driving Control(bool)
+ */
+template <fixed_string Name, fixed_string Desc, void (*Control)(bool), bool Required = true>
+struct boolean : param_base<Name, Required> {
+    static constexpr auto property = detail::leaf_property<Name, "boolean", Desc>();
+
+    static bool apply(const rtc_json_value_t &value)
+    {
+        if (value.kind != RTC_JSON_TRUE && value.kind != RTC_JSON_FALSE) {
+            return false;
+        }
+        Control(value.kind == RTC_JSON_TRUE);
+        return true;
+    }
+};
+
+/**
+ * @brief Integer parameter driving Control(int)
+ */
+template <fixed_string Name, fixed_string Desc, void (*Control)(int), bool Required = true>
+struct integer : param_base<Name, Required> {
+    static constexpr auto property = detail::leaf_property<Name, "integer", Desc>();
+
+    static bool apply(const rtc_json_value_t &value)
+    {
+        if (value.kind != RTC_JSON_NUMBER) {
+            return false;
+        }
+        Control(rtc_json_to_int(value.span));
+        return true;
+    }
+};
+
+/**
+ * @brief Nested object parameter whose members are parameters themselves
+ */
+template <fixed_string Name, fixed_string Desc, bool Required, typename... Params>
+struct object : param_base<Name, Required> {
+    static constexpr auto property = quoted<Name>() + ":{\"type\":\"object\",\"description\":" +
+                                     quoted<Desc>() + "," + detail::object_members<Params...>() + "}";
+
+    static bool apply(const rtc_json_value_t &value)
+    {
+        if (value.kind != RTC_JSON_OBJECT) {
+            return false;
+        }
+        detail::apply_members<Params...>(value.span, std::index_sequence_for<Params...>{});
+        return true;
+    }
+};
+
+// ============================================
+// Tools and Registry
+// ============================================
+
+/**
+ * @brief One callable tool
+ */
+template <fixed_string Name, fixed_string Desc, typename... Params>
+struct tool {
+    static constexpr auto name = Name;
+    static constexpr auto schema = "{\"type\":\"function\",\"name\":" + quoted<Name>() +
+                                   ",\"description\":" + quoted<Desc>() +
+                                   ",\"parameters\":{\"type\":\"object\"," +
+                                   detail::object_members<Params...>() + "}}";
+
+    /**
+     * @brief Decode a call's arguments object and run the controls
+     */
+    static void call(rtc_span_t args)
+    {
+        detail::apply_members<Params...>(args, std::index_sequence_for<Params...>{});
+    }
+};
+
+/**
+ * @brief The set of tools offered to the model
+ */
+template <typename... Tools>
+struct registry {
+    static_assert(sizeof...(Tools) > 0, "registry needs at least one tool");
+
+    /**
+     * @brief JSON array for session.tools
+     */
+    static constexpr auto schema = "[" + drop_first(("" + ... + ("," + Tools::schema))) + "]";
+
+    /**
+     * @brief Run the tool called name
+     *
+     * @param name Tool name (not NUL-terminated)
+     * @param len Name length
+     * @param args Arguments object, decoded from the call's "arguments" string
+     * @return false when no tool has that name
+     */
+    static bool call(const char *name, size_t len, rtc_span_t args)
+    {
+        rtc_span_t key = { name, len };
+        return ((rtc_span_equals(key, Tools::name.c_str()) && (Tools::call(args), true)) || ...);
+    }
+};
+
+} // namespace tool_registry
@@ -10,6 +10,7 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include "esp_err.h"
 
 /**
@@ -32,6 +33,7 @@ typedef struct {
     union {
         struct {
             const char *text;
+            bool partial;                /*!< Delta of a transcript still being spoken */
         } transcript;
         struct {
             const char *name;
@@ -4,11 +4,13 @@
  * Adapted for the ESP32-S3-Touch-AMOLED-1.75 BSP audio system.
  */
 
+#include <math.h>
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_capture_path_simple.h"
 #include "esp_capture_audio_enc.h"
 #include "av_render.h"
+#include "audio_mixer.h"
 #include "webrtc_azure_settings.h"
 #include "media_lib_os.h"
 #include "esp_timer.h"
@@ -17,6 +19,8 @@
 #include "esp_audio_enc_default.h"
 #include "esp_capture_defaults.h"
 #include "esp_webrtc.h"
+#include "latency_ledger.h"
+#include "trace_ring.h"
 
 // codec_board includes for TDM mode audio initialization (required for AEC)
 #include "codec_init.h"
@@ -40,6 +44,7 @@ typedef struct {
 
 typedef struct {
     audio_render_handle_t audio_render;
+    audio_mixer_handle_t  mixer;
     av_render_handle_t    player;
 } player_system_t;
 
@@ -124,12 +129,23 @@ static int build_capture_system(void)
     return 0;
 }
 
+/**
+ * @brief I2S render output hook - traces writes and stamps first response sample
+ */
+static int player_output_cb(uint8_t *data, int size, void *ctx)
+{
+    TRACE_EVENT(TRACE_EV_RENDER_WRITE, size, 0);
+    latency_ledger_mark(LATENCY_MARK_FIRST_I2S_WRITE);
+    return 0;
+}
+
 static int build_player_system(void)
 {
     ESP_LOGI(TAG, "Building player system...");
 
     i2s_render_cfg_t i2s_cfg = {
         .play_handle = get_playback_handle(),
+        .cb = player_output_cb,
     };
 
     player_sys.audio_render = av_render_alloc_i2s_render(&i2s_cfg);
@@ -141,8 +157,26 @@ static int build_player_system(void)
     // Set volume
     esp_codec_dev_set_out_vol(i2s_cfg.play_handle, DEFAULT_PLAYBACK_VOL);
 
+    // Configure audio output format (2 channels for AEC reference)
+    av_render_audio_frame_info_t aud_info = {
+        .sample_rate = 16000,
+        .channel = 2,
+        .bits_per_sample = 16,
+    };
+
+    // Earcons and prompts are mixed in front of the I2S render, not queued behind the reply
+    audio_mixer_cfg_t mixer_cfg = {
+        .out = player_sys.audio_render,
+        .info = aud_info,
+    };
+    player_sys.mixer = audio_mixer_open(&mixer_cfg);
+    if (player_sys.mixer == NULL) {
+        ESP_LOGE(TAG, "Failed to create audio mixer");
+        return -1;
+    }
+
     av_render_cfg_t render_cfg = {
-        .audio_render = player_sys.audio_render,
+        .audio_render = audio_mixer_get_render(player_sys.mixer),
         .audio_raw_fifo_size = 8 * 4096,
         .audio_render_fifo_size = 100 * 1024,
         .allow_drop_data = false,
@@ -154,12 +188,6 @@ static int build_player_system(void)
         return -1;
     }
 
-    // Configure audio output format (2 channels for AEC reference)
-    av_render_audio_frame_info_t aud_info = {
-        .sample_rate = 16000,
-        .channel = 2,
-        .bits_per_sample = 16,
-    };
     av_render_set_fixed_frame_info(player_sys.player, &aud_info);
 
     ESP_LOGI(TAG, "Player system built successfully");
@@ -213,6 +241,41 @@ int media_sys_get_provider(esp_webrtc_media_provider_t *provide)
     return 0;
 }
 
+int media_sys_play_sound(const audio_mixer_sound_t *sound)
+{
+    if (!s_media_initialized) {
+        ESP_LOGE(TAG, "Media system not initialized");
+        return -1;
+    }
+    return audio_mixer_play(player_sys.mixer, sound, NULL);
+}
+
+#if CONFIG_WEBRTC_AZURE_CONNECT_CHIME
+#define CHIME_SAMPLES (16000 * 120 / 1000)
+
+static int16_t s_chime[CHIME_SAMPLES];
+
+int media_sys_play_chime(void)
+{
+    if (s_chime[1] == 0) {
+        // Two rising tones with a decaying envelope, built on first use
+        for (int i = 0; i < CHIME_SAMPLES; i++) {
+            float t = (float)i / 16000;
+            float freq = i < CHIME_SAMPLES / 2 ? 880.0f : 1320.0f;
+            float env = 1.0f - (float)(i % (CHIME_SAMPLES / 2)) / (CHIME_SAMPLES / 2);
+            s_chime[i] = (int16_t)(8000.0f * env * sinf(2.0f * (float)M_PI * freq * t));
+        }
+    }
+    audio_mixer_sound_t sound = {
+        .data = s_chime,
+        .samples = CHIME_SAMPLES,
+        .channel = 1,
+        .duck = true,
+    };
+    return media_sys_play_sound(&sound);
+}
+#endif
+
 int test_capture_to_player(void)
 {
     ESP_LOGI(TAG, "Starting capture to player test...");
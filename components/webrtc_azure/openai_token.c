@@ -0,0 +1,420 @@
+/* Ephemeral token manager
+
+   Fetches realtime session tokens (client_secret) ahead of time so WebRTC
+   session setup does not wait for the sessions endpoint.
+
+   Token lifetime is taken relative to the server's Date header rather than
+   the local clock: the device may not have synced time, and expires_at is
+   only meaningful against the server's notion of now.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdio.h>
+#include <time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "https_client.h"
+#include "openai_token.h"
+#include "webrtc_azure_settings.h"
+#include <cJSON.h>
+
+#define TAG "OPENAI_TOKEN"
+
+#ifdef USE_AZURE_OPENAI
+#define TOKEN_SESSIONS_URL "https://" AZURE_OPENAI_ENDPOINT "/openai/realtimeapi/sessions?api-version=" AZURE_OPENAI_API_VERSION "&deployment=" AZURE_OPENAI_DEPLOYMENT
+#else
+#define TOKEN_SESSIONS_URL "https://api.openai.com/v1/realtime/sessions"
+#define TOKEN_MODEL        "gpt-4o-mini-realtime-preview-2024-12-17"
+#endif
+#define TOKEN_VOICE        "alloy"
+
+#define TOKEN_TASK_STACK       (6 * 1024)
+#define TOKEN_TASK_PRIORITY    3
+#define TOKEN_TAKE_GUARD_S     5        // Minimum lifetime left for a token to be handed out
+#define TOKEN_TAKE_WAIT_MS     10000    // Longest wait for a prefetch in flight
+#define TOKEN_REFILL_DELAY_MS  10000    // Refill after a take if the session never reports up
+#define TOKEN_RETRY_MIN_MS     2000
+#define TOKEN_RETRY_MAX_MS     60000
+#define TOKEN_RESP_MARGIN      4096     // Response size beyond the session config it echoes
+
+typedef struct {
+    char   *value;
+    int64_t expires_us;                 // esp_timer time the token expires
+    int64_t refresh_us;                 // esp_timer time to replace it
+} token_t;
+
+typedef struct {
+    token_t token;
+    int64_t server_now;                 // Date header, 0 if absent
+    char   *body;                       // Streamed response body, NUL terminated
+    int     body_len;
+    int     body_cap;
+    bool    truncated;
+} token_resp_t;
+
+static portMUX_TYPE         s_lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t         s_task;
+static SemaphoreHandle_t    s_wake;     // Manager: refill or refresh now
+static SemaphoreHandle_t    s_ready;    // Takers: a prefetch finished
+static token_t              s_token;
+static volatile bool        s_fetching;
+static int64_t              s_refill_us; // esp_timer time a taken token may be replaced, 0: now
+static char                *s_body;     // Request body, built once
+static openai_token_stats_t s_stats;
+static uint64_t             s_fetch_total_ms;
+
+// ============================================
+// Response Parsing
+// ============================================
+
+/* Days since 1970-01-01 of a civil date (no timegm() on newlib) */
+static int64_t days_from_civil(int y, int m, int d)
+{
+    y -= m <= 2;
+    int64_t era = (y >= 0 ? y : y - 399) / 400;
+    int yoe = y - era * 400;
+    int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+/* IMF-fixdate, e.g. "Sun, 06 Nov 1994 08:49:37 GMT" */
+static int64_t parse_http_date(const char *value)
+{
+    static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    char mon[4] = { 0 };
+    int day, year, hh, mm, ss;
+    if (sscanf(value, "%*3s, %d %3s %d %d:%d:%d", &day, mon, &year, &hh, &mm, &ss) != 6) {
+        return 0;
+    }
+    const char *p = strstr(months, mon);
+    if (p == NULL || (p - months) % 3) {
+        return 0;
+    }
+    int month = (int)(p - months) / 3 + 1;
+    return days_from_civil(year, month, day) * 86400 + hh * 3600 + mm * 60 + ss;
+}
+
+static void token_header(const char *key, const char *value, void *ctx)
+{
+    token_resp_t *resp = ctx;
+    if (strcasecmp(key, "Date") == 0) {
+        resp->server_now = parse_http_date(value);
+    }
+}
+
+static void token_chunk(const char *data, int size, void *ctx)
+{
+    token_resp_t *resp = ctx;
+    if (resp->body_len + size >= resp->body_cap) {
+        resp->truncated = true;
+        return;
+    }
+    memcpy(resp->body + resp->body_len, data, size);
+    resp->body_len += size;
+    resp->body[resp->body_len] = 0;
+}
+
+static void token_parse(token_resp_t *out)
+{
+    if (strstr(out->body, "\"error\"") != NULL) {
+        ESP_LOGE(TAG, "Sessions endpoint returned error: %.*s", out->body_len > 300 ? 300 : out->body_len,
+                 out->body);
+        return;
+    }
+    // Response format: {"client_secret": {"value": "ek_xxx", "expires_at": 123}}
+    cJSON *root = cJSON_Parse(out->body);
+    cJSON *secret = root ? cJSON_GetObjectItem(root, "client_secret") : NULL;
+    cJSON *value = secret ? cJSON_GetObjectItem(secret, "value") : NULL;
+    cJSON *expires = secret ? cJSON_GetObjectItem(secret, "expires_at") : NULL;
+    if (cJSON_IsString(value)) {
+        // Lifetime relative to the server clock, else the local one once synced
+        int64_t now = out->server_now;
+        if (now == 0 && time(NULL) > 1700000000) {
+            now = time(NULL);
+        }
+        int64_t ttl = CONFIG_WEBRTC_AZURE_TOKEN_DEFAULT_TTL_S;
+        if (cJSON_IsNumber(expires) && now > 0) {
+            ttl = (int64_t)expires->valuedouble - now;
+        }
+        // A token that could never be handed out is a failed fetch: back off, don't refetch at once
+        if (ttl <= TOKEN_TAKE_GUARD_S) {
+            ESP_LOGE(TAG, "Token expires in %lld s (expires_at %.0f, server time %lld)", (long long)ttl,
+                     cJSON_IsNumber(expires) ? expires->valuedouble : 0.0, (long long)now);
+            cJSON_Delete(root);
+            return;
+        }
+        out->token.value = strdup(value->valuestring);
+        // Deadline counted from arrival: conservative by the response time.
+        // Short-lived tokens are refreshed at half-life instead of the margin.
+        int64_t margin = CONFIG_WEBRTC_AZURE_TOKEN_REFRESH_MARGIN_S;
+        margin = margin < ttl / 2 ? margin : ttl / 2;
+        out->token.expires_us = esp_timer_get_time() + ttl * 1000000;
+        out->token.refresh_us = out->token.expires_us - margin * 1000000;
+    } else {
+        ESP_LOGE(TAG, "No client_secret.value in response");
+    }
+    cJSON_Delete(root);
+}
+
+// ============================================
+// Fetch
+// ============================================
+
+static const char *request_body(void)
+{
+    if (s_body) {
+        return s_body;
+    }
+    cJSON *root = cJSON_CreateObject();
+#ifdef USE_AZURE_OPENAI
+    cJSON_AddStringToObject(root, "model", AZURE_OPENAI_DEPLOYMENT);
+    cJSON_AddStringToObject(root, "voice", TOKEN_VOICE);
+    cJSON_AddStringToObject(root, "instructions", AZURE_OPENAI_INSTRUCTIONS);
+#else
+    cJSON_AddStringToObject(root, "model", TOKEN_MODEL);
+    cJSON *modalities = cJSON_CreateArray();
+    cJSON_AddItemToArray(modalities, cJSON_CreateString("text"));
+    cJSON_AddItemToArray(modalities, cJSON_CreateString("audio"));
+    cJSON_AddItemToObject(root, "modalities", modalities);
+    cJSON_AddStringToObject(root, "voice", TOKEN_VOICE);
+#endif
+    s_body = cJSON_PrintUnformatted(root);
+    cJSON_Delete(root);
+    return s_body;
+}
+
+static int fetch(token_t *token)
+{
+    const char *body = request_body();
+    if (body == NULL) {
+        return -1;
+    }
+    char auth[128];
+#ifdef USE_AZURE_OPENAI
+    snprintf(auth, sizeof(auth), "api-key: %s", AZURE_OPENAI_API_KEY);
+#else
+    snprintf(auth, sizeof(auth), "Authorization: Bearer %s", OPENAI_API_KEY);
+#endif
+    char content_type[] = "Content-Type: application/json";
+    char *header[] = {
+        auth,
+        content_type,
+        NULL,
+    };
+
+    // The response echoes the session config, so size the body buffer from the request
+    token_resp_t resp = { .body_cap = (int)strlen(body) + TOKEN_RESP_MARGIN };
+    resp.body = malloc(resp.body_cap);
+    if (resp.body == NULL) {
+        return -1;
+    }
+    resp.body[0] = 0;
+    int64_t start = esp_timer_get_time();
+    int ret = https_request(&(https_request_t) {
+        .method = "POST",
+        .url = TOKEN_SESSIONS_URL,
+        .headers = header,
+        .data = body,
+        .header_cb = token_header,
+        .chunk_cb = token_chunk,
+        .ctx = &resp,
+    });
+    uint32_t ms = (uint32_t)((esp_timer_get_time() - start) / 1000);
+    if (resp.truncated) {
+        ESP_LOGE(TAG, "Sessions response exceeds %d bytes", resp.body_cap - 1);
+    } else if (ret == 0 && resp.body_len > 0) {
+        token_parse(&resp);
+    }
+    free(resp.body);
+    bool ok = ret == 0 && resp.token.value != NULL;
+
+    portENTER_CRITICAL(&s_lock);
+    if (ok) {
+        s_stats.fetches++;
+        s_stats.fetch_last_ms = ms;
+        s_fetch_total_ms += ms;
+        s_stats.fetch_avg_ms = (uint32_t)(s_fetch_total_ms / s_stats.fetches);
+    } else {
+        s_stats.failures++;
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    if (!ok) {
+        ESP_LOGE(TAG, "Token request failed (ret=%d, %lu ms)", ret, (unsigned long)ms);
+        free(resp.token.value);
+        return -1;
+    }
+    ESP_LOGI(TAG, "Token fetched in %lu ms, valid %lld s", (unsigned long)ms,
+             (long long)((resp.token.expires_us - esp_timer_get_time()) / 1000000));
+    *token = resp.token;
+    return 0;
+}
+
+// ============================================
+// Background Manager
+// ============================================
+
+static void token_task(void *arg)
+{
+    uint32_t retry_ms = TOKEN_RETRY_MIN_MS;
+    for (;;) {
+        int64_t now = esp_timer_get_time();
+        token_t stale = { 0 };
+
+        portENTER_CRITICAL(&s_lock);
+        bool have = s_token.value != NULL;
+        if (have && now >= s_token.refresh_us) {
+            stale = s_token;
+            s_token.value = NULL;
+            s_stats.expired++;
+            have = false;
+        }
+        // Hold a refill back while the session that took the token sets up
+        bool hold = !have && now < s_refill_us;
+        int64_t due_us = have ? s_token.refresh_us : hold ? s_refill_us : now;
+        s_fetching = !have && !hold;
+        portEXIT_CRITICAL(&s_lock);
+        free(stale.value);
+
+        TickType_t wait;
+        if (have || hold) {
+            wait = pdMS_TO_TICKS((due_us - now) / 1000);
+        } else {
+            token_t token;
+            token_t old = { 0 };
+            int ret = fetch(&token);
+            portENTER_CRITICAL(&s_lock);
+            if (ret == 0) {
+                old = s_token;
+                s_token = token;
+            }
+            s_fetching = false;
+            portEXIT_CRITICAL(&s_lock);
+            free(old.value);
+            xSemaphoreGive(s_ready);
+
+            if (ret == 0) {
+                retry_ms = TOKEN_RETRY_MIN_MS;
+                continue;
+            }
+            wait = pdMS_TO_TICKS(retry_ms);
+            retry_ms = retry_ms * 2 > TOKEN_RETRY_MAX_MS ? TOKEN_RETRY_MAX_MS : retry_ms * 2;
+        }
+        xSemaphoreTake(s_wake, wait);
+    }
+}
+
+esp_err_t openai_token_start(void)
+{
+#if CONFIG_WEBRTC_AZURE_TOKEN_PREFETCH
+    if (s_task) {
+        return ESP_OK;
+    }
+    s_wake = xSemaphoreCreateBinary();
+    s_ready = xSemaphoreCreateBinary();
+    if (s_wake == NULL || s_ready == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    s_fetching = true;
+    if (xTaskCreate(token_task, "token", TOKEN_TASK_STACK, NULL, TOKEN_TASK_PRIORITY, &s_task) != pdPASS) {
+        s_fetching = false;
+        ESP_LOGE(TAG, "Failed to create token task");
+        return ESP_FAIL;
+    }
+    ESP_LOGI(TAG, "Token prefetch started (refresh %d s before expiry)", CONFIG_WEBRTC_AZURE_TOKEN_REFRESH_MARGIN_S);
+#endif
+    return ESP_OK;
+}
+
+// ============================================
+// Take
+// ============================================
+
+char *openai_token_take(void)
+{
+    int64_t start = esp_timer_get_time();
+    int64_t guard_us = (int64_t)TOKEN_TAKE_GUARD_S * 1000000;
+    char *value = NULL;
+    bool waited = false;
+
+    while (s_task) {
+        portENTER_CRITICAL(&s_lock);
+        if (s_token.value && esp_timer_get_time() < s_token.expires_us - guard_us) {
+            value = s_token.value;
+            s_token.value = NULL;
+        }
+        bool fetching = s_fetching;
+        portEXIT_CRITICAL(&s_lock);
+
+        if (value || !fetching) {
+            break;
+        }
+        // A prefetch is in flight: its answer comes sooner than a new request's
+        int64_t left_ms = TOKEN_TAKE_WAIT_MS - (esp_timer_get_time() - start) / 1000;
+        if (left_ms <= 0) {
+            break;
+        }
+        waited = true;
+        xSemaphoreTake(s_ready, pdMS_TO_TICKS(left_ms));
+    }
+
+    bool cached = value != NULL;
+    if (value == NULL) {
+        token_t token;
+        if (fetch(&token) == 0) {
+            value = token.value;
+        }
+    }
+    uint32_t ms = (uint32_t)((esp_timer_get_time() - start) / 1000);
+
+    portENTER_CRITICAL(&s_lock);
+    s_stats.take_last_ms = ms;
+    s_refill_us = esp_timer_get_time() + (int64_t)TOKEN_REFILL_DELAY_MS * 1000;
+    if (cached && !waited) {
+        s_stats.hits++;
+    } else if (cached) {
+        s_stats.waits++;
+    } else {
+        s_stats.misses++;
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    // The manager holds the next fetch until the session is up, off this SDP exchange's network
+    if (s_task) {
+        xSemaphoreGive(s_wake);
+    }
+    if (value == NULL) {
+        ESP_LOGE(TAG, "No token for session after %lu ms", (unsigned long)ms);
+        return NULL;
+    }
+    ESP_LOGI(TAG, "Token for session ready in %lu ms (%s)", (unsigned long)ms,
+             cached ? (waited ? "prefetch in flight" : "prefetched") : "fetched");
+    return value;
+}
+
+void openai_token_session_up(void)
+{
+    if (s_task == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&s_lock);
+    s_refill_us = 0;
+    portEXIT_CRITICAL(&s_lock);
+    xSemaphoreGive(s_wake);
+}
+
+void openai_token_get_stats(openai_token_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&s_lock);
+    *stats = s_stats;
+    portEXIT_CRITICAL(&s_lock);
+}
@@ -0,0 +1,558 @@
+/* Data channel event router
+ *
+ * Replaces cJSON on the data channel receive path. Messages are scanned
+ * once: top-level members are walked in order, the few fields the handlers
+ * use are kept as spans and everything else is skipped bracket by bracket.
+ * Strings are only decoded when a handler asks for them.
+ */
+
+#include "rtc_event_router.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#define SEED_ATTEMPTS       4096
+#define NUMBER_MAX_CHARS    31
+
+// ============================================
+// Event Names
+// ============================================
+
+// Indexed by rtc_event_type_t
+static const char *const s_event_names[RTC_EVENT_MAX] = {
+    [RTC_EVENT_UNKNOWN]                 = "unknown",
+    [RTC_EVENT_ERROR]                   = "error",
+    [RTC_EVENT_SESSION_CREATED]         = "session.created",
+    [RTC_EVENT_SESSION_UPDATED]         = "session.updated",
+    [RTC_EVENT_SPEECH_STARTED]          = "input_audio_buffer.speech_started",
+    [RTC_EVENT_SPEECH_STOPPED]          = "input_audio_buffer.speech_stopped",
+    [RTC_EVENT_BUFFER_COMMITTED]        = "input_audio_buffer.committed",
+    [RTC_EVENT_BUFFER_CLEARED]          = "input_audio_buffer.cleared",
+    [RTC_EVENT_ITEM_CREATED]            = "conversation.item.created",
+    [RTC_EVENT_ITEM_TRUNCATED]          = "conversation.item.truncated",
+    [RTC_EVENT_INPUT_TRANSCRIPT_DELTA]  = "conversation.item.input_audio_transcription.delta",
+    [RTC_EVENT_INPUT_TRANSCRIPT_DONE]   = "conversation.item.input_audio_transcription.completed",
+    [RTC_EVENT_INPUT_TRANSCRIPT_FAILED] = "conversation.item.input_audio_transcription.failed",
+    [RTC_EVENT_RESPONSE_CREATED]        = "response.created",
+    [RTC_EVENT_RESPONSE_DONE]           = "response.done",
+    [RTC_EVENT_OUTPUT_ITEM_ADDED]       = "response.output_item.added",
+    [RTC_EVENT_OUTPUT_ITEM_DONE]        = "response.output_item.done",
+    [RTC_EVENT_CONTENT_PART_ADDED]      = "response.content_part.added",
+    [RTC_EVENT_CONTENT_PART_DONE]       = "response.content_part.done",
+    [RTC_EVENT_TEXT_DELTA]              = "response.text.delta",
+    [RTC_EVENT_TEXT_DONE]               = "response.text.done",
+    [RTC_EVENT_TRANSCRIPT_DELTA]        = "response.audio_transcript.delta",
+    [RTC_EVENT_TRANSCRIPT_DONE]         = "response.audio_transcript.done",
+    [RTC_EVENT_AUDIO_DONE]              = "response.audio.done",
+    [RTC_EVENT_FUNCTION_ARGS_DELTA]     = "response.function_call_arguments.delta",
+    [RTC_EVENT_FUNCTION_ARGS_DONE]      = "response.function_call_arguments.done",
+    [RTC_EVENT_AUDIO_STARTED]           = "output_audio_buffer.started",
+    [RTC_EVENT_AUDIO_STOPPED]           = "output_audio_buffer.stopped",
+    [RTC_EVENT_AUDIO_CLEARED]           = "output_audio_buffer.cleared",
+    [RTC_EVENT_RATE_LIMITS_UPDATED]     = "rate_limits.updated",
+};
+
+static rtc_name_table_t s_event_table;
+
+// ============================================
+// Name Tables
+// ============================================
+
+static uint32_t name_slot(uint32_t seed, const char *name, size_t len)
+{
+    // FNV-1a with the seed folded into the offset basis
+    uint32_t h = 2166136261u ^ seed;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (uint8_t)name[i];
+        h *= 16777619u;
+    }
+    return (h ^ (h >> 15)) & (RTC_NAME_TABLE_SLOTS - 1);
+}
+
+esp_err_t rtc_name_table_build(rtc_name_table_t *table, const char *const *names, size_t count)
+{
+    if (table == NULL || names == NULL || count > RTC_NAME_TABLE_SLOTS / 2) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (size_t i = 0; i < count; i++) {
+        for (size_t j = i + 1; j < count; j++) {
+            if (strcmp(names[i], names[j]) == 0) {
+                return ESP_ERR_INVALID_ARG;
+            }
+        }
+    }
+
+    for (uint32_t seed = 0; seed < SEED_ATTEMPTS; seed++) {
+        memset(table->slot, 0, sizeof(table->slot));
+        size_t placed = 0;
+        for (; placed < count; placed++) {
+            uint32_t s = name_slot(seed, names[placed], strlen(names[placed]));
+            if (table->slot[s] != 0) {
+                break;
+            }
+            table->slot[s] = (uint8_t)(placed + 1);
+        }
+        if (placed == count) {
+            table->seed = seed;
+            table->names = names;
+            table->count = (uint8_t)count;
+            return ESP_OK;
+        }
+    }
+    memset(table, 0, sizeof(*table));
+    return ESP_FAIL;
+}
+
+int rtc_name_table_find(const rtc_name_table_t *table, const char *name, size_t len)
+{
+    if (table == NULL || table->count == 0 || name == NULL) {
+        return -1;
+    }
+    uint8_t idx = table->slot[name_slot(table->seed, name, len)];
+    if (idx == 0) {
+        return -1;
+    }
+    const char *candidate = table->names[idx - 1];
+    if (strncmp(candidate, name, len) != 0 || candidate[len] != '\0') {
+        return -1;
+    }
+    return idx - 1;
+}
+
+// ============================================
+// JSON Scanning
+// ============================================
+
+static const char *skip_ws(const char *p, const char *end)
+{
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) {
+        p++;
+    }
+    return p;
+}
+
+/**
+ * @brief Skip a string starting at its opening quote
+ *
+ * @return Position after the closing quote, NULL if unterminated
+ */
+static const char *skip_string(const char *p, const char *end)
+{
+    for (p++; p < end; p++) {
+        if (*p == '\\') {
+            p++;
+        } else if (*p == '"') {
+            return p + 1;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Skip an object or array starting at its opening bracket
+ */
+static const char *skip_container(const char *p, const char *end)
+{
+    int depth = 0;
+    while (p < end) {
+        char c = *p;
+        if (c == '"') {
+            p = skip_string(p, end);
+            if (p == NULL) {
+                return NULL;
+            }
+            continue;
+        }
+        if (c == '{' || c == '[') {
+            depth++;
+        } else if (c == '}' || c == ']') {
+            if (--depth == 0) {
+                return p + 1;
+            }
+        }
+        p++;
+    }
+    return NULL;
+}
+
+static const char *scan_literal(const char *p, const char *end, const char *word, size_t len)
+{
+    if ((size_t)(end - p) < len || memcmp(p, word, len) != 0) {
+        return NULL;
+    }
+    return p + len;
+}
+
+/**
+ * @brief Scan one value
+ *
+ * @return Position after the value, NULL on malformed input
+ */
+static const char *scan_value(const char *p, const char *end, rtc_json_value_t *value)
+{
+    if (p >= end) {
+        return NULL;
+    }
+    const char *next = NULL;
+    switch (*p) {
+        case '"':
+            next = skip_string(p, end);
+            if (next) {
+                value->kind = RTC_JSON_STRING;
+                value->span.ptr = p + 1;
+                value->span.len = (size_t)(next - p - 2);
+            }
+            return next;
+        case '{':
+        case '[':
+            next = skip_container(p, end);
+            if (next) {
+                value->kind = *p == '{' ? RTC_JSON_OBJECT : RTC_JSON_ARRAY;
+                value->span.ptr = p;
+                value->span.len = (size_t)(next - p);
+            }
+            return next;
+        case 't':
+            next = scan_literal(p, end, "true", 4);
+            value->kind = RTC_JSON_TRUE;
+            break;
+        case 'f':
+            next = scan_literal(p, end, "false", 5);
+            value->kind = RTC_JSON_FALSE;
+            break;
+        case 'n':
+            next = scan_literal(p, end, "null", 4);
+            value->kind = RTC_JSON_NULL;
+            break;
+        default:
+            if (*p != '-' && (*p < '0' || *p > '9')) {
+                return NULL;
+            }
+            next = p + 1;
+            while (next < end && ((*next >= '0' && *next <= '9') || *next == '.' ||
+                                  *next == 'e' || *next == 'E' || *next == '+' || *next == '-')) {
+                next++;
+            }
+            value->kind = RTC_JSON_NUMBER;
+            break;
+    }
+    if (next) {
+        value->span.ptr = p;
+        value->span.len = (size_t)(next - p);
+    }
+    return next;
+}
+
+void rtc_json_iter_init(rtc_json_iter_t *it, const char *obj, size_t len)
+{
+    const char *end = obj + len;
+    const char *p = skip_ws(obj, end);
+
+    it->end = end;
+    it->done = false;
+    it->error = false;
+    if (p >= end || *p != '{') {
+        it->pos = p;
+        it->done = true;
+        it->error = true;
+        return;
+    }
+    p = skip_ws(p + 1, end);
+    if (p < end && *p == '}') {
+        it->done = true;
+    }
+    it->pos = p;
+}
+
+bool rtc_json_iter_next(rtc_json_iter_t *it, rtc_span_t *key, rtc_json_value_t *value)
+{
+    if (it->done) {
+        return false;
+    }
+
+    const char *p = it->pos;
+    const char *end = it->end;
+    const char *key_end;
+    if (p >= end || *p != '"' || (key_end = skip_string(p, end)) == NULL) {
+        goto fail;
+    }
+    key->ptr = p + 1;
+    key->len = (size_t)(key_end - p - 2);
+
+    p = skip_ws(key_end, end);
+    if (p >= end || *p != ':') {
+        goto fail;
+    }
+    p = scan_value(skip_ws(p + 1, end), end, value);
+    if (p == NULL) {
+        goto fail;
+    }
+
+    p = skip_ws(p, end);
+    if (p < end && *p == ',') {
+        p = skip_ws(p + 1, end);
+    } else if (p < end && *p == '}') {
+        it->done = true;
+    } else {
+        goto fail;
+    }
+    it->pos = p;
+    return true;
+
+fail:
+    it->done = true;
+    it->error = true;
+    return false;
+}
+
+int rtc_json_to_int(rtc_span_t span)
+{
+    char buf[NUMBER_MAX_CHARS + 1];
+    size_t len = span.len < NUMBER_MAX_CHARS ? span.len : NUMBER_MAX_CHARS;
+    if (span.ptr == NULL || len == 0) {
+        return 0;
+    }
+    memcpy(buf, span.ptr, len);
+    buf[len] = '\0';
+
+    double number = strtod(buf, NULL);
+    if (number >= INT_MAX) {
+        return INT_MAX;
+    }
+    if (number <= (double)INT_MIN) {
+        return INT_MIN;
+    }
+    return (int)number;
+}
+
+// ============================================
+// Strings
+// ============================================
+
+bool rtc_span_equals(rtc_span_t span, const char *name)
+{
+    return span.ptr != NULL && strncmp(span.ptr, name, span.len) == 0 && name[span.len] == '\0';
+}
+
+static int hex4(const char *p)
+{
+    int v = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = p[i];
+        v <<= 4;
+        if (c >= '0' && c <= '9') {
+            v |= c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            v |= c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            v |= c - 'A' + 10;
+        } else {
+            return -1;
+        }
+    }
+    return v;
+}
+
+static size_t put_utf8(char *out, uint32_t cp)
+{
+    if (cp < 0x80) {
+        out[0] = (char)cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (cp >> 18));
+    out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+/**
+ * @brief Drop a UTF-8 sequence cut short at the end of out[0..len)
+ */
+static size_t trim_partial_utf8(const char *out, size_t len)
+{
+    size_t k = len;
+    while (k > 0 && ((uint8_t)out[k - 1] & 0xC0) == 0x80) {
+        k--;
+    }
+    if (k == 0) {
+        return len;
+    }
+    uint8_t lead = (uint8_t)out[k - 1];
+    if (lead < 0xC0) {
+        return len;
+    }
+    size_t need = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : 2;
+    return len - (k - 1) < need ? k - 1 : len;
+}
+
+size_t rtc_span_unescape(rtc_span_t span, char *out, size_t out_size)
+{
+    if (out == NULL || out_size == 0) {
+        return 0;
+    }
+    if (span.ptr == NULL) {
+        out[0] = '\0';
+        return 0;
+    }
+
+    const char *p = span.ptr;
+    const char *end = span.ptr + span.len;
+    size_t o = 0;
+    size_t room = out_size - 1;
+    bool truncated = false;
+
+    while (p < end) {
+        char c = *p++;
+        if (c != '\\' || p >= end) {
+            if (o >= room) {
+                truncated = true;
+                break;
+            }
+            out[o++] = c;
+            continue;
+        }
+
+        char esc = *p++;
+        char ch;
+        switch (esc) {
+            case 'b': ch = '\b'; break;
+            case 'f': ch = '\f'; break;
+            case 'n': ch = '\n'; break;
+            case 'r': ch = '\r'; break;
+            case 't': ch = '\t'; break;
+            case 'u': {
+                int hi = end - p >= 4 ? hex4(p) : -1;
+                if (hi < 0) {
+                    ch = '?';
+                    break;
+                }
+                p += 4;
+                uint32_t cp = (uint32_t)hi;
+                if (cp >= 0xD800 && cp <= 0xDBFF && end - p >= 6 && p[0] == '\\' && p[1] == 'u') {
+                    int lo = hex4(p + 2);
+                    if (lo >= 0xDC00 && lo <= 0xDFFF) {
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + ((uint32_t)lo - 0xDC00);
+                        p += 6;
+                    }
+                }
+                if (cp >= 0xD800 && cp <= 0xDFFF) {
+                    cp = 0xFFFD;                // Unpaired surrogate
+                }
+                char utf8[4];
+                size_t n = put_utf8(utf8, cp);
+                if (o + n > room) {
+                    truncated = true;
+                    goto out;
+                }
+                memcpy(out + o, utf8, n);
+                o += n;
+                continue;
+            }
+            default: ch = esc; break;           // \" \\ \/
+        }
+        if (o >= room) {
+            truncated = true;
+            break;
+        }
+        out[o++] = ch;
+    }
+
+out:
+    if (truncated) {
+        o = trim_partial_utf8(out, o);
+    }
+    out[o] = '\0';
+    return o;
+}
+
+// ============================================
+// Router
+// ============================================
+
+esp_err_t rtc_event_router_init(void)
+{
+    if (s_event_table.count != 0) {
+        return ESP_OK;
+    }
+    // "unknown" is not a wire name, so the table starts at the first real event
+    return rtc_name_table_build(&s_event_table, s_event_names + 1, RTC_EVENT_MAX - 1);
+}
+
+const char *rtc_event_name(rtc_event_type_t type)
+{
+    return (unsigned)type < RTC_EVENT_MAX ? s_event_names[type] : s_event_names[RTC_EVENT_UNKNOWN];
+}
+
+static inline bool key_is(rtc_span_t key, const char *name, size_t len)
+{
+    return key.len == len && memcmp(key.ptr, name, len) == 0;
+}
+
+esp_err_t rtc_event_parse(const char *data, size_t size, rtc_event_t *event)
+{
+    if (data == NULL || event == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(event, 0, sizeof(*event));
+
+    rtc_json_iter_t it;
+    rtc_span_t key;
+    rtc_json_value_t value;
+    rtc_json_iter_init(&it, data, size);
+    while (rtc_json_iter_next(&it, &key, &value)) {
+        if (value.kind == RTC_JSON_OBJECT) {
+            if (key_is(key, "error", 5)) {
+                event->error = value.span;
+            }
+            continue;
+        }
+        if (value.kind != RTC_JSON_STRING) {
+            continue;
+        }
+        rtc_span_t *field = NULL;
+        switch (key.len) {
+            case 4:
+                field = key_is(key, "type", 4) ? &event->type_name :
+                        key_is(key, "text", 4) ? &event->text :
+                        key_is(key, "name", 4) ? &event->name : NULL;
+                break;
+            case 5:
+                field = key_is(key, "delta", 5) ? &event->delta : NULL;
+                break;
+            case 7:
+                field = key_is(key, "call_id", 7) ? &event->call_id : NULL;
+                break;
+            case 9:
+                field = key_is(key, "arguments", 9) ? &event->arguments : NULL;
+                break;
+            case 10:
+                field = key_is(key, "transcript", 10) ? &event->transcript : NULL;
+                break;
+            default:
+                break;
+        }
+        if (field) {
+            *field = value.span;
+        }
+    }
+
+    if (it.error || event->type_name.ptr == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    int idx = rtc_name_table_find(&s_event_table, event->type_name.ptr, event->type_name.len);
+    event->type = idx < 0 ? RTC_EVENT_UNKNOWN : (rtc_event_type_t)(idx + 1);
+    return ESP_OK;
+}
@@ -18,59 +18,42 @@
 #include "esp_peer_default.h"
 #include "webrtc_azure.h"
 #include "webrtc_azure_settings.h"
+#include "openai_token.h"
+#include "latency_ledger.h"
+#include "rtc_event_router.h"
+#include "azure_tools.h"
+#include "rate_ctrl.h"
+#include "esp_timer.h"
 #include <cJSON.h>
 
 #define TAG "WEBRTC_AZURE"
 
-#define ELEMS(a) (sizeof(a) / sizeof(a[0]))
+#define INLINE_TEXT_SIZE    256     // Transcript deltas decode on the stack below this
+#define FUNCTION_NAME_SIZE  64
 
 // Forward declarations for signaling and media
 extern const esp_peer_signaling_impl_t *esp_signaling_get_openai_signaling(void);
 extern int media_sys_buildup(void);
 extern int media_sys_get_provider(esp_webrtc_media_provider_t *provide);
-
-// Function Calling structures
-typedef struct attribute_t attribute_t;
-typedef struct class_t class_t;
-
-typedef enum {
-    ATTRIBUTE_TYPE_NONE,
-    ATTRIBUTE_TYPE_BOOL,
-    ATTRIBUTE_TYPE_INT,
-    ATTRIBUTE_TYPE_PARENT,
-} attribute_type_t;
-
-struct attribute_t {
-    char            *name;
-    char            *desc;
-    attribute_type_t type;
-    union {
-        bool         b_state;
-        int          i_value;
-        attribute_t *attr_list;
-    };
-    int  attr_num;
-    bool required;
-    int (*control)(attribute_t *attr);
-};
-
-struct class_t {
-    char        *name;
-    char        *desc;
-    attribute_t *attr_list;
-    int          attr_num;
-    class_t     *next;
-};
+#if CONFIG_WEBRTC_AZURE_CONNECT_CHIME
+extern int media_sys_play_chime(void);
+#endif
 
 // Module state
 static esp_webrtc_handle_t s_webrtc = NULL;
-static class_t *s_classes = NULL;
 static bool s_initialized = false;
 static bool s_connected = false;
 static bool s_data_channel_open = false;
 static webrtc_azure_event_cb_t s_event_cb = NULL;
 static void *s_user_data = NULL;
 
+#ifdef CONFIG_RATE_CTRL_ENABLE
+// Uplink rate control, only touched from the pc_send task after start
+static rate_ctrl_t s_rate_ctrl;
+static esp_webrtc_stats_t s_rate_prev;
+static int64_t s_rate_prev_us;
+#endif
+
 // ============================================
 // Thread Stack Size Configuration
 // ============================================
@@ -98,7 +81,7 @@ static void webrtc_thread_scheduler(const char *name, media_lib_thread_cfg_t *cf
         ESP_LOGI(TAG, "start: stack=%d", cfg->stack_size);
     }
     else if (strcmp(name, "pc_send") == 0) {
-        cfg->stack_size = 4 * 1024;  // 4KB - peer connection send
+        cfg->stack_size = 6 * 1024;  // 6KB - peer connection send, runs uplink rate control
         cfg->priority = 15;
         cfg->core_id = 1;
         ESP_LOGI(TAG, "pc_send: stack=%d, priority=%d, core=%d", cfg->stack_size, cfg->priority, cfg->core_id);
@@ -139,446 +122,204 @@ static void webrtc_thread_scheduler(const char *name, media_lib_thread_cfg_t *cf
 }
 
 // ============================================
-// Function Calling - Demo controls
+// Function Calling
 // ============================================
 
-static int set_light_on_off(attribute_t *attr)
-{
-    ESP_LOGI(TAG, "Light set to %s", attr->b_state ? "ON" : "OFF");
-    return 0;
-}
-
-static int set_light_color_red(attribute_t *attr)
-{
-    ESP_LOGI(TAG, "Red set to %d", attr->i_value);
-    return 0;
-}
-
-static int set_light_color_blue(attribute_t *attr)
-{
-    ESP_LOGI(TAG, "Blue set to %d", attr->i_value);
-    return 0;
-}
-
-static int set_light_color_green(attribute_t *attr)
-{
-    ESP_LOGI(TAG, "Green set to %d", attr->i_value);
-    return 0;
-}
-
-static int set_speaker_volume(attribute_t *attr)
-{
-    ESP_LOGI(TAG, "Volume set to %d", attr->i_value);
-    return 0;
-}
-
-static int set_door_state(attribute_t *attr)
-{
-    ESP_LOGI(TAG, "Door is %s", attr->b_state ? "Opened" : "Closed");
-    return 0;
-}
-
-static class_t *build_volume_class(void)
-{
-    class_t *vol = (class_t *)calloc(1, sizeof(class_t));
-    if (vol == NULL) {
-        return NULL;
-    }
-    static attribute_t vol_attrs[] = {
-        {
-            .name = "volume",
-            .desc = "Speaker volume range 0-100",
-            .type = ATTRIBUTE_TYPE_INT,
-            .control = set_speaker_volume,
-            .required = true,
-        },
-    };
-    vol->name = "SetVolume";
-    vol->desc = "Changes speaker volume";
-    vol->attr_list = vol_attrs;
-    vol->attr_num = ELEMS(vol_attrs);
-    return vol;
-}
-
-static class_t *build_door_class(void)
-{
-    class_t *door = (class_t *)calloc(1, sizeof(class_t));
-    if (door == NULL) {
-        return NULL;
-    }
-    static attribute_t door_attrs[] = {
-        {
-            .name = "open",
-            .desc = "Open or close the door",
-            .type = ATTRIBUTE_TYPE_BOOL,
-            .control = set_door_state,
-            .required = true,
-        },
-    };
-    door->name = "OpenDoor";
-    door->desc = "Toggle the door state to open or close";
-    door->attr_list = door_attrs;
-    door->attr_num = ELEMS(door_attrs);
-    return door;
-}
-
-static class_t *build_light_class(void)
-{
-    class_t *light = (class_t *)calloc(1, sizeof(class_t));
-    if (light == NULL) {
-        return NULL;
-    }
-    static attribute_t light_color[] = {
-        {
-            .name = "red",
-            .desc = "Red value in the range of 0-255",
-            .type = ATTRIBUTE_TYPE_INT,
-            .control = set_light_color_red,
-            .required = true,
-        },
-        {
-            .name = "green",
-            .desc = "Green value in the range of 0-255",
-            .type = ATTRIBUTE_TYPE_INT,
-            .control = set_light_color_green,
-            .required = true,
-        },
-        {
-            .name = "blue",
-            .desc = "Blue value in the range of 0-255",
-            .control = set_light_color_blue,
-            .type = ATTRIBUTE_TYPE_INT,
-            .required = true,
-        },
-    };
-    static attribute_t light_attrs[] = {
-        {
-            .name = "LightState",
-            .desc = "New light state (true or false is expected)",
-            .type = ATTRIBUTE_TYPE_BOOL,
-            .control = set_light_on_off,
-            .required = true,
-        },
-        {
-            .name = "LightColor",
-            .desc = "Set light color of red, green and blue",
-            .type = ATTRIBUTE_TYPE_PARENT,
-            .attr_list = light_color,
-            .attr_num = ELEMS(light_color),
-        },
-    };
-    light->name = "SetLightState";
-    light->desc = "Changes the state of the light";
-    light->attr_list = light_attrs;
-    light->attr_num = ELEMS(light_attrs);
-    return light;
-}
-
-static void add_class(class_t *cls)
-{
-    if (s_classes == NULL) {
-        s_classes = cls;
-    } else {
-        class_t *iter = s_classes;
-        while (iter->next) {
-            iter = iter->next;
-        }
-        iter->next = cls;
-    }
-}
-
-static int build_classes(void)
+/**
+ * @brief Announce the session settings and tools
+ *
+ * The session.update is generated at compile time with the tool schema
+ * (azure_tools.cpp), so it is sent straight from flash.
+ */
+static int send_function_desc(void)
 {
-    static bool build_once = false;
-    if (build_once) {
+    if (s_webrtc == NULL) {
         return 0;
     }
-    add_class(build_light_class());
-    add_class(build_volume_class());
-    add_class(build_door_class());
-    build_once = true;
+    size_t len = 0;
+    const char *session_update = azure_tools_session_update(&len);
+    ESP_LOGI(TAG, "turn_detection configured: threshold=0.9, silence=1500ms (no AEC, high threshold)");
+    ESP_LOGI(TAG, "Sending function descriptions");
+    esp_webrtc_send_custom_data(s_webrtc, ESP_WEBRTC_CUSTOM_DATA_VIA_DATA_CHANNEL,
+                                (uint8_t *)session_update, (int)len);
     return 0;
 }
 
 // ============================================
-// JSON Helpers for Function Calling
+// Function Call Processing
 // ============================================
 
-static char *get_attr_type(attribute_type_t type)
+static void on_function_call(const rtc_event_t *event)
 {
-    if (type == ATTRIBUTE_TYPE_BOOL) {
-        return "boolean";
-    }
-    if (type == ATTRIBUTE_TYPE_INT) {
-        return "integer";
+    if (event->name.ptr == NULL || event->arguments.ptr == NULL) {
+        ESP_LOGW(TAG, "Invalid JSON format");
+        return;
     }
-    if (type == ATTRIBUTE_TYPE_PARENT) {
-        return "object";
+    if (event->arguments.len >= AZURE_TOOLS_ARGS_MAX) {
+        ESP_LOGW(TAG, "Function call arguments too long (%u bytes)", (unsigned)event->arguments.len);
+        return;
     }
-    return "";
-}
 
-static int add_parent_attribute(cJSON *parent, attribute_t *attr)
-{
-    cJSON *properties = cJSON_CreateObject();
-    cJSON_AddItemToObject(parent, "properties", properties);
-    int require_num = 0;
-    for (int i = 0; i < attr->attr_num; i++) {
-        attribute_t *sub_attr = &attr->attr_list[i];
-        cJSON *prop = cJSON_CreateObject();
-        cJSON_AddItemToObject(properties, sub_attr->name, prop);
-        cJSON_AddStringToObject(prop, "type", get_attr_type(sub_attr->type));
-        cJSON_AddStringToObject(prop, "description", sub_attr->desc);
-        if (sub_attr->type == ATTRIBUTE_TYPE_PARENT) {
-            add_parent_attribute(prop, sub_attr);
-        }
-        if (sub_attr->required) {
-            require_num++;
-        }
-    }
-    if (require_num) {
-        cJSON *requires = cJSON_CreateArray();
-        for (int i = 0; i < attr->attr_num; i++) {
-            attribute_t *sub_attr = &attr->attr_list[i];
-            if (sub_attr->required) {
-                cJSON_AddItemToArray(requires, cJSON_CreateString(sub_attr->name));
-            }
-        }
-        cJSON_AddItemToObject(parent, "required", requires);
-    }
-    return 0;
-}
+    // Arguments arrive as a JSON document inside a string
+    char name[FUNCTION_NAME_SIZE];
+    char args[AZURE_TOOLS_ARGS_MAX];
+    size_t name_len = rtc_span_unescape(event->name, name, sizeof(name));
+    size_t args_len = rtc_span_unescape(event->arguments, args, sizeof(args));
+    ESP_LOGI(TAG, "Function Call: %s %s", name, args);
 
-static int send_function_desc(void)
-{
-    if (s_classes == NULL || s_webrtc == NULL) {
-        return 0;
+    // Notify callback about function call
+    if (s_event_cb) {
+        webrtc_azure_event_t evt = {
+            .type = WEBRTC_AZURE_EVENT_FUNCTION_CALL,
+            .function_call = {
+                .name = name,
+                .arguments = args,
+            },
+        };
+        s_event_cb(&evt, s_user_data);
     }
-    cJSON *root = cJSON_CreateObject();
-    cJSON_AddStringToObject(root, "type", "session.update");
-    cJSON *session = cJSON_CreateObject();
-    cJSON_AddItemToObject(root, "session", session);
-
-    cJSON *modalities = cJSON_CreateArray();
-    cJSON_AddItemToArray(modalities, cJSON_CreateString("text"));
-    cJSON_AddItemToArray(modalities, cJSON_CreateString("audio"));
-
-    cJSON_AddItemToObject(session, "modalities", modalities);
-    cJSON_AddNullToObject(session, "input_audio_transcription");
-
-    // Configure turn_detection with high threshold to reduce false triggers from echo
-    // Without AEC (Acoustic Echo Cancellation), the microphone captures speaker output
-    // Higher threshold (0.9) makes VAD less sensitive to echo, but still detects loud speech
-    // Longer silence_duration (1500ms) prevents brief pauses from ending the turn
-    cJSON *turn_detection = cJSON_CreateObject();
-    cJSON_AddStringToObject(turn_detection, "type", "server_vad");
-    cJSON_AddNumberToObject(turn_detection, "threshold", 0.9);           // High threshold (0.0-1.0)
-    cJSON_AddNumberToObject(turn_detection, "prefix_padding_ms", 500);   // 500ms padding before speech
-    cJSON_AddNumberToObject(turn_detection, "silence_duration_ms", 1500); // 1.5s silence to end turn
-    cJSON_AddItemToObject(session, "turn_detection", turn_detection);
-    ESP_LOGI(TAG, "turn_detection configured: threshold=0.9, silence=1500ms (no AEC, high threshold)");
 
-    cJSON *tools = cJSON_CreateArray();
-    cJSON_AddItemToObject(session, "tools", tools);
-
-    class_t *iter = s_classes;
-    while (iter) {
-        cJSON *tool = cJSON_CreateObject();
-        cJSON_AddItemToArray(tools, tool);
-        cJSON_AddStringToObject(tool, "type", "function");
-        cJSON_AddStringToObject(tool, "name", iter->name);
-        cJSON_AddStringToObject(tool, "description", iter->desc);
-        cJSON *parameters = cJSON_CreateObject();
-        cJSON_AddItemToObject(tool, "parameters", parameters);
-        cJSON_AddStringToObject(parameters, "type", "object");
-        cJSON *properties = cJSON_CreateObject();
-        cJSON_AddItemToObject(parameters, "properties", properties);
-        int require_num = 0;
-        for (int i = 0; i < iter->attr_num; i++) {
-            attribute_t *attr = &iter->attr_list[i];
-            cJSON *prop = cJSON_CreateObject();
-            cJSON_AddItemToObject(properties, attr->name, prop);
-            cJSON_AddStringToObject(prop, "type", get_attr_type(attr->type));
-            cJSON_AddStringToObject(prop, "description", attr->desc);
-            if (attr->type == ATTRIBUTE_TYPE_PARENT) {
-                add_parent_attribute(prop, attr);
-            }
-            if (attr->required) {
-                require_num++;
-            }
-        }
-        if (require_num) {
-            cJSON *requires = cJSON_CreateArray();
-            for (int i = 0; i < iter->attr_num; i++) {
-                attribute_t *attr = &iter->attr_list[i];
-                if (attr->required) {
-                    cJSON_AddItemToArray(requires, cJSON_CreateString(attr->name));
-                }
-            }
-            cJSON_AddItemToObject(parameters, "required", requires);
-        }
-        iter = iter->next;
-    }
-    char *json_string = cJSON_Print(root);
-    if (json_string) {
-        ESP_LOGI(TAG, "Sending function descriptions");
-        esp_webrtc_send_custom_data(s_webrtc, ESP_WEBRTC_CUSTOM_DATA_VIA_DATA_CHANNEL,
-                                    (uint8_t *)json_string, strlen(json_string));
-        free(json_string);
+    if (azure_tools_call(name, name_len, args, args_len) == ESP_ERR_NOT_FOUND) {
+        ESP_LOGW(TAG, "No function named %s", name);
     }
-    cJSON_Delete(root);
-    return 0;
 }
 
 // ============================================
-// Function Call Processing
+// WebRTC Data Handler
 // ============================================
 
-static int match_and_execute(cJSON *cur, attribute_t *attr)
+typedef void (*event_handler_t)(const rtc_event_t *event);
+
+static void emit_transcript(rtc_span_t span, bool partial)
 {
-    cJSON *attr_value = cJSON_GetObjectItemCaseSensitive(cur, attr->name);
-    if (!attr_value) {
-        if (attr->required) {
-            ESP_LOGW(TAG, "Missing required attribute: %s", attr->name);
-        }
-        return 0;
+    if (span.ptr == NULL) {
+        return;
     }
 
-    if (attr->type == ATTRIBUTE_TYPE_BOOL && cJSON_IsBool(attr_value)) {
-        attr->b_state = cJSON_IsTrue(attr_value);
-        if (attr->control) {
-            attr->control(attr);
-        }
-    } else if (attr->type == ATTRIBUTE_TYPE_INT && cJSON_IsNumber(attr_value)) {
-        attr->i_value = attr_value->valueint;
-        if (attr->control) {
-            attr->control(attr);
-        }
-    } else if (attr->type == ATTRIBUTE_TYPE_PARENT && cJSON_IsObject(attr_value)) {
-        for (int j = 0; j < attr->attr_num; j++) {
-            attribute_t *sub_attr = &attr->attr_list[j];
-            match_and_execute(attr_value, sub_attr);
-        }
-    } else {
-        ESP_LOGW(TAG, "Unhandled attribute type or invalid value for: %s", attr->name);
+    char inline_buf[INLINE_TEXT_SIZE];
+    char *text = span.len < sizeof(inline_buf) ? inline_buf : malloc(span.len + 1);
+    if (text == NULL) {
+        return;
+    }
+    rtc_span_unescape(span, text, span.len + 1);
+    if (!partial) {
+        ESP_LOGI(TAG, "Transcript: %s", text);
     }
 
-    return 1;
+    // Notify callback
+    if (s_event_cb) {
+        webrtc_azure_event_t event = {
+            .type = WEBRTC_AZURE_EVENT_TRANSCRIPT,
+            .transcript = {
+                .text = text,
+                .partial = partial,
+            },
+        };
+        s_event_cb(&event, s_user_data);
+    }
+    if (text != inline_buf) {
+        free(text);
+    }
 }
 
-static int process_json(const char *json_data)
+static void on_transcript_delta(const rtc_event_t *event)
 {
-    cJSON *root = cJSON_Parse(json_data);
-    if (!root) {
-        ESP_LOGW(TAG, "Error parsing JSON data");
-        return -1;
-    }
-
-    const cJSON *type = cJSON_GetObjectItemCaseSensitive(root, "type");
-    if (!cJSON_IsString(type) || strcmp(type->valuestring, "response.function_call_arguments.done") != 0) {
-        cJSON_Delete(root);
-        return 0;
-    }
+    emit_transcript(event->delta, true);
+}
 
-    char *payload = cJSON_PrintUnformatted(root);
-    if (payload) {
-        ESP_LOGI(TAG, "Function Call: %s", payload);
-        free(payload);
-    }
+static void on_transcript_done(const rtc_event_t *event)
+{
+    emit_transcript(event->transcript, false);
+}
 
-    const cJSON *name = cJSON_GetObjectItemCaseSensitive(root, "name");
-    const cJSON *arguments = cJSON_GetObjectItemCaseSensitive(root, "arguments");
-    if (!cJSON_IsString(name) || !name->valuestring ||
-        !cJSON_IsString(arguments) || !arguments->valuestring) {
-        ESP_LOGW(TAG, "Invalid JSON format");
-        cJSON_Delete(root);
-        return -1;
+static void on_error(const rtc_event_t *event)
+{
+    char message[128] = "unknown";
+    rtc_json_iter_t it;
+    rtc_span_t key;
+    rtc_json_value_t value;
+
+    rtc_json_iter_init(&it, event->error.ptr, event->error.len);
+    while (rtc_json_iter_next(&it, &key, &value)) {
+        if (value.kind == RTC_JSON_STRING && rtc_span_equals(key, "message")) {
+            rtc_span_unescape(value.span, message, sizeof(message));
+        }
     }
+    ESP_LOGE(TAG, "Server error: %s", message);
 
-    // Notify callback about function call
     if (s_event_cb) {
-        webrtc_azure_event_t event = {
-            .type = WEBRTC_AZURE_EVENT_FUNCTION_CALL,
-            .function_call = {
-                .name = name->valuestring,
-                .arguments = arguments->valuestring,
+        webrtc_azure_event_t evt = {
+            .type = WEBRTC_AZURE_EVENT_ERROR,
+            .error = {
+                .code = -1,
+                .message = message,
             },
         };
-        s_event_cb(&event, s_user_data);
+        s_event_cb(&evt, s_user_data);
     }
+}
 
-    cJSON *args_root = cJSON_Parse(arguments->valuestring);
-    if (!args_root) {
-        ESP_LOGW(TAG, "Error parsing arguments JSON");
-        cJSON_Delete(root);
-        return -1;
-    }
+/**
+ * @brief Stamp turn milestones from data channel server events
+ *
+ * Server VAD decides the end of user speech, so the turn starts on
+ * speech_stopped rather than on a local state change.
+ */
+static void on_speech_stopped(const rtc_event_t *event)
+{
+    latency_ledger_begin_turn(LATENCY_PROVIDER_WEBRTC);
+}
 
-    // Find and execute the corresponding class
-    class_t *iter = s_classes;
-    while (iter) {
-        if (strcmp(iter->name, name->valuestring) == 0) {
-            for (int i = 0; i < iter->attr_num; i++) {
-                attribute_t *attr = &iter->attr_list[i];
-                match_and_execute(args_root, attr);
-            }
-        }
-        iter = iter->next;
-    }
+static void on_committed(const rtc_event_t *event)
+{
+    latency_ledger_mark(LATENCY_MARK_COMMIT_SENT);
+}
 
-    cJSON_Delete(args_root);
-    cJSON_Delete(root);
-    return 0;
+static void on_audio_started(const rtc_event_t *event)
+{
+    latency_ledger_mark(LATENCY_MARK_FIRST_AUDIO_DELTA);
 }
 
-// ============================================
-// WebRTC Data Handler
-// ============================================
+static void on_response_done(const rtc_event_t *event)
+{
+    latency_ledger_mark(LATENCY_MARK_RESPONSE_DONE);
+}
 
-static int webrtc_data_handler(esp_webrtc_custom_data_via_t via, uint8_t *data, int size, void *ctx)
+static void on_audio_stopped(const rtc_event_t *event)
 {
-    // Process function calls
-    process_json((const char *)data);
+    latency_ledger_end_turn();
+}
 
-    // Extract and log transcripts
-    cJSON *root = cJSON_Parse((const char *)data);
-    if (!root) {
+// Transcripts are only taken from the events that carry them at the top
+// level; response.done and the *.done item events repeat them nested.
+static const event_handler_t s_handlers[RTC_EVENT_MAX] = {
+    [RTC_EVENT_ERROR]                 = on_error,
+    [RTC_EVENT_SPEECH_STOPPED]        = on_speech_stopped,
+    [RTC_EVENT_BUFFER_COMMITTED]      = on_committed,
+    [RTC_EVENT_INPUT_TRANSCRIPT_DONE] = on_transcript_done,
+    [RTC_EVENT_RESPONSE_DONE]         = on_response_done,
+    [RTC_EVENT_TRANSCRIPT_DELTA]      = on_transcript_delta,
+    [RTC_EVENT_TRANSCRIPT_DONE]       = on_transcript_done,
+    [RTC_EVENT_FUNCTION_ARGS_DONE]    = on_function_call,
+    [RTC_EVENT_AUDIO_STARTED]         = on_audio_started,
+    [RTC_EVENT_AUDIO_STOPPED]         = on_audio_stopped,
+};
+
+static int webrtc_data_handler(esp_webrtc_custom_data_via_t via, uint8_t *data, int size, void *ctx)
+{
+    rtc_event_t event;
+    if (size <= 0 || rtc_event_parse((const char *)data, (size_t)size, &event) != ESP_OK) {
+        ESP_LOGW(TAG, "Error parsing JSON data");
         return -1;
     }
 
-    char *payload = cJSON_PrintUnformatted(root);
-    if (payload) {
-        char *text = strstr(payload, "transcript\":");
-        if (text) {
-            text += strlen("transcript\":");
-            char *start = strchr(text, '"');
-            char *end = start ? strchr(start + 1, '"') : NULL;
-            if (end) {
-                start++;
-                int len = (int)(end - start);
-                char *transcript = malloc(len + 1);
-                if (transcript) {
-                    memcpy(transcript, start, len);
-                    transcript[len] = '\0';
-                    ESP_LOGI(TAG, "Transcript: %s", transcript);
-
-                    // Notify callback
-                    if (s_event_cb) {
-                        webrtc_azure_event_t event = {
-                            .type = WEBRTC_AZURE_EVENT_TRANSCRIPT,
-                            .transcript = {
-                                .text = transcript,
-                            },
-                        };
-                        s_event_cb(&event, s_user_data);
-                    }
-                    free(transcript);
-                }
-            }
-        }
-        free(payload);
+    if (event.type != RTC_EVENT_SPEECH_STOPPED) {
+        latency_ledger_mark(LATENCY_MARK_FIRST_SERVER_EVENT);
+    }
+    event_handler_t handler = s_handlers[event.type];
+    if (handler) {
+        handler(&event);
     }
-    cJSON_Delete(root);
     return 0;
 }
 
@@ -614,6 +355,61 @@ static int send_response(const char *text)
     return 0;
 }
 
+// ============================================
+// Uplink Rate Control
+// ============================================
+
+#ifdef CONFIG_RATE_CTRL_ENABLE
+static void rate_ctrl_reset(void)
+{
+    rate_ctrl_config_t cfg;
+    rate_ctrl_default_config(&cfg, false);
+    rate_ctrl_init(&s_rate_ctrl, &cfg);
+    memset(&s_rate_prev, 0, sizeof(s_rate_prev));
+    s_rate_prev_us = esp_timer_get_time();
+}
+
+/**
+ * @brief Feed the send statistics of one interval to the rate controller
+ *
+ * Runs in the pc_send task, so the bitrate changes between two frames and
+ * never after the stream is stopped. The default peer has no receiver
+ * report statistics; the controller then works from send failures, blocked
+ * sends and capture backlog alone.
+ */
+static void on_uplink_stats(esp_webrtc_stats_t *stats, void *ctx)
+{
+    int64_t now = esp_timer_get_time();
+    // Counters restart with every stream
+    if (stats->aud_send_frames < s_rate_prev.aud_send_frames) {
+        rate_ctrl_reset();
+    }
+    uint32_t interval_ms = (uint32_t)((now - s_rate_prev_us) / 1000);
+    rate_ctrl_sample_t sample = {
+        .interval_ms = interval_ms ? interval_ms : 1,
+        .sent_bytes = (stats->aud_send_bytes - s_rate_prev.aud_send_bytes) +
+                      (stats->vid_send_bytes - s_rate_prev.vid_send_bytes),
+        .send_fail = (stats->aud_send_fail - s_rate_prev.aud_send_fail) +
+                     (stats->vid_send_fail - s_rate_prev.vid_send_fail),
+        .backlog_frames = stats->send_backlog_max,
+        .block_ms = stats->send_block_max_ms,
+        .has_loss = (stats->peer.valid & ESP_PEER_STATS_LOSS) != 0,
+        .loss_permille = stats->peer.loss_permille,
+        .has_rtt = (stats->peer.valid & ESP_PEER_STATS_RTT) != 0,
+        .rtt_ms = stats->peer.rtt_ms,
+        .has_queue = (stats->peer.valid & ESP_PEER_STATS_SEND_QUEUE) != 0,
+        .queue_bytes = stats->peer.send_queue_bytes,
+    };
+    s_rate_prev = *stats;
+    s_rate_prev_us = now;
+
+    rate_ctrl_decision_t decision;
+    if (rate_ctrl_update(&s_rate_ctrl, &sample, &decision) == ESP_OK && decision.apply) {
+        esp_webrtc_set_bitrate((esp_webrtc_handle_t)ctx, decision.audio_bps, decision.video_bps);
+    }
+}
+#endif
+
 // ============================================
 // WebRTC Event Handler
 // ============================================
@@ -626,6 +422,10 @@ static int webrtc_event_handler(esp_webrtc_event_t *event, void *ctx)
         case ESP_WEBRTC_EVENT_CONNECTED:
             ESP_LOGI(TAG, "WebRTC connected");
             s_connected = true;
+            openai_token_session_up();
+#if CONFIG_WEBRTC_AZURE_CONNECT_CHIME
+            media_sys_play_chime();
+#endif
             if (s_event_cb) {
                 webrtc_azure_event_t evt = {.type = WEBRTC_AZURE_EVENT_CONNECTED};
                 s_event_cb(&evt, s_user_data);
@@ -693,15 +493,21 @@ esp_err_t webrtc_azure_init(webrtc_azure_config_t *config)
         ESP_LOGW(TAG, "No config provided, event callback not set");
     }
 
-    // Build function calling classes
-    ESP_LOGI(TAG, "Building function calling classes...");
-    build_classes();
+    if (rtc_event_router_init() != ESP_OK) {
+        ESP_LOGE(TAG, "Data channel event table not built");
+        return ESP_FAIL;
+    }
 
     // Build media system
     ESP_LOGI(TAG, "Building media system...");
     int media_ret = media_sys_buildup();
     ESP_LOGI(TAG, "media_sys_buildup returned: %d", media_ret);
 
+    // Prefetch the session token so the first start skips that round-trip
+    if (openai_token_start() != ESP_OK) {
+        ESP_LOGW(TAG, "Token prefetch not started, tokens will be fetched per session");
+    }
+
     s_initialized = true;
     ESP_LOGI(TAG, "Free heap after init: %lu bytes", esp_get_free_heap_size());
     ESP_LOGI(TAG, "WebRTC Azure module initialized successfully");
@@ -802,6 +608,12 @@ esp_err_t webrtc_azure_start(void)
     ESP_LOGI(TAG, "Setting event handler...");
     esp_webrtc_set_event_handler(s_webrtc, webrtc_event_handler, NULL);
 
+#ifdef CONFIG_RATE_CTRL_ENABLE
+    rate_ctrl_reset();
+    esp_webrtc_set_stats_handler(s_webrtc, CONFIG_RATE_CTRL_INTERVAL_MS, on_uplink_stats, s_webrtc);
+    ESP_LOGI(TAG, "Uplink rate control every %d ms", CONFIG_RATE_CTRL_INTERVAL_MS);
+#endif
+
     // Start WebRTC
     ESP_LOGI(TAG, "Calling esp_webrtc_start()...");
     ESP_LOGI(TAG, "Free heap before start: %lu bytes", esp_get_free_heap_size());
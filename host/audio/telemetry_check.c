@@ -0,0 +1,371 @@
+/**
+ * @file telemetry_check.c
+ * @brief Audio to UI telemetry: blocking under the display lock, and a stress test
+ *
+ * Paced run: a UI task renders one frame per refresh period while holding
+ * the display lock, as the LVGL task does, and a mic task and a player task
+ * publish one level per 60 ms audio frame. It runs twice: with the old path,
+ * where each audio frame took the display lock for up to 10 ms to set the
+ * level (ui_manager_update_audio_level), and with audio_telemetry, which
+ * the UI samples once per frame under the lock it already holds. Reported
+ * is how long the audio tasks spent publishing and how many levels were
+ * dropped on a lock timeout.
+ *
+ * Stress run: producers publish as fast as they can against a reader that
+ * reads in a loop. The mic word has one producer with a known level
+ * sequence, so every read's peak and frame count is checked exactly; the
+ * playback word has two producers contending for it, checked by count.
+ *
+ *   telemetry_check [--speed 1] [--render-ms 25] [--seconds 3] [--stress 200000]
+ *
+ * Exits non-zero when a publish blocks, a peak or a frame is lost.
+ */
+
+#include "audio_telemetry.h"
+#include "audio_pipeline.h"
+#include "host_shim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <getopt.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+
+#define LV_DEF_REFR_PERIOD      33
+#define OLD_LOCK_TIMEOUT_MS     10          // ui_manager_update_audio_level()
+#define BLOCKED_US              1000        // A publish taking longer has waited on something
+
+// ============================================
+// Private Types and Variables
+// ============================================
+
+typedef struct {
+    uint32_t frames;
+    uint32_t blocked;           // Publishes over BLOCKED_US
+    uint32_t dropped;           // Old path: lock timeouts
+    int64_t publish_us;
+    int64_t publish_us_max;
+} producer_result_t;
+
+static SemaphoreHandle_t s_lock;
+static bool s_use_channel;
+static uint32_t s_render_ms = 25;
+static volatile bool s_running;
+static volatile int s_tasks_done;
+static producer_result_t s_mic;
+static producer_result_t s_play;
+static uint32_t s_ui_frames;
+static uint32_t s_ui_samples;           // Frames that picked up new values
+static uint8_t s_shown_level;           // Old path: level set under the lock
+
+// ============================================
+// Paced Run
+// ============================================
+
+static void busy_us(int64_t us)
+{
+    int64_t end_us = esp_timer_get_time() + us;
+    while (esp_timer_get_time() < end_us) {
+    }
+}
+
+/**
+ * @brief The LVGL task: one frame per refresh period under the display lock
+ */
+static void ui_task(void *arg)
+{
+    int64_t next_us = esp_timer_get_time();
+    while (s_running) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        if (s_use_channel) {
+            audio_telemetry_t t;
+            if (audio_telemetry_read(&t)) {
+                s_ui_samples++;
+            }
+        }
+        busy_us((int64_t)s_render_ms * 1000);
+        s_ui_frames++;
+        xSemaphoreGive(s_lock);
+
+        next_us += LV_DEF_REFR_PERIOD * 1000;
+        int64_t now = esp_timer_get_time();
+        if (next_us > now) {
+            host_clock_sleep_us(next_us - now);
+        } else {
+            next_us = now;
+        }
+    }
+    s_tasks_done++;
+    vTaskDelete(NULL);
+}
+
+static void publish(producer_result_t *r, bool mic, uint8_t level)
+{
+    int64_t start_us = esp_timer_get_time();
+    if (s_use_channel) {
+        if (mic) {
+            audio_telemetry_publish_mic(level, VAD_STATE_VOICE);
+        } else {
+            audio_telemetry_publish_play(level, true, r->frames * AUDIO_FRAME_MS);
+        }
+    } else if (xSemaphoreTake(s_lock, pdMS_TO_TICKS(OLD_LOCK_TIMEOUT_MS)) == pdTRUE) {
+        s_shown_level = level;
+        xSemaphoreGive(s_lock);
+    } else {
+        r->dropped++;
+    }
+    int64_t us = esp_timer_get_time() - start_us;
+    r->frames++;
+    r->publish_us += us;
+    if (us > r->publish_us_max) {
+        r->publish_us_max = us;
+    }
+    if (us > BLOCKED_US) {
+        r->blocked++;
+    }
+}
+
+/**
+ * @brief Recorder or player task: one level per audio frame
+ */
+static void audio_task(void *arg)
+{
+    bool mic = arg != NULL;
+    producer_result_t *r = mic ? &s_mic : &s_play;
+    int64_t next_us = esp_timer_get_time();
+    while (s_running) {
+        publish(r, mic, (uint8_t)(r->frames * 7 % 101));
+        next_us += AUDIO_FRAME_MS * 1000;
+        int64_t now = esp_timer_get_time();
+        if (next_us > now) {
+            host_clock_sleep_us(next_us - now);
+        }
+    }
+    s_tasks_done++;
+    vTaskDelete(NULL);
+}
+
+static void run_paced(bool use_channel, uint32_t seconds)
+{
+    memset(&s_mic, 0, sizeof(s_mic));
+    memset(&s_play, 0, sizeof(s_play));
+    s_ui_frames = 0;
+    s_ui_samples = 0;
+    s_use_channel = use_channel;
+    s_tasks_done = 0;
+    s_running = true;
+    // Audio above the UI, as on the device
+    xTaskCreate(ui_task, "LVGL", 4096, NULL, 2, NULL);
+    xTaskCreate(audio_task, "rec", 4096, (void *)1, 5, NULL);
+    xTaskCreate(audio_task, "play", 4096, NULL, 5, NULL);
+    host_clock_sleep_us((int64_t)seconds * 1000 * 1000);
+    s_running = false;
+    while (s_tasks_done < 3) {
+        host_clock_sleep_us(1000);
+    }
+}
+
+// ============================================
+// Stress Run
+// ============================================
+
+static _Atomic uint32_t s_mic_published;
+static _Atomic uint32_t s_mic_consumed;
+static _Atomic uint32_t s_play_published;
+static uint32_t s_stress_count;
+
+static uint8_t stress_level(uint32_t i)
+{
+    return (uint8_t)(i * 37 % 101);
+}
+
+/**
+ * @brief The one mic producer; stays under 256 frames ahead so counts are exact
+ */
+static void stress_mic_task(void *arg)
+{
+    for (uint32_t i = 1; i <= s_stress_count; i++) {
+        while (i - atomic_load(&s_mic_consumed) > 200) {
+            taskYIELD();
+        }
+        audio_telemetry_publish_mic(stress_level(i), (uint8_t)(i % 4));
+        atomic_store(&s_mic_published, i);
+    }
+    s_tasks_done++;
+    vTaskDelete(NULL);
+}
+
+static void stress_play_task(void *arg)
+{
+    for (uint32_t i = 1; i <= s_stress_count / 2; i++) {
+        audio_telemetry_publish_play((uint8_t)(i % 101), true, i);
+        atomic_fetch_add(&s_play_published, 1);
+    }
+    s_tasks_done++;
+    vTaskDelete(NULL);
+}
+
+static const char *run_stress(uint32_t *reads)
+{
+    // Start from level 0: a read restarts the peak at the latest level
+    audio_telemetry_t t;
+    audio_telemetry_publish_mic(0, VAD_STATE_SILENCE);
+    audio_telemetry_read(&t);
+    uint8_t floor = 0;
+    uint32_t seen = 0;
+    uint32_t play_frames = 0;
+    const char *why = NULL;
+
+    atomic_store(&s_mic_published, 0);
+    atomic_store(&s_mic_consumed, 0);
+    atomic_store(&s_play_published, 0);
+    s_tasks_done = 0;
+    xTaskCreate(stress_mic_task, "rec", 4096, NULL, 5, NULL);
+    xTaskCreate(stress_play_task, "play1", 4096, NULL, 5, NULL);
+    xTaskCreate(stress_play_task, "play2", 4096, NULL, 5, NULL);
+
+    *reads = 0;
+    bool last = false;
+    while (!last) {
+        // One more read after every producer finished
+        last = s_tasks_done == 3;
+        uint32_t published = atomic_load(&s_mic_published);
+        bool fresh = audio_telemetry_read(&t);
+        if (!fresh && !last) {
+            taskYIELD();
+        }
+        (*reads)++;
+        play_frames += t.play_frames;
+
+        // Every publish in (seen, seen + frames] is folded into this read
+        uint8_t expect = floor;
+        for (uint32_t i = seen + 1; i <= seen + t.mic_frames; i++) {
+            expect = stress_level(i) > expect ? stress_level(i) : expect;
+        }
+        if (seen + t.mic_frames < published) {
+            why = "mic frames lost";
+        } else if (t.mic_level != expect) {
+            why = "mic peak wrong";
+        } else if (t.mic_frames && t.vad_state != (seen + t.mic_frames) % 4) {
+            why = "VAD state stale";
+        } else if (fresh != (t.mic_frames || t.play_frames)) {
+            why = "read flag wrong";
+        }
+        if (why) {
+            break;
+        }
+        if (t.mic_frames) {
+            seen += t.mic_frames;
+            floor = stress_level(seen);
+            atomic_store(&s_mic_consumed, seen);
+        }
+    }
+    while (s_tasks_done < 3) {
+        host_clock_sleep_us(1000);
+    }
+    if (why == NULL && seen != s_stress_count) {
+        why = "mic count wrong";
+    }
+    if (why == NULL && (play_frames & 0xFF) != (atomic_load(&s_play_published) & 0xFF)) {
+        why = "contended play publish lost";
+    }
+    return why;
+}
+
+// ============================================
+// Main
+// ============================================
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "usage: %s [--speed 1] [--render-ms 25] [--seconds 3] [--stress 200000]\n"
+            "  --speed N       virtual clock speed\n"
+            "  --render-ms N   UI frame time under the display lock\n"
+            "  --seconds N     length of each paced run\n"
+            "  --stress N      mic publishes in the stress run\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    double speed = 1;
+    uint32_t seconds = 3;
+    s_stress_count = 200000;
+    static const struct option long_opts[] = {
+        {"speed", required_argument, NULL, 's'},
+        {"render-ms", required_argument, NULL, 'r'},
+        {"seconds", required_argument, NULL, 't'},
+        {"stress", required_argument, NULL, 'n'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", long_opts, NULL)) != -1) {
+        switch (opt) {
+            case 's':
+                speed = atof(optarg);
+                break;
+            case 'r':
+                s_render_ms = (uint32_t)atoi(optarg);
+                break;
+            case 't':
+                seconds = (uint32_t)atoi(optarg);
+                break;
+            case 'n':
+                s_stress_count = (uint32_t)atoi(optarg);
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+    if (speed <= 0 || s_render_ms >= LV_DEF_REFR_PERIOD || seconds == 0 || s_stress_count < 2) {
+        usage(argv[0]);
+        return 2;
+    }
+    host_clock_set_speed(speed);
+    s_lock = xSemaphoreCreateMutex();
+
+    printf("UI frame %d ms with %lu ms under the display lock, audio frame %d ms, clock x%.1f\n",
+           LV_DEF_REFR_PERIOD, (unsigned long)s_render_ms, AUDIO_FRAME_MS, speed);
+    printf("%-8s %-5s %7s %8s %8s %13s %8s %10s\n", "path", "task", "frames", "blocked", "dropped",
+           "publish avg", "max", "ui frames");
+
+    int failed = 0;
+    for (int channel = 0; channel <= 1; channel++) {
+        run_paced(channel, seconds);
+        for (int mic = 1; mic >= 0; mic--) {
+            const producer_result_t *r = mic ? &s_mic : &s_play;
+            const char *why = NULL;
+            if (channel && r->blocked) {
+                why = "publish blocked";
+            }
+            char ui[32] = "";
+            if (mic) {
+                snprintf(ui, sizeof(ui), "%lu", (unsigned long)s_ui_frames);
+            }
+            printf("%-8s %-5s %7lu %8lu %8lu %10.1f us %5.2f ms %10s%s%s\n", mic ? (channel ? "channel" : "lock") : "",
+                   mic ? "mic" : "play", (unsigned long)r->frames, (unsigned long)r->blocked,
+                   (unsigned long)r->dropped, r->frames ? (double)r->publish_us / r->frames : 0.0,
+                   r->publish_us_max / 1000.0, ui, why ? "  FAIL: " : "", why ? why : "");
+            failed += why ? 1 : 0;
+        }
+        if (channel) {
+            printf("%-8s UI frames with new values: %lu of %lu\n", "", (unsigned long)s_ui_samples,
+                   (unsigned long)s_ui_frames);
+        }
+    }
+
+    uint32_t reads = 0;
+    int64_t start_us = esp_timer_get_time();
+    const char *why = run_stress(&reads);
+    printf("stress: %lu mic publishes (1 task), %lu play publishes (2 tasks), %lu reads in %.2f s%s%s\n",
+           (unsigned long)s_stress_count, (unsigned long)atomic_load(&s_play_published), (unsigned long)reads,
+           (esp_timer_get_time() - start_us) / 1e6, why ? "  FAIL: " : "  ok", why ? why : "");
+    failed += why ? 1 : 0;
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,529 @@
+/**
+ * @file congestion_main.c
+ * @brief Host simulation of uplink rate control over a constrained link
+ *
+ * Sends 20 ms Opus-sized frames through a stub esp_peer realization that
+ * models the uplink: a bottleneck queue drained at a scheduled capacity,
+ * random loss, and receiver reports (loss, RTT, send queue) once a second,
+ * exposed through esp_peer_get_stats() the way a realization with
+ * statistics would. Every control interval the same observations the
+ * firmware collects go to rate_ctrl, whose bitrate feeds the next frames.
+ * Runs on a simulated clock, so a minute of link time takes milliseconds.
+ *
+ *   congestion [--seconds 100] [--schedule 0:200,20:60,40:40/2,60:120,80:200]
+ *              [--bottleneck local|remote] [--queue-kb 8] [--base-rtt-ms 60]
+ *              [--jitter-ms 120] [--no-peer-stats] [--fixed-kbps N]
+ *              [--seed 1] [--report report.json] [--verbose]
+ *
+ * The schedule lists "second:kbps[/loss%]" steps of link capacity on the
+ * wire (RTP, SRTP, UDP and IP headers included). A local bottleneck is the
+ * device's own Wi-Fi transmit queue: a full queue refuses the send, which
+ * the sender sees even without peer statistics. A remote bottleneck drops
+ * silently in the network and only shows up in receiver reports.
+ *
+ * A frame stalls playback when it is lost or arrives later than the jitter
+ * buffer allows; consecutive stalled frames count as one stall.
+ */
+
+#include "esp_peer.h"
+#include "rate_ctrl.h"
+#include "host_shim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include "esp_log.h"
+
+#define FRAME_MS                20
+#define PACKET_OVERHEAD         50      // RTP 12 + SRTP 10 + UDP 8 + IPv4 20
+#define REPORT_INTERVAL_MS      1000    // Receiver report period
+#define QUEUE_SLOTS             4096
+#define MAX_STEPS               16
+#define MAX_FRAMES              (3600 * 1000 / FRAME_MS)
+
+// ============================================
+// Private Types and Variables
+// ============================================
+
+typedef struct {
+    uint32_t at_ms;
+    uint32_t cap_bps;
+    uint16_t loss_permille;
+} link_step_t;
+
+typedef struct {
+    uint32_t seconds;
+    link_step_t steps[MAX_STEPS];
+    int step_count;
+    bool remote;
+    uint32_t queue_bytes;
+    uint32_t base_rtt_ms;
+    uint32_t jitter_ms;
+    bool no_peer_stats;
+    uint32_t fixed_bps;
+    uint32_t seed;
+    const char *report_path;
+    bool verbose;
+} congestion_options_t;
+
+typedef struct {
+    uint32_t frame;
+    uint32_t bytes;                     // On the wire
+    uint32_t sent_ms;
+} packet_t;
+
+/**
+ * @brief Stub peer: the uplink from the device to the server
+ */
+typedef struct {
+    packet_t queue[QUEUE_SLOTS];
+    uint32_t head;
+    uint32_t count;
+    uint32_t queued_bytes;
+    double credit;                      // Bytes the link may still send this ms
+    uint32_t now_ms;
+    uint32_t rng;
+    // Receiver report state
+    uint32_t rr_received;
+    uint32_t rr_lost;
+    esp_peer_stats_t stats;
+} stub_peer_t;
+
+typedef struct {
+    uint32_t frames;
+    uint32_t send_fail;
+    uint32_t delivered;
+    uint32_t lost;                      // Dropped in the network or refused
+    uint32_t late;
+    uint32_t stalls;
+    uint32_t stall_ms;
+    uint64_t audio_bits;
+    uint32_t bitrate_changes;
+} sim_result_t;
+
+static congestion_options_t s_opts = {
+    .seconds = 100,
+    .base_rtt_ms = 60,
+    .jitter_ms = 120,
+    .seed = 1,
+};
+
+static const char *TAG = "CONGESTION";
+
+static stub_peer_t s_link;
+static uint32_t *s_frame_delay;         // One-way delay per frame, UINT32_MAX if lost
+static sim_result_t s_result;
+static uint32_t s_delay_p50;
+static uint32_t s_delay_p95;
+
+// ============================================
+// Link Model
+// ============================================
+
+static uint32_t rng_next(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+static const link_step_t *link_at(uint32_t ms)
+{
+    const link_step_t *step = &s_opts.steps[0];
+    for (int i = 1; i < s_opts.step_count && s_opts.steps[i].at_ms <= ms; i++) {
+        step = &s_opts.steps[i];
+    }
+    return step;
+}
+
+static void deliver(stub_peer_t *link, const packet_t *pkt, bool lost)
+{
+    if (lost) {
+        link->rr_lost++;
+        s_frame_delay[pkt->frame] = UINT32_MAX;
+        return;
+    }
+    link->rr_received++;
+    s_frame_delay[pkt->frame] = link->now_ms - pkt->sent_ms + s_opts.base_rtt_ms / 2;
+}
+
+/**
+ * @brief Advance the link by one millisecond
+ */
+static void link_tick(stub_peer_t *link)
+{
+    const link_step_t *step = link_at(link->now_ms);
+    link->credit += step->cap_bps / 8000.0;
+    while (link->count > 0 && link->credit >= link->queue[link->head].bytes) {
+        packet_t *pkt = &link->queue[link->head];
+        link->credit -= pkt->bytes;
+        link->queued_bytes -= pkt->bytes;
+        link->head = (link->head + 1) % QUEUE_SLOTS;
+        link->count--;
+        deliver(link, pkt, rng_next(&link->rng) % 1000 < step->loss_permille);
+    }
+    // An idle link does not bank capacity
+    if (link->count == 0 && link->credit > PACKET_OVERHEAD) {
+        link->credit = PACKET_OVERHEAD;
+    }
+    link->now_ms++;
+
+    if (link->now_ms % REPORT_INTERVAL_MS == 0) {
+        uint32_t total = link->rr_received + link->rr_lost;
+        link->stats.valid = ESP_PEER_STATS_RTT | ESP_PEER_STATS_LOSS;
+        link->stats.loss_permille = total ? (uint16_t)(link->rr_lost * 1000 / total) : 0;
+        link->stats.packets_lost += link->rr_lost;
+        // RTT as seen by a report sent now: the queue ahead of it plus the path
+        link->stats.rtt_ms = s_opts.base_rtt_ms +
+                             (uint32_t)((uint64_t)link->queued_bytes * 8000 / step->cap_bps);
+        link->rr_received = 0;
+        link->rr_lost = 0;
+    }
+    if (!s_opts.remote) {
+        link->stats.valid |= ESP_PEER_STATS_SEND_QUEUE;
+        link->stats.send_queue_bytes = link->queued_bytes;
+    }
+}
+
+// ============================================
+// Stub Peer Realization
+// ============================================
+
+static int stub_open(esp_peer_cfg_t *cfg, esp_peer_handle_t *peer)
+{
+    *peer = &s_link;
+    return ESP_PEER_ERR_NONE;
+}
+
+static int stub_send_audio(esp_peer_handle_t peer, esp_peer_audio_frame_t *frame)
+{
+    stub_peer_t *link = (stub_peer_t *)peer;
+    uint32_t bytes = (uint32_t)frame->size + PACKET_OVERHEAD;
+    packet_t pkt = { .frame = frame->pts / FRAME_MS, .bytes = bytes, .sent_ms = link->now_ms };
+    if (link->queued_bytes + bytes > s_opts.queue_bytes || link->count == QUEUE_SLOTS) {
+        if (s_opts.remote) {
+            // Router tail drop: the sender never knows
+            link->stats.packets_sent++;
+            deliver(link, &pkt, true);
+            return ESP_PEER_ERR_NONE;
+        }
+        s_frame_delay[pkt.frame] = UINT32_MAX;
+        return ESP_PEER_ERR_OVER_LIMITED;
+    }
+    link->queue[(link->head + link->count) % QUEUE_SLOTS] = pkt;
+    link->count++;
+    link->queued_bytes += bytes;
+    link->stats.packets_sent++;
+    return ESP_PEER_ERR_NONE;
+}
+
+static int stub_get_stats(esp_peer_handle_t peer, esp_peer_stats_t *stats)
+{
+    *stats = ((stub_peer_t *)peer)->stats;
+    return ESP_PEER_ERR_NONE;
+}
+
+static int stub_close(esp_peer_handle_t peer)
+{
+    return ESP_PEER_ERR_NONE;
+}
+
+static const esp_peer_ops_t s_stub_ops = {
+    .open = stub_open,
+    .send_audio = stub_send_audio,
+    .close = stub_close,
+};
+
+// ============================================
+// Simulation
+// ============================================
+
+static void run(void)
+{
+    s_link.rng = s_opts.seed ? s_opts.seed : 1;
+    if (!s_opts.no_peer_stats) {
+        esp_peer_register_stats(&s_stub_ops, stub_get_stats);
+    }
+    esp_peer_cfg_t peer_cfg = { 0 };
+    esp_peer_handle_t peer = NULL;
+    ESP_ERROR_CHECK(esp_peer_open(&peer_cfg, &s_stub_ops, &peer));
+
+    rate_ctrl_config_t cfg;
+    rate_ctrl_default_config(&cfg, false);
+    rate_ctrl_t ctrl;
+    ESP_ERROR_CHECK(rate_ctrl_init(&ctrl, &cfg));
+    uint32_t bitrate = s_opts.fixed_bps ? s_opts.fixed_bps : cfg.audio_start_bps;
+
+    uint8_t payload[1500] = { 0 };
+    uint32_t interval_bytes = 0;
+    uint32_t interval_fail = 0;
+    uint32_t end_ms = s_opts.seconds * 1000;
+    for (uint32_t ms = 0; ms < end_ms; ms++) {
+        if (ms % FRAME_MS == 0) {
+            uint32_t size = bitrate * FRAME_MS / 8000;
+            esp_peer_audio_frame_t frame = {
+                .pts = ms,
+                .data = payload,
+                .size = (int)(size < sizeof(payload) ? size : sizeof(payload)),
+            };
+            s_result.frames++;
+            s_result.audio_bits += (uint64_t)frame.size * 8;
+            if (esp_peer_send_audio(peer, &frame) == ESP_PEER_ERR_NONE) {
+                interval_bytes += frame.size;
+            } else {
+                interval_fail++;
+                s_result.send_fail++;
+            }
+        }
+        link_tick(&s_link);
+
+        if (s_opts.fixed_bps == 0 && (ms + 1) % CONFIG_RATE_CTRL_INTERVAL_MS == 0) {
+            // Same observations as on_uplink_stats() in webrtc_azure.c
+            esp_peer_stats_t peer_stats;
+            esp_peer_get_stats(peer, &peer_stats);
+            rate_ctrl_sample_t sample = {
+                .interval_ms = CONFIG_RATE_CTRL_INTERVAL_MS,
+                .sent_bytes = interval_bytes,
+                .send_fail = interval_fail,
+                .has_loss = (peer_stats.valid & ESP_PEER_STATS_LOSS) != 0,
+                .loss_permille = peer_stats.loss_permille,
+                .has_rtt = (peer_stats.valid & ESP_PEER_STATS_RTT) != 0,
+                .rtt_ms = peer_stats.rtt_ms,
+                .has_queue = (peer_stats.valid & ESP_PEER_STATS_SEND_QUEUE) != 0,
+                .queue_bytes = peer_stats.send_queue_bytes,
+            };
+            interval_bytes = 0;
+            interval_fail = 0;
+            rate_ctrl_decision_t d;
+            if (rate_ctrl_update(&ctrl, &sample, &d) == ESP_OK && d.apply) {
+                if (d.audio_bps != bitrate) {
+                    s_result.bitrate_changes++;
+                }
+                bitrate = d.audio_bps;
+                printf("t=%6.1f s  link %4lu kbps  audio %3lu kbps  %-8s %-12s queue %5lu B\n",
+                       (ms + 1) / 1000.0, (unsigned long)(link_at(ms)->cap_bps / 1000),
+                       (unsigned long)(bitrate / 1000), rate_ctrl_action_name(d.action),
+                       d.reason ? d.reason : "-", (unsigned long)s_link.queued_bytes);
+            }
+        }
+    }
+    // Let the queue drain so the last frames are judged
+    for (uint32_t ms = 0; ms < 5000 && s_link.count; ms++) {
+        link_tick(&s_link);
+    }
+    esp_peer_close(peer);
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static void score(void)
+{
+    uint32_t limit = s_opts.base_rtt_ms / 2 + s_opts.jitter_ms;
+    uint32_t *delays = malloc(sizeof(uint32_t) * (s_result.frames + 1));
+    uint32_t n = 0;
+    bool stalled = false;
+    for (uint32_t i = 0; i < s_result.frames; i++) {
+        uint32_t delay = s_frame_delay[i];
+        bool bad = delay == UINT32_MAX || delay > limit;
+        if (delay == UINT32_MAX) {
+            s_result.lost++;
+        } else {
+            s_result.delivered++;
+            s_result.late += delay > limit;
+            if (delays) {
+                delays[n++] = delay;
+            }
+        }
+        if (bad) {
+            s_result.stall_ms += FRAME_MS;
+            s_result.stalls += !stalled;
+        }
+        stalled = bad;
+    }
+    if (delays && n) {
+        qsort(delays, n, sizeof(uint32_t), cmp_u32);
+        s_delay_p50 = delays[n / 2];
+        s_delay_p95 = delays[(uint64_t)n * 95 / 100];
+    }
+    free(delays);
+}
+
+// ============================================
+// Report
+// ============================================
+
+static void write_report(FILE *out, bool json)
+{
+    uint32_t avg_kbps = s_result.frames ? (uint32_t)(s_result.audio_bits / s_result.frames / FRAME_MS) : 0;
+    const char *mode = s_opts.fixed_bps ? "fixed" : (s_opts.no_peer_stats ? "adaptive (local signals)" : "adaptive");
+    if (!json) {
+        fprintf(out, "\n===== Congestion Report =====\n");
+        fprintf(out, "%s bitrate, %s bottleneck, %lu s, queue %lu B, jitter buffer %lu ms\n", mode,
+                s_opts.remote ? "remote" : "local", (unsigned long)s_opts.seconds,
+                (unsigned long)s_opts.queue_bytes, (unsigned long)s_opts.jitter_ms);
+        fprintf(out, "frames %lu: delivered %lu, lost %lu (%lu refused by the peer), late %lu\n",
+                (unsigned long)s_result.frames, (unsigned long)s_result.delivered, (unsigned long)s_result.lost,
+                (unsigned long)s_result.send_fail, (unsigned long)s_result.late);
+        fprintf(out, "stalls %lu, %lu ms of %lu ms stalled\n", (unsigned long)s_result.stalls,
+                (unsigned long)s_result.stall_ms, (unsigned long)(s_opts.seconds * 1000));
+        fprintf(out, "one-way delay p50 %lu ms, p95 %lu ms\n", (unsigned long)s_delay_p50,
+                (unsigned long)s_delay_p95);
+        fprintf(out, "audio avg %lu kbps, %lu bitrate changes\n", (unsigned long)avg_kbps,
+                (unsigned long)s_result.bitrate_changes);
+        return;
+    }
+    fprintf(out, "{\n  \"mode\": \"%s\",\n  \"bottleneck\": \"%s\",\n  \"seconds\": %lu,\n", mode,
+            s_opts.remote ? "remote" : "local", (unsigned long)s_opts.seconds);
+    fprintf(out, "  \"frames\": %lu,\n  \"delivered\": %lu,\n  \"lost\": %lu,\n  \"refused\": %lu,\n"
+            "  \"late\": %lu,\n", (unsigned long)s_result.frames, (unsigned long)s_result.delivered,
+            (unsigned long)s_result.lost, (unsigned long)s_result.send_fail, (unsigned long)s_result.late);
+    fprintf(out, "  \"stalls\": %lu,\n  \"stall_ms\": %lu,\n  \"delay_p50_ms\": %lu,\n  \"delay_p95_ms\": %lu,\n",
+            (unsigned long)s_result.stalls, (unsigned long)s_result.stall_ms, (unsigned long)s_delay_p50,
+            (unsigned long)s_delay_p95);
+    fprintf(out, "  \"audio_avg_kbps\": %lu,\n  \"bitrate_changes\": %lu\n}\n", (unsigned long)avg_kbps,
+            (unsigned long)s_result.bitrate_changes);
+}
+
+// ============================================
+// Main
+// ============================================
+
+static bool parse_schedule(const char *spec)
+{
+    s_opts.step_count = 0;
+    const char *p = spec;
+    while (*p && s_opts.step_count < MAX_STEPS) {
+        char *end;
+        unsigned long at = strtoul(p, &end, 10);
+        if (*end != ':') {
+            return false;
+        }
+        unsigned long kbps = strtoul(end + 1, &end, 10);
+        double loss = 0.0;
+        if (*end == '/') {
+            loss = strtod(end + 1, &end);
+        }
+        if (kbps == 0 || loss < 0.0 || loss > 100.0 || (*end != ',' && *end != '\0')) {
+            return false;
+        }
+        link_step_t *step = &s_opts.steps[s_opts.step_count++];
+        step->at_ms = (uint32_t)at * 1000;
+        step->cap_bps = (uint32_t)kbps * 1000;
+        step->loss_permille = (uint16_t)(loss * 10.0 + 0.5);
+        p = *end ? end + 1 : end;
+    }
+    return s_opts.step_count > 0 && *p == '\0';
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --seconds N           simulated time (default 100)\n"
+            "  --schedule S          link steps \"second:kbps[/loss%%],...\"\n"
+            "                        (default 0:200,20:60,40:40/2,60:120,80:200)\n"
+            "  --bottleneck WHERE    local (device transmit queue, default) or remote (network)\n"
+            "  --queue-kb N          bottleneck queue size (default 8 local, 32 remote)\n"
+            "  --base-rtt-ms N       round trip time of the empty path (default 60)\n"
+            "  --jitter-ms N         receiver jitter buffer (default 120)\n"
+            "  --no-peer-stats       peer without statistics, as the default realization\n"
+            "  --fixed-kbps N        no rate control, constant audio bitrate\n"
+            "  --seed N              loss pattern seed (default 1)\n"
+            "  --report PATH         write the report as JSON\n"
+            "  --verbose             controller logs\n", prog);
+}
+
+static bool parse_args(int argc, char **argv)
+{
+    static const struct option long_opts[] = {
+        { "seconds",       required_argument, NULL, 'n' },
+        { "schedule",      required_argument, NULL, 'S' },
+        { "bottleneck",    required_argument, NULL, 'b' },
+        { "queue-kb",      required_argument, NULL, 'q' },
+        { "base-rtt-ms",   required_argument, NULL, 'r' },
+        { "jitter-ms",     required_argument, NULL, 'J' },
+        { "no-peer-stats", no_argument,       NULL, 'N' },
+        { "fixed-kbps",    required_argument, NULL, 'f' },
+        { "seed",          required_argument, NULL, 'x' },
+        { "report",        required_argument, NULL, 'j' },
+        { "verbose",       no_argument,       NULL, 'v' },
+        { "help",          no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+
+    if (!parse_schedule("0:200,20:60,40:40/2,60:120,80:200")) {
+        return false;
+    }
+    int c;
+    while ((c = getopt_long(argc, argv, "n:S:b:q:r:J:Nf:x:j:vh", long_opts, NULL)) != -1) {
+        switch (c) {
+        case 'n': s_opts.seconds = (uint32_t)atol(optarg); break;
+        case 'S':
+            if (!parse_schedule(optarg)) {
+                fprintf(stderr, "bad schedule: %s\n", optarg);
+                return false;
+            }
+            break;
+        case 'b':
+            if (strcmp(optarg, "local") != 0 && strcmp(optarg, "remote") != 0) {
+                return false;
+            }
+            s_opts.remote = strcmp(optarg, "remote") == 0;
+            break;
+        case 'q': s_opts.queue_bytes = (uint32_t)atol(optarg) * 1024; break;
+        case 'r': s_opts.base_rtt_ms = (uint32_t)atol(optarg); break;
+        case 'J': s_opts.jitter_ms = (uint32_t)atol(optarg); break;
+        case 'N': s_opts.no_peer_stats = true; break;
+        case 'f': s_opts.fixed_bps = (uint32_t)atol(optarg) * 1000; break;
+        case 'x': s_opts.seed = (uint32_t)atol(optarg); break;
+        case 'j': s_opts.report_path = optarg; break;
+        case 'v': s_opts.verbose = true; break;
+        default:
+            return false;
+        }
+    }
+    if (s_opts.queue_bytes == 0) {
+        // Wi-Fi transmit buffers hold about 30 Opus packets; routers buffer more
+        s_opts.queue_bytes = (s_opts.remote ? 32 : 8) * 1024;
+    }
+    return s_opts.seconds > 0 && s_opts.seconds * 1000 / FRAME_MS <= MAX_FRAMES;
+}
+
+int main(int argc, char **argv)
+{
+    if (!parse_args(argc, argv)) {
+        usage(argv[0]);
+        return 2;
+    }
+    host_log_set_level(s_opts.verbose ? ESP_LOG_DEBUG : ESP_LOG_WARN);
+
+    s_frame_delay = malloc(sizeof(uint32_t) * (s_opts.seconds * 1000 / FRAME_MS + 1));
+    if (s_frame_delay == NULL) {
+        ESP_LOGE(TAG, "❌ No memory for %lu s", (unsigned long)s_opts.seconds);
+        return 1;
+    }
+    // Frames never sent (cut off at the end) count as lost
+    memset(s_frame_delay, 0xff, sizeof(uint32_t) * (s_opts.seconds * 1000 / FRAME_MS + 1));
+
+    run();
+    score();
+
+    write_report(stdout, false);
+    if (s_opts.report_path) {
+        FILE *f = fopen(s_opts.report_path, "w");
+        if (f != NULL) {
+            write_report(f, true);
+            fclose(f);
+        }
+    }
+    free(s_frame_delay);
+    return 0;
+}
@@ -0,0 +1,465 @@
+/**
+ * @file loop_check.c
+ * @brief LVGL task pacing against a headless stand-in of LVGL's timer core
+ *
+ * LVGL is not part of the host build, so this models what the LVGL task
+ * sees from LVGL 9: lv_timer_handler() running due timers and returning the
+ * time to the next one (LV_NO_TIMER_READY when all are paused), the
+ * display refresh timer that pauses itself after each refresh and is
+ * resumed by lv_inv_area(), and the animation timer that runs only while
+ * an animation does. A refresh renders the invalidated area in bands of one
+ * draw buffer and flushes each band; rendering the next band overlaps the
+ * transfer of the previous one, as with the two draw buffers.
+ *
+ * Each scenario runs twice: with the old polling loop (2 ms tick, sleep
+ * 1-500 ms) and with display_loop as display_init.c uses it. Another task
+ * changes the UI under the lock like ui_manager does. Reported are loop
+ * passes and tick interrupts per second, the share of time awake, the frame
+ * telemetry of display_loop, and how long a change took to reach a frame.
+ *
+ *   loop_check [--speed 4] [--render-ns-px 50] [--qspi-mhz 40] [--spike 20]
+ *
+ * Rendering is a busy wait on the virtual clock, so a host that preempts
+ * the thread stretches frames the scenario did not make slow. The stand-in
+ * times every frame around display_loop's own measurement and counts those
+ * stalls; late frames are checked to lie between the slow frames and the
+ * slow frames plus the stalls, and change latency on the average.
+ *
+ * Exits non-zero when the event-driven loop polls while idle, renders
+ * changes late, or misses or invents late frames.
+ */
+
+#include "display_loop.h"
+#include "host_shim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+
+// components/display/include/display_init.h
+#define DISPLAY_LVGL_BUF_HEIGHT 30
+
+#define LV_DEF_REFR_PERIOD      33
+#define LV_NO_TIMER_READY       0xFFFFFFFF
+#define OLD_TICK_MS             2           // Former lv_tick_inc() esp_timer period
+#define OLD_DELAY_MAX_MS        500
+
+#define CHANGE_LATENCY_MAX_MS   5           // Event-driven: change to refresh start, on average
+
+// ============================================
+// Private Types and Variables
+// ============================================
+
+typedef enum {
+    ACTION_CAPTION,     // Transcript line changed
+    ACTION_ORB,         // Listening orb animation started
+} action_t;
+
+typedef struct {
+    const char *name;
+    const char *what;
+    uint32_t duration_ms;
+    uint32_t clock_ms;          // App timer redrawing the clock, 0 for none
+    action_t action;
+    uint32_t action_every_ms;   // UI task changes, 0 for none
+    uint32_t anim_ms;           // Orb animation length
+    uint32_t spike_every;       // Every Nth animation frame renders --spike times slower
+} scenario_t;
+
+typedef struct {
+    uint32_t period_ms;
+    uint32_t last_run;
+    bool paused;
+    void (*cb)(void);
+} stand_in_timer_t;
+
+typedef struct {
+    int32_t x1;
+    int32_t y1;
+    int32_t x2;
+    int32_t y2;
+} area_t;
+
+typedef struct {
+    uint32_t passes;
+    uint64_t awake_us;
+    uint32_t changes;
+    uint64_t latency_us;
+    uint32_t latency_us_max;
+    uint32_t spikes;
+    uint32_t stalls;            // Frames over the period that were not slow: host preemption
+    display_loop_stats_t loop;
+} run_result_t;
+
+static const scenario_t s_scenarios[] = {
+    {"idle", "static page", 5000, 0, ACTION_CAPTION, 0, 0, 0},
+    {"clock", "clock redrawn every second", 5000, 1000, ACTION_CAPTION, 0, 0, 0},
+    {"caption", "transcript line every 250 ms", 5000, 0, ACTION_CAPTION, 250, 0, 0},
+    {"orb", "3 s listening animation", 4000, 0, ACTION_ORB, 0, 3000, 0},
+    {"jank", "animation, every 10th frame slow", 4000, 0, ACTION_ORB, 0, 3000, 10},
+};
+
+#define SCENARIO_COUNT (sizeof(s_scenarios) / sizeof(s_scenarios[0]))
+
+static const area_t s_area_clock = {150, 410, 315, 440};
+static const area_t s_area_caption = {40, 330, 425, 420};
+static const area_t s_area_orb = {113, 113, 352, 352};
+
+enum { TIMER_CLOCK, TIMER_ANIM, TIMER_REFR, TIMER_COUNT };
+
+static stand_in_timer_t s_timers[TIMER_COUNT];
+static SemaphoreHandle_t s_lock;
+static const scenario_t *s_scenario;
+static bool s_event_driven;
+static volatile bool s_running;
+static volatile bool s_loop_done;
+static TaskHandle_t s_loop_task;
+
+static area_t s_inv;
+static bool s_inv_valid;
+static int64_t s_change_us;         // Oldest change not yet refreshed, 0 for none
+static int64_t s_anim_end_us;
+static uint32_t s_anim_frames;
+static int64_t s_transfer_end_us;
+static double s_render_ns_px = 50;
+static double s_bytes_per_us = 20;
+static uint32_t s_spike = 20;
+static run_result_t s_result;
+
+// ============================================
+// LVGL Stand-in
+// ============================================
+
+static uint32_t tick_get(void)
+{
+    uint32_t ms = (uint32_t)(esp_timer_get_time() / 1000);
+    // The old tick advanced in steps of the tick timer period
+    return s_event_driven ? ms : ms - ms % OLD_TICK_MS;
+}
+
+static void timer_resume(int id)
+{
+    s_timers[id].paused = false;
+}
+
+/**
+ * @brief lv_inv_area(): join into the pending area and resume the refresh timer
+ */
+static void inv_area(const area_t *area)
+{
+    if (!s_inv_valid) {
+        s_inv = *area;
+        s_inv_valid = true;
+    } else {
+        s_inv.x1 = area->x1 < s_inv.x1 ? area->x1 : s_inv.x1;
+        s_inv.y1 = area->y1 < s_inv.y1 ? area->y1 : s_inv.y1;
+        s_inv.x2 = area->x2 > s_inv.x2 ? area->x2 : s_inv.x2;
+        s_inv.y2 = area->y2 > s_inv.y2 ? area->y2 : s_inv.y2;
+    }
+    timer_resume(TIMER_REFR);
+}
+
+static void clock_timer_cb(void)
+{
+    inv_area(&s_area_clock);
+}
+
+static void anim_timer_cb(void)
+{
+    inv_area(&s_area_orb);
+    // The animation timer pauses once the last animation is deleted
+    if (esp_timer_get_time() >= s_anim_end_us) {
+        s_timers[TIMER_ANIM].paused = true;
+    }
+}
+
+/**
+ * @brief Rendering keeps the core busy; a sleep would overshoot short bands
+ */
+static void render_us(int64_t us)
+{
+    int64_t end_us = esp_timer_get_time() + us;
+    while (esp_timer_get_time() < end_us) {
+    }
+}
+
+/**
+ * @brief Display refresh timer: render and flush the pending area band by band
+ */
+static void refr_timer_cb(void)
+{
+    s_timers[TIMER_REFR].paused = true;
+    int64_t start_us = esp_timer_get_time();
+    display_loop_frame_begin();
+    if (!s_inv_valid) {
+        display_loop_frame_end(false);
+        return;
+    }
+    area_t area = s_inv;
+    s_inv_valid = false;
+    if (s_change_us) {
+        uint32_t latency_us = (uint32_t)(start_us - s_change_us);
+        s_result.latency_us += latency_us;
+        if (latency_us > s_result.latency_us_max) {
+            s_result.latency_us_max = latency_us;
+        }
+        s_change_us = 0;
+    }
+
+    double render_ns_px = s_render_ns_px;
+    bool spike = area.x1 == s_area_orb.x1 && s_scenario->spike_every &&
+                 ++s_anim_frames % s_scenario->spike_every == 0;
+    if (spike) {
+        render_ns_px *= s_spike;
+        s_result.spikes++;
+    }
+    int32_t w = area.x2 - area.x1 + 1;
+    for (int32_t y = area.y1; y <= area.y2; y += DISPLAY_LVGL_BUF_HEIGHT) {
+        int32_t h = area.y2 - y + 1 < DISPLAY_LVGL_BUF_HEIGHT ? area.y2 - y + 1 : DISPLAY_LVGL_BUF_HEIGHT;
+        render_us((int64_t)(w * h * render_ns_px / 1000));
+        // The other buffer is still being sent: wait for its transfer
+        int64_t now = esp_timer_get_time();
+        if (s_transfer_end_us > now) {
+            host_clock_sleep_us(s_transfer_end_us - now);
+            display_loop_flush_wait((uint32_t)(s_transfer_end_us - now));
+            now = s_transfer_end_us;
+        }
+        s_transfer_end_us = now + (int64_t)(w * h * 2 / s_bytes_per_us);
+    }
+    display_loop_frame_end(true);
+    // Timed around display_loop's measurement: any frame it counts late is counted here
+    if (!spike && esp_timer_get_time() - start_us > LV_DEF_REFR_PERIOD * 1000) {
+        s_result.stalls++;
+    }
+}
+
+/**
+ * @brief lv_timer_handler(): run due timers, return ms to the next one
+ */
+static uint32_t timer_handler(void)
+{
+    for (int i = 0; i < TIMER_COUNT; i++) {
+        stand_in_timer_t *t = &s_timers[i];
+        if (!t->paused && tick_get() - t->last_run >= t->period_ms) {
+            t->last_run = tick_get();
+            t->cb();
+        }
+    }
+    uint32_t next = LV_NO_TIMER_READY;
+    uint32_t now = tick_get();
+    for (int i = 0; i < TIMER_COUNT; i++) {
+        stand_in_timer_t *t = &s_timers[i];
+        if (!t->paused) {
+            uint32_t elapsed = now - t->last_run;
+            uint32_t remaining = elapsed >= t->period_ms ? 0 : t->period_ms - elapsed;
+            next = remaining < next ? remaining : next;
+        }
+    }
+    return next;
+}
+
+// ============================================
+// Tasks
+// ============================================
+
+static void lock(void)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+}
+
+static void unlock(void)
+{
+    xSemaphoreGive(s_lock);
+    if (s_event_driven) {
+        display_loop_wake();
+    }
+}
+
+/**
+ * @brief The LVGL task: the old polling loop or the display_init.c one
+ */
+static void loop_task(void *arg)
+{
+    display_loop_bind(LV_DEF_REFR_PERIOD);
+    while (s_running) {
+        lock();
+        int64_t start_us = esp_timer_get_time();
+        uint32_t next_ms = timer_handler();
+        s_result.awake_us += esp_timer_get_time() - start_us;
+        s_result.passes++;
+        unlock();
+        if (s_event_driven) {
+            display_loop_wait(next_ms == LV_NO_TIMER_READY ? DISPLAY_LOOP_WAIT_FOREVER : next_ms);
+        } else {
+            next_ms = next_ms > OLD_DELAY_MAX_MS ? OLD_DELAY_MAX_MS : (next_ms < 1 ? 1 : next_ms);
+            vTaskDelay(pdMS_TO_TICKS(next_ms));
+        }
+    }
+    display_loop_unbind();
+    s_loop_done = true;
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Change the UI under the lock, as ui_manager does from its own task
+ */
+static void ui_change(action_t action)
+{
+    lock();
+    if (s_change_us == 0) {
+        s_change_us = esp_timer_get_time();
+    }
+    s_result.changes++;
+    if (action == ACTION_ORB) {
+        s_anim_end_us = esp_timer_get_time() + (int64_t)s_scenario->anim_ms * 1000;
+        s_anim_frames = 0;
+        s_timers[TIMER_ANIM].last_run = tick_get() - LV_DEF_REFR_PERIOD;
+        timer_resume(TIMER_ANIM);
+    } else {
+        inv_area(&s_area_caption);
+    }
+    unlock();
+}
+
+static void run_scenario(const scenario_t *sc, bool event_driven)
+{
+    memset(&s_result, 0, sizeof(s_result));
+    memset(s_timers, 0, sizeof(s_timers));
+    s_timers[TIMER_CLOCK] = (stand_in_timer_t) {sc->clock_ms ? sc->clock_ms : 1000, tick_get(), sc->clock_ms == 0,
+                                                 clock_timer_cb};
+    s_timers[TIMER_ANIM] = (stand_in_timer_t) {LV_DEF_REFR_PERIOD, tick_get(), true, anim_timer_cb};
+    s_timers[TIMER_REFR] = (stand_in_timer_t) {LV_DEF_REFR_PERIOD, tick_get(), true, refr_timer_cb};
+    s_scenario = sc;
+    s_event_driven = event_driven;
+    s_inv_valid = false;
+    s_change_us = 0;
+    s_transfer_end_us = 0;
+    display_loop_reset_stats();
+
+    s_running = true;
+    s_loop_done = false;
+    xTaskCreate(loop_task, "LVGL", 8192, NULL, 2, &s_loop_task);
+
+    int64_t start_us = esp_timer_get_time();
+    if (sc->action == ACTION_ORB) {
+        host_clock_sleep_us(500 * 1000);
+        ui_change(ACTION_ORB);
+    }
+    while (esp_timer_get_time() - start_us < (int64_t)sc->duration_ms * 1000) {
+        if (sc->action_every_ms) {
+            host_clock_sleep_us((int64_t)sc->action_every_ms * 1000);
+            ui_change(sc->action);
+        } else {
+            host_clock_sleep_us(100 * 1000);
+        }
+    }
+    // Count only the scenario, not the wakeup that stops the task
+    display_loop_get_stats(&s_result.loop);
+    s_running = false;
+    xTaskNotifyGive(s_loop_task);
+    while (!s_loop_done) {
+        host_clock_sleep_us(1000);
+    }
+}
+
+// ============================================
+// Main
+// ============================================
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "usage: %s [--speed 4] [--render-ns-px 50] [--qspi-mhz 40] [--spike 20]\n"
+            "  --speed N          virtual clock speed\n"
+            "  --render-ns-px N   LVGL render cost per pixel\n"
+            "  --qspi-mhz N       panel clock (4 data lines)\n"
+            "  --spike N          render cost factor of the slow frames in \"jank\"\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    double speed = 4;
+    double qspi_mhz = 40;
+    static const struct option long_opts[] = {
+        {"speed", required_argument, NULL, 's'},
+        {"render-ns-px", required_argument, NULL, 'r'},
+        {"qspi-mhz", required_argument, NULL, 'q'},
+        {"spike", required_argument, NULL, 'k'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", long_opts, NULL)) != -1) {
+        switch (opt) {
+            case 's':
+                speed = atof(optarg);
+                break;
+            case 'r':
+                s_render_ns_px = atof(optarg);
+                break;
+            case 'q':
+                qspi_mhz = atof(optarg);
+                break;
+            case 'k':
+                s_spike = (uint32_t)atoi(optarg);
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+    if (speed <= 0 || s_render_ns_px <= 0 || qspi_mhz <= 0 || s_spike == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+    // 4 bits per clock
+    s_bytes_per_us = qspi_mhz / 2;
+    host_clock_set_speed(speed);
+    s_lock = xSemaphoreCreateMutex();
+
+    printf("refresh period %d ms, render %.0f ns/px, QSPI %.0f MHz, clock x%.1f\n", LV_DEF_REFR_PERIOD,
+           s_render_ns_px, qspi_mhz, speed);
+    printf("%-8s %-6s %8s %7s %7s %6s %13s %13s %7s %5s %5s %15s\n", "scenario", "loop", "passes/s", "tick/s",
+           "awake%", "frames", "frame avg/max", "render avg/mx", "wait ms", "late", "skip", "change->frame");
+
+    int failed = 0;
+    for (int i = 0; i < (int)SCENARIO_COUNT; i++) {
+        const scenario_t *sc = &s_scenarios[i];
+        for (int event_driven = 0; event_driven <= 1; event_driven++) {
+            run_scenario(sc, event_driven);
+            const run_result_t *r = &s_result;
+            const display_loop_stats_t *l = &r->loop;
+            double secs = sc->duration_ms / 1000.0;
+            char latency[32] = "-";
+            if (r->changes) {
+                snprintf(latency, sizeof(latency), "%.1f / %.1f ms", r->latency_us / 1000.0 / r->changes,
+                         r->latency_us_max / 1000.0);
+            }
+
+            const char *why = NULL;
+            if (event_driven) {
+                if (sc->clock_ms == 0 && sc->action_every_ms == 0 && sc->anim_ms == 0 && r->passes > 2) {
+                    why = "passes while idle";
+                } else if (r->changes && r->latency_us / r->changes > CHANGE_LATENCY_MAX_MS * 1000) {
+                    why = "changes rendered late";
+                } else if (l->frames_late < r->spikes || l->frames_late > r->spikes + r->stalls) {
+                    why = "late frames not matching slow frames";
+                }
+            }
+            printf("%-8s %-6s %8.1f %7d %7.2f %6lu %6.2f/%6.2f %6.2f/%6.2f %7.2f %5lu %5lu %15s%s%s\n",
+                   event_driven ? "" : sc->name, event_driven ? "event" : "poll", r->passes / secs,
+                   event_driven ? 0 : 1000 / OLD_TICK_MS, 100.0 * r->awake_us / (sc->duration_ms * 1000.0),
+                   (unsigned long)l->frames, l->frame_us_avg / 1000.0, l->frame_us_max / 1000.0,
+                   l->render_us_avg / 1000.0, l->render_us_max / 1000.0, l->flush_wait_us_avg / 1000.0,
+                   (unsigned long)l->frames_late, (unsigned long)l->frames_skipped, latency, why ? "  FAIL: " : "",
+                   why ? why : "");
+            failed += why ? 1 : 0;
+        }
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,324 @@
+/**
+ * @file round_check.c
+ * @brief Round-panel clipping against a headless stand-in of LVGL's refresh
+ *
+ * LVGL is not part of the host build, so this models what LVGL 9 does with
+ * invalidated areas in partial render mode: lv_inv_area() (screen clip, the
+ * LV_EVENT_INVALIDATE_AREA hook, dropping areas inside saved ones, the
+ * 32-entry buffer falling back to the full screen), joining overlapping
+ * areas at refresh, and splitting each area into parts that fit the draw
+ * buffer. The hook is the one display_init.c installs (display_round split
+ * and clip, shrinking bands with nothing on the circle to two pixels) or
+ * none, for the rectangular flush.
+ *
+ * For each update it reports areas, flushes, pixels rendered, bytes pushed
+ * over QSPI and the transfer time at the panel clock, and checks that every
+ * visible pixel of the invalidated rectangles is still redrawn. The corner
+ * update lies entirely off the circle and, clipped, must send no more than
+ * the two pixels each of its bands is shrunk to.
+ *
+ *   round_check [--band 30] [--buf-rows 30] [--qspi-mhz 40] [--flush-us 20]
+ *
+ * Exits non-zero when a visible pixel would not be redrawn or an update
+ * off the circle is still sent in full.
+ */
+
+#include "display_round.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+// components/display/include/display_init.h
+#define DISPLAY_H_RES           466
+#define DISPLAY_V_RES           466
+#define DISPLAY_LVGL_BUF_HEIGHT 30
+#define DISPLAY_ROUND_BAND      30
+
+#define INV_BUF_SIZE            32      // LV_INV_BUF_SIZE
+#define OFF_CIRCLE_PX           2       // display_round_min_area()
+
+// ============================================
+// Private Types and Variables
+// ============================================
+
+typedef struct {
+    const char *name;
+    const char *what;
+    display_round_area_t rects[4];
+    int rect_num;
+    bool off_circle;                    // Nothing visible: clipped, OFF_CIRCLE_PX per area at most
+} update_t;
+
+typedef struct {
+    int areas;
+    int flushes;
+    uint64_t px;
+    double transfer_ms;
+} refresh_result_t;
+
+// Redraws of the UI pages: a page change invalidates the whole screen
+static const update_t s_updates[] = {
+    {"page", "page change (full screen)", {{0, 0, 465, 465}}, 1},
+    {"orb", "listening orb 240x240", {{113, 113, 352, 352}}, 1},
+    {"caption", "transcript lines", {{40, 330, 425, 420}}, 1},
+    {"status", "status row and clock", {{60, 24, 405, 64}, {150, 410, 315, 440}}, 2},
+    {"corner", "area in a corner, off the circle", {{0, 0, 60, 60}}, 1, true},
+};
+
+#define UPDATE_COUNT (sizeof(s_updates) / sizeof(s_updates[0]))
+
+static display_round_area_t s_inv[INV_BUF_SIZE];
+static int s_inv_num;
+static bool s_inv_joined[INV_BUF_SIZE];
+static bool s_round;
+static uint8_t s_covered[DISPLAY_V_RES][DISPLAY_H_RES];
+
+// ============================================
+// LVGL Stand-in
+// ============================================
+
+static bool area_intersect(display_round_area_t *out, const display_round_area_t *a, const display_round_area_t *b)
+{
+    out->x1 = a->x1 > b->x1 ? a->x1 : b->x1;
+    out->y1 = a->y1 > b->y1 ? a->y1 : b->y1;
+    out->x2 = a->x2 < b->x2 ? a->x2 : b->x2;
+    out->y2 = a->y2 < b->y2 ? a->y2 : b->y2;
+    return out->x1 <= out->x2 && out->y1 <= out->y2;
+}
+
+static bool area_is_in(const display_round_area_t *in, const display_round_area_t *holder)
+{
+    return in->x1 >= holder->x1 && in->y1 >= holder->y1 && in->x2 <= holder->x2 && in->y2 <= holder->y2;
+}
+
+static bool area_is_on(const display_round_area_t *a, const display_round_area_t *b)
+{
+    return !(a->x1 > b->x2 + 1 || b->x1 > a->x2 + 1 || a->y1 > b->y2 + 1 || b->y1 > a->y2 + 1);
+}
+
+static int64_t area_size(const display_round_area_t *a)
+{
+    return (int64_t)(a->x2 - a->x1 + 1) * (a->y2 - a->y1 + 1);
+}
+
+static void inv_area(const display_round_area_t *area);
+
+// display_init.c: invalidate_area_cb
+static void invalidate_hook(display_round_area_t *area)
+{
+    display_round_area_t rest;
+    if (display_round_split(area, &rest)) {
+        inv_area(&rest);
+    }
+    if (!display_round_clip(area)) {
+        display_round_min_area(area);
+    }
+}
+
+// lv_inv_area()
+static void inv_area(const display_round_area_t *area)
+{
+    const display_round_area_t scr = {0, 0, DISPLAY_H_RES - 1, DISPLAY_V_RES - 1};
+    display_round_area_t com;
+    if (!area_intersect(&com, area, &scr)) {
+        return;
+    }
+    if (s_round) {
+        invalidate_hook(&com);
+    }
+    for (int i = 0; i < s_inv_num; i++) {
+        if (area_is_in(&com, &s_inv[i])) {
+            return;
+        }
+    }
+    if (s_inv_num < INV_BUF_SIZE) {
+        s_inv[s_inv_num++] = com;
+    } else {
+        s_inv[0] = scr;
+        s_inv_num = 1;
+    }
+}
+
+// lv_refr_join_area()
+static void join_areas(void)
+{
+    memset(s_inv_joined, 0, sizeof(s_inv_joined));
+    for (int in = 0; in < s_inv_num; in++) {
+        if (s_inv_joined[in]) {
+            continue;
+        }
+        for (int from = 0; from < s_inv_num; from++) {
+            if (s_inv_joined[from] || in == from || !area_is_on(&s_inv[in], &s_inv[from])) {
+                continue;
+            }
+            display_round_area_t joined = {
+                s_inv[in].x1 < s_inv[from].x1 ? s_inv[in].x1 : s_inv[from].x1,
+                s_inv[in].y1 < s_inv[from].y1 ? s_inv[in].y1 : s_inv[from].y1,
+                s_inv[in].x2 > s_inv[from].x2 ? s_inv[in].x2 : s_inv[from].x2,
+                s_inv[in].y2 > s_inv[from].y2 ? s_inv[in].y2 : s_inv[from].y2,
+            };
+            if (area_size(&joined) < area_size(&s_inv[in]) + area_size(&s_inv[from])) {
+                s_inv[in] = joined;
+                s_inv_joined[from] = true;
+            }
+        }
+    }
+}
+
+static void flush_part(const display_round_area_t *part, double bytes_per_us, double flush_us, refresh_result_t *res)
+{
+    int64_t px = area_size(part);
+    res->flushes++;
+    res->px += px;
+    res->transfer_ms += (flush_us + px * 2 / bytes_per_us) / 1000.0;
+    for (int32_t y = part->y1; y <= part->y2; y++) {
+        memset(&s_covered[y][part->x1], 1, part->x2 - part->x1 + 1);
+    }
+}
+
+// lv_refr_areas() / refr_area() in LV_DISPLAY_RENDER_MODE_PARTIAL
+static void refresh(int buf_rows, double bytes_per_us, double flush_us, refresh_result_t *res)
+{
+    const int64_t buf_px = (int64_t)DISPLAY_H_RES * buf_rows;
+    join_areas();
+    for (int i = 0; i < s_inv_num; i++) {
+        if (s_inv_joined[i]) {
+            continue;
+        }
+        const display_round_area_t *a = &s_inv[i];
+        int32_t w = a->x2 - a->x1 + 1;
+        int32_t max_row = (int32_t)(buf_px / w);
+        if (max_row > a->y2 - a->y1 + 1) {
+            max_row = a->y2 - a->y1 + 1;
+        }
+        res->areas++;
+        int32_t row = a->y1;
+        for (; row + max_row - 1 <= a->y2; row += max_row) {
+            display_round_area_t part = {a->x1, row, a->x2, row + max_row - 1};
+            flush_part(&part, bytes_per_us, flush_us, res);
+        }
+        if (row <= a->y2) {
+            display_round_area_t part = {a->x1, row, a->x2, a->y2};
+            flush_part(&part, bytes_per_us, flush_us, res);
+        }
+    }
+    s_inv_num = 0;
+}
+
+// ============================================
+// Checks
+// ============================================
+
+static bool run_update(const update_t *u, bool round, int buf_rows, double bytes_per_us, double flush_us,
+                       refresh_result_t *res)
+{
+    memset(res, 0, sizeof(*res));
+    memset(s_covered, 0, sizeof(s_covered));
+    s_round = round;
+    for (int i = 0; i < u->rect_num; i++) {
+        inv_area(&u->rects[i]);
+    }
+    refresh(buf_rows, bytes_per_us, flush_us, res);
+    if (round && u->off_circle && res->px > (uint64_t)res->areas * OFF_CIRCLE_PX) {
+        printf("  %s: %llu pixels off the circle sent\n", u->name, (unsigned long long)res->px);
+        return false;
+    }
+
+    // Every visible pixel that was invalidated has to be redrawn
+    for (int i = 0; i < u->rect_num; i++) {
+        const display_round_area_t *r = &u->rects[i];
+        for (int32_t y = r->y1; y <= r->y2; y++) {
+            int32_t x1, x2;
+            display_round_row_span(y, &x1, &x2);
+            x1 = x1 > r->x1 ? x1 : r->x1;
+            x2 = x2 < r->x2 ? x2 : r->x2;
+            for (int32_t x = x1; x <= x2; x++) {
+                if (!s_covered[y][x]) {
+                    printf("  %s: visible pixel (%d, %d) not redrawn\n", u->name, (int)x, (int)y);
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "usage: %s [--band 30] [--buf-rows 30] [--qspi-mhz 40] [--flush-us 20]\n"
+            "  --band N       rows per clipped band\n"
+            "  --buf-rows N   LVGL draw buffer height in full-width rows\n"
+            "  --qspi-mhz N   panel clock (4 data lines)\n"
+            "  --flush-us N   per-flush overhead (column / row window and write commands)\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    int band = DISPLAY_ROUND_BAND;
+    int buf_rows = DISPLAY_LVGL_BUF_HEIGHT;
+    double qspi_mhz = 40;
+    double flush_us = 20;
+    static const struct option long_opts[] = {
+        {"band", required_argument, NULL, 'b'},
+        {"buf-rows", required_argument, NULL, 'r'},
+        {"qspi-mhz", required_argument, NULL, 'q'},
+        {"flush-us", required_argument, NULL, 'f'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", long_opts, NULL)) != -1) {
+        switch (opt) {
+            case 'b':
+                band = atoi(optarg);
+                break;
+            case 'r':
+                buf_rows = atoi(optarg);
+                break;
+            case 'q':
+                qspi_mhz = atof(optarg);
+                break;
+            case 'f':
+                flush_us = atof(optarg);
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+    if (band <= 0 || buf_rows <= 0 || qspi_mhz <= 0 || display_round_init(DISPLAY_H_RES, band) != ESP_OK) {
+        usage(argv[0]);
+        return 2;
+    }
+    // 4 bits per clock
+    double bytes_per_us = qspi_mhz / 2;
+
+    int64_t visible = 0;
+    for (int32_t y = 0; y < DISPLAY_V_RES; y++) {
+        int32_t x1, x2;
+        display_round_row_span(y, &x1, &x2);
+        visible += x2 - x1 + 1;
+    }
+    printf("panel %dx%d, %.1f%% of the pixels on the circle; band %d rows, buffer %d rows, QSPI %.0f MHz\n",
+           DISPLAY_H_RES, DISPLAY_V_RES, 100.0 * visible / (DISPLAY_H_RES * DISPLAY_V_RES), band, buf_rows,
+           qspi_mhz);
+    printf("%-9s %-6s %6s %8s %10s %10s %10s\n", "update", "flush", "areas", "flushes", "pixels", "KB", "ms");
+
+    int failed = 0;
+    for (int i = 0; i < (int)UPDATE_COUNT; i++) {
+        refresh_result_t rect, round;
+        bool ok = run_update(&s_updates[i], false, buf_rows, bytes_per_us, flush_us, &rect);
+        ok = run_update(&s_updates[i], true, buf_rows, bytes_per_us, flush_us, &round) && ok;
+        printf("%-9s %-6s %6d %8d %10llu %10.1f %10.2f\n", s_updates[i].name, "rect", rect.areas, rect.flushes,
+               (unsigned long long)rect.px, rect.px * 2 / 1024.0, rect.transfer_ms);
+        printf("%-9s %-6s %6d %8d %10llu %10.1f %10.2f  %+.1f%% bytes%s\n", "", "round", round.areas, round.flushes,
+               (unsigned long long)round.px, round.px * 2 / 1024.0, round.transfer_ms,
+               100.0 * ((double)round.px - (double)rect.px) / (double)rect.px, ok ? "" : "  FAIL");
+        failed += ok ? 0 : 1;
+    }
+    display_round_deinit();
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,595 @@
+/**
+ * @file mixer_check.c
+ * @brief Host check of the av_render audio mixer
+ *
+ * Runs audio_mixer with the I2S render replaced by a capture sink. The sink
+ * blocks like the I2S DMA (it accepts writes until lead-ms of audio is
+ * queued) and records every sample with the time it would play, so each
+ * scenario can check the mix sample by sample and measure latency:
+ *
+ *   idle     earcon with no main stream: the mixer task must start it
+ *            within one mixer frame
+ *   main     earcon over a 20 ms main stream (the av_render thread's
+ *            role): it must reach the output with the next main frame,
+ *            the main stream must pass bit-exact outside the overlay and
+ *            mix exactly as main x duck + earcon once the ramps settle
+ *   pts      prompt scheduled at a main-stream pts must start on that
+ *            exact sample
+ *   clip     two full-scale inputs must saturate, never wrap
+ *   nomem    earcon over the main stream with no memory for the mix
+ *            buffer: every main frame must still play, bit-exact
+ *
+ *   mixer_check [--lead-ms 20] [--speed 1] [--report report.json]
+ *
+ * Exits non-zero when a scenario fails.
+ */
+
+#include "audio_mixer.h"
+#include "host_shim.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define RATE                16000
+#define CHANNELS            2
+#define MAIN_FRAME_MS       20
+#define MIXER_FRAME_MS      10
+#define RAMP_MS             5
+#define SINK_MAX_SAMPLES    (RATE * 10)
+#define SINK_MAX_WRITES     2048
+#define EARCON_MS           150
+
+// ============================================
+// Capture Sink
+// ============================================
+
+typedef struct {
+    uint32_t offset;                    // First sample of the write
+    int64_t write_us;
+    int64_t play_us;                    // When its first sample plays
+} sink_write_t;
+
+typedef struct {
+    int16_t pcm[SINK_MAX_SAMPLES * CHANNELS];
+    uint32_t samples;
+    sink_write_t writes[SINK_MAX_WRITES];
+    int write_num;
+    int64_t play_end_us;
+    int64_t lead_us;
+    bool open;
+} sink_t;
+
+static sink_t s_sink;
+static audio_render_handle_t s_sink_render;
+
+static audio_render_handle_t sink_init(void *cfg, int cfg_size)
+{
+    return &s_sink;
+}
+
+static int sink_open(audio_render_handle_t render, av_render_audio_frame_info_t *info)
+{
+    s_sink.open = true;
+    return 0;
+}
+
+static int sink_write(audio_render_handle_t render, av_render_audio_frame_t *frame)
+{
+    int64_t now = host_clock_now_us();
+    uint32_t n = frame->size / (CHANNELS * sizeof(int16_t));
+    if (s_sink.samples + n > SINK_MAX_SAMPLES || s_sink.write_num >= SINK_MAX_WRITES) {
+        return -1;
+    }
+    if (s_sink.play_end_us < now) {
+        s_sink.play_end_us = now;
+    }
+    s_sink.writes[s_sink.write_num++] = (sink_write_t) { s_sink.samples, now, s_sink.play_end_us };
+    memcpy(&s_sink.pcm[s_sink.samples * CHANNELS], frame->data, n * CHANNELS * sizeof(int16_t));
+    s_sink.samples += n;
+    s_sink.play_end_us += (int64_t)n * 1000000 / RATE;
+    // Block like the DMA: return once the queued audio fits in the lead
+    if (s_sink.play_end_us - now > s_sink.lead_us) {
+        host_clock_sleep_us(s_sink.play_end_us - now - s_sink.lead_us);
+    }
+    return 0;
+}
+
+static int sink_get_latency(audio_render_handle_t render, uint32_t *latency)
+{
+    *latency = 0;
+    return 0;
+}
+
+static int sink_get_frame_info(audio_render_handle_t render, av_render_audio_frame_info_t *info)
+{
+    return 0;
+}
+
+static int sink_set_speed(audio_render_handle_t render, float speed)
+{
+    return 0;
+}
+
+static int sink_close(audio_render_handle_t render)
+{
+    s_sink.open = false;
+    return 0;
+}
+
+static void sink_deinit(audio_render_handle_t render)
+{
+}
+
+static audio_render_handle_t sink_alloc(int64_t lead_us)
+{
+    memset(&s_sink, 0, sizeof(s_sink));
+    s_sink.lead_us = lead_us;
+    audio_render_cfg_t cfg = {
+        .ops = {
+            .init = sink_init,
+            .open = sink_open,
+            .write = sink_write,
+            .get_latency = sink_get_latency,
+            .get_frame_info = sink_get_frame_info,
+            .set_speed = sink_set_speed,
+            .close = sink_close,
+            .deinit = sink_deinit,
+        },
+    };
+    return audio_render_alloc_handle(&cfg);
+}
+
+static const sink_write_t *sink_write_of(uint32_t sample)
+{
+    for (int i = s_sink.write_num - 1; i >= 0; i--) {
+        if (s_sink.writes[i].offset <= sample) {
+            return &s_sink.writes[i];
+        }
+    }
+    return NULL;
+}
+
+static int64_t sink_play_us(uint32_t sample)
+{
+    const sink_write_t *w = sink_write_of(sample);
+    return w ? w->play_us + (int64_t)(sample - w->offset) * 1000000 / RATE : 0;
+}
+
+// ============================================
+// Signals
+// ============================================
+
+static int16_t s_earcon[RATE * EARCON_MS / 1000];
+static int16_t s_full_scale[RATE / 10];
+
+static void make_signals(void)
+{
+    for (int i = 0; i < (int)(sizeof(s_earcon) / sizeof(s_earcon[0])); i++) {
+        s_earcon[i] = (int16_t)lrint(12000.0 * sin(2.0 * M_PI * 1200.0 * i / RATE));
+    }
+    for (int i = 0; i < (int)(sizeof(s_full_scale) / sizeof(s_full_scale[0])); i++) {
+        s_full_scale[i] = (i / 20) % 2 ? -32768 : 32767;
+    }
+}
+
+static int16_t main_sample(uint32_t n)
+{
+    return (int16_t)lrint(8000.0 * sin(2.0 * M_PI * 440.0 * n / RATE));
+}
+
+// ============================================
+// Main Stream
+// ============================================
+
+typedef struct {
+    audio_render_handle_t render;
+    int frames;
+    volatile int written;
+    volatile bool done;
+} main_stream_t;
+
+/**
+ * @brief Plays the av_render thread: 20 ms frames with pts, paced by the sink
+ */
+static void main_stream_task(void *arg)
+{
+    main_stream_t *ms = (main_stream_t *)arg;
+    const int n = RATE * MAIN_FRAME_MS / 1000;
+    int16_t frame[n * CHANNELS];
+    av_render_audio_frame_info_t info = { .channel = CHANNELS, .bits_per_sample = 16, .sample_rate = RATE };
+    audio_render_open(ms->render, &info);
+    for (int f = 0; f < ms->frames; f++) {
+        for (int i = 0; i < n; i++) {
+            frame[i * CHANNELS] = frame[i * CHANNELS + 1] = main_sample(f * n + i);
+        }
+        av_render_audio_frame_t data = {
+            .pts = f * MAIN_FRAME_MS,
+            .data = (uint8_t *)frame,
+            .size = sizeof(frame),
+        };
+        audio_render_write(ms->render, &data);
+        ms->written = f + 1;
+    }
+    audio_render_close(ms->render);
+    ms->done = true;
+    vTaskDelete(NULL);
+}
+
+static void start_main(main_stream_t *ms, audio_render_handle_t render, int frames)
+{
+    memset(ms, 0, sizeof(*ms));
+    ms->render = render;
+    ms->frames = frames;
+    xTaskCreate(main_stream_task, "ARender", 8192, ms, 5, NULL);
+}
+
+static void wait_main(main_stream_t *ms)
+{
+    while (ms->done == false) {
+        host_clock_sleep_us(5000);
+    }
+}
+
+// ============================================
+// Scenarios
+// ============================================
+
+typedef struct {
+    const char *name;
+    bool pass;
+    double mix_latency_ms;              // play() to the write holding the first sample
+    double play_latency_ms;             // play() to when that sample plays
+    int mismatches;                     // Samples that differ from the expected mix
+    int checked;
+    uint32_t clipped;
+    char note[96];
+} scenario_result_t;
+
+typedef struct {
+    volatile int done;
+} done_ctx_t;
+
+static void on_done(int input, void *ctx)
+{
+    ((done_ctx_t *)ctx)->done++;
+}
+
+static audio_mixer_handle_t open_mixer(int64_t lead_us)
+{
+    audio_mixer_cfg_t cfg = {
+        .out = s_sink_render = sink_alloc(lead_us),
+        .info = { .channel = CHANNELS, .bits_per_sample = 16, .sample_rate = RATE },
+        .frame_ms = MIXER_FRAME_MS,
+        .ramp_ms = RAMP_MS,
+    };
+    return audio_mixer_open(&cfg);
+}
+
+static void close_mixer(audio_mixer_handle_t mixer)
+{
+    audio_mixer_close(mixer);
+    audio_render_free_handle(s_sink_render);
+    s_sink_render = NULL;
+}
+
+static bool wait_done(done_ctx_t *done, int count, int timeout_ms)
+{
+    for (int t = 0; t < timeout_ms && done->done < count; t += 5) {
+        host_clock_sleep_us(5000);
+    }
+    return done->done >= count;
+}
+
+/**
+ * @brief Sample the overlay starts on, over the main stream
+ *
+ * Its first sample has gain 0 and the duck has not moved yet, so the output
+ * departs from the main stream one sample later. A frame-aligned start must
+ * land on a write boundary.
+ */
+static int overlay_start(void)
+{
+    for (uint32_t i = 1; i < s_sink.samples; i++) {
+        if (s_sink.pcm[i * CHANNELS] != main_sample(i)) {
+            return (int)i - 1;
+        }
+    }
+    return -1;
+}
+
+static void set_latency(scenario_result_t *res, int sample, int64_t play_us)
+{
+    const sink_write_t *w = sink_write_of((uint32_t)sample);
+    res->mix_latency_ms = (w->write_us - play_us) / 1000.0;
+    res->play_latency_ms = (sink_play_us((uint32_t)sample) - play_us) / 1000.0;
+}
+
+static void scenario_idle(int64_t lead_us, scenario_result_t *res)
+{
+    res->name = "idle";
+    audio_mixer_handle_t mixer = open_mixer(lead_us);
+    done_ctx_t done = { 0 };
+    audio_mixer_sound_t sound = {
+        .data = s_earcon,
+        .samples = sizeof(s_earcon) / sizeof(s_earcon[0]),
+        .channel = 1,
+        .done = on_done,
+        .ctx = &done,
+    };
+    host_clock_sleep_us(50000);
+    int64_t t0 = host_clock_now_us();
+    audio_mixer_play(mixer, &sound, NULL);
+    bool finished = wait_done(&done, 1, 2000);
+    // Nothing was written before the play call
+    int start = s_sink.samples ? 0 : -1;
+    if (start >= 0) {
+        set_latency(res, start, t0);
+    }
+    // Both channels carry the mono earcon; the body matches it once the fade-in is over
+    int ramp = RATE * RAMP_MS / 1000 + 2;
+    for (int i = ramp; start >= 0 && i < (int)sound.samples && start + i < (int)s_sink.samples; i++) {
+        int16_t l = s_sink.pcm[(start + i) * CHANNELS];
+        int16_t r = s_sink.pcm[(start + i) * CHANNELS + 1];
+        res->mismatches += (l != s_earcon[i] || r != l) ? 1 : 0;
+        res->checked++;
+    }
+    close_mixer(mixer);
+    res->pass = finished && start >= 0 && res->mix_latency_ms <= MIXER_FRAME_MS + 1 && res->mismatches == 0 &&
+                res->checked > 0 && s_sink.open == false;
+    snprintf(res->note, sizeof(res->note), "%s, output %s after", finished ? "done" : "NOT DONE",
+             s_sink.open ? "left OPEN" : "closed");
+}
+
+static void scenario_main(int64_t lead_us, scenario_result_t *res)
+{
+    res->name = "main";
+    audio_mixer_handle_t mixer = open_mixer(lead_us);
+    main_stream_t ms;
+    start_main(&ms, audio_mixer_get_render(mixer), 50);
+    while (ms.written < 10) {
+        host_clock_sleep_us(1000);
+    }
+    // Land the call between main frames, as a UI event would
+    host_clock_sleep_us(7000);
+    done_ctx_t done = { 0 };
+    audio_mixer_sound_t sound = {
+        .data = s_earcon,
+        .samples = sizeof(s_earcon) / sizeof(s_earcon[0]),
+        .channel = 1,
+        .duck = true,
+        .done = on_done,
+        .ctx = &done,
+    };
+    int64_t t0 = host_clock_now_us();
+    audio_mixer_play(mixer, &sound, NULL);
+    wait_main(&ms);
+    bool finished = done.done == 1;
+
+    int start = overlay_start();
+    bool aligned = start >= 0 && sink_write_of((uint32_t)start)->offset == (uint32_t)start;
+    // Ramps take ramp_ms plus the step rounding
+    int ramp = RATE * RAMP_MS / 1000 + 2;
+    int duck = AUDIO_MIXER_GAIN_UNITY / 4;
+    int end = start + (int)sound.samples;
+    if (start >= 0) {
+        set_latency(res, start, t0);
+        // Steady part: both gains settled
+        for (int i = start + ramp; i < end; i++) {
+            int64_t acc = (int64_t)main_sample(i) * duck + (int64_t)s_earcon[i - start] * AUDIO_MIXER_GAIN_UNITY;
+            int64_t v = (acc + (1 << 14)) >> 15;
+            v = v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : v);
+            res->mismatches += (s_sink.pcm[i * CHANNELS] != v || s_sink.pcm[i * CHANNELS + 1] != v) ? 1 : 0;
+            res->checked++;
+        }
+        // Before the overlay and after the duck has ramped back: untouched
+        for (uint32_t i = 0; i < s_sink.samples; i++) {
+            if ((int)i >= start && (int)i < end + ramp) {
+                continue;
+            }
+            res->mismatches += (s_sink.pcm[i * CHANNELS] != main_sample(i)) ? 1 : 0;
+            res->checked++;
+        }
+    }
+    close_mixer(mixer);
+    res->pass = finished && aligned && res->mix_latency_ms <= MAIN_FRAME_MS + 1 && res->mismatches == 0;
+    snprintf(res->note, sizeof(res->note), "%s, %s, duck to 0.25 with %d ms ramps", finished ? "done" : "NOT DONE",
+             aligned ? "frame-aligned" : "NOT ALIGNED", RAMP_MS);
+}
+
+static void scenario_pts(int64_t lead_us, scenario_result_t *res)
+{
+    res->name = "pts";
+    audio_mixer_handle_t mixer = open_mixer(lead_us);
+    main_stream_t ms;
+    start_main(&ms, audio_mixer_get_render(mixer), 40);
+    while (ms.written < 5) {
+        host_clock_sleep_us(1000);
+    }
+    // 7 ms into a frame a few frames ahead of the writer
+    uint32_t pts = (ms.written + 4) * MAIN_FRAME_MS + 7;
+    audio_mixer_sound_t sound = {
+        .data = s_earcon,
+        .samples = sizeof(s_earcon) / sizeof(s_earcon[0]),
+        .channel = 1,
+        .at_pts = true,
+        .pts = pts,
+    };
+    audio_mixer_play(mixer, &sound, NULL);
+    wait_main(&ms);
+    int start = overlay_start();
+    int expect = (int)(pts * RATE / 1000);
+    close_mixer(mixer);
+    res->checked = 1;
+    res->mismatches = start == expect ? 0 : 1;
+    res->pass = res->mismatches == 0;
+    snprintf(res->note, sizeof(res->note), "pts %u ms: sample %d, expected %d", (unsigned)pts, start, expect);
+}
+
+static void scenario_clip(int64_t lead_us, scenario_result_t *res)
+{
+    res->name = "clip";
+    audio_mixer_handle_t mixer = open_mixer(lead_us);
+    done_ctx_t done = { 0 };
+    audio_mixer_sound_t sound = {
+        .data = s_full_scale,
+        .samples = sizeof(s_full_scale) / sizeof(s_full_scale[0]),
+        .channel = 1,
+        .done = on_done,
+        .ctx = &done,
+    };
+    audio_mixer_play(mixer, &sound, NULL);
+    // The second input may start a mixer frame later; a frame is a whole number of pattern periods
+    audio_mixer_play(mixer, &sound, NULL);
+    bool finished = wait_done(&done, 2, 2000);
+    audio_mixer_stats_t stats;
+    audio_mixer_get_stats(mixer, &stats);
+    int start = s_sink.samples ? 0 : -1;
+    int ramp = RATE * RAMP_MS / 1000 + 2;
+    for (int i = ramp; start >= 0 && i < (int)sound.samples; i++) {
+        int16_t v = s_sink.pcm[(start + i) * CHANNELS];
+        int16_t expect = s_full_scale[i] > 0 ? INT16_MAX : INT16_MIN;
+        res->mismatches += v != expect ? 1 : 0;
+        res->checked++;
+    }
+    res->clipped = stats.clipped;
+    close_mixer(mixer);
+    res->pass = finished && start >= 0 && res->mismatches == 0 && stats.clipped > 0;
+    snprintf(res->note, sizeof(res->note), "%u samples saturated", (unsigned)stats.clipped);
+}
+
+static void scenario_nomem(int64_t lead_us, scenario_result_t *res)
+{
+    res->name = "nomem";
+    audio_mixer_handle_t mixer = open_mixer(lead_us);
+    host_media_lib_fail_realloc(true);
+    const int frames = 30;
+    main_stream_t ms;
+    start_main(&ms, audio_mixer_get_render(mixer), frames);
+    while (ms.written < 5) {
+        host_clock_sleep_us(1000);
+    }
+    audio_mixer_sound_t sound = {
+        .data = s_earcon,
+        .samples = sizeof(s_earcon) / sizeof(s_earcon[0]),
+        .channel = 1,
+        .duck = true,
+    };
+    audio_mixer_play(mixer, &sound, NULL);
+    wait_main(&ms);
+    audio_mixer_stats_t stats;
+    audio_mixer_get_stats(mixer, &stats);
+    host_media_lib_fail_realloc(false);
+
+    uint32_t expect = (uint32_t)frames * (RATE * MAIN_FRAME_MS / 1000);
+    for (uint32_t i = 0; i < s_sink.samples; i++) {
+        res->mismatches += (s_sink.pcm[i * CHANNELS] != main_sample(i)) ? 1 : 0;
+        res->checked++;
+    }
+    close_mixer(mixer);
+    res->pass = s_sink.samples == expect && res->mismatches == 0 && stats.unmixed_frames > 0;
+    snprintf(res->note, sizeof(res->note), "%u/%u samples played, %u frames unmixed", (unsigned)s_sink.samples,
+             (unsigned)expect, (unsigned)stats.unmixed_frames);
+}
+
+// ============================================
+// Main
+// ============================================
+
+static void write_report(const char *path, const scenario_result_t *res, int count)
+{
+    FILE *f = strcmp(path, "-") == 0 ? stdout : fopen(path, "w");
+    if (f == NULL) {
+        fprintf(stderr, "mixer_check: cannot write %s\n", path);
+        return;
+    }
+    fprintf(f, "{\n  \"scenarios\": [\n");
+    for (int i = 0; i < count; i++) {
+        fprintf(f, "    {\"name\": \"%s\", \"pass\": %s, \"mix_latency_ms\": %.1f, \"play_latency_ms\": %.1f, "
+                "\"mismatches\": %d, \"checked\": %d, \"clipped\": %u}%s\n",
+                res[i].name, res[i].pass ? "true" : "false", res[i].mix_latency_ms, res[i].play_latency_ms,
+                res[i].mismatches, res[i].checked, (unsigned)res[i].clipped, i + 1 < count ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    if (f != stdout) {
+        fclose(f);
+    }
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --lead-ms N      audio the sink queues before blocking, like the DMA (default 20)\n"
+            "  --speed N        virtual clock speed (default 1)\n"
+            "  --report PATH    write results as JSON (\"-\" for stdout)\n",
+            argv0);
+}
+
+int main(int argc, char **argv)
+{
+    int lead_ms = 20;
+    double speed = 1.0;
+    const char *report_path = NULL;
+    static const struct option long_opts[] = {
+        {"lead-ms", required_argument, NULL, 'l'},
+        {"speed", required_argument, NULL, 's'},
+        {"report", required_argument, NULL, 'r'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", long_opts, NULL)) != -1) {
+        switch (opt) {
+            case 'l':
+                lead_ms = atoi(optarg);
+                break;
+            case 's':
+                speed = atof(optarg);
+                break;
+            case 'r':
+                report_path = optarg;
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+
+    host_log_set_level(ESP_LOG_WARN);
+    host_clock_set_speed(speed);
+    host_task_register_current("main");
+    if (host_media_lib_os_register() != ESP_OK) {
+        fprintf(stderr, "mixer_check: media_lib OS port registration failed\n");
+        return 1;
+    }
+    make_signals();
+
+    scenario_result_t res[5];
+    memset(res, 0, sizeof(res));
+    int64_t lead_us = (int64_t)lead_ms * 1000;
+    scenario_idle(lead_us, &res[0]);
+    scenario_main(lead_us, &res[1]);
+    scenario_pts(lead_us, &res[2]);
+    scenario_clip(lead_us, &res[3]);
+    scenario_nomem(lead_us, &res[4]);
+
+    int failed = 0;
+    printf("%-6s %6s %12s %13s %16s  %s\n", "case", "result", "mix lat ms", "play lat ms", "mismatch/checked",
+           "note");
+    for (int i = 0; i < 5; i++) {
+        char counts[24];
+        snprintf(counts, sizeof(counts), "%d/%d", res[i].mismatches, res[i].checked);
+        printf("%-6s %6s %12.1f %13.1f %16s  %s\n", res[i].name, res[i].pass ? "ok" : "FAIL", res[i].mix_latency_ms,
+               res[i].play_latency_ms, counts, res[i].note);
+        failed += res[i].pass ? 0 : 1;
+    }
+    if (report_path) {
+        write_report(report_path, res, 5);
+    }
+    return failed ? 1 : 0;
+}
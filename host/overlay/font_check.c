@@ -0,0 +1,213 @@
+/**
+ * @file font_check.c
+ * @brief Packed text overlay glyphs against a reference rendering
+ *
+ * The fonts in font/ are packed by tools/pack_font.py (boxes, raw or
+ * run-length coded) and decoded by esp_capture_text_overlay.c on first use.
+ * font_reference.h holds the CRC-32 of every glyph's cell as the packer
+ * loaded it: the original raw bitmaps for the Espressif sizes, the TTF
+ * rasterization for the others. Every font in font/ is enabled here, and
+ * each glyph is drawn alone through the overlay, white on black, and its
+ * cell compared with the reference.
+ *
+ * The glyphs are drawn in three passes (forward, backward, forward), so they
+ * are decoded again after leaving the glyph cache as well as taken from it.
+ *
+ *   font_check [--dump 18]
+ *
+ * --dump prints every glyph of one size as the overlay drew it. Exits
+ * non-zero on the first glyph that differs from the reference, on a pixel
+ * set outside its cell, or when a font and the reference do not match up.
+ */
+
+#include "esp_capture_text_overlay.h"
+#include "esp_painter_font.h"
+#include "host_shim.h"
+#include "font_reference.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include "esp_log.h"
+
+#define OVERLAY_SIZE  64        // Largest cell (24x48) plus the margin
+#define CELL_X        5
+#define CELL_Y        7
+#define PASSES        3
+
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+// ============================================
+// Private Functions
+// ============================================
+
+static uint32_t crc32_update(uint32_t crc, uint8_t byte)
+{
+    crc ^= byte;
+    for (int i = 0; i < 8; i++) {
+        crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return crc;
+}
+
+static const font_reference_t *find_reference(uint16_t height)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(font_reference); i++) {
+        if (font_reference[i].height == height) {
+            return &font_reference[i];
+        }
+    }
+    return NULL;
+}
+
+static void dump_glyph(const uint16_t *px, const font_reference_t *ref, char c)
+{
+    printf("'%c'\n", c);
+    for (uint32_t y = 0; y < ref->height; y++) {
+        for (uint32_t x = 0; x < ref->width; x++) {
+            putchar(px[(CELL_Y + y) * OVERLAY_SIZE + CELL_X + x] ? '#' : '.');
+        }
+        putchar('\n');
+    }
+}
+
+/**
+ * @brief Draw one glyph and compare it with the reference
+ */
+static bool check_glyph(esp_capture_overlay_if_t *overlay, const font_reference_t *ref, int idx, bool dump)
+{
+    esp_capture_rgn_t all = {.width = OVERLAY_SIZE, .height = OVERLAY_SIZE};
+    esp_capture_text_overlay_clear(overlay, &all, COLOR_RGB565_BLACK);
+    esp_capture_text_overlay_draw_info_t info = {
+        .color = COLOR_RGB565_WHITE,
+        .font_size = ref->height,
+        .x = CELL_X,
+        .y = CELL_Y,
+    };
+    char str[2] = {(char)(0x20 + idx), 0};
+    if (esp_capture_text_overlay_draw_text(overlay, &info, str) != ESP_CAPTURE_ERR_OK) {
+        printf("font %d: '%s' not drawn\n", ref->height, str);
+        return false;
+    }
+
+    esp_capture_stream_frame_t frame;
+    overlay->acquire_frame(overlay, &frame);
+    const uint16_t *px = (const uint16_t *)frame.data;
+    bool ok = true;
+    uint32_t crc = 0xFFFFFFFFu;
+    for (uint32_t y = 0; y < OVERLAY_SIZE && ok; y++) {
+        for (uint32_t x = 0; x < OVERLAY_SIZE; x++) {
+            bool set = px[y * OVERLAY_SIZE + x] != COLOR_RGB565_BLACK;
+            bool in_cell = x >= CELL_X && x < CELL_X + ref->width && y >= CELL_Y && y < CELL_Y + ref->height;
+            if (in_cell) {
+                crc = crc32_update(crc, set);
+            } else if (set) {
+                printf("font %d: '%s' sets pixel (%d, %d) outside its cell\n", ref->height, str,
+                       (int)x - CELL_X, (int)y - CELL_Y);
+                ok = false;
+                break;
+            }
+        }
+    }
+    crc ^= 0xFFFFFFFFu;
+    if (ok && crc != ref->crc[idx]) {
+        printf("font %d: '%s' decodes to CRC %08x, reference %08x\n", ref->height, str,
+               (unsigned)crc, (unsigned)ref->crc[idx]);
+        ok = false;
+    }
+    if (dump || ok == false) {
+        dump_glyph(px, ref, str[0]);
+    }
+    overlay->release_frame(overlay, &frame);
+    return ok;
+}
+
+static bool check_font(const esp_painter_basic_font_t *font, int dump_size)
+{
+    const font_reference_t *ref = find_reference(font->height);
+    if (ref == NULL) {
+        printf("font %d: no reference, regenerate font_reference.h\n", font->height);
+        return false;
+    }
+    if (font->width != ref->width || font->first != 0x20 || font->count != ARRAY_SIZE(ref->crc)) {
+        printf("font %d: %dx%d, %d glyphs from 0x%02x; reference %dx%d, %d glyphs from 0x20\n", font->height,
+               font->width, font->height, font->count, font->first, ref->width, ref->height,
+               (int)ARRAY_SIZE(ref->crc));
+        return false;
+    }
+    // A fresh overlay per font: one holds only a few sizes at once
+    esp_capture_rgn_t rgn = {.width = OVERLAY_SIZE, .height = OVERLAY_SIZE};
+    esp_capture_overlay_if_t *overlay = esp_capture_new_text_overlay(&rgn);
+    if (overlay == NULL || overlay->open(overlay) != ESP_CAPTURE_ERR_OK) {
+        printf("font %d: overlay open failed\n", font->height);
+        free(overlay);
+        return false;
+    }
+    bool ok = true;
+    for (int pass = 0; pass < PASSES && ok; pass++) {
+        for (int i = 0; i < font->count && ok; i++) {
+            int idx = pass % 2 ? font->count - 1 - i : i;
+            ok = check_glyph(overlay, ref, idx, pass == 0 && font->height == dump_size);
+        }
+    }
+    overlay->close(overlay);
+    return ok;
+}
+
+// ============================================
+// Main
+// ============================================
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --dump SIZE      print every glyph of this font size\n",
+            argv0);
+}
+
+int main(int argc, char **argv)
+{
+    int dump_size = 0;
+    static const struct option long_opts[] = {
+        {"dump", required_argument, NULL, 'd'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", long_opts, NULL)) != -1) {
+        switch (opt) {
+            case 'd':
+                dump_size = atoi(optarg);
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+
+    host_log_set_level(ESP_LOG_WARN);
+    if (host_media_lib_os_register() != ESP_OK) {
+        fprintf(stderr, "font_check: media_lib OS port registration failed\n");
+        return 1;
+    }
+
+    bool ok = true;
+    int fonts = 0;
+    int glyphs = 0;
+    for (int i = 0; esp_painter_basic_fonts[i] && ok; i++) {
+        ok = check_font(esp_painter_basic_fonts[i], dump_size);
+        fonts++;
+        glyphs += esp_painter_basic_fonts[i]->count;
+    }
+    if (ok && fonts != (int)ARRAY_SIZE(font_reference)) {
+        printf("%d fonts built, %d in the reference\n", fonts, (int)ARRAY_SIZE(font_reference));
+        ok = false;
+    }
+    if (ok) {
+        printf("%d fonts, %d glyphs, %d passes through a %d-glyph cache\n", fonts, glyphs, PASSES,
+               CONFIG_ESP_PAINTER_GLYPH_CACHE_SIZE);
+    }
+    printf("%s\n", ok ? "every glyph matches the reference" : "FAIL");
+    return ok ? 0 : 1;
+}
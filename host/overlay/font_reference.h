@@ -0,0 +1,213 @@
+/* Generated by tools/pack_font.py --reference: the CRC-32 of each glyph's cell,
+   width x height bytes of 0 or 1, row-major, as rasterized or read from the source */
+
+#pragma once
+
+#include <stdint.h>
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint32_t crc[95];
+} font_reference_t;
+
+static const font_reference_t font_reference[] = {
+    {6, 12, { // basic_font_12.c
+        0x0FC2BB52, 0x76AE81BF, 0x7B51016B, 0xDA385C24, 0x2AE03DC8, 0x2501DEDF,
+        0x961BD9EF, 0x9FC2B9D3, 0x541B9AD2, 0x179836E9, 0x178A0B72, 0x3AB6088D,
+        0x88B2D6AA, 0xAA59DC0E, 0x88647011, 0xA4F31E7D, 0x41FF355A, 0x20B6B888,
+        0xCCAF379C, 0x18220EF9, 0xAFDC586F, 0x80929E34, 0xDE3D62FA, 0xDC2F13ED,
+        0x64944519, 0x0E3C2CA0, 0xDE63B150, 0xE12CD3BA, 0x8349D819, 0x5DCDCE4E,
+        0x2E842668, 0x633831BE, 0x53244D95, 0x923EEA0C, 0x757FF5BB, 0xED0D4030,
+        0x193A91B7, 0x5C6E24FA, 0x1DFD2522, 0x481EC399, 0xC20607E3, 0x8A931593,
+        0x9055057D, 0xAB3EEADD, 0xC6DABF72, 0x8563B920, 0xC06C861B, 0x41FF355A,
+        0xBF24B628, 0x67468620, 0x4B3583F9, 0x9CCA7120, 0x7D5AF243, 0x1C359125,
+        0xA3F80562, 0x7F2FAC3C, 0x198FBE06, 0xD3DF43BD, 0x7F15910F, 0x324B9621,
+        0xC924F058, 0x71C83A1A, 0x86FDBB03, 0x2E9C4DC2, 0x5ACE482F, 0xF171D30D,
+        0x6589CE48, 0xD7438FF3, 0x25E3A97F, 0x2A87E8EA, 0x2CDCB6E9, 0x647995C3,
+        0x73B99BB2, 0x2F49D263, 0x81B2C0F3, 0xF9B6CA08, 0x6A058D32, 0x129EF2DF,
+        0x656E5E70, 0xBDD6D486, 0xFC50493A, 0x0E25A36C, 0x5019C06B, 0x436AE561,
+        0x25164B85, 0x96AD979F, 0xC84AE959, 0xFAD59689, 0x359D0D06, 0xD93D85AC,
+        0xA6C5269D, 0xDA08629C, 0xDD190250, 0xA3D8FE64, 0xF0FA0230,
+    }},
+    {8, 16, { // basic_font_16.c
+        0xC2A8FA9D, 0xFD0EC898, 0xD6EBCCBB, 0xDD96C160, 0xF017815B, 0x25C4AD01,
+        0x7551C1AD, 0xFDAED769, 0x8C3ED658, 0xB538549F, 0xD1BB90DF, 0xCFD7F2AE,
+        0xDC7F7F46, 0xB095B9E3, 0x7C747F50, 0x59C3D46C, 0x70392398, 0xEB7263E8,
+        0xF7E51926, 0x9419B905, 0x10840DB4, 0x506C245D, 0xC2EF5361, 0x69A60D99,
+        0xEE5A54EC, 0xBE87F174, 0xA5326C06, 0x6881F54A, 0x4C9051FD, 0x5AF3EF83,
+        0x2BF91ACA, 0x56E4F224, 0x8985F4E6, 0x1FBEE7C1, 0xA8263F5A, 0x0B85B90D,
+        0xFF15576F, 0xE155B70D, 0x0F95782C, 0x06CCE36E, 0x69795269, 0xDE7F3618,
+        0x606BE0EA, 0x83A64D03, 0x59B36F83, 0x6DC8BCFE, 0x25DDE8B1, 0x6DE74236,
+        0x9E1B4C5A, 0x4F66E128, 0x7FDFB79D, 0x1D3E8CBF, 0xC894B393, 0x892F3ED1,
+        0x13CB3594, 0xB2801A10, 0xB30F8DE2, 0x76F81901, 0x4A4148E6, 0xE133F64C,
+        0xB69AE456, 0x3DF5DF9B, 0x9C814429, 0x892B0727, 0x5F2061BC, 0x7A3CC034,
+        0x4191B55C, 0xF0DCDBBB, 0xFE34DD13, 0xFED1E63C, 0x4DB29BF0, 0xDB660781,
+        0x890C417D, 0x7B55274E, 0xAD7B6BCB, 0x7EC2A783, 0xE2EEA5B7, 0x09F8466F,
+        0x7867D5A2, 0x6B37CA4C, 0xA88022E4, 0x8A927602, 0xF73F4317, 0x0A316D12,
+        0xA00C9903, 0x6E28D0A1, 0x2E6F617D, 0x8F2CC3DE, 0x874728EE, 0x1ADE6390,
+        0xD319589E, 0xC70AEBEA, 0xFE09B903, 0xD00DB1A2, 0x6E22081E,
+    }},
+    {9, 18, { // DejaVuSansMono.ttf
+        0xFD6B80D2, 0x9C24E9EF, 0x625F82D9, 0x80703F02, 0x7C0D29E9, 0xE53CE300,
+        0x374EEA9C, 0xDDED881A, 0x79AB3136, 0xF67F39BA, 0x83D69B49, 0xC903C398,
+        0xBED302E9, 0xD5345D6D, 0x1399BE23, 0xDC99B6F0, 0x7D09586E, 0x0D575066,
+        0xAAC22AD1, 0xC01AE523, 0xC937081B, 0x8F1A0600, 0x2CD8CF96, 0x880C190C,
+        0xA5359BE0, 0x1B05CFE7, 0x28DDB32B, 0x85970FE1, 0xD00F2A1D, 0x2F3EB311,
+        0xE3074DC5, 0x0ACD2B0D, 0xB11974A8, 0xE368EFB7, 0x8C8E821C, 0x9952051C,
+        0x4764EBC8, 0x61208637, 0x53A65BD2, 0xBA444D26, 0x0D99CAC2, 0xE1CE05FB,
+        0xB98E556D, 0x779D8AF1, 0x3346B674, 0x241229D9, 0xB90ACD47, 0x1C415DC7,
+        0x331D2175, 0x7F7037DC, 0xAA033B68, 0xBB94EC07, 0xDCD77AFC, 0xE8475808,
+        0x6D4CB4D4, 0x88E19B23, 0x4414A828, 0xEF375369, 0x24F875B7, 0x4A531EE1,
+        0xD83733D9, 0xFD990E4D, 0x40721646, 0xA193692B, 0x38540625, 0x335046C2,
+        0x35A97747, 0xFF7BDDC9, 0x5197C1AF, 0x474D369C, 0x13DECF07, 0x2D342DD7,
+        0x9A2B05A5, 0xEFB84EF8, 0x5462CFF9, 0x112753CB, 0xF86E2EB1, 0xA11C7042,
+        0x1E32D703, 0xE1C24A1A, 0x2B535858, 0x27DE8ECB, 0xDEDCBE28, 0x75AD6450,
+        0xB5D33164, 0x027B6F82, 0xBA199EFF, 0x31930058, 0xE0454413, 0x8CBA8C70,
+        0x0EB56CDF, 0x1019466E, 0x5AED7FC3, 0xA9A02198, 0xDB0234F1,
+    }},
+    {10, 20, { // basic_font_20.c
+        0xC971A876, 0xA6767DFF, 0x90C034DF, 0x87F3916B, 0xCA2A60BD, 0x76CE1AC0,
+        0x377937BB, 0xF2BB8494, 0x203EA47D, 0xBAF55794, 0x7E657C2C, 0x602A68E9,
+        0x03CCE17C, 0x90D0834B, 0xB8999DF2, 0x065C999A, 0xC623650E, 0xB73B351A,
+        0x69B79CF5, 0x9D92E933, 0x2391F81F, 0x2D7C2E73, 0x1FF90FC8, 0xD39695A6,
+        0x3F7235BD, 0x3E012F17, 0xDC002037, 0xA8AF3268, 0x43D2435E, 0xA49B4AB3,
+        0x026FBE65, 0xB2C31AC7, 0x7ECADD12, 0xEA3D07A2, 0x7D62BBD7, 0x8501182E,
+        0x95E91F49, 0xA7FD23A0, 0x414C3CD1, 0x7A5B2E16, 0xC0190107, 0xB0716E08,
+        0x41EF4EC0, 0xB59C3A87, 0x93CC0CF5, 0x486A5676, 0xBBBF7F88, 0x70E634B4,
+        0x8532604B, 0x9C69DF95, 0x0922A028, 0x0E3670E0, 0xE75B45DB, 0x8814A282,
+        0x1A1CC710, 0xB1A486F1, 0x3DC7807B, 0xD1795A1A, 0x0B88F2B2, 0x806C5D15,
+        0x0486B302, 0xB84B4C40, 0x8BC31910, 0x7A4B2AB1, 0xA24B90D1, 0x14637048,
+        0x96771A6E, 0x4F6DF739, 0x875AFC3A, 0x3700FE09, 0x0D86704F, 0xB47170BD,
+        0x8A009E50, 0x6D06BBB0, 0x3FCF1EDF, 0xB18D2ACC, 0xC240A64A, 0xEA8E8C79,
+        0x9E33D513, 0xDFC89CB0, 0x110505B8, 0xE34F9134, 0xCB97E6C0, 0xC94A8154,
+        0x3E6FB105, 0xBBB7DECF, 0x5ABE5AB8, 0xFD73CA39, 0xF03F8B98, 0x91051F19,
+        0x031014D6, 0x8185F752, 0x54BC2C46, 0x9B385F16, 0x07320202,
+    }},
+    {12, 24, { // basic_font_24.c
+        0xEBF26A52, 0x3820B4E6, 0x1C06A547, 0xD803324F, 0x47E34852, 0xBDE05BB1,
+        0x6FCD7D4F, 0xAE719AB0, 0x5EBCDA39, 0x51E2FFE3, 0x80562655, 0xD266E546,
+        0x8383350D, 0x24F40F4A, 0xBB23F3FA, 0xE08CC312, 0x6A438D75, 0xA4CCC257,
+        0xB25BBF8A, 0xDB276CB4, 0xCBAC7F7A, 0xE1EAC293, 0x64298ED1, 0x4655D4DF,
+        0xBA4A0927, 0xCBA9850E, 0x57420C03, 0x2D11AC03, 0xBD97855D, 0x4EE7DCA6,
+        0xF5732CD5, 0x5785891C, 0x73E2FC31, 0xEEEDDE8D, 0x437AF489, 0xE31486A9,
+        0xAC02FC33, 0x5B18EB60, 0x2F826282, 0x73C7AFFA, 0xE93512E7, 0xC749553A,
+        0xB94FBB1D, 0x2689BA65, 0x75D578B5, 0xBE23E112, 0x9337B0F7, 0x11E5B0CE,
+        0x453D459D, 0xEAB1F550, 0x31102DD9, 0x382195E6, 0xE927EC81, 0x7B12B475,
+        0xCA00C246, 0x1F949CA0, 0x9C6D0D6B, 0x443954AA, 0x605F313B, 0x463A1C4A,
+        0xF5139B57, 0x8ECF816C, 0xCF4F6AE1, 0x02E37B3A, 0x94DDAB2F, 0x6BC11355,
+        0x58F00B53, 0x8577B2B6, 0x9A3697D0, 0xA610C76E, 0xB7F4942B, 0xAE8DD426,
+        0x1B5AD06A, 0xAD901D1B, 0x58B4FA95, 0xA71AEA59, 0xC4ABB90A, 0x80B1DBAB,
+        0xF78C986A, 0xA7F04944, 0x5CAB45C6, 0x9CE2DC1F, 0x1767807A, 0x35CDA19E,
+        0xADA1E9C2, 0xFA0E0C5E, 0x632ADE30, 0x759AED27, 0x0933DF79, 0x9C5F8F35,
+        0xD46A794D, 0x486799E3, 0x688A91AC, 0x123D437F, 0xCC90E8EF,
+    }},
+    {14, 28, { // basic_font_28.c
+        0x7109D72C, 0x8B738875, 0x968BF2DF, 0xFE6976C0, 0xCBB994D8, 0x8372928C,
+        0x30C3B302, 0x43BE3FFB, 0x381A51CC, 0x2D090C7A, 0x0814631F, 0x26D657AE,
+        0x1CFC7EBA, 0xE0A31B23, 0xB54556DE, 0xAFB1A42D, 0x01686D2E, 0xBAD33B34,
+        0x8A07F9A8, 0x89E84A76, 0x2F3B9326, 0x7DA375BE, 0x00293321, 0x74B86748,
+        0x0093A652, 0x811BF65B, 0xBD2895A9, 0xA51600A8, 0x5A1D5787, 0x8F1D1C03,
+        0xE470B309, 0xEAE41D5C, 0x0D7942D9, 0x27D90C04, 0xAE3DF644, 0x259BC579,
+        0x1E6F2034, 0x97636C4F, 0x680C64AB, 0x87AFA3F2, 0x1D3286F4, 0x290116EE,
+        0x7A3EE50F, 0x6E826469, 0x3EFFAD82, 0x485F2B20, 0x15BD000F, 0x1F6E3567,
+        0xF8D3BC3D, 0x8DE6A98B, 0x3A40EB5A, 0xBB6AE258, 0x34C64E47, 0x33940DF4,
+        0x245C819C, 0xA1F91142, 0x220C2B07, 0xFEA7E8EA, 0x84C809BD, 0x2BF6C6FF,
+        0x3282B848, 0x2BADE029, 0xB74512DD, 0xD881FEB7, 0x9302535B, 0x4F47B981,
+        0x47C264A9, 0x61162B26, 0xE360D822, 0x71615792, 0x82F6F8D8, 0x5DB49BD5,
+        0x2219DA37, 0x8F3937F8, 0x2394CCBF, 0x0C3C87E1, 0x57FE4719, 0x0A4CE56D,
+        0x6B29204A, 0x3F2341DB, 0xD3D766ED, 0x65710BED, 0xC5C3C18A, 0x7009BC3D,
+        0x645FFC9C, 0x38FCC91E, 0x2A533CAB, 0x395072CF, 0xF7111EC2, 0x63FA4575,
+        0xF4B45723, 0x04CA3931, 0x572E1673, 0x8CDB9021, 0xD2196499,
+    }},
+    {16, 32, { // basic_font_32.c
+        0xB2AA7578, 0x2B090A28, 0x44EBDDF0, 0x670024B5, 0x6F1EE063, 0x2B4BD83C,
+        0xCC68F06C, 0x818296F9, 0x0453877B, 0x0A017147, 0xB64D7CC2, 0xEAB339CD,
+        0x803B9554, 0x61838C25, 0x1EF0AF26, 0x77668583, 0xDAA866F8, 0x3B421D2D,
+        0xE4E22F9F, 0xBAA1E1FD, 0xA6A775E7, 0x65808701, 0xD19CD4C6, 0xA3A3E039,
+        0x5B4A1BC5, 0xDECE1220, 0x209CF62D, 0x4451A245, 0x8FE92882, 0x8F14E056,
+        0xDF1B593E, 0x5B4A058A, 0x4553F5C2, 0x7A34C566, 0xCDAFC6BD, 0xBB08BAE7,
+        0xE4DA427D, 0xCC5BC7FB, 0x18C7F663, 0xD70A2F67, 0xD86545EE, 0xEE1ED07B,
+        0x5D225CAD, 0xA0E9983A, 0x5DC8E1DA, 0x272E6263, 0x9804F8D7, 0x390B17C2,
+        0x3E1ED396, 0x00ADBDA8, 0xFB8AB113, 0x45269AD2, 0x0E624D82, 0x1778475D,
+        0xEED4359F, 0xF35F3145, 0x2EB4F398, 0x7FE2BD62, 0x15E84152, 0x37C3D6D9,
+        0x5728736C, 0x7505D998, 0xB7DAE4A9, 0x0CB1169A, 0x5BC3379C, 0x63334004,
+        0xAB71C5B5, 0x5E04DB8F, 0x3D0C23A4, 0xCE847A21, 0x3A9D1598, 0x76A4086B,
+        0x0C0098B3, 0x26A48374, 0x478FC8FD, 0x459D0BDF, 0xFDDD3FE3, 0x15FC7433,
+        0xD0075444, 0xAEA14E32, 0x22F0BC46, 0x1DD39F33, 0xBDC9AA0A, 0xB65BF0D3,
+        0xBBDF2A59, 0xFD765AC4, 0x661AAAAB, 0x285F11A7, 0x3A8F3102, 0xAF687D0A,
+        0x9467182E, 0xD761A0A4, 0xBFCF2D1E, 0xEA374858, 0x4E84E555,
+    }},
+    {18, 36, { // basic_font_36.c
+        0xCFF54868, 0x1DBB97CF, 0x239945E6, 0x432762F9, 0x3145311F, 0x52AD8AC5,
+        0xA46188AE, 0x0425D605, 0x9F5BE754, 0x319D13C4, 0x71C12DCB, 0xA7A465E4,
+        0xA6A8B279, 0xA8438B7D, 0xB847C06C, 0x5F538A95, 0xE9B5222F, 0xFC732C21,
+        0x59D0AE85, 0x67549259, 0x6D67919B, 0xAEEA1C55, 0x63BEB8EB, 0x3790CB6D,
+        0x44711821, 0xE1B0BD2A, 0xD0FCC7EA, 0x10CF1A74, 0xAD93F732, 0x6B185DA3,
+        0xEFE95FD8, 0xBFF62252, 0x9562E5CC, 0x88A6E035, 0x0E9FAC95, 0x70C7402C,
+        0xB065142A, 0x3B994DF7, 0x1898EB7A, 0x700BA76A, 0xED990DE7, 0xCFCAF6F2,
+        0xEC8AC170, 0x176FD60F, 0x968AE725, 0xDA795709, 0x523D51D4, 0x0CE007F6,
+        0xF4A68A04, 0xF078B774, 0xF117AABE, 0x01C96F87, 0xDE4A8A81, 0x54FAF197,
+        0x48479BF1, 0x9F4DBCBB, 0x0385D01F, 0xE45F7354, 0xE2430256, 0x18548926,
+        0x38ED9DF1, 0xA00E1BC2, 0x8903AF42, 0x191A5628, 0x7CC6265D, 0x33D9679B,
+        0x1C9CD78A, 0xDD8A4D0B, 0x47D5EEC0, 0x6FB891D7, 0x9823E01E, 0x5E922D6D,
+        0x5FBE27F5, 0x80625AB3, 0x3BBC1A80, 0x03BFF769, 0xD7BD5BD3, 0xFDC1D988,
+        0x64B51C6B, 0xB25B061A, 0xA3D962E6, 0xDD5CDDD2, 0x5202D884, 0x59AF6E61,
+        0x89AD3768, 0xF0011277, 0xA164DB73, 0xB67BA59E, 0xDBEAF9FF, 0x9AAEEB9D,
+        0xF9E6C920, 0x12649F23, 0x91D72491, 0x082C5096, 0x36F31CCF,
+    }},
+    {20, 40, { // basic_font_40.c
+        0x688FA2E3, 0x014CE771, 0x3F421FD9, 0x90161222, 0x8205AACD, 0xD1580DC2,
+        0xA55A648D, 0xB0AAE9E1, 0x1F50F217, 0x60A5E825, 0x61032E62, 0xCA9D2746,
+        0xBCC5C9A4, 0x35C14BA5, 0x43BF9F4D, 0x954BDE2D, 0xE2CC5698, 0xE1B33A80,
+        0xC6EDE0A8, 0x45249BA6, 0x15909BD0, 0xD711E9CE, 0x6695092D, 0xD03814AA,
+        0x819A486B, 0x92BC97D8, 0x46ED6845, 0x30D32CC6, 0x00EF2AF3, 0xCCC4031C,
+        0x7369BB04, 0xE65C2C85, 0x41B00940, 0xB06C6E8F, 0xE8C9890D, 0x8989BA99,
+        0x77DA4443, 0x07CDF4C9, 0x4F48C066, 0xC2FD749B, 0x2ADF9109, 0xF7ADAA1A,
+        0x06CA0276, 0x51E8CA30, 0xD1593102, 0xBEE88B4D, 0xC7FD4215, 0xD04FAD1F,
+        0xD561709D, 0xBCC8367E, 0x4F2FF70D, 0xDFB8C0A9, 0xA110A7B9, 0x8C189C2B,
+        0xDA4C9538, 0xFDB32E3B, 0xB062DB42, 0x1B9DE717, 0xE065A18D, 0x6D7BCA6B,
+        0xC09EF74B, 0x03D4F780, 0xF6F74293, 0xD3F5BC57, 0xB23695DB, 0x59E01BF6,
+        0x672FF1AE, 0x3BE226C4, 0x24425A6A, 0x83C452AD, 0x7C1DA70F, 0x7957B581,
+        0xE181489B, 0x75E8F6F3, 0x99C1928B, 0x35D9FD46, 0x21C5877C, 0xCF823F52,
+        0x883FD32F, 0x7E72CE13, 0xC9AE9ACD, 0x3E5B86DC, 0xB924A914, 0x80A410D1,
+        0xC444D776, 0xC17B7D75, 0x7B5D02FE, 0x4D72BE2B, 0x9D19F83B, 0xD95C5DC8,
+        0x0BE5506D, 0x1D1EB765, 0x7ABD089E, 0x57A3C65F, 0x9B4897C4,
+    }},
+    {22, 44, { // basic_font_44.c
+        0x5EC51B61, 0x150C889E, 0x7682DDAE, 0x8035998D, 0xF17D15F8, 0xA8987931,
+        0x55E6FEAF, 0xC761E3E6, 0x6A777DF9, 0xA353E6D1, 0x24AA13BD, 0xEDCDA65F,
+        0xA59FF29E, 0x1FE65811, 0x47D45C0C, 0x76D5478E, 0x44BC39EE, 0x26BB5F26,
+        0x33C22ABF, 0x31124A22, 0xDE4B86E9, 0x337C7D0A, 0xEE20B3EF, 0x3C4DDE57,
+        0x0E6EE4A0, 0x4B71E6E1, 0x14660DC2, 0x21A588DB, 0x5BB57802, 0x2287248B,
+        0xF3915B78, 0xF05F26D1, 0x25410F98, 0xD84D4710, 0xF5100A93, 0xC96B8297,
+        0x3265BD87, 0x2EFE1996, 0x73D3DA75, 0xF0F7B486, 0x866B8C0F, 0x09962F8B,
+        0x18A97F7C, 0x5165EB3C, 0xA9C1A348, 0xFD2E1327, 0xA395E174, 0x1E8A429F,
+        0xC9160FE1, 0xE4BDF41E, 0x11486840, 0xADA4EFFD, 0xF9A68999, 0x34FD1E12,
+        0x781DD7BC, 0x87792BCD, 0x6215FC83, 0xB2A5F568, 0xA6EE49D7, 0xD13FE9AF,
+        0x7DAE3BD2, 0x704F1BF2, 0x8116F1C6, 0xB25D5961, 0x3275E230, 0xF3A6CF04,
+        0x82F5DB9A, 0x2B0985EF, 0x5E0A81E1, 0x552F16E6, 0x3FFD84B2, 0x2A4E180C,
+        0x3D64FAB8, 0x92ADF461, 0x15A1A731, 0x76592D62, 0xC572AE06, 0x35AC7A6D,
+        0x5A864963, 0x1EEE1208, 0x41514569, 0x205219E3, 0x3A2B4EF7, 0x7CEC68FD,
+        0x28506ED6, 0x52E9D32E, 0x5466B9CE, 0x2E3F4D51, 0x2C44383A, 0xE534BF54,
+        0x73C2B65F, 0x5A75019A, 0x03D4E90C, 0xD77BE5D4, 0xCCAEB7C2,
+    }},
+    {24, 48, { // basic_font_48.c
+        0xA15C5830, 0x1C0FA841, 0x5D6A1D31, 0x1542D08B, 0x5E029FD6, 0x8DDAF519,
+        0xBD70FF02, 0xC5057FCD, 0x23F63CD5, 0x1F3CC4AD, 0x50512A23, 0x9C0FA785,
+        0x3992AAD3, 0x38817789, 0x04AD5871, 0xB13AA114, 0xD256877C, 0x4F1F6A5D,
+        0x601D0181, 0xAD314308, 0x6AF81CEF, 0x8FEDE2A7, 0x01BF5430, 0x00D9EA5E,
+        0xBBA92FD8, 0x29C71212, 0xB20F5416, 0x47A024E1, 0x39430E5F, 0x13F9104A,
+        0xCFC1CA08, 0x0BF09C13, 0x2ED5D602, 0x11E5CB86, 0x43DC7315, 0x95D24DA0,
+        0x9A8E736C, 0x69A74FDB, 0x92B9C461, 0xF0E093F9, 0x92FE482F, 0x2BF5E58C,
+        0x107E8BD8, 0x65A043B6, 0x7E56908D, 0xD84788B8, 0x3D7AAC45, 0xC518D7CB,
+        0x4B7844F2, 0x14ADBED4, 0xEA6D3D7E, 0x4080E240, 0xE891714B, 0x0996875A,
+        0x505CDFB9, 0x860370A4, 0x5440D2C3, 0xBF918154, 0x37562D31, 0x57D38560,
+        0xA89194B0, 0x2AA5DE8E, 0x2BA647E1, 0x579295C3, 0xE45B0F3D, 0xF6861B7A,
+        0xE3F74CFA, 0x1474D6D7, 0x19B883DE, 0xDC390A1F, 0xB529041F, 0xED3380F7,
+        0xBEF11D10, 0xA7D8E89D, 0x7CC84C1F, 0x7F9F5B44, 0xB2385C79, 0xF25D2986,
+        0x9C7890F2, 0xEC6BE207, 0xFA857ECF, 0xA8D1B7D2, 0xEF868854, 0xBCFA0869,
+        0x7BD84344, 0x511F088C, 0x63C6E802, 0xE73FAF36, 0x2596757D, 0x18D62CA0,
+        0x1CD8CB9B, 0x89060C19, 0xC6F21DA8, 0x68282D0C, 0x175B777D,
+    }},
+};
@@ -0,0 +1,363 @@
+/**
+ * @file overlay_check.c
+ * @brief Incremental text overlay redraw against a full redraw
+ *
+ * esp_capture_text_overlay renders a batch (draw_start .. draw_finished)
+ * that repeats the previous one with only the strings changed by
+ * repainting just the character cells that differ. This drives two
+ * overlays with the same random sequence of updates:
+ *
+ *   incremental  every update batched, as an application draws a caption
+ *                or a clock
+ *   reference    every operation drawn at once, outside a batch, which
+ *                always renders in full
+ *
+ * Most updates change only strings (characters, length, '\n', characters
+ * outside the font, lines wrapping at the right edge and falling off the
+ * bottom), the rest change the operations or draw outside a batch. After
+ * each update the two frames must be pixel-identical, and every pixel the
+ * incremental overlay changed must lie in a region returned by
+ * esp_capture_text_overlay_take_dirty().
+ *
+ *   overlay_check [--updates 5000] [--seed 1]
+ *
+ * Exits non-zero on the first update where either check fails.
+ */
+
+#include "esp_capture_text_overlay.h"
+#include "host_shim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include "esp_log.h"
+
+#define OVERLAY_WIDTH   200
+#define OVERLAY_HEIGHT  96
+#define MAX_OPS         10      // Under the overlay's 16 recorded operations
+#define MAX_STR         40      // MAX_OPS strings stay under its 512-byte arena
+#define MAX_DIRTY       8
+
+// CONFIG_ESP_PAINTER_BASIC_FONT_* set in CMakeLists.txt
+static const uint16_t s_font_sizes[] = {12, 16, 24};
+static const uint16_t s_colors[] = {
+    COLOR_RGB565_BLACK, COLOR_RGB565_WHITE, COLOR_RGB565_RED, COLOR_RGB565_ESP_BKGD, COLOR_RGB565_TEAL,
+};
+
+#define ARRAY_SIZE(a)   (sizeof(a) / sizeof((a)[0]))
+
+// ============================================
+// Private Types and Variables
+// ============================================
+
+typedef struct {
+    bool                                 text;
+    esp_capture_rgn_t                    rgn;       // Clear
+    uint16_t                             color;
+    esp_capture_text_overlay_draw_info_t info;      // Text
+    char                                 str[MAX_STR + 1];
+} check_op_t;
+
+typedef struct {
+    esp_capture_overlay_if_t *inc;
+    esp_capture_overlay_if_t *ref;
+    uint16_t                 *before;               // Incremental frame before the update
+    uint32_t                  rng;
+    check_op_t                ops[MAX_OPS];
+    int                       op_num;
+    uint32_t                  string_updates;
+    uint32_t                  shape_updates;
+    uint32_t                  immediate_updates;
+    uint64_t                  changed_px;
+    uint64_t                  dirty_px;
+} check_ctx_t;
+
+static uint32_t rng_next(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+static uint32_t rng_below(check_ctx_t *c, uint32_t n)
+{
+    return rng_next(&c->rng) % n;
+}
+
+// ============================================
+// Random Updates
+// ============================================
+
+static char random_char(check_ctx_t *c)
+{
+    uint32_t r = rng_below(c, 100);
+    if (r < 6) {
+        return '\n';
+    }
+    if (r < 9) {
+        // Outside the font: skipped, but still takes a cell
+        static const char outside[] = {'\x01', '\x7f', '\x80', '\xff'};
+        return outside[rng_below(c, ARRAY_SIZE(outside))];
+    }
+    if (r < 25) {
+        return (char)('0' + rng_below(c, 10));
+    }
+    return (char)(' ' + rng_below(c, 95));
+}
+
+static void random_string(check_ctx_t *c, char *str)
+{
+    int len = (int)rng_below(c, MAX_STR + 1);
+    for (int i = 0; i < len; i++) {
+        str[i] = random_char(c);
+    }
+    str[len] = '\0';
+}
+
+static void random_op(check_ctx_t *c, check_op_t *op)
+{
+    memset(op, 0, sizeof(*op));
+    op->text = rng_below(c, 3) != 0;
+    if (op->text) {
+        uint16_t size = s_font_sizes[rng_below(c, ARRAY_SIZE(s_font_sizes))];
+        op->info.font_size = size;
+        op->info.color = s_colors[rng_below(c, ARRAY_SIZE(s_colors))];
+        op->info.x = (uint16_t)rng_below(c, OVERLAY_WIDTH - size / 2 + 1);
+        op->info.y = (uint16_t)rng_below(c, OVERLAY_HEIGHT - size + 1);
+        random_string(c, op->str);
+        return;
+    }
+    if (rng_below(c, 4) == 0) {
+        op->rgn = (esp_capture_rgn_t) {.width = OVERLAY_WIDTH, .height = OVERLAY_HEIGHT};
+    } else {
+        op->rgn.x = rng_below(c, OVERLAY_WIDTH);
+        op->rgn.y = rng_below(c, OVERLAY_HEIGHT);
+        op->rgn.width = 1 + rng_below(c, OVERLAY_WIDTH - op->rgn.x);
+        op->rgn.height = 1 + rng_below(c, OVERLAY_HEIGHT - op->rgn.y);
+    }
+    op->color = s_colors[rng_below(c, ARRAY_SIZE(s_colors))];
+}
+
+/**
+ * @brief Change the strings only, as a clock or caption update does
+ */
+static void mutate_strings(check_ctx_t *c)
+{
+    for (int i = 0; i < c->op_num; i++) {
+        check_op_t *op = &c->ops[i];
+        if (op->text == false || rng_below(c, 2)) {
+            continue;
+        }
+        int len = (int)strlen(op->str);
+        switch (rng_below(c, 4)) {
+            case 0:
+                random_string(c, op->str);
+                break;
+            case 1:
+                // Grow or shrink at the end
+                len = (int)rng_below(c, MAX_STR + 1) > len ? len + 1 + (int)rng_below(c, MAX_STR - len)
+                                                            : (int)rng_below(c, len + 1);
+                for (int k = (int)strlen(op->str); k < len; k++) {
+                    op->str[k] = random_char(c);
+                }
+                op->str[len] = '\0';
+                break;
+            default:
+                // A few characters in place, like a ticking clock
+                for (int n = 1 + (int)rng_below(c, 3); n > 0 && len > 0; n--) {
+                    op->str[rng_below(c, len)] = random_char(c);
+                }
+                break;
+        }
+    }
+}
+
+static void draw_op(esp_capture_overlay_if_t *overlay, check_op_t *op)
+{
+    if (op->text) {
+        esp_capture_text_overlay_draw_text(overlay, &op->info, op->str);
+    } else {
+        esp_capture_text_overlay_clear(overlay, &op->rgn, op->color);
+    }
+}
+
+// ============================================
+// Checks
+// ============================================
+
+static const uint16_t *frame_pixels(esp_capture_overlay_if_t *overlay, esp_capture_stream_frame_t *frame)
+{
+    overlay->acquire_frame(overlay, frame);
+    return (const uint16_t *)frame->data;
+}
+
+static bool in_dirty(const esp_capture_rgn_t *dirty, int num, uint32_t x, uint32_t y)
+{
+    for (int i = 0; i < num; i++) {
+        if (x >= dirty[i].x && x < dirty[i].x + dirty[i].width && y >= dirty[i].y &&
+            y < dirty[i].y + dirty[i].height) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool check_update(check_ctx_t *c, uint32_t n)
+{
+    esp_capture_rgn_t dirty[MAX_DIRTY];
+    int dirty_num = esp_capture_text_overlay_take_dirty(c->inc, dirty, MAX_DIRTY);
+    esp_capture_rgn_t ref_dirty[MAX_DIRTY];
+    esp_capture_text_overlay_take_dirty(c->ref, ref_dirty, MAX_DIRTY);
+    for (int i = 0; i < dirty_num; i++) {
+        c->dirty_px += dirty[i].width * dirty[i].height;
+    }
+
+    esp_capture_stream_frame_t inc_frame, ref_frame;
+    const uint16_t *inc = frame_pixels(c->inc, &inc_frame);
+    const uint16_t *ref = frame_pixels(c->ref, &ref_frame);
+    bool ok = true;
+    for (uint32_t y = 0; y < OVERLAY_HEIGHT && ok; y++) {
+        for (uint32_t x = 0; x < OVERLAY_WIDTH; x++) {
+            uint32_t i = y * OVERLAY_WIDTH + x;
+            if (inc[i] != ref[i]) {
+                printf("update %lu: pixel (%lu, %lu) is %04x incrementally, %04x in a full redraw\n",
+                       (unsigned long)n, (unsigned long)x, (unsigned long)y, inc[i], ref[i]);
+                ok = false;
+                break;
+            }
+            if (inc[i] != c->before[i]) {
+                c->changed_px++;
+                if (in_dirty(dirty, dirty_num, x, y) == false) {
+                    printf("update %lu: pixel (%lu, %lu) changed outside the %d dirty regions\n",
+                           (unsigned long)n, (unsigned long)x, (unsigned long)y, dirty_num);
+                    ok = false;
+                    break;
+                }
+            }
+        }
+    }
+    memcpy(c->before, inc, OVERLAY_WIDTH * OVERLAY_HEIGHT * sizeof(uint16_t));
+    c->inc->release_frame(c->inc, &inc_frame);
+    c->ref->release_frame(c->ref, &ref_frame);
+    return ok;
+}
+
+static bool run_update(check_ctx_t *c, uint32_t n)
+{
+    uint32_t kind = n == 0 ? 1 : rng_below(c, 20);
+    if (kind == 0) {
+        // Outside a batch: drawn at once on both, and the next batch cannot be incremental
+        check_op_t op;
+        random_op(c, &op);
+        draw_op(c->inc, &op);
+        draw_op(c->ref, &op);
+        c->immediate_updates++;
+        return check_update(c, n);
+    }
+    if (kind < 4) {
+        c->op_num = 1 + (int)rng_below(c, MAX_OPS);
+        for (int i = 0; i < c->op_num; i++) {
+            random_op(c, &c->ops[i]);
+        }
+        c->shape_updates++;
+    } else {
+        mutate_strings(c);
+        c->string_updates++;
+    }
+    esp_capture_text_overlay_draw_start(c->inc);
+    for (int i = 0; i < c->op_num; i++) {
+        draw_op(c->inc, &c->ops[i]);
+        draw_op(c->ref, &c->ops[i]);
+    }
+    esp_capture_text_overlay_draw_finished(c->inc);
+    return check_update(c, n);
+}
+
+// ============================================
+// Main
+// ============================================
+
+static esp_capture_overlay_if_t *open_overlay(void)
+{
+    esp_capture_rgn_t rgn = {.width = OVERLAY_WIDTH, .height = OVERLAY_HEIGHT};
+    esp_capture_overlay_if_t *overlay = esp_capture_new_text_overlay(&rgn);
+    if (overlay && overlay->open(overlay) != ESP_CAPTURE_ERR_OK) {
+        free(overlay);
+        overlay = NULL;
+    }
+    return overlay;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --updates N      random updates to run (default 5000)\n"
+            "  --seed N         update sequence seed (default 1)\n",
+            argv0);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t updates = 5000;
+    uint32_t seed = 1;
+    static const struct option long_opts[] = {
+        {"updates", required_argument, NULL, 'n'},
+        {"seed", required_argument, NULL, 's'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", long_opts, NULL)) != -1) {
+        switch (opt) {
+            case 'n':
+                updates = (uint32_t)atol(optarg);
+                break;
+            case 's':
+                seed = (uint32_t)atol(optarg);
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+
+    host_log_set_level(ESP_LOG_WARN);
+    if (host_media_lib_os_register() != ESP_OK) {
+        fprintf(stderr, "overlay_check: media_lib OS port registration failed\n");
+        return 1;
+    }
+    check_ctx_t c = {
+        .inc = open_overlay(),
+        .ref = open_overlay(),
+        .before = calloc(OVERLAY_WIDTH * OVERLAY_HEIGHT, sizeof(uint16_t)),
+        .rng = seed ? seed : 1,
+    };
+    if (c.inc == NULL || c.ref == NULL || c.before == NULL) {
+        fprintf(stderr, "overlay_check: no memory\n");
+        return 1;
+    }
+
+    uint32_t n = 0;
+    bool ok = true;
+    for (; n < updates && ok; n++) {
+        ok = run_update(&c, n);
+    }
+
+    printf("%lu updates on a %dx%d overlay: %lu strings only, %lu new operations, %lu outside a batch\n",
+           (unsigned long)n, OVERLAY_WIDTH, OVERLAY_HEIGHT, (unsigned long)c.string_updates,
+           (unsigned long)c.shape_updates, (unsigned long)c.immediate_updates);
+    printf("changed %llu pixels, dirty regions covered %llu (%.1f per changed pixel)\n",
+           (unsigned long long)c.changed_px, (unsigned long long)c.dirty_px,
+           c.changed_px ? (double)c.dirty_px / c.changed_px : 0.0);
+    printf("%s\n", ok ? "incremental redraw matches the full redraw" : "FAIL");
+
+    c.inc->close(c.inc);
+    c.ref->close(c.ref);
+    free(c.inc);
+    free(c.ref);
+    free(c.before);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,680 @@
+/**
+ * @file replay_main.c
+ * @brief Host replay of the voice pipeline against recorded audio
+ *
+ * Runs the unmodified audio_pipeline (recorder DSP + VAD, rec_pipe, player),
+ * the realtime WebSocket provider, latency_ledger and trace_ring on the
+ * FreeRTOS/ESP-IDF shim. The microphone is a WAV file, the speaker is a WAV
+ * file and the service is the in-process stand-in, so a run is repeatable
+ * and needs no board, Wi-Fi or account.
+ *
+ * This file plays app_core's role with the same turn logic: stream audio
+ * while listening, commit (and request a response) on VAD voice end, play
+ * response deltas, close the turn once the player has drained.
+ *
+ *   replay --in speech.wav [--out reply.wav] [--provider azure|coze|none]
+ *          [--response answer.wav] [--speed 4] [--unpaced]
+ *          [--drop] [--drop-mid N] [--no-tickets]
+ *          [--trace trace.json] [--report report.json]
+ *
+ * --drop makes the stand-in close the connection after every response, so
+ * each turn also measures reconnect (backoff, TLS handshake, session setup)
+ * as reported by realtime_link. --drop-mid N closes it after N audio
+ * messages of every utterance instead: the turn only completes if the
+ * provider's capture spool replays the utterance on the new session.
+ */
+
+#include "audio_pipeline.h"
+#include "audio_player.h"
+#include "app_core.h"
+#include "latency_ledger.h"
+#include "trace_ring.h"
+#include "host_shim.h"
+
+#if HOST_HAVE_PROVIDERS
+#include "azure_realtime.h"
+#include "coze_ws.h"
+#include "realtime_link.h"
+#include "capture_spool.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+
+static const char *TAG = "REPLAY";
+
+#define READY_TIMEOUT_MS        15000   // Provider connect + session setup
+#define RESPONSE_TIMEOUT_MS     20000   // Voice end to response done
+#define TAIL_MS                 1500    // Silence replayed after the file ends
+#define POLL_MS                 20
+
+// ============================================
+// Private Types and Variables
+// ============================================
+
+typedef enum {
+    PROVIDER_NONE = 0,
+    PROVIDER_AZURE,
+    PROVIDER_COZE,
+} provider_t;
+
+typedef struct {
+    const char *in_path;
+    const char *out_path;
+    const char *response_path;
+    const char *trace_path;
+    const char *report_path;
+    provider_t provider;
+    double speed;
+    bool paced;
+    bool verbose;
+    bool drop;
+    uint32_t drop_mid;
+    bool no_tickets;
+} replay_options_t;
+
+static replay_options_t s_opts = {
+    .provider = PROVIDER_AZURE,
+    .speed = 1.0,
+    .paced = true,
+};
+
+static esp_codec_dev_handle_t s_mic = NULL;
+static esp_codec_dev_handle_t s_spk = NULL;
+
+static volatile app_state_t s_state = APP_STATE_LISTENING;
+static volatile bool s_response_done = false;
+static volatile bool s_playback_started = false;
+static int64_t s_turn_start_us = 0;
+
+static uint32_t s_utterances = 0;
+static uint32_t s_turns_completed = 0;
+static uint32_t s_turns_timed_out = 0;
+static uint32_t s_send_errors = 0;
+static uint64_t s_audio_bytes_out = 0;
+static uint32_t s_player_drops = 0;
+
+// ============================================
+// Firmware Hooks (normally provided by main / app_core)
+// ============================================
+
+esp_codec_dev_handle_t app_get_mic_codec(void)
+{
+    return s_mic;
+}
+
+esp_codec_dev_handle_t app_get_speaker_codec(void)
+{
+    return s_spk;
+}
+
+app_state_t app_core_get_state(void)
+{
+    return s_state;
+}
+
+static void set_state(app_state_t state)
+{
+    TRACE_EVENT(TRACE_EV_APP_STATE, s_state, state);
+    s_state = state;
+}
+
+// ============================================
+// Provider Glue
+// ============================================
+
+static latency_provider_t ledger_provider(void)
+{
+    return s_opts.provider == PROVIDER_COZE ? LATENCY_PROVIDER_COZE_WS : LATENCY_PROVIDER_AZURE_WS;
+}
+
+static esp_err_t provider_send_audio(const uint8_t *data, size_t size)
+{
+#if HOST_HAVE_PROVIDERS
+    if (s_opts.provider == PROVIDER_AZURE) {
+        return azure_realtime_send_audio(data, size);
+    } else if (s_opts.provider == PROVIDER_COZE) {
+        return coze_ws_send_audio(data, size);
+    }
+#endif
+    (void)data;
+    (void)size;
+    return ESP_OK;
+}
+
+static void provider_commit(void)
+{
+#if HOST_HAVE_PROVIDERS
+    if (s_opts.provider == PROVIDER_AZURE) {
+        azure_realtime_commit_audio();
+        azure_realtime_create_response();
+    } else if (s_opts.provider == PROVIDER_COZE) {
+        coze_ws_commit_audio();
+    }
+#endif
+}
+
+/**
+ * @brief Skip a reconnect backoff when the user starts talking (app_core does
+ *        the same on touch)
+ */
+static void provider_prewarm(void)
+{
+#if HOST_HAVE_PROVIDERS
+    if (s_opts.provider == PROVIDER_AZURE) {
+        azure_realtime_prewarm();
+    } else if (s_opts.provider == PROVIDER_COZE) {
+        coze_ws_prewarm();
+    }
+#endif
+}
+
+#if HOST_HAVE_PROVIDERS
+static void on_audio_delta(const uint8_t *data, size_t size)
+{
+    if (s_state == APP_STATE_PROCESSING) {
+        set_state(APP_STATE_SPEAKING);
+        audio_pipeline_start_playback();
+        s_playback_started = true;
+    }
+    s_audio_bytes_out += size;
+    if (audio_player_write(data, size, 100) < (int)size) {
+        s_player_drops++;
+    }
+}
+
+static void azure_event_callback(const azure_event_t *event, void *user_data)
+{
+    if (event->type == AZURE_MSG_TYPE_RESPONSE_AUDIO_DELTA && event->audio_data && event->audio_size) {
+        on_audio_delta(event->audio_data, event->audio_size);
+    } else if (event->type == AZURE_MSG_TYPE_RESPONSE_DONE) {
+        s_response_done = true;
+    } else if (event->type == AZURE_MSG_TYPE_ERROR) {
+        ESP_LOGE(TAG, "❌ Provider error: %s", event->error_message ? event->error_message : "?");
+    }
+}
+
+static void coze_event_callback(const coze_event_t *event, void *user_data)
+{
+    if (event->type == COZE_MSG_TYPE_RESPONSE_AUDIO_DELTA && event->audio_data && event->audio_size) {
+        on_audio_delta(event->audio_data, event->audio_size);
+    } else if (event->type == COZE_MSG_TYPE_RESPONSE_DONE) {
+        s_response_done = true;
+    } else if (event->type == COZE_MSG_TYPE_ERROR) {
+        ESP_LOGE(TAG, "❌ Provider error: %s", event->error_message ? event->error_message : "?");
+    }
+}
+#endif
+
+/**
+ * @brief Start the provider and wait until it accepts audio
+ */
+static esp_err_t provider_start(void)
+{
+    if (s_opts.provider == PROVIDER_NONE) {
+        return ESP_OK;
+    }
+
+#if HOST_HAVE_PROVIDERS
+    if (s_opts.provider == PROVIDER_AZURE) {
+        azure_realtime_config_t cfg = AZURE_REALTIME_DEFAULT_CONFIG();
+        cfg.api_key = "standin";
+        cfg.endpoint = "standin.local";
+        cfg.resource_name = "standin";
+        cfg.callback = azure_event_callback;
+        ESP_ERROR_CHECK(azure_realtime_init());
+        ESP_ERROR_CHECK(azure_realtime_configure(&cfg));
+        ESP_ERROR_CHECK(azure_realtime_register_callback(azure_event_callback, NULL));
+        ESP_ERROR_CHECK(azure_realtime_start_task());
+    } else {
+        coze_ws_config_t cfg = COZE_WS_DEFAULT_CONFIG();
+        cfg.callback = coze_event_callback;
+        ESP_ERROR_CHECK(coze_ws_init());
+        ESP_ERROR_CHECK(coze_ws_configure(&cfg));
+        ESP_ERROR_CHECK(coze_ws_register_callback(coze_event_callback, NULL));
+        ESP_ERROR_CHECK(coze_ws_start_task());
+        ESP_ERROR_CHECK(coze_ws_connect());
+    }
+
+    int64_t deadline = host_clock_now_us() + (int64_t)READY_TIMEOUT_MS * 1000;
+    while (host_clock_now_us() < deadline) {
+        bool ready = (s_opts.provider == PROVIDER_AZURE) ?
+                     azure_realtime_get_state() == AZURE_STATE_READY :
+                     coze_ws_get_state() == COZE_STATE_READY;
+        if (ready) {
+            ESP_LOGI(TAG, "✅ Provider ready after %lld ms", (long long)(host_clock_now_us() / 1000));
+            return ESP_OK;
+        }
+        vTaskDelay(pdMS_TO_TICKS(POLL_MS));
+    }
+    ESP_LOGE(TAG, "❌ Provider not ready after %d ms", READY_TIMEOUT_MS);
+    return ESP_ERR_TIMEOUT;
+#else
+    ESP_LOGE(TAG, "❌ Built without cJSON: only --provider none is available");
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+// ============================================
+// Turn Logic (mirrors app_core)
+// ============================================
+
+static void record_callback(const uint8_t *data, size_t size, vad_state_t vad_state, void *user_data)
+{
+    if (s_state != APP_STATE_LISTENING) {
+        return;
+    }
+
+    TRACE_EVENT(TRACE_EV_AUDIO_CB, size, vad_state);
+    if (vad_state == VAD_STATE_VOICE_START) {
+        provider_prewarm();
+    }
+    if (provider_send_audio(data, size) != ESP_OK) {
+        s_send_errors++;
+    }
+
+    if (vad_state == VAD_STATE_VOICE_END) {
+        s_utterances++;
+        ESP_LOGI(TAG, "🎤 VAD: Voice END #%lu at %lld ms", (unsigned long)s_utterances,
+                 (long long)(host_clock_now_us() / 1000));
+        if (s_opts.provider == PROVIDER_NONE) {
+            return;
+        }
+
+        s_response_done = false;
+        s_turn_start_us = host_clock_now_us();
+        set_state(APP_STATE_PROCESSING);
+        latency_ledger_begin_turn(ledger_provider());
+        provider_commit();
+    }
+}
+
+/**
+ * @brief Advance PROCESSING / SPEAKING back to LISTENING
+ */
+static void poll_turn(void)
+{
+    if (s_state == APP_STATE_LISTENING) {
+        return;
+    }
+
+    bool drained = !s_playback_started || audio_player_get_buffer_level() == 0;
+    if (s_response_done && drained) {
+        latency_ledger_end_turn();
+        s_turns_completed++;
+    } else if (host_clock_now_us() - s_turn_start_us > (int64_t)RESPONSE_TIMEOUT_MS * 1000) {
+        ESP_LOGW(TAG, "⚠️ Turn timed out");
+        latency_ledger_abort_turn();
+        s_turns_timed_out++;
+    } else {
+        return;
+    }
+
+    if (s_playback_started) {
+        audio_pipeline_stop_playback();
+        s_playback_started = false;
+    }
+    set_state(APP_STATE_LISTENING);
+}
+
+// ============================================
+// Report
+// ============================================
+
+static void print_task(const host_task_stats_t *stats, void *ctx)
+{
+    FILE *out = ctx;
+    fprintf(out, "  %-16s cpu=%8.1f ms  queue_fail=%lu  ringbuf_fail=%lu\n", stats->name,
+            stats->cpu_us / 1000.0, (unsigned long)stats->queue_send_fail,
+            (unsigned long)stats->ringbuf_send_fail);
+}
+
+typedef struct {
+    FILE *out;
+    bool first;
+} json_ctx_t;
+
+static void json_task(const host_task_stats_t *stats, void *ctx)
+{
+    json_ctx_t *j = ctx;
+    fprintf(j->out, "%s\n    {\"name\":\"%s\",\"cpu_us\":%llu,\"queue_send_fail\":%lu,\"ringbuf_send_fail\":%lu}",
+            j->first ? "" : ",", stats->name, (unsigned long long)stats->cpu_us,
+            (unsigned long)stats->queue_send_fail, (unsigned long)stats->ringbuf_send_fail);
+    j->first = false;
+}
+
+#if HOST_HAVE_PROVIDERS
+static void print_link(const realtime_link_stats_t *stats, void *ctx)
+{
+    if (stats->attempts == 0) {
+        return;
+    }
+    fprintf((FILE *)ctx, "link %s: attempts %lu, connects %lu (%lu resumed), ready %lu, prewarms %lu\n"
+            "  handshake full %lu ms, resumed %lu ms; connect-to-ready avg %lu ms, last %lu ms\n",
+            stats->name, (unsigned long)stats->attempts, (unsigned long)stats->connects,
+            (unsigned long)stats->resumed, (unsigned long)stats->ready, (unsigned long)stats->prewarms,
+            (unsigned long)stats->handshake_full_avg_ms, (unsigned long)stats->handshake_resumed_avg_ms,
+            (unsigned long)stats->ready_avg_ms, (unsigned long)stats->ready_last_ms);
+}
+
+static void json_link(const realtime_link_stats_t *stats, void *ctx)
+{
+    json_ctx_t *j = ctx;
+    if (stats->attempts == 0) {
+        return;
+    }
+    fprintf(j->out, "%s\n    {\"name\":\"%s\",\"attempts\":%lu,\"connects\":%lu,\"resumed\":%lu,\"ready\":%lu,"
+            "\"prewarms\":%lu,\"handshake_full_ms\":%lu,\"handshake_resumed_ms\":%lu,\"ready_avg_ms\":%lu}",
+            j->first ? "" : ",", stats->name, (unsigned long)stats->attempts, (unsigned long)stats->connects,
+            (unsigned long)stats->resumed, (unsigned long)stats->ready, (unsigned long)stats->prewarms,
+            (unsigned long)stats->handshake_full_avg_ms, (unsigned long)stats->handshake_resumed_avg_ms,
+            (unsigned long)stats->ready_avg_ms);
+    j->first = false;
+}
+
+static void print_spool(const capture_spool_stats_t *stats, void *ctx)
+{
+    if (stats->spooled_bytes == 0) {
+        return;
+    }
+    fprintf((FILE *)ctx, "spool %s: spooled %llu, replayed %llu (%lu rewinds), evicted %llu, dropped %llu, "
+            "busy %llu, overflow %llu, max depth %lu bytes\n",
+            stats->name, (unsigned long long)stats->spooled_bytes, (unsigned long long)stats->replayed_bytes,
+            (unsigned long)stats->rewinds, (unsigned long long)stats->evicted_bytes,
+            (unsigned long long)stats->dropped_bytes, (unsigned long long)stats->busy_bytes,
+            (unsigned long long)stats->overflow_bytes,
+            (unsigned long)stats->max_depth_bytes);
+}
+
+static void json_spool(const capture_spool_stats_t *stats, void *ctx)
+{
+    json_ctx_t *j = ctx;
+    if (stats->spooled_bytes == 0) {
+        return;
+    }
+    fprintf(j->out, "%s\n    {\"name\":\"%s\",\"spooled\":%llu,\"replayed\":%llu,\"rewinds\":%lu,\"evicted\":%llu,"
+            "\"dropped\":%llu,\"busy\":%llu,\"overflow\":%llu,\"max_depth\":%lu}",
+            j->first ? "" : ",", stats->name, (unsigned long long)stats->spooled_bytes,
+            (unsigned long long)stats->replayed_bytes, (unsigned long)stats->rewinds,
+            (unsigned long long)stats->evicted_bytes, (unsigned long long)stats->dropped_bytes,
+            (unsigned long long)stats->busy_bytes, (unsigned long long)stats->overflow_bytes, (unsigned long)stats->max_depth_bytes);
+    j->first = false;
+}
+#endif
+
+static void write_report(FILE *out, bool json, int64_t wall_us)
+{
+    host_codec_stats_t mic = {0};
+    host_codec_stats_t spk = {0};
+    host_codec_get_stats(s_mic, &mic);
+    host_codec_get_stats(s_spk, &spk);
+    host_ws_standin_stats_t ws = {0};
+    host_ws_standin_get_stats(&ws);
+    latency_provider_t provider = ledger_provider();
+
+    if (!json) {
+        fprintf(out, "\n===== Replay Report =====\n");
+        fprintf(out, "virtual time %.2f s (speed %.1fx), utterances %lu, turns %lu, timeouts %lu\n",
+                wall_us / 1e6, s_opts.speed, (unsigned long)s_utterances,
+                (unsigned long)s_turns_completed, (unsigned long)s_turns_timed_out);
+        if (s_opts.provider != PROVIDER_NONE) {
+            fprintf(out, "latency (%s, ms from voice end):\n", latency_ledger_provider_to_string(provider));
+            for (int m = LATENCY_MARK_COMMIT_SENT; m < LATENCY_MARK_MAX; m++) {
+                latency_stats_t st;
+                if (latency_ledger_get_stats(provider, m, &st) == ESP_OK && st.count > 0) {
+                    fprintf(out, "  %-20s n=%-3lu p50=%-6lu p90=%-6lu p99=%lu\n",
+                            latency_ledger_mark_to_string(m), (unsigned long)st.count,
+                            (unsigned long)st.p50_ms, (unsigned long)st.p90_ms, (unsigned long)st.p99_ms);
+                }
+            }
+        }
+        fprintf(out, "mic: %llu bytes, %lu reads, %lu late\n", (unsigned long long)mic.bytes,
+                (unsigned long)mic.calls, (unsigned long)mic.late_reads);
+        fprintf(out, "speaker: %llu bytes, %lu writes, %lu underruns\n", (unsigned long long)spk.bytes,
+                (unsigned long)spk.calls, (unsigned long)spk.underruns);
+        fprintf(out, "provider: sends failed %lu, response bytes %llu, player drops %lu\n",
+                (unsigned long)s_send_errors, (unsigned long long)s_audio_bytes_out,
+                (unsigned long)s_player_drops);
+        fprintf(out, "stand-in: connects %lu (%lu resumed, %lu dropped), frames in %lu, commits %lu "
+                "(%lu empty), responses %lu, deltas %lu\n",
+                (unsigned long)ws.connects, (unsigned long)ws.resumed, (unsigned long)ws.drops,
+                (unsigned long)ws.frames_in, (unsigned long)ws.commits, (unsigned long)ws.empty_commits,
+                (unsigned long)ws.responses, (unsigned long)ws.deltas_out);
+#if HOST_HAVE_PROVIDERS
+        realtime_link_foreach(print_link, out);
+        capture_spool_foreach(print_spool, out);
+#endif
+        fprintf(out, "tasks:\n");
+        host_task_foreach(print_task, out);
+        return;
+    }
+
+    fprintf(out, "{\n  \"virtual_ms\": %lld,\n  \"speed\": %.2f,\n", (long long)(wall_us / 1000), s_opts.speed);
+    fprintf(out, "  \"utterances\": %lu,\n  \"turns\": %lu,\n  \"timeouts\": %lu,\n",
+            (unsigned long)s_utterances, (unsigned long)s_turns_completed, (unsigned long)s_turns_timed_out);
+    fprintf(out, "  \"latency\": {");
+    bool first = true;
+    for (int m = LATENCY_MARK_COMMIT_SENT; m < LATENCY_MARK_MAX && s_opts.provider != PROVIDER_NONE; m++) {
+        latency_stats_t st;
+        if (latency_ledger_get_stats(provider, m, &st) == ESP_OK && st.count > 0) {
+            fprintf(out, "%s\n    \"%s\": {\"count\":%lu,\"p50\":%lu,\"p90\":%lu,\"p99\":%lu}",
+                    first ? "" : ",", latency_ledger_mark_to_string(m), (unsigned long)st.count,
+                    (unsigned long)st.p50_ms, (unsigned long)st.p90_ms, (unsigned long)st.p99_ms);
+            first = false;
+        }
+    }
+    fprintf(out, "\n  },\n");
+    fprintf(out, "  \"mic\": {\"bytes\":%llu,\"reads\":%lu,\"late_reads\":%lu},\n",
+            (unsigned long long)mic.bytes, (unsigned long)mic.calls, (unsigned long)mic.late_reads);
+    fprintf(out, "  \"speaker\": {\"bytes\":%llu,\"writes\":%lu,\"underruns\":%lu},\n",
+            (unsigned long long)spk.bytes, (unsigned long)spk.calls, (unsigned long)spk.underruns);
+    fprintf(out, "  \"provider\": {\"send_errors\":%lu,\"response_bytes\":%llu,\"player_drops\":%lu},\n",
+            (unsigned long)s_send_errors, (unsigned long long)s_audio_bytes_out, (unsigned long)s_player_drops);
+    fprintf(out, "  \"standin\": {\"connects\":%lu,\"resumed\":%lu,\"drops\":%lu,\"frames_in\":%lu,"
+            "\"commits\":%lu,\"empty_commits\":%lu,\"responses\":%lu,\"deltas\":%lu},\n",
+            (unsigned long)ws.connects, (unsigned long)ws.resumed, (unsigned long)ws.drops,
+            (unsigned long)ws.frames_in, (unsigned long)ws.commits, (unsigned long)ws.empty_commits,
+            (unsigned long)ws.responses, (unsigned long)ws.deltas_out);
+    json_ctx_t j = { .out = out, .first = true };
+    fprintf(out, "  \"links\": [");
+#if HOST_HAVE_PROVIDERS
+    realtime_link_foreach(json_link, &j);
+#endif
+    fprintf(out, "\n  ],\n");
+    fprintf(out, "  \"spools\": [");
+    j.first = true;
+#if HOST_HAVE_PROVIDERS
+    capture_spool_foreach(json_spool, &j);
+#endif
+    fprintf(out, "\n  ],\n");
+    fprintf(out, "  \"tasks\": [");
+    j.first = true;
+    host_task_foreach(json_task, &j);
+    fprintf(out, "\n  ]\n}\n");
+}
+
+// ============================================
+// Main
+// ============================================
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "usage: %s --in speech.wav [options]\n"
+            "  --out PATH        write speaker output to a WAV file\n"
+            "  --provider NAME   azure (default), coze or none (DSP/VAD only)\n"
+            "  --response PATH   8 kHz mono WAV the stand-in answers with (default: 1 s tone)\n"
+            "  --speed N         virtual clock speed (default 1.0)\n"
+            "  --unpaced         do not pace codec I/O (DSP throughput runs)\n"
+            "  --drop            stand-in closes the connection after every response\n"
+            "  --drop-mid N      stand-in closes the connection after N audio messages of every utterance\n"
+            "  --no-tickets      stand-in issues no TLS session tickets (full handshakes)\n"
+            "  --trace PATH      write the trace ring as Chrome trace JSON\n"
+            "  --report PATH     write the report as JSON\n"
+            "  --verbose         debug logging\n", prog);
+}
+
+static bool parse_args(int argc, char **argv)
+{
+    static const struct option long_opts[] = {
+        { "in",       required_argument, NULL, 'i' },
+        { "out",      required_argument, NULL, 'o' },
+        { "provider", required_argument, NULL, 'p' },
+        { "response", required_argument, NULL, 'r' },
+        { "speed",    required_argument, NULL, 's' },
+        { "unpaced",  no_argument,       NULL, 'u' },
+        { "drop",     no_argument,       NULL, 'd' },
+        { "drop-mid", required_argument, NULL, 'm' },
+        { "no-tickets", no_argument,     NULL, 'n' },
+        { "trace",    required_argument, NULL, 't' },
+        { "report",   required_argument, NULL, 'j' },
+        { "verbose",  no_argument,       NULL, 'v' },
+        { "help",     no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+
+    int c;
+    while ((c = getopt_long(argc, argv, "i:o:p:r:s:udm:nt:j:vh", long_opts, NULL)) != -1) {
+        switch (c) {
+        case 'i': s_opts.in_path = optarg; break;
+        case 'o': s_opts.out_path = optarg; break;
+        case 'r': s_opts.response_path = optarg; break;
+        case 's': s_opts.speed = atof(optarg); break;
+        case 'u': s_opts.paced = false; break;
+        case 'd': s_opts.drop = true; break;
+        case 'm': s_opts.drop_mid = (uint32_t)atoi(optarg); break;
+        case 'n': s_opts.no_tickets = true; break;
+        case 't': s_opts.trace_path = optarg; break;
+        case 'j': s_opts.report_path = optarg; break;
+        case 'v': s_opts.verbose = true; break;
+        case 'p':
+            if (strcmp(optarg, "azure") == 0) {
+                s_opts.provider = PROVIDER_AZURE;
+            } else if (strcmp(optarg, "coze") == 0) {
+                s_opts.provider = PROVIDER_COZE;
+            } else if (strcmp(optarg, "none") == 0) {
+                s_opts.provider = PROVIDER_NONE;
+            } else {
+                return false;
+            }
+            break;
+        default:
+            return false;
+        }
+    }
+    return s_opts.in_path != NULL && s_opts.speed > 0.0;
+}
+
+int main(int argc, char **argv)
+{
+    if (!parse_args(argc, argv)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    host_log_set_level(s_opts.verbose ? ESP_LOG_DEBUG : ESP_LOG_INFO);
+    host_task_register_current("main");
+    host_clock_set_speed(s_opts.speed);
+    latency_ledger_set_clock(host_clock_now_us);
+    latency_ledger_init();
+
+    host_ws_standin_config_t ws_cfg = HOST_WS_STANDIN_DEFAULT_CONFIG();
+    ws_cfg.drop_after_response = s_opts.drop;
+    ws_cfg.drop_mid_utterance = s_opts.drop_mid;
+    ws_cfg.session_tickets = !s_opts.no_tickets;
+    int16_t *response = NULL;
+    if (s_opts.response_path) {
+        size_t samples = 0;
+        uint32_t rate = 0;
+        if (host_wav_load(s_opts.response_path, &response, &samples, &rate) != ESP_OK || rate != 8000) {
+            ESP_LOGE(TAG, "❌ --response must be an 8 kHz mono 16-bit WAV");
+            return 1;
+        }
+        ws_cfg.response_pcm = response;
+        ws_cfg.response_samples = samples;
+    }
+    host_ws_standin_configure(&ws_cfg);
+
+    s_mic = host_codec_wav_open_input(s_opts.in_path, s_opts.paced);
+    s_spk = host_codec_wav_open_output(s_opts.out_path, s_opts.paced);
+    if (s_mic == NULL || s_spk == NULL) {
+        return 1;
+    }
+
+    // The recorder would fail to open the mic and the replay never end
+    audio_pipeline_config_t audio_cfg = AUDIO_PIPELINE_DEFAULT_CONFIG();
+    if (host_codec_input_rate(s_mic) != audio_cfg.sample_rate) {
+        ESP_LOGE(TAG, "❌ --in is %lu Hz but the recorder runs at %lu Hz; resample it first",
+                 (unsigned long)host_codec_input_rate(s_mic), (unsigned long)audio_cfg.sample_rate);
+        return 1;
+    }
+
+    ESP_ERROR_CHECK(audio_pipeline_init());
+    audio_cfg.record_cb = record_callback;
+    ESP_ERROR_CHECK(audio_pipeline_configure(&audio_cfg));
+    ESP_ERROR_CHECK(audio_pipeline_start_tasks());
+
+    if (provider_start() != ESP_OK) {
+        return 1;
+    }
+
+    trace_ring_clear();
+    int64_t start_us = host_clock_now_us();
+    ESP_ERROR_CHECK(audio_pipeline_start_recording());
+
+    // Run until the file is consumed, the tail of silence has closed the
+    // last utterance and any turn in flight has finished
+    int64_t tail_start_us = 0;
+    for (;;) {
+        vTaskDelay(pdMS_TO_TICKS(POLL_MS));
+        poll_turn();
+
+        if (!host_codec_input_exhausted(s_mic)) {
+            continue;
+        }
+        if (tail_start_us == 0) {
+            tail_start_us = host_clock_now_us();
+        }
+        if (host_clock_now_us() - tail_start_us >= (int64_t)TAIL_MS * 1000 &&
+            s_state == APP_STATE_LISTENING) {
+            break;
+        }
+    }
+
+    audio_pipeline_stop_recording();
+    int64_t elapsed_us = host_clock_now_us() - start_us;
+
+    if (s_opts.trace_path) {
+        FILE *f = fopen(s_opts.trace_path, "w");
+        uint32_t written = 0;
+        if (f == NULL || trace_ring_export_json(f, &written) != ESP_OK) {
+            ESP_LOGE(TAG, "❌ Failed to write %s", s_opts.trace_path);
+        } else {
+            ESP_LOGI(TAG, "📝 %lu trace events -> %s", (unsigned long)written, s_opts.trace_path);
+        }
+        if (f) {
+            fclose(f);
+        }
+    }
+
+    write_report(stdout, false, elapsed_us);
+    if (s_opts.report_path) {
+        FILE *f = fopen(s_opts.report_path, "w");
+        if (f != NULL) {
+            write_report(f, true, elapsed_us);
+            fclose(f);
+        }
+    }
+
+    host_codec_wav_release(s_spk);
+    free(response);
+    // Firmware tasks never exit; leave them to process teardown
+    fflush(stdout);
+    _exit(s_turns_timed_out > 0 ? 3 : 0);
+}
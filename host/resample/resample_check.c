@@ -0,0 +1,318 @@
+/**
+ * @file resample_check.c
+ * @brief Host accuracy check of the fused audio_resample kernels
+ *
+ * Runs every fused tuple over generated tones in 20 ms frames and reports:
+ *
+ *   THD+N     1 kHz at -6 dBFS through the kernel; the best-fit sine at the
+ *             output rate is removed and the remainder (harmonics, images,
+ *             aliases, quantization) compared with the tone
+ *   stopband  rate changes only: when decimating, a tone past the output
+ *             Nyquist, which should not come out; when interpolating, the
+ *             images of a tone near the input Nyquist
+ *   seams     the same signal in 20 ms frames and in ragged 1..23 ms frames
+ *             must give bit-identical output, so history and phase carry
+ *             across frame boundaries
+ *
+ *   resample_check [--thdn-db -60] [--stop-db -50] [--report report.json]
+ *
+ * Exits non-zero when a kernel misses a limit.
+ */
+
+#include "audio_resample_fused.h"
+#include "host_shim.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include "esp_log.h"
+
+#define SIGNAL_MS               2000
+#define SETTLE_MS               100     // Filter start-up excluded from the fit
+#define FRAME_MS                20
+#define TONE_HZ                 1000.0
+#define TONE_AMP                16384.0 // -6 dBFS
+
+// ============================================
+// Private Types and Variables
+// ============================================
+
+typedef struct {
+    av_render_audio_frame_info_t in;
+    av_render_audio_frame_info_t out;
+} check_case_t;
+
+typedef struct {
+    const char *name;
+    double thdn_db;
+    double stop_db;                     // Alias or image level, 0 without a rate change
+    bool seams_ok;
+    bool pass;
+} check_result_t;
+
+static const check_case_t s_cases[] = {
+    {{2, 16, 16000}, {1, 16, 16000}},
+    {{1, 16, 16000}, {2, 16, 16000}},
+    {{2, 16, 16000}, {1, 16, 8000}},
+    {{2, 16, 48000}, {1, 16, 16000}},
+    {{1, 16, 16000}, {1, 16, 8000}},
+    {{1, 16, 48000}, {1, 16, 16000}},
+    {{1, 16, 8000}, {1, 16, 16000}},
+    {{1, 16, 16000}, {1, 16, 24000}},
+    {{1, 16, 16000}, {1, 16, 48000}},
+    {{1, 16, 8000}, {2, 16, 16000}},
+    {{1, 16, 16000}, {2, 16, 24000}},
+    {{1, 16, 8000}, {2, 16, 24000}},
+};
+
+#define CASE_COUNT  (sizeof(s_cases) / sizeof(s_cases[0]))
+
+// ============================================
+// Signal Helpers
+// ============================================
+
+static int16_t *make_tone(const av_render_audio_frame_info_t *info, double hz, int samples)
+{
+    int16_t *pcm = (int16_t *)malloc(samples * info->channel * sizeof(int16_t));
+    for (int i = 0; i < samples; i++) {
+        double v = TONE_AMP * sin(2.0 * M_PI * hz * i / info->sample_rate);
+        for (int c = 0; c < info->channel; c++) {
+            pcm[i * info->channel + c] = (int16_t)lrint(v);
+        }
+    }
+    return pcm;
+}
+
+/**
+ * @brief Push a signal through a fresh converter in 20 ms or ragged frames
+ *
+ * @return Output samples per channel; *out is malloc'd
+ */
+static int run_frames(const check_case_t *c, const int16_t *pcm, int samples, bool ragged, int16_t **out)
+{
+    resample_fused_handle_t h = resample_fused_open(&c->in, &c->out);
+    if (h == NULL) {
+        *out = NULL;
+        return -1;
+    }
+    int in_frame = c->in.sample_rate * FRAME_MS / 1000;
+    int cap = resample_fused_max_out_size(h, samples * c->in.channel * 2) + in_frame * 8;
+    uint8_t *dst = (uint8_t *)malloc(cap);
+    int total = 0;
+    int done = 0;
+    for (int i = 0; done < samples; i++) {
+        int n = ragged ? (int)(c->in.sample_rate / 1000) * (1 + (i * 7) % 23) : in_frame;
+        if (n > samples - done) {
+            n = samples - done;
+        }
+        total += resample_fused_process(h, (const uint8_t *)(pcm + done * c->in.channel),
+                                        n * c->in.channel * 2, dst + total);
+        done += n;
+    }
+    resample_fused_close(h);
+    *out = (int16_t *)dst;
+    return total / (c->out.channel * 2);
+}
+
+/**
+ * @brief Fit a + b sin + c cos at hz and return residual / tone power in dB
+ */
+static double thdn_db(const int16_t *pcm, int channels, int rate, int from, int to, double hz)
+{
+    double ss = 0, sc = 0, cc = 0, s1 = 0, c1 = 0, n = 0;
+    double ys = 0, yc = 0, y1 = 0;
+    for (int i = from; i < to; i++) {
+        double w = 2.0 * M_PI * hz * i / rate;
+        double s = sin(w), co = cos(w), y = pcm[i * channels];
+        ss += s * s;
+        sc += s * co;
+        cc += co * co;
+        s1 += s;
+        c1 += co;
+        n += 1;
+        ys += y * s;
+        yc += y * co;
+        y1 += y;
+    }
+    // Normal equations of the 3-term least squares, solved by Cramer's rule
+    double m[3][3] = {{n, s1, c1}, {s1, ss, sc}, {c1, sc, cc}};
+    double r[3] = {y1, ys, yc};
+    double det = m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+                 m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+                 m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+    double x[3];
+    for (int k = 0; k < 3; k++) {
+        double t[3][3];
+        memcpy(t, m, sizeof(t));
+        for (int j = 0; j < 3; j++) {
+            t[j][k] = r[j];
+        }
+        x[k] = (t[0][0] * (t[1][1] * t[2][2] - t[1][2] * t[2][1]) -
+                t[0][1] * (t[1][0] * t[2][2] - t[1][2] * t[2][0]) +
+                t[0][2] * (t[1][0] * t[2][1] - t[1][1] * t[2][0])) / det;
+    }
+    double tone = 0, resid = 0;
+    for (int i = from; i < to; i++) {
+        double w = 2.0 * M_PI * hz * i / rate;
+        double fit = x[1] * sin(w) + x[2] * cos(w);
+        double e = pcm[i * channels] - x[0] - fit;
+        tone += fit * fit;
+        resid += e * e;
+    }
+    return 10.0 * log10((resid + 1e-9) / (tone + 1e-9));
+}
+
+static double rms(const int16_t *pcm, int channels, int from, int to)
+{
+    double acc = 0;
+    for (int i = from; i < to; i++) {
+        acc += (double)pcm[i * channels] * pcm[i * channels];
+    }
+    return sqrt(acc / (to > from ? to - from : 1));
+}
+
+// ============================================
+// Checks
+// ============================================
+
+static void check_case(const check_case_t *c, double thdn_limit, double stop_limit, check_result_t *res)
+{
+    int samples = c->in.sample_rate * SIGNAL_MS / 1000;
+    int settle = c->out.sample_rate * SETTLE_MS / 1000;
+    resample_fused_handle_t h = resample_fused_open(&c->in, &c->out);
+    res->name = resample_fused_name(h);
+    resample_fused_close(h);
+
+    int16_t *tone = make_tone(&c->in, TONE_HZ, samples);
+    int16_t *out = NULL;
+    int16_t *ragged = NULL;
+    int n = run_frames(c, tone, samples, false, &out);
+    int n_ragged = run_frames(c, tone, samples, true, &ragged);
+    res->thdn_db = thdn_db(out, c->out.channel, c->out.sample_rate, settle, n, TONE_HZ);
+    res->seams_ok = (n == n_ragged) && memcmp(out, ragged, n * c->out.channel * 2) == 0;
+    if (c->out.channel == 2) {
+        for (int i = 0; i < n; i++) {
+            res->seams_ok &= out[2 * i] == out[2 * i + 1];
+        }
+    }
+    free(out);
+    free(ragged);
+    free(tone);
+
+    res->stop_db = 0;
+    if (c->in.sample_rate > c->out.sample_rate) {
+        // Output Nyquist plus 15 %: anything that comes out is an alias
+        double hz = c->out.sample_rate * 0.5 * 1.15;
+        int16_t *stop = make_tone(&c->in, hz, samples);
+        n = run_frames(c, stop, samples, false, &out);
+        res->stop_db = 20.0 * log10((rms(out, c->out.channel, settle, n) + 1e-9) / (TONE_AMP / sqrt(2.0)));
+        free(out);
+        free(stop);
+    } else if (c->in.sample_rate < c->out.sample_rate) {
+        // Tone near the input Nyquist: its images land just past it
+        double hz = c->in.sample_rate * 0.35;
+        int16_t *stop = make_tone(&c->in, hz, samples);
+        n = run_frames(c, stop, samples, false, &out);
+        res->stop_db = thdn_db(out, c->out.channel, c->out.sample_rate, settle, n, hz);
+        free(out);
+        free(stop);
+    }
+    res->pass = res->seams_ok && res->thdn_db <= thdn_limit &&
+                (c->in.sample_rate == c->out.sample_rate || res->stop_db <= stop_limit);
+}
+
+static void write_report(const char *path, const check_result_t *res, int count)
+{
+    FILE *f = strcmp(path, "-") == 0 ? stdout : fopen(path, "w");
+    if (f == NULL) {
+        fprintf(stderr, "resample_check: cannot write %s\n", path);
+        return;
+    }
+    fprintf(f, "{\n  \"kernels\": [\n");
+    for (int i = 0; i < count; i++) {
+        fprintf(f, "    {\"in\": \"%dch %dHz\", \"out\": \"%dch %dHz\", \"kernel\": \"%s\", "
+                "\"thdn_db\": %.1f, \"stop_db\": %.1f, \"seams\": %s, \"pass\": %s}%s\n",
+                s_cases[i].in.channel, (int)s_cases[i].in.sample_rate, s_cases[i].out.channel,
+                (int)s_cases[i].out.sample_rate, res[i].name, res[i].thdn_db, res[i].stop_db,
+                res[i].seams_ok ? "true" : "false", res[i].pass ? "true" : "false", i + 1 < count ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    if (f != stdout) {
+        fclose(f);
+    }
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --thdn-db DB     highest THD+N at 1 kHz, -6 dBFS (default -60)\n"
+            "  --stop-db DB     highest alias or image level (default -50)\n"
+            "  --report PATH    write results as JSON (\"-\" for stdout)\n",
+            argv0);
+}
+
+int main(int argc, char **argv)
+{
+    double thdn_limit = -60.0;
+    double stop_limit = -50.0;
+    const char *report_path = NULL;
+    static const struct option long_opts[] = {
+        {"thdn-db", required_argument, NULL, 't'},
+        {"stop-db", required_argument, NULL, 's'},
+        {"report", required_argument, NULL, 'r'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", long_opts, NULL)) != -1) {
+        switch (opt) {
+            case 't':
+                thdn_limit = atof(optarg);
+                break;
+            case 's':
+                stop_limit = atof(optarg);
+                break;
+            case 'r':
+                report_path = optarg;
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+
+    host_log_set_level(ESP_LOG_WARN);
+    if (host_media_lib_os_register() != ESP_OK) {
+        fprintf(stderr, "resample_check: media_lib OS port registration failed\n");
+        return 1;
+    }
+
+    check_result_t res[CASE_COUNT];
+    int failed = 0;
+    printf("%-22s %-16s %10s %10s %6s\n", "conversion", "kernel", "THD+N dB", "stop dB", "seams");
+    for (int i = 0; i < (int)CASE_COUNT; i++) {
+        const check_case_t *c = &s_cases[i];
+        char conv[32];
+        snprintf(conv, sizeof(conv), "%dch %dk -> %dch %dk", c->in.channel, (int)c->in.sample_rate / 1000,
+                 c->out.channel, (int)c->out.sample_rate / 1000);
+        if (!resample_fused_supported(&c->in, &c->out)) {
+            printf("%-22s no fused kernel\n", conv);
+            failed++;
+            memset(&res[i], 0, sizeof(res[i]));
+            res[i].name = "";
+            continue;
+        }
+        check_case(c, thdn_limit, stop_limit, &res[i]);
+        printf("%-22s %-16s %10.1f %10.1f %6s%s\n", conv, res[i].name, res[i].thdn_db, res[i].stop_db,
+               res[i].seams_ok ? "ok" : "BAD", res[i].pass ? "" : "  FAIL");
+        failed += res[i].pass ? 0 : 1;
+    }
+    if (report_path) {
+        write_report(report_path, res, (int)CASE_COUNT);
+    }
+    printf("%d of %d kernels within THD+N %.0f dB, stopband %.0f dB\n", (int)CASE_COUNT - failed, (int)CASE_COUNT,
+           thdn_limit, stop_limit);
+    return failed ? 1 : 0;
+}
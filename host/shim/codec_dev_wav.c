@@ -0,0 +1,479 @@
+/**
+ * @file codec_dev_wav.c
+ * @brief File-backed esp_codec_dev stand-in
+ *
+ * Input devices serve a WAV file the way the I2S RX DMA would serve the
+ * microphone: the file's channels are mapped onto the channel count the
+ * firmware opens with (a mono file feeds every mic slot), and paced reads
+ * complete when the virtual clock says the frame has been captured. Output
+ * devices record whatever the firmware writes into a WAV file and count the
+ * underruns a real DMA would have filled with silence.
+ */
+
+#include "host_shim.h"
+#include "esp_codec_dev.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "HOST_CODEC";
+
+// ============================================
+// WAV Files
+// ============================================
+
+typedef struct __attribute__((packed)) {
+    char riff[4];
+    uint32_t riff_size;
+    char wave[4];
+    char fmt[4];
+    uint32_t fmt_size;
+    uint16_t format;
+    uint16_t channels;
+    uint32_t sample_rate;
+    uint32_t byte_rate;
+    uint16_t block_align;
+    uint16_t bits_per_sample;
+    char data[4];
+    uint32_t data_size;
+} wav_header_t;
+
+static void wav_header_fill(wav_header_t *hdr, uint16_t channels, uint32_t rate, uint32_t data_size)
+{
+    memcpy(hdr->riff, "RIFF", 4);
+    hdr->riff_size = 36 + data_size;
+    memcpy(hdr->wave, "WAVE", 4);
+    memcpy(hdr->fmt, "fmt ", 4);
+    hdr->fmt_size = 16;
+    hdr->format = 1;
+    hdr->channels = channels;
+    hdr->sample_rate = rate;
+    hdr->byte_rate = rate * channels * 2;
+    hdr->block_align = channels * 2;
+    hdr->bits_per_sample = 16;
+    memcpy(hdr->data, "data", 4);
+    hdr->data_size = data_size;
+}
+
+/**
+ * @brief Parse a RIFF file up to the start of its PCM data
+ */
+static esp_err_t wav_open_read(FILE *f, uint16_t *channels, uint32_t *rate, uint32_t *data_size)
+{
+    uint8_t riff[12];
+    if (fread(riff, 1, sizeof(riff), f) != sizeof(riff) ||
+        memcmp(riff, "RIFF", 4) != 0 || memcmp(riff + 8, "WAVE", 4) != 0) {
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+
+    bool have_fmt = false;
+    for (;;) {
+        uint8_t chunk[8];
+        if (fread(chunk, 1, sizeof(chunk), f) != sizeof(chunk)) {
+            return ESP_ERR_NOT_FOUND;
+        }
+        uint32_t size = chunk[4] | (chunk[5] << 8) | (chunk[6] << 16) | ((uint32_t)chunk[7] << 24);
+
+        if (memcmp(chunk, "fmt ", 4) == 0) {
+            uint8_t fmt[16];
+            if (size < sizeof(fmt) || fread(fmt, 1, sizeof(fmt), f) != sizeof(fmt)) {
+                return ESP_ERR_INVALID_SIZE;
+            }
+            uint16_t format = fmt[0] | (fmt[1] << 8);
+            uint16_t bits = fmt[14] | (fmt[15] << 8);
+            if (format != 1 || bits != 16) {
+                ESP_LOGE(TAG, "Only 16-bit PCM WAV is supported (format=%u, bits=%u)", format, bits);
+                return ESP_ERR_NOT_SUPPORTED;
+            }
+            *channels = fmt[2] | (fmt[3] << 8);
+            *rate = fmt[4] | (fmt[5] << 8) | (fmt[6] << 16) | ((uint32_t)fmt[7] << 24);
+            fseek(f, (long)(size - sizeof(fmt) + (size & 1)), SEEK_CUR);
+            have_fmt = true;
+        } else if (memcmp(chunk, "data", 4) == 0) {
+            if (!have_fmt) {
+                return ESP_ERR_INVALID_STATE;
+            }
+            *data_size = size;
+            return ESP_OK;
+        } else {
+            fseek(f, (long)(size + (size & 1)), SEEK_CUR);
+        }
+    }
+}
+
+esp_err_t host_wav_load(const char *path, int16_t **samples, size_t *count, uint32_t *sample_rate)
+{
+    if (path == NULL || samples == NULL || count == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        ESP_LOGE(TAG, "Cannot open %s", path);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    uint16_t channels = 0;
+    uint32_t rate = 0;
+    uint32_t data_size = 0;
+    esp_err_t ret = wav_open_read(f, &channels, &rate, &data_size);
+    if (ret != ESP_OK) {
+        fclose(f);
+        return ret;
+    }
+    if (channels != 1) {
+        ESP_LOGE(TAG, "%s: expected mono, got %u channels", path, channels);
+        fclose(f);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    int16_t *buf = malloc(data_size ? data_size : 2);
+    if (buf == NULL) {
+        fclose(f);
+        return ESP_ERR_NO_MEM;
+    }
+    size_t n = fread(buf, sizeof(int16_t), data_size / sizeof(int16_t), f);
+    fclose(f);
+
+    *samples = buf;
+    *count = n;
+    if (sample_rate) {
+        *sample_rate = rate;
+    }
+    return ESP_OK;
+}
+
+// ============================================
+// Codec Devices
+// ============================================
+
+struct host_codec {
+    bool is_input;
+    bool paced;
+    bool opened;
+    char *path;
+    FILE *file;
+    pthread_mutex_t mutex;
+
+    // Input: source file layout
+    uint16_t file_channels;
+    uint32_t file_rate;
+    uint32_t data_remaining;
+
+    // Format requested by esp_codec_dev_open()
+    uint16_t channels;
+    uint32_t sample_rate;
+
+    // Pacing: virtual time at which the DMA has produced / consumed
+    // everything transferred so far
+    int64_t stream_start_us;
+    uint64_t stream_bytes;
+
+    uint32_t data_written;
+    bool exhausted;
+    bool muted;
+    host_codec_stats_t stats;
+};
+
+static struct host_codec *codec_alloc(const char *path, bool is_input, bool paced)
+{
+    struct host_codec *dev = calloc(1, sizeof(*dev));
+    if (dev == NULL) {
+        return NULL;
+    }
+    dev->is_input = is_input;
+    dev->paced = paced;
+    dev->path = path ? strdup(path) : NULL;
+    pthread_mutex_init(&dev->mutex, NULL);
+    return dev;
+}
+
+esp_codec_dev_handle_t host_codec_wav_open_input(const char *path, bool paced)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        ESP_LOGE(TAG, "Cannot open input %s", path);
+        return NULL;
+    }
+
+    struct host_codec *dev = codec_alloc(path, true, paced);
+    if (dev == NULL) {
+        fclose(f);
+        return NULL;
+    }
+
+    if (wav_open_read(f, &dev->file_channels, &dev->file_rate, &dev->data_remaining) != ESP_OK ||
+        dev->file_channels == 0) {
+        ESP_LOGE(TAG, "%s is not a 16-bit PCM WAV file", path);
+        fclose(f);
+        free(dev->path);
+        free(dev);
+        return NULL;
+    }
+    dev->file = f;
+    ESP_LOGI(TAG, "🎙️ Mic <- %s (%lu Hz, %u ch, %lu ms)", path,
+             (unsigned long)dev->file_rate, dev->file_channels,
+             (unsigned long)((uint64_t)dev->data_remaining * 1000 /
+                             ((uint64_t)dev->file_rate * dev->file_channels * 2)));
+    return dev;
+}
+
+esp_codec_dev_handle_t host_codec_wav_open_output(const char *path, bool paced)
+{
+    struct host_codec *dev = codec_alloc(path, false, paced);
+    if (dev == NULL) {
+        return NULL;
+    }
+
+    if (path != NULL) {
+        dev->file = fopen(path, "wb");
+        if (dev->file == NULL) {
+            ESP_LOGE(TAG, "Cannot create output %s", path);
+            free(dev->path);
+            free(dev);
+            return NULL;
+        }
+        // Placeholder header, rewritten on release
+        wav_header_t hdr;
+        wav_header_fill(&hdr, 1, 8000, 0);
+        fwrite(&hdr, sizeof(hdr), 1, dev->file);
+    }
+    return dev;
+}
+
+uint32_t host_codec_input_rate(esp_codec_dev_handle_t dev)
+{
+    return (dev != NULL && dev->is_input) ? dev->file_rate : 0;
+}
+
+bool host_codec_input_exhausted(esp_codec_dev_handle_t dev)
+{
+    if (dev == NULL) {
+        return true;
+    }
+    pthread_mutex_lock(&dev->mutex);
+    bool exhausted = dev->exhausted;
+    pthread_mutex_unlock(&dev->mutex);
+    return exhausted;
+}
+
+void host_codec_get_stats(esp_codec_dev_handle_t dev, host_codec_stats_t *stats)
+{
+    if (dev == NULL || stats == NULL) {
+        return;
+    }
+    pthread_mutex_lock(&dev->mutex);
+    *stats = dev->stats;
+    pthread_mutex_unlock(&dev->mutex);
+}
+
+void host_codec_wav_release(esp_codec_dev_handle_t dev)
+{
+    if (dev == NULL) {
+        return;
+    }
+
+    if (dev->file != NULL) {
+        if (!dev->is_input) {
+            wav_header_t hdr;
+            wav_header_fill(&hdr, dev->channels ? dev->channels : 1,
+                            dev->sample_rate ? dev->sample_rate : 8000, dev->data_written);
+            fseek(dev->file, 0, SEEK_SET);
+            fwrite(&hdr, sizeof(hdr), 1, dev->file);
+        }
+        fclose(dev->file);
+    }
+    pthread_mutex_destroy(&dev->mutex);
+    free(dev->path);
+    free(dev);
+}
+
+// ============================================
+// esp_codec_dev API
+// ============================================
+
+int esp_codec_dev_open(esp_codec_dev_handle_t dev, esp_codec_dev_sample_info_t *fs)
+{
+    if (dev == NULL || fs == NULL || fs->bits_per_sample != 16 || fs->channel == 0) {
+        return ESP_CODEC_DEV_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&dev->mutex);
+    if (dev->is_input && fs->sample_rate != dev->file_rate) {
+        // No resampling here: a mismatch would silently change pitch and timing
+        ESP_LOGE(TAG, "Mic opened at %lu Hz but %s is %lu Hz",
+                 (unsigned long)fs->sample_rate, dev->path, (unsigned long)dev->file_rate);
+        pthread_mutex_unlock(&dev->mutex);
+        return ESP_CODEC_DEV_NOT_SUPPORT;
+    }
+    dev->channels = fs->channel;
+    dev->sample_rate = fs->sample_rate;
+    dev->stats.sample_rate = fs->sample_rate;
+    dev->stream_start_us = host_clock_now_us();
+    dev->stream_bytes = 0;
+    dev->opened = true;
+    pthread_mutex_unlock(&dev->mutex);
+    return ESP_CODEC_DEV_OK;
+}
+
+int esp_codec_dev_close(esp_codec_dev_handle_t dev)
+{
+    if (dev == NULL) {
+        return ESP_CODEC_DEV_INVALID_ARG;
+    }
+    pthread_mutex_lock(&dev->mutex);
+    dev->opened = false;
+    if (dev->file != NULL && !dev->is_input) {
+        fflush(dev->file);
+    }
+    pthread_mutex_unlock(&dev->mutex);
+    return ESP_CODEC_DEV_OK;
+}
+
+/**
+ * @brief Virtual time at which the DMA completes the given stream position
+ */
+static int64_t stream_due_us(const struct host_codec *dev, uint64_t bytes)
+{
+    uint64_t bytes_per_sec = (uint64_t)dev->sample_rate * dev->channels * 2;
+    return dev->stream_start_us + (int64_t)(bytes * 1000000 / bytes_per_sec);
+}
+
+/**
+ * @brief Fill one interleaved frame of the opened layout from the file
+ */
+static bool read_frame(struct host_codec *dev, int16_t *frame)
+{
+    int16_t src[8];
+    uint16_t file_ch = dev->file_channels > 8 ? 8 : dev->file_channels;
+    size_t frame_bytes = (size_t)dev->file_channels * 2;
+
+    if (dev->data_remaining < frame_bytes ||
+        fread(src, 2, file_ch, dev->file) != file_ch) {
+        return false;
+    }
+    if (dev->file_channels > file_ch) {
+        fseek(dev->file, (long)(dev->file_channels - file_ch) * 2, SEEK_CUR);
+    }
+    dev->data_remaining -= frame_bytes;
+
+    for (uint16_t ch = 0; ch < dev->channels; ch++) {
+        frame[ch] = src[ch < file_ch ? ch : 0];
+    }
+    return true;
+}
+
+int esp_codec_dev_read(esp_codec_dev_handle_t dev, void *data, int len)
+{
+    if (dev == NULL || data == NULL || len <= 0 || !dev->is_input) {
+        return ESP_CODEC_DEV_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&dev->mutex);
+    if (!dev->opened) {
+        pthread_mutex_unlock(&dev->mutex);
+        return ESP_CODEC_DEV_WRONG_STATE;
+    }
+
+    int16_t *out = data;
+    size_t frames = (size_t)len / (dev->channels * 2);
+    for (size_t i = 0; i < frames; i++) {
+        if (dev->exhausted || !read_frame(dev, out + i * dev->channels)) {
+            // After EOF the mic hears silence, so VAD can close the utterance
+            dev->exhausted = true;
+            memset(out + i * dev->channels, 0, (size_t)dev->channels * 2);
+        }
+    }
+
+    int64_t now = host_clock_now_us();
+    int64_t frame_start = stream_due_us(dev, dev->stream_bytes);
+    int64_t frame_us = stream_due_us(dev, dev->stream_bytes + (uint64_t)len) - frame_start;
+    if (dev->paced && now - frame_start > 2 * frame_us) {
+        // The reader fell more than a frame behind: real DMA would have
+        // overwritten samples, so resynchronise instead of catching up
+        dev->stats.late_reads++;
+        dev->stream_start_us += now - frame_start - frame_us;
+    }
+    dev->stream_bytes += (uint64_t)len;
+    int64_t due = stream_due_us(dev, dev->stream_bytes);
+    dev->stats.bytes += (uint64_t)len;
+    dev->stats.calls++;
+    pthread_mutex_unlock(&dev->mutex);
+
+    if (dev->paced && due > now) {
+        host_clock_sleep_us(due - now);
+    }
+    return ESP_CODEC_DEV_OK;
+}
+
+int esp_codec_dev_write(esp_codec_dev_handle_t dev, void *data, int len)
+{
+    if (dev == NULL || data == NULL || len <= 0 || dev->is_input) {
+        return ESP_CODEC_DEV_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&dev->mutex);
+    if (!dev->opened) {
+        pthread_mutex_unlock(&dev->mutex);
+        return ESP_CODEC_DEV_WRONG_STATE;
+    }
+
+    int64_t now = host_clock_now_us();
+    if (dev->paced && now > stream_due_us(dev, dev->stream_bytes)) {
+        // DMA drained before this write arrived and played silence meanwhile
+        if (dev->stream_bytes > 0) {
+            dev->stats.underruns++;
+        }
+        dev->stream_start_us += now - stream_due_us(dev, dev->stream_bytes);
+    }
+
+    if (dev->file != NULL) {
+        if (dev->muted) {
+            static const int16_t zeros[512];
+            for (int left = len; left > 0; left -= (int)sizeof(zeros)) {
+                fwrite(zeros, 1, left < (int)sizeof(zeros) ? (size_t)left : sizeof(zeros), dev->file);
+            }
+        } else {
+            fwrite(data, 1, (size_t)len, dev->file);
+        }
+        dev->data_written += (uint32_t)len;
+    }
+
+    dev->stream_bytes += (uint64_t)len;
+    dev->stats.bytes += (uint64_t)len;
+    dev->stats.calls++;
+    int64_t due = stream_due_us(dev, dev->stream_bytes);
+    pthread_mutex_unlock(&dev->mutex);
+
+    // Blocks like i2s_channel_write() once the DMA queue (~2 frames) is full
+    int64_t slack_us = 2 * 60 * 1000;
+    if (dev->paced && due - slack_us > now) {
+        host_clock_sleep_us(due - slack_us - now);
+    }
+    return ESP_CODEC_DEV_OK;
+}
+
+int esp_codec_dev_set_out_vol(esp_codec_dev_handle_t dev, int volume)
+{
+    (void)volume;
+    return dev ? ESP_CODEC_DEV_OK : ESP_CODEC_DEV_INVALID_ARG;
+}
+
+int esp_codec_dev_set_out_mute(esp_codec_dev_handle_t dev, bool mute)
+{
+    if (dev == NULL) {
+        return ESP_CODEC_DEV_INVALID_ARG;
+    }
+    pthread_mutex_lock(&dev->mutex);
+    dev->muted = mute;
+    pthread_mutex_unlock(&dev->mutex);
+    return ESP_CODEC_DEV_OK;
+}
+
+int esp_codec_dev_set_in_gain(esp_codec_dev_handle_t dev, float db_value)
+{
+    (void)db_value;
+    return dev ? ESP_CODEC_DEV_OK : ESP_CODEC_DEV_INVALID_ARG;
+}
@@ -0,0 +1,300 @@
+/**
+ * @file esp_shim.c
+ * @brief Virtual clock, logging, error names, heap figures and base64 for host builds
+ */
+
+#include "host_shim.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "mbedtls/base64.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// ============================================
+// Virtual Clock
+// ============================================
+
+/*
+ * virtual = base_us + (real - real_base) * speed. Changing the speed rebases
+ * the clock so virtual time stays continuous.
+ */
+static pthread_mutex_t s_clock_lock = PTHREAD_MUTEX_INITIALIZER;
+static double s_speed = 1.0;
+static int64_t s_virtual_base_us = 0;
+static int64_t s_real_base_us = -1;
+
+static int64_t real_now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int64_t virtual_now_locked(int64_t real_us)
+{
+    if (s_real_base_us < 0) {
+        s_real_base_us = real_us;
+    }
+    return s_virtual_base_us + (int64_t)((double)(real_us - s_real_base_us) * s_speed);
+}
+
+void host_clock_set_speed(double speed)
+{
+    if (!(speed > 0.0)) {
+        return;
+    }
+
+    pthread_mutex_lock(&s_clock_lock);
+    int64_t real_us = real_now_us();
+    s_virtual_base_us = virtual_now_locked(real_us);
+    s_real_base_us = real_us;
+    s_speed = speed;
+    pthread_mutex_unlock(&s_clock_lock);
+}
+
+double host_clock_get_speed(void)
+{
+    pthread_mutex_lock(&s_clock_lock);
+    double speed = s_speed;
+    pthread_mutex_unlock(&s_clock_lock);
+    return speed;
+}
+
+int64_t host_clock_now_us(void)
+{
+    pthread_mutex_lock(&s_clock_lock);
+    int64_t now = virtual_now_locked(real_now_us());
+    pthread_mutex_unlock(&s_clock_lock);
+    return now;
+}
+
+void host_clock_sleep_us(int64_t us)
+{
+    if (us <= 0) {
+        sched_yield();
+        return;
+    }
+
+    int64_t real_us = (int64_t)((double)us / host_clock_get_speed());
+    struct timespec ts = {
+        .tv_sec = real_us / 1000000,
+        .tv_nsec = (real_us % 1000000) * 1000,
+    };
+    while (nanosleep(&ts, &ts) != 0) {
+    }
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return host_clock_now_us();
+}
+
+// ============================================
+// Logging
+// ============================================
+
+static esp_log_level_t s_log_level = ESP_LOG_INFO;
+static pthread_mutex_t s_log_lock = PTHREAD_MUTEX_INITIALIZER;
+static FILE *s_log_out = NULL;
+
+void host_log_set_level(esp_log_level_t level)
+{
+    s_log_level = level;
+}
+
+void host_log_set_output(FILE *out)
+{
+    pthread_mutex_lock(&s_log_lock);
+    s_log_out = out;
+    pthread_mutex_unlock(&s_log_lock);
+}
+
+void esp_log_level_set(const char *tag, esp_log_level_t level)
+{
+    // Per-tag levels are not tracked; "*" sets the global level
+    if (tag != NULL && strcmp(tag, "*") == 0) {
+        s_log_level = level;
+    }
+}
+
+uint32_t esp_log_timestamp(void)
+{
+    return (uint32_t)(host_clock_now_us() / 1000);
+}
+
+void esp_log_write(esp_log_level_t level, const char *tag, const char *format, ...)
+{
+    (void)tag;
+    if (level > s_log_level) {
+        return;
+    }
+
+    va_list args;
+    va_start(args, format);
+    pthread_mutex_lock(&s_log_lock);
+    vfprintf(s_log_out ? s_log_out : stderr, format, args);
+    pthread_mutex_unlock(&s_log_lock);
+    va_end(args);
+}
+
+// ============================================
+// Heap
+// ============================================
+
+static _Atomic size_t s_heap_used = 0;
+static _Atomic size_t s_heap_peak = 0;
+
+void host_heap_set_used(size_t bytes)
+{
+    if (bytes > HOST_HEAP_INTERNAL_SIZE) {
+        bytes = HOST_HEAP_INTERNAL_SIZE;
+    }
+    s_heap_used = bytes;
+    if (bytes > s_heap_peak) {
+        s_heap_peak = bytes;
+    }
+}
+
+size_t host_heap_get_used(void)
+{
+    return s_heap_used;
+}
+
+size_t host_heap_get_peak(void)
+{
+    return s_heap_peak;
+}
+
+// ============================================
+// Error Names
+// ============================================
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    switch (code) {
+        case ESP_OK:                    return "ESP_OK";
+        case ESP_FAIL:                  return "ESP_FAIL";
+        case ESP_ERR_NO_MEM:            return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG:       return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE:     return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_INVALID_SIZE:      return "ESP_ERR_INVALID_SIZE";
+        case ESP_ERR_NOT_FOUND:         return "ESP_ERR_NOT_FOUND";
+        case ESP_ERR_NOT_SUPPORTED:     return "ESP_ERR_NOT_SUPPORTED";
+        case ESP_ERR_TIMEOUT:           return "ESP_ERR_TIMEOUT";
+        case ESP_ERR_INVALID_RESPONSE:  return "ESP_ERR_INVALID_RESPONSE";
+        case ESP_ERR_NOT_FINISHED:      return "ESP_ERR_NOT_FINISHED";
+        case ESP_ERR_NOT_ALLOWED:       return "ESP_ERR_NOT_ALLOWED";
+        default:                        return "UNKNOWN ERROR";
+    }
+}
+
+// ============================================
+// Base64 (mbedtls semantics)
+// ============================================
+
+static const char s_b64_enc[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+int mbedtls_base64_encode(unsigned char *dst, size_t dlen, size_t *olen,
+                          const unsigned char *src, size_t slen)
+{
+    size_t need = ((slen + 2) / 3) * 4;
+    if (slen == 0) {
+        *olen = 0;
+        return 0;
+    }
+    // mbedtls reports the required size including the terminator
+    if (dst == NULL || dlen < need + 1) {
+        *olen = need + 1;
+        return MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL;
+    }
+
+    unsigned char *p = dst;
+    size_t i = 0;
+    for (; i + 2 < slen; i += 3) {
+        uint32_t v = ((uint32_t)src[i] << 16) | ((uint32_t)src[i + 1] << 8) | src[i + 2];
+        *p++ = s_b64_enc[(v >> 18) & 0x3F];
+        *p++ = s_b64_enc[(v >> 12) & 0x3F];
+        *p++ = s_b64_enc[(v >> 6) & 0x3F];
+        *p++ = s_b64_enc[v & 0x3F];
+    }
+    if (i < slen) {
+        uint32_t v = (uint32_t)src[i] << 16;
+        if (i + 1 < slen) {
+            v |= (uint32_t)src[i + 1] << 8;
+        }
+        *p++ = s_b64_enc[(v >> 18) & 0x3F];
+        *p++ = s_b64_enc[(v >> 12) & 0x3F];
+        *p++ = (i + 1 < slen) ? s_b64_enc[(v >> 6) & 0x3F] : '=';
+        *p++ = '=';
+    }
+    *p = '\0';
+    *olen = (size_t)(p - dst);
+    return 0;
+}
+
+static int b64_value(unsigned char c)
+{
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if (c >= '0' && c <= '9') return c - '0' + 52;
+    if (c == '+') return 62;
+    if (c == '/') return 63;
+    return -1;
+}
+
+int mbedtls_base64_decode(unsigned char *dst, size_t dlen, size_t *olen,
+                          const unsigned char *src, size_t slen)
+{
+    // First pass: validate and size
+    size_t digits = 0;
+    size_t pad = 0;
+    for (size_t i = 0; i < slen; i++) {
+        unsigned char c = src[i];
+        if (c == ' ' || c == '\r' || c == '\n') {
+            continue;
+        }
+        if (c == '=') {
+            if (++pad > 2) {
+                return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
+            }
+            continue;
+        }
+        if (pad > 0 || b64_value(c) < 0) {
+            return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
+        }
+        digits++;
+    }
+    if ((digits + pad) % 4 != 0) {
+        return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
+    }
+
+    size_t need = (digits * 3) / 4;
+    if (dst == NULL || dlen < need) {
+        *olen = need;
+        return MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL;
+    }
+
+    uint32_t acc = 0;
+    int bits = 0;
+    unsigned char *p = dst;
+    for (size_t i = 0; i < slen; i++) {
+        int v = b64_value(src[i]);
+        if (v < 0) {
+            continue;
+        }
+        acc = (acc << 6) | (uint32_t)v;
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            *p++ = (unsigned char)(acc >> bits);
+        }
+    }
+    *olen = (size_t)(p - dst);
+    return 0;
+}
@@ -0,0 +1,805 @@
+/**
+ * @file freertos_posix.c
+ * @brief FreeRTOS kernel shim on pthreads
+ *
+ * Every blocking call converts its tick timeout into a real-time deadline
+ * through the virtual clock, so an accelerated replay shortens waits without
+ * changing their meaning to the firmware. Scheduling is left to the host
+ * OS: priorities and core affinity are recorded but not enforced.
+ */
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/ringbuf.h"
+#include "freertos/event_groups.h"
+#include "host_shim.h"
+#include "host_shim_priv.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// ============================================
+// Deadlines
+// ============================================
+
+/**
+ * @brief Real-time absolute deadline for a tick timeout
+ *
+ * @return false if the wait is infinite
+ */
+static bool ticks_to_deadline(TickType_t ticks, struct timespec *deadline)
+{
+    if (ticks == portMAX_DELAY) {
+        return false;
+    }
+
+    int64_t real_ns = (int64_t)((double)pdTICKS_TO_MS(ticks) * 1000000.0 / host_clock_get_speed());
+    clock_gettime(CLOCK_MONOTONIC, deadline);
+    deadline->tv_sec += real_ns / 1000000000;
+    deadline->tv_nsec += real_ns % 1000000000;
+    if (deadline->tv_nsec >= 1000000000) {
+        deadline->tv_sec++;
+        deadline->tv_nsec -= 1000000000;
+    }
+    return true;
+}
+
+/**
+ * @brief Wait on a condition until a deadline
+ *
+ * @return false on timeout
+ */
+static bool cond_wait(pthread_cond_t *cond, pthread_mutex_t *mutex, bool timed, const struct timespec *deadline)
+{
+    if (!timed) {
+        pthread_cond_wait(cond, mutex);
+        return true;
+    }
+    return pthread_cond_timedwait(cond, mutex, deadline) != ETIMEDOUT;
+}
+
+static void cond_init_monotonic(pthread_cond_t *cond)
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+// ============================================
+// Tasks
+// ============================================
+
+struct host_task {
+    pthread_t thread;
+    char name[16];
+    TaskFunction_t fn;
+    void *arg;
+    uint32_t stack_depth;
+    clockid_t cpu_clock;
+    uint64_t cpu_us_final;
+    bool running;
+    uint32_t queue_send_fail;
+    uint32_t ringbuf_send_fail;
+
+    pthread_mutex_t notify_mutex;
+    pthread_cond_t notify_cond;
+    uint32_t notify_count;
+
+    struct host_task *next;
+};
+
+static pthread_mutex_t s_task_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct host_task *s_tasks = NULL;
+static __thread struct host_task *s_current = NULL;
+
+static uint64_t thread_cpu_us(clockid_t clock)
+{
+    struct timespec ts;
+    if (clock_gettime(clock, &ts) != 0) {
+        return 0;
+    }
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static struct host_task *task_alloc(const char *name, TaskFunction_t fn, void *arg, uint32_t stack_depth)
+{
+    struct host_task *task = calloc(1, sizeof(*task));
+    if (task == NULL) {
+        return NULL;
+    }
+    strncpy(task->name, name ? name : "task", sizeof(task->name) - 1);
+    task->fn = fn;
+    task->arg = arg;
+    task->stack_depth = stack_depth;
+    pthread_mutex_init(&task->notify_mutex, NULL);
+    cond_init_monotonic(&task->notify_cond);
+
+    pthread_mutex_lock(&s_task_lock);
+    task->next = s_tasks;
+    s_tasks = task;
+    pthread_mutex_unlock(&s_task_lock);
+    return task;
+}
+
+static void task_finish(struct host_task *task)
+{
+    pthread_mutex_lock(&s_task_lock);
+    task->cpu_us_final = thread_cpu_us(task->cpu_clock);
+    task->running = false;
+    pthread_mutex_unlock(&s_task_lock);
+}
+
+static void *task_entry(void *param)
+{
+    struct host_task *task = param;
+    s_current = task;
+    pthread_getcpuclockid(pthread_self(), &task->cpu_clock);
+
+    task->fn(task->arg);
+
+    // FreeRTOS tasks must not return; tolerate it on the host
+    task_finish(task);
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack_depth,
+                                   void *arg, UBaseType_t priority, TaskHandle_t *handle,
+                                   BaseType_t core_id)
+{
+    (void)priority;
+    (void)core_id;
+
+    struct host_task *task = task_alloc(name, fn, arg, stack_depth);
+    if (task == NULL) {
+        return pdFAIL;
+    }
+
+    task->running = true;
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    int err = pthread_create(&task->thread, &attr, task_entry, task);
+    pthread_attr_destroy(&attr);
+    if (err != 0) {
+        task->running = false;
+        return pdFAIL;
+    }
+
+    pthread_setname_np(task->thread, task->name);
+    if (handle) {
+        *handle = task;
+    }
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCoreWithCaps(TaskFunction_t fn, const char *name, uint32_t stack_depth,
+                                           void *arg, UBaseType_t priority, TaskHandle_t *handle,
+                                           BaseType_t core_id, uint32_t caps)
+{
+    (void)caps;
+    return xTaskCreatePinnedToCore(fn, name, stack_depth, arg, priority, handle, core_id);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task == NULL || task == s_current) {
+        if (s_current != NULL) {
+            task_finish(s_current);
+        }
+        pthread_exit(NULL);
+    }
+    // Deleting another task: it has already been asked to stop via its flag
+}
+
+void host_task_register_current(const char *name)
+{
+    if (s_current != NULL) {
+        return;
+    }
+    struct host_task *task = task_alloc(name, NULL, NULL, 0);
+    if (task == NULL) {
+        return;
+    }
+    task->thread = pthread_self();
+    pthread_getcpuclockid(task->thread, &task->cpu_clock);
+    task->running = true;
+    s_current = task;
+}
+
+void host_task_foreach(host_task_stats_cb_t cb, void *ctx)
+{
+    if (cb == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&s_task_lock);
+    for (struct host_task *task = s_tasks; task != NULL; task = task->next) {
+        host_task_stats_t stats = {
+            .cpu_us = task->running ? thread_cpu_us(task->cpu_clock) : task->cpu_us_final,
+            .queue_send_fail = task->queue_send_fail,
+            .ringbuf_send_fail = task->ringbuf_send_fail,
+            .running = task->running,
+        };
+        memcpy(stats.name, task->name, sizeof(stats.name));
+        cb(&stats, ctx);
+    }
+    pthread_mutex_unlock(&s_task_lock);
+}
+
+void host_task_count_send_fail(bool ringbuf)
+{
+    struct host_task *task = s_current;
+    if (task == NULL) {
+        return;
+    }
+    if (ringbuf) {
+        task->ringbuf_send_fail++;
+    } else {
+        task->queue_send_fail++;
+    }
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    host_clock_sleep_us((int64_t)pdTICKS_TO_MS(ticks) * 1000);
+}
+
+BaseType_t xTaskDelayUntil(TickType_t *previous_wake, TickType_t increment)
+{
+    TickType_t target = *previous_wake + increment;
+    TickType_t now = xTaskGetTickCount();
+    *previous_wake = target;
+
+    if ((int32_t)(target - now) <= 0) {
+        return pdFALSE;
+    }
+    vTaskDelay(target - now);
+    return pdTRUE;
+}
+
+void vTaskDelayUntil(TickType_t *previous_wake, TickType_t increment)
+{
+    xTaskDelayUntil(previous_wake, increment);
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)pdMS_TO_TICKS(host_clock_now_us() / 1000);
+}
+
+TickType_t xTaskGetTickCountFromISR(void)
+{
+    return xTaskGetTickCount();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return s_current;
+}
+
+const char *pcTaskGetName(TaskHandle_t task)
+{
+    task = task ? task : s_current;
+    return task ? task->name : "main";
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task)
+{
+    task = task ? task : s_current;
+    return task ? task->stack_depth : 0;
+}
+
+void taskYIELD(void)
+{
+    sched_yield();
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    if (task == NULL) {
+        return pdFAIL;
+    }
+    pthread_mutex_lock(&task->notify_mutex);
+    task->notify_count++;
+    pthread_cond_signal(&task->notify_cond);
+    pthread_mutex_unlock(&task->notify_mutex);
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higher_priority_woken)
+{
+    if (higher_priority_woken) {
+        *higher_priority_woken = pdFALSE;
+    }
+    xTaskNotifyGive(task);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks)
+{
+    struct host_task *task = s_current;
+    if (task == NULL) {
+        vTaskDelay(ticks);
+        return 0;
+    }
+
+    struct timespec deadline;
+    bool timed = ticks_to_deadline(ticks, &deadline);
+
+    pthread_mutex_lock(&task->notify_mutex);
+    while (task->notify_count == 0 && ticks != 0) {
+        if (!cond_wait(&task->notify_cond, &task->notify_mutex, timed, &deadline)) {
+            break;
+        }
+    }
+    uint32_t value = task->notify_count;
+    if (value > 0) {
+        task->notify_count = clear_on_exit ? 0 : value - 1;
+    }
+    pthread_mutex_unlock(&task->notify_mutex);
+    return value;
+}
+
+// ============================================
+// Queues and Semaphores
+// ============================================
+
+struct host_queue {
+    pthread_mutex_t mutex;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    uint8_t *storage;
+    bool own_storage;
+    size_t item_size;                   // 0 for semaphores
+    size_t length;
+    size_t head;
+    size_t count;
+};
+
+static QueueHandle_t queue_create(UBaseType_t length, UBaseType_t item_size, uint8_t *storage)
+{
+    struct host_queue *queue = calloc(1, sizeof(*queue));
+    if (queue == NULL || length == 0) {
+        free(queue);
+        return NULL;
+    }
+
+    queue->item_size = item_size;
+    queue->length = length;
+    if (item_size > 0) {
+        queue->own_storage = (storage == NULL);
+        queue->storage = storage ? storage : malloc(length * item_size);
+        if (queue->storage == NULL) {
+            free(queue);
+            return NULL;
+        }
+    }
+    pthread_mutex_init(&queue->mutex, NULL);
+    cond_init_monotonic(&queue->not_empty);
+    cond_init_monotonic(&queue->not_full);
+    return queue;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    return queue_create(length, item_size, NULL);
+}
+
+QueueHandle_t xQueueCreateStatic(UBaseType_t length, UBaseType_t item_size,
+                                 uint8_t *storage, StaticQueue_t *queue_buffer)
+{
+    (void)queue_buffer;
+    return queue_create(length, item_size, storage);
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+    if (queue == NULL) {
+        return;
+    }
+    pthread_mutex_destroy(&queue->mutex);
+    pthread_cond_destroy(&queue->not_empty);
+    pthread_cond_destroy(&queue->not_full);
+    if (queue->own_storage) {
+        free(queue->storage);
+    }
+    free(queue);
+}
+
+static BaseType_t queue_send(QueueHandle_t queue, const void *item, TickType_t ticks, bool front, bool overwrite)
+{
+    if (queue == NULL) {
+        return pdFAIL;
+    }
+
+    struct timespec deadline;
+    bool timed = ticks_to_deadline(ticks, &deadline);
+
+    pthread_mutex_lock(&queue->mutex);
+    while (queue->count == queue->length && !overwrite) {
+        if (ticks == 0 || !cond_wait(&queue->not_full, &queue->mutex, timed, &deadline)) {
+            pthread_mutex_unlock(&queue->mutex);
+            if (queue->item_size > 0) {
+                host_task_count_send_fail(false);
+            }
+            return errQUEUE_FULL;
+        }
+    }
+
+    if (queue->item_size > 0) {
+        size_t slot;
+        if (overwrite && queue->count == queue->length) {
+            slot = (queue->head + queue->count - 1) % queue->length;
+        } else if (front) {
+            queue->head = (queue->head + queue->length - 1) % queue->length;
+            slot = queue->head;
+            queue->count++;
+        } else {
+            slot = (queue->head + queue->count) % queue->length;
+            queue->count++;
+        }
+        memcpy(queue->storage + slot * queue->item_size, item, queue->item_size);
+    } else if (queue->count < queue->length) {
+        queue->count++;
+    }
+
+    pthread_cond_signal(&queue->not_empty);
+    pthread_mutex_unlock(&queue->mutex);
+    return pdPASS;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+    return queue_send(queue, item, ticks, false, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+    return queue_send(queue, item, ticks, true, false);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void *item)
+{
+    return queue_send(queue, item, 0, false, true);
+}
+
+static BaseType_t queue_receive(QueueHandle_t queue, void *item, TickType_t ticks, bool peek)
+{
+    if (queue == NULL) {
+        return pdFAIL;
+    }
+
+    struct timespec deadline;
+    bool timed = ticks_to_deadline(ticks, &deadline);
+
+    pthread_mutex_lock(&queue->mutex);
+    while (queue->count == 0) {
+        if (ticks == 0 || !cond_wait(&queue->not_empty, &queue->mutex, timed, &deadline)) {
+            pthread_mutex_unlock(&queue->mutex);
+            return errQUEUE_EMPTY;
+        }
+    }
+
+    if (queue->item_size > 0 && item != NULL) {
+        memcpy(item, queue->storage + queue->head * queue->item_size, queue->item_size);
+    }
+    if (!peek) {
+        queue->head = (queue->head + 1) % queue->length;
+        queue->count--;
+        pthread_cond_signal(&queue->not_full);
+    }
+
+    pthread_mutex_unlock(&queue->mutex);
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+    return queue_receive(queue, item, ticks, false);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+    return queue_receive(queue, item, ticks, true);
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue)
+{
+    if (queue == NULL) {
+        return pdFAIL;
+    }
+    pthread_mutex_lock(&queue->mutex);
+    queue->head = 0;
+    queue->count = 0;
+    pthread_cond_broadcast(&queue->not_full);
+    pthread_mutex_unlock(&queue->mutex);
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    if (queue == NULL) {
+        return 0;
+    }
+    pthread_mutex_lock(&queue->mutex);
+    UBaseType_t count = queue->count;
+    pthread_mutex_unlock(&queue->mutex);
+    return count;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue)
+{
+    if (queue == NULL) {
+        return 0;
+    }
+    pthread_mutex_lock(&queue->mutex);
+    UBaseType_t spaces = queue->length - queue->count;
+    pthread_mutex_unlock(&queue->mutex);
+    return spaces;
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count)
+{
+    QueueHandle_t sem = queue_create(max_count, 0, NULL);
+    if (sem != NULL) {
+        sem->count = initial_count;
+    }
+    return sem;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+    return queue_receive(sem, NULL, ticks, false);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    if (sem == NULL) {
+        return pdFAIL;
+    }
+    pthread_mutex_lock(&sem->mutex);
+    BaseType_t ret = pdFAIL;
+    if (sem->count < sem->length) {
+        sem->count++;
+        ret = pdPASS;
+        pthread_cond_signal(&sem->not_empty);
+    }
+    pthread_mutex_unlock(&sem->mutex);
+    return ret;
+}
+
+// ============================================
+// Byte Ring Buffers
+// ============================================
+
+struct host_ringbuf {
+    pthread_mutex_t mutex;
+    pthread_cond_t data_ready;
+    pthread_cond_t space_ready;
+    uint8_t *buf;
+    size_t size;
+    size_t read;                        // Read offset
+    size_t used;                        // Bytes stored, including held
+    size_t held;                        // Bytes handed out, not yet returned
+};
+
+RingbufHandle_t xRingbufferCreate(size_t size, RingbufferType_t type)
+{
+    if (type != RINGBUF_TYPE_BYTEBUF || size == 0) {
+        return NULL;
+    }
+
+    struct host_ringbuf *rb = calloc(1, sizeof(*rb));
+    if (rb == NULL) {
+        return NULL;
+    }
+    rb->buf = malloc(size);
+    if (rb->buf == NULL) {
+        free(rb);
+        return NULL;
+    }
+    rb->size = size;
+    pthread_mutex_init(&rb->mutex, NULL);
+    cond_init_monotonic(&rb->data_ready);
+    cond_init_monotonic(&rb->space_ready);
+    return rb;
+}
+
+void vRingbufferDelete(RingbufHandle_t rb)
+{
+    if (rb == NULL) {
+        return;
+    }
+    pthread_mutex_destroy(&rb->mutex);
+    pthread_cond_destroy(&rb->data_ready);
+    pthread_cond_destroy(&rb->space_ready);
+    free(rb->buf);
+    free(rb);
+}
+
+BaseType_t xRingbufferSend(RingbufHandle_t rb, const void *data, size_t size, TickType_t ticks)
+{
+    if (rb == NULL || size > rb->size) {
+        return pdFALSE;
+    }
+
+    struct timespec deadline;
+    bool timed = ticks_to_deadline(ticks, &deadline);
+
+    pthread_mutex_lock(&rb->mutex);
+    while (rb->size - rb->used < size) {
+        if (ticks == 0 || !cond_wait(&rb->space_ready, &rb->mutex, timed, &deadline)) {
+            pthread_mutex_unlock(&rb->mutex);
+            host_task_count_send_fail(true);
+            return pdFALSE;
+        }
+    }
+
+    size_t write = (rb->read + rb->used) % rb->size;
+    size_t first = size < rb->size - write ? size : rb->size - write;
+    memcpy(rb->buf + write, data, first);
+    memcpy(rb->buf, (const uint8_t *)data + first, size - first);
+    rb->used += size;
+
+    pthread_cond_signal(&rb->data_ready);
+    pthread_mutex_unlock(&rb->mutex);
+    return pdTRUE;
+}
+
+void *xRingbufferReceiveUpTo(RingbufHandle_t rb, size_t *size, TickType_t ticks, size_t max_size)
+{
+    if (rb == NULL || size == NULL) {
+        return NULL;
+    }
+
+    struct timespec deadline;
+    bool timed = ticks_to_deadline(ticks, &deadline);
+
+    pthread_mutex_lock(&rb->mutex);
+    while (rb->used == rb->held || rb->held > 0) {
+        if (ticks == 0 || !cond_wait(&rb->data_ready, &rb->mutex, timed, &deadline)) {
+            pthread_mutex_unlock(&rb->mutex);
+            *size = 0;
+            return NULL;
+        }
+    }
+
+    // Byte buffers hand out the contiguous run up to the wrap point
+    size_t n = rb->used;
+    if (n > rb->size - rb->read) {
+        n = rb->size - rb->read;
+    }
+    if (n > max_size) {
+        n = max_size;
+    }
+    rb->held = n;
+    *size = n;
+    void *item = rb->buf + rb->read;
+
+    pthread_mutex_unlock(&rb->mutex);
+    return item;
+}
+
+void *xRingbufferReceive(RingbufHandle_t rb, size_t *size, TickType_t ticks)
+{
+    return xRingbufferReceiveUpTo(rb, size, ticks, rb ? rb->size : 0);
+}
+
+void vRingbufferReturnItem(RingbufHandle_t rb, void *item)
+{
+    if (rb == NULL || item == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&rb->mutex);
+    rb->read = (rb->read + rb->held) % rb->size;
+    rb->used -= rb->held;
+    rb->held = 0;
+    pthread_cond_broadcast(&rb->space_ready);
+    pthread_cond_signal(&rb->data_ready);
+    pthread_mutex_unlock(&rb->mutex);
+}
+
+size_t xRingbufferGetCurFreeSize(RingbufHandle_t rb)
+{
+    if (rb == NULL) {
+        return 0;
+    }
+    pthread_mutex_lock(&rb->mutex);
+    size_t free_size = rb->size - rb->used;
+    pthread_mutex_unlock(&rb->mutex);
+    return free_size;
+}
+
+size_t xRingbufferGetMaxItemSize(RingbufHandle_t rb)
+{
+    return rb ? rb->size : 0;
+}
+
+// ============================================
+// Event Groups
+// ============================================
+
+struct host_event_group {
+    pthread_mutex_t mutex;
+    pthread_cond_t changed;
+    EventBits_t bits;
+};
+
+EventGroupHandle_t xEventGroupCreate(void)
+{
+    struct host_event_group *group = calloc(1, sizeof(*group));
+    if (group != NULL) {
+        pthread_mutex_init(&group->mutex, NULL);
+        cond_init_monotonic(&group->changed);
+    }
+    return group;
+}
+
+void vEventGroupDelete(EventGroupHandle_t group)
+{
+    if (group == NULL) {
+        return;
+    }
+    pthread_mutex_destroy(&group->mutex);
+    pthread_cond_destroy(&group->changed);
+    free(group);
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    pthread_mutex_lock(&group->mutex);
+    group->bits |= bits;
+    EventBits_t value = group->bits;
+    pthread_cond_broadcast(&group->changed);
+    pthread_mutex_unlock(&group->mutex);
+    return value;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    pthread_mutex_lock(&group->mutex);
+    EventBits_t value = group->bits;
+    group->bits &= ~bits;
+    pthread_mutex_unlock(&group->mutex);
+    return value;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group)
+{
+    pthread_mutex_lock(&group->mutex);
+    EventBits_t value = group->bits;
+    pthread_mutex_unlock(&group->mutex);
+    return value;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear_on_exit,
+                                BaseType_t wait_for_all, TickType_t ticks)
+{
+    struct timespec deadline;
+    bool timed = ticks_to_deadline(ticks, &deadline);
+
+    pthread_mutex_lock(&group->mutex);
+    for (;;) {
+        EventBits_t match = group->bits & bits;
+        if (wait_for_all ? match == bits : match != 0) {
+            break;
+        }
+        if (ticks == 0 || !cond_wait(&group->changed, &group->mutex, timed, &deadline)) {
+            break;
+        }
+    }
+    EventBits_t value = group->bits;
+    EventBits_t match = value & bits;
+    if (clear_on_exit && (wait_for_all ? match == bits : match != 0)) {
+        group->bits &= ~bits;
+    }
+    pthread_mutex_unlock(&group->mutex);
+    return value;
+}
@@ -0,0 +1,15 @@
+/**
+ * @file host_shim_priv.h
+ * @brief Internal interfaces shared between shim translation units
+ */
+
+#pragma once
+
+#include <stdbool.h>
+
+/**
+ * @brief Count a failed queue or ring buffer send against the calling task
+ *
+ * @param ringbuf true for xRingbufferSend, false for xQueueSend
+ */
+void host_task_count_send_fail(bool ringbuf);
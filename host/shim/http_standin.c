@@ -0,0 +1,430 @@
+/**
+ * @file http_standin.c
+ * @brief In-process stand-in for the realtime session and SDP HTTPS endpoints
+ *
+ * Implements the esp_http_client calls used by esp_webrtc's https_client
+ * without a network. A request runs synchronously in the caller's task like
+ * the real client: it "connects" (full handshake time) unless the handle
+ * still holds a live keep-alive connection to the same host, waits the
+ * endpoint's processing time and delivers the response through the event
+ * handler in small ON_DATA chunks. Responses carry a Date header from a
+ * server clock that follows the virtual clock, and tokens expire against it.
+ *
+ * The server side closes keep-alive connections left idle for longer than
+ * idle_close_ms; the next request on such a handle fails the way a write on
+ * a half-closed socket does, so pooling code has to recover.
+ */
+
+#include "esp_http_client.h"
+#include "host_shim.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+static const char *TAG = "HOST_HTTP";
+
+#define STANDIN_MAX_HEADERS     8
+#define STANDIN_CHUNK_SIZE      256
+#define STANDIN_HOST_LEN        128
+#define STANDIN_EPOCH           1760000000  // Server clock at virtual time 0 (2025-10-09)
+
+// ============================================
+// Private Types and Variables
+// ============================================
+
+typedef struct {
+    char *key;
+    char *value;
+} standin_header_t;
+
+struct host_http_client {
+    esp_http_client_config_t config;
+    char *url;
+    esp_http_client_method_t method;
+    standin_header_t headers[STANDIN_MAX_HEADERS];
+    const char *post_data;
+    int post_len;
+
+    bool connected;
+    char conn_host[STANDIN_HOST_LEN];
+    int64_t last_active_us;
+
+    int status;
+    int64_t content_length;
+};
+
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+static host_http_standin_config_t s_config = HOST_HTTP_STANDIN_DEFAULT_CONFIG();
+static host_http_standin_stats_t s_stats;
+static uint32_t s_token_seq;
+
+// ============================================
+// Configuration
+// ============================================
+
+void host_http_standin_configure(const host_http_standin_config_t *config)
+{
+    if (config == NULL) {
+        return;
+    }
+    pthread_mutex_lock(&s_lock);
+    s_config = *config;
+    pthread_mutex_unlock(&s_lock);
+}
+
+void host_http_standin_get_stats(host_http_standin_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    pthread_mutex_lock(&s_lock);
+    *stats = s_stats;
+    pthread_mutex_unlock(&s_lock);
+}
+
+// ============================================
+// Helpers
+// ============================================
+
+static void emit(esp_http_client_handle_t client, esp_http_client_event_id_t id, void *data, int len)
+{
+    if (client->config.event_handler == NULL) {
+        return;
+    }
+    esp_http_client_event_t evt = {
+        .event_id = id,
+        .client = client,
+        .data = data,
+        .data_len = len,
+        .user_data = client->config.user_data,
+    };
+    client->config.event_handler(&evt);
+}
+
+static void emit_header(esp_http_client_handle_t client, const char *key, const char *value)
+{
+    if (client->config.event_handler == NULL) {
+        return;
+    }
+    esp_http_client_event_t evt = {
+        .event_id = HTTP_EVENT_ON_HEADER,
+        .client = client,
+        .user_data = client->config.user_data,
+        .header_key = (char *)key,
+        .header_value = (char *)value,
+    };
+    client->config.event_handler(&evt);
+}
+
+/**
+ * @brief "scheme://host[:port]" part of a URL
+ */
+static void url_host(const char *url, char *host, size_t size)
+{
+    const char *p = strstr(url, "://");
+    p = p ? p + 3 : url;
+    size_t len = strcspn(p, "/?#") + (size_t)(p - url);
+    if (len >= size) {
+        len = size - 1;
+    }
+    memcpy(host, url, len);
+    host[len] = 0;
+}
+
+static void disconnect(esp_http_client_handle_t client)
+{
+    if (client->connected) {
+        client->connected = false;
+        emit(client, HTTP_EVENT_DISCONNECTED, NULL, 0);
+    }
+}
+
+/**
+ * @brief Server wall clock: a fixed epoch advanced by the virtual clock
+ */
+static int64_t server_time(void)
+{
+    return STANDIN_EPOCH + host_clock_now_us() / 1000000;
+}
+
+/**
+ * @brief Build the response body for the request path (malloc'd)
+ */
+static char *respond(esp_http_client_handle_t client, const host_http_standin_config_t *cfg,
+                     uint32_t *delay_ms, int *status, const char **type)
+{
+    const char *path = strstr(client->url, "://");
+    path = path ? strchr(path + 3, '/') : NULL;
+    path = path ? path : "/";
+
+    char *body = NULL;
+    if (strstr(path, "/sessions") != NULL) {
+        pthread_mutex_lock(&s_lock);
+        uint32_t seq = ++s_token_seq;
+        s_stats.tokens++;
+        pthread_mutex_unlock(&s_lock);
+        // Tokens expire relative to the time the session is created
+        int64_t expires_at = server_time() + cfg->token_ms / 1000 + cfg->token_ttl_s;
+        if (asprintf(&body, "{\"id\":\"sess_%06lu\",\"object\":\"realtime.session\",\"model\":\"gpt-realtime\","
+                     "\"voice\":\"alloy\",\"client_secret\":{\"value\":\"ek_standin_%06lu\",\"expires_at\":%lld}}",
+                     (unsigned long)seq, (unsigned long)seq, (long long)expires_at) < 0) {
+            body = NULL;
+        }
+        *delay_ms = cfg->token_ms;
+        *status = 200;
+        *type = "application/json";
+    } else if (strstr(path, "/realtimertc") != NULL || strstr(path, "/v1/realtime") != NULL) {
+        pthread_mutex_lock(&s_lock);
+        s_stats.answers++;
+        pthread_mutex_unlock(&s_lock);
+        body = strdup("v=0\r\n"
+                      "o=- 4215775240449105457 2 IN IP4 127.0.0.1\r\n"
+                      "s=-\r\n"
+                      "t=0 0\r\n"
+                      "a=group:BUNDLE 0 1\r\n"
+                      "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+                      "c=IN IP4 0.0.0.0\r\n"
+                      "a=ice-ufrag:standin\r\n"
+                      "a=ice-pwd:standinstandinstandinstandin\r\n"
+                      "a=fingerprint:sha-256 00:11:22:33:44:55:66:77:88:99:AA:BB:CC:DD:EE:FF:"
+                      "00:11:22:33:44:55:66:77:88:99:AA:BB:CC:DD:EE:FF\r\n"
+                      "a=setup:active\r\n"
+                      "a=mid:0\r\n"
+                      "a=sendrecv\r\n"
+                      "a=rtpmap:111 opus/48000/2\r\n"
+                      "m=application 9 UDP/DTLS/SCTP webrtc-datachannel\r\n"
+                      "c=IN IP4 0.0.0.0\r\n"
+                      "a=mid:1\r\n"
+                      "a=sctp-port:5000\r\n");
+        *delay_ms = cfg->sdp_ms;
+        *status = 201;
+        *type = "application/sdp";
+    } else {
+        body = strdup("{\"error\":{\"message\":\"not found\"}}");
+        *delay_ms = 0;
+        *status = 404;
+        *type = "application/json";
+    }
+    return body;
+}
+
+// ============================================
+// esp_http_client API
+// ============================================
+
+esp_http_client_handle_t esp_http_client_init(const esp_http_client_config_t *config)
+{
+    if (config == NULL || config->url == NULL) {
+        return NULL;
+    }
+    esp_http_client_handle_t client = calloc(1, sizeof(*client));
+    if (client == NULL) {
+        return NULL;
+    }
+    client->config = *config;
+    client->url = strdup(config->url);
+    client->method = config->method;
+    if (client->url == NULL) {
+        free(client);
+        return NULL;
+    }
+    return client;
+}
+
+esp_err_t esp_http_client_set_url(esp_http_client_handle_t client, const char *url)
+{
+    if (client == NULL || url == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    char *copy = strdup(url);
+    if (copy == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    // Like the real client: a different host drops the open connection
+    char host[STANDIN_HOST_LEN];
+    url_host(copy, host, sizeof(host));
+    if (client->connected && strcmp(host, client->conn_host) != 0) {
+        disconnect(client);
+    }
+    free(client->url);
+    client->url = copy;
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_set_method(esp_http_client_handle_t client, esp_http_client_method_t method)
+{
+    if (client == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    client->method = method;
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_set_header(esp_http_client_handle_t client, const char *key, const char *value)
+{
+    if (client == NULL || key == NULL || value == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    standin_header_t *slot = NULL;
+    for (int i = 0; i < STANDIN_MAX_HEADERS; i++) {
+        standin_header_t *h = &client->headers[i];
+        if (h->key && strcasecmp(h->key, key) == 0) {
+            slot = h;
+            break;
+        }
+        if (h->key == NULL && slot == NULL) {
+            slot = h;
+        }
+    }
+    if (slot == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    char *v = strdup(value);
+    if (v == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (slot->key == NULL) {
+        slot->key = strdup(key);
+    }
+    free(slot->value);
+    slot->value = v;
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_delete_header(esp_http_client_handle_t client, const char *key)
+{
+    if (client == NULL || key == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (int i = 0; i < STANDIN_MAX_HEADERS; i++) {
+        standin_header_t *h = &client->headers[i];
+        if (h->key && strcasecmp(h->key, key) == 0) {
+            free(h->key);
+            free(h->value);
+            h->key = NULL;
+            h->value = NULL;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_set_post_field(esp_http_client_handle_t client, const char *data, int len)
+{
+    if (client == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    client->post_data = data;
+    client->post_len = data ? len : 0;
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_set_redirection(esp_http_client_handle_t client)
+{
+    return client ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+int esp_http_client_get_status_code(esp_http_client_handle_t client)
+{
+    return client ? client->status : -1;
+}
+
+int64_t esp_http_client_get_content_length(esp_http_client_handle_t client)
+{
+    return client ? client->content_length : -1;
+}
+
+esp_err_t esp_http_client_perform(esp_http_client_handle_t client)
+{
+    if (client == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&s_lock);
+    host_http_standin_config_t cfg = s_config;
+    s_stats.requests++;
+    pthread_mutex_unlock(&s_lock);
+
+    client->status = 0;
+    client->content_length = -1;
+
+    if (client->connected &&
+        host_clock_now_us() - client->last_active_us > (int64_t)cfg.idle_close_ms * 1000) {
+        // The server closed the idle connection; the request dies on the dead socket
+        ESP_LOGD(TAG, "%s: connection closed by server while idle", client->conn_host);
+        pthread_mutex_lock(&s_lock);
+        s_stats.idle_closes++;
+        pthread_mutex_unlock(&s_lock);
+        disconnect(client);
+        emit(client, HTTP_EVENT_ERROR, NULL, 0);
+        return ESP_ERR_HTTP_FETCH_HEADER;
+    }
+
+    if (!client->connected) {
+        host_clock_sleep_us((int64_t)cfg.connect_ms * 1000);
+        url_host(client->url, client->conn_host, sizeof(client->conn_host));
+        client->connected = true;
+        pthread_mutex_lock(&s_lock);
+        s_stats.connects++;
+        pthread_mutex_unlock(&s_lock);
+        emit(client, HTTP_EVENT_ON_CONNECTED, NULL, 0);
+    }
+    emit(client, HTTP_EVENT_HEADERS_SENT, NULL, 0);
+
+    uint32_t delay_ms = 0;
+    const char *type = NULL;
+    char *body = respond(client, &cfg, &delay_ms, &client->status, &type);
+    if (body == NULL) {
+        disconnect(client);
+        return ESP_ERR_NO_MEM;
+    }
+    host_clock_sleep_us((int64_t)delay_ms * 1000);
+
+    int len = (int)strlen(body);
+    client->content_length = len;
+    char length[16];
+    snprintf(length, sizeof(length), "%d", len);
+    char date[40];
+    time_t now = (time_t)server_time();
+    struct tm tm;
+    strftime(date, sizeof(date), "%a, %d %b %Y %H:%M:%S GMT", gmtime_r(&now, &tm));
+    emit_header(client, "Date", date);
+    emit_header(client, "Content-Type", type);
+    emit_header(client, "Content-Length", length);
+    for (int off = 0; off < len; off += STANDIN_CHUNK_SIZE) {
+        int n = len - off < STANDIN_CHUNK_SIZE ? len - off : STANDIN_CHUNK_SIZE;
+        emit(client, HTTP_EVENT_ON_DATA, body + off, n);
+    }
+    emit(client, HTTP_EVENT_ON_FINISH, NULL, 0);
+    free(body);
+
+    // HTTP/1.1: the connection stays open until closed or cleaned up
+    client->last_active_us = host_clock_now_us();
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_close(esp_http_client_handle_t client)
+{
+    if (client == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    disconnect(client);
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_cleanup(esp_http_client_handle_t client)
+{
+    if (client == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    disconnect(client);
+    for (int i = 0; i < STANDIN_MAX_HEADERS; i++) {
+        free(client->headers[i].key);
+        free(client->headers[i].value);
+    }
+    free(client->url);
+    free(client);
+    return ESP_OK;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file esp_codec_dev.h
+ * @brief esp_codec_dev API for host builds
+ *
+ * Handles are created by the host (see host_codec_wav_open_input() /
+ * host_codec_wav_open_output() in host_shim.h) and backed by WAV files.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ESP_CODEC_DEV_OK            (0)
+#define ESP_CODEC_DEV_DRV_ERR       (-1)
+#define ESP_CODEC_DEV_INVALID_ARG   (-2)
+#define ESP_CODEC_DEV_NO_MEM        (-3)
+#define ESP_CODEC_DEV_NOT_SUPPORT   (-4)
+#define ESP_CODEC_DEV_NOT_FOUND     (-5)
+#define ESP_CODEC_DEV_WRONG_STATE   (-6)
+#define ESP_CODEC_DEV_WRITE_FAIL    (-7)
+#define ESP_CODEC_DEV_READ_FAIL     (-8)
+
+typedef struct host_codec *esp_codec_dev_handle_t;
+
+typedef struct {
+    uint8_t bits_per_sample;
+    uint8_t channel;
+    uint16_t channel_mask;
+    uint32_t sample_rate;
+    int mclk_multiple;
+} esp_codec_dev_sample_info_t;
+
+int esp_codec_dev_open(esp_codec_dev_handle_t dev, esp_codec_dev_sample_info_t *fs);
+int esp_codec_dev_read(esp_codec_dev_handle_t dev, void *data, int len);
+int esp_codec_dev_write(esp_codec_dev_handle_t dev, void *data, int len);
+int esp_codec_dev_close(esp_codec_dev_handle_t dev);
+int esp_codec_dev_set_out_vol(esp_codec_dev_handle_t dev, int volume);
+int esp_codec_dev_set_out_mute(esp_codec_dev_handle_t dev, bool mute);
+int esp_codec_dev_set_in_gain(esp_codec_dev_handle_t dev, float db_value);
+
+#ifdef __cplusplus
+}
+#endif
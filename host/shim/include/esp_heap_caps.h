@@ -0,0 +1,94 @@
+/**
+ * @file esp_heap_caps.h
+ * @brief Capability-aware heap API for host builds (plain malloc)
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MALLOC_CAP_EXEC         (1 << 0)
+#define MALLOC_CAP_32BIT        (1 << 1)
+#define MALLOC_CAP_8BIT         (1 << 2)
+#define MALLOC_CAP_DMA          (1 << 3)
+#define MALLOC_CAP_SPIRAM       (1 << 10)
+#define MALLOC_CAP_INTERNAL     (1 << 11)
+#define MALLOC_CAP_DEFAULT      (1 << 12)
+
+// Reported sizes mimic an ESP32-S3 with 8 MB PSRAM
+#define HOST_HEAP_INTERNAL_SIZE (320 * 1024)
+#define HOST_HEAP_SPIRAM_SIZE   (8 * 1024 * 1024)
+
+// Internal heap the host tool reports as in use (host_heap_set_used())
+size_t host_heap_get_used(void);
+size_t host_heap_get_peak(void);
+
+static inline void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    (void)caps;
+    return malloc(size);
+}
+
+static inline void *heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    (void)caps;
+    return calloc(n, size);
+}
+
+static inline void *heap_caps_realloc(void *ptr, size_t size, uint32_t caps)
+{
+    (void)caps;
+    return realloc(ptr, size);
+}
+
+static inline void *heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps)
+{
+    (void)caps;
+    void *ptr = NULL;
+    return posix_memalign(&ptr, alignment < sizeof(void *) ? sizeof(void *) : alignment, size) == 0 ? ptr : NULL;
+}
+
+static inline void heap_caps_free(void *ptr)
+{
+    free(ptr);
+}
+
+static inline size_t heap_caps_get_total_size(uint32_t caps)
+{
+    return (caps & MALLOC_CAP_SPIRAM) ? HOST_HEAP_SPIRAM_SIZE : HOST_HEAP_INTERNAL_SIZE;
+}
+
+static inline size_t heap_caps_get_free_size(uint32_t caps)
+{
+    return (caps & MALLOC_CAP_SPIRAM) ? HOST_HEAP_SPIRAM_SIZE : HOST_HEAP_INTERNAL_SIZE - host_heap_get_used();
+}
+
+static inline size_t heap_caps_get_minimum_free_size(uint32_t caps)
+{
+    return (caps & MALLOC_CAP_SPIRAM) ? HOST_HEAP_SPIRAM_SIZE : HOST_HEAP_INTERNAL_SIZE - host_heap_get_peak();
+}
+
+static inline size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+    return heap_caps_get_free_size(caps);
+}
+
+static inline uint32_t esp_get_free_heap_size(void)
+{
+    return HOST_HEAP_INTERNAL_SIZE + HOST_HEAP_SPIRAM_SIZE;
+}
+
+static inline uint32_t esp_get_minimum_free_heap_size(void)
+{
+    return esp_get_free_heap_size();
+}
+
+#ifdef __cplusplus
+}
+#endif
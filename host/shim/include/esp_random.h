@@ -0,0 +1,25 @@
+/**
+ * @file esp_random.h
+ * @brief ESP-IDF random number API for host builds
+ *
+ * Backed by random() with its default seed, so backoff jitter repeats from
+ * run to run.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline uint32_t esp_random(void)
+{
+    return ((uint32_t)random() << 16) ^ (uint32_t)random();
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,22 @@
+/**
+ * @file esp_system.h
+ * @brief ESP-IDF system API for host builds
+ */
+
+#pragma once
+
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline void esp_restart(void)
+{
+    exit(0);
+}
+
+#ifdef __cplusplus
+}
+#endif
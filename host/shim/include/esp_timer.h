@@ -0,0 +1,22 @@
+/**
+ * @file esp_timer.h
+ * @brief ESP-IDF timer API for host builds
+ *
+ * esp_timer_get_time() returns the host virtual clock, so it stays
+ * consistent with FreeRTOS ticks when a replay runs accelerated.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int64_t esp_timer_get_time(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,23 @@
+/**
+ * @file esp_transport.h
+ * @brief tcp_transport handle API for host builds
+ *
+ * Transports only carry the TLS session state the stand-in models
+ * (host/shim/ws_standin.c); there is no socket behind them.
+ */
+
+#pragma once
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct host_transport *esp_transport_handle_t;
+
+esp_err_t esp_transport_destroy(esp_transport_handle_t t);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,29 @@
+/**
+ * @file esp_transport_ssl.h
+ * @brief SSL transport API for host builds (session ticket model only)
+ */
+
+#pragma once
+
+#include "esp_transport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    ESP_TRANSPORT_SESSION_TICKET_INIT,
+    ESP_TRANSPORT_SESSION_TICKET_SAVE,
+    ESP_TRANSPORT_SESSION_TICKET_USE,
+    ESP_TRANSPORT_SESSION_TICKET_FREE,
+} esp_transport_session_ticket_operation_t;
+
+esp_transport_handle_t esp_transport_ssl_init(void);
+void esp_transport_ssl_crt_bundle_attach(esp_transport_handle_t t, esp_err_t ((*crt_bundle_attach)(void *conf)));
+void esp_transport_ssl_skip_common_name_check(esp_transport_handle_t t);
+void esp_transport_ssl_session_ticket_operation(esp_transport_handle_t t,
+                                                esp_transport_session_ticket_operation_t operation);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,20 @@
+/**
+ * @file esp_transport_ws.h
+ * @brief WebSocket transport API for host builds
+ */
+
+#pragma once
+
+#include "esp_transport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+esp_transport_handle_t esp_transport_ws_init(esp_transport_handle_t parent_handle);
+void esp_transport_ws_set_path(esp_transport_handle_t t, const char *path);
+esp_err_t esp_transport_ws_set_headers(esp_transport_handle_t t, const char *headers);
+
+#ifdef __cplusplus
+}
+#endif
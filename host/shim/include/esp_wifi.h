@@ -0,0 +1,37 @@
+/**
+ * @file esp_wifi.h
+ * @brief ESP-IDF Wi-Fi station queries for host builds
+ *
+ * The host is always associated to one fixed access point; connection
+ * state and RSSI come from app_wifi, which host tools provide.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint8_t bssid[6];
+    uint8_t ssid[33];
+    uint8_t primary;
+    int8_t  rssi;
+} wifi_ap_record_t;
+
+static inline esp_err_t esp_wifi_sta_get_ap_info(wifi_ap_record_t *ap_info)
+{
+    memset(ap_info, 0, sizeof(*ap_info));
+    memcpy(ap_info->ssid, "host-ap", sizeof("host-ap"));
+    ap_info->primary = 6;
+    ap_info->rssi = -55;
+    return ESP_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,109 @@
+/**
+ * @file FreeRTOS.h
+ * @brief FreeRTOS-on-POSIX shim for host builds
+ *
+ * Implements the subset of the FreeRTOS / ESP-IDF kernel API used by the
+ * firmware components (tasks, queues, semaphores, byte ring buffers,
+ * critical sections) on top of pthreads. Ticks follow the host virtual
+ * clock (see host_shim.h), so accelerated replays keep every timeout and
+ * delay in proportion.
+ *
+ * The companion headers (task.h, queue.h, semphr.h, ringbuf.h) all include
+ * this one.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <assert.h>
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================
+// Kernel Configuration (matches sdkconfig)
+// ============================================
+
+#define configTICK_RATE_HZ          1000
+#define configMAX_PRIORITIES        25
+#define configASSERT(x)             assert(x)
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t StackType_t;
+
+#define pdFALSE                     ((BaseType_t)0)
+#define pdTRUE                      ((BaseType_t)1)
+#define pdFAIL                      pdFALSE
+#define pdPASS                      pdTRUE
+#define errQUEUE_FULL               ((BaseType_t)0)
+#define errQUEUE_EMPTY              ((BaseType_t)0)
+
+#define portMAX_DELAY               ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS          ((TickType_t)1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms)           ((TickType_t)(((TickType_t)(ms) * (TickType_t)configTICK_RATE_HZ) / (TickType_t)1000U))
+#define pdTICKS_TO_MS(t)            ((TickType_t)(((TickType_t)(t) * (TickType_t)1000U) / (TickType_t)configTICK_RATE_HZ))
+#define portNUM_PROCESSORS          2
+#define tskNO_AFFINITY              ((BaseType_t)0x7FFFFFFF)
+
+// ============================================
+// Critical Sections
+// ============================================
+
+typedef struct {
+    pthread_mutex_t mutex;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED    { PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP }
+
+#define portENTER_CRITICAL(mux)         pthread_mutex_lock(&(mux)->mutex)
+#define portEXIT_CRITICAL(mux)          pthread_mutex_unlock(&(mux)->mutex)
+#define portENTER_CRITICAL_ISR(mux)     portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux)      portEXIT_CRITICAL(mux)
+#define portENTER_CRITICAL_SAFE(mux)    portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_SAFE(mux)     portEXIT_CRITICAL(mux)
+#define taskENTER_CRITICAL(mux)         portENTER_CRITICAL(mux)
+#define taskEXIT_CRITICAL(mux)          portEXIT_CRITICAL(mux)
+#define spinlock_initialize(mux)        pthread_mutex_init(&(mux)->mutex, NULL)
+
+#define portYIELD_FROM_ISR(...)         do { } while (0)
+#define IRAM_ATTR
+#define EXT_RAM_BSS_ATTR
+
+static inline BaseType_t xPortGetCoreID(void)
+{
+    return 0;
+}
+
+static inline bool xPortCanYield(void)
+{
+    return true;
+}
+
+// ============================================
+// Handles
+// ============================================
+
+typedef struct host_task *TaskHandle_t;
+typedef struct host_queue *QueueHandle_t;
+typedef QueueHandle_t SemaphoreHandle_t;
+typedef struct host_ringbuf *RingbufHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+/**
+ * @brief Static queue control block (storage is honoured, the block is not)
+ */
+typedef struct {
+    void *reserved;
+} StaticQueue_t;
+
+typedef StaticQueue_t StaticSemaphore_t;
+
+#ifdef __cplusplus
+}
+#endif
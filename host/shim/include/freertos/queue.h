@@ -0,0 +1,36 @@
+/**
+ * @file queue.h
+ * @brief FreeRTOS queue API shim
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+QueueHandle_t xQueueCreateStatic(UBaseType_t length, UBaseType_t item_size,
+                                 uint8_t *storage, StaticQueue_t *queue_buffer);
+void vQueueDelete(QueueHandle_t queue);
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks);
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void *item, TickType_t ticks);
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void *item);
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks);
+BaseType_t xQueuePeek(QueueHandle_t queue, void *item, TickType_t ticks);
+BaseType_t xQueueReset(QueueHandle_t queue);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue);
+
+#define xQueueSendToBack(q, item, ticks)                xQueueSend((q), (item), (ticks))
+#define xQueueSendFromISR(q, item, woken)               xQueueSend((q), (item), 0)
+#define xQueueSendToBackFromISR(q, item, woken)         xQueueSend((q), (item), 0)
+#define xQueueReceiveFromISR(q, item, woken)            xQueueReceive((q), (item), 0)
+#define uxQueueMessagesWaitingFromISR(q)                uxQueueMessagesWaiting(q)
+
+#ifdef __cplusplus
+}
+#endif
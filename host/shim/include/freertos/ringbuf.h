@@ -0,0 +1,40 @@
+/**
+ * @file ringbuf.h
+ * @brief ESP-IDF ring buffer API shim (byte buffers only)
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    RINGBUF_TYPE_NOSPLIT = 0,
+    RINGBUF_TYPE_ALLOWSPLIT,
+    RINGBUF_TYPE_BYTEBUF,
+    RINGBUF_TYPE_MAX,
+} RingbufferType_t;
+
+/**
+ * @brief Create a ring buffer
+ *
+ * Only RINGBUF_TYPE_BYTEBUF is implemented; other types return NULL.
+ */
+RingbufHandle_t xRingbufferCreate(size_t size, RingbufferType_t type);
+void vRingbufferDelete(RingbufHandle_t ringbuf);
+
+BaseType_t xRingbufferSend(RingbufHandle_t ringbuf, const void *data, size_t size, TickType_t ticks);
+void *xRingbufferReceive(RingbufHandle_t ringbuf, size_t *size, TickType_t ticks);
+void *xRingbufferReceiveUpTo(RingbufHandle_t ringbuf, size_t *size, TickType_t ticks, size_t max_size);
+void vRingbufferReturnItem(RingbufHandle_t ringbuf, void *item);
+size_t xRingbufferGetCurFreeSize(RingbufHandle_t ringbuf);
+size_t xRingbufferGetMaxItemSize(RingbufHandle_t ringbuf);
+
+#define xRingbufferSendFromISR(rb, data, size, woken)   xRingbufferSend((rb), (data), (size), 0)
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,34 @@
+/**
+ * @file semphr.h
+ * @brief FreeRTOS semaphore API shim
+ *
+ * Semaphores are counting queues without payload, as in FreeRTOS. Mutexes
+ * are not recursive and carry no priority inheritance.
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+
+#define xSemaphoreCreateMutex()                 xSemaphoreCreateCounting(1, 1)
+#define xSemaphoreCreateRecursiveMutex()        xSemaphoreCreateCounting(1, 1)
+#define xSemaphoreCreateBinary()                xSemaphoreCreateCounting(1, 0)
+#define xSemaphoreCreateMutexStatic(buf)        xSemaphoreCreateCounting(1, 1)
+#define xSemaphoreCreateBinaryStatic(buf)       xSemaphoreCreateCounting(1, 0)
+#define vSemaphoreDelete(sem)                   vQueueDelete(sem)
+#define xSemaphoreGiveFromISR(sem, woken)       xSemaphoreGive(sem)
+#define xSemaphoreTakeFromISR(sem, woken)       xSemaphoreTake((sem), 0)
+#define uxSemaphoreGetCount(sem)                uxQueueMessagesWaiting(sem)
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,319 @@
+/**
+ * @file host_shim.h
+ * @brief Host-side controls for the ESP-IDF / FreeRTOS shim
+ *
+ * The shim runs firmware components unmodified on a POSIX host. Everything
+ * here is host-only: the virtual clock that paces ticks and esp_timer, task
+ * accounting (CPU time and failed sends per task, i.e. per pipeline stage),
+ * WAV-backed codec devices and the in-process realtime WebSocket and HTTPS
+ * endpoint stand-ins.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_codec_dev.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================
+// Virtual Clock
+// ============================================
+
+/**
+ * @brief Set the virtual clock speed
+ *
+ * 1.0 runs in real time; 10.0 runs every delay, timeout and paced codec ten
+ * times faster while all firmware-visible times stay in device units.
+ *
+ * @param speed Virtual seconds per real second (> 0)
+ */
+void host_clock_set_speed(double speed);
+
+/**
+ * @brief Get the virtual clock speed
+ */
+double host_clock_get_speed(void);
+
+/**
+ * @brief Virtual microseconds since start (what esp_timer_get_time() returns)
+ */
+int64_t host_clock_now_us(void);
+
+/**
+ * @brief Sleep for a virtual duration
+ *
+ * @param us Virtual microseconds
+ */
+void host_clock_sleep_us(int64_t us);
+
+/**
+ * @brief Set the global log level (default ESP_LOG_INFO)
+ */
+void host_log_set_level(esp_log_level_t level);
+
+/**
+ * @brief Send log output to a stream (default stderr, NULL restores it)
+ */
+void host_log_set_output(FILE *out);
+
+// ============================================
+// Heap
+// ============================================
+
+/**
+ * @brief Set how much internal heap heap_caps_get_free_size() reports as used
+ *
+ * Host allocations are plain malloc and never show up in the reported
+ * sizes; tools that exercise heap monitoring set the usage here.
+ *
+ * @param bytes Bytes in use, at most HOST_HEAP_INTERNAL_SIZE
+ */
+void host_heap_set_used(size_t bytes);
+
+// ============================================
+// Task Accounting
+// ============================================
+
+/**
+ * @brief Per-task statistics
+ */
+typedef struct {
+    char name[16];
+    uint64_t cpu_us;                    // Thread CPU time (real, not virtual)
+    uint32_t queue_send_fail;           // xQueueSend timeouts issued by this task
+    uint32_t ringbuf_send_fail;         // xRingbufferSend timeouts issued by this task
+    bool running;
+} host_task_stats_t;
+
+typedef void (*host_task_stats_cb_t)(const host_task_stats_t *stats, void *ctx);
+
+/**
+ * @brief Register the calling thread (e.g. main) so its work is accounted
+ *
+ * @param name Task name
+ */
+void host_task_register_current(const char *name);
+
+/**
+ * @brief Visit statistics of every task created so far
+ *
+ * @param cb Callback, invoked once per task
+ * @param ctx Callback context
+ */
+void host_task_foreach(host_task_stats_cb_t cb, void *ctx);
+
+// ============================================
+// WAV Codec Devices
+// ============================================
+
+/**
+ * @brief Codec device statistics
+ */
+typedef struct {
+    uint32_t sample_rate;               // Rate requested by esp_codec_dev_open()
+    uint64_t bytes;                     // PCM bytes read or written
+    uint32_t calls;                     // read / write calls
+    uint32_t underruns;                 // Output: writer late, DMA would have played silence
+    uint32_t late_reads;                // Input: reader late, DMA would have dropped samples
+} host_codec_stats_t;
+
+/**
+ * @brief Open a 16-bit PCM WAV file as a microphone
+ *
+ * Reads are paced at the sample rate on the virtual clock (like I2S DMA)
+ * unless paced is false. After the file is exhausted the device keeps
+ * returning silence so VAD can close the last utterance.
+ *
+ * @param path WAV file path
+ * @param paced true to block reads in real time (virtual clock)
+ * @return Codec handle, NULL on error
+ */
+esp_codec_dev_handle_t host_codec_wav_open_input(const char *path, bool paced);
+
+/**
+ * @brief Create a WAV file as a speaker
+ *
+ * The WAV format follows the first esp_codec_dev_open() call.
+ *
+ * @param path WAV file path (NULL discards output)
+ * @param paced true to block writes in real time (virtual clock)
+ * @return Codec handle, NULL on error
+ */
+esp_codec_dev_handle_t host_codec_wav_open_output(const char *path, bool paced);
+
+/**
+ * @brief Sample rate of an input device's WAV file
+ *
+ * The mic is not resampled: esp_codec_dev_open() at any other rate fails.
+ *
+ * @return Hz, 0 for NULL or an output device
+ */
+uint32_t host_codec_input_rate(esp_codec_dev_handle_t dev);
+
+/**
+ * @brief Check whether an input device has served its whole file
+ */
+bool host_codec_input_exhausted(esp_codec_dev_handle_t dev);
+
+/**
+ * @brief Get codec device statistics
+ */
+void host_codec_get_stats(esp_codec_dev_handle_t dev, host_codec_stats_t *stats);
+
+/**
+ * @brief Finalize the WAV header (outputs) and free the device
+ */
+void host_codec_wav_release(esp_codec_dev_handle_t dev);
+
+/**
+ * @brief Load a 16-bit mono PCM WAV file into memory
+ *
+ * @param path WAV file path
+ * @param samples Output, malloc'd samples (caller frees)
+ * @param count Output, sample count
+ * @param sample_rate Output, sample rate
+ * @return ESP_OK on success
+ */
+esp_err_t host_wav_load(const char *path, int16_t **samples, size_t *count, uint32_t *sample_rate);
+
+// ============================================
+// Realtime Endpoint Stand-in
+// ============================================
+
+/**
+ * @brief Stand-in behaviour
+ *
+ * The protocol (Coze or Azure) is picked from the client URI. All times are
+ * virtual milliseconds. The input audio buffer belongs to the connection, as
+ * on the service: audio sent before a drop is gone on the next one.
+ */
+typedef struct {
+    uint32_t connect_ms;                // DNS + TCP + full TLS handshake + upgrade
+    uint32_t resume_ms;                 // Same with an abbreviated (ticket) TLS handshake
+    bool session_tickets;               // Server issues TLS session tickets
+    bool drop_after_response;           // Close the connection after every response
+    uint32_t drop_mid_utterance;        // Close after this many audio appends in an utterance (0: off)
+    uint32_t response_delay_ms;         // Commit to first response event
+    uint32_t delta_ms;                  // Audio per response delta
+    uint32_t delta_interval_ms;         // Spacing between deltas (server pacing)
+    const int16_t *response_pcm;        // 8 kHz response audio (NULL: 1 s tone)
+    size_t response_samples;
+} host_ws_standin_config_t;
+
+#define HOST_WS_STANDIN_DEFAULT_CONFIG() { \
+    .connect_ms = 400,                      \
+    .resume_ms = 150,                       \
+    .session_tickets = true,                \
+    .drop_after_response = false,           \
+    .drop_mid_utterance = 0,                \
+    .response_delay_ms = 600,               \
+    .delta_ms = 100,                        \
+    .delta_interval_ms = 40,                \
+    .response_pcm = NULL,                   \
+    .response_samples = 0,                  \
+}
+
+/**
+ * @brief Stand-in statistics
+ */
+typedef struct {
+    uint32_t connects;
+    uint32_t resumed;                   // Connects that used a session ticket
+    uint32_t drops;                     // Connections closed by the server
+    uint32_t frames_in;                 // Client frames received
+    uint64_t audio_bytes_in;            // Base64 audio payload received
+    uint32_t commits;
+    uint32_t empty_commits;             // Commits with < 100 ms in the server's buffer (rejected)
+    uint32_t responses;
+    uint32_t deltas_out;
+} host_ws_standin_stats_t;
+
+/**
+ * @brief Configure the stand-in (applies to clients started afterwards)
+ */
+void host_ws_standin_configure(const host_ws_standin_config_t *config);
+
+/**
+ * @brief Get stand-in statistics
+ */
+void host_ws_standin_get_stats(host_ws_standin_stats_t *stats);
+
+// ============================================
+// HTTPS Endpoint Stand-in
+// ============================================
+
+/**
+ * @brief HTTPS stand-in behaviour (esp_http_client)
+ *
+ * Paths containing "/sessions" create an ephemeral token; "/realtimertc" and
+ * "/v1/realtime" answer an SDP offer. Anything else is a 404. All times are
+ * virtual milliseconds.
+ */
+typedef struct {
+    uint32_t connect_ms;                // DNS + TCP + full TLS handshake
+    uint32_t token_ms;                  // Session (ephemeral token) creation
+    uint32_t sdp_ms;                    // SDP offer to answer
+    uint32_t idle_close_ms;             // Server closes keep-alive connections idle this long
+    uint32_t token_ttl_s;               // Lifetime of issued tokens (expires_at)
+} host_http_standin_config_t;
+
+#define HOST_HTTP_STANDIN_DEFAULT_CONFIG() { \
+    .connect_ms = 350,                      \
+    .token_ms = 450,                        \
+    .sdp_ms = 300,                          \
+    .idle_close_ms = 60000,                 \
+    .token_ttl_s = 60,                      \
+}
+
+/**
+ * @brief HTTPS stand-in statistics
+ */
+typedef struct {
+    uint32_t requests;
+    uint32_t connects;                  // New connections (full handshakes)
+    uint32_t idle_closes;               // Requests that found their connection closed by the server
+    uint32_t tokens;                    // Tokens issued
+    uint32_t answers;                   // SDP answers sent
+} host_http_standin_stats_t;
+
+/**
+ * @brief Configure the HTTPS stand-in (applies to requests made afterwards)
+ */
+void host_http_standin_configure(const host_http_standin_config_t *config);
+
+/**
+ * @brief Get HTTPS stand-in statistics
+ */
+void host_http_standin_get_stats(host_http_standin_stats_t *stats);
+
+// ============================================
+// media_lib_sal
+// ============================================
+
+/**
+ * @brief Register the host OS port for media_lib_sal
+ *
+ * Host counterpart of media_lib_add_default_adapter() for the OS wrappers
+ * used by data_queue, av_render and esp_capture. Only linked into targets
+ * that build host_media_lib.
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t host_media_lib_os_register(void);
+
+/**
+ * @brief Make media_lib_realloc() fail, to exercise out-of-memory paths
+ */
+void host_media_lib_fail_realloc(bool fail);
+
+#ifdef __cplusplus
+}
+#endif
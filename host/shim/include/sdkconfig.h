@@ -0,0 +1,9 @@
+/**
+ * @file sdkconfig.h
+ * @brief Host stand-in for the generated ESP-IDF configuration
+ *
+ * Components that include sdkconfig.h only to test CONFIG_IDF_TARGET_* or
+ * optional features see an empty configuration: every option is off.
+ */
+
+#pragma once
@@ -0,0 +1,293 @@
+/**
+ * @file media_lib_os_host.c
+ * @brief media_lib_sal OS port for the host shim
+ *
+ * Same shape as components/media_lib_sal/port/media_lib_os_freertos.c:
+ * threads, semaphores and event groups go through the FreeRTOS shim (so
+ * they follow the virtual clock and show up in task accounting). Mutexes
+ * are pthread recursive mutexes because the shim's recursive mutex is a
+ * plain binary semaphore.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "media_lib_os_reg.h"
+#include "host_shim.h"
+
+#define TAG "MEDIA_OS_HOST"
+
+#define RETURN_ON_NULL_HANDLE(h)                                               \
+    if (h == NULL) {                                                           \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+// ============================================
+// Memory
+// ============================================
+
+static _Atomic bool s_fail_realloc = false;
+
+static void *_realloc(void *ptr, size_t size)
+{
+    return s_fail_realloc ? NULL : realloc(ptr, size);
+}
+
+void host_media_lib_fail_realloc(bool fail)
+{
+    s_fail_realloc = fail;
+}
+
+static void *_malloc_align(size_t size, uint8_t align)
+{
+    if (!align || ((align & (align - 1)) != 0)) {
+        return NULL;
+    }
+    size += align;
+    uint8_t *buf = (uint8_t *)malloc(size);
+    if (buf == NULL) {
+        return NULL;
+    }
+    uint8_t *aligned = (uint8_t *)(((size_t)buf + align) & (~(align - 1)));
+    aligned[-1] = (uint8_t)(size_t)(aligned - buf);
+    return aligned;
+}
+
+static void _free_align(void *addr)
+{
+    if (addr == NULL) {
+        return;
+    }
+    uint8_t *aligned = (uint8_t *)addr;
+    free(aligned - aligned[-1]);
+}
+
+static int _get_stack_frame(void **addr, int n)
+{
+    return 0;
+}
+
+// ============================================
+// Threads
+// ============================================
+
+static int _thread_create(media_lib_thread_handle_t *handle, const char *name,
+                          void (*body)(void *arg), void *arg, uint32_t stack_size,
+                          int prio, int core)
+{
+    if (xTaskCreatePinnedToCore(body, name, stack_size, arg, prio,
+                                (TaskHandle_t *)handle, core) != pdPASS) {
+        ESP_LOGE(TAG, "Fail to create thread %s", name);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static void _thread_destroy(media_lib_thread_handle_t handle)
+{
+    // allow NULL to destroy self
+    vTaskDelete((TaskHandle_t)handle);
+}
+
+static bool _thread_set_priority(media_lib_thread_handle_t handle, int prio)
+{
+    return true;
+}
+
+static void _thread_sleep(uint32_t ms)
+{
+    vTaskDelay(ms / portTICK_PERIOD_MS);
+}
+
+// ============================================
+// Semaphores
+// ============================================
+
+static int _sema_create(media_lib_sema_handle_t *sema)
+{
+    if (sema) {
+        *sema = (media_lib_sema_handle_t)xSemaphoreCreateCounting(1, 0);
+        if (*sema != NULL) {
+            return ESP_OK;
+        }
+    }
+    return ESP_FAIL;
+}
+
+static int _sema_lock_timeout(media_lib_sema_handle_t sema, uint32_t timeout)
+{
+    RETURN_ON_NULL_HANDLE(sema);
+    if (timeout != portMAX_DELAY) {
+        timeout /= portTICK_PERIOD_MS;
+    }
+    return xSemaphoreTake((SemaphoreHandle_t)sema, timeout) ? ESP_OK : ESP_FAIL;
+}
+
+static int _sema_unlock(media_lib_sema_handle_t sema)
+{
+    RETURN_ON_NULL_HANDLE(sema);
+    xSemaphoreGive((SemaphoreHandle_t)sema);
+    return ESP_OK;
+}
+
+static int _sema_destroy(media_lib_sema_handle_t sema)
+{
+    RETURN_ON_NULL_HANDLE(sema);
+    vSemaphoreDelete((SemaphoreHandle_t)sema);
+    return ESP_OK;
+}
+
+// ============================================
+// Mutexes
+// ============================================
+
+static int _mutex_create(media_lib_mutex_handle_t *mutex)
+{
+    RETURN_ON_NULL_HANDLE(mutex);
+    pthread_mutex_t *m = (pthread_mutex_t *)malloc(sizeof(pthread_mutex_t));
+    if (m == NULL) {
+        return ESP_FAIL;
+    }
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(m, &attr);
+    pthread_mutexattr_destroy(&attr);
+    *mutex = (media_lib_mutex_handle_t)m;
+    return ESP_OK;
+}
+
+static int _mutex_lock_timeout(media_lib_mutex_handle_t mutex, uint32_t timeout)
+{
+    RETURN_ON_NULL_HANDLE(mutex);
+    pthread_mutex_t *m = (pthread_mutex_t *)mutex;
+    if (timeout == portMAX_DELAY) {
+        return pthread_mutex_lock(m) == 0 ? ESP_OK : ESP_FAIL;
+    }
+    // Timeout is in virtual milliseconds
+    int64_t real_us = (int64_t)((double)timeout * 1000.0 / host_clock_get_speed());
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += real_us / 1000000;
+    deadline.tv_nsec += (real_us % 1000000) * 1000;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+    return pthread_mutex_timedlock(m, &deadline) == 0 ? ESP_OK : ESP_FAIL;
+}
+
+static int _mutex_unlock(media_lib_mutex_handle_t mutex)
+{
+    RETURN_ON_NULL_HANDLE(mutex);
+    return pthread_mutex_unlock((pthread_mutex_t *)mutex) == 0 ? ESP_OK : ESP_FAIL;
+}
+
+static int _mutex_destroy(media_lib_mutex_handle_t mutex)
+{
+    RETURN_ON_NULL_HANDLE(mutex);
+    pthread_mutex_destroy((pthread_mutex_t *)mutex);
+    free(mutex);
+    return ESP_OK;
+}
+
+static int _enter_critical(void)
+{
+    return ESP_OK;
+}
+
+static int _leave_critical(void)
+{
+    return ESP_OK;
+}
+
+// ============================================
+// Event Groups
+// ============================================
+
+static int _event_group_create(media_lib_event_grp_handle_t *group)
+{
+    RETURN_ON_NULL_HANDLE(group);
+    *group = (media_lib_event_grp_handle_t)xEventGroupCreate();
+    return *group ? ESP_OK : ESP_FAIL;
+}
+
+static uint32_t _event_group_set_bits(media_lib_event_grp_handle_t group, uint32_t bits)
+{
+    RETURN_ON_NULL_HANDLE(group);
+    return (uint32_t)xEventGroupSetBits((EventGroupHandle_t)group, bits);
+}
+
+static uint32_t _event_group_clr_bits(media_lib_event_grp_handle_t group, uint32_t bits)
+{
+    RETURN_ON_NULL_HANDLE(group);
+    return (uint32_t)xEventGroupClearBits((EventGroupHandle_t)group, bits);
+}
+
+static uint32_t _event_group_wait_bits(media_lib_event_grp_handle_t group,
+                                       uint32_t bits, uint32_t timeout)
+{
+    RETURN_ON_NULL_HANDLE(group);
+    if (timeout != portMAX_DELAY) {
+        timeout /= portTICK_PERIOD_MS;
+    }
+    return (uint32_t)xEventGroupWaitBits((EventGroupHandle_t)group, bits, false,
+                                         true, timeout);
+}
+
+static int _event_group_destroy(media_lib_event_grp_handle_t group)
+{
+    RETURN_ON_NULL_HANDLE(group);
+    vEventGroupDelete((EventGroupHandle_t)group);
+    return ESP_OK;
+}
+
+// ============================================
+// Registration
+// ============================================
+
+esp_err_t host_media_lib_os_register(void)
+{
+    media_lib_os_t os_lib = {
+        .malloc = malloc,
+        .free = free,
+        .calloc = calloc,
+        .realloc = _realloc,
+        .malloc_align = _malloc_align,
+        .free_align = _free_align,
+        .strdup = strdup,
+        .get_stack_frame = _get_stack_frame,
+
+        .thread_create = _thread_create,
+        .thread_destroy = _thread_destroy,
+        .thread_set_prio = _thread_set_priority,
+        .thread_sleep = _thread_sleep,
+
+        .sema_create = _sema_create,
+        .sema_lock = _sema_lock_timeout,
+        .sema_unlock = _sema_unlock,
+        .sema_destroy = _sema_destroy,
+
+        .mutex_create = _mutex_create,
+        .mutex_lock = _mutex_lock_timeout,
+        .mutex_unlock = _mutex_unlock,
+        .mutex_destroy = _mutex_destroy,
+
+        .enter_critical = _enter_critical,
+        .leave_critical = _leave_critical,
+
+        .group_create = _event_group_create,
+        .group_set_bits = _event_group_set_bits,
+        .group_clr_bits = _event_group_clr_bits,
+        .group_wait_bits = _event_group_wait_bits,
+        .group_destroy = _event_group_destroy,
+    };
+    return media_lib_os_register(&os_lib);
+}
@@ -0,0 +1,728 @@
+/**
+ * @file ws_standin.c
+ * @brief In-process stand-in for the Coze / Azure realtime WebSocket endpoints
+ *
+ * Implements the esp_websocket_client API without a network. Each client
+ * runs one shim task that plays the transport: it "connects" after the
+ * configured handshake time and then delivers scripted server events to the
+ * registered handler at their virtual due times, exactly like the real
+ * client task dispatches WEBSOCKET_EVENT_DATA. Client frames are parsed
+ * synchronously in the sender's context and schedule the replies.
+ *
+ * The protocol is chosen from the URI: "/openai/" selects Azure OpenAI
+ * Realtime, anything else Coze Audio Speech.
+ *
+ * TLS is modelled only as handshake time. A client given an external
+ * transport (ext_transport over esp_transport_ssl) gets the abbreviated
+ * handshake time when it offers a ticket saved from an earlier connection,
+ * which is how realtime_link reuses sessions on the device.
+ */
+
+#include "esp_websocket_client.h"
+#include "esp_transport_ssl.h"
+#include "esp_transport_ws.h"
+#include "host_shim.h"
+#include "freertos/task.h"
+#include "cJSON.h"
+#include "mbedtls/base64.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "HOST_WS";
+
+#define STANDIN_SAMPLE_RATE     8000
+#define STANDIN_POLL_MS         5
+#define STANDIN_MIN_COMMIT      (STANDIN_SAMPLE_RATE / 10)  // 100 ms of u-law, as the service requires
+
+// ============================================
+// Private Types and Variables
+// ============================================
+
+typedef struct outbound_msg {
+    int64_t due_us;
+    char *text;                         // NULL: server closes the connection
+    struct outbound_msg *next;
+} outbound_msg_t;
+
+struct host_transport {
+    struct host_transport *parent;      // SSL transport under a WS transport
+    char *path;
+    char *headers;
+    bool tickets;                       // Session ticket operations enabled
+    bool session;                       // Last handshake left a resumable session
+    bool ticket;                        // Session saved for reuse
+    bool offer;                         // Offer the ticket on the next handshake
+};
+
+struct host_ws_client {
+    char *uri;
+    bool azure;
+    struct host_transport *ext;
+
+    esp_event_handler_t handler;
+    void *handler_arg;
+
+    pthread_mutex_t mutex;
+    outbound_msg_t *outbox;             // Sorted by due time
+    int64_t last_due_us;                // Keeps scripted replies in order
+    bool started;
+    bool connected;
+    volatile bool stop;
+    TaskHandle_t task;
+
+    host_ws_standin_config_t config;
+    uint32_t response_seq;
+    size_t buffered;                    // Input audio (u-law bytes) since the last commit
+    uint32_t appends;                   // Appends since the last commit
+    bool user_turn;                     // Committed user audio awaiting response.create
+};
+
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+static host_ws_standin_config_t s_config = HOST_WS_STANDIN_DEFAULT_CONFIG();
+static host_ws_standin_stats_t s_stats;
+static int16_t *s_tone = NULL;
+static size_t s_tone_samples = 0;
+static uint32_t s_mid_drop_at = UINT32_MAX;  // Commit count of the last mid-utterance drop
+
+// ============================================
+// Configuration
+// ============================================
+
+void host_ws_standin_configure(const host_ws_standin_config_t *config)
+{
+    if (config == NULL) {
+        return;
+    }
+    pthread_mutex_lock(&s_lock);
+    s_config = *config;
+    pthread_mutex_unlock(&s_lock);
+}
+
+void host_ws_standin_get_stats(host_ws_standin_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    pthread_mutex_lock(&s_lock);
+    *stats = s_stats;
+    pthread_mutex_unlock(&s_lock);
+}
+
+/**
+ * @brief Default response: one second of a 440 Hz tone
+ */
+static const int16_t *default_response(size_t *samples)
+{
+    pthread_mutex_lock(&s_lock);
+    if (s_tone == NULL) {
+        s_tone_samples = STANDIN_SAMPLE_RATE;
+        s_tone = malloc(s_tone_samples * sizeof(int16_t));
+        for (size_t i = 0; s_tone != NULL && i < s_tone_samples; i++) {
+            s_tone[i] = (int16_t)(8000.0 * sin(2.0 * M_PI * 440.0 * (double)i / STANDIN_SAMPLE_RATE));
+        }
+    }
+    *samples = s_tone ? s_tone_samples : 0;
+    pthread_mutex_unlock(&s_lock);
+    return s_tone;
+}
+
+// ============================================
+// G.711 u-law (what both services send back)
+// ============================================
+
+static uint8_t linear_to_ulaw(int16_t sample)
+{
+    const int16_t bias = 0x84;
+    const int16_t clip = 32635;
+    int sign = (sample >> 8) & 0x80;
+    int s = sample;
+    if (sign) {
+        s = -s;
+    }
+    if (s > clip) {
+        s = clip;
+    }
+    s += bias;
+
+    int exponent = 7;
+    for (int mask = 0x4000; (s & mask) == 0 && exponent > 0; mask >>= 1) {
+        exponent--;
+    }
+    int mantissa = (s >> (exponent + 3)) & 0x0F;
+    return (uint8_t)~(sign | (exponent << 4) | mantissa);
+}
+
+// ============================================
+// Outbound Scheduling
+// ============================================
+
+/**
+ * @brief Queue a server event for delivery after delay_ms (virtual)
+ *
+ * Events scheduled later never overtake earlier ones.
+ */
+static void schedule_text(struct host_ws_client *client, uint32_t delay_ms, char *text)
+{
+    outbound_msg_t *msg = calloc(1, sizeof(*msg));
+    if (msg == NULL) {
+        free(text);
+        return;
+    }
+
+    pthread_mutex_lock(&client->mutex);
+    int64_t due = host_clock_now_us() + (int64_t)delay_ms * 1000;
+    if (due < client->last_due_us) {
+        due = client->last_due_us;
+    }
+    client->last_due_us = due;
+    msg->due_us = due;
+    msg->text = text;
+
+    outbound_msg_t **tail = &client->outbox;
+    while (*tail != NULL) {
+        tail = &(*tail)->next;
+    }
+    *tail = msg;
+    pthread_mutex_unlock(&client->mutex);
+}
+
+static void schedule(struct host_ws_client *client, uint32_t delay_ms, cJSON *root)
+{
+    char *text = cJSON_PrintUnformatted(root);
+    cJSON_Delete(root);
+    if (text != NULL) {
+        schedule_text(client, delay_ms, text);
+    }
+}
+
+static cJSON *event_new(struct host_ws_client *client, const char *type)
+{
+    cJSON *root = cJSON_CreateObject();
+    // Azure uses "type"; Coze's speech API answers with "event_type"
+    cJSON_AddStringToObject(root, client->azure ? "type" : "event_type", type);
+    return root;
+}
+
+/**
+ * @brief Schedule a full spoken response: deltas paced like the service
+ */
+static void schedule_response(struct host_ws_client *client)
+{
+    const int16_t *pcm = client->config.response_pcm;
+    size_t samples = client->config.response_samples;
+    if (pcm == NULL || samples == 0) {
+        pcm = default_response(&samples);
+    }
+
+    uint32_t seq = ++client->response_seq;
+    char id[32];
+    snprintf(id, sizeof(id), "resp_%lu", (unsigned long)seq);
+
+    uint32_t delay = client->config.response_delay_ms;
+    if (client->azure) {
+        cJSON *created = event_new(client, "response.created");
+        cJSON *resp = cJSON_AddObjectToObject(created, "response");
+        cJSON_AddStringToObject(resp, "id", id);
+        schedule(client, delay, created);
+    }
+
+    size_t per_delta = (size_t)client->config.delta_ms * STANDIN_SAMPLE_RATE / 1000;
+    if (per_delta == 0) {
+        per_delta = STANDIN_SAMPLE_RATE / 10;
+    }
+    uint8_t *ulaw = malloc(per_delta);
+    size_t b64_cap = ((per_delta + 2) / 3) * 4 + 1;
+    unsigned char *b64 = malloc(b64_cap);
+
+    uint32_t deltas = 0;
+    for (size_t off = 0; ulaw && b64 && off < samples; off += per_delta) {
+        size_t n = samples - off < per_delta ? samples - off : per_delta;
+        for (size_t i = 0; i < n; i++) {
+            ulaw[i] = linear_to_ulaw(pcm[off + i]);
+        }
+        size_t olen = 0;
+        mbedtls_base64_encode(b64, b64_cap, &olen, ulaw, n);
+
+        cJSON *ev = event_new(client, client->azure ? "response.audio.delta" : "conversation.audio.delta");
+        if (client->azure) {
+            cJSON_AddStringToObject(ev, "response_id", id);
+            cJSON_AddStringToObject(ev, "delta", (const char *)b64);
+        } else {
+            cJSON *data = cJSON_AddObjectToObject(ev, "data");
+            cJSON_AddStringToObject(data, "delta", (const char *)b64);
+        }
+        schedule(client, delay, ev);
+        delay += client->config.delta_interval_ms;
+        deltas++;
+    }
+    free(ulaw);
+    free(b64);
+
+    if (client->azure) {
+        schedule(client, delay, event_new(client, "response.audio.done"));
+        schedule(client, delay, event_new(client, "response.done"));
+    } else {
+        schedule(client, delay, event_new(client, "conversation.chat.completed"));
+    }
+    if (client->config.drop_after_response) {
+        schedule_text(client, delay + 50, NULL);
+    }
+
+    pthread_mutex_lock(&s_lock);
+    s_stats.responses++;
+    s_stats.deltas_out += deltas;
+    pthread_mutex_unlock(&s_lock);
+}
+
+/**
+ * @brief Handle one client frame and script the server's reaction
+ */
+static void server_receive(struct host_ws_client *client, const char *data, int len)
+{
+    cJSON *root = cJSON_ParseWithLength(data, (size_t)len);
+    if (root == NULL) {
+        ESP_LOGW(TAG, "Client sent invalid JSON (%d bytes)", len);
+        return;
+    }
+
+    cJSON *type = cJSON_GetObjectItem(root, "type");
+    if (!cJSON_IsString(type)) {
+        type = cJSON_GetObjectItem(root, "event_type");
+    }
+    const char *t = cJSON_IsString(type) ? type->valuestring : "";
+
+    pthread_mutex_lock(&s_lock);
+    s_stats.frames_in++;
+    pthread_mutex_unlock(&s_lock);
+
+    if (strcmp(t, "session.update") == 0) {
+        if (!client->azure) {
+            cJSON *created = event_new(client, "speech.created");
+            cJSON *payload = cJSON_AddObjectToObject(created, "data");
+            cJSON_AddStringToObject(payload, "id", "standin_speech");
+            schedule(client, 20, created);
+        }
+        schedule(client, 20, event_new(client, "session.updated"));
+
+    } else if (strcmp(t, "input_audio_buffer.append") == 0) {
+        cJSON *audio = cJSON_GetObjectItem(root, "audio");
+        if (!cJSON_IsString(audio)) {
+            cJSON *payload = cJSON_GetObjectItem(root, "data");
+            audio = payload ? cJSON_GetObjectItem(payload, "delta") : NULL;
+        }
+        bool drop = false;
+        if (cJSON_IsString(audio)) {
+            size_t b64 = strlen(audio->valuestring);
+            client->buffered += b64 / 4 * 3;
+            client->appends++;
+
+            // Lose the connection part-way through the utterance, once per utterance
+            pthread_mutex_lock(&s_lock);
+            s_stats.audio_bytes_in += b64;
+            if (client->config.drop_mid_utterance > 0 &&
+                client->appends >= client->config.drop_mid_utterance &&
+                s_mid_drop_at != s_stats.commits) {
+                s_mid_drop_at = s_stats.commits;
+                drop = true;
+            }
+            pthread_mutex_unlock(&s_lock);
+        }
+        if (drop) {
+            ESP_LOGI(TAG, "🔌 Stand-in dropping the connection mid-utterance (%lu appends, %u bytes buffered)",
+                     (unsigned long)client->appends, (unsigned)client->buffered);
+            schedule_text(client, 0, NULL);
+        }
+
+    } else if (strcmp(t, "input_audio_buffer.commit") == 0 ||
+               strcmp(t, "input_audio_buffer.complete") == 0) {
+        bool empty = client->buffered < STANDIN_MIN_COMMIT;
+        client->buffered = 0;
+        client->appends = 0;
+        pthread_mutex_lock(&s_lock);
+        s_stats.commits++;
+        s_stats.empty_commits += empty ? 1 : 0;
+        pthread_mutex_unlock(&s_lock);
+
+        if (empty) {
+            // What a reconnect without the audio gets: the new session's buffer is empty
+            ESP_LOGW(TAG, "⚠️ Stand-in rejecting commit: input audio buffer below 100 ms");
+            cJSON *err = event_new(client, "error");
+            if (client->azure) {
+                cJSON *detail = cJSON_AddObjectToObject(err, "error");
+                cJSON_AddStringToObject(detail, "code", "input_audio_buffer_commit_empty");
+                cJSON_AddStringToObject(detail, "message", "buffer too small, expected at least 100ms of audio");
+            } else {
+                cJSON *detail = cJSON_AddObjectToObject(err, "data");
+                cJSON_AddNumberToObject(detail, "code", 4000);
+                cJSON_AddStringToObject(detail, "message", "input audio buffer is empty");
+            }
+            schedule(client, 10, err);
+        } else if (client->azure) {
+            client->user_turn = true;
+            schedule(client, 10, event_new(client, "input_audio_buffer.committed"));
+        } else {
+            // Coze starts answering as soon as the buffer is complete
+            schedule_response(client);
+        }
+
+    } else if (strcmp(t, "response.create") == 0) {
+        // Only a committed user turn is answered (none after a rejected commit)
+        if (client->azure && client->user_turn) {
+            client->user_turn = false;
+            schedule_response(client);
+        }
+
+    } else if (strcmp(t, "response.cancel") == 0) {
+        pthread_mutex_lock(&client->mutex);
+        while (client->outbox != NULL) {
+            outbound_msg_t *msg = client->outbox;
+            client->outbox = msg->next;
+            free(msg->text);
+            free(msg);
+        }
+        pthread_mutex_unlock(&client->mutex);
+        schedule(client, 10, event_new(client, client->azure ? "response.done" : "conversation.chat.canceled"));
+    }
+
+    cJSON_Delete(root);
+}
+
+// ============================================
+// Client Task
+// ============================================
+
+static void dispatch(struct host_ws_client *client, esp_websocket_event_id_t id,
+                     const char *data, int len)
+{
+    if (client->handler == NULL) {
+        return;
+    }
+    esp_websocket_event_data_t event = {
+        .data_ptr = data,
+        .data_len = len,
+        .fin = true,
+        .op_code = data ? 0x01 : 0x00,
+        .client = client,
+        .payload_len = len,
+        .payload_offset = 0,
+    };
+    client->handler(client->handler_arg, "WEBSOCKET_EVENTS", id, &event);
+}
+
+static void ws_client_task(void *arg)
+{
+    struct host_ws_client *client = arg;
+
+    // Handshake: DNS + TCP + TLS + HTTP upgrade, abbreviated with a ticket
+    struct host_transport *ssl = client->ext ? client->ext->parent : NULL;
+    bool resumed = ssl && ssl->offer && ssl->ticket && client->config.session_tickets;
+    vTaskDelay(pdMS_TO_TICKS(resumed ? client->config.resume_ms : client->config.connect_ms));
+    if (ssl) {
+        ssl->offer = false;
+        ssl->session = ssl->tickets && client->config.session_tickets;
+    }
+    if (!client->stop) {
+        pthread_mutex_lock(&client->mutex);
+        client->connected = true;
+        pthread_mutex_unlock(&client->mutex);
+
+        pthread_mutex_lock(&s_lock);
+        s_stats.connects++;
+        s_stats.resumed += resumed ? 1 : 0;
+        pthread_mutex_unlock(&s_lock);
+
+        ESP_LOGI(TAG, "🔌 Stand-in connected (%s%s)", client->azure ? "azure" : "coze",
+                 resumed ? ", session resumed" : "");
+        if (client->azure) {
+            cJSON *created = event_new(client, "session.created");
+            cJSON *session = cJSON_AddObjectToObject(created, "session");
+            cJSON_AddStringToObject(session, "id", "standin_session");
+            schedule(client, 20, created);
+        }
+        dispatch(client, WEBSOCKET_EVENT_CONNECTED, NULL, 0);
+    }
+
+    bool closed = false;
+    while (!client->stop && !closed) {
+        pthread_mutex_lock(&client->mutex);
+        outbound_msg_t *msg = client->outbox;
+        if (msg != NULL && msg->due_us <= host_clock_now_us()) {
+            client->outbox = msg->next;
+        } else {
+            msg = NULL;
+        }
+        pthread_mutex_unlock(&client->mutex);
+
+        if (msg == NULL) {
+            vTaskDelay(pdMS_TO_TICKS(STANDIN_POLL_MS));
+            continue;
+        }
+
+        if (msg->text == NULL) {
+            closed = true;
+            pthread_mutex_lock(&s_lock);
+            s_stats.drops++;
+            pthread_mutex_unlock(&s_lock);
+            ESP_LOGI(TAG, "🔌 Stand-in closing the connection (%s)", client->azure ? "azure" : "coze");
+        } else {
+            dispatch(client, WEBSOCKET_EVENT_DATA, msg->text, (int)strlen(msg->text));
+        }
+        free(msg->text);
+        free(msg);
+    }
+
+    pthread_mutex_lock(&client->mutex);
+    bool was_connected = client->connected;
+    client->connected = false;
+    pthread_mutex_unlock(&client->mutex);
+
+    if (was_connected) {
+        dispatch(client, WEBSOCKET_EVENT_DISCONNECTED, NULL, 0);
+    }
+
+    // A server close ends the run like auto-reconnect disabled on the device
+    pthread_mutex_lock(&client->mutex);
+    client->task = NULL;
+    if (closed) {
+        client->started = false;
+    }
+    pthread_mutex_unlock(&client->mutex);
+    vTaskDelete(NULL);
+}
+
+// ============================================
+// esp_websocket_client API
+// ============================================
+
+esp_websocket_client_handle_t esp_websocket_client_init(const esp_websocket_client_config_t *config)
+{
+    if (config == NULL || config->uri == NULL) {
+        return NULL;
+    }
+
+    struct host_ws_client *client = calloc(1, sizeof(*client));
+    if (client == NULL) {
+        return NULL;
+    }
+    client->uri = strdup(config->uri);
+    client->azure = strstr(config->uri, "/openai/") != NULL;
+    client->ext = config->ext_transport;
+    pthread_mutex_init(&client->mutex, NULL);
+    return client;
+}
+
+esp_err_t esp_websocket_register_events(esp_websocket_client_handle_t client, esp_websocket_event_id_t event,
+                                        esp_event_handler_t event_handler, void *event_handler_arg)
+{
+    (void)event;
+    if (client == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    client->handler = event_handler;
+    client->handler_arg = event_handler_arg;
+    return ESP_OK;
+}
+
+esp_err_t esp_websocket_client_append_header(esp_websocket_client_handle_t client, const char *key, const char *value)
+{
+    (void)key;
+    (void)value;
+    return client ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_websocket_client_start(esp_websocket_client_handle_t client)
+{
+    if (client == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (client->started) {
+        return ESP_FAIL;
+    }
+
+    pthread_mutex_lock(&s_lock);
+    client->config = s_config;
+    pthread_mutex_unlock(&s_lock);
+
+    // A new connection starts with an empty input audio buffer
+    client->buffered = 0;
+    client->appends = 0;
+    client->user_turn = false;
+    client->stop = false;
+    client->started = true;
+    if (xTaskCreate(ws_client_task, "websocket_task", 4096, client, 5, &client->task) != pdPASS) {
+        client->started = false;
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_websocket_client_stop(esp_websocket_client_handle_t client)
+{
+    if (client == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!client->started) {
+        return ESP_FAIL;
+    }
+
+    client->stop = true;
+    // The task may be dispatching into the caller's handler; wait it out
+    for (int i = 0; i < 200; i++) {
+        pthread_mutex_lock(&client->mutex);
+        bool running = client->task != NULL;
+        pthread_mutex_unlock(&client->mutex);
+        if (!running) {
+            break;
+        }
+        vTaskDelay(pdMS_TO_TICKS(STANDIN_POLL_MS));
+    }
+    client->started = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_websocket_client_close(esp_websocket_client_handle_t client, TickType_t timeout)
+{
+    (void)timeout;
+    return esp_websocket_client_stop(client);
+}
+
+esp_err_t esp_websocket_client_destroy(esp_websocket_client_handle_t client)
+{
+    if (client == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (client->started) {
+        esp_websocket_client_stop(client);
+    }
+
+    while (client->outbox != NULL) {
+        outbound_msg_t *msg = client->outbox;
+        client->outbox = msg->next;
+        free(msg->text);
+        free(msg);
+    }
+    pthread_mutex_destroy(&client->mutex);
+    free(client->uri);
+    free(client);
+    return ESP_OK;
+}
+
+bool esp_websocket_client_is_connected(esp_websocket_client_handle_t client)
+{
+    if (client == NULL) {
+        return false;
+    }
+    pthread_mutex_lock(&client->mutex);
+    bool connected = client->connected;
+    pthread_mutex_unlock(&client->mutex);
+    return connected;
+}
+
+static int client_send(esp_websocket_client_handle_t client, const char *data, int len)
+{
+    if (!esp_websocket_client_is_connected(client) || data == NULL || len <= 0) {
+        return -1;
+    }
+    server_receive(client, data, len);
+    return len;
+}
+
+int esp_websocket_client_send_text(esp_websocket_client_handle_t client, const char *data, int len, TickType_t timeout)
+{
+    (void)timeout;
+    return client_send(client, data, len);
+}
+
+int esp_websocket_client_send_bin(esp_websocket_client_handle_t client, const char *data, int len, TickType_t timeout)
+{
+    (void)timeout;
+    return client_send(client, data, len);
+}
+
+// ============================================
+// esp_transport (TLS session model)
+// ============================================
+
+esp_transport_handle_t esp_transport_ssl_init(void)
+{
+    return calloc(1, sizeof(struct host_transport));
+}
+
+esp_transport_handle_t esp_transport_ws_init(esp_transport_handle_t parent_handle)
+{
+    if (parent_handle == NULL) {
+        return NULL;
+    }
+    struct host_transport *t = calloc(1, sizeof(*t));
+    if (t != NULL) {
+        t->parent = parent_handle;
+    }
+    return t;
+}
+
+esp_err_t esp_transport_destroy(esp_transport_handle_t t)
+{
+    if (t == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    free(t->path);
+    free(t->headers);
+    free(t);
+    return ESP_OK;
+}
+
+void esp_transport_ssl_crt_bundle_attach(esp_transport_handle_t t, esp_err_t ((*crt_bundle_attach)(void *conf)))
+{
+    (void)t;
+    (void)crt_bundle_attach;
+}
+
+void esp_transport_ssl_skip_common_name_check(esp_transport_handle_t t)
+{
+    (void)t;
+}
+
+void esp_transport_ssl_session_ticket_operation(esp_transport_handle_t t,
+                                                esp_transport_session_ticket_operation_t operation)
+{
+    if (t == NULL) {
+        return;
+    }
+    switch (operation) {
+    case ESP_TRANSPORT_SESSION_TICKET_INIT:
+        t->tickets = true;
+        break;
+    case ESP_TRANSPORT_SESSION_TICKET_SAVE:
+        t->ticket = t->session;
+        break;
+    case ESP_TRANSPORT_SESSION_TICKET_USE:
+        t->offer = t->ticket;
+        break;
+    case ESP_TRANSPORT_SESSION_TICKET_FREE:
+        t->ticket = false;
+        t->offer = false;
+        break;
+    }
+}
+
+void esp_transport_ws_set_path(esp_transport_handle_t t, const char *path)
+{
+    if (t != NULL && path != NULL) {
+        free(t->path);
+        t->path = strdup(path);
+    }
+}
+
+esp_err_t esp_transport_ws_set_headers(esp_transport_handle_t t, const char *headers)
+{
+    if (t == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    free(t->headers);
+    t->headers = headers ? strdup(headers) : NULL;
+    return ESP_OK;
+}
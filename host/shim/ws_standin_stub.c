@@ -0,0 +1,20 @@
+/**
+ * @file ws_standin_stub.c
+ * @brief Stand-in statistics when the harness is built without cJSON
+ */
+
+#include "host_shim.h"
+
+#include <string.h>
+
+void host_ws_standin_configure(const host_ws_standin_config_t *config)
+{
+    (void)config;
+}
+
+void host_ws_standin_get_stats(host_ws_standin_stats_t *stats)
+{
+    if (stats != NULL) {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
@@ -0,0 +1,300 @@
+/**
+ * @file signaling_main.c
+ * @brief Host timing of the WebRTC session setup requests
+ *
+ * Replays what openai_signaling does when a conversation starts: take an
+ * ephemeral token from openai_token (prefetched in the background, or
+ * fetched on the spot), then POST the SDP offer with it and wait for the
+ * answer. Requests go through the unmodified esp_webrtc https_client and
+ * openai_token against the in-process HTTPS stand-in, so the effect of the
+ * keep-alive pool and of token prefetch on button-to-answer latency can be
+ * measured without a board.
+ *
+ *   signaling [--sessions 5] [--gap-ms 10000] [--no-pool] [--no-prefetch]
+ *             [--idle-close-ms 60000] [--token-ttl-s 60] [--speed 1]
+ *             [--report report.json]
+ *
+ * Each session starts gap-ms after the previous one finished (the first
+ * gap-ms after boot), which is when the user presses the button. Endpoints
+ * follow webrtc_azure_settings.h: with USE_AZURE_OPENAI the token comes from
+ * the resource endpoint and the SDP goes to a regional host.
+ */
+
+#include "https_client.h"
+#include "openai_token.h"
+#include "webrtc_azure_settings.h"
+#include "host_shim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <unistd.h>
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "SIGNALING";
+
+#define MAX_SESSIONS            64
+
+#ifdef USE_AZURE_OPENAI
+#define SDP_URL     "https://" AZURE_OPENAI_REGION ".realtimeapi-preview.ai.azure.com/v1/realtimertc"
+#else
+#define SDP_URL     "https://api.openai.com/v1/realtime?model=gpt-4o-mini-realtime-preview-2024-12-17"
+#endif
+
+// ============================================
+// Private Types and Variables
+// ============================================
+
+typedef struct {
+    int sessions;
+    uint32_t gap_ms;
+    bool no_pool;
+    bool no_prefetch;
+    uint32_t idle_close_ms;
+    uint32_t token_ttl_s;
+    double speed;
+    const char *report_path;
+    bool verbose;
+} signaling_options_t;
+
+typedef struct {
+    uint32_t token_ms;
+    uint32_t sdp_ms;
+    bool ok;
+} session_result_t;
+
+static signaling_options_t s_opts = {
+    .sessions = 5,
+    .gap_ms = 10000,
+    .idle_close_ms = 60000,
+    .token_ttl_s = 60,
+    .speed = 1.0,
+};
+
+static session_result_t s_results[MAX_SESSIONS];
+
+// Minimal offer; the stand-in does not inspect it
+static char s_offer[] = "v=0\r\no=- 0 0 IN IP4 127.0.0.1\r\ns=-\r\nt=0 0\r\n"
+                        "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\na=rtpmap:111 opus/48000/2\r\n";
+
+// ============================================
+// Session Setup
+// ============================================
+
+// Streamed like openai_signaling; the answer starts with "v=0"
+static void sdp_chunk(const char *data, int size, void *ctx)
+{
+    int *received = ctx;
+    if (*received == 0 && size > 0 && data[0] != 'v') {
+        *received = -1;
+    } else if (*received >= 0) {
+        *received += size;
+    }
+}
+
+static void run_session(session_result_t *result)
+{
+    int64_t start = host_clock_now_us();
+    char *token = openai_token_take();
+    result->token_ms = (uint32_t)((host_clock_now_us() - start) / 1000);
+    if (token == NULL) {
+        ESP_LOGE(TAG, "❌ No token");
+        return;
+    }
+
+    char content_type[] = "Content-Type: application/sdp";
+    char auth[128];
+    snprintf(auth, sizeof(auth), "Authorization: Bearer %s", token);
+    char *header[] = { content_type, auth, NULL };
+    int received = 0;
+    start = host_clock_now_us();
+    int ret = https_request(&(https_request_t) {
+        .method = "POST",
+        .url = SDP_URL,
+        .headers = header,
+        .data = s_offer,
+        .chunk_cb = sdp_chunk,
+        .ctx = &received,
+    });
+    result->sdp_ms = (uint32_t)((host_clock_now_us() - start) / 1000);
+    result->ok = ret == 0 && received > 0;
+    // As the WebRTC connected event does; the handshake after the answer is not modelled
+    if (result->ok) {
+        openai_token_session_up();
+    }
+    free(token);
+}
+
+// ============================================
+// Report
+// ============================================
+
+static void write_report(FILE *out, bool json)
+{
+    https_client_stats_t http = {0};
+    https_client_get_stats(&http);
+    host_http_standin_stats_t standin = {0};
+    host_http_standin_get_stats(&standin);
+    openai_token_stats_t token = {0};
+    openai_token_get_stats(&token);
+
+    uint64_t total_sum = 0;
+    uint32_t total_max = 0;
+    int ok = 0;
+    for (int i = 0; i < s_opts.sessions; i++) {
+        uint32_t total = s_results[i].token_ms + s_results[i].sdp_ms;
+        total_sum += total;
+        total_max = total > total_max ? total : total_max;
+        ok += s_results[i].ok;
+    }
+    uint32_t total_avg = s_opts.sessions ? (uint32_t)(total_sum / s_opts.sessions) : 0;
+
+    if (!json) {
+        fprintf(out, "\n===== Signaling Report =====\n");
+        fprintf(out, "pool %s, prefetch %s, %d sessions %lu ms apart, %d ok\n",
+                s_opts.no_pool ? "off" : "on", s_opts.no_prefetch ? "off" : "on", s_opts.sessions,
+                (unsigned long)s_opts.gap_ms, ok);
+        for (int i = 0; i < s_opts.sessions; i++) {
+            fprintf(out, "  #%-2d token %5lu ms  sdp %5lu ms  total %5lu ms%s\n", i,
+                    (unsigned long)s_results[i].token_ms, (unsigned long)s_results[i].sdp_ms,
+                    (unsigned long)(s_results[i].token_ms + s_results[i].sdp_ms),
+                    s_results[i].ok ? "" : "  FAILED");
+        }
+        fprintf(out, "button-to-answer avg %lu ms, max %lu ms\n", (unsigned long)total_avg,
+                (unsigned long)total_max);
+        fprintf(out, "tokens: fetched %lu (avg %lu ms, %lu failed), takes %lu prefetched / %lu in flight / "
+                "%lu fetched, %lu expired unused\n",
+                (unsigned long)token.fetches, (unsigned long)token.fetch_avg_ms, (unsigned long)token.failures,
+                (unsigned long)token.hits, (unsigned long)token.waits, (unsigned long)token.misses,
+                (unsigned long)token.expired);
+        fprintf(out, "https_client: requests %lu (%lu failed), new connections %lu (avg %lu ms), "
+                "reused %lu (avg %lu ms)\n",
+                (unsigned long)http.requests, (unsigned long)http.failures, (unsigned long)http.connects,
+                (unsigned long)http.avg_new_ms, (unsigned long)http.reused, (unsigned long)http.avg_reused_ms);
+        fprintf(out, "stand-in: requests %lu, handshakes %lu, idle closes %lu\n",
+                (unsigned long)standin.requests, (unsigned long)standin.connects,
+                (unsigned long)standin.idle_closes);
+        return;
+    }
+
+    fprintf(out, "{\n  \"pool\": %s,\n  \"prefetch\": %s,\n  \"gap_ms\": %lu,\n",
+            s_opts.no_pool ? "false" : "true", s_opts.no_prefetch ? "false" : "true", (unsigned long)s_opts.gap_ms);
+    fprintf(out, "  \"sessions\": [");
+    for (int i = 0; i < s_opts.sessions; i++) {
+        fprintf(out, "%s\n    {\"token_ms\":%lu,\"sdp_ms\":%lu,\"ok\":%s}", i ? "," : "",
+                (unsigned long)s_results[i].token_ms, (unsigned long)s_results[i].sdp_ms,
+                s_results[i].ok ? "true" : "false");
+    }
+    fprintf(out, "\n  ],\n  \"setup_avg_ms\": %lu,\n  \"setup_max_ms\": %lu,\n",
+            (unsigned long)total_avg, (unsigned long)total_max);
+    fprintf(out, "  \"https_client\": {\"requests\":%lu,\"failures\":%lu,\"connects\":%lu,\"reused\":%lu,"
+            "\"avg_new_ms\":%lu,\"avg_reused_ms\":%lu,\"max_ms\":%lu},\n",
+            (unsigned long)http.requests, (unsigned long)http.failures, (unsigned long)http.connects,
+            (unsigned long)http.reused, (unsigned long)http.avg_new_ms, (unsigned long)http.avg_reused_ms,
+            (unsigned long)http.max_ms);
+    fprintf(out, "  \"tokens\": {\"fetches\":%lu,\"failures\":%lu,\"fetch_avg_ms\":%lu,\"hits\":%lu,"
+            "\"waits\":%lu,\"misses\":%lu,\"expired\":%lu},\n",
+            (unsigned long)token.fetches, (unsigned long)token.failures, (unsigned long)token.fetch_avg_ms,
+            (unsigned long)token.hits, (unsigned long)token.waits, (unsigned long)token.misses,
+            (unsigned long)token.expired);
+    fprintf(out, "  \"standin\": {\"requests\":%lu,\"connects\":%lu,\"idle_closes\":%lu}\n}\n",
+            (unsigned long)standin.requests, (unsigned long)standin.connects, (unsigned long)standin.idle_closes);
+}
+
+// ============================================
+// Main
+// ============================================
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --sessions N          session setups to run (default 5, max %d)\n"
+            "  --gap-ms N            virtual idle time before each setup (default 10000)\n"
+            "  --no-pool             one connection per request (no keep-alive pool)\n"
+            "  --no-prefetch         fetch the token when the session starts\n"
+            "  --idle-close-ms N     stand-in closes idle connections after N ms (default 60000)\n"
+            "  --token-ttl-s N       lifetime of stand-in tokens (default 60)\n"
+            "  --speed N             virtual clock speed (default 1.0)\n"
+            "  --report PATH         write the report as JSON\n"
+            "  --verbose             debug logging\n", prog, MAX_SESSIONS);
+}
+
+static bool parse_args(int argc, char **argv)
+{
+    static const struct option long_opts[] = {
+        { "sessions",      required_argument, NULL, 'n' },
+        { "gap-ms",        required_argument, NULL, 'g' },
+        { "no-pool",       no_argument,       NULL, 'P' },
+        { "no-prefetch",   no_argument,       NULL, 'F' },
+        { "idle-close-ms", required_argument, NULL, 'c' },
+        { "token-ttl-s",   required_argument, NULL, 't' },
+        { "speed",         required_argument, NULL, 's' },
+        { "report",        required_argument, NULL, 'j' },
+        { "verbose",       no_argument,       NULL, 'v' },
+        { "help",          no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+
+    int c;
+    while ((c = getopt_long(argc, argv, "n:g:PFc:t:s:j:vh", long_opts, NULL)) != -1) {
+        switch (c) {
+        case 'n': s_opts.sessions = atoi(optarg); break;
+        case 'g': s_opts.gap_ms = (uint32_t)atol(optarg); break;
+        case 'P': s_opts.no_pool = true; break;
+        case 'F': s_opts.no_prefetch = true; break;
+        case 'c': s_opts.idle_close_ms = (uint32_t)atol(optarg); break;
+        case 't': s_opts.token_ttl_s = (uint32_t)atol(optarg); break;
+        case 's': s_opts.speed = atof(optarg); break;
+        case 'j': s_opts.report_path = optarg; break;
+        case 'v': s_opts.verbose = true; break;
+        default:
+            return false;
+        }
+    }
+    return s_opts.sessions > 0 && s_opts.sessions <= MAX_SESSIONS && s_opts.speed > 0.0;
+}
+
+int main(int argc, char **argv)
+{
+    if (!parse_args(argc, argv)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    host_log_set_level(s_opts.verbose ? ESP_LOG_DEBUG : ESP_LOG_INFO);
+    host_task_register_current("main");
+    host_clock_set_speed(s_opts.speed);
+
+    host_http_standin_config_t cfg = HOST_HTTP_STANDIN_DEFAULT_CONFIG();
+    cfg.idle_close_ms = s_opts.idle_close_ms;
+    cfg.token_ttl_s = s_opts.token_ttl_s;
+    host_http_standin_configure(&cfg);
+    https_client_set_keep_alive(!s_opts.no_pool);
+    // As webrtc_azure_init() does at boot
+    if (!s_opts.no_prefetch) {
+        ESP_ERROR_CHECK(openai_token_start());
+    }
+
+    int failed = 0;
+    for (int i = 0; i < s_opts.sessions; i++) {
+        vTaskDelay(pdMS_TO_TICKS(s_opts.gap_ms));
+        run_session(&s_results[i]);
+        failed += !s_results[i].ok;
+    }
+
+    write_report(stdout, false);
+    if (s_opts.report_path) {
+        FILE *f = fopen(s_opts.report_path, "w");
+        if (f != NULL) {
+            write_report(f, true);
+            fclose(f);
+        }
+    }
+    // The token task never exits; leave it to process teardown
+    fflush(stdout);
+    _exit(failed ? 3 : 0);
+}
@@ -0,0 +1,346 @@
+/**
+ * @file boot_check.c
+ * @brief boot_graph: app_main's boot as stub phases, sequential vs parallel
+ *
+ * The phase table is system_init()'s own, from main/boot_phases.h: same
+ * phases, same dependencies, same milestones. Each stub stands for its phase's cost on the device as
+ * CPU time plus waiting (I2C and panel resets, Wi-Fi association, SNTP).
+ * CPU time holds one of two "cores" (a counting semaphore), so no more than
+ * two phases compute at once however many workers there are; waiting holds
+ * nothing. The figures are rough ESP32-S3 estimates; Wi-Fi and SNTP are
+ * options since they depend on the network.
+ *
+ * The legacy run is the old system_init(): every phase after the previous
+ * one on a single worker, and the LVGL task only started with the other
+ * tasks at the end. Then the graph runs on the configured workers, a run
+ * where the display fails checks that dependents are skipped, and a graph
+ * with a cycle must be rejected.
+ *
+ *   boot_check [--workers 3] [--wifi-ms 2500] [--sntp-ms 700] [--speed 10]
+ *
+ * Exits non-zero when a phase starts before one of its dependencies is
+ * done, the I2C phases overlap, a milestone is later than in the legacy
+ * run, or the failure and cycle cases are not handled as described.
+ */
+
+#include "boot_graph.h"
+#include "boot_phases.h"
+#include "host_shim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+// Phases that set up devices on I2C bus 0, kept one after the other
+#define I2C_PHASES      (BOOT_DEP(BOOT_PMU) | BOOT_DEP(BOOT_RTC) | BOOT_DEP(BOOT_CODEC))
+
+// ============================================
+// Stub Phases
+// ============================================
+
+typedef struct {
+    uint32_t cpu_ms;
+    uint32_t wait_ms;
+    bool fail;
+} stub_cost_t;
+
+static stub_cost_t s_cost[BOOT_PHASE_MAX] = {
+    [BOOT_NVS]      = { 25, 0 },
+    [BOOT_LEDGER]   = { 5, 0 },
+    [BOOT_EVENTS]   = { 5, 0 },
+    [BOOT_PMU]      = { 5, 35 },        // XPowersLib register setup over I2C
+    [BOOT_RTC]      = { 2, 8 },
+    [BOOT_SYSINFO]  = { 5, 15 },        // First PMU and RTC reads
+    [BOOT_DISPLAY]  = { 120, 200 },     // Panel reset and init sequence, LVGL setup
+    [BOOT_CODEC]    = { 40, 140 },      // ES8311 / ES7210 reset and I2S TDM setup
+    [BOOT_UI]       = { 180, 0 },       // LVGL object trees for every page
+    [BOOT_WIFI]     = { 150, 50 },      // Driver init and RF calibration
+    [BOOT_TIME]     = { 0, 0 },         // --wifi-ms + --sntp-ms
+    [BOOT_PIPELINE] = { 250, 0 },       // AFE / AEC setup
+    [BOOT_WEBRTC]   = { 200, 300 },     // Media system, first peer connection start
+    [BOOT_CORE]     = { 10, 0 },
+    [BOOT_BUTTON]   = { 2, 0 },
+    [BOOT_CONSOLE]  = { 15, 0 },
+    [BOOT_TASKS]    = { 10, 0 },
+};
+
+static SemaphoreHandle_t s_cores;
+
+static esp_err_t stub_phase(void *arg)
+{
+    const stub_cost_t *cost = (const stub_cost_t *)arg;
+    if (cost->cpu_ms) {
+        xSemaphoreTake(s_cores, portMAX_DELAY);
+        vTaskDelay(pdMS_TO_TICKS(cost->cpu_ms));
+        xSemaphoreGive(s_cores);
+    }
+    if (cost->wait_ms) {
+        vTaskDelay(pdMS_TO_TICKS(cost->wait_ms));
+    }
+    return cost->fail ? ESP_FAIL : ESP_OK;
+}
+
+// app_main's functions are replaced by the stub, each with its phase's cost
+#define PHASE_STUB(id, name, fn, deps)  [id] = { name, stub_phase, &s_cost[id], deps },
+
+static const boot_phase_t s_graph[BOOT_PHASE_MAX] = {
+    BOOT_PHASES(PHASE_STUB)
+};
+
+static const boot_milestone_t s_milestones[] = {
+    BOOT_MILESTONES(BOOT_MILESTONE_ENTRY)
+};
+
+// Old system_init(): each phase after the one before, LVGL started with the tasks
+static const boot_milestone_t s_legacy_milestones[] = {
+    { "interactive UI",       BOOT_DEP(BOOT_TASKS) },
+    { "conversation ready",   BOOT_DEP(BOOT_TASKS) },
+};
+
+#define MILESTONE_COUNT     (sizeof(s_milestones) / sizeof(s_milestones[0]))
+
+// ============================================
+// Checks
+// ============================================
+
+static bool intervals_overlap(const boot_phase_record_t *a, const boot_phase_record_t *b)
+{
+    return a->start_us < b->end_us && b->start_us < a->end_us;
+}
+
+/**
+ * @brief Every phase that ran started after its dependencies ended
+ */
+static const char *check_order(const boot_graph_config_t *cfg, const boot_graph_result_t *res)
+{
+    for (size_t i = 0; i < cfg->phase_count; i++) {
+        const boot_phase_record_t *rec = &res->phases[i];
+        if (rec->state == BOOT_PHASE_PENDING || rec->state == BOOT_PHASE_RUNNING) {
+            return "phase left unfinished";
+        }
+        if (rec->state == BOOT_PHASE_SKIPPED) {
+            continue;
+        }
+        for (size_t d = 0; d < cfg->phase_count; d++) {
+            if (!(cfg->phases[i].deps & BOOT_DEP(d))) {
+                continue;
+            }
+            const boot_phase_record_t *dep = &res->phases[d];
+            if (dep->state != BOOT_PHASE_DONE || dep->end_us > rec->start_us) {
+                printf("  %s started before %s was done\n", cfg->phases[i].name, cfg->phases[d].name);
+                return "dependency order violated";
+            }
+        }
+    }
+    for (size_t i = 0; i < cfg->phase_count; i++) {
+        for (size_t j = i + 1; j < cfg->phase_count; j++) {
+            if ((I2C_PHASES & BOOT_DEP(i)) && (I2C_PHASES & BOOT_DEP(j)) &&
+                res->phases[i].state == BOOT_PHASE_DONE && res->phases[j].state == BOOT_PHASE_DONE &&
+                intervals_overlap(&res->phases[i], &res->phases[j])) {
+                printf("  %s and %s overlap on I2C\n", cfg->phases[i].name, cfg->phases[j].name);
+                return "I2C phases overlap";
+            }
+        }
+    }
+    return NULL;
+}
+
+static const char *run_failure(uint8_t workers)
+{
+    boot_graph_config_t cfg = {
+        .phases = s_graph,
+        .phase_count = BOOT_PHASE_MAX,
+        .milestones = s_milestones,
+        .milestone_count = MILESTONE_COUNT,
+        .workers = workers,
+    };
+    static boot_graph_result_t res;
+
+    s_cost[BOOT_DISPLAY].fail = true;
+    esp_err_t err = boot_graph_run(&cfg, &res);
+    s_cost[BOOT_DISPLAY].fail = false;
+
+    if (err != ESP_FAIL || res.phases[BOOT_DISPLAY].state != BOOT_PHASE_FAILED) {
+        return "display failure not reported";
+    }
+    // Everything downstream of the display, and the rest of the boot with it
+    static const boot_phase_id_t downstream[] = { BOOT_UI, BOOT_CORE, BOOT_BUTTON, BOOT_CONSOLE, BOOT_TASKS };
+    for (size_t i = 0; i < sizeof(downstream) / sizeof(downstream[0]); i++) {
+        if (res.phases[downstream[i]].state != BOOT_PHASE_SKIPPED) {
+            return "phase after a failed dependency was not skipped";
+        }
+    }
+    if (boot_graph_milestone_ms(&res, 0) >= 0 || boot_graph_milestone_ms(&res, 1) >= 0) {
+        return "milestone reached despite the failure";
+    }
+    const char *why = check_order(&cfg, &res);
+    if (why) {
+        return why;
+    }
+    int skipped = 0;
+    for (size_t i = 0; i < BOOT_PHASE_MAX; i++) {
+        skipped += res.phases[i].state == BOOT_PHASE_SKIPPED;
+    }
+    printf("display failure: %s, %d phases skipped, %lu ms\n", esp_err_to_name(err), skipped,
+           (unsigned long)((res.end_us - res.start_us) / 1000));
+    return NULL;
+}
+
+static const char *run_cycle(void)
+{
+    static const boot_phase_t cycle[] = {
+        { "a", stub_phase, &s_cost[BOOT_CORE], BOOT_DEP(2) },
+        { "b", stub_phase, &s_cost[BOOT_CORE], BOOT_DEP(0) },
+        { "c", stub_phase, &s_cost[BOOT_CORE], BOOT_DEP(1) },
+    };
+    static const boot_phase_t missing[] = {
+        { "a", stub_phase, &s_cost[BOOT_CORE], 0 },
+        { "b", stub_phase, &s_cost[BOOT_CORE], BOOT_DEP(5) },
+    };
+    boot_graph_config_t cfg = { .phases = cycle, .phase_count = 3 };
+    boot_graph_result_t res;
+
+    host_log_set_level(ESP_LOG_NONE);
+    esp_err_t cycle_err = boot_graph_run(&cfg, &res);
+    cfg.phases = missing;
+    cfg.phase_count = 2;
+    esp_err_t missing_err = boot_graph_run(&cfg, &res);
+    host_log_set_level(ESP_LOG_WARN);
+
+    if (cycle_err != ESP_ERR_INVALID_ARG) {
+        return "cycle not rejected";
+    }
+    if (missing_err != ESP_ERR_INVALID_ARG) {
+        return "dependency on a missing phase not rejected";
+    }
+    printf("cycle and missing dependency rejected\n");
+    return NULL;
+}
+
+// ============================================
+// Main
+// ============================================
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "usage: %s [--workers 3] [--wifi-ms 2500] [--sntp-ms 700] [--speed 10]\n"
+            "  Runs app_main's boot graph with stub phases, sequentially and in\n"
+            "  parallel, and prints both timelines.\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    int workers = CONFIG_BOOT_GRAPH_WORKERS;
+    uint32_t wifi_ms = 2500;
+    uint32_t sntp_ms = 700;
+    double speed = 10.0;
+
+    static const struct option long_opts[] = {
+        { "workers", required_argument, NULL, 'w' },
+        { "wifi-ms", required_argument, NULL, 'i' },
+        { "sntp-ms", required_argument, NULL, 'n' },
+        { "speed",   required_argument, NULL, 's' },
+        { NULL, 0, NULL, 0 },
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", long_opts, NULL)) != -1) {
+        switch (opt) {
+            case 'w':
+                workers = atoi(optarg);
+                break;
+            case 'i':
+                wifi_ms = (uint32_t)atoi(optarg);
+                break;
+            case 'n':
+                sntp_ms = (uint32_t)atoi(optarg);
+                break;
+            case 's':
+                speed = atof(optarg);
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+    if (workers < 1 || workers > BOOT_GRAPH_MAX_WORKERS || speed <= 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    host_clock_set_speed(speed);
+    host_log_set_level(ESP_LOG_INFO);
+    host_task_register_current("main");
+    s_cores = xSemaphoreCreateCounting(portNUM_PROCESSORS, portNUM_PROCESSORS);
+    s_cost[BOOT_TIME].wait_ms = wifi_ms + sntp_ms;
+
+    // Legacy: the same phases chained in table order on one worker
+    boot_phase_t legacy_phases[BOOT_PHASE_MAX];
+    for (size_t i = 0; i < BOOT_PHASE_MAX; i++) {
+        legacy_phases[i] = s_graph[i];
+        legacy_phases[i].deps = i ? BOOT_DEP(i - 1) : 0;
+    }
+    boot_graph_config_t legacy_cfg = {
+        .phases = legacy_phases,
+        .phase_count = BOOT_PHASE_MAX,
+        .milestones = s_legacy_milestones,
+        .milestone_count = MILESTONE_COUNT,
+        .workers = 1,
+    };
+    boot_graph_config_t graph_cfg = {
+        .phases = s_graph,
+        .phase_count = BOOT_PHASE_MAX,
+        .milestones = s_milestones,
+        .milestone_count = MILESTONE_COUNT,
+        .workers = (uint8_t)workers,
+    };
+    static boot_graph_result_t legacy;
+    static boot_graph_result_t graph;
+
+    printf("== legacy (sequential) ==\n");
+    fflush(stdout);
+    if (boot_graph_run(&legacy_cfg, &legacy) != ESP_OK) {
+        printf("FAIL: legacy boot failed\n");
+        return 1;
+    }
+    boot_graph_print(&legacy_cfg, &legacy);
+
+    printf("== graph (%d workers) ==\n", workers);
+    fflush(stdout);
+    if (boot_graph_run(&graph_cfg, &graph) != ESP_OK) {
+        printf("FAIL: graph boot failed\n");
+        return 1;
+    }
+    boot_graph_print(&graph_cfg, &graph);
+
+    printf("\n%-20s %10s %10s\n", "milestone", "legacy ms", "graph ms");
+    const char *why = check_order(&graph_cfg, &graph);
+    for (size_t i = 0; i < MILESTONE_COUNT; i++) {
+        int32_t before = boot_graph_milestone_ms(&legacy, i);
+        int32_t after = boot_graph_milestone_ms(&graph, i);
+        printf("%-20s %10ld %10ld\n", s_milestones[i].name, (long)before, (long)after);
+        // Slack for host scheduling jitter, which a one-worker run is all about
+        if (!why && (after < 0 || after > before + before / 100 + 5)) {
+            why = "milestone later than the sequential boot";
+        }
+    }
+    printf("\n");
+
+    host_log_set_level(ESP_LOG_WARN);
+    if (!why) {
+        why = run_failure((uint8_t)workers);
+    }
+    if (!why) {
+        why = run_cycle();
+    }
+    if (why) {
+        printf("FAIL: %s\n", why);
+        return 1;
+    }
+    return 0;
+}
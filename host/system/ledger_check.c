@@ -0,0 +1,266 @@
+/**
+ * @file ledger_check.c
+ * @brief latency_ledger: recording, percentiles and the save / load round trip
+ *
+ * Turns are driven through the public API on a fake clock, so every
+ * interval is exact. Percentiles are compared with the exact ones over the
+ * recorded values: buckets are a quarter octave wide and reported at their
+ * midpoint, so each must be within 12.5 % (plus a millisecond of rounding).
+ * Then the table is saved, the ledger deinitialized and initialized again
+ * (host builds persist to memory), and everything but the last-turn values
+ * must come back unchanged. A run of LATENCY_LEDGER_SAVE_EVERY turns must
+ * then reach flash through the ledger's save thread alone, and a last run
+ * records turns while other threads keep saving: the reloaded table must
+ * hold every turn.
+ *
+ *   ledger_check [--turns 1000]
+ *
+ * Exits non-zero on the first mismatch.
+ */
+
+#include "latency_ledger.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+static int64_t s_now_us;
+
+static int64_t fake_clock(void)
+{
+    return s_now_us;
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief One turn with the first audio after audio_ms and the response after done_ms
+ */
+static void record_turn(uint32_t audio_ms, uint32_t done_ms)
+{
+    latency_ledger_begin_turn(LATENCY_PROVIDER_WEBRTC);
+    int64_t start = s_now_us;
+    s_now_us = start + (int64_t)audio_ms * 1000;
+    latency_ledger_mark(LATENCY_MARK_FIRST_AUDIO_DELTA);
+    s_now_us = start + (int64_t)done_ms * 1000;
+    latency_ledger_mark(LATENCY_MARK_RESPONSE_DONE);
+    latency_ledger_end_turn();
+    s_now_us += 1000000;
+}
+
+static uint32_t exact_percentile(const uint32_t *sorted, uint32_t n, uint32_t pct)
+{
+    uint32_t rank = (uint32_t)(((uint64_t)n * pct + 99) / 100);
+    return sorted[rank ? rank - 1 : 0];
+}
+
+static bool close_enough(uint32_t got, uint32_t want)
+{
+    uint32_t diff = got > want ? got - want : want - got;
+    return diff <= want / 8 + 1;
+}
+
+static const char *check_stats(latency_mark_t mark, const uint32_t *values, uint32_t n)
+{
+    uint32_t *sorted = malloc(n * sizeof(uint32_t));
+    memcpy(sorted, values, n * sizeof(uint32_t));
+    qsort(sorted, n, sizeof(uint32_t), cmp_u32);
+
+    latency_stats_t st;
+    latency_ledger_get_stats(LATENCY_PROVIDER_WEBRTC, mark, &st);
+    static const uint32_t pcts[] = { 50, 90, 99 };
+    const uint32_t got[] = { st.p50_ms, st.p90_ms, st.p99_ms };
+    const char *why = NULL;
+    if (st.count != n) {
+        printf("  %s: %lu turns, expected %lu\n", latency_ledger_mark_to_string(mark),
+               (unsigned long)st.count, (unsigned long)n);
+        why = "turn count";
+    }
+    for (int i = 0; i < 3 && !why; i++) {
+        uint32_t want = exact_percentile(sorted, n, pcts[i]);
+        printf("  %-18s p%-2lu %6lu ms (exact %lu)\n", latency_ledger_mark_to_string(mark),
+               (unsigned long)pcts[i], (unsigned long)got[i], (unsigned long)want);
+        if (!close_enough(got[i], want)) {
+            why = "percentile off by more than a bucket";
+        }
+    }
+    free(sorted);
+    return why;
+}
+
+static bool same_stats(const latency_stats_t *a, const latency_stats_t *b)
+{
+    return a->count == b->count && a->p50_ms == b->p50_ms && a->p90_ms == b->p90_ms &&
+           a->p99_ms == b->p99_ms;
+}
+
+// ============================================
+// Background Save
+// ============================================
+
+static const char *run_background(void)
+{
+    latency_ledger_reset();
+    for (uint32_t i = 0; i < LATENCY_LEDGER_SAVE_EVERY; i++) {
+        record_turn(200, 1200);
+    }
+    // end_turn only wakes the save thread; give it time to write
+    usleep(200 * 1000);
+
+    latency_ledger_deinit();
+    latency_ledger_init();
+    latency_stats_t st;
+    latency_ledger_get_stats(LATENCY_PROVIDER_WEBRTC, LATENCY_MARK_RESPONSE_DONE, &st);
+    printf("background save: %lu of %d turns reloaded\n", (unsigned long)st.count, LATENCY_LEDGER_SAVE_EVERY);
+    return st.count == LATENCY_LEDGER_SAVE_EVERY ? NULL : "due save not written by the save thread";
+}
+
+// ============================================
+// Concurrent Saves
+// ============================================
+
+static atomic_bool s_saving;
+static atomic_uint s_saves;
+
+static void *save_thread(void *arg)
+{
+    (void)arg;
+    while (atomic_load(&s_saving)) {
+        if (latency_ledger_save() == ESP_OK) {
+            atomic_fetch_add(&s_saves, 1);
+        }
+    }
+    return NULL;
+}
+
+static const char *run_concurrent(uint32_t turns)
+{
+    latency_ledger_reset();
+    atomic_store(&s_saving, true);
+    pthread_t threads[2];
+    for (int i = 0; i < 2; i++) {
+        pthread_create(&threads[i], NULL, save_thread, NULL);
+    }
+    for (uint32_t i = 0; i < turns; i++) {
+        record_turn(100 + i % 400, 900 + i % 400);
+    }
+    atomic_store(&s_saving, false);
+    for (int i = 0; i < 2; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    latency_ledger_save();
+
+    latency_ledger_deinit();
+    latency_ledger_init();
+    latency_stats_t st;
+    latency_ledger_get_stats(LATENCY_PROVIDER_WEBRTC, LATENCY_MARK_RESPONSE_DONE, &st);
+    printf("concurrent: %lu turns recorded during %u saves, %lu reloaded\n", (unsigned long)turns,
+           atomic_load(&s_saves), (unsigned long)st.count);
+    return st.count == turns ? NULL : "turns lost across concurrent saves";
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char **argv)
+{
+    uint32_t turns = 1000;
+
+    static const struct option long_opts[] = {
+        { "turns", required_argument, NULL, 't' },
+        { NULL, 0, NULL, 0 },
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", long_opts, NULL)) != -1) {
+        switch (opt) {
+            case 't':
+                turns = (uint32_t)atoi(optarg);
+                break;
+            default:
+                fprintf(stderr, "usage: %s [--turns 1000]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (turns < 10) {
+        fprintf(stderr, "usage: %s [--turns 1000]\n", argv[0]);
+        return 2;
+    }
+
+    latency_ledger_set_clock(fake_clock);
+    latency_ledger_init();
+    latency_ledger_reset();
+
+    // Skewed like real turns: most fast, a long tail
+    uint32_t *audio = malloc(turns * sizeof(uint32_t));
+    uint32_t *done = malloc(turns * sizeof(uint32_t));
+    srandom(7);
+    for (uint32_t i = 0; i < turns; i++) {
+        audio[i] = 300 + (uint32_t)(random() % 400) + ((i % 10 == 0) ? (uint32_t)(random() % 4000) : 0);
+        done[i] = audio[i] + 500 + (uint32_t)(random() % 6000);
+        record_turn(audio[i], done[i]);
+    }
+
+    // Neither an aborted turn nor one without a voice end is recorded
+    latency_ledger_begin_turn(LATENCY_PROVIDER_WEBRTC);
+    latency_ledger_mark(LATENCY_MARK_FIRST_AUDIO_DELTA);
+    latency_ledger_abort_turn();
+    latency_ledger_mark(LATENCY_MARK_RESPONSE_DONE);
+    latency_ledger_end_turn();
+
+    printf("%lu turns:\n", (unsigned long)turns);
+    const char *why = check_stats(LATENCY_MARK_FIRST_AUDIO_DELTA, audio, turns);
+    if (!why) {
+        why = check_stats(LATENCY_MARK_RESPONSE_DONE, done, turns);
+    }
+    latency_stats_t before[LATENCY_MARK_MAX];
+    for (int m = LATENCY_MARK_VOICE_END + 1; m < LATENCY_MARK_MAX && !why; m++) {
+        latency_ledger_get_stats(LATENCY_PROVIDER_WEBRTC, (latency_mark_t)m, &before[m]);
+    }
+    if (!why && before[LATENCY_MARK_RESPONSE_DONE].last_ms != done[turns - 1]) {
+        why = "last turn not reported";
+    }
+
+    // Round trip: everything persisted except the per-boot last values
+    if (!why && latency_ledger_save() != ESP_OK) {
+        why = "save failed";
+    }
+    if (!why) {
+        latency_ledger_deinit();
+        latency_ledger_init();
+        for (int m = LATENCY_MARK_VOICE_END + 1; m < LATENCY_MARK_MAX && !why; m++) {
+            latency_stats_t after;
+            latency_ledger_get_stats(LATENCY_PROVIDER_WEBRTC, (latency_mark_t)m, &after);
+            if (!same_stats(&before[m], &after) || after.last_ms != 0) {
+                why = "table changed across save and reload";
+            }
+        }
+        if (!why) {
+            printf("save / reload: %lu turns, percentiles unchanged\n",
+                   (unsigned long)before[LATENCY_MARK_RESPONSE_DONE].count);
+        }
+    }
+
+    if (!why) {
+        why = run_background();
+    }
+    if (!why) {
+        why = run_concurrent(turns);
+    }
+    free(audio);
+    free(done);
+    if (why) {
+        printf("FAIL: %s\n", why);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,504 @@
+/**
+ * @file sysinfo_check.c
+ * @brief system_info polling: I2C transactions and carousel redraws per minute
+ *
+ * The AXP2101, PCF85063 and app_wifi are stubbed: the PMU and RTC count I2C
+ * transactions (XPowersLib issues about 14 register reads per
+ * axp2101_get_info(), the RTC one burst read), and a simulated device
+ * drifts underneath them once per second: heap churn with a spike every
+ * conversation turn, a slowly draining battery, PMU temperature and RSSI
+ * noise, and a wall clock that crosses midnight.
+ *
+ * The legacy run is the old behaviour: every source read every second and
+ * all carousel labels set every 2 s. The second run is system_info itself
+ * with a subscriber that updates the carousel as ui_info_carousel does,
+ * only for changed groups and only labels whose text changed. Label sets
+ * on the tile on screen (auto-rotating every 5 s) are what LVGL redraws.
+ *
+ *   sysinfo_check [--minutes 10] [--speed 200]
+ *
+ * Exits non-zero when the notified clock is off by more than a second,
+ * the notified heap or battery lags the device past its threshold, or the
+ * new path does more I2C or redraws than the old one.
+ */
+
+#include "system_info.h"
+#include "axp2101_driver.h"
+#include "pcf85063_driver.h"
+#include "app_wifi.h"
+#include "host_shim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <getopt.h>
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+
+#define AXP_INFO_READS          14          // Register reads per axp2101_get_info()
+#define OLD_POLL_MS             1000        // Old poll_task period
+#define OLD_CAROUSEL_MS         2000        // Old ui_manager carousel timer
+#define AUTO_ROTATE_MS          5000        // ui_info_carousel auto-rotation
+#define TURN_EVERY_S            45          // A conversation turn allocates for a while
+#define START_EPOCH             1792281440  // 2026-10-17 23:57:20 UTC
+
+// Allowed lag of notified values behind the device
+#define HEAP_LAG_MAX            (8 * 1024)
+#define BATTERY_LAG_MAX         1
+
+// ============================================
+// Simulated Device
+// ============================================
+
+static struct {
+    size_t heap_used;
+    uint8_t battery_percent;
+    uint32_t battery_drain_s;       // Seconds until the next percent
+    float temperature_c;
+    int8_t rssi;
+    int64_t rtc_phase_us;           // RTC second boundary vs esp_timer
+} s_dev;
+
+static atomic_uint s_axp_reads;
+static atomic_uint s_rtc_reads;
+
+static void device_reset(void)
+{
+    srandom(1);
+    s_dev.heap_used = 180 * 1024;
+    s_dev.battery_percent = 76;
+    s_dev.battery_drain_s = 0;
+    s_dev.temperature_c = 38.0f;
+    s_dev.rssi = -58;
+    s_dev.rtc_phase_us = 370000;
+    host_heap_set_used(s_dev.heap_used);
+    atomic_store(&s_axp_reads, 0);
+    atomic_store(&s_rtc_reads, 0);
+}
+
+static int noise(int span)
+{
+    return (int)(random() % (2 * span + 1)) - span;
+}
+
+/**
+ * @brief Advance the device by one second
+ */
+static void device_step(uint32_t second)
+{
+    size_t base = 180 * 1024 + ((second % TURN_EVERY_S) < 12 ? 24 * 1024 : 0);
+    s_dev.heap_used = base + (size_t)(noise(3) * 512 + 1536);
+    host_heap_set_used(s_dev.heap_used);
+
+    if (++s_dev.battery_drain_s >= 200 && s_dev.battery_percent > 0) {
+        s_dev.battery_percent--;
+        s_dev.battery_drain_s = 0;
+    }
+    s_dev.temperature_c += noise(2) * 0.1f;
+    s_dev.rssi = (int8_t)(-58 + noise(2));
+}
+
+static void device_wall_clock(int64_t now_us, struct tm *tm)
+{
+    time_t t = START_EPOCH + (time_t)((now_us + s_dev.rtc_phase_us) / 1000000);
+    gmtime_r(&t, tm);
+}
+
+// Driver stubs
+
+esp_err_t axp2101_get_info(axp2101_info_t *info)
+{
+    atomic_fetch_add(&s_axp_reads, AXP_INFO_READS);
+    memset(info, 0, sizeof(*info));
+    info->percent = s_dev.battery_percent;
+    info->voltage_mv = (uint16_t)(3300 + s_dev.battery_percent * 9);
+    info->is_battery_present = true;
+    info->temperature_c = s_dev.temperature_c;
+    return ESP_OK;
+}
+
+esp_err_t pcf85063_get_datetime(pcf85063_datetime_t *dt)
+{
+    atomic_fetch_add(&s_rtc_reads, 1);
+    struct tm tm;
+    device_wall_clock(esp_timer_get_time(), &tm);
+    dt->year = (uint16_t)(tm.tm_year + 1900);
+    dt->month = (uint8_t)(tm.tm_mon + 1);
+    dt->day = (uint8_t)tm.tm_mday;
+    dt->weekday = (uint8_t)tm.tm_wday;
+    dt->hour = (uint8_t)tm.tm_hour;
+    dt->minute = (uint8_t)tm.tm_min;
+    dt->second = (uint8_t)tm.tm_sec;
+    return ESP_OK;
+}
+
+bool app_wifi_is_connected(void)
+{
+    return true;
+}
+
+int8_t app_wifi_get_rssi(void)
+{
+    return s_dev.rssi;
+}
+
+esp_err_t app_wifi_get_ip_string(char *buffer, size_t size)
+{
+    snprintf(buffer, size, "192.168.1.42");
+    return ESP_OK;
+}
+
+// ============================================
+// Carousel Model (ui_info_carousel.c)
+// ============================================
+
+enum { TILE_WIFI, TILE_BATTERY, TILE_MEMORY, TILE_TEMPERATURE, TILE_GPS, TILE_DATETIME, TILE_MAX };
+
+typedef struct {
+    char text[48];
+} label_t;
+
+typedef struct {
+    label_t labels[TILE_MAX][3];
+    label_t icons[TILE_MAX];        // Symbol and color, as one string
+    bool force;                     // Old path: set whether changed or not
+    uint32_t sets;                  // lv_label_set_text / lv_obj_set_style_text_color calls
+    uint32_t visible_sets;          // ... on the tile on screen
+    uint32_t tile_on_screen;
+} carousel_t;
+
+static void set_label(carousel_t *c, int tile, label_t *label, const char *text)
+{
+    if (!c->force && strcmp(label->text, text) == 0) {
+        return;
+    }
+    snprintf(label->text, sizeof(label->text), "%s", text);
+    c->sets++;
+    if ((uint32_t)tile == c->tile_on_screen) {
+        c->visible_sets++;
+    }
+}
+
+static void set_icon(carousel_t *c, int tile, const char *symbol, const char *color)
+{
+    // Symbol and color are two calls on the firmware when both change
+    char text[48];
+    snprintf(text, sizeof(text), "%s/%s", symbol ? symbol : "-", color);
+    if (!c->force && strcmp(c->icons[tile].text, text) == 0) {
+        return;
+    }
+    set_label(c, tile, &c->icons[tile], text);
+}
+
+static void carousel_apply(carousel_t *c, const system_info_t *info, uint32_t changed)
+{
+    char buf[64];
+
+    if (changed & SYSTEM_INFO_MASK(SYSTEM_INFO_WIFI)) {
+        set_label(c, TILE_WIFI, &c->labels[TILE_WIFI][0], info->wifi_ssid[0] ? info->wifi_ssid : "Connected");
+        set_icon(c, TILE_WIFI, NULL, "secondary");
+        snprintf(buf, sizeof(buf), "Signal: %s (%d dBm)", system_info_rssi_to_string(info->wifi_rssi),
+                 info->wifi_rssi);
+        set_label(c, TILE_WIFI, &c->labels[TILE_WIFI][1], buf);
+    }
+    if (changed & SYSTEM_INFO_MASK(SYSTEM_INFO_BATTERY)) {
+        snprintf(buf, sizeof(buf), "%d%%", info->battery_percent);
+        set_label(c, TILE_BATTERY, &c->labels[TILE_BATTERY][0], buf);
+        set_label(c, TILE_BATTERY, &c->labels[TILE_BATTERY][1],
+                  system_info_battery_status(info->battery_percent, info->battery_charging));
+        set_icon(c, TILE_BATTERY, info->battery_percent < 80 ? "battery_3" : "battery_full", "secondary");
+
+        snprintf(buf, sizeof(buf), "%.1f°C", info->temperature_c);
+        set_label(c, TILE_TEMPERATURE, &c->labels[TILE_TEMPERATURE][0], buf);
+        set_icon(c, TILE_TEMPERATURE, NULL, info->temperature_c > 45 ? "thinking" : "secondary");
+        set_label(c, TILE_TEMPERATURE, &c->labels[TILE_TEMPERATURE][1],
+                  info->temperature_c > 45 ? "Warm" : "Normal");
+    }
+    if (changed & SYSTEM_INFO_MASK(SYSTEM_INFO_MEMORY)) {
+        snprintf(buf, sizeof(buf), "%d%%", info->heap_usage_percent);
+        set_label(c, TILE_MEMORY, &c->labels[TILE_MEMORY][0], buf);
+        snprintf(buf, sizeof(buf), "Free: %lu KB", (unsigned long)(info->free_heap / 1024));
+        set_label(c, TILE_MEMORY, &c->labels[TILE_MEMORY][1], buf);
+        set_icon(c, TILE_MEMORY, NULL, info->heap_usage_percent > 70 ? "thinking" : "accent");
+    }
+    if (changed & SYSTEM_INFO_MASK(SYSTEM_INFO_GPS)) {
+        set_label(c, TILE_GPS, &c->labels[TILE_GPS][0], "Not Available");
+        set_label(c, TILE_GPS, &c->labels[TILE_GPS][1], "");
+        set_icon(c, TILE_GPS, NULL, "dim");
+    }
+    if (changed & SYSTEM_INFO_MASK(SYSTEM_INFO_RTC)) {
+        snprintf(buf, sizeof(buf), "%02d:%02d:%02d", info->rtc_hour, info->rtc_minute, info->rtc_second);
+        set_label(c, TILE_DATETIME, &c->labels[TILE_DATETIME][0], buf);
+        snprintf(buf, sizeof(buf), "%04d/%02d/%02d", info->rtc_year, info->rtc_month, info->rtc_day);
+        set_label(c, TILE_DATETIME, &c->labels[TILE_DATETIME][1], buf);
+        snprintf(buf, sizeof(buf), "weekday %d", info->rtc_weekday);
+        set_label(c, TILE_DATETIME, &c->labels[TILE_DATETIME][2], buf);
+    }
+}
+
+// ============================================
+// Runs
+// ============================================
+
+typedef struct {
+    uint32_t seconds;
+    uint32_t axp_reads;
+    uint32_t rtc_reads;
+    uint32_t notifies[SYSTEM_INFO_FIELD_MAX];
+    uint32_t label_sets;
+    uint32_t visible_sets;
+    int64_t clock_err_max_s;
+    size_t heap_lag_max;
+    int battery_lag_max;
+} run_result_t;
+
+static carousel_t s_carousel;
+static run_result_t s_result;
+static system_info_t s_shown;           // What the carousel shows
+static atomic_bool s_have_shown;
+
+static void check_clock(const system_info_t *info)
+{
+    struct tm tm;
+    device_wall_clock(esp_timer_get_time(), &tm);
+    struct tm shown = {
+        .tm_year = info->rtc_year - 1900,
+        .tm_mon = info->rtc_month - 1,
+        .tm_mday = info->rtc_day,
+        .tm_hour = info->rtc_hour,
+        .tm_min = info->rtc_minute,
+        .tm_sec = info->rtc_second,
+    };
+    int64_t err = (int64_t)timegm(&tm) - (int64_t)timegm(&shown);
+    if (err < 0) {
+        err = -err;
+    }
+    if (err > s_result.clock_err_max_s) {
+        s_result.clock_err_max_s = err;
+    }
+}
+
+/**
+ * @brief Once per second: how far the shown values lag the device
+ */
+static void check_lag(void)
+{
+    if (!atomic_load(&s_have_shown)) {
+        return;
+    }
+    size_t free_now = HOST_HEAP_INTERNAL_SIZE - s_dev.heap_used;
+    size_t lag = free_now > s_shown.free_heap ? free_now - s_shown.free_heap : s_shown.free_heap - free_now;
+    if (lag > s_result.heap_lag_max) {
+        s_result.heap_lag_max = lag;
+    }
+    int battery_lag = abs((int)s_dev.battery_percent - (int)s_shown.battery_percent);
+    if (battery_lag > s_result.battery_lag_max) {
+        s_result.battery_lag_max = battery_lag;
+    }
+}
+
+static void update_tile_on_screen(uint32_t second)
+{
+    s_carousel.tile_on_screen = (second * 1000 / AUTO_ROTATE_MS) % TILE_MAX;
+}
+
+/**
+ * @brief Old system_info poll_task and 2 s carousel timer, inline
+ */
+static void run_legacy(uint32_t seconds)
+{
+    memset(&s_carousel, 0, sizeof(s_carousel));
+    memset(&s_result, 0, sizeof(s_result));
+    s_carousel.force = true;
+    device_reset();
+
+    system_info_t info = {.wifi_connected = true, .total_heap = HOST_HEAP_INTERNAL_SIZE};
+    for (uint32_t second = 0; second < seconds; second++) {
+        device_step(second);
+        update_tile_on_screen(second);
+
+        axp2101_info_t batt;
+        axp2101_get_info(&batt);
+        info.battery_percent = batt.percent;
+        info.temperature_c = batt.temperature_c;
+        pcf85063_datetime_t dt;
+        pcf85063_get_datetime(&dt);
+        info.rtc_year = dt.year;
+        info.rtc_month = dt.month;
+        info.rtc_day = dt.day;
+        info.rtc_weekday = dt.weekday;
+        info.rtc_hour = dt.hour;
+        info.rtc_minute = dt.minute;
+        info.rtc_second = dt.second;
+        info.wifi_rssi = app_wifi_get_rssi();
+        snprintf(info.wifi_ssid, sizeof(info.wifi_ssid), "host-ap");
+        info.free_heap = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+        info.heap_usage_percent = (uint8_t)((info.total_heap - info.free_heap) * 100 / info.total_heap);
+
+        if ((second * OLD_POLL_MS) % OLD_CAROUSEL_MS == 0) {
+            carousel_apply(&s_carousel, &info, SYSTEM_INFO_MASK_ALL);
+            s_shown = info;
+            atomic_store(&s_have_shown, true);
+            check_clock(&info);
+        }
+        check_lag();
+        host_clock_sleep_us(1000000);
+    }
+    s_result.seconds = seconds;
+    s_result.axp_reads = atomic_load(&s_axp_reads);
+    s_result.rtc_reads = atomic_load(&s_rtc_reads);
+    s_result.label_sets = s_carousel.sets;
+    s_result.visible_sets = s_carousel.visible_sets;
+    for (int f = 0; f < SYSTEM_INFO_FIELD_MAX; f++) {
+        s_result.notifies[f] = seconds * OLD_POLL_MS / OLD_CAROUSEL_MS;
+    }
+}
+
+static void on_change(const system_info_t *info, uint32_t changed, void *ctx)
+{
+    (void)ctx;
+    for (int f = 0; f < SYSTEM_INFO_FIELD_MAX; f++) {
+        if (changed & SYSTEM_INFO_MASK(f)) {
+            s_result.notifies[f]++;
+        }
+    }
+    carousel_apply(&s_carousel, info, changed);
+    if (changed & SYSTEM_INFO_MASK(SYSTEM_INFO_MEMORY)) {
+        s_shown.free_heap = info->free_heap;
+    }
+    if (changed & SYSTEM_INFO_MASK(SYSTEM_INFO_BATTERY)) {
+        s_shown.battery_percent = info->battery_percent;
+    }
+    if (changed & SYSTEM_INFO_MASK(SYSTEM_INFO_RTC)) {
+        check_clock(info);
+    }
+    atomic_store(&s_have_shown, true);
+}
+
+static bool run_subscribed(uint32_t seconds)
+{
+    memset(&s_carousel, 0, sizeof(s_carousel));
+    memset(&s_result, 0, sizeof(s_result));
+    memset(&s_shown, 0, sizeof(s_shown));
+    atomic_store(&s_have_shown, false);
+    device_reset();
+
+    if (system_info_init() != ESP_OK || system_info_subscribe(SYSTEM_INFO_MASK_ALL, on_change, NULL) != ESP_OK) {
+        fprintf(stderr, "system_info init failed\n");
+        return false;
+    }
+    // The poll task wakes on whole seconds; step the device half-way between
+    host_clock_sleep_us(500000);
+    for (uint32_t second = 0; second < seconds; second++) {
+        device_step(second);
+        update_tile_on_screen(second);
+        host_clock_sleep_us(1000000);
+        check_lag();
+    }
+    system_info_unsubscribe(on_change, NULL);
+    system_info_deinit();
+
+    s_result.seconds = seconds;
+    s_result.axp_reads = atomic_load(&s_axp_reads);
+    s_result.rtc_reads = atomic_load(&s_rtc_reads);
+    s_result.label_sets = s_carousel.sets;
+    s_result.visible_sets = s_carousel.visible_sets;
+    return true;
+}
+
+// ============================================
+// Main
+// ============================================
+
+static void report(const char *name, const run_result_t *r)
+{
+    double per_min = 60.0 / r->seconds;
+    printf("%-10s %9.0f %9.0f %9.0f %12.1f %12.1f   ", name, (r->axp_reads + r->rtc_reads) * per_min,
+           r->axp_reads * per_min, r->rtc_reads * per_min, r->label_sets * per_min, r->visible_sets * per_min);
+    for (int f = 0; f < SYSTEM_INFO_FIELD_MAX; f++) {
+        printf("%5.1f", r->notifies[f] * per_min);
+    }
+    printf("   %2lld s %5zu B %2d %%\n", (long long)r->clock_err_max_s, r->heap_lag_max, r->battery_lag_max);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "usage: %s [--minutes 10] [--speed 200]\n"
+            "  --minutes N   simulated minutes per run\n"
+            "  --speed N     virtual clock speed\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t minutes = 10;
+    double speed = 200;
+    static const struct option long_opts[] = {
+        {"minutes", required_argument, NULL, 'm'},
+        {"speed", required_argument, NULL, 's'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", long_opts, NULL)) != -1) {
+        switch (opt) {
+            case 'm':
+                minutes = (uint32_t)atoi(optarg);
+                break;
+            case 's':
+                speed = atof(optarg);
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+    if (minutes < 1 || speed <= 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    host_clock_set_speed(speed);
+    host_log_set_level(ESP_LOG_WARN);
+    host_task_register_current("main");
+
+    printf("%u simulated minutes from 23:57:20, a turn every %d s, per minute:\n", minutes, TURN_EVERY_S);
+    printf("%-10s %9s %9s %9s %12s %12s   %-30s %s\n", "run", "I2C", "AXP2101", "PCF85063", "label sets",
+           "on screen", "notifies wifi/batt/mem/rtc/gps/lat", "clock / heap / battery lag");
+
+    run_result_t legacy;
+    run_legacy(minutes * 60);
+    legacy = s_result;
+    report("legacy", &legacy);
+
+    if (!run_subscribed(minutes * 60)) {
+        return 1;
+    }
+    run_result_t sub = s_result;
+    report("subscribed", &sub);
+
+    const char *why = NULL;
+    if (sub.clock_err_max_s > 1) {
+        why = "clock off by more than a second";
+    } else if (sub.heap_lag_max > HEAP_LAG_MAX) {
+        why = "heap figure lags the device";
+    } else if (sub.battery_lag_max > BATTERY_LAG_MAX) {
+        why = "battery figure lags the device";
+    } else if (sub.axp_reads + sub.rtc_reads > legacy.axp_reads + legacy.rtc_reads) {
+        why = "more I2C than before";
+    } else if (sub.visible_sets > legacy.visible_sets) {
+        why = "more redraws than before";
+    }
+    if (why) {
+        printf("FAIL: %s\n", why);
+        return 1;
+    }
+    printf("I2C %.1fx fewer, on-screen label sets %.1fx fewer\n",
+           (double)(legacy.axp_reads + legacy.rtc_reads) / (sub.axp_reads + sub.rtc_reads),
+           (double)legacy.visible_sets / (sub.visible_sets ? sub.visible_sets : 1));
+    return 0;
+}
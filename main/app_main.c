@@ -9,6 +9,10 @@
  * - Coze WebSocket client
  * - LVGL UI
  * - Application core state machine
+ *
+ * Initialization is a boot_graph of phases with their dependencies; phases
+ * that do not depend on each other run in parallel on both cores, and the
+ * boot timeline is logged when they are done.
  */
 
 #include <stdio.h>
@@ -40,6 +44,9 @@
 #include "app_wifi.h"
 #include "bsp_button.h"
 #include "debug_console.h"
+#include "latency_ledger.h"
+#include "boot_graph.h"
+#include "boot_phases.h"
 #include "media_lib_adapter.h"
 #include "media_lib_os.h"
 
@@ -251,7 +258,7 @@ static void webrtc_azure_event_callback(webrtc_azure_event_t *event, void *user_
             break;
 
         case WEBRTC_AZURE_EVENT_TRANSCRIPT:
-            if (event->transcript.text) {
+            if (event->transcript.text && !event->transcript.partial) {
                 ESP_LOGI(TAG, "📝 Transcript: %s", event->transcript.text);
             }
             break;
@@ -343,50 +350,65 @@ static esp_err_t sync_system_time(void)
     return ESP_OK;
 }
 
-/**
- * @brief Initialize all system components in proper order
- */
-static esp_err_t system_init(void)
-{
-    esp_err_t ret;
+// ============================================
+// Boot Phases
+// ============================================
 
-    // ==== Phase 1: Core System Initialization ====
-    ESP_LOGI(TAG, "========================================");
-    ESP_LOGI(TAG, "ESP32-S3 Coze Voice Agent Starting...");
-    ESP_LOGI(TAG, "========================================");
+// Set by the time phase, read by the WebRTC phase that depends on it
+static bool s_boot_wifi_connected = false;
+// TLS needs a valid clock: WebRTC is not started before a sync succeeded
+static bool s_time_synced = false;
 
-    // Initialize NVS
-    ret = init_nvs();
+static esp_err_t boot_nvs(void *arg)
+{
+    esp_err_t ret = init_nvs();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "NVS init failed: %s", esp_err_to_name(ret));
         return ret;
     }
     ESP_LOGI(TAG, "NVS initialized");
+    return ESP_OK;
+}
 
-    // Initialize event system
-    ret = init_event_system();
+static esp_err_t boot_ledger(void *arg)
+{
+    // Load persisted turn latency histograms (non-critical)
+    esp_err_t ret = latency_ledger_init();
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Latency ledger init failed: %s", esp_err_to_name(ret));
+    }
+    return ESP_OK;
+}
+
+static esp_err_t boot_events(void *arg)
+{
+    esp_err_t ret = init_event_system();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Event system init failed");
         return ret;
     }
     ESP_LOGI(TAG, "Event system initialized");
+    return ESP_OK;
+}
 
-    // ==== Phase 2: I2C Bus Initialization ====
+static esp_err_t boot_pmu(void *arg)
+{
     // I2C is initialized lazily by drivers via bsp_i2c_init() (new driver API)
-    ESP_LOGI(TAG, "I2C bus will be initialized by drivers (new API)");
-
-    // ==== Phase 2.1: PMU and RTC Initialization ====
     ESP_LOGI(TAG, "Initializing AXP2101 PMU...");
-    ret = axp2101_init(0, 15, 14);  // I2C_NUM_0, SDA=GPIO15, SCL=GPIO14
+    esp_err_t ret = axp2101_init(0, 15, 14);  // I2C_NUM_0, SDA=GPIO15, SCL=GPIO14
     if (ret != ESP_OK) {
         ESP_LOGW(TAG, "AXP2101 init failed (non-critical): %s", esp_err_to_name(ret));
         // Not critical, continue
     } else {
         ESP_LOGI(TAG, "AXP2101 PMU initialized (battery: %d%%)", axp2101_get_battery_percent());
     }
+    return ESP_OK;
+}
 
+static esp_err_t boot_rtc(void *arg)
+{
     ESP_LOGI(TAG, "Initializing PCF85063 RTC...");
-    ret = pcf85063_init(0, 15, 14);  // I2C_NUM_0, SDA=GPIO15, SCL=GPIO14
+    esp_err_t ret = pcf85063_init(0, 15, 14);  // I2C_NUM_0, SDA=GPIO15, SCL=GPIO14
     if (ret != ESP_OK) {
         ESP_LOGW(TAG, "PCF85063 init failed (non-critical): %s", esp_err_to_name(ret));
         // Not critical, continue
@@ -395,19 +417,25 @@ static esp_err_t system_init(void)
         pcf85063_get_time_str(time_str, sizeof(time_str));
         ESP_LOGI(TAG, "PCF85063 RTC initialized (time: %s)", time_str);
     }
+    return ESP_OK;
+}
 
-    // Initialize system info aggregator
-    ret = system_info_init();
+static esp_err_t boot_sysinfo(void *arg)
+{
+    esp_err_t ret = system_info_init();
     if (ret != ESP_OK) {
         ESP_LOGW(TAG, "System info init failed (non-critical): %s", esp_err_to_name(ret));
     } else {
         ESP_LOGI(TAG, "System info aggregator initialized");
     }
+    return ESP_OK;
+}
 
-    // ==== Phase 3: Display + LVGL Initialization ====
+static esp_err_t boot_display(void *arg)
+{
     // Using manual display initialization (bypasses BSP to fix SPI queue issue)
     ESP_LOGI(TAG, "Initializing display + LVGL (manual init)...");
-    ret = display_init();
+    esp_err_t ret = display_init();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Display init failed: %s", esp_err_to_name(ret));
         return ret;
@@ -421,8 +449,11 @@ static esp_err_t system_init(void)
     s_lv_indev = NULL;
     ESP_LOGW(TAG, "Touch input not available (manual display init)");
     ESP_LOGI(TAG, "Display + LVGL initialized (manual)");
+    return ESP_OK;
+}
 
-    // ==== Phase 4: Audio Initialization (TDM mode for AEC) ====
+static esp_err_t boot_codec(void *arg)
+{
     ESP_LOGI(TAG, "Initializing audio with TDM mode for AEC...");
 
     // Initialize audio board using codec_board with TDM mode
@@ -440,17 +471,30 @@ static esp_err_t system_init(void)
     }
     ESP_LOGI(TAG, "Audio initialized with TDM mode: spk=%p, mic=%p", spk_handle, mic_handle);
     xEventGroupSetBits(g_system_event_group, AUDIO_READY_BIT);
+    return ESP_OK;
+}
 
-    // ==== Phase 5: UI Manager Initialization ====
+static esp_err_t boot_ui(void *arg)
+{
     ESP_LOGI(TAG, "Initializing UI manager...");
-    ret = ui_manager_init();
+    esp_err_t ret = ui_manager_init();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "UI manager init failed: %s", esp_err_to_name(ret));
         return ret;
     }
+
+    // Start the LVGL task now so the boot page renders while boot continues
+    ret = ui_manager_start_task();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start UI task: %s", esp_err_to_name(ret));
+        return ret;
+    }
     xEventGroupSetBits(g_system_event_group, UI_READY_BIT);
+    return ESP_OK;
+}
 
-    // ==== Phase 6: WiFi Initialization ====
+static esp_err_t boot_wifi(void *arg)
+{
     ESP_LOGI(TAG, "Initializing WiFi...");
 
     app_wifi_config_t wifi_cfg = {
@@ -459,12 +503,16 @@ static esp_err_t system_init(void)
         .event_callback = wifi_event_callback,
     };
 
-    ret = app_wifi_init(&wifi_cfg);
+    esp_err_t ret = app_wifi_init(&wifi_cfg);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "WiFi init failed: %s", esp_err_to_name(ret));
         return ret;
     }
+    return ESP_OK;
+}
 
+static esp_err_t boot_time(void *arg)
+{
     // Wait for WiFi connection (with timeout)
     EventBits_t bits = xEventGroupWaitBits(g_system_event_group,
                                            WIFI_CONNECTED_BIT | WIFI_FAIL_BIT,
@@ -481,31 +529,39 @@ static esp_err_t system_init(void)
 
     log_current_time("Before SNTP");
 
-    // ==== Phase 7: SNTP Time Sync ====
     if (bits & WIFI_CONNECTED_BIT) {
-        ret = sync_system_time();
-        if (ret != ESP_OK) {
-            ESP_LOGE(TAG, "Time sync failed; aborting to avoid TLS issues");
-            return ret;
+        // Not fatal this late in boot: only TLS needs the time, the main loop retries
+        if (sync_system_time() == ESP_OK) {
+            s_time_synced = true;
+            log_current_time("After SNTP");
+        } else {
+            ESP_LOGE(TAG, "Time sync failed; WebRTC waits for a later sync");
         }
-        log_current_time("After SNTP");
     } else {
         ESP_LOGW(TAG, "Skipping time sync (WiFi not connected)");
     }
+    s_boot_wifi_connected = (bits & WIFI_CONNECTED_BIT) != 0;
+    return ESP_OK;
+}
 
-    // ==== Phase 8: Audio Pipeline Initialization ====
+static esp_err_t boot_pipeline(void *arg)
+{
     ESP_LOGI(TAG, "Initializing audio pipeline...");
-    ret = audio_pipeline_init();
+    esp_err_t ret = audio_pipeline_init();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Audio pipeline init failed: %s", esp_err_to_name(ret));
         return ret;
     }
     ESP_LOGI(TAG, "Audio pipeline initialized");
+    return ESP_OK;
+}
 
-    // ==== Phase 9: WebRTC Azure Initialization (replaces old WebSocket Azure) ====
+static esp_err_t boot_webrtc(void *arg)
+{
     ESP_LOGI(TAG, "Adding media lib adapter...");
     media_lib_add_default_adapter();
 
+    // Builds the media system on the codec and prefetches a token over TLS
     ESP_LOGI(TAG, "Initializing WebRTC Azure module...");
     webrtc_azure_config_t webrtc_cfg = {
         .wifi_ssid = WIFI_SSID,
@@ -514,15 +570,15 @@ static esp_err_t system_init(void)
         .user_data = NULL,
     };
 
-    ret = webrtc_azure_init(&webrtc_cfg);
+    esp_err_t ret = webrtc_azure_init(&webrtc_cfg);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "WebRTC Azure init failed: %s", esp_err_to_name(ret));
         return ret;
     }
     ESP_LOGI(TAG, "WebRTC Azure module initialized");
 
-    // Start WebRTC if WiFi is already connected
-    if (bits & WIFI_CONNECTED_BIT) {
+    // Start WebRTC if WiFi is already connected and the clock is valid
+    if (s_boot_wifi_connected && s_time_synced) {
         ESP_LOGI(TAG, "Starting WebRTC connection...");
         ret = webrtc_azure_start();
         if (ret != ESP_OK) {
@@ -530,55 +586,56 @@ static esp_err_t system_init(void)
             // Not critical - will retry in main loop
         }
     }
+    return ESP_OK;
+}
 
-    // ==== Phase 9: Application Core Initialization ====
+static esp_err_t boot_core(void *arg)
+{
     ESP_LOGI(TAG, "Initializing application core...");
-    ret = app_core_init();
+    esp_err_t ret = app_core_init();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "App core init failed: %s", esp_err_to_name(ret));
         return ret;
     }
     ESP_LOGI(TAG, "Application core initialized");
+    return ESP_OK;
+}
 
-    // ==== Phase 10: Button Initialization ====
+static esp_err_t boot_button(void *arg)
+{
     ESP_LOGI(TAG, "Initializing BOOT button...");
-    ret = bsp_button_init(button_event_callback, NULL);
+    esp_err_t ret = bsp_button_init(button_event_callback, NULL);
     if (ret != ESP_OK) {
         ESP_LOGW(TAG, "Button init failed (non-critical): %s", esp_err_to_name(ret));
         // Not critical, continue
     } else {
         ESP_LOGI(TAG, "BOOT button initialized (GPIO 0)");
     }
+    return ESP_OK;
+}
 
-    // ==== Phase 11: Debug Console Initialization ====
+static esp_err_t boot_console(void *arg)
+{
     ESP_LOGI(TAG, "Initializing debug console...");
-    ret = debug_console_init();
+    esp_err_t ret = debug_console_init();
     if (ret != ESP_OK) {
         ESP_LOGW(TAG, "Debug console init failed (non-critical): %s", esp_err_to_name(ret));
         // Not critical, continue
     } else {
         ESP_LOGI(TAG, "Debug console initialized");
     }
-
     return ESP_OK;
 }
 
 /**
- * @brief Start all application tasks
+ * @brief Start the audio and application core tasks (the UI task runs already)
  */
-static esp_err_t start_application_tasks(void)
+static esp_err_t boot_tasks(void *arg)
 {
     ESP_LOGI(TAG, "Starting application tasks...");
 
-    // Start UI task (handles LVGL refresh and touch events)
-    esp_err_t ret = ui_manager_start_task();
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to start UI task: %s", esp_err_to_name(ret));
-        return ret;
-    }
-
     // Start audio tasks (recording and playback)
-    ret = audio_pipeline_start_tasks();
+    esp_err_t ret = audio_pipeline_start_tasks();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to start audio tasks");
         return ret;
@@ -605,6 +662,39 @@ static esp_err_t start_application_tasks(void)
     return ESP_OK;
 }
 
+// Phases and milestones are in boot_phases.h, shared with host/system/boot_check.c
+#define BOOT_PHASE_ENTRY(id, name, fn, deps)    [id] = { name, fn, NULL, deps },
+
+static const boot_phase_t s_boot_phases[BOOT_PHASE_MAX] = {
+    BOOT_PHASES(BOOT_PHASE_ENTRY)
+};
+
+static const boot_milestone_t s_boot_milestones[] = {
+    BOOT_MILESTONES(BOOT_MILESTONE_ENTRY)
+};
+
+/**
+ * @brief Initialize all system components, independent phases in parallel
+ */
+static esp_err_t system_init(void)
+{
+    ESP_LOGI(TAG, "========================================");
+    ESP_LOGI(TAG, "ESP32-S3 Coze Voice Agent Starting...");
+    ESP_LOGI(TAG, "========================================");
+
+    const boot_graph_config_t boot_cfg = {
+        .phases = s_boot_phases,
+        .phase_count = BOOT_PHASE_MAX,
+        .milestones = s_boot_milestones,
+        .milestone_count = sizeof(s_boot_milestones) / sizeof(s_boot_milestones[0]),
+    };
+    static boot_graph_result_t boot_result;
+
+    esp_err_t ret = boot_graph_run(&boot_cfg, &boot_result);
+    boot_graph_print(&boot_cfg, &boot_result);
+    return ret;
+}
+
 /**
  * @brief Main application entry point
  */
@@ -627,15 +717,6 @@ void app_main(void)
         }
     }
 
-    // Start all application tasks
-    ret = start_application_tasks();
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "❌ Failed to start application tasks!");
-        while (1) {
-            vTaskDelay(pdMS_TO_TICKS(1000));
-        }
-    }
-
     // Transition to idle state
     app_core_set_state(APP_STATE_IDLE);
 
@@ -674,9 +755,16 @@ void app_main(void)
         // Auto-connect WebRTC if WiFi is connected but WebRTC is not running
         // Use is_running() instead of is_connected() to avoid interrupting DTLS handshake
         if ((bits & WIFI_CONNECTED_BIT) && !webrtc_azure_is_running()) {
-            ESP_LOGI(TAG, "WiFi connected, starting WebRTC connection...");
-            log_current_time("WebRTC connect");
-            webrtc_azure_start();
+            if (!s_time_synced && sync_system_time() == ESP_OK) {
+                s_time_synced = true;
+            }
+            if (s_time_synced) {
+                ESP_LOGI(TAG, "WiFi connected, starting WebRTC connection...");
+                log_current_time("WebRTC connect");
+                webrtc_azure_start();
+            } else {
+                ESP_LOGW(TAG, "Time not synced, WebRTC start deferred");
+            }
         }
 
         // Query WebRTC status periodically
@@ -0,0 +1,61 @@
+/**
+ * @file boot_phases.h
+ * @brief app_main's boot graph: phases, dependencies and milestones
+ *
+ * Shared by system_init() in app_main.c and host/system/boot_check.c, so
+ * the host replays exactly the graph the device boots. Each user expands
+ * the lists with its own macro: app_main binds every phase to its boot_*
+ * function, boot_check to a stub with the phase's estimated cost.
+ *
+ * Dependencies are what each phase actually needs, plus one ordering
+ * constraint: the PMU, RTC and codec all probe I2C bus 0, so they run one
+ * after the other. The display is on its own QSPI bus and comes up
+ * alongside them, and nothing but WebRTC waits for Wi-Fi and SNTP.
+ */
+
+#pragma once
+
+#include "boot_graph.h"
+
+/**
+ * @brief Boot phases, in the order the old sequential boot ran them
+ *
+ * PHASE(id, name, fn, deps)
+ */
+#define BOOT_PHASES(PHASE) \
+    PHASE(BOOT_NVS,      "nvs",      boot_nvs,      0) \
+    PHASE(BOOT_LEDGER,   "ledger",   boot_ledger,   BOOT_DEP(BOOT_NVS)) \
+    PHASE(BOOT_EVENTS,   "events",   boot_events,   0) \
+    PHASE(BOOT_PMU,      "pmu",      boot_pmu,      0) \
+    PHASE(BOOT_RTC,      "rtc",      boot_rtc,      BOOT_DEP(BOOT_PMU)) \
+    PHASE(BOOT_SYSINFO,  "sysinfo",  boot_sysinfo,  BOOT_DEP(BOOT_LEDGER) | BOOT_DEP(BOOT_RTC)) \
+    PHASE(BOOT_DISPLAY,  "display",  boot_display,  0) \
+    PHASE(BOOT_CODEC,    "codec",    boot_codec,    BOOT_DEP(BOOT_EVENTS) | BOOT_DEP(BOOT_RTC)) \
+    PHASE(BOOT_UI,       "ui",       boot_ui,       BOOT_DEP(BOOT_EVENTS) | BOOT_DEP(BOOT_DISPLAY) | \
+                                                    BOOT_DEP(BOOT_SYSINFO)) \
+    PHASE(BOOT_WIFI,     "wifi",     boot_wifi,     BOOT_DEP(BOOT_NVS) | BOOT_DEP(BOOT_EVENTS)) \
+    PHASE(BOOT_TIME,     "time",     boot_time,     BOOT_DEP(BOOT_WIFI)) \
+    PHASE(BOOT_PIPELINE, "pipeline", boot_pipeline, BOOT_DEP(BOOT_CODEC)) \
+    PHASE(BOOT_WEBRTC,   "webrtc",   boot_webrtc,   BOOT_DEP(BOOT_TIME) | BOOT_DEP(BOOT_PIPELINE)) \
+    PHASE(BOOT_CORE,     "core",     boot_core,     BOOT_DEP(BOOT_PIPELINE) | BOOT_DEP(BOOT_UI)) \
+    PHASE(BOOT_BUTTON,   "button",   boot_button,   BOOT_DEP(BOOT_CORE)) \
+    PHASE(BOOT_CONSOLE,  "console",  boot_console,  BOOT_DEP(BOOT_CORE)) \
+    PHASE(BOOT_TASKS,    "tasks",    boot_tasks,    BOOT_DEP(BOOT_CORE))
+
+#define BOOT_PHASE_ID(id, name, fn, deps)   id,
+
+typedef enum {
+    BOOT_PHASES(BOOT_PHASE_ID)
+    BOOT_PHASE_MAX,
+} boot_phase_id_t;
+
+/**
+ * @brief Boot milestones
+ *
+ * MILESTONE(name, phases)
+ */
+#define BOOT_MILESTONES(MILESTONE) \
+    MILESTONE("interactive UI",     BOOT_DEP(BOOT_UI)) \
+    MILESTONE("conversation ready", BOOT_DEP(BOOT_TASKS) | BOOT_DEP(BOOT_BUTTON) | BOOT_DEP(BOOT_WEBRTC))
+
+#define BOOT_MILESTONE_ENTRY(name, phases)  { name, phases },